@@ -0,0 +1,623 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "/root/repo/CTestConfig.cmake"
+  "/root/repo/CTestCustom.cmake.in"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "bpls.cmake.gen"
+  "source/adios2/common/ADIOSConfig.h.in"
+  "testing/adios2/engine/staging-common/run_test.py.gen"
+  "thirdparty/EVPath/EVPath/EVPathConfig.cmake"
+  "thirdparty/EVPath/EVPath/EVPathConfigCommon.cmake"
+  "thirdparty/EVPath/EVPath/EVPathConfigVersion.cmake"
+  "thirdparty/atl/atl/atl-config-version.cmake"
+  "thirdparty/atl/atl/atl-config.cmake"
+  "thirdparty/dill/dill/dill-config-common.cmake"
+  "thirdparty/dill/dill/dill-config-version.cmake"
+  "thirdparty/dill/dill/dill-config.cmake"
+  "thirdparty/enet/enet/enet-config-version.cmake"
+  "thirdparty/enet/enet/enet-config.cmake"
+  "thirdparty/ffs/ffs/ffs-config-version.cmake"
+  "thirdparty/ffs/ffs/ffs-config.cmake"
+  "/root/repo/bindings/C/CMakeLists.txt"
+  "/root/repo/bindings/CMakeLists.txt"
+  "/root/repo/bindings/CXX11/CMakeLists.txt"
+  "/root/repo/cmake/ADIOSBisonFlexSub.cmake"
+  "/root/repo/cmake/ADIOSFunctions.cmake"
+  "/root/repo/cmake/CMakeFindDependencyMacro.cmake"
+  "/root/repo/cmake/CheckTypeRepresentation.cmake"
+  "/root/repo/cmake/DetectOptions.cmake"
+  "/root/repo/cmake/FindBZip2.cmake"
+  "/root/repo/cmake/FindDAOS.cmake"
+  "/root/repo/cmake/FindIME.cmake"
+  "/root/repo/cmake/FindPkgConfig.cmake"
+  "/root/repo/cmake/FindPython.cmake"
+  "/root/repo/cmake/FindSZ.cmake"
+  "/root/repo/cmake/FindSodium.cmake"
+  "/root/repo/cmake/FindZeroMQ.cmake"
+  "/root/repo/cmake/GoogleTest.cmake"
+  "/root/repo/cmake/adios2-config-common.cmake.in"
+  "/root/repo/cmake/adios2-config-install.cmake.in"
+  "/root/repo/cmake/adios2-config.cmake.in"
+  "/root/repo/cmake/install/packaging/CMakeLists.txt"
+  "/root/repo/cmake/install/post/CMakeLists.txt"
+  "/root/repo/cmake/install/post/adios2-config.post.sh.in"
+  "/root/repo/cmake/install/post/adios2-config.pre.sh.in"
+  "/root/repo/cmake/install/post/generate-adios2-config.sh.in"
+  "/root/repo/cmake/install/pre/CMakeLists.txt"
+  "/root/repo/cmake/upstream/GoogleTest.cmake"
+  "/root/repo/plugins/CMakeLists.txt"
+  "/root/repo/plugins/engines/CMakeLists.txt"
+  "/root/repo/plugins/operators/CMakeLists.txt"
+  "/root/repo/source/CMakeLists.txt"
+  "/root/repo/source/adios2/CMakeLists.txt"
+  "/root/repo/source/adios2/common/ADIOSConfig.h.in"
+  "/root/repo/source/utils/CMakeLists.txt"
+  "/root/repo/source/utils/adios_campaign_manager/CMakeLists.txt"
+  "/root/repo/source/utils/adios_reorganize/adios2_reorganize_wrapper"
+  "/root/repo/source/utils/bp4dbg/CMakeLists.txt"
+  "/root/repo/source/utils/bp5dbg/CMakeLists.txt"
+  "/root/repo/source/utils/bpls/bpls.cmake.gen.in"
+  "/root/repo/source/utils/verinfo.h.in"
+  "/root/repo/testing/CMakeLists.txt"
+  "/root/repo/testing/adios2/CMakeLists.txt"
+  "/root/repo/testing/adios2/backward_compatibility/CMakeLists.txt"
+  "/root/repo/testing/adios2/backward_compatibility/TestBP4ReadOldCompressed.cpp"
+  "/root/repo/testing/adios2/bindings/C/CMakeLists.txt"
+  "/root/repo/testing/adios2/bindings/C/TestBPMemorySpace.cpp"
+  "/root/repo/testing/adios2/bindings/C/TestBPWriteReadMultiblock.cpp"
+  "/root/repo/testing/adios2/bindings/C/TestBPWriteStatsOnly.cpp"
+  "/root/repo/testing/adios2/bindings/C/TestBPWriteTypes.cpp"
+  "/root/repo/testing/adios2/bindings/C/TestNullWriteRead.cpp"
+  "/root/repo/testing/adios2/bindings/CMakeLists.txt"
+  "/root/repo/testing/adios2/derived/CMakeLists.txt"
+  "/root/repo/testing/adios2/derived/TestBPDerivedCorrectness.cpp"
+  "/root/repo/testing/adios2/derived/TestBPDerivedCorrectnessMPI.cpp"
+  "/root/repo/testing/adios2/engine/CMakeLists.txt"
+  "/root/repo/testing/adios2/engine/bp/CMakeLists.txt"
+  "/root/repo/testing/adios2/engine/bp/TestBPAccuracyDefaults.cpp"
+  "/root/repo/testing/adios2/engine/bp/TestBPAppendAfterSteps.cpp"
+  "/root/repo/testing/adios2/engine/bp/TestBPBufferSize.cpp"
+  "/root/repo/testing/adios2/engine/bp/TestBPChangingShape.cpp"
+  "/root/repo/testing/adios2/engine/bp/TestBPChangingShapeWithinStep.cpp"
+  "/root/repo/testing/adios2/engine/bp/TestBPDirectIO.cpp"
+  "/root/repo/testing/adios2/engine/bp/TestBPFStreamWriteReadHighLevelAPI.cpp"
+  "/root/repo/testing/adios2/engine/bp/TestBPInquireDefine.cpp"
+  "/root/repo/testing/adios2/engine/bp/TestBPInquireVariableException.cpp"
+  "/root/repo/testing/adios2/engine/bp/TestBPJoinedArray.cpp"
+  "/root/repo/testing/adios2/engine/bp/TestBPLargeMetadata.cpp"
+  "/root/repo/testing/adios2/engine/bp/TestBPNoXMLRecovery.cpp"
+  "/root/repo/testing/adios2/engine/bp/TestBPOpenWithMetadata.cpp"
+  "/root/repo/testing/adios2/engine/bp/TestBPParameterSelectSteps.cpp"
+  "/root/repo/testing/adios2/engine/bp/TestBPReadMultithreaded.cpp"
+  "/root/repo/testing/adios2/engine/bp/TestBPSelectionsOnColumnMajorData.cpp"
+  "/root/repo/testing/adios2/engine/bp/TestBPSelectionsOnRowMajorData.cpp"
+  "/root/repo/testing/adios2/engine/bp/TestBPStepsFileGlobalArray.cpp"
+  "/root/repo/testing/adios2/engine/bp/TestBPStepsFileLocalArray.cpp"
+  "/root/repo/testing/adios2/engine/bp/TestBPStepsInSituGlobalArray.cpp"
+  "/root/repo/testing/adios2/engine/bp/TestBPStepsInSituLocalArray.cpp"
+  "/root/repo/testing/adios2/engine/bp/TestBPTimeAggregation.cpp"
+  "/root/repo/testing/adios2/engine/bp/TestBPWriteAppendReadADIOS2.cpp"
+  "/root/repo/testing/adios2/engine/bp/TestBPWriteFlushRead.cpp"
+  "/root/repo/testing/adios2/engine/bp/TestBPWriteMemorySelectionRead.cpp"
+  "/root/repo/testing/adios2/engine/bp/TestBPWriteMultiblockRead.cpp"
+  "/root/repo/testing/adios2/engine/bp/TestBPWriteNull.cpp"
+  "/root/repo/testing/adios2/engine/bp/TestBPWriteReadADIOS2.cpp"
+  "/root/repo/testing/adios2/engine/bp/TestBPWriteReadADIOS2fstream.cpp"
+  "/root/repo/testing/adios2/engine/bp/TestBPWriteReadADIOS2stdio.cpp"
+  "/root/repo/testing/adios2/engine/bp/TestBPWriteReadAsStreamADIOS2.cpp"
+  "/root/repo/testing/adios2/engine/bp/TestBPWriteReadAsStreamADIOS2_Threads.cpp"
+  "/root/repo/testing/adios2/engine/bp/TestBPWriteReadAttributes.cpp"
+  "/root/repo/testing/adios2/engine/bp/TestBPWriteReadAttributesMultirank.cpp"
+  "/root/repo/testing/adios2/engine/bp/TestBPWriteReadBlockInfo.cpp"
+  "/root/repo/testing/adios2/engine/bp/TestBPWriteReadLocalVariables.cpp"
+  "/root/repo/testing/adios2/engine/bp/TestBPWriteReadLocalVariablesSel.cpp"
+  "/root/repo/testing/adios2/engine/bp/TestBPWriteReadLocalVariablesSelHighLevel.cpp"
+  "/root/repo/testing/adios2/engine/bp/TestBPWriteReadMultiblock.cpp"
+  "/root/repo/testing/adios2/engine/bp/TestBPWriteReadVariableSpan.cpp"
+  "/root/repo/testing/adios2/engine/bp/TestBPWriteReadVector.cpp"
+  "/root/repo/testing/adios2/engine/bp/TestBPWriteStatsOnly.cpp"
+  "/root/repo/testing/adios2/engine/bp/operations/CMakeLists.txt"
+  "/root/repo/testing/adios2/engine/bp/operations/TestBPWriteReadBZIP2.cpp"
+  "/root/repo/testing/adios2/engine/bp/operations/TestBPWriteReadPNG.cpp"
+  "/root/repo/testing/adios2/engine/inline/CMakeLists.txt"
+  "/root/repo/testing/adios2/engine/inline/TestInlineWriteRead.cpp"
+  "/root/repo/testing/adios2/engine/mhs/CMakeLists.txt"
+  "/root/repo/testing/adios2/engine/mhs/TestMhsSingleRank.cpp"
+  "/root/repo/testing/adios2/engine/null/CMakeLists.txt"
+  "/root/repo/testing/adios2/engine/null/TestNullWriteRead.cpp"
+  "/root/repo/testing/adios2/engine/nullcore/CMakeLists.txt"
+  "/root/repo/testing/adios2/engine/nullcore/TestNullCoreWrite.cpp"
+  "/root/repo/testing/adios2/engine/skeleton/CMakeLists.txt"
+  "/root/repo/testing/adios2/engine/staging-common/CMakeLists.txt"
+  "/root/repo/testing/adios2/engine/staging-common/TestSupp.cmake"
+  "/root/repo/testing/adios2/engine/staging-common/run_test.py.gen.in"
+  "/root/repo/testing/adios2/helper/CMakeLists.txt"
+  "/root/repo/testing/adios2/helper/TestDivideBlock.cpp"
+  "/root/repo/testing/adios2/helper/TestHelperStrings.cpp"
+  "/root/repo/testing/adios2/helper/TestMinMaxs.cpp"
+  "/root/repo/testing/adios2/helper/TestRangeFilter.cpp"
+  "/root/repo/testing/adios2/helper/TestReadNonBPFile.cpp"
+  "/root/repo/testing/adios2/hierarchy/CMakeLists.txt"
+  "/root/repo/testing/adios2/hierarchy/TestBPHierarchicalReading.cpp"
+  "/root/repo/testing/adios2/interface/CMakeLists.txt"
+  "/root/repo/testing/adios2/interface/TestADIOSDefineAttribute.cpp"
+  "/root/repo/testing/adios2/interface/TestADIOSDefineVariable.cpp"
+  "/root/repo/testing/adios2/interface/TestADIOSInfo.cpp"
+  "/root/repo/testing/adios2/interface/TestADIOSInterface.cpp"
+  "/root/repo/testing/adios2/interface/TestADIOSInterfaceWrite.cpp"
+  "/root/repo/testing/adios2/interface/TestADIOSNoMpi.cpp"
+  "/root/repo/testing/adios2/interface/TestADIOSSelection.cpp"
+  "/root/repo/testing/adios2/performance/CMakeLists.txt"
+  "/root/repo/testing/adios2/performance/manyvars/CMakeLists.txt"
+  "/root/repo/testing/adios2/performance/metadata/CMakeLists.txt"
+  "/root/repo/testing/adios2/performance/query/CMakeLists.txt"
+  "/root/repo/testing/adios2/performance/query/TestBPQuery.cpp"
+  "/root/repo/testing/adios2/transports/CMakeLists.txt"
+  "/root/repo/testing/adios2/transports/TestFile.cpp"
+  "/root/repo/testing/adios2/unit/CMakeLists.txt"
+  "/root/repo/testing/adios2/unit/TestBP5ReadBufferPool.cpp"
+  "/root/repo/testing/adios2/unit/TestChunkV.cpp"
+  "/root/repo/testing/adios2/unit/TestCoreDims.cpp"
+  "/root/repo/testing/adios2/unit/TestLocalKVCache.cpp"
+  "/root/repo/testing/adios2/unit/TestPosixTransport.cpp"
+  "/root/repo/testing/adios2/unit/TestProfilingCounters.cpp"
+  "/root/repo/testing/adios2/xml/CMakeLists.txt"
+  "/root/repo/testing/adios2/xml/TestXMLConfig.cpp"
+  "/root/repo/testing/adios2/yaml/CMakeLists.txt"
+  "/root/repo/testing/adios2/yaml/TestYAMLConfig.cpp"
+  "/root/repo/testing/install/CMakeLists.txt"
+  "/root/repo/testing/utils/CMakeLists.txt"
+  "/root/repo/testing/utils/changingshape/CMakeLists.txt"
+  "/root/repo/testing/utils/cwriter/CMakeLists.txt"
+  "/root/repo/testing/utils/reorganize/CMakeLists.txt"
+  "/root/repo/thirdparty/CMakeLists.txt"
+  "/root/repo/thirdparty/EVPath/CMakeLists.txt"
+  "/root/repo/thirdparty/EVPath/EVPath/CMakeLists.txt"
+  "/root/repo/thirdparty/EVPath/EVPath/CTestCustom.ctest.in"
+  "/root/repo/thirdparty/EVPath/EVPath/EVPathConfig.cmake.in"
+  "/root/repo/thirdparty/EVPath/EVPath/EVPathConfigCommon.cmake.in"
+  "/root/repo/thirdparty/EVPath/EVPath/EVPathConfigVersion.cmake.in"
+  "/root/repo/thirdparty/EVPath/EVPath/cmake/CheckBrokenTitanCompiler.cmake"
+  "/root/repo/thirdparty/EVPath/EVPath/cmake/check_mac_sysctl.c"
+  "/root/repo/thirdparty/EVPath/EVPath/cmake/check_sysconf.c"
+  "/root/repo/thirdparty/EVPath/EVPath/cmake/check_sysinfo.c"
+  "/root/repo/thirdparty/EVPath/EVPath/config.h.cmake"
+  "/root/repo/thirdparty/GTest/CMakeLists.txt"
+  "/root/repo/thirdparty/GTest/googletest/CMakeLists.txt"
+  "/root/repo/thirdparty/GTest/googletest/googletest/CMakeLists.txt"
+  "/root/repo/thirdparty/GTest/googletest/googletest/cmake/Config.cmake.in"
+  "/root/repo/thirdparty/GTest/googletest/googletest/cmake/gtest.pc.in"
+  "/root/repo/thirdparty/GTest/googletest/googletest/cmake/gtest_main.pc.in"
+  "/root/repo/thirdparty/GTest/googletest/googletest/cmake/internal_utils.cmake"
+  "/root/repo/thirdparty/KWSys/CMakeLists.txt"
+  "/root/repo/thirdparty/KWSys/adios2sys/CMakeLists.txt"
+  "/root/repo/thirdparty/KWSys/adios2sys/CommandLineArguments.hxx.in"
+  "/root/repo/thirdparty/KWSys/adios2sys/Configure.h.in"
+  "/root/repo/thirdparty/KWSys/adios2sys/Configure.hxx.in"
+  "/root/repo/thirdparty/KWSys/adios2sys/Directory.hxx.in"
+  "/root/repo/thirdparty/KWSys/adios2sys/DynamicLoader.hxx.in"
+  "/root/repo/thirdparty/KWSys/adios2sys/Encoding.h.in"
+  "/root/repo/thirdparty/KWSys/adios2sys/Encoding.hxx.in"
+  "/root/repo/thirdparty/KWSys/adios2sys/FStream.hxx.in"
+  "/root/repo/thirdparty/KWSys/adios2sys/MD5.h.in"
+  "/root/repo/thirdparty/KWSys/adios2sys/RegularExpression.hxx.in"
+  "/root/repo/thirdparty/KWSys/adios2sys/Status.hxx.in"
+  "/root/repo/thirdparty/KWSys/adios2sys/SystemTools.hxx.in"
+  "/root/repo/thirdparty/KWSys/adios2sys/kwsysPlatformTests.cmake"
+  "/root/repo/thirdparty/KWSys/adios2sys/kwsysPrivate.h"
+  "/root/repo/thirdparty/atl/CMakeLists.txt"
+  "/root/repo/thirdparty/atl/atl/CMakeLists.txt"
+  "/root/repo/thirdparty/atl/atl/CTestCustom.cmake.in"
+  "/root/repo/thirdparty/atl/atl/atl-config.cmake.in"
+  "/root/repo/thirdparty/atl/atl/config.h.cmake"
+  "/root/repo/thirdparty/dill/CMakeLists.txt"
+  "/root/repo/thirdparty/dill/dill/CMakeLists.txt"
+  "/root/repo/thirdparty/dill/dill/CTestCustom.cmake.in"
+  "/root/repo/thirdparty/dill/dill/config.h.cmake"
+  "/root/repo/thirdparty/dill/dill/dill-config-common.cmake.in"
+  "/root/repo/thirdparty/dill/dill/dill-config-install.cmake.in"
+  "/root/repo/thirdparty/dill/dill/dill-config-version.cmake.in"
+  "/root/repo/thirdparty/dill/dill/dill-config.cmake.in"
+  "/root/repo/thirdparty/enet/CMakeLists.txt"
+  "/root/repo/thirdparty/enet/enet/CMakeLists.txt"
+  "/root/repo/thirdparty/enet/enet/enet-config.cmake.in"
+  "/root/repo/thirdparty/ffs/CMakeLists.txt"
+  "/root/repo/thirdparty/ffs/ffs/CMakeLists.txt"
+  "/root/repo/thirdparty/ffs/ffs/CTestCustom.ctest.in"
+  "/root/repo/thirdparty/ffs/ffs/cmake/BisonFlexSub.cmake"
+  "/root/repo/thirdparty/ffs/ffs/cod/CMakeLists.txt"
+  "/root/repo/thirdparty/ffs/ffs/config.h.cmake"
+  "/root/repo/thirdparty/ffs/ffs/ffs-config.cmake.in"
+  "/root/repo/thirdparty/ffs/ffs/ffs/CMakeLists.txt"
+  "/root/repo/thirdparty/ffs/ffs/ffs/ffs.h.in"
+  "/root/repo/thirdparty/ffs/ffs/fm/CMakeLists.txt"
+  "/root/repo/thirdparty/nlohmann_json/CMakeLists.txt"
+  "/root/repo/thirdparty/nlohmann_json/nlohmann_json_wrapper/CMakeLists.txt"
+  "/root/repo/thirdparty/perfstubs/CMakeLists.txt"
+  "/root/repo/thirdparty/perfstubs/adios2-perfstubs-interface.h.in"
+  "/root/repo/thirdparty/perfstubs/perfstubs/CMakeLists.txt"
+  "/root/repo/thirdparty/perfstubs/perfstubs/perfstubs_api/config.h.in"
+  "/root/repo/thirdparty/pugixml/CMakeLists.txt"
+  "/root/repo/thirdparty/pugixml/pugixml/CMakeLists.txt"
+  "/root/repo/thirdparty/yaml-cpp/CMakeLists.txt"
+  "/root/repo/thirdparty/yaml-cpp/yaml-cpp/CMakeLists.txt"
+  "/usr/share/cmake-3.25/Modules/BasicConfigVersion-AnyNewerVersion.cmake.in"
+  "/usr/share/cmake-3.25/Modules/BasicConfigVersion-SameMajorVersion.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDependentOption.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeFindDependencyMacro.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakePackageConfigHelpers.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakePushCheckState.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CTest.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestTargets.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestUseLaunchers.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceRuns.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckFunctionExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFileCXX.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckStructHasMember.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckSymbolExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckTypeSize.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/DartConfiguration.tcl.in"
+  "/usr/share/cmake-3.25/Modules/FindBISON.cmake"
+  "/usr/share/cmake-3.25/Modules/FindBZip2.cmake"
+  "/usr/share/cmake-3.25/Modules/FindCygwin.cmake"
+  "/usr/share/cmake-3.25/Modules/FindDoxygen.cmake"
+  "/usr/share/cmake-3.25/Modules/FindFLEX.cmake"
+  "/usr/share/cmake-3.25/Modules/FindMsys.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPNG.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPerl.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPkgConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPython.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPython/Support.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPython3.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/FindZLIB.cmake"
+  "/usr/share/cmake-3.25/Modules/GNUInstallDirs.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceRuns.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/SelectLibraryConfigurations.cmake"
+  "/usr/share/cmake-3.25/Modules/TestBigEndian.cmake"
+  "/usr/share/cmake-3.25/Modules/WriteBasicConfigVersionFile.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "DartConfiguration.tcl"
+  "source/adios2/common/ADIOSConfig.h.in"
+  "source/adios2/common/ADIOSConfig.h"
+  "CTestCustom.cmake"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "cmake/install/pre/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "thirdparty/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "thirdparty/KWSys/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "thirdparty/KWSys/adios2sys/kwsysPrivate.h"
+  "thirdparty/KWSys/adios2sys/adios2sys/Directory.hxx"
+  "thirdparty/KWSys/adios2sys/adios2sys/DynamicLoader.hxx"
+  "thirdparty/KWSys/adios2sys/adios2sys/Encoding.hxx"
+  "thirdparty/KWSys/adios2sys/adios2sys/RegularExpression.hxx"
+  "thirdparty/KWSys/adios2sys/adios2sys/SystemTools.hxx"
+  "thirdparty/KWSys/adios2sys/adios2sys/CommandLineArguments.hxx"
+  "thirdparty/KWSys/adios2sys/adios2sys/FStream.hxx"
+  "thirdparty/KWSys/adios2sys/adios2sys/Status.hxx"
+  "thirdparty/KWSys/adios2sys/adios2sys/Configure.h"
+  "thirdparty/KWSys/adios2sys/adios2sys/Encoding.h"
+  "thirdparty/KWSys/adios2sys/adios2sys/MD5.h"
+  "thirdparty/KWSys/adios2sys/adios2sys/Configure.hxx"
+  "thirdparty/KWSys/adios2sys/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "thirdparty/perfstubs/adios2-perfstubs-interface.h"
+  "thirdparty/perfstubs/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "thirdparty/perfstubs/perfstubs/perfstubs_api/config.h"
+  "thirdparty/perfstubs/perfstubs/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "thirdparty/GTest/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "thirdparty/GTest/googletest/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "thirdparty/GTest/googletest/googletest/generated/GTestConfigVersion.cmake"
+  "thirdparty/GTest/googletest/googletest/generated/GTestConfig.cmake"
+  "thirdparty/GTest/googletest/googletest/generated/gtest.pc"
+  "thirdparty/GTest/googletest/googletest/generated/gtest_main.pc"
+  "thirdparty/GTest/googletest/googletest/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "thirdparty/pugixml/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "thirdparty/pugixml/pugixml/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "thirdparty/nlohmann_json/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "thirdparty/nlohmann_json/nlohmann_json_wrapper/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "thirdparty/yaml-cpp/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "thirdparty/yaml-cpp/yaml-cpp/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "thirdparty/atl/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "thirdparty/atl/atl/config.h"
+  "thirdparty/atl/atl/atl-config-version.cmake"
+  "thirdparty/atl/atl/atl-config.cmake"
+  "thirdparty/atl/atl/CTestCustom.cmake"
+  "thirdparty/atl/atl/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "thirdparty/dill/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "thirdparty/dill/dill/config.h"
+  "thirdparty/dill/dill/dill-config-common.cmake"
+  "thirdparty/dill/dill/dill-config-version.cmake"
+  "thirdparty/dill/dill/dill-config.cmake"
+  "thirdparty/dill/dill/dill-config-install.cmake"
+  "thirdparty/dill/dill/CTestCustom.cmake"
+  "thirdparty/dill/dill/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "thirdparty/ffs/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "thirdparty/ffs/ffs/ffs/ffs.h"
+  "thirdparty/ffs/ffs/CTestCustom.ctest"
+  "thirdparty/ffs/ffs/config.h"
+  "thirdparty/ffs/ffs/ffs-config-version.cmake"
+  "thirdparty/ffs/ffs/ffs-config.cmake"
+  "thirdparty/ffs/ffs/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "thirdparty/ffs/ffs/fm/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "thirdparty/ffs/ffs/cod/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "thirdparty/ffs/ffs/ffs/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "thirdparty/enet/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "thirdparty/enet/enet/enet-config-version.cmake"
+  "thirdparty/enet/enet/enet-config.cmake"
+  "thirdparty/enet/enet/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "thirdparty/EVPath/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "thirdparty/EVPath/EVPath/CTestCustom.ctest"
+  "thirdparty/EVPath/EVPath/EVPathConfig.cmake"
+  "thirdparty/EVPath/EVPath/EVPathConfigCommon.cmake"
+  "thirdparty/EVPath/EVPath/EVPathConfigVersion.cmake"
+  "thirdparty/EVPath/EVPath/config.h"
+  "thirdparty/EVPath/EVPath/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/adios2/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "verinfo.h"
+  "bpls.cmake.gen"
+  "adios2_reorganize_wrapper"
+  "Release/bpls.cmake"
+  "source/utils/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/utils/bp4dbg/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/utils/bp5dbg/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/utils/adios_campaign_manager/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bindings/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bindings/C/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bindings/CXX11/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "plugins/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "plugins/operators/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "plugins/engines/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "testing/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "testing/adios2/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "testing/adios2/interface/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "testing/adios2/unit/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "testing/adios2/engine/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "testing/adios2/engine/bp/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "testing/adios2/engine/bp/operations/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "testing/adios2/engine/skeleton/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "testing/adios2/engine/inline/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "testing/adios2/engine/null/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "testing/adios2/engine/nullcore/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "testing/adios2/engine/mhs/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "testing/adios2/engine/staging-common/run_test.py.gen"
+  "bin/run_test.py.Release"
+  "testing/adios2/engine/staging-common/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "testing/adios2/transports/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "testing/adios2/bindings/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "testing/adios2/bindings/C/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "testing/adios2/xml/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "testing/adios2/yaml/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "testing/adios2/performance/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "testing/adios2/performance/manyvars/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "testing/adios2/performance/query/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "testing/adios2/performance/metadata/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "testing/adios2/helper/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "testing/adios2/hierarchy/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "testing/adios2/backward_compatibility/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "testing/adios2/derived/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "testing/utils/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "testing/utils/cwriter/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "testing/utils/changingshape/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "testing/utils/reorganize/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "testing/install/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "adios2-config-version.cmake"
+  "adios2-config-common.cmake"
+  "adios2-config.cmake"
+  "adios2-config-install.cmake"
+  "cmake/install/packaging/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "cmake/install/post/generate-adios2-config.sh"
+  "cmake/install/post/adios2-config.pre.sh"
+  "cmake/install/post/adios2-config.post.sh"
+  "cmake/install/post/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/Experimental.dir/DependInfo.cmake"
+  "CMakeFiles/Nightly.dir/DependInfo.cmake"
+  "CMakeFiles/Continuous.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyMemoryCheck.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyStart.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyBuild.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyTest.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/NightlySubmit.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalStart.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalBuild.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalTest.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalSubmit.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousStart.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousBuild.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousTest.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousSubmit.dir/DependInfo.cmake"
+  "thirdparty/KWSys/adios2sys/CMakeFiles/adios2sys_objects.dir/DependInfo.cmake"
+  "thirdparty/perfstubs/perfstubs/CMakeFiles/perfstubs.dir/DependInfo.cmake"
+  "thirdparty/GTest/googletest/googletest/CMakeFiles/gtest.dir/DependInfo.cmake"
+  "thirdparty/GTest/googletest/googletest/CMakeFiles/gtest_main.dir/DependInfo.cmake"
+  "thirdparty/atl/atl/CMakeFiles/atl.dir/DependInfo.cmake"
+  "thirdparty/dill/dill/CMakeFiles/generate_vm_include.dir/DependInfo.cmake"
+  "thirdparty/dill/dill/CMakeFiles/dill.dir/DependInfo.cmake"
+  "thirdparty/ffs/ffs/CMakeFiles/docs.dir/DependInfo.cmake"
+  "thirdparty/ffs/ffs/CMakeFiles/generated.dir/DependInfo.cmake"
+  "thirdparty/ffs/ffs/CMakeFiles/ffs.dir/DependInfo.cmake"
+  "thirdparty/enet/enet/CMakeFiles/enet.dir/DependInfo.cmake"
+  "thirdparty/EVPath/EVPath/CMakeFiles/EVPath.dir/DependInfo.cmake"
+  "thirdparty/EVPath/EVPath/CMakeFiles/cmselect.dir/DependInfo.cmake"
+  "thirdparty/EVPath/EVPath/CMakeFiles/cmsockets.dir/DependInfo.cmake"
+  "thirdparty/EVPath/EVPath/CMakeFiles/cmudp.dir/DependInfo.cmake"
+  "thirdparty/EVPath/EVPath/CMakeFiles/cmmulticast.dir/DependInfo.cmake"
+  "thirdparty/EVPath/EVPath/CMakeFiles/cmepoll.dir/DependInfo.cmake"
+  "thirdparty/EVPath/EVPath/CMakeFiles/cmenet.dir/DependInfo.cmake"
+  "source/adios2/CMakeFiles/adios2_core.dir/DependInfo.cmake"
+  "source/adios2/CMakeFiles/adios2_core_derived.dir/DependInfo.cmake"
+  "source/utils/CMakeFiles/bpls.dir/DependInfo.cmake"
+  "source/utils/CMakeFiles/adios_reorganize.dir/DependInfo.cmake"
+  "bindings/C/CMakeFiles/adios2_c.dir/DependInfo.cmake"
+  "bindings/CXX11/CMakeFiles/adios2_cxx11.dir/DependInfo.cmake"
+  "testing/adios2/interface/CMakeFiles/Test.Interface.Interface.Serial.dir/DependInfo.cmake"
+  "testing/adios2/interface/CMakeFiles/Test.Interface.Write.Serial.dir/DependInfo.cmake"
+  "testing/adios2/interface/CMakeFiles/Test.Interface.DefineVariable.Serial.dir/DependInfo.cmake"
+  "testing/adios2/interface/CMakeFiles/Test.Interface.DefineAttribute.Serial.dir/DependInfo.cmake"
+  "testing/adios2/interface/CMakeFiles/Test.Interface.Selection.Serial.dir/DependInfo.cmake"
+  "testing/adios2/interface/CMakeFiles/Test.Interface.NoMpi.Serial.dir/DependInfo.cmake"
+  "testing/adios2/interface/CMakeFiles/Test.Interface.Info.Serial.dir/DependInfo.cmake"
+  "testing/adios2/unit/CMakeFiles/Test.Unit.ChunkV.Serial.dir/DependInfo.cmake"
+  "testing/adios2/unit/CMakeFiles/Test.Unit.BP5ReadBufferPool.Serial.dir/DependInfo.cmake"
+  "testing/adios2/unit/CMakeFiles/Test.Unit.LocalKVCache.Serial.dir/DependInfo.cmake"
+  "testing/adios2/unit/CMakeFiles/Test.Unit.CoreDims.Serial.dir/DependInfo.cmake"
+  "testing/adios2/unit/CMakeFiles/Test.Unit.ProfilingCounters.Serial.dir/DependInfo.cmake"
+  "testing/adios2/unit/CMakeFiles/Test.Unit.PosixTransport.Serial.dir/DependInfo.cmake"
+  "testing/adios2/engine/bp/CMakeFiles/Test.Engine.BP.WriteReadADIOS2.Serial.dir/DependInfo.cmake"
+  "testing/adios2/engine/bp/CMakeFiles/Test.Engine.BP.WriteReadADIOS2fstream.Serial.dir/DependInfo.cmake"
+  "testing/adios2/engine/bp/CMakeFiles/Test.Engine.BP.WriteReadADIOS2stdio.Serial.dir/DependInfo.cmake"
+  "testing/adios2/engine/bp/CMakeFiles/Test.Engine.BP.WriteReadAsStreamADIOS2.Serial.dir/DependInfo.cmake"
+  "testing/adios2/engine/bp/CMakeFiles/Test.Engine.BP.WriteReadAsStreamADIOS2_Threads.Serial.dir/DependInfo.cmake"
+  "testing/adios2/engine/bp/CMakeFiles/Test.Engine.BP.WriteReadAttributes.Serial.dir/DependInfo.cmake"
+  "testing/adios2/engine/bp/CMakeFiles/Test.Engine.BP.FStreamWriteReadHighLevelAPI.Serial.dir/DependInfo.cmake"
+  "testing/adios2/engine/bp/CMakeFiles/Test.Engine.BP.WriteFlushRead.Serial.dir/DependInfo.cmake"
+  "testing/adios2/engine/bp/CMakeFiles/Test.Engine.BP.WriteMultiblockRead.Serial.dir/DependInfo.cmake"
+  "testing/adios2/engine/bp/CMakeFiles/Test.Engine.BP.WriteReadMultiblock.Serial.dir/DependInfo.cmake"
+  "testing/adios2/engine/bp/CMakeFiles/Test.Engine.BP.WriteReadVector.Serial.dir/DependInfo.cmake"
+  "testing/adios2/engine/bp/CMakeFiles/Test.Engine.BP.WriteReadAttributesMultirank.Serial.dir/DependInfo.cmake"
+  "testing/adios2/engine/bp/CMakeFiles/Test.Engine.BP.LargeMetadata.Serial.dir/DependInfo.cmake"
+  "testing/adios2/engine/bp/CMakeFiles/Test.Engine.BP.WriteStatsOnly.Serial.dir/DependInfo.cmake"
+  "testing/adios2/engine/bp/CMakeFiles/Test.Engine.BP.WriteMemorySelectionRead.Serial.dir/DependInfo.cmake"
+  "testing/adios2/engine/bp/CMakeFiles/Test.Engine.BP.WriteReadLocalVariables.Serial.dir/DependInfo.cmake"
+  "testing/adios2/engine/bp/CMakeFiles/Test.Engine.BP.WriteReadLocalVariablesSel.Serial.dir/DependInfo.cmake"
+  "testing/adios2/engine/bp/CMakeFiles/Test.Engine.BP.WriteReadLocalVariablesSelHighLevel.Serial.dir/DependInfo.cmake"
+  "testing/adios2/engine/bp/CMakeFiles/Test.Engine.BP.ChangingShape.Serial.dir/DependInfo.cmake"
+  "testing/adios2/engine/bp/CMakeFiles/Test.Engine.BP.ChangingShapeWithinStep.Serial.dir/DependInfo.cmake"
+  "testing/adios2/engine/bp/CMakeFiles/Test.Engine.BP.WriteReadBlockInfo.Serial.dir/DependInfo.cmake"
+  "testing/adios2/engine/bp/CMakeFiles/Test.Engine.BP.WriteReadVariableSpan.Serial.dir/DependInfo.cmake"
+  "testing/adios2/engine/bp/CMakeFiles/Test.Engine.BP.TimeAggregation.Serial.dir/DependInfo.cmake"
+  "testing/adios2/engine/bp/CMakeFiles/Test.Engine.BP.NoXMLRecovery.Serial.dir/DependInfo.cmake"
+  "testing/adios2/engine/bp/CMakeFiles/Test.Engine.BP.StepsFileGlobalArray.Serial.dir/DependInfo.cmake"
+  "testing/adios2/engine/bp/CMakeFiles/Test.Engine.BP.StepsFileLocalArray.Serial.dir/DependInfo.cmake"
+  "testing/adios2/engine/bp/CMakeFiles/Test.Engine.BP.SelectionsOnRowMajorData.Serial.dir/DependInfo.cmake"
+  "testing/adios2/engine/bp/CMakeFiles/Test.Engine.BP.SelectionsOnColumnMajorData.Serial.dir/DependInfo.cmake"
+  "testing/adios2/engine/bp/CMakeFiles/Test.Engine.BP.BufferSize.Serial.dir/DependInfo.cmake"
+  "testing/adios2/engine/bp/CMakeFiles/Test.Engine.BP.ParameterSelectSteps.Serial.dir/DependInfo.cmake"
+  "testing/adios2/engine/bp/CMakeFiles/Test.Engine.BP.AppendAfterSteps.Serial.dir/DependInfo.cmake"
+  "testing/adios2/engine/bp/CMakeFiles/Test.Engine.BP.DirectIO.Serial.dir/DependInfo.cmake"
+  "testing/adios2/engine/bp/CMakeFiles/Test.Engine.BP.ReadMultithreaded.Serial.dir/DependInfo.cmake"
+  "testing/adios2/engine/bp/CMakeFiles/Test.Engine.BP.AccuracyDefaults.Serial.dir/DependInfo.cmake"
+  "testing/adios2/engine/bp/CMakeFiles/Test.Engine.BP.WriteNull.Serial.dir/DependInfo.cmake"
+  "testing/adios2/engine/bp/CMakeFiles/Test.Engine.BP.WriteAppendReadADIOS2.Serial.dir/DependInfo.cmake"
+  "testing/adios2/engine/bp/CMakeFiles/Test.Engine.BP.JoinedArray.Serial.dir/DependInfo.cmake"
+  "testing/adios2/engine/bp/CMakeFiles/Test.Engine.BP.OpenWithMetadata.Serial.dir/DependInfo.cmake"
+  "testing/adios2/engine/bp/CMakeFiles/Test.Engine.BP.StepsInSituGlobalArray.Serial.dir/DependInfo.cmake"
+  "testing/adios2/engine/bp/CMakeFiles/Test.Engine.BP.StepsInSituLocalArray.Serial.dir/DependInfo.cmake"
+  "testing/adios2/engine/bp/CMakeFiles/Test.Engine.BP.InquireVariableException.Serial.dir/DependInfo.cmake"
+  "testing/adios2/engine/bp/CMakeFiles/Test.Engine.BP.InquireDefine.Serial.dir/DependInfo.cmake"
+  "testing/adios2/engine/bp/operations/CMakeFiles/Test.Engine.BP.WriteReadBZIP2.Serial.dir/DependInfo.cmake"
+  "testing/adios2/engine/bp/operations/CMakeFiles/Test.Engine.BP.WriteReadPNG.Serial.dir/DependInfo.cmake"
+  "testing/adios2/engine/skeleton/CMakeFiles/Test.Engine.Skeleton.Writer.dir/DependInfo.cmake"
+  "testing/adios2/engine/skeleton/CMakeFiles/Test.Engine.Skeleton.Reader.dir/DependInfo.cmake"
+  "testing/adios2/engine/inline/CMakeFiles/Test.Engine.Inline.WriteRead.Serial.dir/DependInfo.cmake"
+  "testing/adios2/engine/null/CMakeFiles/Test.Engine.Null.WriteRead.Serial.dir/DependInfo.cmake"
+  "testing/adios2/engine/nullcore/CMakeFiles/Test.Engine.NullCore.Write.Serial.dir/DependInfo.cmake"
+  "testing/adios2/engine/mhs/CMakeFiles/Test.Engine.MHS.SingleRank.Serial.dir/DependInfo.cmake"
+  "testing/adios2/engine/staging-common/CMakeFiles/TestCommonWrite.dir/DependInfo.cmake"
+  "testing/adios2/engine/staging-common/CMakeFiles/TestShapeChangingWrite.dir/DependInfo.cmake"
+  "testing/adios2/engine/staging-common/CMakeFiles/TestCommonWriteModes.dir/DependInfo.cmake"
+  "testing/adios2/engine/staging-common/CMakeFiles/TestCommonWriteAttrs.dir/DependInfo.cmake"
+  "testing/adios2/engine/staging-common/CMakeFiles/TestCommonWriteLocal.dir/DependInfo.cmake"
+  "testing/adios2/engine/staging-common/CMakeFiles/TestCommonWriteShared.dir/DependInfo.cmake"
+  "testing/adios2/engine/staging-common/CMakeFiles/TestCommonSpanWrite.dir/DependInfo.cmake"
+  "testing/adios2/engine/staging-common/CMakeFiles/TestDistributionWrite.dir/DependInfo.cmake"
+  "testing/adios2/engine/staging-common/CMakeFiles/TestDefSyncWrite.dir/DependInfo.cmake"
+  "testing/adios2/engine/staging-common/CMakeFiles/TestCommonRead.dir/DependInfo.cmake"
+  "testing/adios2/engine/staging-common/CMakeFiles/TestCommonSpanRead.dir/DependInfo.cmake"
+  "testing/adios2/engine/staging-common/CMakeFiles/TestCommonReadR64.dir/DependInfo.cmake"
+  "testing/adios2/engine/staging-common/CMakeFiles/TestCommonReadLocal.dir/DependInfo.cmake"
+  "testing/adios2/engine/staging-common/CMakeFiles/TestCommonReadShared.dir/DependInfo.cmake"
+  "testing/adios2/engine/staging-common/CMakeFiles/TestCommonReadAttrs.dir/DependInfo.cmake"
+  "testing/adios2/engine/staging-common/CMakeFiles/TestCommonServer.dir/DependInfo.cmake"
+  "testing/adios2/engine/staging-common/CMakeFiles/TestCommonClient.dir/DependInfo.cmake"
+  "testing/adios2/engine/staging-common/CMakeFiles/TestDistributionRead.dir/DependInfo.cmake"
+  "testing/adios2/engine/staging-common/CMakeFiles/TestLocalWrite.dir/DependInfo.cmake"
+  "testing/adios2/engine/staging-common/CMakeFiles/TestLocalRead.dir/DependInfo.cmake"
+  "testing/adios2/engine/staging-common/CMakeFiles/TestStructWrite.dir/DependInfo.cmake"
+  "testing/adios2/engine/staging-common/CMakeFiles/TestStructRead.dir/DependInfo.cmake"
+  "testing/adios2/engine/staging-common/CMakeFiles/TestWriteJoined.dir/DependInfo.cmake"
+  "testing/adios2/engine/staging-common/CMakeFiles/TestReadJoined.dir/DependInfo.cmake"
+  "testing/adios2/engine/staging-common/CMakeFiles/TestOnDemandWrite.dir/DependInfo.cmake"
+  "testing/adios2/engine/staging-common/CMakeFiles/TestOnDemandRead.dir/DependInfo.cmake"
+  "testing/adios2/transports/CMakeFiles/Test.Transports.File.Serial.dir/DependInfo.cmake"
+  "testing/adios2/bindings/C/CMakeFiles/Test.Bindings.C.WriteTypes.Serial.dir/DependInfo.cmake"
+  "testing/adios2/bindings/C/CMakeFiles/Test.Bindings.C.WriteReadMultiblock.Serial.dir/DependInfo.cmake"
+  "testing/adios2/bindings/C/CMakeFiles/Test.Bindings.C.NullWriteRead.Serial.dir/DependInfo.cmake"
+  "testing/adios2/bindings/C/CMakeFiles/Test.Bindings.C.MemorySpace.Serial.dir/DependInfo.cmake"
+  "testing/adios2/bindings/C/CMakeFiles/Test.Bindings.C.WriteStatsOnly.Serial.dir/DependInfo.cmake"
+  "testing/adios2/xml/CMakeFiles/Test.XMLConfig.Serial.dir/DependInfo.cmake"
+  "testing/adios2/yaml/CMakeFiles/Test.YAMLConfig.Serial.dir/DependInfo.cmake"
+  "testing/adios2/performance/query/CMakeFiles/Test.Performance.Query.Serial.dir/DependInfo.cmake"
+  "testing/adios2/performance/query/CMakeFiles/PerfQuerySubBlocks.dir/DependInfo.cmake"
+  "testing/adios2/performance/metadata/CMakeFiles/PerfReadPlanning.dir/DependInfo.cmake"
+  "testing/adios2/helper/CMakeFiles/Test.Helper.Strings.Serial.dir/DependInfo.cmake"
+  "testing/adios2/helper/CMakeFiles/Test.Helper.DivideBlock.Serial.dir/DependInfo.cmake"
+  "testing/adios2/helper/CMakeFiles/Test.Helper.MinMaxs.Serial.dir/DependInfo.cmake"
+  "testing/adios2/helper/CMakeFiles/Test.Helper.RangeFilter.Serial.dir/DependInfo.cmake"
+  "testing/adios2/helper/CMakeFiles/Test.Helper.ReadNonBPFile.Serial.dir/DependInfo.cmake"
+  "testing/adios2/hierarchy/CMakeFiles/Test.Engine.BP.HierarchicalReading.Serial.dir/DependInfo.cmake"
+  "testing/adios2/backward_compatibility/CMakeFiles/Test.Engine.BP.ReadOldCompressed.Serial.dir/DependInfo.cmake"
+  "testing/adios2/derived/CMakeFiles/Test.Derived.DerivedCorrectness.Serial.dir/DependInfo.cmake"
+  "testing/adios2/derived/CMakeFiles/Test.Derived.DerivedCorrectnessMPI.Serial.dir/DependInfo.cmake"
+  "testing/utils/cwriter/CMakeFiles/Test.Utils.CWriter.dir/DependInfo.cmake"
+  "testing/utils/changingshape/CMakeFiles/Test.Utils.ChangingShape.dir/DependInfo.cmake"
+  )
@@ -0,0 +1,14 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo
+# Build directory: /root/repo/_derived_build
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("cmake/install/pre")
+subdirs("thirdparty")
+subdirs("source")
+subdirs("bindings")
+subdirs("plugins")
+subdirs("testing")
+subdirs("cmake/install/packaging")
+subdirs("cmake/install/post")
@@ -0,0 +1,21 @@
+set(_ADIOS2_CMAKE_MODULE_PATH ${CMAKE_MODULE_PATH})
+list(INSERT CMAKE_MODULE_PATH 0 "/root/repo/cmake")
+
+if(NOT ON)
+  set(atl_DIR /root/repo/_derived_build/thirdparty/atl/atl)
+  set(dill_DIR /root/repo/_derived_build/thirdparty/dill/dill)
+  set(ffs_DIR /root/repo/_derived_build/thirdparty/ffs/ffs)
+endif()
+
+if()
+  set(EVPath_DIR /root/repo/_derived_build/thirdparty/EVPath/EVPath)
+  if(NOT ON)
+    set(enet_DIR /root/repo/_derived_build/thirdparty/enet/enet)
+  endif()
+endif()
+
+set(${CMAKE_FIND_PACKAGE_NAME}_CONFIG "${CMAKE_CURRENT_LIST_FILE}")
+include("${CMAKE_CURRENT_LIST_DIR}/adios2-config-common.cmake")
+
+set(CMAKE_MODULE_PATH ${_ADIOS2_CMAKE_MODULE_PATH})
+unset(_ADIOS2_CMAKE_MODULE_PATH)
@@ -0,0 +1,32 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/bindings/C/adios2/c/adios2_c_adios.cpp" "bindings/C/CMakeFiles/adios2_c.dir/adios2/c/adios2_c_adios.cpp.o" "gcc" "bindings/C/CMakeFiles/adios2_c.dir/adios2/c/adios2_c_adios.cpp.o.d"
+  "/root/repo/bindings/C/adios2/c/adios2_c_attribute.cpp" "bindings/C/CMakeFiles/adios2_c.dir/adios2/c/adios2_c_attribute.cpp.o" "gcc" "bindings/C/CMakeFiles/adios2_c.dir/adios2/c/adios2_c_attribute.cpp.o.d"
+  "/root/repo/bindings/C/adios2/c/adios2_c_engine.cpp" "bindings/C/CMakeFiles/adios2_c.dir/adios2/c/adios2_c_engine.cpp.o" "gcc" "bindings/C/CMakeFiles/adios2_c.dir/adios2/c/adios2_c_engine.cpp.o.d"
+  "/root/repo/bindings/C/adios2/c/adios2_c_io.cpp" "bindings/C/CMakeFiles/adios2_c.dir/adios2/c/adios2_c_io.cpp.o" "gcc" "bindings/C/CMakeFiles/adios2_c.dir/adios2/c/adios2_c_io.cpp.o.d"
+  "/root/repo/bindings/C/adios2/c/adios2_c_operator.cpp" "bindings/C/CMakeFiles/adios2_c.dir/adios2/c/adios2_c_operator.cpp.o" "gcc" "bindings/C/CMakeFiles/adios2_c.dir/adios2/c/adios2_c_operator.cpp.o.d"
+  "/root/repo/bindings/C/adios2/c/adios2_c_variable.cpp" "bindings/C/CMakeFiles/adios2_c.dir/adios2/c/adios2_c_variable.cpp.o" "gcc" "bindings/C/CMakeFiles/adios2_c.dir/adios2/c/adios2_c_variable.cpp.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_derived_build/lib/libadios2_c.so" "/root/repo/_derived_build/lib/libadios2_c.so.2.10.0"
+  "/root/repo/_derived_build/lib/libadios2_c.so.2.10" "/root/repo/_derived_build/lib/libadios2_c.so.2.10.0"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_derived_build/source/adios2/CMakeFiles/adios2_core.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,23 @@
+file(REMOVE_RECURSE
+  "../../lib/libadios2_c.pdb"
+  "../../lib/libadios2_c.so"
+  "../../lib/libadios2_c.so.2.10"
+  "../../lib/libadios2_c.so.2.10.0"
+  "CMakeFiles/adios2_c.dir/adios2/c/adios2_c_adios.cpp.o"
+  "CMakeFiles/adios2_c.dir/adios2/c/adios2_c_adios.cpp.o.d"
+  "CMakeFiles/adios2_c.dir/adios2/c/adios2_c_attribute.cpp.o"
+  "CMakeFiles/adios2_c.dir/adios2/c/adios2_c_attribute.cpp.o.d"
+  "CMakeFiles/adios2_c.dir/adios2/c/adios2_c_engine.cpp.o"
+  "CMakeFiles/adios2_c.dir/adios2/c/adios2_c_engine.cpp.o.d"
+  "CMakeFiles/adios2_c.dir/adios2/c/adios2_c_io.cpp.o"
+  "CMakeFiles/adios2_c.dir/adios2/c/adios2_c_io.cpp.o.d"
+  "CMakeFiles/adios2_c.dir/adios2/c/adios2_c_operator.cpp.o"
+  "CMakeFiles/adios2_c.dir/adios2/c/adios2_c_operator.cpp.o.d"
+  "CMakeFiles/adios2_c.dir/adios2/c/adios2_c_variable.cpp.o"
+  "CMakeFiles/adios2_c.dir/adios2/c/adios2_c_variable.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/adios2_c.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/bindings
+# Build directory: /root/repo/_derived_build/bindings
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("C")
+subdirs("CXX11")
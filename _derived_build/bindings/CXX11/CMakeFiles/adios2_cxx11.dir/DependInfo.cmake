@@ -0,0 +1,38 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/bindings/CXX11/adios2/cxx11/ADIOS.cpp" "bindings/CXX11/CMakeFiles/adios2_cxx11.dir/adios2/cxx11/ADIOS.cpp.o" "gcc" "bindings/CXX11/CMakeFiles/adios2_cxx11.dir/adios2/cxx11/ADIOS.cpp.o.d"
+  "/root/repo/bindings/CXX11/adios2/cxx11/Attribute.cpp" "bindings/CXX11/CMakeFiles/adios2_cxx11.dir/adios2/cxx11/Attribute.cpp.o" "gcc" "bindings/CXX11/CMakeFiles/adios2_cxx11.dir/adios2/cxx11/Attribute.cpp.o.d"
+  "/root/repo/bindings/CXX11/adios2/cxx11/Engine.cpp" "bindings/CXX11/CMakeFiles/adios2_cxx11.dir/adios2/cxx11/Engine.cpp.o" "gcc" "bindings/CXX11/CMakeFiles/adios2_cxx11.dir/adios2/cxx11/Engine.cpp.o.d"
+  "/root/repo/bindings/CXX11/adios2/cxx11/Group.cpp" "bindings/CXX11/CMakeFiles/adios2_cxx11.dir/adios2/cxx11/Group.cpp.o" "gcc" "bindings/CXX11/CMakeFiles/adios2_cxx11.dir/adios2/cxx11/Group.cpp.o.d"
+  "/root/repo/bindings/CXX11/adios2/cxx11/IO.cpp" "bindings/CXX11/CMakeFiles/adios2_cxx11.dir/adios2/cxx11/IO.cpp.o" "gcc" "bindings/CXX11/CMakeFiles/adios2_cxx11.dir/adios2/cxx11/IO.cpp.o.d"
+  "/root/repo/bindings/CXX11/adios2/cxx11/Operator.cpp" "bindings/CXX11/CMakeFiles/adios2_cxx11.dir/adios2/cxx11/Operator.cpp.o" "gcc" "bindings/CXX11/CMakeFiles/adios2_cxx11.dir/adios2/cxx11/Operator.cpp.o.d"
+  "/root/repo/bindings/CXX11/adios2/cxx11/Query.cpp" "bindings/CXX11/CMakeFiles/adios2_cxx11.dir/adios2/cxx11/Query.cpp.o" "gcc" "bindings/CXX11/CMakeFiles/adios2_cxx11.dir/adios2/cxx11/Query.cpp.o.d"
+  "/root/repo/bindings/CXX11/adios2/cxx11/Types.cpp" "bindings/CXX11/CMakeFiles/adios2_cxx11.dir/adios2/cxx11/Types.cpp.o" "gcc" "bindings/CXX11/CMakeFiles/adios2_cxx11.dir/adios2/cxx11/Types.cpp.o.d"
+  "/root/repo/bindings/CXX11/adios2/cxx11/Variable.cpp" "bindings/CXX11/CMakeFiles/adios2_cxx11.dir/adios2/cxx11/Variable.cpp.o" "gcc" "bindings/CXX11/CMakeFiles/adios2_cxx11.dir/adios2/cxx11/Variable.cpp.o.d"
+  "/root/repo/bindings/CXX11/adios2/cxx11/VariableDerived.cpp" "bindings/CXX11/CMakeFiles/adios2_cxx11.dir/adios2/cxx11/VariableDerived.cpp.o" "gcc" "bindings/CXX11/CMakeFiles/adios2_cxx11.dir/adios2/cxx11/VariableDerived.cpp.o.d"
+  "/root/repo/bindings/CXX11/adios2/cxx11/VariableNT.cpp" "bindings/CXX11/CMakeFiles/adios2_cxx11.dir/adios2/cxx11/VariableNT.cpp.o" "gcc" "bindings/CXX11/CMakeFiles/adios2_cxx11.dir/adios2/cxx11/VariableNT.cpp.o.d"
+  "/root/repo/bindings/CXX11/adios2/cxx11/fstream/ADIOS2fstream.cpp" "bindings/CXX11/CMakeFiles/adios2_cxx11.dir/adios2/cxx11/fstream/ADIOS2fstream.cpp.o" "gcc" "bindings/CXX11/CMakeFiles/adios2_cxx11.dir/adios2/cxx11/fstream/ADIOS2fstream.cpp.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_derived_build/lib/libadios2_cxx11.so" "/root/repo/_derived_build/lib/libadios2_cxx11.so.2.10.0"
+  "/root/repo/_derived_build/lib/libadios2_cxx11.so.2.10" "/root/repo/_derived_build/lib/libadios2_cxx11.so.2.10.0"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_derived_build/source/adios2/CMakeFiles/adios2_core.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
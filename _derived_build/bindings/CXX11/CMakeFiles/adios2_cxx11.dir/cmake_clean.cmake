@@ -0,0 +1,35 @@
+file(REMOVE_RECURSE
+  "../../lib/libadios2_cxx11.pdb"
+  "../../lib/libadios2_cxx11.so"
+  "../../lib/libadios2_cxx11.so.2.10"
+  "../../lib/libadios2_cxx11.so.2.10.0"
+  "CMakeFiles/adios2_cxx11.dir/adios2/cxx11/ADIOS.cpp.o"
+  "CMakeFiles/adios2_cxx11.dir/adios2/cxx11/ADIOS.cpp.o.d"
+  "CMakeFiles/adios2_cxx11.dir/adios2/cxx11/Attribute.cpp.o"
+  "CMakeFiles/adios2_cxx11.dir/adios2/cxx11/Attribute.cpp.o.d"
+  "CMakeFiles/adios2_cxx11.dir/adios2/cxx11/Engine.cpp.o"
+  "CMakeFiles/adios2_cxx11.dir/adios2/cxx11/Engine.cpp.o.d"
+  "CMakeFiles/adios2_cxx11.dir/adios2/cxx11/Group.cpp.o"
+  "CMakeFiles/adios2_cxx11.dir/adios2/cxx11/Group.cpp.o.d"
+  "CMakeFiles/adios2_cxx11.dir/adios2/cxx11/IO.cpp.o"
+  "CMakeFiles/adios2_cxx11.dir/adios2/cxx11/IO.cpp.o.d"
+  "CMakeFiles/adios2_cxx11.dir/adios2/cxx11/Operator.cpp.o"
+  "CMakeFiles/adios2_cxx11.dir/adios2/cxx11/Operator.cpp.o.d"
+  "CMakeFiles/adios2_cxx11.dir/adios2/cxx11/Query.cpp.o"
+  "CMakeFiles/adios2_cxx11.dir/adios2/cxx11/Query.cpp.o.d"
+  "CMakeFiles/adios2_cxx11.dir/adios2/cxx11/Types.cpp.o"
+  "CMakeFiles/adios2_cxx11.dir/adios2/cxx11/Types.cpp.o.d"
+  "CMakeFiles/adios2_cxx11.dir/adios2/cxx11/Variable.cpp.o"
+  "CMakeFiles/adios2_cxx11.dir/adios2/cxx11/Variable.cpp.o.d"
+  "CMakeFiles/adios2_cxx11.dir/adios2/cxx11/VariableDerived.cpp.o"
+  "CMakeFiles/adios2_cxx11.dir/adios2/cxx11/VariableDerived.cpp.o.d"
+  "CMakeFiles/adios2_cxx11.dir/adios2/cxx11/VariableNT.cpp.o"
+  "CMakeFiles/adios2_cxx11.dir/adios2/cxx11/VariableNT.cpp.o.d"
+  "CMakeFiles/adios2_cxx11.dir/adios2/cxx11/fstream/ADIOS2fstream.cpp.o"
+  "CMakeFiles/adios2_cxx11.dir/adios2/cxx11/fstream/ADIOS2fstream.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/adios2_cxx11.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,4 @@
+#!/bin/bash
+
+ADIOS2_PREFIX=$(perl -MCwd -e 'print Cwd::abs_path shift' $(dirname ${BASH_SOURCE})/..)
+
@@ -0,0 +1,77 @@
+# Install script for directory: /root/repo/cmake/install/pre
+
+# Set the install prefix
+if(NOT DEFINED CMAKE_INSTALL_PREFIX)
+  set(CMAKE_INSTALL_PREFIX "/usr/local")
+endif()
+string(REGEX REPLACE "/$" "" CMAKE_INSTALL_PREFIX "${CMAKE_INSTALL_PREFIX}")
+
+# Set the install configuration name.
+if(NOT DEFINED CMAKE_INSTALL_CONFIG_NAME)
+  if(BUILD_TYPE)
+    string(REGEX REPLACE "^[^A-Za-z0-9_]+" ""
+           CMAKE_INSTALL_CONFIG_NAME "${BUILD_TYPE}")
+  else()
+    set(CMAKE_INSTALL_CONFIG_NAME "Release")
+  endif()
+  message(STATUS "Install configuration: \"${CMAKE_INSTALL_CONFIG_NAME}\"")
+endif()
+
+# Set the component getting installed.
+if(NOT CMAKE_INSTALL_COMPONENT)
+  if(COMPONENT)
+    message(STATUS "Install component: \"${COMPONENT}\"")
+    set(CMAKE_INSTALL_COMPONENT "${COMPONENT}")
+  else()
+    set(CMAKE_INSTALL_COMPONENT)
+  endif()
+endif()
+
+# Install shared libraries without execute permission?
+if(NOT DEFINED CMAKE_INSTALL_SO_NO_EXE)
+  set(CMAKE_INSTALL_SO_NO_EXE "1")
+endif()
+
+# Is this installation the result of a crosscompile?
+if(NOT DEFINED CMAKE_CROSSCOMPILING)
+  set(CMAKE_CROSSCOMPILING "FALSE")
+endif()
+
+# Set default install directory permissions.
+if(NOT DEFINED CMAKE_OBJDUMP)
+  set(CMAKE_OBJDUMP "/usr/bin/objdump")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "adios2_core-development" OR NOT CMAKE_INSTALL_COMPONENT)
+  
+  message("Pre-installation cleanup of CMake files")
+  file(REMOVE_RECURSE "/usr/local/lib/cmake/adios2")
+
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "adios2_core-development" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib/cmake/adios2" TYPE FILE FILES
+    "/root/repo/cmake/CMakeFindDependencyMacro.cmake"
+    "/root/repo/cmake/FindBZip2.cmake"
+    "/root/repo/cmake/FindCrayDRC.cmake"
+    "/root/repo/cmake/FindDAOS.cmake"
+    "/root/repo/cmake/FindDataSpaces.cmake"
+    "/root/repo/cmake/FindHDF5.cmake"
+    "/root/repo/cmake/FindIME.cmake"
+    "/root/repo/cmake/FindLIBFABRIC.cmake"
+    "/root/repo/cmake/FindMPI.cmake"
+    "/root/repo/cmake/FindPkgConfig.cmake"
+    "/root/repo/cmake/FindPython.cmake"
+    "/root/repo/cmake/FindPythonModule.cmake"
+    "/root/repo/cmake/FindSZ.cmake"
+    "/root/repo/cmake/FindSodium.cmake"
+    "/root/repo/cmake/FindUCX.cmake"
+    "/root/repo/cmake/FindZeroMQ.cmake"
+    "/root/repo/cmake/Findpugixml.cmake"
+    )
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "adios2_core-development" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib/cmake/adios2/upstream" TYPE DIRECTORY FILES "/root/repo/cmake/upstream/")
+endif()
+
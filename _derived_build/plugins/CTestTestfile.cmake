@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/plugins
+# Build directory: /root/repo/_derived_build/plugins
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("operators")
+subdirs("engines")
@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/plugins/operators
+# Build directory: /root/repo/_derived_build/plugins/operators
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
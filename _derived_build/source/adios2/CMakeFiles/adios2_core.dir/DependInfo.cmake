@@ -0,0 +1,174 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/thirdparty/pugixml/pugixml/src/pugixml.cpp" "source/adios2/CMakeFiles/adios2_core.dir/__/__/thirdparty/pugixml/pugixml/src/pugixml.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/__/__/thirdparty/pugixml/pugixml/src/pugixml.cpp.o.d"
+  "/root/repo/thirdparty/yaml-cpp/yaml-cpp/src/binary.cpp" "source/adios2/CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/binary.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/binary.cpp.o.d"
+  "/root/repo/thirdparty/yaml-cpp/yaml-cpp/src/contrib/graphbuilder.cpp" "source/adios2/CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/contrib/graphbuilder.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/contrib/graphbuilder.cpp.o.d"
+  "/root/repo/thirdparty/yaml-cpp/yaml-cpp/src/contrib/graphbuilderadapter.cpp" "source/adios2/CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/contrib/graphbuilderadapter.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/contrib/graphbuilderadapter.cpp.o.d"
+  "/root/repo/thirdparty/yaml-cpp/yaml-cpp/src/convert.cpp" "source/adios2/CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/convert.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/convert.cpp.o.d"
+  "/root/repo/thirdparty/yaml-cpp/yaml-cpp/src/depthguard.cpp" "source/adios2/CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/depthguard.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/depthguard.cpp.o.d"
+  "/root/repo/thirdparty/yaml-cpp/yaml-cpp/src/directives.cpp" "source/adios2/CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/directives.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/directives.cpp.o.d"
+  "/root/repo/thirdparty/yaml-cpp/yaml-cpp/src/emit.cpp" "source/adios2/CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/emit.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/emit.cpp.o.d"
+  "/root/repo/thirdparty/yaml-cpp/yaml-cpp/src/emitfromevents.cpp" "source/adios2/CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/emitfromevents.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/emitfromevents.cpp.o.d"
+  "/root/repo/thirdparty/yaml-cpp/yaml-cpp/src/emitter.cpp" "source/adios2/CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/emitter.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/emitter.cpp.o.d"
+  "/root/repo/thirdparty/yaml-cpp/yaml-cpp/src/emitterstate.cpp" "source/adios2/CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/emitterstate.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/emitterstate.cpp.o.d"
+  "/root/repo/thirdparty/yaml-cpp/yaml-cpp/src/emitterutils.cpp" "source/adios2/CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/emitterutils.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/emitterutils.cpp.o.d"
+  "/root/repo/thirdparty/yaml-cpp/yaml-cpp/src/exceptions.cpp" "source/adios2/CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/exceptions.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/exceptions.cpp.o.d"
+  "/root/repo/thirdparty/yaml-cpp/yaml-cpp/src/exp.cpp" "source/adios2/CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/exp.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/exp.cpp.o.d"
+  "/root/repo/thirdparty/yaml-cpp/yaml-cpp/src/memory.cpp" "source/adios2/CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/memory.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/memory.cpp.o.d"
+  "/root/repo/thirdparty/yaml-cpp/yaml-cpp/src/node.cpp" "source/adios2/CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/node.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/node.cpp.o.d"
+  "/root/repo/thirdparty/yaml-cpp/yaml-cpp/src/node_data.cpp" "source/adios2/CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/node_data.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/node_data.cpp.o.d"
+  "/root/repo/thirdparty/yaml-cpp/yaml-cpp/src/nodebuilder.cpp" "source/adios2/CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/nodebuilder.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/nodebuilder.cpp.o.d"
+  "/root/repo/thirdparty/yaml-cpp/yaml-cpp/src/nodeevents.cpp" "source/adios2/CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/nodeevents.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/nodeevents.cpp.o.d"
+  "/root/repo/thirdparty/yaml-cpp/yaml-cpp/src/null.cpp" "source/adios2/CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/null.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/null.cpp.o.d"
+  "/root/repo/thirdparty/yaml-cpp/yaml-cpp/src/ostream_wrapper.cpp" "source/adios2/CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/ostream_wrapper.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/ostream_wrapper.cpp.o.d"
+  "/root/repo/thirdparty/yaml-cpp/yaml-cpp/src/parse.cpp" "source/adios2/CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/parse.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/parse.cpp.o.d"
+  "/root/repo/thirdparty/yaml-cpp/yaml-cpp/src/parser.cpp" "source/adios2/CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/parser.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/parser.cpp.o.d"
+  "/root/repo/thirdparty/yaml-cpp/yaml-cpp/src/regex_yaml.cpp" "source/adios2/CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/regex_yaml.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/regex_yaml.cpp.o.d"
+  "/root/repo/thirdparty/yaml-cpp/yaml-cpp/src/scanner.cpp" "source/adios2/CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/scanner.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/scanner.cpp.o.d"
+  "/root/repo/thirdparty/yaml-cpp/yaml-cpp/src/scanscalar.cpp" "source/adios2/CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/scanscalar.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/scanscalar.cpp.o.d"
+  "/root/repo/thirdparty/yaml-cpp/yaml-cpp/src/scantag.cpp" "source/adios2/CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/scantag.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/scantag.cpp.o.d"
+  "/root/repo/thirdparty/yaml-cpp/yaml-cpp/src/scantoken.cpp" "source/adios2/CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/scantoken.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/scantoken.cpp.o.d"
+  "/root/repo/thirdparty/yaml-cpp/yaml-cpp/src/simplekey.cpp" "source/adios2/CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/simplekey.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/simplekey.cpp.o.d"
+  "/root/repo/thirdparty/yaml-cpp/yaml-cpp/src/singledocparser.cpp" "source/adios2/CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/singledocparser.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/singledocparser.cpp.o.d"
+  "/root/repo/thirdparty/yaml-cpp/yaml-cpp/src/stream.cpp" "source/adios2/CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/stream.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/stream.cpp.o.d"
+  "/root/repo/thirdparty/yaml-cpp/yaml-cpp/src/tag.cpp" "source/adios2/CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/tag.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/tag.cpp.o.d"
+  "/root/repo/source/adios2/common/ADIOSTypes.cpp" "source/adios2/CMakeFiles/adios2_core.dir/common/ADIOSTypes.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/common/ADIOSTypes.cpp.o.d"
+  "/root/repo/source/adios2/core/ADIOS.cpp" "source/adios2/CMakeFiles/adios2_core.dir/core/ADIOS.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/core/ADIOS.cpp.o.d"
+  "/root/repo/source/adios2/core/Attribute.cpp" "source/adios2/CMakeFiles/adios2_core.dir/core/Attribute.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/core/Attribute.cpp.o.d"
+  "/root/repo/source/adios2/core/AttributeBase.cpp" "source/adios2/CMakeFiles/adios2_core.dir/core/AttributeBase.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/core/AttributeBase.cpp.o.d"
+  "/root/repo/source/adios2/core/Engine.cpp" "source/adios2/CMakeFiles/adios2_core.dir/core/Engine.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/core/Engine.cpp.o.d"
+  "/root/repo/source/adios2/core/Group.cpp" "source/adios2/CMakeFiles/adios2_core.dir/core/Group.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/core/Group.cpp.o.d"
+  "/root/repo/source/adios2/core/IO.cpp" "source/adios2/CMakeFiles/adios2_core.dir/core/IO.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/core/IO.cpp.o.d"
+  "/root/repo/source/adios2/core/Info.cpp" "source/adios2/CMakeFiles/adios2_core.dir/core/Info.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/core/Info.cpp.o.d"
+  "/root/repo/source/adios2/core/Operator.cpp" "source/adios2/CMakeFiles/adios2_core.dir/core/Operator.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/core/Operator.cpp.o.d"
+  "/root/repo/source/adios2/core/Span.cpp" "source/adios2/CMakeFiles/adios2_core.dir/core/Span.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/core/Span.cpp.o.d"
+  "/root/repo/source/adios2/core/Stream.cpp" "source/adios2/CMakeFiles/adios2_core.dir/core/Stream.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/core/Stream.cpp.o.d"
+  "/root/repo/source/adios2/core/Variable.cpp" "source/adios2/CMakeFiles/adios2_core.dir/core/Variable.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/core/Variable.cpp.o.d"
+  "/root/repo/source/adios2/core/VariableBase.cpp" "source/adios2/CMakeFiles/adios2_core.dir/core/VariableBase.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/core/VariableBase.cpp.o.d"
+  "/root/repo/source/adios2/core/VariableDerived.cpp" "source/adios2/CMakeFiles/adios2_core.dir/core/VariableDerived.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/core/VariableDerived.cpp.o.d"
+  "/root/repo/source/adios2/core/VariableStruct.cpp" "source/adios2/CMakeFiles/adios2_core.dir/core/VariableStruct.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/core/VariableStruct.cpp.o.d"
+  "/root/repo/source/adios2/engine/bp3/BP3Reader.cpp" "source/adios2/CMakeFiles/adios2_core.dir/engine/bp3/BP3Reader.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/engine/bp3/BP3Reader.cpp.o.d"
+  "/root/repo/source/adios2/engine/bp3/BP3Writer.cpp" "source/adios2/CMakeFiles/adios2_core.dir/engine/bp3/BP3Writer.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/engine/bp3/BP3Writer.cpp.o.d"
+  "/root/repo/source/adios2/engine/bp4/BP4Reader.cpp" "source/adios2/CMakeFiles/adios2_core.dir/engine/bp4/BP4Reader.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/engine/bp4/BP4Reader.cpp.o.d"
+  "/root/repo/source/adios2/engine/bp4/BP4Writer.cpp" "source/adios2/CMakeFiles/adios2_core.dir/engine/bp4/BP4Writer.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/engine/bp4/BP4Writer.cpp.o.d"
+  "/root/repo/source/adios2/engine/bp5/BP5Engine.cpp" "source/adios2/CMakeFiles/adios2_core.dir/engine/bp5/BP5Engine.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/engine/bp5/BP5Engine.cpp.o.d"
+  "/root/repo/source/adios2/engine/bp5/BP5Reader.cpp" "source/adios2/CMakeFiles/adios2_core.dir/engine/bp5/BP5Reader.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/engine/bp5/BP5Reader.cpp.o.d"
+  "/root/repo/source/adios2/engine/bp5/BP5Writer.cpp" "source/adios2/CMakeFiles/adios2_core.dir/engine/bp5/BP5Writer.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/engine/bp5/BP5Writer.cpp.o.d"
+  "/root/repo/source/adios2/engine/bp5/BP5Writer_EveryoneWrites_Async.cpp" "source/adios2/CMakeFiles/adios2_core.dir/engine/bp5/BP5Writer_EveryoneWrites_Async.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/engine/bp5/BP5Writer_EveryoneWrites_Async.cpp.o.d"
+  "/root/repo/source/adios2/engine/bp5/BP5Writer_TwoLevelShm.cpp" "source/adios2/CMakeFiles/adios2_core.dir/engine/bp5/BP5Writer_TwoLevelShm.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/engine/bp5/BP5Writer_TwoLevelShm.cpp.o.d"
+  "/root/repo/source/adios2/engine/bp5/BP5Writer_TwoLevelShm_Async.cpp" "source/adios2/CMakeFiles/adios2_core.dir/engine/bp5/BP5Writer_TwoLevelShm_Async.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/engine/bp5/BP5Writer_TwoLevelShm_Async.cpp.o.d"
+  "/root/repo/source/adios2/engine/inline/InlineReader.cpp" "source/adios2/CMakeFiles/adios2_core.dir/engine/inline/InlineReader.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/engine/inline/InlineReader.cpp.o.d"
+  "/root/repo/source/adios2/engine/inline/InlineWriter.cpp" "source/adios2/CMakeFiles/adios2_core.dir/engine/inline/InlineWriter.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/engine/inline/InlineWriter.cpp.o.d"
+  "/root/repo/source/adios2/engine/mhs/MhsReader.cpp" "source/adios2/CMakeFiles/adios2_core.dir/engine/mhs/MhsReader.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/engine/mhs/MhsReader.cpp.o.d"
+  "/root/repo/source/adios2/engine/mhs/MhsWriter.cpp" "source/adios2/CMakeFiles/adios2_core.dir/engine/mhs/MhsWriter.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/engine/mhs/MhsWriter.cpp.o.d"
+  "/root/repo/source/adios2/engine/null/NullReader.cpp" "source/adios2/CMakeFiles/adios2_core.dir/engine/null/NullReader.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/engine/null/NullReader.cpp.o.d"
+  "/root/repo/source/adios2/engine/null/NullWriter.cpp" "source/adios2/CMakeFiles/adios2_core.dir/engine/null/NullWriter.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/engine/null/NullWriter.cpp.o.d"
+  "/root/repo/source/adios2/engine/plugin/PluginEngine.cpp" "source/adios2/CMakeFiles/adios2_core.dir/engine/plugin/PluginEngine.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/engine/plugin/PluginEngine.cpp.o.d"
+  "/root/repo/source/adios2/engine/plugin/PluginEngineInterface.cpp" "source/adios2/CMakeFiles/adios2_core.dir/engine/plugin/PluginEngineInterface.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/engine/plugin/PluginEngineInterface.cpp.o.d"
+  "/root/repo/source/adios2/engine/skeleton/SkeletonReader.cpp" "source/adios2/CMakeFiles/adios2_core.dir/engine/skeleton/SkeletonReader.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/engine/skeleton/SkeletonReader.cpp.o.d"
+  "/root/repo/source/adios2/engine/skeleton/SkeletonWriter.cpp" "source/adios2/CMakeFiles/adios2_core.dir/engine/skeleton/SkeletonWriter.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/engine/skeleton/SkeletonWriter.cpp.o.d"
+  "/root/repo/source/adios2/helper/adiosComm.cpp" "source/adios2/CMakeFiles/adios2_core.dir/helper/adiosComm.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/helper/adiosComm.cpp.o.d"
+  "/root/repo/source/adios2/helper/adiosCommDummy.cpp" "source/adios2/CMakeFiles/adios2_core.dir/helper/adiosCommDummy.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/helper/adiosCommDummy.cpp.o.d"
+  "/root/repo/source/adios2/helper/adiosDynamicBinder.cpp" "source/adios2/CMakeFiles/adios2_core.dir/helper/adiosDynamicBinder.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/helper/adiosDynamicBinder.cpp.o.d"
+  "/root/repo/source/adios2/helper/adiosLog.cpp" "source/adios2/CMakeFiles/adios2_core.dir/helper/adiosLog.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/helper/adiosLog.cpp.o.d"
+  "/root/repo/source/adios2/helper/adiosMath.cpp" "source/adios2/CMakeFiles/adios2_core.dir/helper/adiosMath.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/helper/adiosMath.cpp.o.d"
+  "/root/repo/source/adios2/helper/adiosMemory.cpp" "source/adios2/CMakeFiles/adios2_core.dir/helper/adiosMemory.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/helper/adiosMemory.cpp.o.d"
+  "/root/repo/source/adios2/helper/adiosNetwork.cpp" "source/adios2/CMakeFiles/adios2_core.dir/helper/adiosNetwork.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/helper/adiosNetwork.cpp.o.d"
+  "/root/repo/source/adios2/helper/adiosPluginManager.cpp" "source/adios2/CMakeFiles/adios2_core.dir/helper/adiosPluginManager.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/helper/adiosPluginManager.cpp.o.d"
+  "/root/repo/source/adios2/helper/adiosRangeFilter.cpp" "source/adios2/CMakeFiles/adios2_core.dir/helper/adiosRangeFilter.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/helper/adiosRangeFilter.cpp.o.d"
+  "/root/repo/source/adios2/helper/adiosString.cpp" "source/adios2/CMakeFiles/adios2_core.dir/helper/adiosString.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/helper/adiosString.cpp.o.d"
+  "/root/repo/source/adios2/helper/adiosSystem.cpp" "source/adios2/CMakeFiles/adios2_core.dir/helper/adiosSystem.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/helper/adiosSystem.cpp.o.d"
+  "/root/repo/source/adios2/helper/adiosThreadPool.cpp" "source/adios2/CMakeFiles/adios2_core.dir/helper/adiosThreadPool.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/helper/adiosThreadPool.cpp.o.d"
+  "/root/repo/source/adios2/helper/adiosType.cpp" "source/adios2/CMakeFiles/adios2_core.dir/helper/adiosType.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/helper/adiosType.cpp.o.d"
+  "/root/repo/source/adios2/helper/adiosXML.cpp" "source/adios2/CMakeFiles/adios2_core.dir/helper/adiosXML.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/helper/adiosXML.cpp.o.d"
+  "/root/repo/source/adios2/helper/adiosXMLUtil.cpp" "source/adios2/CMakeFiles/adios2_core.dir/helper/adiosXMLUtil.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/helper/adiosXMLUtil.cpp.o.d"
+  "/root/repo/source/adios2/helper/adiosYAML.cpp" "source/adios2/CMakeFiles/adios2_core.dir/helper/adiosYAML.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/helper/adiosYAML.cpp.o.d"
+  "/root/repo/source/adios2/operator/OperatorFactory.cpp" "source/adios2/CMakeFiles/adios2_core.dir/operator/OperatorFactory.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/operator/OperatorFactory.cpp.o.d"
+  "/root/repo/source/adios2/operator/callback/Signature1.cpp" "source/adios2/CMakeFiles/adios2_core.dir/operator/callback/Signature1.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/operator/callback/Signature1.cpp.o.d"
+  "/root/repo/source/adios2/operator/callback/Signature2.cpp" "source/adios2/CMakeFiles/adios2_core.dir/operator/callback/Signature2.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/operator/callback/Signature2.cpp.o.d"
+  "/root/repo/source/adios2/operator/compress/CompressBZIP2.cpp" "source/adios2/CMakeFiles/adios2_core.dir/operator/compress/CompressBZIP2.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/operator/compress/CompressBZIP2.cpp.o.d"
+  "/root/repo/source/adios2/operator/compress/CompressNull.cpp" "source/adios2/CMakeFiles/adios2_core.dir/operator/compress/CompressNull.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/operator/compress/CompressNull.cpp.o.d"
+  "/root/repo/source/adios2/operator/compress/CompressPNG.cpp" "source/adios2/CMakeFiles/adios2_core.dir/operator/compress/CompressPNG.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/operator/compress/CompressPNG.cpp.o.d"
+  "/root/repo/source/adios2/operator/compress/CompressSirius.cpp" "source/adios2/CMakeFiles/adios2_core.dir/operator/compress/CompressSirius.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/operator/compress/CompressSirius.cpp.o.d"
+  "/root/repo/source/adios2/operator/plugin/PluginOperator.cpp" "source/adios2/CMakeFiles/adios2_core.dir/operator/plugin/PluginOperator.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/operator/plugin/PluginOperator.cpp.o.d"
+  "/root/repo/source/adios2/operator/plugin/PluginOperatorInterface.cpp" "source/adios2/CMakeFiles/adios2_core.dir/operator/plugin/PluginOperatorInterface.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/operator/plugin/PluginOperatorInterface.cpp.o.d"
+  "/root/repo/source/adios2/toolkit/aggregator/mpi/MPIAggregator.cpp" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/aggregator/mpi/MPIAggregator.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/aggregator/mpi/MPIAggregator.cpp.o.d"
+  "/root/repo/source/adios2/toolkit/aggregator/mpi/MPIChain.cpp" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/aggregator/mpi/MPIChain.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/aggregator/mpi/MPIChain.cpp.o.d"
+  "/root/repo/source/adios2/toolkit/aggregator/mpi/MPIShmChain.cpp" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/aggregator/mpi/MPIShmChain.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/aggregator/mpi/MPIShmChain.cpp.o.d"
+  "/root/repo/source/adios2/toolkit/burstbuffer/FileDrainer.cpp" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/burstbuffer/FileDrainer.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/burstbuffer/FileDrainer.cpp.o.d"
+  "/root/repo/source/adios2/toolkit/burstbuffer/FileDrainerMultiThread.cpp" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/burstbuffer/FileDrainerMultiThread.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/burstbuffer/FileDrainerMultiThread.cpp.o.d"
+  "/root/repo/source/adios2/toolkit/burstbuffer/FileDrainerSingleThread.cpp" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/burstbuffer/FileDrainerSingleThread.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/burstbuffer/FileDrainerSingleThread.cpp.o.d"
+  "/root/repo/source/adios2/toolkit/derived/Expression.cpp" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/derived/Expression.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/derived/Expression.cpp.o.d"
+  "/root/repo/source/adios2/toolkit/derived/Function.cpp" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/derived/Function.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/derived/Function.cpp.o.d"
+  "/root/repo/source/adios2/toolkit/derived/FusedExpression.cpp" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/derived/FusedExpression.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/derived/FusedExpression.cpp.o.d"
+  "/root/repo/source/adios2/toolkit/format/bp/BPBase.cpp" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/format/bp/BPBase.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/format/bp/BPBase.cpp.o.d"
+  "/root/repo/source/adios2/toolkit/format/bp/BPSerializer.cpp" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/format/bp/BPSerializer.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/format/bp/BPSerializer.cpp.o.d"
+  "/root/repo/source/adios2/toolkit/format/bp/bp3/BP3Base.cpp" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/format/bp/bp3/BP3Base.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/format/bp/bp3/BP3Base.cpp.o.d"
+  "/root/repo/source/adios2/toolkit/format/bp/bp3/BP3Deserializer.cpp" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/format/bp/bp3/BP3Deserializer.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/format/bp/bp3/BP3Deserializer.cpp.o.d"
+  "/root/repo/source/adios2/toolkit/format/bp/bp3/BP3Serializer.cpp" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/format/bp/bp3/BP3Serializer.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/format/bp/bp3/BP3Serializer.cpp.o.d"
+  "/root/repo/source/adios2/toolkit/format/bp/bp4/BP4Base.cpp" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/format/bp/bp4/BP4Base.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/format/bp/bp4/BP4Base.cpp.o.d"
+  "/root/repo/source/adios2/toolkit/format/bp/bp4/BP4Deserializer.cpp" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/format/bp/bp4/BP4Deserializer.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/format/bp/bp4/BP4Deserializer.cpp.o.d"
+  "/root/repo/source/adios2/toolkit/format/bp/bp4/BP4Serializer.cpp" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/format/bp/bp4/BP4Serializer.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/format/bp/bp4/BP4Serializer.cpp.o.d"
+  "/root/repo/source/adios2/toolkit/format/bp/bpBackCompatOperation/compress/BPBackCompatBlosc.cpp" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/format/bp/bpBackCompatOperation/compress/BPBackCompatBlosc.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/format/bp/bpBackCompatOperation/compress/BPBackCompatBlosc.cpp.o.d"
+  "/root/repo/source/adios2/toolkit/format/bp5/BP5Base.cpp" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/format/bp5/BP5Base.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/format/bp5/BP5Base.cpp.o.d"
+  "/root/repo/source/adios2/toolkit/format/bp5/BP5Deserializer.cpp" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/format/bp5/BP5Deserializer.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/format/bp5/BP5Deserializer.cpp.o.d"
+  "/root/repo/source/adios2/toolkit/format/bp5/BP5Helper.cpp" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/format/bp5/BP5Helper.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/format/bp5/BP5Helper.cpp.o.d"
+  "/root/repo/source/adios2/toolkit/format/bp5/BP5ReadBufferPool.cpp" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/format/bp5/BP5ReadBufferPool.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/format/bp5/BP5ReadBufferPool.cpp.o.d"
+  "/root/repo/source/adios2/toolkit/format/bp5/BP5Serializer.cpp" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/format/bp5/BP5Serializer.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/format/bp5/BP5Serializer.cpp.o.d"
+  "/root/repo/source/adios2/toolkit/format/buffer/Buffer.cpp" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/format/buffer/Buffer.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/format/buffer/Buffer.cpp.o.d"
+  "/root/repo/source/adios2/toolkit/format/buffer/BufferV.cpp" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/format/buffer/BufferV.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/format/buffer/BufferV.cpp.o.d"
+  "/root/repo/source/adios2/toolkit/format/buffer/chunk/ChunkPool.cpp" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/format/buffer/chunk/ChunkPool.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/format/buffer/chunk/ChunkPool.cpp.o.d"
+  "/root/repo/source/adios2/toolkit/format/buffer/chunk/ChunkV.cpp" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/format/buffer/chunk/ChunkV.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/format/buffer/chunk/ChunkV.cpp.o.d"
+  "/root/repo/source/adios2/toolkit/format/buffer/ffs/BufferFFS.cpp" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/format/buffer/ffs/BufferFFS.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/format/buffer/ffs/BufferFFS.cpp.o.d"
+  "/root/repo/source/adios2/toolkit/format/buffer/heap/BufferMalloc.cpp" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/format/buffer/heap/BufferMalloc.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/format/buffer/heap/BufferMalloc.cpp.o.d"
+  "/root/repo/source/adios2/toolkit/format/buffer/heap/BufferSTL.cpp" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/format/buffer/heap/BufferSTL.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/format/buffer/heap/BufferSTL.cpp.o.d"
+  "/root/repo/source/adios2/toolkit/format/buffer/ipc/BufferSystemV.cpp" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/format/buffer/ipc/BufferSystemV.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/format/buffer/ipc/BufferSystemV.cpp.o.d"
+  "/root/repo/source/adios2/toolkit/format/buffer/malloc/MallocV.cpp" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/format/buffer/malloc/MallocV.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/format/buffer/malloc/MallocV.cpp.o.d"
+  "/root/repo/source/adios2/toolkit/kvcache/KVCacheCommon.cpp" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/kvcache/KVCacheCommon.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/kvcache/KVCacheCommon.cpp.o.d"
+  "/root/repo/source/adios2/toolkit/kvcache/LocalKVCache.cpp" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/kvcache/LocalKVCache.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/kvcache/LocalKVCache.cpp.o.d"
+  "/root/repo/source/adios2/toolkit/profiling/iochrono/Counters.cpp" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/profiling/iochrono/Counters.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/profiling/iochrono/Counters.cpp.o.d"
+  "/root/repo/source/adios2/toolkit/profiling/iochrono/IOChrono.cpp" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/profiling/iochrono/IOChrono.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/profiling/iochrono/IOChrono.cpp.o.d"
+  "/root/repo/source/adios2/toolkit/profiling/iochrono/Timer.cpp" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/profiling/iochrono/Timer.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/profiling/iochrono/Timer.cpp.o.d"
+  "/root/repo/source/adios2/toolkit/query/BitmapIndex.cpp" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/query/BitmapIndex.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/query/BitmapIndex.cpp.o.d"
+  "/root/repo/source/adios2/toolkit/query/BlockIndex.cpp" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/query/BlockIndex.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/query/BlockIndex.cpp.o.d"
+  "/root/repo/source/adios2/toolkit/query/Query.cpp" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/query/Query.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/query/Query.cpp.o.d"
+  "/root/repo/source/adios2/toolkit/query/Worker.cpp" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/query/Worker.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/query/Worker.cpp.o.d"
+  "/root/repo/source/adios2/toolkit/query/XmlWorker.cpp" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/query/XmlWorker.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/query/XmlWorker.cpp.o.d"
+  "/root/repo/source/adios2/toolkit/remote/Remote.cpp" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/remote/Remote.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/remote/Remote.cpp.o.d"
+  "/root/repo/source/adios2/toolkit/shm/SerializeProcesses.cpp" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/shm/SerializeProcesses.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/shm/SerializeProcesses.cpp.o.d"
+  "/root/repo/source/adios2/toolkit/shm/Spinlock.cpp" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/shm/Spinlock.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/shm/Spinlock.cpp.o.d"
+  "/root/repo/source/adios2/toolkit/transport/Transport.cpp" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/transport/Transport.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/transport/Transport.cpp.o.d"
+  "/root/repo/source/adios2/toolkit/transport/file/FileFStream.cpp" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/transport/file/FileFStream.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/transport/file/FileFStream.cpp.o.d"
+  "/root/repo/source/adios2/toolkit/transport/file/FileHTTP.cpp" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/transport/file/FileHTTP.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/transport/file/FileHTTP.cpp.o.d"
+  "/root/repo/source/adios2/toolkit/transport/file/FilePOSIX.cpp" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/transport/file/FilePOSIX.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/transport/file/FilePOSIX.cpp.o.d"
+  "/root/repo/source/adios2/toolkit/transport/file/FileStdio.cpp" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/transport/file/FileStdio.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/transport/file/FileStdio.cpp.o.d"
+  "/root/repo/source/adios2/toolkit/transport/null/NullTransport.cpp" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/transport/null/NullTransport.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/transport/null/NullTransport.cpp.o.d"
+  "/root/repo/source/adios2/toolkit/transport/shm/ShmSystemV.cpp" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/transport/shm/ShmSystemV.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/transport/shm/ShmSystemV.cpp.o.d"
+  "/root/repo/source/adios2/toolkit/transportman/TransportMan.cpp" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/transportman/TransportMan.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core.dir/toolkit/transportman/TransportMan.cpp.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_derived_build/lib/libadios2_core.so" "/root/repo/_derived_build/lib/libadios2_core.so.2.10.0"
+  "/root/repo/_derived_build/lib/libadios2_core.so.2.10" "/root/repo/_derived_build/lib/libadios2_core.so.2.10.0"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_derived_build/source/adios2/CMakeFiles/adios2_core_derived.dir/DependInfo.cmake"
+  "/root/repo/_derived_build/thirdparty/perfstubs/perfstubs/CMakeFiles/perfstubs.dir/DependInfo.cmake"
+  "/root/repo/_derived_build/thirdparty/ffs/ffs/CMakeFiles/ffs.dir/DependInfo.cmake"
+  "/root/repo/_derived_build/thirdparty/atl/atl/CMakeFiles/atl.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,301 @@
+file(REMOVE_RECURSE
+  "../../lib/libadios2_core.pdb"
+  "../../lib/libadios2_core.so"
+  "../../lib/libadios2_core.so.2.10"
+  "../../lib/libadios2_core.so.2.10.0"
+  "CMakeFiles/adios2_core.dir/__/__/thirdparty/pugixml/pugixml/src/pugixml.cpp.o"
+  "CMakeFiles/adios2_core.dir/__/__/thirdparty/pugixml/pugixml/src/pugixml.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/binary.cpp.o"
+  "CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/binary.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/contrib/graphbuilder.cpp.o"
+  "CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/contrib/graphbuilder.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/contrib/graphbuilderadapter.cpp.o"
+  "CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/contrib/graphbuilderadapter.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/convert.cpp.o"
+  "CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/convert.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/depthguard.cpp.o"
+  "CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/depthguard.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/directives.cpp.o"
+  "CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/directives.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/emit.cpp.o"
+  "CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/emit.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/emitfromevents.cpp.o"
+  "CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/emitfromevents.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/emitter.cpp.o"
+  "CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/emitter.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/emitterstate.cpp.o"
+  "CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/emitterstate.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/emitterutils.cpp.o"
+  "CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/emitterutils.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/exceptions.cpp.o"
+  "CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/exceptions.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/exp.cpp.o"
+  "CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/exp.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/memory.cpp.o"
+  "CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/memory.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/node.cpp.o"
+  "CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/node.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/node_data.cpp.o"
+  "CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/node_data.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/nodebuilder.cpp.o"
+  "CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/nodebuilder.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/nodeevents.cpp.o"
+  "CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/nodeevents.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/null.cpp.o"
+  "CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/null.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/ostream_wrapper.cpp.o"
+  "CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/ostream_wrapper.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/parse.cpp.o"
+  "CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/parse.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/parser.cpp.o"
+  "CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/parser.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/regex_yaml.cpp.o"
+  "CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/regex_yaml.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/scanner.cpp.o"
+  "CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/scanner.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/scanscalar.cpp.o"
+  "CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/scanscalar.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/scantag.cpp.o"
+  "CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/scantag.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/scantoken.cpp.o"
+  "CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/scantoken.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/simplekey.cpp.o"
+  "CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/simplekey.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/singledocparser.cpp.o"
+  "CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/singledocparser.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/stream.cpp.o"
+  "CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/stream.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/tag.cpp.o"
+  "CMakeFiles/adios2_core.dir/__/__/thirdparty/yaml-cpp/yaml-cpp/src/tag.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/common/ADIOSTypes.cpp.o"
+  "CMakeFiles/adios2_core.dir/common/ADIOSTypes.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/core/ADIOS.cpp.o"
+  "CMakeFiles/adios2_core.dir/core/ADIOS.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/core/Attribute.cpp.o"
+  "CMakeFiles/adios2_core.dir/core/Attribute.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/core/AttributeBase.cpp.o"
+  "CMakeFiles/adios2_core.dir/core/AttributeBase.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/core/Engine.cpp.o"
+  "CMakeFiles/adios2_core.dir/core/Engine.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/core/Group.cpp.o"
+  "CMakeFiles/adios2_core.dir/core/Group.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/core/IO.cpp.o"
+  "CMakeFiles/adios2_core.dir/core/IO.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/core/Info.cpp.o"
+  "CMakeFiles/adios2_core.dir/core/Info.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/core/Operator.cpp.o"
+  "CMakeFiles/adios2_core.dir/core/Operator.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/core/Span.cpp.o"
+  "CMakeFiles/adios2_core.dir/core/Span.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/core/Stream.cpp.o"
+  "CMakeFiles/adios2_core.dir/core/Stream.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/core/Variable.cpp.o"
+  "CMakeFiles/adios2_core.dir/core/Variable.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/core/VariableBase.cpp.o"
+  "CMakeFiles/adios2_core.dir/core/VariableBase.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/core/VariableDerived.cpp.o"
+  "CMakeFiles/adios2_core.dir/core/VariableDerived.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/core/VariableStruct.cpp.o"
+  "CMakeFiles/adios2_core.dir/core/VariableStruct.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/engine/bp3/BP3Reader.cpp.o"
+  "CMakeFiles/adios2_core.dir/engine/bp3/BP3Reader.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/engine/bp3/BP3Writer.cpp.o"
+  "CMakeFiles/adios2_core.dir/engine/bp3/BP3Writer.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/engine/bp4/BP4Reader.cpp.o"
+  "CMakeFiles/adios2_core.dir/engine/bp4/BP4Reader.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/engine/bp4/BP4Writer.cpp.o"
+  "CMakeFiles/adios2_core.dir/engine/bp4/BP4Writer.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/engine/bp5/BP5Engine.cpp.o"
+  "CMakeFiles/adios2_core.dir/engine/bp5/BP5Engine.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/engine/bp5/BP5Reader.cpp.o"
+  "CMakeFiles/adios2_core.dir/engine/bp5/BP5Reader.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/engine/bp5/BP5Writer.cpp.o"
+  "CMakeFiles/adios2_core.dir/engine/bp5/BP5Writer.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/engine/bp5/BP5Writer_EveryoneWrites_Async.cpp.o"
+  "CMakeFiles/adios2_core.dir/engine/bp5/BP5Writer_EveryoneWrites_Async.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/engine/bp5/BP5Writer_TwoLevelShm.cpp.o"
+  "CMakeFiles/adios2_core.dir/engine/bp5/BP5Writer_TwoLevelShm.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/engine/bp5/BP5Writer_TwoLevelShm_Async.cpp.o"
+  "CMakeFiles/adios2_core.dir/engine/bp5/BP5Writer_TwoLevelShm_Async.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/engine/inline/InlineReader.cpp.o"
+  "CMakeFiles/adios2_core.dir/engine/inline/InlineReader.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/engine/inline/InlineWriter.cpp.o"
+  "CMakeFiles/adios2_core.dir/engine/inline/InlineWriter.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/engine/mhs/MhsReader.cpp.o"
+  "CMakeFiles/adios2_core.dir/engine/mhs/MhsReader.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/engine/mhs/MhsWriter.cpp.o"
+  "CMakeFiles/adios2_core.dir/engine/mhs/MhsWriter.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/engine/null/NullReader.cpp.o"
+  "CMakeFiles/adios2_core.dir/engine/null/NullReader.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/engine/null/NullWriter.cpp.o"
+  "CMakeFiles/adios2_core.dir/engine/null/NullWriter.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/engine/plugin/PluginEngine.cpp.o"
+  "CMakeFiles/adios2_core.dir/engine/plugin/PluginEngine.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/engine/plugin/PluginEngineInterface.cpp.o"
+  "CMakeFiles/adios2_core.dir/engine/plugin/PluginEngineInterface.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/engine/skeleton/SkeletonReader.cpp.o"
+  "CMakeFiles/adios2_core.dir/engine/skeleton/SkeletonReader.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/engine/skeleton/SkeletonWriter.cpp.o"
+  "CMakeFiles/adios2_core.dir/engine/skeleton/SkeletonWriter.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/helper/adiosComm.cpp.o"
+  "CMakeFiles/adios2_core.dir/helper/adiosComm.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/helper/adiosCommDummy.cpp.o"
+  "CMakeFiles/adios2_core.dir/helper/adiosCommDummy.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/helper/adiosDynamicBinder.cpp.o"
+  "CMakeFiles/adios2_core.dir/helper/adiosDynamicBinder.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/helper/adiosLog.cpp.o"
+  "CMakeFiles/adios2_core.dir/helper/adiosLog.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/helper/adiosMath.cpp.o"
+  "CMakeFiles/adios2_core.dir/helper/adiosMath.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/helper/adiosMemory.cpp.o"
+  "CMakeFiles/adios2_core.dir/helper/adiosMemory.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/helper/adiosNetwork.cpp.o"
+  "CMakeFiles/adios2_core.dir/helper/adiosNetwork.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/helper/adiosPluginManager.cpp.o"
+  "CMakeFiles/adios2_core.dir/helper/adiosPluginManager.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/helper/adiosRangeFilter.cpp.o"
+  "CMakeFiles/adios2_core.dir/helper/adiosRangeFilter.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/helper/adiosString.cpp.o"
+  "CMakeFiles/adios2_core.dir/helper/adiosString.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/helper/adiosSystem.cpp.o"
+  "CMakeFiles/adios2_core.dir/helper/adiosSystem.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/helper/adiosThreadPool.cpp.o"
+  "CMakeFiles/adios2_core.dir/helper/adiosThreadPool.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/helper/adiosType.cpp.o"
+  "CMakeFiles/adios2_core.dir/helper/adiosType.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/helper/adiosXML.cpp.o"
+  "CMakeFiles/adios2_core.dir/helper/adiosXML.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/helper/adiosXMLUtil.cpp.o"
+  "CMakeFiles/adios2_core.dir/helper/adiosXMLUtil.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/helper/adiosYAML.cpp.o"
+  "CMakeFiles/adios2_core.dir/helper/adiosYAML.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/operator/OperatorFactory.cpp.o"
+  "CMakeFiles/adios2_core.dir/operator/OperatorFactory.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/operator/callback/Signature1.cpp.o"
+  "CMakeFiles/adios2_core.dir/operator/callback/Signature1.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/operator/callback/Signature2.cpp.o"
+  "CMakeFiles/adios2_core.dir/operator/callback/Signature2.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/operator/compress/CompressBZIP2.cpp.o"
+  "CMakeFiles/adios2_core.dir/operator/compress/CompressBZIP2.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/operator/compress/CompressNull.cpp.o"
+  "CMakeFiles/adios2_core.dir/operator/compress/CompressNull.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/operator/compress/CompressPNG.cpp.o"
+  "CMakeFiles/adios2_core.dir/operator/compress/CompressPNG.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/operator/compress/CompressSirius.cpp.o"
+  "CMakeFiles/adios2_core.dir/operator/compress/CompressSirius.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/operator/plugin/PluginOperator.cpp.o"
+  "CMakeFiles/adios2_core.dir/operator/plugin/PluginOperator.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/operator/plugin/PluginOperatorInterface.cpp.o"
+  "CMakeFiles/adios2_core.dir/operator/plugin/PluginOperatorInterface.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/toolkit/aggregator/mpi/MPIAggregator.cpp.o"
+  "CMakeFiles/adios2_core.dir/toolkit/aggregator/mpi/MPIAggregator.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/toolkit/aggregator/mpi/MPIChain.cpp.o"
+  "CMakeFiles/adios2_core.dir/toolkit/aggregator/mpi/MPIChain.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/toolkit/aggregator/mpi/MPIShmChain.cpp.o"
+  "CMakeFiles/adios2_core.dir/toolkit/aggregator/mpi/MPIShmChain.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/toolkit/burstbuffer/FileDrainer.cpp.o"
+  "CMakeFiles/adios2_core.dir/toolkit/burstbuffer/FileDrainer.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/toolkit/burstbuffer/FileDrainerMultiThread.cpp.o"
+  "CMakeFiles/adios2_core.dir/toolkit/burstbuffer/FileDrainerMultiThread.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/toolkit/burstbuffer/FileDrainerSingleThread.cpp.o"
+  "CMakeFiles/adios2_core.dir/toolkit/burstbuffer/FileDrainerSingleThread.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/toolkit/derived/Expression.cpp.o"
+  "CMakeFiles/adios2_core.dir/toolkit/derived/Expression.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/toolkit/derived/Function.cpp.o"
+  "CMakeFiles/adios2_core.dir/toolkit/derived/Function.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/toolkit/derived/FusedExpression.cpp.o"
+  "CMakeFiles/adios2_core.dir/toolkit/derived/FusedExpression.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/toolkit/format/bp/BPBase.cpp.o"
+  "CMakeFiles/adios2_core.dir/toolkit/format/bp/BPBase.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/toolkit/format/bp/BPSerializer.cpp.o"
+  "CMakeFiles/adios2_core.dir/toolkit/format/bp/BPSerializer.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/toolkit/format/bp/bp3/BP3Base.cpp.o"
+  "CMakeFiles/adios2_core.dir/toolkit/format/bp/bp3/BP3Base.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/toolkit/format/bp/bp3/BP3Deserializer.cpp.o"
+  "CMakeFiles/adios2_core.dir/toolkit/format/bp/bp3/BP3Deserializer.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/toolkit/format/bp/bp3/BP3Serializer.cpp.o"
+  "CMakeFiles/adios2_core.dir/toolkit/format/bp/bp3/BP3Serializer.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/toolkit/format/bp/bp4/BP4Base.cpp.o"
+  "CMakeFiles/adios2_core.dir/toolkit/format/bp/bp4/BP4Base.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/toolkit/format/bp/bp4/BP4Deserializer.cpp.o"
+  "CMakeFiles/adios2_core.dir/toolkit/format/bp/bp4/BP4Deserializer.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/toolkit/format/bp/bp4/BP4Serializer.cpp.o"
+  "CMakeFiles/adios2_core.dir/toolkit/format/bp/bp4/BP4Serializer.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/toolkit/format/bp/bpBackCompatOperation/compress/BPBackCompatBlosc.cpp.o"
+  "CMakeFiles/adios2_core.dir/toolkit/format/bp/bpBackCompatOperation/compress/BPBackCompatBlosc.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/toolkit/format/bp5/BP5Base.cpp.o"
+  "CMakeFiles/adios2_core.dir/toolkit/format/bp5/BP5Base.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/toolkit/format/bp5/BP5Deserializer.cpp.o"
+  "CMakeFiles/adios2_core.dir/toolkit/format/bp5/BP5Deserializer.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/toolkit/format/bp5/BP5Helper.cpp.o"
+  "CMakeFiles/adios2_core.dir/toolkit/format/bp5/BP5Helper.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/toolkit/format/bp5/BP5ReadBufferPool.cpp.o"
+  "CMakeFiles/adios2_core.dir/toolkit/format/bp5/BP5ReadBufferPool.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/toolkit/format/bp5/BP5Serializer.cpp.o"
+  "CMakeFiles/adios2_core.dir/toolkit/format/bp5/BP5Serializer.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/toolkit/format/buffer/Buffer.cpp.o"
+  "CMakeFiles/adios2_core.dir/toolkit/format/buffer/Buffer.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/toolkit/format/buffer/BufferV.cpp.o"
+  "CMakeFiles/adios2_core.dir/toolkit/format/buffer/BufferV.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/toolkit/format/buffer/chunk/ChunkPool.cpp.o"
+  "CMakeFiles/adios2_core.dir/toolkit/format/buffer/chunk/ChunkPool.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/toolkit/format/buffer/chunk/ChunkV.cpp.o"
+  "CMakeFiles/adios2_core.dir/toolkit/format/buffer/chunk/ChunkV.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/toolkit/format/buffer/ffs/BufferFFS.cpp.o"
+  "CMakeFiles/adios2_core.dir/toolkit/format/buffer/ffs/BufferFFS.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/toolkit/format/buffer/heap/BufferMalloc.cpp.o"
+  "CMakeFiles/adios2_core.dir/toolkit/format/buffer/heap/BufferMalloc.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/toolkit/format/buffer/heap/BufferSTL.cpp.o"
+  "CMakeFiles/adios2_core.dir/toolkit/format/buffer/heap/BufferSTL.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/toolkit/format/buffer/ipc/BufferSystemV.cpp.o"
+  "CMakeFiles/adios2_core.dir/toolkit/format/buffer/ipc/BufferSystemV.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/toolkit/format/buffer/malloc/MallocV.cpp.o"
+  "CMakeFiles/adios2_core.dir/toolkit/format/buffer/malloc/MallocV.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/toolkit/kvcache/KVCacheCommon.cpp.o"
+  "CMakeFiles/adios2_core.dir/toolkit/kvcache/KVCacheCommon.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/toolkit/kvcache/LocalKVCache.cpp.o"
+  "CMakeFiles/adios2_core.dir/toolkit/kvcache/LocalKVCache.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/toolkit/profiling/iochrono/Counters.cpp.o"
+  "CMakeFiles/adios2_core.dir/toolkit/profiling/iochrono/Counters.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/toolkit/profiling/iochrono/IOChrono.cpp.o"
+  "CMakeFiles/adios2_core.dir/toolkit/profiling/iochrono/IOChrono.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/toolkit/profiling/iochrono/Timer.cpp.o"
+  "CMakeFiles/adios2_core.dir/toolkit/profiling/iochrono/Timer.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/toolkit/query/BitmapIndex.cpp.o"
+  "CMakeFiles/adios2_core.dir/toolkit/query/BitmapIndex.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/toolkit/query/BlockIndex.cpp.o"
+  "CMakeFiles/adios2_core.dir/toolkit/query/BlockIndex.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/toolkit/query/Query.cpp.o"
+  "CMakeFiles/adios2_core.dir/toolkit/query/Query.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/toolkit/query/Worker.cpp.o"
+  "CMakeFiles/adios2_core.dir/toolkit/query/Worker.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/toolkit/query/XmlWorker.cpp.o"
+  "CMakeFiles/adios2_core.dir/toolkit/query/XmlWorker.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/toolkit/remote/Remote.cpp.o"
+  "CMakeFiles/adios2_core.dir/toolkit/remote/Remote.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/toolkit/shm/SerializeProcesses.cpp.o"
+  "CMakeFiles/adios2_core.dir/toolkit/shm/SerializeProcesses.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/toolkit/shm/Spinlock.cpp.o"
+  "CMakeFiles/adios2_core.dir/toolkit/shm/Spinlock.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/toolkit/transport/Transport.cpp.o"
+  "CMakeFiles/adios2_core.dir/toolkit/transport/Transport.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/toolkit/transport/file/FileFStream.cpp.o"
+  "CMakeFiles/adios2_core.dir/toolkit/transport/file/FileFStream.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/toolkit/transport/file/FileHTTP.cpp.o"
+  "CMakeFiles/adios2_core.dir/toolkit/transport/file/FileHTTP.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/toolkit/transport/file/FilePOSIX.cpp.o"
+  "CMakeFiles/adios2_core.dir/toolkit/transport/file/FilePOSIX.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/toolkit/transport/file/FileStdio.cpp.o"
+  "CMakeFiles/adios2_core.dir/toolkit/transport/file/FileStdio.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/toolkit/transport/null/NullTransport.cpp.o"
+  "CMakeFiles/adios2_core.dir/toolkit/transport/null/NullTransport.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/toolkit/transport/shm/ShmSystemV.cpp.o"
+  "CMakeFiles/adios2_core.dir/toolkit/transport/shm/ShmSystemV.cpp.o.d"
+  "CMakeFiles/adios2_core.dir/toolkit/transportman/TransportMan.cpp.o"
+  "CMakeFiles/adios2_core.dir/toolkit/transportman/TransportMan.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/adios2_core.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
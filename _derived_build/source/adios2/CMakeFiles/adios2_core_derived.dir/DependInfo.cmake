@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/_derived_build/source/adios2/lexer.cpp" "source/adios2/CMakeFiles/adios2_core_derived.dir/lexer.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core_derived.dir/lexer.cpp.o.d"
+  "/root/repo/_derived_build/source/adios2/parser.cpp" "source/adios2/CMakeFiles/adios2_core_derived.dir/parser.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core_derived.dir/parser.cpp.o.d"
+  "/root/repo/source/adios2/toolkit/derived/parser/ASTDriver.cpp" "source/adios2/CMakeFiles/adios2_core_derived.dir/toolkit/derived/parser/ASTDriver.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core_derived.dir/toolkit/derived/parser/ASTDriver.cpp.o.d"
+  "/root/repo/source/adios2/toolkit/derived/parser/ASTNode.cpp" "source/adios2/CMakeFiles/adios2_core_derived.dir/toolkit/derived/parser/ASTNode.cpp.o" "gcc" "source/adios2/CMakeFiles/adios2_core_derived.dir/toolkit/derived/parser/ASTNode.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
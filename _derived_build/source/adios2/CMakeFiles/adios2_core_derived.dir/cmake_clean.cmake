@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "../../lib/libadios2_core_derived.pdb"
+  "../../lib/libadios2_core_derived.so"
+  "CMakeFiles/adios2_core_derived.dir/lexer.cpp.o"
+  "CMakeFiles/adios2_core_derived.dir/lexer.cpp.o.d"
+  "CMakeFiles/adios2_core_derived.dir/parser.cpp.o"
+  "CMakeFiles/adios2_core_derived.dir/parser.cpp.o.d"
+  "CMakeFiles/adios2_core_derived.dir/toolkit/derived/parser/ASTDriver.cpp.o"
+  "CMakeFiles/adios2_core_derived.dir/toolkit/derived/parser/ASTDriver.cpp.o.d"
+  "CMakeFiles/adios2_core_derived.dir/toolkit/derived/parser/ASTNode.cpp.o"
+  "CMakeFiles/adios2_core_derived.dir/toolkit/derived/parser/ASTNode.cpp.o.d"
+  "lexer.cpp"
+  "parser.cpp"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/adios2_core_derived.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/source/utils/Utils.cpp" "source/utils/CMakeFiles/adios_reorganize.dir/Utils.cpp.o" "gcc" "source/utils/CMakeFiles/adios_reorganize.dir/Utils.cpp.o.d"
+  "/root/repo/source/utils/adios_reorganize/Reorganize.cpp" "source/utils/CMakeFiles/adios_reorganize.dir/adios_reorganize/Reorganize.cpp.o" "gcc" "source/utils/CMakeFiles/adios_reorganize.dir/adios_reorganize/Reorganize.cpp.o.d"
+  "/root/repo/source/utils/adios_reorganize/main.cpp" "source/utils/CMakeFiles/adios_reorganize.dir/adios_reorganize/main.cpp.o" "gcc" "source/utils/CMakeFiles/adios_reorganize.dir/adios_reorganize/main.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_derived_build/source/adios2/CMakeFiles/adios2_core.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
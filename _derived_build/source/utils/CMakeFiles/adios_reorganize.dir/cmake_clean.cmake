@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../../bin/adios2_reorganize"
+  "../../bin/adios2_reorganize.pdb"
+  "CMakeFiles/adios_reorganize.dir/Utils.cpp.o"
+  "CMakeFiles/adios_reorganize.dir/Utils.cpp.o.d"
+  "CMakeFiles/adios_reorganize.dir/adios_reorganize/Reorganize.cpp.o"
+  "CMakeFiles/adios_reorganize.dir/adios_reorganize/Reorganize.cpp.o.d"
+  "CMakeFiles/adios_reorganize.dir/adios_reorganize/main.cpp.o"
+  "CMakeFiles/adios_reorganize.dir/adios_reorganize/main.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/adios_reorganize.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
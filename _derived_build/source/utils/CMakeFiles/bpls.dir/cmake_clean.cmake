@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../bin/bpls"
+  "../../bin/bpls.pdb"
+  "CMakeFiles/bpls.dir/__/__/thirdparty/pugixml/pugixml/src/pugixml.cpp.o"
+  "CMakeFiles/bpls.dir/__/__/thirdparty/pugixml/pugixml/src/pugixml.cpp.o.d"
+  "CMakeFiles/bpls.dir/bpls/bpls.cpp.o"
+  "CMakeFiles/bpls.dir/bpls/bpls.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bpls.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/source/utils
+# Build directory: /root/repo/_derived_build/source/utils
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("bp4dbg")
+subdirs("bp5dbg")
+subdirs("adios_campaign_manager")
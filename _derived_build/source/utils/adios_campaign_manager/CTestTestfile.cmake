@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/source/utils/adios_campaign_manager
+# Build directory: /root/repo/_derived_build/source/utils/adios_campaign_manager
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
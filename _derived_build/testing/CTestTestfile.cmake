@@ -0,0 +1,9 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/testing
+# Build directory: /root/repo/_derived_build/testing
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("adios2")
+subdirs("utils")
+subdirs("install")
@@ -0,0 +1,18 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/testing/adios2
+# Build directory: /root/repo/_derived_build/testing/adios2
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("interface")
+subdirs("unit")
+subdirs("engine")
+subdirs("transports")
+subdirs("bindings")
+subdirs("xml")
+subdirs("yaml")
+subdirs("performance")
+subdirs("helper")
+subdirs("hierarchy")
+subdirs("backward_compatibility")
+subdirs("derived")
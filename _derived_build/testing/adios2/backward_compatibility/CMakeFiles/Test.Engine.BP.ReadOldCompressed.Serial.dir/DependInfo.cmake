@@ -0,0 +1,23 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/testing/adios2/backward_compatibility/TestBP4ReadOldCompressed.cpp" "testing/adios2/backward_compatibility/CMakeFiles/Test.Engine.BP.ReadOldCompressed.Serial.dir/TestBP4ReadOldCompressed.cpp.o" "gcc" "testing/adios2/backward_compatibility/CMakeFiles/Test.Engine.BP.ReadOldCompressed.Serial.dir/TestBP4ReadOldCompressed.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_derived_build/bindings/CXX11/CMakeFiles/adios2_cxx11.dir/DependInfo.cmake"
+  "/root/repo/_derived_build/bindings/C/CMakeFiles/adios2_c.dir/DependInfo.cmake"
+  "/root/repo/_derived_build/source/adios2/CMakeFiles/adios2_core.dir/DependInfo.cmake"
+  "/root/repo/_derived_build/thirdparty/GTest/googletest/googletest/CMakeFiles/gtest.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/Test.Engine.BP.ReadOldCompressed.Serial"
+  "../../../bin/Test.Engine.BP.ReadOldCompressed.Serial.pdb"
+  "CMakeFiles/Test.Engine.BP.ReadOldCompressed.Serial.dir/TestBP4ReadOldCompressed.cpp.o"
+  "CMakeFiles/Test.Engine.BP.ReadOldCompressed.Serial.dir/TestBP4ReadOldCompressed.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test.Engine.BP.ReadOldCompressed.Serial.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
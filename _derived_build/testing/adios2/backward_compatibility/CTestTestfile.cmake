@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/testing/adios2/backward_compatibility
+# Build directory: /root/repo/_derived_build/testing/adios2/backward_compatibility
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(Engine.BP.*/BP4ReadOldCompressedP.Read/*.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.ReadOldCompressed.Serial" "--gtest_filter=*/BP4ReadOldCompressedP.Read/*" "BP4")
+set_tests_properties(Engine.BP.*/BP4ReadOldCompressedP.Read/*.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/testing/adios2/backward_compatibility" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/backward_compatibility/CMakeLists.txt;6;gtest_add_tests_helper;/root/repo/testing/adios2/backward_compatibility/CMakeLists.txt;0;")
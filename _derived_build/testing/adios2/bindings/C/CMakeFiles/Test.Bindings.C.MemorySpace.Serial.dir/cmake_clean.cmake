@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../bin/Test.Bindings.C.MemorySpace.Serial"
+  "../../../../bin/Test.Bindings.C.MemorySpace.Serial.pdb"
+  "CMakeFiles/Test.Bindings.C.MemorySpace.Serial.dir/TestBPMemorySpace.cpp.o"
+  "CMakeFiles/Test.Bindings.C.MemorySpace.Serial.dir/TestBPMemorySpace.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test.Bindings.C.MemorySpace.Serial.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
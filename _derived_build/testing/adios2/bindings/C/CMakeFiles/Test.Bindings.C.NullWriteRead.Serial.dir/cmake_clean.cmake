@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../bin/Test.Bindings.C.NullWriteRead.Serial"
+  "../../../../bin/Test.Bindings.C.NullWriteRead.Serial.pdb"
+  "CMakeFiles/Test.Bindings.C.NullWriteRead.Serial.dir/TestNullWriteRead.cpp.o"
+  "CMakeFiles/Test.Bindings.C.NullWriteRead.Serial.dir/TestNullWriteRead.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test.Bindings.C.NullWriteRead.Serial.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../bin/Test.Bindings.C.WriteReadMultiblock.Serial"
+  "../../../../bin/Test.Bindings.C.WriteReadMultiblock.Serial.pdb"
+  "CMakeFiles/Test.Bindings.C.WriteReadMultiblock.Serial.dir/TestBPWriteReadMultiblock.cpp.o"
+  "CMakeFiles/Test.Bindings.C.WriteReadMultiblock.Serial.dir/TestBPWriteReadMultiblock.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test.Bindings.C.WriteReadMultiblock.Serial.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../bin/Test.Bindings.C.WriteStatsOnly.Serial"
+  "../../../../bin/Test.Bindings.C.WriteStatsOnly.Serial.pdb"
+  "CMakeFiles/Test.Bindings.C.WriteStatsOnly.Serial.dir/TestBPWriteStatsOnly.cpp.o"
+  "CMakeFiles/Test.Bindings.C.WriteStatsOnly.Serial.dir/TestBPWriteStatsOnly.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test.Bindings.C.WriteStatsOnly.Serial.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../bin/Test.Bindings.C.WriteTypes.Serial"
+  "../../../../bin/Test.Bindings.C.WriteTypes.Serial.pdb"
+  "CMakeFiles/Test.Bindings.C.WriteTypes.Serial.dir/TestBPWriteTypes.cpp.o"
+  "CMakeFiles/Test.Bindings.C.WriteTypes.Serial.dir/TestBPWriteTypes.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test.Bindings.C.WriteTypes.Serial.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,24 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/testing/adios2/bindings/C
+# Build directory: /root/repo/_derived_build/testing/adios2/bindings/C
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(Bindings.C.ADIOS2_C_API.ADIOS2BPWriteTypes.Serial "/root/repo/_derived_build/bin/Test.Bindings.C.WriteTypes.Serial" "--gtest_filter=ADIOS2_C_API.ADIOS2BPWriteTypes")
+set_tests_properties(Bindings.C.ADIOS2_C_API.ADIOS2BPWriteTypes.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/bindings/C/CMakeLists.txt;6;gtest_add_tests_helper;/root/repo/testing/adios2/bindings/C/CMakeLists.txt;0;")
+add_test(Bindings.C.ADIOS2_C_API_IO.Engine.Serial "/root/repo/_derived_build/bin/Test.Bindings.C.WriteTypes.Serial" "--gtest_filter=ADIOS2_C_API_IO.Engine")
+set_tests_properties(Bindings.C.ADIOS2_C_API_IO.Engine.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/bindings/C/CMakeLists.txt;6;gtest_add_tests_helper;/root/repo/testing/adios2/bindings/C/CMakeLists.txt;0;")
+add_test(Bindings.C.ADIOS2_C_API_IO.EngineDefault.Serial "/root/repo/_derived_build/bin/Test.Bindings.C.WriteTypes.Serial" "--gtest_filter=ADIOS2_C_API_IO.EngineDefault")
+set_tests_properties(Bindings.C.ADIOS2_C_API_IO.EngineDefault.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/bindings/C/CMakeLists.txt;6;gtest_add_tests_helper;/root/repo/testing/adios2/bindings/C/CMakeLists.txt;0;")
+add_test(Bindings.C.ADIOS2_C_API_IO.ReturnedStrings.Serial "/root/repo/_derived_build/bin/Test.Bindings.C.WriteTypes.Serial" "--gtest_filter=ADIOS2_C_API_IO.ReturnedStrings")
+set_tests_properties(Bindings.C.ADIOS2_C_API_IO.ReturnedStrings.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/bindings/C/CMakeLists.txt;6;gtest_add_tests_helper;/root/repo/testing/adios2/bindings/C/CMakeLists.txt;0;")
+add_test(Bindings.C.BPWriteReadMultiblockCC.ZeroSizeBlocks.Serial "/root/repo/_derived_build/bin/Test.Bindings.C.WriteReadMultiblock.Serial" "--gtest_filter=BPWriteReadMultiblockCC.ZeroSizeBlocks")
+set_tests_properties(Bindings.C.BPWriteReadMultiblockCC.ZeroSizeBlocks.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/bindings/C/CMakeLists.txt;7;gtest_add_tests_helper;/root/repo/testing/adios2/bindings/C/CMakeLists.txt;0;")
+add_test(Bindings.C.NullWriteReadTests_C_API.NullWriteRead1D8.Serial "/root/repo/_derived_build/bin/Test.Bindings.C.NullWriteRead.Serial" "--gtest_filter=NullWriteReadTests_C_API.NullWriteRead1D8")
+set_tests_properties(Bindings.C.NullWriteReadTests_C_API.NullWriteRead1D8.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/bindings/C/CMakeLists.txt;8;gtest_add_tests_helper;/root/repo/testing/adios2/bindings/C/CMakeLists.txt;0;")
+add_test(Bindings.C.ADIOS2_C_API.ADIOS2BPMemorySpaceGPU.Serial "/root/repo/_derived_build/bin/Test.Bindings.C.MemorySpace.Serial" "--gtest_filter=ADIOS2_C_API.ADIOS2BPMemorySpaceGPU")
+set_tests_properties(Bindings.C.ADIOS2_C_API.ADIOS2BPMemorySpaceGPU.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/bindings/C/CMakeLists.txt;11;gtest_add_tests_helper;/root/repo/testing/adios2/bindings/C/CMakeLists.txt;0;")
+add_test(Bindings.C.ADIOS2_C_API.ADIOS2BPMemorySpaceShape.Serial "/root/repo/_derived_build/bin/Test.Bindings.C.MemorySpace.Serial" "--gtest_filter=ADIOS2_C_API.ADIOS2BPMemorySpaceShape")
+set_tests_properties(Bindings.C.ADIOS2_C_API.ADIOS2BPMemorySpaceShape.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/bindings/C/CMakeLists.txt;11;gtest_add_tests_helper;/root/repo/testing/adios2/bindings/C/CMakeLists.txt;0;")
+add_test(Bindings.C.ADIOS2_C_API.ADIOS2BPWriteStatsOnly.Serial "/root/repo/_derived_build/bin/Test.Bindings.C.WriteStatsOnly.Serial" "--gtest_filter=ADIOS2_C_API.ADIOS2BPWriteStatsOnly")
+set_tests_properties(Bindings.C.ADIOS2_C_API.ADIOS2BPWriteStatsOnly.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/bindings/C/CMakeLists.txt;12;gtest_add_tests_helper;/root/repo/testing/adios2/bindings/C/CMakeLists.txt;0;")
@@ -0,0 +1,7 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/testing/adios2/bindings
+# Build directory: /root/repo/_derived_build/testing/adios2/bindings
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("C")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/Test.Derived.DerivedCorrectness.Serial"
+  "../../../bin/Test.Derived.DerivedCorrectness.Serial.pdb"
+  "CMakeFiles/Test.Derived.DerivedCorrectness.Serial.dir/TestBPDerivedCorrectness.cpp.o"
+  "CMakeFiles/Test.Derived.DerivedCorrectness.Serial.dir/TestBPDerivedCorrectness.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test.Derived.DerivedCorrectness.Serial.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/Test.Derived.DerivedCorrectnessMPI.Serial"
+  "../../../bin/Test.Derived.DerivedCorrectnessMPI.Serial.pdb"
+  "CMakeFiles/Test.Derived.DerivedCorrectnessMPI.Serial.dir/TestBPDerivedCorrectnessMPI.cpp.o"
+  "CMakeFiles/Test.Derived.DerivedCorrectnessMPI.Serial.dir/TestBPDerivedCorrectnessMPI.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test.Derived.DerivedCorrectnessMPI.Serial.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
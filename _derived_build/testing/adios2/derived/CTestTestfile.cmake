@@ -0,0 +1,22 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/testing/adios2/derived
+# Build directory: /root/repo/_derived_build/testing/adios2/derived
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(Derived.*/DerivedCorrectnessP.BasicCorrectnessTest/*.Serial "/root/repo/_derived_build/bin/Test.Derived.DerivedCorrectness.Serial" "--gtest_filter=*/DerivedCorrectnessP.BasicCorrectnessTest/*")
+set_tests_properties(Derived.*/DerivedCorrectnessP.BasicCorrectnessTest/*.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/derived/CMakeLists.txt;6;gtest_add_tests_helper;/root/repo/testing/adios2/derived/CMakeLists.txt;0;")
+add_test(Derived.*/DerivedCorrectnessP.VectorCorrectnessTest/*.Serial "/root/repo/_derived_build/bin/Test.Derived.DerivedCorrectness.Serial" "--gtest_filter=*/DerivedCorrectnessP.VectorCorrectnessTest/*")
+set_tests_properties(Derived.*/DerivedCorrectnessP.VectorCorrectnessTest/*.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/derived/CMakeLists.txt;6;gtest_add_tests_helper;/root/repo/testing/adios2/derived/CMakeLists.txt;0;")
+add_test(Derived.*/DerivedCorrectnessP.CurlCorrectnessTest/*.Serial "/root/repo/_derived_build/bin/Test.Derived.DerivedCorrectness.Serial" "--gtest_filter=*/DerivedCorrectnessP.CurlCorrectnessTest/*")
+set_tests_properties(Derived.*/DerivedCorrectnessP.CurlCorrectnessTest/*.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/derived/CMakeLists.txt;6;gtest_add_tests_helper;/root/repo/testing/adios2/derived/CMakeLists.txt;0;")
+add_test(Derived.*/DerivedCorrectnessP.MagCurlCorrectnessTest/*.Serial "/root/repo/_derived_build/bin/Test.Derived.DerivedCorrectness.Serial" "--gtest_filter=*/DerivedCorrectnessP.MagCurlCorrectnessTest/*")
+set_tests_properties(Derived.*/DerivedCorrectnessP.MagCurlCorrectnessTest/*.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/derived/CMakeLists.txt;6;gtest_add_tests_helper;/root/repo/testing/adios2/derived/CMakeLists.txt;0;")
+add_test(Derived.*/DerivedCorrectnessP.NestedCorrectnessTest/*.Serial "/root/repo/_derived_build/bin/Test.Derived.DerivedCorrectness.Serial" "--gtest_filter=*/DerivedCorrectnessP.NestedCorrectnessTest/*")
+set_tests_properties(Derived.*/DerivedCorrectnessP.NestedCorrectnessTest/*.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/derived/CMakeLists.txt;6;gtest_add_tests_helper;/root/repo/testing/adios2/derived/CMakeLists.txt;0;")
+add_test(Derived.*/DerivedCorrectnessP.SelectionCorrectnessTest/*.Serial "/root/repo/_derived_build/bin/Test.Derived.DerivedCorrectness.Serial" "--gtest_filter=*/DerivedCorrectnessP.SelectionCorrectnessTest/*")
+set_tests_properties(Derived.*/DerivedCorrectnessP.SelectionCorrectnessTest/*.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/derived/CMakeLists.txt;6;gtest_add_tests_helper;/root/repo/testing/adios2/derived/CMakeLists.txt;0;")
+add_test(Derived.*/DerivedCorrectnessMPIP.ScalarFunctionsCorrectnessTest/*.Serial "/root/repo/_derived_build/bin/Test.Derived.DerivedCorrectnessMPI.Serial" "--gtest_filter=*/DerivedCorrectnessMPIP.ScalarFunctionsCorrectnessTest/*")
+set_tests_properties(Derived.*/DerivedCorrectnessMPIP.ScalarFunctionsCorrectnessTest/*.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/derived/CMakeLists.txt;7;gtest_add_tests_helper;/root/repo/testing/adios2/derived/CMakeLists.txt;0;")
+add_test(Derived.*/DerivedCorrectnessMPIP.TrigCorrectnessTest/*.Serial "/root/repo/_derived_build/bin/Test.Derived.DerivedCorrectnessMPI.Serial" "--gtest_filter=*/DerivedCorrectnessMPIP.TrigCorrectnessTest/*")
+set_tests_properties(Derived.*/DerivedCorrectnessMPIP.TrigCorrectnessTest/*.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/derived/CMakeLists.txt;7;gtest_add_tests_helper;/root/repo/testing/adios2/derived/CMakeLists.txt;0;")
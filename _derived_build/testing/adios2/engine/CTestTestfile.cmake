@@ -0,0 +1,13 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/testing/adios2/engine
+# Build directory: /root/repo/_derived_build/testing/adios2/engine
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("bp")
+subdirs("skeleton")
+subdirs("inline")
+subdirs("null")
+subdirs("nullcore")
+subdirs("mhs")
+subdirs("staging-common")
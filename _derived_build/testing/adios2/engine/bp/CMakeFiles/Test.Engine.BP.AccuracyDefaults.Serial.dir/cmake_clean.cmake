@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../bin/Test.Engine.BP.AccuracyDefaults.Serial"
+  "../../../../bin/Test.Engine.BP.AccuracyDefaults.Serial.pdb"
+  "CMakeFiles/Test.Engine.BP.AccuracyDefaults.Serial.dir/TestBPAccuracyDefaults.cpp.o"
+  "CMakeFiles/Test.Engine.BP.AccuracyDefaults.Serial.dir/TestBPAccuracyDefaults.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test.Engine.BP.AccuracyDefaults.Serial.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../bin/Test.Engine.BP.AppendAfterSteps.Serial"
+  "../../../../bin/Test.Engine.BP.AppendAfterSteps.Serial.pdb"
+  "CMakeFiles/Test.Engine.BP.AppendAfterSteps.Serial.dir/TestBPAppendAfterSteps.cpp.o"
+  "CMakeFiles/Test.Engine.BP.AppendAfterSteps.Serial.dir/TestBPAppendAfterSteps.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test.Engine.BP.AppendAfterSteps.Serial.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
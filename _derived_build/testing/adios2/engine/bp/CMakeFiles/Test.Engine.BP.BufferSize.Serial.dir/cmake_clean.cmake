@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../bin/Test.Engine.BP.BufferSize.Serial"
+  "../../../../bin/Test.Engine.BP.BufferSize.Serial.pdb"
+  "CMakeFiles/Test.Engine.BP.BufferSize.Serial.dir/TestBPBufferSize.cpp.o"
+  "CMakeFiles/Test.Engine.BP.BufferSize.Serial.dir/TestBPBufferSize.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test.Engine.BP.BufferSize.Serial.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
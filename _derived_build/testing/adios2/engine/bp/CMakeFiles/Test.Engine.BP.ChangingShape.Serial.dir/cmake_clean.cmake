@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../bin/Test.Engine.BP.ChangingShape.Serial"
+  "../../../../bin/Test.Engine.BP.ChangingShape.Serial.pdb"
+  "CMakeFiles/Test.Engine.BP.ChangingShape.Serial.dir/TestBPChangingShape.cpp.o"
+  "CMakeFiles/Test.Engine.BP.ChangingShape.Serial.dir/TestBPChangingShape.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test.Engine.BP.ChangingShape.Serial.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
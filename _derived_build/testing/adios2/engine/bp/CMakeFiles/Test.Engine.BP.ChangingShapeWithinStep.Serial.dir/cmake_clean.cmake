@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../bin/Test.Engine.BP.ChangingShapeWithinStep.Serial"
+  "../../../../bin/Test.Engine.BP.ChangingShapeWithinStep.Serial.pdb"
+  "CMakeFiles/Test.Engine.BP.ChangingShapeWithinStep.Serial.dir/TestBPChangingShapeWithinStep.cpp.o"
+  "CMakeFiles/Test.Engine.BP.ChangingShapeWithinStep.Serial.dir/TestBPChangingShapeWithinStep.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test.Engine.BP.ChangingShapeWithinStep.Serial.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
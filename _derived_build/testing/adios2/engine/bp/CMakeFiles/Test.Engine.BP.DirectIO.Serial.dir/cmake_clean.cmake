@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../bin/Test.Engine.BP.DirectIO.Serial"
+  "../../../../bin/Test.Engine.BP.DirectIO.Serial.pdb"
+  "CMakeFiles/Test.Engine.BP.DirectIO.Serial.dir/TestBPDirectIO.cpp.o"
+  "CMakeFiles/Test.Engine.BP.DirectIO.Serial.dir/TestBPDirectIO.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test.Engine.BP.DirectIO.Serial.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../bin/Test.Engine.BP.FStreamWriteReadHighLevelAPI.Serial"
+  "../../../../bin/Test.Engine.BP.FStreamWriteReadHighLevelAPI.Serial.pdb"
+  "CMakeFiles/Test.Engine.BP.FStreamWriteReadHighLevelAPI.Serial.dir/TestBPFStreamWriteReadHighLevelAPI.cpp.o"
+  "CMakeFiles/Test.Engine.BP.FStreamWriteReadHighLevelAPI.Serial.dir/TestBPFStreamWriteReadHighLevelAPI.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test.Engine.BP.FStreamWriteReadHighLevelAPI.Serial.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
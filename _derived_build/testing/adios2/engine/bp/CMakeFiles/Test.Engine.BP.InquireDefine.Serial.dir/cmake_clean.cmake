@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../bin/Test.Engine.BP.InquireDefine.Serial"
+  "../../../../bin/Test.Engine.BP.InquireDefine.Serial.pdb"
+  "CMakeFiles/Test.Engine.BP.InquireDefine.Serial.dir/TestBPInquireDefine.cpp.o"
+  "CMakeFiles/Test.Engine.BP.InquireDefine.Serial.dir/TestBPInquireDefine.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test.Engine.BP.InquireDefine.Serial.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
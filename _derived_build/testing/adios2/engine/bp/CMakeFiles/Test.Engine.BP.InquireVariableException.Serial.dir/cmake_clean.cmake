@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../bin/Test.Engine.BP.InquireVariableException.Serial"
+  "../../../../bin/Test.Engine.BP.InquireVariableException.Serial.pdb"
+  "CMakeFiles/Test.Engine.BP.InquireVariableException.Serial.dir/TestBPInquireVariableException.cpp.o"
+  "CMakeFiles/Test.Engine.BP.InquireVariableException.Serial.dir/TestBPInquireVariableException.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test.Engine.BP.InquireVariableException.Serial.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../bin/Test.Engine.BP.JoinedArray.Serial"
+  "../../../../bin/Test.Engine.BP.JoinedArray.Serial.pdb"
+  "CMakeFiles/Test.Engine.BP.JoinedArray.Serial.dir/TestBPJoinedArray.cpp.o"
+  "CMakeFiles/Test.Engine.BP.JoinedArray.Serial.dir/TestBPJoinedArray.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test.Engine.BP.JoinedArray.Serial.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../bin/Test.Engine.BP.LargeMetadata.Serial"
+  "../../../../bin/Test.Engine.BP.LargeMetadata.Serial.pdb"
+  "CMakeFiles/Test.Engine.BP.LargeMetadata.Serial.dir/TestBPLargeMetadata.cpp.o"
+  "CMakeFiles/Test.Engine.BP.LargeMetadata.Serial.dir/TestBPLargeMetadata.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test.Engine.BP.LargeMetadata.Serial.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../bin/Test.Engine.BP.NoXMLRecovery.Serial"
+  "../../../../bin/Test.Engine.BP.NoXMLRecovery.Serial.pdb"
+  "CMakeFiles/Test.Engine.BP.NoXMLRecovery.Serial.dir/TestBPNoXMLRecovery.cpp.o"
+  "CMakeFiles/Test.Engine.BP.NoXMLRecovery.Serial.dir/TestBPNoXMLRecovery.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test.Engine.BP.NoXMLRecovery.Serial.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
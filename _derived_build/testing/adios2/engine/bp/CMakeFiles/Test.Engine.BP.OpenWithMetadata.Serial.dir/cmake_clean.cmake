@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../bin/Test.Engine.BP.OpenWithMetadata.Serial"
+  "../../../../bin/Test.Engine.BP.OpenWithMetadata.Serial.pdb"
+  "CMakeFiles/Test.Engine.BP.OpenWithMetadata.Serial.dir/TestBPOpenWithMetadata.cpp.o"
+  "CMakeFiles/Test.Engine.BP.OpenWithMetadata.Serial.dir/TestBPOpenWithMetadata.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test.Engine.BP.OpenWithMetadata.Serial.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../bin/Test.Engine.BP.ParameterSelectSteps.Serial"
+  "../../../../bin/Test.Engine.BP.ParameterSelectSteps.Serial.pdb"
+  "CMakeFiles/Test.Engine.BP.ParameterSelectSteps.Serial.dir/TestBPParameterSelectSteps.cpp.o"
+  "CMakeFiles/Test.Engine.BP.ParameterSelectSteps.Serial.dir/TestBPParameterSelectSteps.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test.Engine.BP.ParameterSelectSteps.Serial.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../bin/Test.Engine.BP.ReadMultithreaded.Serial"
+  "../../../../bin/Test.Engine.BP.ReadMultithreaded.Serial.pdb"
+  "CMakeFiles/Test.Engine.BP.ReadMultithreaded.Serial.dir/TestBPReadMultithreaded.cpp.o"
+  "CMakeFiles/Test.Engine.BP.ReadMultithreaded.Serial.dir/TestBPReadMultithreaded.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test.Engine.BP.ReadMultithreaded.Serial.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../bin/Test.Engine.BP.SelectionsOnColumnMajorData.Serial"
+  "../../../../bin/Test.Engine.BP.SelectionsOnColumnMajorData.Serial.pdb"
+  "CMakeFiles/Test.Engine.BP.SelectionsOnColumnMajorData.Serial.dir/TestBPSelectionsOnColumnMajorData.cpp.o"
+  "CMakeFiles/Test.Engine.BP.SelectionsOnColumnMajorData.Serial.dir/TestBPSelectionsOnColumnMajorData.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test.Engine.BP.SelectionsOnColumnMajorData.Serial.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
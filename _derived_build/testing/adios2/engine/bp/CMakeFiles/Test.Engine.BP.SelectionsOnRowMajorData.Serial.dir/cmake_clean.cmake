@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../bin/Test.Engine.BP.SelectionsOnRowMajorData.Serial"
+  "../../../../bin/Test.Engine.BP.SelectionsOnRowMajorData.Serial.pdb"
+  "CMakeFiles/Test.Engine.BP.SelectionsOnRowMajorData.Serial.dir/TestBPSelectionsOnRowMajorData.cpp.o"
+  "CMakeFiles/Test.Engine.BP.SelectionsOnRowMajorData.Serial.dir/TestBPSelectionsOnRowMajorData.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test.Engine.BP.SelectionsOnRowMajorData.Serial.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../bin/Test.Engine.BP.StepsFileGlobalArray.Serial"
+  "../../../../bin/Test.Engine.BP.StepsFileGlobalArray.Serial.pdb"
+  "CMakeFiles/Test.Engine.BP.StepsFileGlobalArray.Serial.dir/TestBPStepsFileGlobalArray.cpp.o"
+  "CMakeFiles/Test.Engine.BP.StepsFileGlobalArray.Serial.dir/TestBPStepsFileGlobalArray.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test.Engine.BP.StepsFileGlobalArray.Serial.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../bin/Test.Engine.BP.StepsFileLocalArray.Serial"
+  "../../../../bin/Test.Engine.BP.StepsFileLocalArray.Serial.pdb"
+  "CMakeFiles/Test.Engine.BP.StepsFileLocalArray.Serial.dir/TestBPStepsFileLocalArray.cpp.o"
+  "CMakeFiles/Test.Engine.BP.StepsFileLocalArray.Serial.dir/TestBPStepsFileLocalArray.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test.Engine.BP.StepsFileLocalArray.Serial.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
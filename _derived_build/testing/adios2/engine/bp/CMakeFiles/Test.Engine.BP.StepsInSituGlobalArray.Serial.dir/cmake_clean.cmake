@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../bin/Test.Engine.BP.StepsInSituGlobalArray.Serial"
+  "../../../../bin/Test.Engine.BP.StepsInSituGlobalArray.Serial.pdb"
+  "CMakeFiles/Test.Engine.BP.StepsInSituGlobalArray.Serial.dir/TestBPStepsInSituGlobalArray.cpp.o"
+  "CMakeFiles/Test.Engine.BP.StepsInSituGlobalArray.Serial.dir/TestBPStepsInSituGlobalArray.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test.Engine.BP.StepsInSituGlobalArray.Serial.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../bin/Test.Engine.BP.StepsInSituLocalArray.Serial"
+  "../../../../bin/Test.Engine.BP.StepsInSituLocalArray.Serial.pdb"
+  "CMakeFiles/Test.Engine.BP.StepsInSituLocalArray.Serial.dir/TestBPStepsInSituLocalArray.cpp.o"
+  "CMakeFiles/Test.Engine.BP.StepsInSituLocalArray.Serial.dir/TestBPStepsInSituLocalArray.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test.Engine.BP.StepsInSituLocalArray.Serial.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
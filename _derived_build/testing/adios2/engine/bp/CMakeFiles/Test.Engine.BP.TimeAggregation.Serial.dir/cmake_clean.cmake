@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../bin/Test.Engine.BP.TimeAggregation.Serial"
+  "../../../../bin/Test.Engine.BP.TimeAggregation.Serial.pdb"
+  "CMakeFiles/Test.Engine.BP.TimeAggregation.Serial.dir/TestBPTimeAggregation.cpp.o"
+  "CMakeFiles/Test.Engine.BP.TimeAggregation.Serial.dir/TestBPTimeAggregation.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test.Engine.BP.TimeAggregation.Serial.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
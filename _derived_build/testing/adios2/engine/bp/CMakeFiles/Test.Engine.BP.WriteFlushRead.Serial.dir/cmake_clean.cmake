@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../bin/Test.Engine.BP.WriteFlushRead.Serial"
+  "../../../../bin/Test.Engine.BP.WriteFlushRead.Serial.pdb"
+  "CMakeFiles/Test.Engine.BP.WriteFlushRead.Serial.dir/TestBPWriteFlushRead.cpp.o"
+  "CMakeFiles/Test.Engine.BP.WriteFlushRead.Serial.dir/TestBPWriteFlushRead.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test.Engine.BP.WriteFlushRead.Serial.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
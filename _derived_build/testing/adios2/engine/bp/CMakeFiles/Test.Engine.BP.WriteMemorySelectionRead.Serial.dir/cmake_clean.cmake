@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../bin/Test.Engine.BP.WriteMemorySelectionRead.Serial"
+  "../../../../bin/Test.Engine.BP.WriteMemorySelectionRead.Serial.pdb"
+  "CMakeFiles/Test.Engine.BP.WriteMemorySelectionRead.Serial.dir/TestBPWriteMemorySelectionRead.cpp.o"
+  "CMakeFiles/Test.Engine.BP.WriteMemorySelectionRead.Serial.dir/TestBPWriteMemorySelectionRead.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test.Engine.BP.WriteMemorySelectionRead.Serial.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
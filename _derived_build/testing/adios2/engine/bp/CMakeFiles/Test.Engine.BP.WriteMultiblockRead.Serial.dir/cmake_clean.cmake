@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../bin/Test.Engine.BP.WriteMultiblockRead.Serial"
+  "../../../../bin/Test.Engine.BP.WriteMultiblockRead.Serial.pdb"
+  "CMakeFiles/Test.Engine.BP.WriteMultiblockRead.Serial.dir/TestBPWriteMultiblockRead.cpp.o"
+  "CMakeFiles/Test.Engine.BP.WriteMultiblockRead.Serial.dir/TestBPWriteMultiblockRead.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test.Engine.BP.WriteMultiblockRead.Serial.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../bin/Test.Engine.BP.WriteNull.Serial"
+  "../../../../bin/Test.Engine.BP.WriteNull.Serial.pdb"
+  "CMakeFiles/Test.Engine.BP.WriteNull.Serial.dir/TestBPWriteNull.cpp.o"
+  "CMakeFiles/Test.Engine.BP.WriteNull.Serial.dir/TestBPWriteNull.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test.Engine.BP.WriteNull.Serial.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
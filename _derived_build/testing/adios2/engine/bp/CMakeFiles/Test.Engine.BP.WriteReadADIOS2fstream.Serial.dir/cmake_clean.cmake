@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../bin/Test.Engine.BP.WriteReadADIOS2fstream.Serial"
+  "../../../../bin/Test.Engine.BP.WriteReadADIOS2fstream.Serial.pdb"
+  "CMakeFiles/Test.Engine.BP.WriteReadADIOS2fstream.Serial.dir/TestBPWriteReadADIOS2fstream.cpp.o"
+  "CMakeFiles/Test.Engine.BP.WriteReadADIOS2fstream.Serial.dir/TestBPWriteReadADIOS2fstream.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test.Engine.BP.WriteReadADIOS2fstream.Serial.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../bin/Test.Engine.BP.WriteReadADIOS2stdio.Serial"
+  "../../../../bin/Test.Engine.BP.WriteReadADIOS2stdio.Serial.pdb"
+  "CMakeFiles/Test.Engine.BP.WriteReadADIOS2stdio.Serial.dir/TestBPWriteReadADIOS2stdio.cpp.o"
+  "CMakeFiles/Test.Engine.BP.WriteReadADIOS2stdio.Serial.dir/TestBPWriteReadADIOS2stdio.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test.Engine.BP.WriteReadADIOS2stdio.Serial.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
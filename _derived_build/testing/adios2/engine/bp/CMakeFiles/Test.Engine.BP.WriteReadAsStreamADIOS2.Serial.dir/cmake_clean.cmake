@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../bin/Test.Engine.BP.WriteReadAsStreamADIOS2.Serial"
+  "../../../../bin/Test.Engine.BP.WriteReadAsStreamADIOS2.Serial.pdb"
+  "CMakeFiles/Test.Engine.BP.WriteReadAsStreamADIOS2.Serial.dir/TestBPWriteReadAsStreamADIOS2.cpp.o"
+  "CMakeFiles/Test.Engine.BP.WriteReadAsStreamADIOS2.Serial.dir/TestBPWriteReadAsStreamADIOS2.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test.Engine.BP.WriteReadAsStreamADIOS2.Serial.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
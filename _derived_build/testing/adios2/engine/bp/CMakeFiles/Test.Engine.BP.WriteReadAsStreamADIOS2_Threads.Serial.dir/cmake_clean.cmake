@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../bin/Test.Engine.BP.WriteReadAsStreamADIOS2_Threads.Serial"
+  "../../../../bin/Test.Engine.BP.WriteReadAsStreamADIOS2_Threads.Serial.pdb"
+  "CMakeFiles/Test.Engine.BP.WriteReadAsStreamADIOS2_Threads.Serial.dir/TestBPWriteReadAsStreamADIOS2_Threads.cpp.o"
+  "CMakeFiles/Test.Engine.BP.WriteReadAsStreamADIOS2_Threads.Serial.dir/TestBPWriteReadAsStreamADIOS2_Threads.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test.Engine.BP.WriteReadAsStreamADIOS2_Threads.Serial.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
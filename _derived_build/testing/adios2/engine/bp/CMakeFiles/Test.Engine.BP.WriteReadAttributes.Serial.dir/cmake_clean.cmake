@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../bin/Test.Engine.BP.WriteReadAttributes.Serial"
+  "../../../../bin/Test.Engine.BP.WriteReadAttributes.Serial.pdb"
+  "CMakeFiles/Test.Engine.BP.WriteReadAttributes.Serial.dir/TestBPWriteReadAttributes.cpp.o"
+  "CMakeFiles/Test.Engine.BP.WriteReadAttributes.Serial.dir/TestBPWriteReadAttributes.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test.Engine.BP.WriteReadAttributes.Serial.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../bin/Test.Engine.BP.WriteReadAttributesMultirank.Serial"
+  "../../../../bin/Test.Engine.BP.WriteReadAttributesMultirank.Serial.pdb"
+  "CMakeFiles/Test.Engine.BP.WriteReadAttributesMultirank.Serial.dir/TestBPWriteReadAttributesMultirank.cpp.o"
+  "CMakeFiles/Test.Engine.BP.WriteReadAttributesMultirank.Serial.dir/TestBPWriteReadAttributesMultirank.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test.Engine.BP.WriteReadAttributesMultirank.Serial.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../bin/Test.Engine.BP.WriteReadBlockInfo.Serial"
+  "../../../../bin/Test.Engine.BP.WriteReadBlockInfo.Serial.pdb"
+  "CMakeFiles/Test.Engine.BP.WriteReadBlockInfo.Serial.dir/TestBPWriteReadBlockInfo.cpp.o"
+  "CMakeFiles/Test.Engine.BP.WriteReadBlockInfo.Serial.dir/TestBPWriteReadBlockInfo.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test.Engine.BP.WriteReadBlockInfo.Serial.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
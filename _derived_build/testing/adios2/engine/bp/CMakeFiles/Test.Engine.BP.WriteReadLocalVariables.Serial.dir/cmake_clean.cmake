@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../bin/Test.Engine.BP.WriteReadLocalVariables.Serial"
+  "../../../../bin/Test.Engine.BP.WriteReadLocalVariables.Serial.pdb"
+  "CMakeFiles/Test.Engine.BP.WriteReadLocalVariables.Serial.dir/TestBPWriteReadLocalVariables.cpp.o"
+  "CMakeFiles/Test.Engine.BP.WriteReadLocalVariables.Serial.dir/TestBPWriteReadLocalVariables.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test.Engine.BP.WriteReadLocalVariables.Serial.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../bin/Test.Engine.BP.WriteReadLocalVariablesSel.Serial"
+  "../../../../bin/Test.Engine.BP.WriteReadLocalVariablesSel.Serial.pdb"
+  "CMakeFiles/Test.Engine.BP.WriteReadLocalVariablesSel.Serial.dir/TestBPWriteReadLocalVariablesSel.cpp.o"
+  "CMakeFiles/Test.Engine.BP.WriteReadLocalVariablesSel.Serial.dir/TestBPWriteReadLocalVariablesSel.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test.Engine.BP.WriteReadLocalVariablesSel.Serial.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
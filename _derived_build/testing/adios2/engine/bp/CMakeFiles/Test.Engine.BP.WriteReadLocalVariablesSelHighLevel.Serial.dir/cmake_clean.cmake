@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../bin/Test.Engine.BP.WriteReadLocalVariablesSelHighLevel.Serial"
+  "../../../../bin/Test.Engine.BP.WriteReadLocalVariablesSelHighLevel.Serial.pdb"
+  "CMakeFiles/Test.Engine.BP.WriteReadLocalVariablesSelHighLevel.Serial.dir/TestBPWriteReadLocalVariablesSelHighLevel.cpp.o"
+  "CMakeFiles/Test.Engine.BP.WriteReadLocalVariablesSelHighLevel.Serial.dir/TestBPWriteReadLocalVariablesSelHighLevel.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test.Engine.BP.WriteReadLocalVariablesSelHighLevel.Serial.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../bin/Test.Engine.BP.WriteReadMultiblock.Serial"
+  "../../../../bin/Test.Engine.BP.WriteReadMultiblock.Serial.pdb"
+  "CMakeFiles/Test.Engine.BP.WriteReadMultiblock.Serial.dir/TestBPWriteReadMultiblock.cpp.o"
+  "CMakeFiles/Test.Engine.BP.WriteReadMultiblock.Serial.dir/TestBPWriteReadMultiblock.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test.Engine.BP.WriteReadMultiblock.Serial.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../bin/Test.Engine.BP.WriteReadVariableSpan.Serial"
+  "../../../../bin/Test.Engine.BP.WriteReadVariableSpan.Serial.pdb"
+  "CMakeFiles/Test.Engine.BP.WriteReadVariableSpan.Serial.dir/TestBPWriteReadVariableSpan.cpp.o"
+  "CMakeFiles/Test.Engine.BP.WriteReadVariableSpan.Serial.dir/TestBPWriteReadVariableSpan.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test.Engine.BP.WriteReadVariableSpan.Serial.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
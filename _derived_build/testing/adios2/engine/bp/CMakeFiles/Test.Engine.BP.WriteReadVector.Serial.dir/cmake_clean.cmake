@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../bin/Test.Engine.BP.WriteReadVector.Serial"
+  "../../../../bin/Test.Engine.BP.WriteReadVector.Serial.pdb"
+  "CMakeFiles/Test.Engine.BP.WriteReadVector.Serial.dir/TestBPWriteReadVector.cpp.o"
+  "CMakeFiles/Test.Engine.BP.WriteReadVector.Serial.dir/TestBPWriteReadVector.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test.Engine.BP.WriteReadVector.Serial.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
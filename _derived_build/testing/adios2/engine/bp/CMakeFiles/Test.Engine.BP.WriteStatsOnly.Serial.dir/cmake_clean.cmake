@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../bin/Test.Engine.BP.WriteStatsOnly.Serial"
+  "../../../../bin/Test.Engine.BP.WriteStatsOnly.Serial.pdb"
+  "CMakeFiles/Test.Engine.BP.WriteStatsOnly.Serial.dir/TestBPWriteStatsOnly.cpp.o"
+  "CMakeFiles/Test.Engine.BP.WriteStatsOnly.Serial.dir/TestBPWriteStatsOnly.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test.Engine.BP.WriteStatsOnly.Serial.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
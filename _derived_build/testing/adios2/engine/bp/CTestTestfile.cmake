@@ -0,0 +1,967 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/testing/adios2/engine/bp
+# Build directory: /root/repo/_derived_build/testing/adios2/engine/bp
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead1D8.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.ADIOS2BPWriteRead1D8" "BP3")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead1D8.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;114;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D2x4.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D2x4" "BP3")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D2x4.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;114;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2" "BP3")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;114;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead10D2x2.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.ADIOS2BPWriteRead10D2x2" "BP3")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead10D2x2.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;114;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2_ReadMultiSteps.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2_ReadMultiSteps" "BP3")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2_ReadMultiSteps.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;114;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2_MultiStepsOverflow.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2_MultiStepsOverflow" "BP3")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2_MultiStepsOverflow.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;114;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.OpenEngineTwice.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.OpenEngineTwice" "BP3")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.OpenEngineTwice.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;114;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.ReadStartCount.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.ReadStartCount" "BP3")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.ReadStartCount.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;114;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteReadEmptyProcess.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.ADIOS2BPWriteReadEmptyProcess" "BP3")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteReadEmptyProcess.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;114;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.GetDeferredInClose.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.GetDeferredInClose" "BP3")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.GetDeferredInClose.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;114;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.GetDeferredInEndStep.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.GetDeferredInEndStep" "BP3")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.GetDeferredInEndStep.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;114;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.GetDeferredWithoutEndStep.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.GetDeferredWithoutEndStep" "BP3")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.GetDeferredWithoutEndStep.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;114;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead1D8.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.ADIOS2BPWriteRead1D8" "BP4")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead1D8.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;114;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D2x4.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D2x4" "BP4")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D2x4.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;114;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2" "BP4")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;114;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead10D2x2.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.ADIOS2BPWriteRead10D2x2" "BP4")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead10D2x2.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;114;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2_ReadMultiSteps.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2_ReadMultiSteps" "BP4")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2_ReadMultiSteps.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;114;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2_MultiStepsOverflow.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2_MultiStepsOverflow" "BP4")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2_MultiStepsOverflow.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;114;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.OpenEngineTwice.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.OpenEngineTwice" "BP4")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.OpenEngineTwice.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;114;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.ReadStartCount.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.ReadStartCount" "BP4")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.ReadStartCount.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;114;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteReadEmptyProcess.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.ADIOS2BPWriteReadEmptyProcess" "BP4")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteReadEmptyProcess.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;114;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.GetDeferredInClose.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.GetDeferredInClose" "BP4")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.GetDeferredInClose.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;114;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.GetDeferredInEndStep.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.GetDeferredInEndStep" "BP4")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.GetDeferredInEndStep.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;114;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.GetDeferredWithoutEndStep.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.GetDeferredWithoutEndStep" "BP4")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.GetDeferredWithoutEndStep.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;114;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead1D8.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.ADIOS2BPWriteRead1D8" "BP5")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead1D8.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;114;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D2x4.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D2x4" "BP5")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D2x4.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;114;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2" "BP5")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;114;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead10D2x2.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.ADIOS2BPWriteRead10D2x2" "BP5")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead10D2x2.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;114;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2_ReadMultiSteps.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2_ReadMultiSteps" "BP5")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2_ReadMultiSteps.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;114;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2_MultiStepsOverflow.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2_MultiStepsOverflow" "BP5")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2_MultiStepsOverflow.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;114;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.OpenEngineTwice.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.OpenEngineTwice" "BP5")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.OpenEngineTwice.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;114;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.ReadStartCount.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.ReadStartCount" "BP5")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.ReadStartCount.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;114;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteReadEmptyProcess.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.ADIOS2BPWriteReadEmptyProcess" "BP5")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteReadEmptyProcess.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;114;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.GetDeferredInClose.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.GetDeferredInClose" "BP5")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.GetDeferredInClose.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;114;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.GetDeferredInEndStep.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.GetDeferredInEndStep" "BP5")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.GetDeferredInEndStep.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;114;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.GetDeferredWithoutEndStep.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.GetDeferredWithoutEndStep" "BP5")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.GetDeferredWithoutEndStep.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;114;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead1D8.Async.BP5.TLS.Guided.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.ADIOS2BPWriteRead1D8" "BP5" "AggregationType=TwoLevelShm,AsyncWrite=Guided")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead1D8.Async.BP5.TLS.Guided.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/async/tls-guided" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;67;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;115;async_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D2x4.Async.BP5.TLS.Guided.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D2x4" "BP5" "AggregationType=TwoLevelShm,AsyncWrite=Guided")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D2x4.Async.BP5.TLS.Guided.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/async/tls-guided" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;67;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;115;async_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2.Async.BP5.TLS.Guided.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2" "BP5" "AggregationType=TwoLevelShm,AsyncWrite=Guided")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2.Async.BP5.TLS.Guided.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/async/tls-guided" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;67;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;115;async_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead10D2x2.Async.BP5.TLS.Guided.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.ADIOS2BPWriteRead10D2x2" "BP5" "AggregationType=TwoLevelShm,AsyncWrite=Guided")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead10D2x2.Async.BP5.TLS.Guided.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/async/tls-guided" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;67;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;115;async_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2_ReadMultiSteps.Async.BP5.TLS.Guided.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2_ReadMultiSteps" "BP5" "AggregationType=TwoLevelShm,AsyncWrite=Guided")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2_ReadMultiSteps.Async.BP5.TLS.Guided.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/async/tls-guided" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;67;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;115;async_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2_MultiStepsOverflow.Async.BP5.TLS.Guided.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2_MultiStepsOverflow" "BP5" "AggregationType=TwoLevelShm,AsyncWrite=Guided")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2_MultiStepsOverflow.Async.BP5.TLS.Guided.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/async/tls-guided" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;67;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;115;async_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.OpenEngineTwice.Async.BP5.TLS.Guided.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.OpenEngineTwice" "BP5" "AggregationType=TwoLevelShm,AsyncWrite=Guided")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.OpenEngineTwice.Async.BP5.TLS.Guided.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/async/tls-guided" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;67;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;115;async_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.ReadStartCount.Async.BP5.TLS.Guided.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.ReadStartCount" "BP5" "AggregationType=TwoLevelShm,AsyncWrite=Guided")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.ReadStartCount.Async.BP5.TLS.Guided.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/async/tls-guided" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;67;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;115;async_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteReadEmptyProcess.Async.BP5.TLS.Guided.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.ADIOS2BPWriteReadEmptyProcess" "BP5" "AggregationType=TwoLevelShm,AsyncWrite=Guided")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteReadEmptyProcess.Async.BP5.TLS.Guided.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/async/tls-guided" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;67;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;115;async_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.GetDeferredInClose.Async.BP5.TLS.Guided.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.GetDeferredInClose" "BP5" "AggregationType=TwoLevelShm,AsyncWrite=Guided")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.GetDeferredInClose.Async.BP5.TLS.Guided.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/async/tls-guided" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;67;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;115;async_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.GetDeferredInEndStep.Async.BP5.TLS.Guided.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.GetDeferredInEndStep" "BP5" "AggregationType=TwoLevelShm,AsyncWrite=Guided")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.GetDeferredInEndStep.Async.BP5.TLS.Guided.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/async/tls-guided" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;67;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;115;async_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.GetDeferredWithoutEndStep.Async.BP5.TLS.Guided.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.GetDeferredWithoutEndStep" "BP5" "AggregationType=TwoLevelShm,AsyncWrite=Guided")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.GetDeferredWithoutEndStep.Async.BP5.TLS.Guided.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/async/tls-guided" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;67;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;115;async_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead1D8.Async.BP5.TLS.Naive.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.ADIOS2BPWriteRead1D8" "BP5" "AggregationType=TwoLevelShm,AsyncWrite=Naive")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead1D8.Async.BP5.TLS.Naive.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/async/tls-naive" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;70;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;115;async_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D2x4.Async.BP5.TLS.Naive.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D2x4" "BP5" "AggregationType=TwoLevelShm,AsyncWrite=Naive")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D2x4.Async.BP5.TLS.Naive.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/async/tls-naive" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;70;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;115;async_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2.Async.BP5.TLS.Naive.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2" "BP5" "AggregationType=TwoLevelShm,AsyncWrite=Naive")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2.Async.BP5.TLS.Naive.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/async/tls-naive" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;70;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;115;async_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead10D2x2.Async.BP5.TLS.Naive.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.ADIOS2BPWriteRead10D2x2" "BP5" "AggregationType=TwoLevelShm,AsyncWrite=Naive")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead10D2x2.Async.BP5.TLS.Naive.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/async/tls-naive" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;70;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;115;async_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2_ReadMultiSteps.Async.BP5.TLS.Naive.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2_ReadMultiSteps" "BP5" "AggregationType=TwoLevelShm,AsyncWrite=Naive")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2_ReadMultiSteps.Async.BP5.TLS.Naive.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/async/tls-naive" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;70;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;115;async_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2_MultiStepsOverflow.Async.BP5.TLS.Naive.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2_MultiStepsOverflow" "BP5" "AggregationType=TwoLevelShm,AsyncWrite=Naive")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2_MultiStepsOverflow.Async.BP5.TLS.Naive.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/async/tls-naive" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;70;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;115;async_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.OpenEngineTwice.Async.BP5.TLS.Naive.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.OpenEngineTwice" "BP5" "AggregationType=TwoLevelShm,AsyncWrite=Naive")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.OpenEngineTwice.Async.BP5.TLS.Naive.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/async/tls-naive" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;70;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;115;async_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.ReadStartCount.Async.BP5.TLS.Naive.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.ReadStartCount" "BP5" "AggregationType=TwoLevelShm,AsyncWrite=Naive")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.ReadStartCount.Async.BP5.TLS.Naive.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/async/tls-naive" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;70;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;115;async_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteReadEmptyProcess.Async.BP5.TLS.Naive.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.ADIOS2BPWriteReadEmptyProcess" "BP5" "AggregationType=TwoLevelShm,AsyncWrite=Naive")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteReadEmptyProcess.Async.BP5.TLS.Naive.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/async/tls-naive" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;70;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;115;async_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.GetDeferredInClose.Async.BP5.TLS.Naive.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.GetDeferredInClose" "BP5" "AggregationType=TwoLevelShm,AsyncWrite=Naive")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.GetDeferredInClose.Async.BP5.TLS.Naive.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/async/tls-naive" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;70;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;115;async_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.GetDeferredInEndStep.Async.BP5.TLS.Naive.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.GetDeferredInEndStep" "BP5" "AggregationType=TwoLevelShm,AsyncWrite=Naive")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.GetDeferredInEndStep.Async.BP5.TLS.Naive.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/async/tls-naive" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;70;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;115;async_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.GetDeferredWithoutEndStep.Async.BP5.TLS.Naive.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.GetDeferredWithoutEndStep" "BP5" "AggregationType=TwoLevelShm,AsyncWrite=Naive")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.GetDeferredWithoutEndStep.Async.BP5.TLS.Naive.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/async/tls-naive" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;70;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;115;async_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead1D8.Async.BP5.EWS.Guided.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.ADIOS2BPWriteRead1D8" "BP5" "AggregationType=EveryoneWritesSerial,AsyncWrite=Guided")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead1D8.Async.BP5.EWS.Guided.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/async/ews-guided" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;73;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;115;async_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D2x4.Async.BP5.EWS.Guided.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D2x4" "BP5" "AggregationType=EveryoneWritesSerial,AsyncWrite=Guided")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D2x4.Async.BP5.EWS.Guided.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/async/ews-guided" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;73;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;115;async_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2.Async.BP5.EWS.Guided.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2" "BP5" "AggregationType=EveryoneWritesSerial,AsyncWrite=Guided")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2.Async.BP5.EWS.Guided.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/async/ews-guided" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;73;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;115;async_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead10D2x2.Async.BP5.EWS.Guided.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.ADIOS2BPWriteRead10D2x2" "BP5" "AggregationType=EveryoneWritesSerial,AsyncWrite=Guided")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead10D2x2.Async.BP5.EWS.Guided.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/async/ews-guided" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;73;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;115;async_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2_ReadMultiSteps.Async.BP5.EWS.Guided.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2_ReadMultiSteps" "BP5" "AggregationType=EveryoneWritesSerial,AsyncWrite=Guided")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2_ReadMultiSteps.Async.BP5.EWS.Guided.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/async/ews-guided" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;73;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;115;async_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2_MultiStepsOverflow.Async.BP5.EWS.Guided.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2_MultiStepsOverflow" "BP5" "AggregationType=EveryoneWritesSerial,AsyncWrite=Guided")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2_MultiStepsOverflow.Async.BP5.EWS.Guided.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/async/ews-guided" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;73;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;115;async_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.OpenEngineTwice.Async.BP5.EWS.Guided.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.OpenEngineTwice" "BP5" "AggregationType=EveryoneWritesSerial,AsyncWrite=Guided")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.OpenEngineTwice.Async.BP5.EWS.Guided.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/async/ews-guided" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;73;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;115;async_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.ReadStartCount.Async.BP5.EWS.Guided.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.ReadStartCount" "BP5" "AggregationType=EveryoneWritesSerial,AsyncWrite=Guided")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.ReadStartCount.Async.BP5.EWS.Guided.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/async/ews-guided" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;73;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;115;async_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteReadEmptyProcess.Async.BP5.EWS.Guided.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.ADIOS2BPWriteReadEmptyProcess" "BP5" "AggregationType=EveryoneWritesSerial,AsyncWrite=Guided")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteReadEmptyProcess.Async.BP5.EWS.Guided.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/async/ews-guided" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;73;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;115;async_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.GetDeferredInClose.Async.BP5.EWS.Guided.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.GetDeferredInClose" "BP5" "AggregationType=EveryoneWritesSerial,AsyncWrite=Guided")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.GetDeferredInClose.Async.BP5.EWS.Guided.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/async/ews-guided" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;73;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;115;async_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.GetDeferredInEndStep.Async.BP5.EWS.Guided.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.GetDeferredInEndStep" "BP5" "AggregationType=EveryoneWritesSerial,AsyncWrite=Guided")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.GetDeferredInEndStep.Async.BP5.EWS.Guided.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/async/ews-guided" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;73;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;115;async_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.GetDeferredWithoutEndStep.Async.BP5.EWS.Guided.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.GetDeferredWithoutEndStep" "BP5" "AggregationType=EveryoneWritesSerial,AsyncWrite=Guided")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.GetDeferredWithoutEndStep.Async.BP5.EWS.Guided.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/async/ews-guided" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;73;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;115;async_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead1D8.Async.BP5.EWS.Naive.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.ADIOS2BPWriteRead1D8" "BP5" "AggregationType=EveryoneWritesSerial,AsyncWrite=Naive")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead1D8.Async.BP5.EWS.Naive.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/async/ews-naive" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;76;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;115;async_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D2x4.Async.BP5.EWS.Naive.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D2x4" "BP5" "AggregationType=EveryoneWritesSerial,AsyncWrite=Naive")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D2x4.Async.BP5.EWS.Naive.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/async/ews-naive" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;76;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;115;async_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2.Async.BP5.EWS.Naive.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2" "BP5" "AggregationType=EveryoneWritesSerial,AsyncWrite=Naive")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2.Async.BP5.EWS.Naive.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/async/ews-naive" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;76;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;115;async_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead10D2x2.Async.BP5.EWS.Naive.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.ADIOS2BPWriteRead10D2x2" "BP5" "AggregationType=EveryoneWritesSerial,AsyncWrite=Naive")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead10D2x2.Async.BP5.EWS.Naive.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/async/ews-naive" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;76;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;115;async_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2_ReadMultiSteps.Async.BP5.EWS.Naive.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2_ReadMultiSteps" "BP5" "AggregationType=EveryoneWritesSerial,AsyncWrite=Naive")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2_ReadMultiSteps.Async.BP5.EWS.Naive.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/async/ews-naive" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;76;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;115;async_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2_MultiStepsOverflow.Async.BP5.EWS.Naive.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2_MultiStepsOverflow" "BP5" "AggregationType=EveryoneWritesSerial,AsyncWrite=Naive")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2_MultiStepsOverflow.Async.BP5.EWS.Naive.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/async/ews-naive" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;76;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;115;async_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.OpenEngineTwice.Async.BP5.EWS.Naive.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.OpenEngineTwice" "BP5" "AggregationType=EveryoneWritesSerial,AsyncWrite=Naive")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.OpenEngineTwice.Async.BP5.EWS.Naive.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/async/ews-naive" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;76;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;115;async_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.ReadStartCount.Async.BP5.EWS.Naive.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.ReadStartCount" "BP5" "AggregationType=EveryoneWritesSerial,AsyncWrite=Naive")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.ReadStartCount.Async.BP5.EWS.Naive.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/async/ews-naive" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;76;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;115;async_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteReadEmptyProcess.Async.BP5.EWS.Naive.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.ADIOS2BPWriteReadEmptyProcess" "BP5" "AggregationType=EveryoneWritesSerial,AsyncWrite=Naive")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteReadEmptyProcess.Async.BP5.EWS.Naive.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/async/ews-naive" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;76;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;115;async_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.GetDeferredInClose.Async.BP5.EWS.Naive.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.GetDeferredInClose" "BP5" "AggregationType=EveryoneWritesSerial,AsyncWrite=Naive")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.GetDeferredInClose.Async.BP5.EWS.Naive.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/async/ews-naive" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;76;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;115;async_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.GetDeferredInEndStep.Async.BP5.EWS.Naive.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.GetDeferredInEndStep" "BP5" "AggregationType=EveryoneWritesSerial,AsyncWrite=Naive")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.GetDeferredInEndStep.Async.BP5.EWS.Naive.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/async/ews-naive" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;76;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;115;async_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.GetDeferredWithoutEndStep.Async.BP5.EWS.Naive.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.GetDeferredWithoutEndStep" "BP5" "AggregationType=EveryoneWritesSerial,AsyncWrite=Naive")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.GetDeferredWithoutEndStep.Async.BP5.EWS.Naive.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/async/ews-naive" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;76;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;115;async_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead1D8.BP5.NoCoalesce.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.ADIOS2BPWriteRead1D8" "BP5" "ReadCoalesceMaxSize=0")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead1D8.BP5.NoCoalesce.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/NoCoalesce" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;85;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;116;bp5_params_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D2x4.BP5.NoCoalesce.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D2x4" "BP5" "ReadCoalesceMaxSize=0")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D2x4.BP5.NoCoalesce.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/NoCoalesce" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;85;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;116;bp5_params_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2.BP5.NoCoalesce.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2" "BP5" "ReadCoalesceMaxSize=0")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2.BP5.NoCoalesce.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/NoCoalesce" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;85;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;116;bp5_params_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead10D2x2.BP5.NoCoalesce.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.ADIOS2BPWriteRead10D2x2" "BP5" "ReadCoalesceMaxSize=0")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead10D2x2.BP5.NoCoalesce.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/NoCoalesce" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;85;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;116;bp5_params_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2_ReadMultiSteps.BP5.NoCoalesce.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2_ReadMultiSteps" "BP5" "ReadCoalesceMaxSize=0")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2_ReadMultiSteps.BP5.NoCoalesce.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/NoCoalesce" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;85;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;116;bp5_params_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2_MultiStepsOverflow.BP5.NoCoalesce.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2_MultiStepsOverflow" "BP5" "ReadCoalesceMaxSize=0")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2_MultiStepsOverflow.BP5.NoCoalesce.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/NoCoalesce" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;85;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;116;bp5_params_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.OpenEngineTwice.BP5.NoCoalesce.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.OpenEngineTwice" "BP5" "ReadCoalesceMaxSize=0")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.OpenEngineTwice.BP5.NoCoalesce.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/NoCoalesce" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;85;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;116;bp5_params_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.ReadStartCount.BP5.NoCoalesce.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.ReadStartCount" "BP5" "ReadCoalesceMaxSize=0")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.ReadStartCount.BP5.NoCoalesce.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/NoCoalesce" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;85;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;116;bp5_params_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteReadEmptyProcess.BP5.NoCoalesce.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.ADIOS2BPWriteReadEmptyProcess" "BP5" "ReadCoalesceMaxSize=0")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteReadEmptyProcess.BP5.NoCoalesce.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/NoCoalesce" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;85;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;116;bp5_params_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.GetDeferredInClose.BP5.NoCoalesce.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.GetDeferredInClose" "BP5" "ReadCoalesceMaxSize=0")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.GetDeferredInClose.BP5.NoCoalesce.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/NoCoalesce" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;85;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;116;bp5_params_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.GetDeferredInEndStep.BP5.NoCoalesce.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.GetDeferredInEndStep" "BP5" "ReadCoalesceMaxSize=0")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.GetDeferredInEndStep.BP5.NoCoalesce.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/NoCoalesce" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;85;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;116;bp5_params_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.GetDeferredWithoutEndStep.BP5.NoCoalesce.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.GetDeferredWithoutEndStep" "BP5" "ReadCoalesceMaxSize=0")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.GetDeferredWithoutEndStep.BP5.NoCoalesce.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/NoCoalesce" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;85;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;116;bp5_params_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead1D8.BP5.SmallCoalesce.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.ADIOS2BPWriteRead1D8" "BP5" "ReadCoalesceMaxSize=4Kb,ReadCoalesceGapSize=0,Threads=2")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead1D8.BP5.SmallCoalesce.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/SmallCoalesce" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;85;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;117;bp5_params_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D2x4.BP5.SmallCoalesce.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D2x4" "BP5" "ReadCoalesceMaxSize=4Kb,ReadCoalesceGapSize=0,Threads=2")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D2x4.BP5.SmallCoalesce.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/SmallCoalesce" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;85;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;117;bp5_params_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2.BP5.SmallCoalesce.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2" "BP5" "ReadCoalesceMaxSize=4Kb,ReadCoalesceGapSize=0,Threads=2")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2.BP5.SmallCoalesce.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/SmallCoalesce" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;85;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;117;bp5_params_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead10D2x2.BP5.SmallCoalesce.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.ADIOS2BPWriteRead10D2x2" "BP5" "ReadCoalesceMaxSize=4Kb,ReadCoalesceGapSize=0,Threads=2")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead10D2x2.BP5.SmallCoalesce.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/SmallCoalesce" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;85;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;117;bp5_params_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2_ReadMultiSteps.BP5.SmallCoalesce.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2_ReadMultiSteps" "BP5" "ReadCoalesceMaxSize=4Kb,ReadCoalesceGapSize=0,Threads=2")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2_ReadMultiSteps.BP5.SmallCoalesce.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/SmallCoalesce" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;85;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;117;bp5_params_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2_MultiStepsOverflow.BP5.SmallCoalesce.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2_MultiStepsOverflow" "BP5" "ReadCoalesceMaxSize=4Kb,ReadCoalesceGapSize=0,Threads=2")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2_MultiStepsOverflow.BP5.SmallCoalesce.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/SmallCoalesce" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;85;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;117;bp5_params_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.OpenEngineTwice.BP5.SmallCoalesce.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.OpenEngineTwice" "BP5" "ReadCoalesceMaxSize=4Kb,ReadCoalesceGapSize=0,Threads=2")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.OpenEngineTwice.BP5.SmallCoalesce.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/SmallCoalesce" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;85;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;117;bp5_params_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.ReadStartCount.BP5.SmallCoalesce.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.ReadStartCount" "BP5" "ReadCoalesceMaxSize=4Kb,ReadCoalesceGapSize=0,Threads=2")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.ReadStartCount.BP5.SmallCoalesce.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/SmallCoalesce" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;85;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;117;bp5_params_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteReadEmptyProcess.BP5.SmallCoalesce.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.ADIOS2BPWriteReadEmptyProcess" "BP5" "ReadCoalesceMaxSize=4Kb,ReadCoalesceGapSize=0,Threads=2")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteReadEmptyProcess.BP5.SmallCoalesce.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/SmallCoalesce" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;85;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;117;bp5_params_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.GetDeferredInClose.BP5.SmallCoalesce.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.GetDeferredInClose" "BP5" "ReadCoalesceMaxSize=4Kb,ReadCoalesceGapSize=0,Threads=2")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.GetDeferredInClose.BP5.SmallCoalesce.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/SmallCoalesce" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;85;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;117;bp5_params_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.GetDeferredInEndStep.BP5.SmallCoalesce.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.GetDeferredInEndStep" "BP5" "ReadCoalesceMaxSize=4Kb,ReadCoalesceGapSize=0,Threads=2")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.GetDeferredInEndStep.BP5.SmallCoalesce.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/SmallCoalesce" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;85;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;117;bp5_params_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.GetDeferredWithoutEndStep.BP5.SmallCoalesce.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.GetDeferredWithoutEndStep" "BP5" "ReadCoalesceMaxSize=4Kb,ReadCoalesceGapSize=0,Threads=2")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.GetDeferredWithoutEndStep.BP5.SmallCoalesce.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/SmallCoalesce" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;85;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;117;bp5_params_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead1D8.BP5.MaxInstalledSteps.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.ADIOS2BPWriteRead1D8" "BP5" "MaxInstalledSteps=2")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead1D8.BP5.MaxInstalledSteps.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/MaxInstalledSteps" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;85;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;119;bp5_params_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D2x4.BP5.MaxInstalledSteps.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D2x4" "BP5" "MaxInstalledSteps=2")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D2x4.BP5.MaxInstalledSteps.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/MaxInstalledSteps" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;85;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;119;bp5_params_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2.BP5.MaxInstalledSteps.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2" "BP5" "MaxInstalledSteps=2")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2.BP5.MaxInstalledSteps.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/MaxInstalledSteps" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;85;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;119;bp5_params_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead10D2x2.BP5.MaxInstalledSteps.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.ADIOS2BPWriteRead10D2x2" "BP5" "MaxInstalledSteps=2")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead10D2x2.BP5.MaxInstalledSteps.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/MaxInstalledSteps" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;85;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;119;bp5_params_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2_ReadMultiSteps.BP5.MaxInstalledSteps.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2_ReadMultiSteps" "BP5" "MaxInstalledSteps=2")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2_ReadMultiSteps.BP5.MaxInstalledSteps.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/MaxInstalledSteps" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;85;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;119;bp5_params_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2_MultiStepsOverflow.BP5.MaxInstalledSteps.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2_MultiStepsOverflow" "BP5" "MaxInstalledSteps=2")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2_MultiStepsOverflow.BP5.MaxInstalledSteps.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/MaxInstalledSteps" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;85;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;119;bp5_params_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.OpenEngineTwice.BP5.MaxInstalledSteps.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.OpenEngineTwice" "BP5" "MaxInstalledSteps=2")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.OpenEngineTwice.BP5.MaxInstalledSteps.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/MaxInstalledSteps" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;85;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;119;bp5_params_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.ReadStartCount.BP5.MaxInstalledSteps.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.ReadStartCount" "BP5" "MaxInstalledSteps=2")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.ReadStartCount.BP5.MaxInstalledSteps.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/MaxInstalledSteps" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;85;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;119;bp5_params_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteReadEmptyProcess.BP5.MaxInstalledSteps.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.ADIOS2BPWriteReadEmptyProcess" "BP5" "MaxInstalledSteps=2")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteReadEmptyProcess.BP5.MaxInstalledSteps.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/MaxInstalledSteps" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;85;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;119;bp5_params_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.GetDeferredInClose.BP5.MaxInstalledSteps.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.GetDeferredInClose" "BP5" "MaxInstalledSteps=2")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.GetDeferredInClose.BP5.MaxInstalledSteps.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/MaxInstalledSteps" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;85;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;119;bp5_params_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.GetDeferredInEndStep.BP5.MaxInstalledSteps.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.GetDeferredInEndStep" "BP5" "MaxInstalledSteps=2")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.GetDeferredInEndStep.BP5.MaxInstalledSteps.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/MaxInstalledSteps" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;85;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;119;bp5_params_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.GetDeferredWithoutEndStep.BP5.MaxInstalledSteps.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.GetDeferredWithoutEndStep" "BP5" "MaxInstalledSteps=2")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.GetDeferredWithoutEndStep.BP5.MaxInstalledSteps.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/MaxInstalledSteps" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;85;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;119;bp5_params_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead1D8.BP5.NodeShared.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.ADIOS2BPWriteRead1D8" "BP5" "NodeSharedMetadata=true")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead1D8.BP5.NodeShared.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/NodeShared" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;85;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;120;bp5_params_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D2x4.BP5.NodeShared.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D2x4" "BP5" "NodeSharedMetadata=true")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D2x4.BP5.NodeShared.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/NodeShared" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;85;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;120;bp5_params_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2.BP5.NodeShared.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2" "BP5" "NodeSharedMetadata=true")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2.BP5.NodeShared.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/NodeShared" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;85;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;120;bp5_params_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead10D2x2.BP5.NodeShared.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.ADIOS2BPWriteRead10D2x2" "BP5" "NodeSharedMetadata=true")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead10D2x2.BP5.NodeShared.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/NodeShared" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;85;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;120;bp5_params_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2_ReadMultiSteps.BP5.NodeShared.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2_ReadMultiSteps" "BP5" "NodeSharedMetadata=true")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2_ReadMultiSteps.BP5.NodeShared.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/NodeShared" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;85;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;120;bp5_params_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2_MultiStepsOverflow.BP5.NodeShared.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2_MultiStepsOverflow" "BP5" "NodeSharedMetadata=true")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2_MultiStepsOverflow.BP5.NodeShared.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/NodeShared" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;85;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;120;bp5_params_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.OpenEngineTwice.BP5.NodeShared.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.OpenEngineTwice" "BP5" "NodeSharedMetadata=true")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.OpenEngineTwice.BP5.NodeShared.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/NodeShared" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;85;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;120;bp5_params_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.ReadStartCount.BP5.NodeShared.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.ReadStartCount" "BP5" "NodeSharedMetadata=true")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.ReadStartCount.BP5.NodeShared.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/NodeShared" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;85;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;120;bp5_params_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteReadEmptyProcess.BP5.NodeShared.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.ADIOS2BPWriteReadEmptyProcess" "BP5" "NodeSharedMetadata=true")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteReadEmptyProcess.BP5.NodeShared.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/NodeShared" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;85;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;120;bp5_params_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.GetDeferredInClose.BP5.NodeShared.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.GetDeferredInClose" "BP5" "NodeSharedMetadata=true")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.GetDeferredInClose.BP5.NodeShared.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/NodeShared" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;85;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;120;bp5_params_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.GetDeferredInEndStep.BP5.NodeShared.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.GetDeferredInEndStep" "BP5" "NodeSharedMetadata=true")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.GetDeferredInEndStep.BP5.NodeShared.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/NodeShared" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;85;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;120;bp5_params_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.GetDeferredWithoutEndStep.BP5.NodeShared.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.GetDeferredWithoutEndStep" "BP5" "NodeSharedMetadata=true")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.GetDeferredWithoutEndStep.BP5.NodeShared.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/NodeShared" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;85;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;120;bp5_params_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead1D8.BP5.ParallelMetadata.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.ADIOS2BPWriteRead1D8" "BP5" "Threads=4")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead1D8.BP5.ParallelMetadata.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/ParallelMetadata" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;85;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;121;bp5_params_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D2x4.BP5.ParallelMetadata.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D2x4" "BP5" "Threads=4")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D2x4.BP5.ParallelMetadata.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/ParallelMetadata" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;85;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;121;bp5_params_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2.BP5.ParallelMetadata.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2" "BP5" "Threads=4")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2.BP5.ParallelMetadata.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/ParallelMetadata" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;85;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;121;bp5_params_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead10D2x2.BP5.ParallelMetadata.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.ADIOS2BPWriteRead10D2x2" "BP5" "Threads=4")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead10D2x2.BP5.ParallelMetadata.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/ParallelMetadata" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;85;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;121;bp5_params_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2_ReadMultiSteps.BP5.ParallelMetadata.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2_ReadMultiSteps" "BP5" "Threads=4")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2_ReadMultiSteps.BP5.ParallelMetadata.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/ParallelMetadata" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;85;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;121;bp5_params_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2_MultiStepsOverflow.BP5.ParallelMetadata.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2_MultiStepsOverflow" "BP5" "Threads=4")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteRead2D4x2_MultiStepsOverflow.BP5.ParallelMetadata.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/ParallelMetadata" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;85;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;121;bp5_params_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.OpenEngineTwice.BP5.ParallelMetadata.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.OpenEngineTwice" "BP5" "Threads=4")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.OpenEngineTwice.BP5.ParallelMetadata.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/ParallelMetadata" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;85;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;121;bp5_params_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.ReadStartCount.BP5.ParallelMetadata.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.ReadStartCount" "BP5" "Threads=4")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.ReadStartCount.BP5.ParallelMetadata.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/ParallelMetadata" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;85;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;121;bp5_params_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteReadEmptyProcess.BP5.ParallelMetadata.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.ADIOS2BPWriteReadEmptyProcess" "BP5" "Threads=4")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.ADIOS2BPWriteReadEmptyProcess.BP5.ParallelMetadata.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/ParallelMetadata" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;85;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;121;bp5_params_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.GetDeferredInClose.BP5.ParallelMetadata.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.GetDeferredInClose" "BP5" "Threads=4")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.GetDeferredInClose.BP5.ParallelMetadata.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/ParallelMetadata" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;85;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;121;bp5_params_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.GetDeferredInEndStep.BP5.ParallelMetadata.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.GetDeferredInEndStep" "BP5" "Threads=4")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.GetDeferredInEndStep.BP5.ParallelMetadata.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/ParallelMetadata" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;85;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;121;bp5_params_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2.GetDeferredWithoutEndStep.BP5.ParallelMetadata.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2.Serial" "--gtest_filter=BPWriteReadTestADIOS2.GetDeferredWithoutEndStep" "BP5" "Threads=4")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2.GetDeferredWithoutEndStep.BP5.ParallelMetadata.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/ParallelMetadata" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;85;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;121;bp5_params_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2fstream.ADIOS2BPWriteRead1D8.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2fstream.Serial" "--gtest_filter=BPWriteReadTestADIOS2fstream.ADIOS2BPWriteRead1D8" "BP3")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2fstream.ADIOS2BPWriteRead1D8.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;125;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2fstream.ADIOS2BPWriteRead2D2x4.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2fstream.Serial" "--gtest_filter=BPWriteReadTestADIOS2fstream.ADIOS2BPWriteRead2D2x4" "BP3")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2fstream.ADIOS2BPWriteRead2D2x4.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;125;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2fstream.ADIOS2BPWriteRead2D4x2.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2fstream.Serial" "--gtest_filter=BPWriteReadTestADIOS2fstream.ADIOS2BPWriteRead2D4x2" "BP3")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2fstream.ADIOS2BPWriteRead2D4x2.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;125;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2fstream.ADIOS2BPWriteRead2D4x2_ReadMultiSteps.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2fstream.Serial" "--gtest_filter=BPWriteReadTestADIOS2fstream.ADIOS2BPWriteRead2D4x2_ReadMultiSteps" "BP3")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2fstream.ADIOS2BPWriteRead2D4x2_ReadMultiSteps.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;125;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2fstream.ADIOS2BPWriteRead2D4x2_MultiStepsOverflow.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2fstream.Serial" "--gtest_filter=BPWriteReadTestADIOS2fstream.ADIOS2BPWriteRead2D4x2_MultiStepsOverflow" "BP3")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2fstream.ADIOS2BPWriteRead2D4x2_MultiStepsOverflow.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;125;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2fstream.OpenEngineTwice.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2fstream.Serial" "--gtest_filter=BPWriteReadTestADIOS2fstream.OpenEngineTwice" "BP3")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2fstream.OpenEngineTwice.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;125;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2fstream.ADIOS2BPWriteRead1D8.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2fstream.Serial" "--gtest_filter=BPWriteReadTestADIOS2fstream.ADIOS2BPWriteRead1D8" "BP4")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2fstream.ADIOS2BPWriteRead1D8.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;125;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2fstream.ADIOS2BPWriteRead2D2x4.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2fstream.Serial" "--gtest_filter=BPWriteReadTestADIOS2fstream.ADIOS2BPWriteRead2D2x4" "BP4")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2fstream.ADIOS2BPWriteRead2D2x4.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;125;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2fstream.ADIOS2BPWriteRead2D4x2.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2fstream.Serial" "--gtest_filter=BPWriteReadTestADIOS2fstream.ADIOS2BPWriteRead2D4x2" "BP4")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2fstream.ADIOS2BPWriteRead2D4x2.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;125;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2fstream.ADIOS2BPWriteRead2D4x2_ReadMultiSteps.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2fstream.Serial" "--gtest_filter=BPWriteReadTestADIOS2fstream.ADIOS2BPWriteRead2D4x2_ReadMultiSteps" "BP4")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2fstream.ADIOS2BPWriteRead2D4x2_ReadMultiSteps.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;125;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2fstream.ADIOS2BPWriteRead2D4x2_MultiStepsOverflow.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2fstream.Serial" "--gtest_filter=BPWriteReadTestADIOS2fstream.ADIOS2BPWriteRead2D4x2_MultiStepsOverflow" "BP4")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2fstream.ADIOS2BPWriteRead2D4x2_MultiStepsOverflow.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;125;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2fstream.OpenEngineTwice.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2fstream.Serial" "--gtest_filter=BPWriteReadTestADIOS2fstream.OpenEngineTwice" "BP4")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2fstream.OpenEngineTwice.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;125;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2fstream.ADIOS2BPWriteRead1D8.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2fstream.Serial" "--gtest_filter=BPWriteReadTestADIOS2fstream.ADIOS2BPWriteRead1D8" "BP5")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2fstream.ADIOS2BPWriteRead1D8.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;125;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2fstream.ADIOS2BPWriteRead2D2x4.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2fstream.Serial" "--gtest_filter=BPWriteReadTestADIOS2fstream.ADIOS2BPWriteRead2D2x4" "BP5")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2fstream.ADIOS2BPWriteRead2D2x4.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;125;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2fstream.ADIOS2BPWriteRead2D4x2.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2fstream.Serial" "--gtest_filter=BPWriteReadTestADIOS2fstream.ADIOS2BPWriteRead2D4x2" "BP5")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2fstream.ADIOS2BPWriteRead2D4x2.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;125;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2fstream.ADIOS2BPWriteRead2D4x2_ReadMultiSteps.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2fstream.Serial" "--gtest_filter=BPWriteReadTestADIOS2fstream.ADIOS2BPWriteRead2D4x2_ReadMultiSteps" "BP5")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2fstream.ADIOS2BPWriteRead2D4x2_ReadMultiSteps.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;125;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2fstream.ADIOS2BPWriteRead2D4x2_MultiStepsOverflow.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2fstream.Serial" "--gtest_filter=BPWriteReadTestADIOS2fstream.ADIOS2BPWriteRead2D4x2_MultiStepsOverflow" "BP5")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2fstream.ADIOS2BPWriteRead2D4x2_MultiStepsOverflow.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;125;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2fstream.OpenEngineTwice.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2fstream.Serial" "--gtest_filter=BPWriteReadTestADIOS2fstream.OpenEngineTwice" "BP5")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2fstream.OpenEngineTwice.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;125;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2stdio.ADIOS2BPWriteRead1D8.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2stdio.Serial" "--gtest_filter=BPWriteReadTestADIOS2stdio.ADIOS2BPWriteRead1D8" "BP3")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2stdio.ADIOS2BPWriteRead1D8.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;126;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2stdio.ADIOS2BPWriteRead2D2x4.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2stdio.Serial" "--gtest_filter=BPWriteReadTestADIOS2stdio.ADIOS2BPWriteRead2D2x4" "BP3")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2stdio.ADIOS2BPWriteRead2D2x4.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;126;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2stdio.ADIOS2BPWriteRead2D4x2.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2stdio.Serial" "--gtest_filter=BPWriteReadTestADIOS2stdio.ADIOS2BPWriteRead2D4x2" "BP3")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2stdio.ADIOS2BPWriteRead2D4x2.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;126;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2stdio.ADIOS2BPWriteRead2D4x2_ReadMultiSteps.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2stdio.Serial" "--gtest_filter=BPWriteReadTestADIOS2stdio.ADIOS2BPWriteRead2D4x2_ReadMultiSteps" "BP3")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2stdio.ADIOS2BPWriteRead2D4x2_ReadMultiSteps.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;126;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2stdio.ADIOS2BPWriteRead2D4x2_MultiStepsOverflow.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2stdio.Serial" "--gtest_filter=BPWriteReadTestADIOS2stdio.ADIOS2BPWriteRead2D4x2_MultiStepsOverflow" "BP3")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2stdio.ADIOS2BPWriteRead2D4x2_MultiStepsOverflow.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;126;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2stdio.OpenEngineTwice.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2stdio.Serial" "--gtest_filter=BPWriteReadTestADIOS2stdio.OpenEngineTwice" "BP3")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2stdio.OpenEngineTwice.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;126;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2stdio.ADIOS2BPWriteRead1D8.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2stdio.Serial" "--gtest_filter=BPWriteReadTestADIOS2stdio.ADIOS2BPWriteRead1D8" "BP4")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2stdio.ADIOS2BPWriteRead1D8.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;126;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2stdio.ADIOS2BPWriteRead2D2x4.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2stdio.Serial" "--gtest_filter=BPWriteReadTestADIOS2stdio.ADIOS2BPWriteRead2D2x4" "BP4")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2stdio.ADIOS2BPWriteRead2D2x4.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;126;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2stdio.ADIOS2BPWriteRead2D4x2.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2stdio.Serial" "--gtest_filter=BPWriteReadTestADIOS2stdio.ADIOS2BPWriteRead2D4x2" "BP4")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2stdio.ADIOS2BPWriteRead2D4x2.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;126;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2stdio.ADIOS2BPWriteRead2D4x2_ReadMultiSteps.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2stdio.Serial" "--gtest_filter=BPWriteReadTestADIOS2stdio.ADIOS2BPWriteRead2D4x2_ReadMultiSteps" "BP4")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2stdio.ADIOS2BPWriteRead2D4x2_ReadMultiSteps.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;126;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2stdio.ADIOS2BPWriteRead2D4x2_MultiStepsOverflow.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2stdio.Serial" "--gtest_filter=BPWriteReadTestADIOS2stdio.ADIOS2BPWriteRead2D4x2_MultiStepsOverflow" "BP4")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2stdio.ADIOS2BPWriteRead2D4x2_MultiStepsOverflow.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;126;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2stdio.OpenEngineTwice.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2stdio.Serial" "--gtest_filter=BPWriteReadTestADIOS2stdio.OpenEngineTwice" "BP4")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2stdio.OpenEngineTwice.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;126;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2stdio.ADIOS2BPWriteRead1D8.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2stdio.Serial" "--gtest_filter=BPWriteReadTestADIOS2stdio.ADIOS2BPWriteRead1D8" "BP5")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2stdio.ADIOS2BPWriteRead1D8.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;126;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2stdio.ADIOS2BPWriteRead2D2x4.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2stdio.Serial" "--gtest_filter=BPWriteReadTestADIOS2stdio.ADIOS2BPWriteRead2D2x4" "BP5")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2stdio.ADIOS2BPWriteRead2D2x4.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;126;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2stdio.ADIOS2BPWriteRead2D4x2.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2stdio.Serial" "--gtest_filter=BPWriteReadTestADIOS2stdio.ADIOS2BPWriteRead2D4x2" "BP5")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2stdio.ADIOS2BPWriteRead2D4x2.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;126;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2stdio.ADIOS2BPWriteRead2D4x2_ReadMultiSteps.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2stdio.Serial" "--gtest_filter=BPWriteReadTestADIOS2stdio.ADIOS2BPWriteRead2D4x2_ReadMultiSteps" "BP5")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2stdio.ADIOS2BPWriteRead2D4x2_ReadMultiSteps.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;126;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2stdio.ADIOS2BPWriteRead2D4x2_MultiStepsOverflow.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2stdio.Serial" "--gtest_filter=BPWriteReadTestADIOS2stdio.ADIOS2BPWriteRead2D4x2_MultiStepsOverflow" "BP5")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2stdio.ADIOS2BPWriteRead2D4x2_MultiStepsOverflow.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;126;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadTestADIOS2stdio.OpenEngineTwice.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadADIOS2stdio.Serial" "--gtest_filter=BPWriteReadTestADIOS2stdio.OpenEngineTwice" "BP5")
+set_tests_properties(Engine.BP.BPWriteReadTestADIOS2stdio.OpenEngineTwice.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;126;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadAsStreamTestADIOS2.ADIOS2BPWriteRead1D8.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadAsStreamADIOS2.Serial" "--gtest_filter=BPWriteReadAsStreamTestADIOS2.ADIOS2BPWriteRead1D8" "BP3")
+set_tests_properties(Engine.BP.BPWriteReadAsStreamTestADIOS2.ADIOS2BPWriteRead1D8.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;127;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadAsStreamTestADIOS2.ADIOS2BPWriteRead2D2x4.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadAsStreamADIOS2.Serial" "--gtest_filter=BPWriteReadAsStreamTestADIOS2.ADIOS2BPWriteRead2D2x4" "BP3")
+set_tests_properties(Engine.BP.BPWriteReadAsStreamTestADIOS2.ADIOS2BPWriteRead2D2x4.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;127;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadAsStreamTestADIOS2.ADIOS2BPWriteRead2D4x2.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadAsStreamADIOS2.Serial" "--gtest_filter=BPWriteReadAsStreamTestADIOS2.ADIOS2BPWriteRead2D4x2" "BP3")
+set_tests_properties(Engine.BP.BPWriteReadAsStreamTestADIOS2.ADIOS2BPWriteRead2D4x2.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;127;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadAsStreamTestADIOS2.ReaderWriterDefineVariable.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadAsStreamADIOS2.Serial" "--gtest_filter=BPWriteReadAsStreamTestADIOS2.ReaderWriterDefineVariable" "BP3")
+set_tests_properties(Engine.BP.BPWriteReadAsStreamTestADIOS2.ReaderWriterDefineVariable.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;127;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadAsStreamTestADIOS2.ADIOS2BPWriteRead1D8.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadAsStreamADIOS2.Serial" "--gtest_filter=BPWriteReadAsStreamTestADIOS2.ADIOS2BPWriteRead1D8" "BP4")
+set_tests_properties(Engine.BP.BPWriteReadAsStreamTestADIOS2.ADIOS2BPWriteRead1D8.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;127;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadAsStreamTestADIOS2.ADIOS2BPWriteRead2D2x4.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadAsStreamADIOS2.Serial" "--gtest_filter=BPWriteReadAsStreamTestADIOS2.ADIOS2BPWriteRead2D2x4" "BP4")
+set_tests_properties(Engine.BP.BPWriteReadAsStreamTestADIOS2.ADIOS2BPWriteRead2D2x4.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;127;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadAsStreamTestADIOS2.ADIOS2BPWriteRead2D4x2.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadAsStreamADIOS2.Serial" "--gtest_filter=BPWriteReadAsStreamTestADIOS2.ADIOS2BPWriteRead2D4x2" "BP4")
+set_tests_properties(Engine.BP.BPWriteReadAsStreamTestADIOS2.ADIOS2BPWriteRead2D4x2.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;127;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadAsStreamTestADIOS2.ReaderWriterDefineVariable.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadAsStreamADIOS2.Serial" "--gtest_filter=BPWriteReadAsStreamTestADIOS2.ReaderWriterDefineVariable" "BP4")
+set_tests_properties(Engine.BP.BPWriteReadAsStreamTestADIOS2.ReaderWriterDefineVariable.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;127;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadAsStreamTestADIOS2.ADIOS2BPWriteRead1D8.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadAsStreamADIOS2.Serial" "--gtest_filter=BPWriteReadAsStreamTestADIOS2.ADIOS2BPWriteRead1D8" "BP5")
+set_tests_properties(Engine.BP.BPWriteReadAsStreamTestADIOS2.ADIOS2BPWriteRead1D8.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;127;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadAsStreamTestADIOS2.ADIOS2BPWriteRead2D2x4.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadAsStreamADIOS2.Serial" "--gtest_filter=BPWriteReadAsStreamTestADIOS2.ADIOS2BPWriteRead2D2x4" "BP5")
+set_tests_properties(Engine.BP.BPWriteReadAsStreamTestADIOS2.ADIOS2BPWriteRead2D2x4.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;127;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadAsStreamTestADIOS2.ADIOS2BPWriteRead2D4x2.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadAsStreamADIOS2.Serial" "--gtest_filter=BPWriteReadAsStreamTestADIOS2.ADIOS2BPWriteRead2D4x2" "BP5")
+set_tests_properties(Engine.BP.BPWriteReadAsStreamTestADIOS2.ADIOS2BPWriteRead2D4x2.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;127;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadAsStreamTestADIOS2.ReaderWriterDefineVariable.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadAsStreamADIOS2.Serial" "--gtest_filter=BPWriteReadAsStreamTestADIOS2.ReaderWriterDefineVariable" "BP5")
+set_tests_properties(Engine.BP.BPWriteReadAsStreamTestADIOS2.ReaderWriterDefineVariable.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;127;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadAsStreamTestADIOS2.ADIOS2BPWriteRead1D8.BP5.ReadAhead.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadAsStreamADIOS2.Serial" "--gtest_filter=BPWriteReadAsStreamTestADIOS2.ADIOS2BPWriteRead1D8" "BP5" "ReadAhead=true")
+set_tests_properties(Engine.BP.BPWriteReadAsStreamTestADIOS2.ADIOS2BPWriteRead1D8.BP5.ReadAhead.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/ReadAhead" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;85;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;128;bp5_params_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadAsStreamTestADIOS2.ADIOS2BPWriteRead2D2x4.BP5.ReadAhead.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadAsStreamADIOS2.Serial" "--gtest_filter=BPWriteReadAsStreamTestADIOS2.ADIOS2BPWriteRead2D2x4" "BP5" "ReadAhead=true")
+set_tests_properties(Engine.BP.BPWriteReadAsStreamTestADIOS2.ADIOS2BPWriteRead2D2x4.BP5.ReadAhead.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/ReadAhead" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;85;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;128;bp5_params_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadAsStreamTestADIOS2.ADIOS2BPWriteRead2D4x2.BP5.ReadAhead.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadAsStreamADIOS2.Serial" "--gtest_filter=BPWriteReadAsStreamTestADIOS2.ADIOS2BPWriteRead2D4x2" "BP5" "ReadAhead=true")
+set_tests_properties(Engine.BP.BPWriteReadAsStreamTestADIOS2.ADIOS2BPWriteRead2D4x2.BP5.ReadAhead.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/ReadAhead" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;85;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;128;bp5_params_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadAsStreamTestADIOS2.ReaderWriterDefineVariable.BP5.ReadAhead.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadAsStreamADIOS2.Serial" "--gtest_filter=BPWriteReadAsStreamTestADIOS2.ReaderWriterDefineVariable" "BP5" "ReadAhead=true")
+set_tests_properties(Engine.BP.BPWriteReadAsStreamTestADIOS2.ReaderWriterDefineVariable.BP5.ReadAhead.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/ReadAhead" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;85;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;128;bp5_params_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadAsStreamTestADIOS2.ADIOS2BPWriteRead1D8.BP5.ReadAheadSmall.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadAsStreamADIOS2.Serial" "--gtest_filter=BPWriteReadAsStreamTestADIOS2.ADIOS2BPWriteRead1D8" "BP5" "ReadAhead=true,ReadAheadBufferSize=1Kb")
+set_tests_properties(Engine.BP.BPWriteReadAsStreamTestADIOS2.ADIOS2BPWriteRead1D8.BP5.ReadAheadSmall.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/ReadAheadSmall" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;85;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;129;bp5_params_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadAsStreamTestADIOS2.ADIOS2BPWriteRead2D2x4.BP5.ReadAheadSmall.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadAsStreamADIOS2.Serial" "--gtest_filter=BPWriteReadAsStreamTestADIOS2.ADIOS2BPWriteRead2D2x4" "BP5" "ReadAhead=true,ReadAheadBufferSize=1Kb")
+set_tests_properties(Engine.BP.BPWriteReadAsStreamTestADIOS2.ADIOS2BPWriteRead2D2x4.BP5.ReadAheadSmall.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/ReadAheadSmall" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;85;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;129;bp5_params_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadAsStreamTestADIOS2.ADIOS2BPWriteRead2D4x2.BP5.ReadAheadSmall.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadAsStreamADIOS2.Serial" "--gtest_filter=BPWriteReadAsStreamTestADIOS2.ADIOS2BPWriteRead2D4x2" "BP5" "ReadAhead=true,ReadAheadBufferSize=1Kb")
+set_tests_properties(Engine.BP.BPWriteReadAsStreamTestADIOS2.ADIOS2BPWriteRead2D4x2.BP5.ReadAheadSmall.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/ReadAheadSmall" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;85;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;129;bp5_params_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadAsStreamTestADIOS2.ReaderWriterDefineVariable.BP5.ReadAheadSmall.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadAsStreamADIOS2.Serial" "--gtest_filter=BPWriteReadAsStreamTestADIOS2.ReaderWriterDefineVariable" "BP5" "ReadAhead=true,ReadAheadBufferSize=1Kb")
+set_tests_properties(Engine.BP.BPWriteReadAsStreamTestADIOS2.ReaderWriterDefineVariable.BP5.ReadAheadSmall.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/ReadAheadSmall" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;85;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;129;bp5_params_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadAsStreamTestADIOS2.ADIOS2BPWriteRead1D8.BP5.NodeShared.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadAsStreamADIOS2.Serial" "--gtest_filter=BPWriteReadAsStreamTestADIOS2.ADIOS2BPWriteRead1D8" "BP5" "NodeSharedMetadata=true")
+set_tests_properties(Engine.BP.BPWriteReadAsStreamTestADIOS2.ADIOS2BPWriteRead1D8.BP5.NodeShared.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/NodeShared" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;85;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;131;bp5_params_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadAsStreamTestADIOS2.ADIOS2BPWriteRead2D2x4.BP5.NodeShared.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadAsStreamADIOS2.Serial" "--gtest_filter=BPWriteReadAsStreamTestADIOS2.ADIOS2BPWriteRead2D2x4" "BP5" "NodeSharedMetadata=true")
+set_tests_properties(Engine.BP.BPWriteReadAsStreamTestADIOS2.ADIOS2BPWriteRead2D2x4.BP5.NodeShared.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/NodeShared" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;85;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;131;bp5_params_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadAsStreamTestADIOS2.ADIOS2BPWriteRead2D4x2.BP5.NodeShared.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadAsStreamADIOS2.Serial" "--gtest_filter=BPWriteReadAsStreamTestADIOS2.ADIOS2BPWriteRead2D4x2" "BP5" "NodeSharedMetadata=true")
+set_tests_properties(Engine.BP.BPWriteReadAsStreamTestADIOS2.ADIOS2BPWriteRead2D4x2.BP5.NodeShared.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/NodeShared" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;85;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;131;bp5_params_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadAsStreamTestADIOS2.ReaderWriterDefineVariable.BP5.NodeShared.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadAsStreamADIOS2.Serial" "--gtest_filter=BPWriteReadAsStreamTestADIOS2.ReaderWriterDefineVariable" "BP5" "NodeSharedMetadata=true")
+set_tests_properties(Engine.BP.BPWriteReadAsStreamTestADIOS2.ReaderWriterDefineVariable.BP5.NodeShared.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/NodeShared" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;85;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;131;bp5_params_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadAsStreamTestADIOS2.ADIOS2BPWriteRead1D8.BP5.ParallelMetadata.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadAsStreamADIOS2.Serial" "--gtest_filter=BPWriteReadAsStreamTestADIOS2.ADIOS2BPWriteRead1D8" "BP5" "Threads=4")
+set_tests_properties(Engine.BP.BPWriteReadAsStreamTestADIOS2.ADIOS2BPWriteRead1D8.BP5.ParallelMetadata.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/ParallelMetadata" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;85;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;132;bp5_params_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadAsStreamTestADIOS2.ADIOS2BPWriteRead2D2x4.BP5.ParallelMetadata.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadAsStreamADIOS2.Serial" "--gtest_filter=BPWriteReadAsStreamTestADIOS2.ADIOS2BPWriteRead2D2x4" "BP5" "Threads=4")
+set_tests_properties(Engine.BP.BPWriteReadAsStreamTestADIOS2.ADIOS2BPWriteRead2D2x4.BP5.ParallelMetadata.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/ParallelMetadata" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;85;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;132;bp5_params_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadAsStreamTestADIOS2.ADIOS2BPWriteRead2D4x2.BP5.ParallelMetadata.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadAsStreamADIOS2.Serial" "--gtest_filter=BPWriteReadAsStreamTestADIOS2.ADIOS2BPWriteRead2D4x2" "BP5" "Threads=4")
+set_tests_properties(Engine.BP.BPWriteReadAsStreamTestADIOS2.ADIOS2BPWriteRead2D4x2.BP5.ParallelMetadata.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/ParallelMetadata" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;85;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;132;bp5_params_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadAsStreamTestADIOS2.ReaderWriterDefineVariable.BP5.ParallelMetadata.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadAsStreamADIOS2.Serial" "--gtest_filter=BPWriteReadAsStreamTestADIOS2.ReaderWriterDefineVariable" "BP5" "Threads=4")
+set_tests_properties(Engine.BP.BPWriteReadAsStreamTestADIOS2.ReaderWriterDefineVariable.BP5.ParallelMetadata.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5/ParallelMetadata" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;85;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;132;bp5_params_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadAsStreamTestADIOS2_Threads.ADIOS2BPWriteRead1D8.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadAsStreamADIOS2_Threads.Serial" "--gtest_filter=BPWriteReadAsStreamTestADIOS2_Threads.ADIOS2BPWriteRead1D8" "BP3")
+set_tests_properties(Engine.BP.BPWriteReadAsStreamTestADIOS2_Threads.ADIOS2BPWriteRead1D8.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;133;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadAsStreamTestADIOS2_Threads.ADIOS2BPWriteRead2D2x4.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadAsStreamADIOS2_Threads.Serial" "--gtest_filter=BPWriteReadAsStreamTestADIOS2_Threads.ADIOS2BPWriteRead2D2x4" "BP3")
+set_tests_properties(Engine.BP.BPWriteReadAsStreamTestADIOS2_Threads.ADIOS2BPWriteRead2D2x4.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;133;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadAsStreamTestADIOS2_Threads.ADIOS2BPWriteRead2D4x2.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadAsStreamADIOS2_Threads.Serial" "--gtest_filter=BPWriteReadAsStreamTestADIOS2_Threads.ADIOS2BPWriteRead2D4x2" "BP3")
+set_tests_properties(Engine.BP.BPWriteReadAsStreamTestADIOS2_Threads.ADIOS2BPWriteRead2D4x2.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;133;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadAsStreamTestADIOS2_Threads.ADIOS2BPWriteRead1D8MissingPerformGets.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadAsStreamADIOS2_Threads.Serial" "--gtest_filter=BPWriteReadAsStreamTestADIOS2_Threads.ADIOS2BPWriteRead1D8MissingPerformGets" "BP3")
+set_tests_properties(Engine.BP.BPWriteReadAsStreamTestADIOS2_Threads.ADIOS2BPWriteRead1D8MissingPerformGets.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;133;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadAsStreamTestADIOS2_Threads.ADIOS2BPWriteRead2D2x4MissingPerformGets.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadAsStreamADIOS2_Threads.Serial" "--gtest_filter=BPWriteReadAsStreamTestADIOS2_Threads.ADIOS2BPWriteRead2D2x4MissingPerformGets" "BP3")
+set_tests_properties(Engine.BP.BPWriteReadAsStreamTestADIOS2_Threads.ADIOS2BPWriteRead2D2x4MissingPerformGets.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;133;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadAsStreamTestADIOS2_Threads.ADIOS2BPWriteRead2D4x2MissingPerformGets.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadAsStreamADIOS2_Threads.Serial" "--gtest_filter=BPWriteReadAsStreamTestADIOS2_Threads.ADIOS2BPWriteRead2D4x2MissingPerformGets" "BP3")
+set_tests_properties(Engine.BP.BPWriteReadAsStreamTestADIOS2_Threads.ADIOS2BPWriteRead2D4x2MissingPerformGets.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;133;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadAsStreamTestADIOS2_Threads.ADIOS2BPWriteRead1D8.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadAsStreamADIOS2_Threads.Serial" "--gtest_filter=BPWriteReadAsStreamTestADIOS2_Threads.ADIOS2BPWriteRead1D8" "BP4")
+set_tests_properties(Engine.BP.BPWriteReadAsStreamTestADIOS2_Threads.ADIOS2BPWriteRead1D8.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;133;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadAsStreamTestADIOS2_Threads.ADIOS2BPWriteRead2D2x4.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadAsStreamADIOS2_Threads.Serial" "--gtest_filter=BPWriteReadAsStreamTestADIOS2_Threads.ADIOS2BPWriteRead2D2x4" "BP4")
+set_tests_properties(Engine.BP.BPWriteReadAsStreamTestADIOS2_Threads.ADIOS2BPWriteRead2D2x4.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;133;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadAsStreamTestADIOS2_Threads.ADIOS2BPWriteRead2D4x2.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadAsStreamADIOS2_Threads.Serial" "--gtest_filter=BPWriteReadAsStreamTestADIOS2_Threads.ADIOS2BPWriteRead2D4x2" "BP4")
+set_tests_properties(Engine.BP.BPWriteReadAsStreamTestADIOS2_Threads.ADIOS2BPWriteRead2D4x2.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;133;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadAsStreamTestADIOS2_Threads.ADIOS2BPWriteRead1D8MissingPerformGets.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadAsStreamADIOS2_Threads.Serial" "--gtest_filter=BPWriteReadAsStreamTestADIOS2_Threads.ADIOS2BPWriteRead1D8MissingPerformGets" "BP4")
+set_tests_properties(Engine.BP.BPWriteReadAsStreamTestADIOS2_Threads.ADIOS2BPWriteRead1D8MissingPerformGets.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;133;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadAsStreamTestADIOS2_Threads.ADIOS2BPWriteRead2D2x4MissingPerformGets.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadAsStreamADIOS2_Threads.Serial" "--gtest_filter=BPWriteReadAsStreamTestADIOS2_Threads.ADIOS2BPWriteRead2D2x4MissingPerformGets" "BP4")
+set_tests_properties(Engine.BP.BPWriteReadAsStreamTestADIOS2_Threads.ADIOS2BPWriteRead2D2x4MissingPerformGets.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;133;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadAsStreamTestADIOS2_Threads.ADIOS2BPWriteRead2D4x2MissingPerformGets.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadAsStreamADIOS2_Threads.Serial" "--gtest_filter=BPWriteReadAsStreamTestADIOS2_Threads.ADIOS2BPWriteRead2D4x2MissingPerformGets" "BP4")
+set_tests_properties(Engine.BP.BPWriteReadAsStreamTestADIOS2_Threads.ADIOS2BPWriteRead2D4x2MissingPerformGets.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;133;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadAsStreamTestADIOS2_Threads.ADIOS2BPWriteRead1D8.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadAsStreamADIOS2_Threads.Serial" "--gtest_filter=BPWriteReadAsStreamTestADIOS2_Threads.ADIOS2BPWriteRead1D8" "BP5")
+set_tests_properties(Engine.BP.BPWriteReadAsStreamTestADIOS2_Threads.ADIOS2BPWriteRead1D8.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;133;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadAsStreamTestADIOS2_Threads.ADIOS2BPWriteRead2D2x4.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadAsStreamADIOS2_Threads.Serial" "--gtest_filter=BPWriteReadAsStreamTestADIOS2_Threads.ADIOS2BPWriteRead2D2x4" "BP5")
+set_tests_properties(Engine.BP.BPWriteReadAsStreamTestADIOS2_Threads.ADIOS2BPWriteRead2D2x4.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;133;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadAsStreamTestADIOS2_Threads.ADIOS2BPWriteRead2D4x2.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadAsStreamADIOS2_Threads.Serial" "--gtest_filter=BPWriteReadAsStreamTestADIOS2_Threads.ADIOS2BPWriteRead2D4x2" "BP5")
+set_tests_properties(Engine.BP.BPWriteReadAsStreamTestADIOS2_Threads.ADIOS2BPWriteRead2D4x2.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;133;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadAsStreamTestADIOS2_Threads.ADIOS2BPWriteRead1D8MissingPerformGets.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadAsStreamADIOS2_Threads.Serial" "--gtest_filter=BPWriteReadAsStreamTestADIOS2_Threads.ADIOS2BPWriteRead1D8MissingPerformGets" "BP5")
+set_tests_properties(Engine.BP.BPWriteReadAsStreamTestADIOS2_Threads.ADIOS2BPWriteRead1D8MissingPerformGets.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;133;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadAsStreamTestADIOS2_Threads.ADIOS2BPWriteRead2D2x4MissingPerformGets.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadAsStreamADIOS2_Threads.Serial" "--gtest_filter=BPWriteReadAsStreamTestADIOS2_Threads.ADIOS2BPWriteRead2D2x4MissingPerformGets" "BP5")
+set_tests_properties(Engine.BP.BPWriteReadAsStreamTestADIOS2_Threads.ADIOS2BPWriteRead2D2x4MissingPerformGets.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;133;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadAsStreamTestADIOS2_Threads.ADIOS2BPWriteRead2D4x2MissingPerformGets.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadAsStreamADIOS2_Threads.Serial" "--gtest_filter=BPWriteReadAsStreamTestADIOS2_Threads.ADIOS2BPWriteRead2D4x2MissingPerformGets" "BP5")
+set_tests_properties(Engine.BP.BPWriteReadAsStreamTestADIOS2_Threads.ADIOS2BPWriteRead2D4x2MissingPerformGets.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;133;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadAttributes.WriteReadSingleTypes.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadAttributes.Serial" "--gtest_filter=BPWriteReadAttributes.WriteReadSingleTypes" "BP3")
+set_tests_properties(Engine.BP.BPWriteReadAttributes.WriteReadSingleTypes.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;134;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadAttributes.WriteReadArrayTypes.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadAttributes.Serial" "--gtest_filter=BPWriteReadAttributes.WriteReadArrayTypes" "BP3")
+set_tests_properties(Engine.BP.BPWriteReadAttributes.WriteReadArrayTypes.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;134;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadAttributes.BPWriteReadSingleTypesVar.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadAttributes.Serial" "--gtest_filter=BPWriteReadAttributes.BPWriteReadSingleTypesVar" "BP3")
+set_tests_properties(Engine.BP.BPWriteReadAttributes.BPWriteReadSingleTypesVar.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;134;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadAttributes.WriteReadArrayTypesVar.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadAttributes.Serial" "--gtest_filter=BPWriteReadAttributes.WriteReadArrayTypesVar" "BP3")
+set_tests_properties(Engine.BP.BPWriteReadAttributes.WriteReadArrayTypesVar.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;134;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadAttributes.WriteReadStreamVarp.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadAttributes.Serial" "--gtest_filter=BPWriteReadAttributes.WriteReadStreamVarp" "BP3")
+set_tests_properties(Engine.BP.BPWriteReadAttributes.WriteReadStreamVarp.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;134;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadAttributes.WriteReadStreamModifiable.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadAttributes.Serial" "--gtest_filter=BPWriteReadAttributes.WriteReadStreamModifiable" "BP3")
+set_tests_properties(Engine.BP.BPWriteReadAttributes.WriteReadStreamModifiable.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;134;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadAttributes.WriteReadSingleTypes.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadAttributes.Serial" "--gtest_filter=BPWriteReadAttributes.WriteReadSingleTypes" "BP4")
+set_tests_properties(Engine.BP.BPWriteReadAttributes.WriteReadSingleTypes.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;134;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadAttributes.WriteReadArrayTypes.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadAttributes.Serial" "--gtest_filter=BPWriteReadAttributes.WriteReadArrayTypes" "BP4")
+set_tests_properties(Engine.BP.BPWriteReadAttributes.WriteReadArrayTypes.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;134;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadAttributes.BPWriteReadSingleTypesVar.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadAttributes.Serial" "--gtest_filter=BPWriteReadAttributes.BPWriteReadSingleTypesVar" "BP4")
+set_tests_properties(Engine.BP.BPWriteReadAttributes.BPWriteReadSingleTypesVar.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;134;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadAttributes.WriteReadArrayTypesVar.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadAttributes.Serial" "--gtest_filter=BPWriteReadAttributes.WriteReadArrayTypesVar" "BP4")
+set_tests_properties(Engine.BP.BPWriteReadAttributes.WriteReadArrayTypesVar.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;134;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadAttributes.WriteReadStreamVarp.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadAttributes.Serial" "--gtest_filter=BPWriteReadAttributes.WriteReadStreamVarp" "BP4")
+set_tests_properties(Engine.BP.BPWriteReadAttributes.WriteReadStreamVarp.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;134;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadAttributes.WriteReadStreamModifiable.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadAttributes.Serial" "--gtest_filter=BPWriteReadAttributes.WriteReadStreamModifiable" "BP4")
+set_tests_properties(Engine.BP.BPWriteReadAttributes.WriteReadStreamModifiable.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;134;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadAttributes.WriteReadSingleTypes.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadAttributes.Serial" "--gtest_filter=BPWriteReadAttributes.WriteReadSingleTypes" "BP5")
+set_tests_properties(Engine.BP.BPWriteReadAttributes.WriteReadSingleTypes.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;134;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadAttributes.WriteReadArrayTypes.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadAttributes.Serial" "--gtest_filter=BPWriteReadAttributes.WriteReadArrayTypes" "BP5")
+set_tests_properties(Engine.BP.BPWriteReadAttributes.WriteReadArrayTypes.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;134;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadAttributes.BPWriteReadSingleTypesVar.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadAttributes.Serial" "--gtest_filter=BPWriteReadAttributes.BPWriteReadSingleTypesVar" "BP5")
+set_tests_properties(Engine.BP.BPWriteReadAttributes.BPWriteReadSingleTypesVar.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;134;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadAttributes.WriteReadArrayTypesVar.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadAttributes.Serial" "--gtest_filter=BPWriteReadAttributes.WriteReadArrayTypesVar" "BP5")
+set_tests_properties(Engine.BP.BPWriteReadAttributes.WriteReadArrayTypesVar.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;134;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadAttributes.WriteReadStreamVarp.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadAttributes.Serial" "--gtest_filter=BPWriteReadAttributes.WriteReadStreamVarp" "BP5")
+set_tests_properties(Engine.BP.BPWriteReadAttributes.WriteReadStreamVarp.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;134;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadAttributes.WriteReadStreamModifiable.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadAttributes.Serial" "--gtest_filter=BPWriteReadAttributes.WriteReadStreamModifiable" "BP5")
+set_tests_properties(Engine.BP.BPWriteReadAttributes.WriteReadStreamModifiable.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;134;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.StreamWriteReadHighLevelAPI.ADIOS2BPWriteRead1D8.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.FStreamWriteReadHighLevelAPI.Serial" "--gtest_filter=StreamWriteReadHighLevelAPI.ADIOS2BPWriteRead1D8" "BP3")
+set_tests_properties(Engine.BP.StreamWriteReadHighLevelAPI.ADIOS2BPWriteRead1D8.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;135;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.StreamWriteReadHighLevelAPI.ADIOS2BPwriteRead2D2x4.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.FStreamWriteReadHighLevelAPI.Serial" "--gtest_filter=StreamWriteReadHighLevelAPI.ADIOS2BPwriteRead2D2x4" "BP3")
+set_tests_properties(Engine.BP.StreamWriteReadHighLevelAPI.ADIOS2BPwriteRead2D2x4.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;135;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.StreamWriteReadHighLevelAPI.ADIOS2BPwriteRead2D4x2.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.FStreamWriteReadHighLevelAPI.Serial" "--gtest_filter=StreamWriteReadHighLevelAPI.ADIOS2BPwriteRead2D4x2" "BP3")
+set_tests_properties(Engine.BP.StreamWriteReadHighLevelAPI.ADIOS2BPwriteRead2D4x2.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;135;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.StreamWriteReadHighLevelAPI.DoubleOpenException.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.FStreamWriteReadHighLevelAPI.Serial" "--gtest_filter=StreamWriteReadHighLevelAPI.DoubleOpenException" "BP3")
+set_tests_properties(Engine.BP.StreamWriteReadHighLevelAPI.DoubleOpenException.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;135;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.StreamWriteReadHighLevelAPI.ADIOS2BPWriteRead1D8.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.FStreamWriteReadHighLevelAPI.Serial" "--gtest_filter=StreamWriteReadHighLevelAPI.ADIOS2BPWriteRead1D8" "BP4")
+set_tests_properties(Engine.BP.StreamWriteReadHighLevelAPI.ADIOS2BPWriteRead1D8.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;135;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.StreamWriteReadHighLevelAPI.ADIOS2BPwriteRead2D2x4.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.FStreamWriteReadHighLevelAPI.Serial" "--gtest_filter=StreamWriteReadHighLevelAPI.ADIOS2BPwriteRead2D2x4" "BP4")
+set_tests_properties(Engine.BP.StreamWriteReadHighLevelAPI.ADIOS2BPwriteRead2D2x4.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;135;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.StreamWriteReadHighLevelAPI.ADIOS2BPwriteRead2D4x2.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.FStreamWriteReadHighLevelAPI.Serial" "--gtest_filter=StreamWriteReadHighLevelAPI.ADIOS2BPwriteRead2D4x2" "BP4")
+set_tests_properties(Engine.BP.StreamWriteReadHighLevelAPI.ADIOS2BPwriteRead2D4x2.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;135;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.StreamWriteReadHighLevelAPI.DoubleOpenException.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.FStreamWriteReadHighLevelAPI.Serial" "--gtest_filter=StreamWriteReadHighLevelAPI.DoubleOpenException" "BP4")
+set_tests_properties(Engine.BP.StreamWriteReadHighLevelAPI.DoubleOpenException.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;135;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.StreamWriteReadHighLevelAPI.ADIOS2BPWriteRead1D8.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.FStreamWriteReadHighLevelAPI.Serial" "--gtest_filter=StreamWriteReadHighLevelAPI.ADIOS2BPWriteRead1D8" "BP5")
+set_tests_properties(Engine.BP.StreamWriteReadHighLevelAPI.ADIOS2BPWriteRead1D8.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;135;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.StreamWriteReadHighLevelAPI.ADIOS2BPwriteRead2D2x4.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.FStreamWriteReadHighLevelAPI.Serial" "--gtest_filter=StreamWriteReadHighLevelAPI.ADIOS2BPwriteRead2D2x4" "BP5")
+set_tests_properties(Engine.BP.StreamWriteReadHighLevelAPI.ADIOS2BPwriteRead2D2x4.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;135;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.StreamWriteReadHighLevelAPI.ADIOS2BPwriteRead2D4x2.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.FStreamWriteReadHighLevelAPI.Serial" "--gtest_filter=StreamWriteReadHighLevelAPI.ADIOS2BPwriteRead2D4x2" "BP5")
+set_tests_properties(Engine.BP.StreamWriteReadHighLevelAPI.ADIOS2BPwriteRead2D4x2.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;135;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.StreamWriteReadHighLevelAPI.DoubleOpenException.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.FStreamWriteReadHighLevelAPI.Serial" "--gtest_filter=StreamWriteReadHighLevelAPI.DoubleOpenException" "BP5")
+set_tests_properties(Engine.BP.StreamWriteReadHighLevelAPI.DoubleOpenException.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;135;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteFlushRead.ADIOS2BPWrite1D2D.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteFlushRead.Serial" "--gtest_filter=BPWriteFlushRead.ADIOS2BPWrite1D2D" "BP3")
+set_tests_properties(Engine.BP.BPWriteFlushRead.ADIOS2BPWrite1D2D.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;136;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteFlushRead.ADIOS2BPWrite1D2Dstdio.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteFlushRead.Serial" "--gtest_filter=BPWriteFlushRead.ADIOS2BPWrite1D2Dstdio" "BP3")
+set_tests_properties(Engine.BP.BPWriteFlushRead.ADIOS2BPWrite1D2Dstdio.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;136;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteFlushRead.ADIOS2BPWrite1D2Dfstream.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteFlushRead.Serial" "--gtest_filter=BPWriteFlushRead.ADIOS2BPWrite1D2Dfstream" "BP3")
+set_tests_properties(Engine.BP.BPWriteFlushRead.ADIOS2BPWrite1D2Dfstream.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;136;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteFlushRead.ADIOS2BPWrite1D2D.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteFlushRead.Serial" "--gtest_filter=BPWriteFlushRead.ADIOS2BPWrite1D2D" "BP4")
+set_tests_properties(Engine.BP.BPWriteFlushRead.ADIOS2BPWrite1D2D.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;136;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteFlushRead.ADIOS2BPWrite1D2Dstdio.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteFlushRead.Serial" "--gtest_filter=BPWriteFlushRead.ADIOS2BPWrite1D2Dstdio" "BP4")
+set_tests_properties(Engine.BP.BPWriteFlushRead.ADIOS2BPWrite1D2Dstdio.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;136;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteFlushRead.ADIOS2BPWrite1D2Dfstream.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteFlushRead.Serial" "--gtest_filter=BPWriteFlushRead.ADIOS2BPWrite1D2Dfstream" "BP4")
+set_tests_properties(Engine.BP.BPWriteFlushRead.ADIOS2BPWrite1D2Dfstream.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;136;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteFlushRead.ADIOS2BPWrite1D2D.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteFlushRead.Serial" "--gtest_filter=BPWriteFlushRead.ADIOS2BPWrite1D2D" "BP5")
+set_tests_properties(Engine.BP.BPWriteFlushRead.ADIOS2BPWrite1D2D.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;136;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteFlushRead.ADIOS2BPWrite1D2Dstdio.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteFlushRead.Serial" "--gtest_filter=BPWriteFlushRead.ADIOS2BPWrite1D2Dstdio" "BP5")
+set_tests_properties(Engine.BP.BPWriteFlushRead.ADIOS2BPWrite1D2Dstdio.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;136;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteFlushRead.ADIOS2BPWrite1D2Dfstream.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteFlushRead.Serial" "--gtest_filter=BPWriteFlushRead.ADIOS2BPWrite1D2Dfstream" "BP5")
+set_tests_properties(Engine.BP.BPWriteFlushRead.ADIOS2BPWrite1D2Dfstream.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;136;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteMultiblockReadTest.ADIOS2BPWriteMultiblockRead1D8.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteMultiblockRead.Serial" "--gtest_filter=BPWriteMultiblockReadTest.ADIOS2BPWriteMultiblockRead1D8" "BP3")
+set_tests_properties(Engine.BP.BPWriteMultiblockReadTest.ADIOS2BPWriteMultiblockRead1D8.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;137;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteMultiblockReadTest.ADIOS2BPWriteMultiblockRead2D2x4.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteMultiblockRead.Serial" "--gtest_filter=BPWriteMultiblockReadTest.ADIOS2BPWriteMultiblockRead2D2x4" "BP3")
+set_tests_properties(Engine.BP.BPWriteMultiblockReadTest.ADIOS2BPWriteMultiblockRead2D2x4.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;137;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteMultiblockReadTest.ADIOS2BPWriteMultiblockRead2D4x2.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteMultiblockRead.Serial" "--gtest_filter=BPWriteMultiblockReadTest.ADIOS2BPWriteMultiblockRead2D4x2" "BP3")
+set_tests_properties(Engine.BP.BPWriteMultiblockReadTest.ADIOS2BPWriteMultiblockRead2D4x2.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;137;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteMultiblockReadTest.ADIOS2BPWriteRead1D8ZeroBlock.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteMultiblockRead.Serial" "--gtest_filter=BPWriteMultiblockReadTest.ADIOS2BPWriteRead1D8ZeroBlock" "BP3")
+set_tests_properties(Engine.BP.BPWriteMultiblockReadTest.ADIOS2BPWriteRead1D8ZeroBlock.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;137;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteMultiblockReadTest.ADIOS2BPWriteMultiblockRead1D8.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteMultiblockRead.Serial" "--gtest_filter=BPWriteMultiblockReadTest.ADIOS2BPWriteMultiblockRead1D8" "BP4")
+set_tests_properties(Engine.BP.BPWriteMultiblockReadTest.ADIOS2BPWriteMultiblockRead1D8.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;137;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteMultiblockReadTest.ADIOS2BPWriteMultiblockRead2D2x4.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteMultiblockRead.Serial" "--gtest_filter=BPWriteMultiblockReadTest.ADIOS2BPWriteMultiblockRead2D2x4" "BP4")
+set_tests_properties(Engine.BP.BPWriteMultiblockReadTest.ADIOS2BPWriteMultiblockRead2D2x4.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;137;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteMultiblockReadTest.ADIOS2BPWriteMultiblockRead2D4x2.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteMultiblockRead.Serial" "--gtest_filter=BPWriteMultiblockReadTest.ADIOS2BPWriteMultiblockRead2D4x2" "BP4")
+set_tests_properties(Engine.BP.BPWriteMultiblockReadTest.ADIOS2BPWriteMultiblockRead2D4x2.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;137;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteMultiblockReadTest.ADIOS2BPWriteRead1D8ZeroBlock.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteMultiblockRead.Serial" "--gtest_filter=BPWriteMultiblockReadTest.ADIOS2BPWriteRead1D8ZeroBlock" "BP4")
+set_tests_properties(Engine.BP.BPWriteMultiblockReadTest.ADIOS2BPWriteRead1D8ZeroBlock.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;137;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteMultiblockReadTest.ADIOS2BPWriteMultiblockRead1D8.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteMultiblockRead.Serial" "--gtest_filter=BPWriteMultiblockReadTest.ADIOS2BPWriteMultiblockRead1D8" "BP5")
+set_tests_properties(Engine.BP.BPWriteMultiblockReadTest.ADIOS2BPWriteMultiblockRead1D8.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;137;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteMultiblockReadTest.ADIOS2BPWriteMultiblockRead2D2x4.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteMultiblockRead.Serial" "--gtest_filter=BPWriteMultiblockReadTest.ADIOS2BPWriteMultiblockRead2D2x4" "BP5")
+set_tests_properties(Engine.BP.BPWriteMultiblockReadTest.ADIOS2BPWriteMultiblockRead2D2x4.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;137;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteMultiblockReadTest.ADIOS2BPWriteMultiblockRead2D4x2.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteMultiblockRead.Serial" "--gtest_filter=BPWriteMultiblockReadTest.ADIOS2BPWriteMultiblockRead2D4x2" "BP5")
+set_tests_properties(Engine.BP.BPWriteMultiblockReadTest.ADIOS2BPWriteMultiblockRead2D4x2.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;137;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteMultiblockReadTest.ADIOS2BPWriteRead1D8ZeroBlock.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteMultiblockRead.Serial" "--gtest_filter=BPWriteMultiblockReadTest.ADIOS2BPWriteRead1D8ZeroBlock" "BP5")
+set_tests_properties(Engine.BP.BPWriteMultiblockReadTest.ADIOS2BPWriteRead1D8ZeroBlock.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;137;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadMultiblockTest.ADIOS2BPWriteReadMultiblock1D8.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadMultiblock.Serial" "--gtest_filter=BPWriteReadMultiblockTest.ADIOS2BPWriteReadMultiblock1D8" "BP3")
+set_tests_properties(Engine.BP.BPWriteReadMultiblockTest.ADIOS2BPWriteReadMultiblock1D8.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;138;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadMultiblockTest.ADIOS2BPWriteReadMultiblock2D2x4.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadMultiblock.Serial" "--gtest_filter=BPWriteReadMultiblockTest.ADIOS2BPWriteReadMultiblock2D2x4" "BP3")
+set_tests_properties(Engine.BP.BPWriteReadMultiblockTest.ADIOS2BPWriteReadMultiblock2D2x4.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;138;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadMultiblockTest.ADIOS2BPWriteReadMultiblock2D4x2.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadMultiblock.Serial" "--gtest_filter=BPWriteReadMultiblockTest.ADIOS2BPWriteReadMultiblock2D4x2" "BP3")
+set_tests_properties(Engine.BP.BPWriteReadMultiblockTest.ADIOS2BPWriteReadMultiblock2D4x2.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;138;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadMultiblockTest.MultiblockPerformDataWrite.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadMultiblock.Serial" "--gtest_filter=BPWriteReadMultiblockTest.MultiblockPerformDataWrite" "BP3")
+set_tests_properties(Engine.BP.BPWriteReadMultiblockTest.MultiblockPerformDataWrite.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;138;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadMultiblockTest.MultiblockNullBlocks.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadMultiblock.Serial" "--gtest_filter=BPWriteReadMultiblockTest.MultiblockNullBlocks" "BP3")
+set_tests_properties(Engine.BP.BPWriteReadMultiblockTest.MultiblockNullBlocks.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;138;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadMultiblockTest.ADIOS2BPWriteReadMultiblock1D8.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadMultiblock.Serial" "--gtest_filter=BPWriteReadMultiblockTest.ADIOS2BPWriteReadMultiblock1D8" "BP4")
+set_tests_properties(Engine.BP.BPWriteReadMultiblockTest.ADIOS2BPWriteReadMultiblock1D8.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;138;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadMultiblockTest.ADIOS2BPWriteReadMultiblock2D2x4.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadMultiblock.Serial" "--gtest_filter=BPWriteReadMultiblockTest.ADIOS2BPWriteReadMultiblock2D2x4" "BP4")
+set_tests_properties(Engine.BP.BPWriteReadMultiblockTest.ADIOS2BPWriteReadMultiblock2D2x4.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;138;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadMultiblockTest.ADIOS2BPWriteReadMultiblock2D4x2.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadMultiblock.Serial" "--gtest_filter=BPWriteReadMultiblockTest.ADIOS2BPWriteReadMultiblock2D4x2" "BP4")
+set_tests_properties(Engine.BP.BPWriteReadMultiblockTest.ADIOS2BPWriteReadMultiblock2D4x2.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;138;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadMultiblockTest.MultiblockPerformDataWrite.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadMultiblock.Serial" "--gtest_filter=BPWriteReadMultiblockTest.MultiblockPerformDataWrite" "BP4")
+set_tests_properties(Engine.BP.BPWriteReadMultiblockTest.MultiblockPerformDataWrite.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;138;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadMultiblockTest.MultiblockNullBlocks.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadMultiblock.Serial" "--gtest_filter=BPWriteReadMultiblockTest.MultiblockNullBlocks" "BP4")
+set_tests_properties(Engine.BP.BPWriteReadMultiblockTest.MultiblockNullBlocks.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;138;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadMultiblockTest.ADIOS2BPWriteReadMultiblock1D8.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadMultiblock.Serial" "--gtest_filter=BPWriteReadMultiblockTest.ADIOS2BPWriteReadMultiblock1D8" "BP5")
+set_tests_properties(Engine.BP.BPWriteReadMultiblockTest.ADIOS2BPWriteReadMultiblock1D8.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;138;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadMultiblockTest.ADIOS2BPWriteReadMultiblock2D2x4.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadMultiblock.Serial" "--gtest_filter=BPWriteReadMultiblockTest.ADIOS2BPWriteReadMultiblock2D2x4" "BP5")
+set_tests_properties(Engine.BP.BPWriteReadMultiblockTest.ADIOS2BPWriteReadMultiblock2D2x4.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;138;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadMultiblockTest.ADIOS2BPWriteReadMultiblock2D4x2.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadMultiblock.Serial" "--gtest_filter=BPWriteReadMultiblockTest.ADIOS2BPWriteReadMultiblock2D4x2" "BP5")
+set_tests_properties(Engine.BP.BPWriteReadMultiblockTest.ADIOS2BPWriteReadMultiblock2D4x2.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;138;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadMultiblockTest.MultiblockPerformDataWrite.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadMultiblock.Serial" "--gtest_filter=BPWriteReadMultiblockTest.MultiblockPerformDataWrite" "BP5")
+set_tests_properties(Engine.BP.BPWriteReadMultiblockTest.MultiblockPerformDataWrite.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;138;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadMultiblockTest.MultiblockNullBlocks.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadMultiblock.Serial" "--gtest_filter=BPWriteReadMultiblockTest.MultiblockNullBlocks" "BP5")
+set_tests_properties(Engine.BP.BPWriteReadMultiblockTest.MultiblockNullBlocks.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;138;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadVector.ADIOS2BPWriteRead1D8.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadVector.Serial" "--gtest_filter=BPWriteReadVector.ADIOS2BPWriteRead1D8" "BP3")
+set_tests_properties(Engine.BP.BPWriteReadVector.ADIOS2BPWriteRead1D8.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;139;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadVector.ADIOS2BPWriteRead2D2x4.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadVector.Serial" "--gtest_filter=BPWriteReadVector.ADIOS2BPWriteRead2D2x4" "BP3")
+set_tests_properties(Engine.BP.BPWriteReadVector.ADIOS2BPWriteRead2D2x4.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;139;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadVector.ADIOS2BPWriteRead2D4x2.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadVector.Serial" "--gtest_filter=BPWriteReadVector.ADIOS2BPWriteRead2D4x2" "BP3")
+set_tests_properties(Engine.BP.BPWriteReadVector.ADIOS2BPWriteRead2D4x2.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;139;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadVector.ADIOS2BPWriteReadVector2D4x2_MultiSteps.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadVector.Serial" "--gtest_filter=BPWriteReadVector.ADIOS2BPWriteReadVector2D4x2_MultiSteps" "BP3")
+set_tests_properties(Engine.BP.BPWriteReadVector.ADIOS2BPWriteReadVector2D4x2_MultiSteps.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;139;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadVector.ADIOS2BPWriteRead1D8.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadVector.Serial" "--gtest_filter=BPWriteReadVector.ADIOS2BPWriteRead1D8" "BP4")
+set_tests_properties(Engine.BP.BPWriteReadVector.ADIOS2BPWriteRead1D8.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;139;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadVector.ADIOS2BPWriteRead2D2x4.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadVector.Serial" "--gtest_filter=BPWriteReadVector.ADIOS2BPWriteRead2D2x4" "BP4")
+set_tests_properties(Engine.BP.BPWriteReadVector.ADIOS2BPWriteRead2D2x4.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;139;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadVector.ADIOS2BPWriteRead2D4x2.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadVector.Serial" "--gtest_filter=BPWriteReadVector.ADIOS2BPWriteRead2D4x2" "BP4")
+set_tests_properties(Engine.BP.BPWriteReadVector.ADIOS2BPWriteRead2D4x2.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;139;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadVector.ADIOS2BPWriteReadVector2D4x2_MultiSteps.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadVector.Serial" "--gtest_filter=BPWriteReadVector.ADIOS2BPWriteReadVector2D4x2_MultiSteps" "BP4")
+set_tests_properties(Engine.BP.BPWriteReadVector.ADIOS2BPWriteReadVector2D4x2_MultiSteps.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;139;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadVector.ADIOS2BPWriteRead1D8.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadVector.Serial" "--gtest_filter=BPWriteReadVector.ADIOS2BPWriteRead1D8" "BP5")
+set_tests_properties(Engine.BP.BPWriteReadVector.ADIOS2BPWriteRead1D8.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;139;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadVector.ADIOS2BPWriteRead2D2x4.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadVector.Serial" "--gtest_filter=BPWriteReadVector.ADIOS2BPWriteRead2D2x4" "BP5")
+set_tests_properties(Engine.BP.BPWriteReadVector.ADIOS2BPWriteRead2D2x4.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;139;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadVector.ADIOS2BPWriteRead2D4x2.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadVector.Serial" "--gtest_filter=BPWriteReadVector.ADIOS2BPWriteRead2D4x2" "BP5")
+set_tests_properties(Engine.BP.BPWriteReadVector.ADIOS2BPWriteRead2D4x2.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;139;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadVector.ADIOS2BPWriteReadVector2D4x2_MultiSteps.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadVector.Serial" "--gtest_filter=BPWriteReadVector.ADIOS2BPWriteReadVector2D4x2_MultiSteps" "BP5")
+set_tests_properties(Engine.BP.BPWriteReadVector.ADIOS2BPWriteReadVector2D4x2_MultiSteps.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;139;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadAttributeTestMultirank.ADIOS2BPWriteReadArrayTypes.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadAttributesMultirank.Serial" "--gtest_filter=BPWriteReadAttributeTestMultirank.ADIOS2BPWriteReadArrayTypes" "BP3")
+set_tests_properties(Engine.BP.BPWriteReadAttributeTestMultirank.ADIOS2BPWriteReadArrayTypes.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;140;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadAttributeTestMultirank.ADIOS2BPWriteReadNewAttributesLaterStep.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadAttributesMultirank.Serial" "--gtest_filter=BPWriteReadAttributeTestMultirank.ADIOS2BPWriteReadNewAttributesLaterStep" "BP3")
+set_tests_properties(Engine.BP.BPWriteReadAttributeTestMultirank.ADIOS2BPWriteReadNewAttributesLaterStep.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;140;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadAttributeTestMultirank.ADIOS2BPWriteReadArrayTypes.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadAttributesMultirank.Serial" "--gtest_filter=BPWriteReadAttributeTestMultirank.ADIOS2BPWriteReadArrayTypes" "BP4")
+set_tests_properties(Engine.BP.BPWriteReadAttributeTestMultirank.ADIOS2BPWriteReadArrayTypes.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;140;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadAttributeTestMultirank.ADIOS2BPWriteReadNewAttributesLaterStep.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadAttributesMultirank.Serial" "--gtest_filter=BPWriteReadAttributeTestMultirank.ADIOS2BPWriteReadNewAttributesLaterStep" "BP4")
+set_tests_properties(Engine.BP.BPWriteReadAttributeTestMultirank.ADIOS2BPWriteReadNewAttributesLaterStep.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;140;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadAttributeTestMultirank.ADIOS2BPWriteReadArrayTypes.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadAttributesMultirank.Serial" "--gtest_filter=BPWriteReadAttributeTestMultirank.ADIOS2BPWriteReadArrayTypes" "BP5")
+set_tests_properties(Engine.BP.BPWriteReadAttributeTestMultirank.ADIOS2BPWriteReadArrayTypes.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;140;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadAttributeTestMultirank.ADIOS2BPWriteReadNewAttributesLaterStep.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadAttributesMultirank.Serial" "--gtest_filter=BPWriteReadAttributeTestMultirank.ADIOS2BPWriteReadNewAttributesLaterStep" "BP5")
+set_tests_properties(Engine.BP.BPWriteReadAttributeTestMultirank.ADIOS2BPWriteReadNewAttributesLaterStep.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;140;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPLargeMetadata.BPWrite1D_LargeMetadata.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.LargeMetadata.Serial" "--gtest_filter=BPLargeMetadata.BPWrite1D_LargeMetadata" "BP3")
+set_tests_properties(Engine.BP.BPLargeMetadata.BPWrite1D_LargeMetadata.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;141;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPLargeMetadata.ManyLongStrings.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.LargeMetadata.Serial" "--gtest_filter=BPLargeMetadata.ManyLongStrings" "BP3")
+set_tests_properties(Engine.BP.BPLargeMetadata.ManyLongStrings.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;141;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPLargeMetadata.BPWrite1D_LargeMetadata.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.LargeMetadata.Serial" "--gtest_filter=BPLargeMetadata.BPWrite1D_LargeMetadata" "BP4")
+set_tests_properties(Engine.BP.BPLargeMetadata.BPWrite1D_LargeMetadata.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;141;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPLargeMetadata.ManyLongStrings.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.LargeMetadata.Serial" "--gtest_filter=BPLargeMetadata.ManyLongStrings" "BP4")
+set_tests_properties(Engine.BP.BPLargeMetadata.ManyLongStrings.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;141;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPLargeMetadata.BPWrite1D_LargeMetadata.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.LargeMetadata.Serial" "--gtest_filter=BPLargeMetadata.BPWrite1D_LargeMetadata" "BP5")
+set_tests_properties(Engine.BP.BPLargeMetadata.BPWrite1D_LargeMetadata.BP5.Serial PROPERTIES  RUN_SERIAL "TRUE" WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;141;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPLargeMetadata.ManyLongStrings.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.LargeMetadata.Serial" "--gtest_filter=BPLargeMetadata.ManyLongStrings" "BP5")
+set_tests_properties(Engine.BP.BPLargeMetadata.ManyLongStrings.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;141;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteStatsOnly.BPReadException.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteStatsOnly.Serial" "--gtest_filter=BPWriteStatsOnly.BPReadException" "BP5")
+set_tests_properties(Engine.BP.BPWriteStatsOnly.BPReadException.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;31;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;142;bp5_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.*/BPWriteMemSelReadVector.BPMemorySelectionSteps1D/*.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteMemorySelectionRead.Serial" "--gtest_filter=*/BPWriteMemSelReadVector.BPMemorySelectionSteps1D/*" "BP3")
+set_tests_properties(Engine.BP.*/BPWriteMemSelReadVector.BPMemorySelectionSteps1D/*.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;233;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.*/BPWriteMemSelReadVector.BPMemorySelectionSteps2D4x2/*.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteMemorySelectionRead.Serial" "--gtest_filter=*/BPWriteMemSelReadVector.BPMemorySelectionSteps2D4x2/*" "BP3")
+set_tests_properties(Engine.BP.*/BPWriteMemSelReadVector.BPMemorySelectionSteps2D4x2/*.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;233;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.*/BPWriteMemSelReadVector.BPMemorySelectionSteps3D4x2x8/*.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteMemorySelectionRead.Serial" "--gtest_filter=*/BPWriteMemSelReadVector.BPMemorySelectionSteps3D4x2x8/*" "BP3")
+set_tests_properties(Engine.BP.*/BPWriteMemSelReadVector.BPMemorySelectionSteps3D4x2x8/*.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;233;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.*/BPWriteMemSelReadVector.BPMemorySelectionSteps1D/*.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteMemorySelectionRead.Serial" "--gtest_filter=*/BPWriteMemSelReadVector.BPMemorySelectionSteps1D/*" "BP4")
+set_tests_properties(Engine.BP.*/BPWriteMemSelReadVector.BPMemorySelectionSteps1D/*.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;233;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.*/BPWriteMemSelReadVector.BPMemorySelectionSteps2D4x2/*.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteMemorySelectionRead.Serial" "--gtest_filter=*/BPWriteMemSelReadVector.BPMemorySelectionSteps2D4x2/*" "BP4")
+set_tests_properties(Engine.BP.*/BPWriteMemSelReadVector.BPMemorySelectionSteps2D4x2/*.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;233;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.*/BPWriteMemSelReadVector.BPMemorySelectionSteps3D4x2x8/*.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteMemorySelectionRead.Serial" "--gtest_filter=*/BPWriteMemSelReadVector.BPMemorySelectionSteps3D4x2x8/*" "BP4")
+set_tests_properties(Engine.BP.*/BPWriteMemSelReadVector.BPMemorySelectionSteps3D4x2x8/*.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;233;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.*/BPWriteMemSelReadVector.BPMemorySelectionSteps1D/*.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteMemorySelectionRead.Serial" "--gtest_filter=*/BPWriteMemSelReadVector.BPMemorySelectionSteps1D/*" "BP5")
+set_tests_properties(Engine.BP.*/BPWriteMemSelReadVector.BPMemorySelectionSteps1D/*.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;233;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.*/BPWriteMemSelReadVector.BPMemorySelectionSteps2D4x2/*.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteMemorySelectionRead.Serial" "--gtest_filter=*/BPWriteMemSelReadVector.BPMemorySelectionSteps2D4x2/*" "BP5")
+set_tests_properties(Engine.BP.*/BPWriteMemSelReadVector.BPMemorySelectionSteps2D4x2/*.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;233;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.*/BPWriteMemSelReadVector.BPMemorySelectionSteps3D4x2x8/*.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteMemorySelectionRead.Serial" "--gtest_filter=*/BPWriteMemSelReadVector.BPMemorySelectionSteps3D4x2x8/*" "BP5")
+set_tests_properties(Engine.BP.*/BPWriteMemSelReadVector.BPMemorySelectionSteps3D4x2x8/*.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;233;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadLocalVariables.ADIOS2BPWriteReadLocal1D.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadLocalVariables.Serial" "--gtest_filter=BPWriteReadLocalVariables.ADIOS2BPWriteReadLocal1D" "BP3")
+set_tests_properties(Engine.BP.BPWriteReadLocalVariables.ADIOS2BPWriteReadLocal1D.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;234;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadLocalVariables.ADIOS2BPWriteReadLocal2D2x4.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadLocalVariables.Serial" "--gtest_filter=BPWriteReadLocalVariables.ADIOS2BPWriteReadLocal2D2x4" "BP3")
+set_tests_properties(Engine.BP.BPWriteReadLocalVariables.ADIOS2BPWriteReadLocal2D2x4.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;234;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadLocalVariables.ADIOS2BPWriteReadLocal2D4x2.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadLocalVariables.Serial" "--gtest_filter=BPWriteReadLocalVariables.ADIOS2BPWriteReadLocal2D4x2" "BP3")
+set_tests_properties(Engine.BP.BPWriteReadLocalVariables.ADIOS2BPWriteReadLocal2D4x2.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;234;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadLocalVariables.ADIOS2BPWriteReadLocal1DAllSteps.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadLocalVariables.Serial" "--gtest_filter=BPWriteReadLocalVariables.ADIOS2BPWriteReadLocal1DAllSteps" "BP3")
+set_tests_properties(Engine.BP.BPWriteReadLocalVariables.ADIOS2BPWriteReadLocal1DAllSteps.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;234;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadLocalVariables.ADIOS2BPWriteReadLocal1DBlockInfo.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadLocalVariables.Serial" "--gtest_filter=BPWriteReadLocalVariables.ADIOS2BPWriteReadLocal1DBlockInfo" "BP3")
+set_tests_properties(Engine.BP.BPWriteReadLocalVariables.ADIOS2BPWriteReadLocal1DBlockInfo.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;234;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadLocalVariables.ADIOS2BPWriteReadLocal1DSubFile.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadLocalVariables.Serial" "--gtest_filter=BPWriteReadLocalVariables.ADIOS2BPWriteReadLocal1DSubFile" "BP3")
+set_tests_properties(Engine.BP.BPWriteReadLocalVariables.ADIOS2BPWriteReadLocal1DSubFile.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;234;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadLocalVariables.ADIOS2BPWriteReadLocal2DChangeCount.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadLocalVariables.Serial" "--gtest_filter=BPWriteReadLocalVariables.ADIOS2BPWriteReadLocal2DChangeCount" "BP3")
+set_tests_properties(Engine.BP.BPWriteReadLocalVariables.ADIOS2BPWriteReadLocal2DChangeCount.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;234;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadLocalVariables.ADIOS2BPWriteReadLocalVaryingNumberOfBlocks.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadLocalVariables.Serial" "--gtest_filter=BPWriteReadLocalVariables.ADIOS2BPWriteReadLocalVaryingNumberOfBlocks" "BP3")
+set_tests_properties(Engine.BP.BPWriteReadLocalVariables.ADIOS2BPWriteReadLocalVaryingNumberOfBlocks.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;234;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadLocalVariables.ADIOS2BPWriteReadLocal1D.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadLocalVariables.Serial" "--gtest_filter=BPWriteReadLocalVariables.ADIOS2BPWriteReadLocal1D" "BP4")
+set_tests_properties(Engine.BP.BPWriteReadLocalVariables.ADIOS2BPWriteReadLocal1D.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;234;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadLocalVariables.ADIOS2BPWriteReadLocal2D2x4.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadLocalVariables.Serial" "--gtest_filter=BPWriteReadLocalVariables.ADIOS2BPWriteReadLocal2D2x4" "BP4")
+set_tests_properties(Engine.BP.BPWriteReadLocalVariables.ADIOS2BPWriteReadLocal2D2x4.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;234;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadLocalVariables.ADIOS2BPWriteReadLocal2D4x2.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadLocalVariables.Serial" "--gtest_filter=BPWriteReadLocalVariables.ADIOS2BPWriteReadLocal2D4x2" "BP4")
+set_tests_properties(Engine.BP.BPWriteReadLocalVariables.ADIOS2BPWriteReadLocal2D4x2.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;234;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadLocalVariables.ADIOS2BPWriteReadLocal1DAllSteps.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadLocalVariables.Serial" "--gtest_filter=BPWriteReadLocalVariables.ADIOS2BPWriteReadLocal1DAllSteps" "BP4")
+set_tests_properties(Engine.BP.BPWriteReadLocalVariables.ADIOS2BPWriteReadLocal1DAllSteps.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;234;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadLocalVariables.ADIOS2BPWriteReadLocal1DBlockInfo.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadLocalVariables.Serial" "--gtest_filter=BPWriteReadLocalVariables.ADIOS2BPWriteReadLocal1DBlockInfo" "BP4")
+set_tests_properties(Engine.BP.BPWriteReadLocalVariables.ADIOS2BPWriteReadLocal1DBlockInfo.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;234;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadLocalVariables.ADIOS2BPWriteReadLocal1DSubFile.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadLocalVariables.Serial" "--gtest_filter=BPWriteReadLocalVariables.ADIOS2BPWriteReadLocal1DSubFile" "BP4")
+set_tests_properties(Engine.BP.BPWriteReadLocalVariables.ADIOS2BPWriteReadLocal1DSubFile.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;234;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadLocalVariables.ADIOS2BPWriteReadLocal2DChangeCount.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadLocalVariables.Serial" "--gtest_filter=BPWriteReadLocalVariables.ADIOS2BPWriteReadLocal2DChangeCount" "BP4")
+set_tests_properties(Engine.BP.BPWriteReadLocalVariables.ADIOS2BPWriteReadLocal2DChangeCount.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;234;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadLocalVariables.ADIOS2BPWriteReadLocalVaryingNumberOfBlocks.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadLocalVariables.Serial" "--gtest_filter=BPWriteReadLocalVariables.ADIOS2BPWriteReadLocalVaryingNumberOfBlocks" "BP4")
+set_tests_properties(Engine.BP.BPWriteReadLocalVariables.ADIOS2BPWriteReadLocalVaryingNumberOfBlocks.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;234;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadLocalVariables.ADIOS2BPWriteReadLocal1D.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadLocalVariables.Serial" "--gtest_filter=BPWriteReadLocalVariables.ADIOS2BPWriteReadLocal1D" "BP5")
+set_tests_properties(Engine.BP.BPWriteReadLocalVariables.ADIOS2BPWriteReadLocal1D.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;234;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadLocalVariables.ADIOS2BPWriteReadLocal2D2x4.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadLocalVariables.Serial" "--gtest_filter=BPWriteReadLocalVariables.ADIOS2BPWriteReadLocal2D2x4" "BP5")
+set_tests_properties(Engine.BP.BPWriteReadLocalVariables.ADIOS2BPWriteReadLocal2D2x4.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;234;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadLocalVariables.ADIOS2BPWriteReadLocal2D4x2.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadLocalVariables.Serial" "--gtest_filter=BPWriteReadLocalVariables.ADIOS2BPWriteReadLocal2D4x2" "BP5")
+set_tests_properties(Engine.BP.BPWriteReadLocalVariables.ADIOS2BPWriteReadLocal2D4x2.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;234;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadLocalVariables.ADIOS2BPWriteReadLocal1DAllSteps.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadLocalVariables.Serial" "--gtest_filter=BPWriteReadLocalVariables.ADIOS2BPWriteReadLocal1DAllSteps" "BP5")
+set_tests_properties(Engine.BP.BPWriteReadLocalVariables.ADIOS2BPWriteReadLocal1DAllSteps.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;234;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadLocalVariables.ADIOS2BPWriteReadLocal1DBlockInfo.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadLocalVariables.Serial" "--gtest_filter=BPWriteReadLocalVariables.ADIOS2BPWriteReadLocal1DBlockInfo" "BP5")
+set_tests_properties(Engine.BP.BPWriteReadLocalVariables.ADIOS2BPWriteReadLocal1DBlockInfo.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;234;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadLocalVariables.ADIOS2BPWriteReadLocal1DSubFile.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadLocalVariables.Serial" "--gtest_filter=BPWriteReadLocalVariables.ADIOS2BPWriteReadLocal1DSubFile" "BP5")
+set_tests_properties(Engine.BP.BPWriteReadLocalVariables.ADIOS2BPWriteReadLocal1DSubFile.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;234;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadLocalVariables.ADIOS2BPWriteReadLocal2DChangeCount.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadLocalVariables.Serial" "--gtest_filter=BPWriteReadLocalVariables.ADIOS2BPWriteReadLocal2DChangeCount" "BP5")
+set_tests_properties(Engine.BP.BPWriteReadLocalVariables.ADIOS2BPWriteReadLocal2DChangeCount.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;234;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadLocalVariables.ADIOS2BPWriteReadLocalVaryingNumberOfBlocks.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadLocalVariables.Serial" "--gtest_filter=BPWriteReadLocalVariables.ADIOS2BPWriteReadLocalVaryingNumberOfBlocks" "BP5")
+set_tests_properties(Engine.BP.BPWriteReadLocalVariables.ADIOS2BPWriteReadLocalVaryingNumberOfBlocks.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;234;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadLocalVariablesSel.BPWriteReadLocal1DSel.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadLocalVariablesSel.Serial" "--gtest_filter=BPWriteReadLocalVariablesSel.BPWriteReadLocal1DSel" "BP3")
+set_tests_properties(Engine.BP.BPWriteReadLocalVariablesSel.BPWriteReadLocal1DSel.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;235;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadLocalVariablesSel.BPWriteReadLocal2D2x4Sel.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadLocalVariablesSel.Serial" "--gtest_filter=BPWriteReadLocalVariablesSel.BPWriteReadLocal2D2x4Sel" "BP3")
+set_tests_properties(Engine.BP.BPWriteReadLocalVariablesSel.BPWriteReadLocal2D2x4Sel.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;235;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadLocalVariablesSel.BPWriteReadLocal2D4x2Sel.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadLocalVariablesSel.Serial" "--gtest_filter=BPWriteReadLocalVariablesSel.BPWriteReadLocal2D4x2Sel" "BP3")
+set_tests_properties(Engine.BP.BPWriteReadLocalVariablesSel.BPWriteReadLocal2D4x2Sel.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;235;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadLocalVariablesSel.BPWriteReadLocal1DAllStepsSel.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadLocalVariablesSel.Serial" "--gtest_filter=BPWriteReadLocalVariablesSel.BPWriteReadLocal1DAllStepsSel" "BP3")
+set_tests_properties(Engine.BP.BPWriteReadLocalVariablesSel.BPWriteReadLocal1DAllStepsSel.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;235;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadLocalVariablesSel.BPWriteReadLocal1DSel.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadLocalVariablesSel.Serial" "--gtest_filter=BPWriteReadLocalVariablesSel.BPWriteReadLocal1DSel" "BP4")
+set_tests_properties(Engine.BP.BPWriteReadLocalVariablesSel.BPWriteReadLocal1DSel.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;235;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadLocalVariablesSel.BPWriteReadLocal2D2x4Sel.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadLocalVariablesSel.Serial" "--gtest_filter=BPWriteReadLocalVariablesSel.BPWriteReadLocal2D2x4Sel" "BP4")
+set_tests_properties(Engine.BP.BPWriteReadLocalVariablesSel.BPWriteReadLocal2D2x4Sel.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;235;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadLocalVariablesSel.BPWriteReadLocal2D4x2Sel.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadLocalVariablesSel.Serial" "--gtest_filter=BPWriteReadLocalVariablesSel.BPWriteReadLocal2D4x2Sel" "BP4")
+set_tests_properties(Engine.BP.BPWriteReadLocalVariablesSel.BPWriteReadLocal2D4x2Sel.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;235;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadLocalVariablesSel.BPWriteReadLocal1DAllStepsSel.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadLocalVariablesSel.Serial" "--gtest_filter=BPWriteReadLocalVariablesSel.BPWriteReadLocal1DAllStepsSel" "BP4")
+set_tests_properties(Engine.BP.BPWriteReadLocalVariablesSel.BPWriteReadLocal1DAllStepsSel.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;235;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadLocalVariablesSel.BPWriteReadLocal1DSel.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadLocalVariablesSel.Serial" "--gtest_filter=BPWriteReadLocalVariablesSel.BPWriteReadLocal1DSel" "BP5")
+set_tests_properties(Engine.BP.BPWriteReadLocalVariablesSel.BPWriteReadLocal1DSel.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;235;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadLocalVariablesSel.BPWriteReadLocal2D2x4Sel.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadLocalVariablesSel.Serial" "--gtest_filter=BPWriteReadLocalVariablesSel.BPWriteReadLocal2D2x4Sel" "BP5")
+set_tests_properties(Engine.BP.BPWriteReadLocalVariablesSel.BPWriteReadLocal2D2x4Sel.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;235;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadLocalVariablesSel.BPWriteReadLocal2D4x2Sel.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadLocalVariablesSel.Serial" "--gtest_filter=BPWriteReadLocalVariablesSel.BPWriteReadLocal2D4x2Sel" "BP5")
+set_tests_properties(Engine.BP.BPWriteReadLocalVariablesSel.BPWriteReadLocal2D4x2Sel.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;235;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadLocalVariablesSel.BPWriteReadLocal1DAllStepsSel.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadLocalVariablesSel.Serial" "--gtest_filter=BPWriteReadLocalVariablesSel.BPWriteReadLocal1DAllStepsSel" "BP5")
+set_tests_properties(Engine.BP.BPWriteReadLocalVariablesSel.BPWriteReadLocal1DAllStepsSel.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;235;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadLocalVariablesSelHighLevel.BPWriteReadLocal1DSel.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadLocalVariablesSelHighLevel.Serial" "--gtest_filter=BPWriteReadLocalVariablesSelHighLevel.BPWriteReadLocal1DSel" "BP3")
+set_tests_properties(Engine.BP.BPWriteReadLocalVariablesSelHighLevel.BPWriteReadLocal1DSel.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;236;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadLocalVariablesSelHighLevel.BPWriteReadLocal2D2x4Sel.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadLocalVariablesSelHighLevel.Serial" "--gtest_filter=BPWriteReadLocalVariablesSelHighLevel.BPWriteReadLocal2D2x4Sel" "BP3")
+set_tests_properties(Engine.BP.BPWriteReadLocalVariablesSelHighLevel.BPWriteReadLocal2D2x4Sel.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;236;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadLocalVariablesSelHighLevel.BPWriteReadLocal1DAllStepsSel.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadLocalVariablesSelHighLevel.Serial" "--gtest_filter=BPWriteReadLocalVariablesSelHighLevel.BPWriteReadLocal1DAllStepsSel" "BP3")
+set_tests_properties(Engine.BP.BPWriteReadLocalVariablesSelHighLevel.BPWriteReadLocal1DAllStepsSel.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;236;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadLocalVariablesSelHighLevel.BPWriteReadLocal1DSel.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadLocalVariablesSelHighLevel.Serial" "--gtest_filter=BPWriteReadLocalVariablesSelHighLevel.BPWriteReadLocal1DSel" "BP4")
+set_tests_properties(Engine.BP.BPWriteReadLocalVariablesSelHighLevel.BPWriteReadLocal1DSel.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;236;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadLocalVariablesSelHighLevel.BPWriteReadLocal2D2x4Sel.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadLocalVariablesSelHighLevel.Serial" "--gtest_filter=BPWriteReadLocalVariablesSelHighLevel.BPWriteReadLocal2D2x4Sel" "BP4")
+set_tests_properties(Engine.BP.BPWriteReadLocalVariablesSelHighLevel.BPWriteReadLocal2D2x4Sel.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;236;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadLocalVariablesSelHighLevel.BPWriteReadLocal1DAllStepsSel.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadLocalVariablesSelHighLevel.Serial" "--gtest_filter=BPWriteReadLocalVariablesSelHighLevel.BPWriteReadLocal1DAllStepsSel" "BP4")
+set_tests_properties(Engine.BP.BPWriteReadLocalVariablesSelHighLevel.BPWriteReadLocal1DAllStepsSel.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;236;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadLocalVariablesSelHighLevel.BPWriteReadLocal1DSel.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadLocalVariablesSelHighLevel.Serial" "--gtest_filter=BPWriteReadLocalVariablesSelHighLevel.BPWriteReadLocal1DSel" "BP5")
+set_tests_properties(Engine.BP.BPWriteReadLocalVariablesSelHighLevel.BPWriteReadLocal1DSel.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;236;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadLocalVariablesSelHighLevel.BPWriteReadLocal2D2x4Sel.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadLocalVariablesSelHighLevel.Serial" "--gtest_filter=BPWriteReadLocalVariablesSelHighLevel.BPWriteReadLocal2D2x4Sel" "BP5")
+set_tests_properties(Engine.BP.BPWriteReadLocalVariablesSelHighLevel.BPWriteReadLocal2D2x4Sel.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;236;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadLocalVariablesSelHighLevel.BPWriteReadLocal1DAllStepsSel.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadLocalVariablesSelHighLevel.Serial" "--gtest_filter=BPWriteReadLocalVariablesSelHighLevel.BPWriteReadLocal1DAllStepsSel" "BP5")
+set_tests_properties(Engine.BP.BPWriteReadLocalVariablesSelHighLevel.BPWriteReadLocal1DAllStepsSel.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;236;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPChangingShape.BPWriteReadShape2D.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.ChangingShape.Serial" "--gtest_filter=BPChangingShape.BPWriteReadShape2D" "BP3")
+set_tests_properties(Engine.BP.BPChangingShape.BPWriteReadShape2D.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;237;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPChangingShape.BPWriteReadShape2D.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.ChangingShape.Serial" "--gtest_filter=BPChangingShape.BPWriteReadShape2D" "BP4")
+set_tests_properties(Engine.BP.BPChangingShape.BPWriteReadShape2D.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;237;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPChangingShape.BPWriteReadShape2D.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.ChangingShape.Serial" "--gtest_filter=BPChangingShape.BPWriteReadShape2D" "BP5")
+set_tests_properties(Engine.BP.BPChangingShape.BPWriteReadShape2D.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;237;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.*/BPChangingShapeWithinStep.MultiBlock/*.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.ChangingShapeWithinStep.Serial" "--gtest_filter=*/BPChangingShapeWithinStep.MultiBlock/*" "BP3")
+set_tests_properties(Engine.BP.*/BPChangingShapeWithinStep.MultiBlock/*.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;238;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.*/BPChangingShapeWithinStep.MultiBlock/*.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.ChangingShapeWithinStep.Serial" "--gtest_filter=*/BPChangingShapeWithinStep.MultiBlock/*" "BP4")
+set_tests_properties(Engine.BP.*/BPChangingShapeWithinStep.MultiBlock/*.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;238;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.*/BPChangingShapeWithinStep.MultiBlock/*.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.ChangingShapeWithinStep.Serial" "--gtest_filter=*/BPChangingShapeWithinStep.MultiBlock/*" "BP5")
+set_tests_properties(Engine.BP.*/BPChangingShapeWithinStep.MultiBlock/*.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;238;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadBlockInfo.BPWriteReadBlockInfo1D8.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadBlockInfo.Serial" "--gtest_filter=BPWriteReadBlockInfo.BPWriteReadBlockInfo1D8" "BP3")
+set_tests_properties(Engine.BP.BPWriteReadBlockInfo.BPWriteReadBlockInfo1D8.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;239;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadBlockInfo.BPWriteReadBlockInfo2D2x4.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadBlockInfo.Serial" "--gtest_filter=BPWriteReadBlockInfo.BPWriteReadBlockInfo2D2x4" "BP3")
+set_tests_properties(Engine.BP.BPWriteReadBlockInfo.BPWriteReadBlockInfo2D2x4.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;239;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadBlockInfo.BPWriteReadBlockInfo1D8_C.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadBlockInfo.Serial" "--gtest_filter=BPWriteReadBlockInfo.BPWriteReadBlockInfo1D8_C" "BP3")
+set_tests_properties(Engine.BP.BPWriteReadBlockInfo.BPWriteReadBlockInfo1D8_C.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;239;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadBlockInfo.BPWriteReadBlockInfo1D8.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadBlockInfo.Serial" "--gtest_filter=BPWriteReadBlockInfo.BPWriteReadBlockInfo1D8" "BP4")
+set_tests_properties(Engine.BP.BPWriteReadBlockInfo.BPWriteReadBlockInfo1D8.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;239;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadBlockInfo.BPWriteReadBlockInfo2D2x4.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadBlockInfo.Serial" "--gtest_filter=BPWriteReadBlockInfo.BPWriteReadBlockInfo2D2x4" "BP4")
+set_tests_properties(Engine.BP.BPWriteReadBlockInfo.BPWriteReadBlockInfo2D2x4.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;239;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadBlockInfo.BPWriteReadBlockInfo1D8_C.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadBlockInfo.Serial" "--gtest_filter=BPWriteReadBlockInfo.BPWriteReadBlockInfo1D8_C" "BP4")
+set_tests_properties(Engine.BP.BPWriteReadBlockInfo.BPWriteReadBlockInfo1D8_C.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;239;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadBlockInfo.BPWriteReadBlockInfo1D8.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadBlockInfo.Serial" "--gtest_filter=BPWriteReadBlockInfo.BPWriteReadBlockInfo1D8" "BP5")
+set_tests_properties(Engine.BP.BPWriteReadBlockInfo.BPWriteReadBlockInfo1D8.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;239;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadBlockInfo.BPWriteReadBlockInfo2D2x4.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadBlockInfo.Serial" "--gtest_filter=BPWriteReadBlockInfo.BPWriteReadBlockInfo2D2x4" "BP5")
+set_tests_properties(Engine.BP.BPWriteReadBlockInfo.BPWriteReadBlockInfo2D2x4.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;239;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadBlockInfo.BPWriteReadBlockInfo1D8_C.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadBlockInfo.Serial" "--gtest_filter=BPWriteReadBlockInfo.BPWriteReadBlockInfo1D8_C" "BP5")
+set_tests_properties(Engine.BP.BPWriteReadBlockInfo.BPWriteReadBlockInfo1D8_C.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;239;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadSpan.BPWriteRead1D8.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadVariableSpan.Serial" "--gtest_filter=BPWriteReadSpan.BPWriteRead1D8" "BP3")
+set_tests_properties(Engine.BP.BPWriteReadSpan.BPWriteRead1D8.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;240;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadSpan.BPWriteRead2D2x4.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadVariableSpan.Serial" "--gtest_filter=BPWriteReadSpan.BPWriteRead2D2x4" "BP3")
+set_tests_properties(Engine.BP.BPWriteReadSpan.BPWriteRead2D2x4.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;240;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadSpan.BPWriteRead1D8Local.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadVariableSpan.Serial" "--gtest_filter=BPWriteReadSpan.BPWriteRead1D8Local" "BP3")
+set_tests_properties(Engine.BP.BPWriteReadSpan.BPWriteRead1D8Local.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;240;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadSpan.BPWriteRead2D2x4Local.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadVariableSpan.Serial" "--gtest_filter=BPWriteReadSpan.BPWriteRead2D2x4Local" "BP3")
+set_tests_properties(Engine.BP.BPWriteReadSpan.BPWriteRead2D2x4Local.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;240;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadSpan.BPWriteRead1D8FillValue.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadVariableSpan.Serial" "--gtest_filter=BPWriteReadSpan.BPWriteRead1D8FillValue" "BP3")
+set_tests_properties(Engine.BP.BPWriteReadSpan.BPWriteRead1D8FillValue.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;240;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadSpan.BPWriteSpanOperatorException.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadVariableSpan.Serial" "--gtest_filter=BPWriteReadSpan.BPWriteSpanOperatorException" "BP3")
+set_tests_properties(Engine.BP.BPWriteReadSpan.BPWriteSpanOperatorException.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;240;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadSpan.BPWriteRead1D8.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadVariableSpan.Serial" "--gtest_filter=BPWriteReadSpan.BPWriteRead1D8" "BP4")
+set_tests_properties(Engine.BP.BPWriteReadSpan.BPWriteRead1D8.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;240;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadSpan.BPWriteRead2D2x4.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadVariableSpan.Serial" "--gtest_filter=BPWriteReadSpan.BPWriteRead2D2x4" "BP4")
+set_tests_properties(Engine.BP.BPWriteReadSpan.BPWriteRead2D2x4.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;240;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadSpan.BPWriteRead1D8Local.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadVariableSpan.Serial" "--gtest_filter=BPWriteReadSpan.BPWriteRead1D8Local" "BP4")
+set_tests_properties(Engine.BP.BPWriteReadSpan.BPWriteRead1D8Local.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;240;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadSpan.BPWriteRead2D2x4Local.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadVariableSpan.Serial" "--gtest_filter=BPWriteReadSpan.BPWriteRead2D2x4Local" "BP4")
+set_tests_properties(Engine.BP.BPWriteReadSpan.BPWriteRead2D2x4Local.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;240;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadSpan.BPWriteRead1D8FillValue.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadVariableSpan.Serial" "--gtest_filter=BPWriteReadSpan.BPWriteRead1D8FillValue" "BP4")
+set_tests_properties(Engine.BP.BPWriteReadSpan.BPWriteRead1D8FillValue.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;240;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadSpan.BPWriteSpanOperatorException.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadVariableSpan.Serial" "--gtest_filter=BPWriteReadSpan.BPWriteSpanOperatorException" "BP4")
+set_tests_properties(Engine.BP.BPWriteReadSpan.BPWriteSpanOperatorException.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;240;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadSpan.BPWriteRead1D8.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadVariableSpan.Serial" "--gtest_filter=BPWriteReadSpan.BPWriteRead1D8" "BP5")
+set_tests_properties(Engine.BP.BPWriteReadSpan.BPWriteRead1D8.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;240;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadSpan.BPWriteRead2D2x4.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadVariableSpan.Serial" "--gtest_filter=BPWriteReadSpan.BPWriteRead2D2x4" "BP5")
+set_tests_properties(Engine.BP.BPWriteReadSpan.BPWriteRead2D2x4.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;240;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadSpan.BPWriteRead1D8Local.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadVariableSpan.Serial" "--gtest_filter=BPWriteReadSpan.BPWriteRead1D8Local" "BP5")
+set_tests_properties(Engine.BP.BPWriteReadSpan.BPWriteRead1D8Local.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;240;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadSpan.BPWriteRead2D2x4Local.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadVariableSpan.Serial" "--gtest_filter=BPWriteReadSpan.BPWriteRead2D2x4Local" "BP5")
+set_tests_properties(Engine.BP.BPWriteReadSpan.BPWriteRead2D2x4Local.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;240;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadSpan.BPWriteRead1D8FillValue.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadVariableSpan.Serial" "--gtest_filter=BPWriteReadSpan.BPWriteRead1D8FillValue" "BP5")
+set_tests_properties(Engine.BP.BPWriteReadSpan.BPWriteRead1D8FillValue.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;240;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteReadSpan.BPWriteSpanOperatorException.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadVariableSpan.Serial" "--gtest_filter=BPWriteReadSpan.BPWriteSpanOperatorException" "BP5")
+set_tests_properties(Engine.BP.BPWriteReadSpan.BPWriteSpanOperatorException.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;240;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.*/BPTestTimeAggregation.BPTimeAggregation1D8/*.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.TimeAggregation.Serial" "--gtest_filter=*/BPTestTimeAggregation.BPTimeAggregation1D8/*" "BP3")
+set_tests_properties(Engine.BP.*/BPTestTimeAggregation.BPTimeAggregation1D8/*.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;37;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;241;bp3_bp4_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.*/BPTestTimeAggregation.BPTimeAggregation2D4x2/*.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.TimeAggregation.Serial" "--gtest_filter=*/BPTestTimeAggregation.BPTimeAggregation2D4x2/*" "BP3")
+set_tests_properties(Engine.BP.*/BPTestTimeAggregation.BPTimeAggregation2D4x2/*.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;37;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;241;bp3_bp4_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.*/BPTestTimeAggregation.BPTimeAggregation1D8/*.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.TimeAggregation.Serial" "--gtest_filter=*/BPTestTimeAggregation.BPTimeAggregation1D8/*" "BP4")
+set_tests_properties(Engine.BP.*/BPTestTimeAggregation.BPTimeAggregation1D8/*.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;40;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;241;bp3_bp4_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.*/BPTestTimeAggregation.BPTimeAggregation2D4x2/*.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.TimeAggregation.Serial" "--gtest_filter=*/BPTestTimeAggregation.BPTimeAggregation2D4x2/*" "BP4")
+set_tests_properties(Engine.BP.*/BPTestTimeAggregation.BPTimeAggregation2D4x2/*.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;40;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;241;bp3_bp4_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.*/BPStepsFileGlobalArrayReaders.EveryStep/*.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.StepsFileGlobalArray.Serial" "--gtest_filter=*/BPStepsFileGlobalArrayReaders.EveryStep/*" "BP3")
+set_tests_properties(Engine.BP.*/BPStepsFileGlobalArrayReaders.EveryStep/*.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;243;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.*/BPStepsFileGlobalArrayReaders.NewVarPerStep/*.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.StepsFileGlobalArray.Serial" "--gtest_filter=*/BPStepsFileGlobalArrayReaders.NewVarPerStep/*" "BP3")
+set_tests_properties(Engine.BP.*/BPStepsFileGlobalArrayReaders.NewVarPerStep/*.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;243;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.*/BPStepsFileGlobalArrayParameters.EveryOtherStep/*.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.StepsFileGlobalArray.Serial" "--gtest_filter=*/BPStepsFileGlobalArrayParameters.EveryOtherStep/*" "BP3")
+set_tests_properties(Engine.BP.*/BPStepsFileGlobalArrayParameters.EveryOtherStep/*.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;243;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.*/BPStepsFileGlobalArrayReaders.EveryStep/*.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.StepsFileGlobalArray.Serial" "--gtest_filter=*/BPStepsFileGlobalArrayReaders.EveryStep/*" "BP4")
+set_tests_properties(Engine.BP.*/BPStepsFileGlobalArrayReaders.EveryStep/*.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;243;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.*/BPStepsFileGlobalArrayReaders.NewVarPerStep/*.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.StepsFileGlobalArray.Serial" "--gtest_filter=*/BPStepsFileGlobalArrayReaders.NewVarPerStep/*" "BP4")
+set_tests_properties(Engine.BP.*/BPStepsFileGlobalArrayReaders.NewVarPerStep/*.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;243;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.*/BPStepsFileGlobalArrayParameters.EveryOtherStep/*.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.StepsFileGlobalArray.Serial" "--gtest_filter=*/BPStepsFileGlobalArrayParameters.EveryOtherStep/*" "BP4")
+set_tests_properties(Engine.BP.*/BPStepsFileGlobalArrayParameters.EveryOtherStep/*.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;243;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.*/BPStepsFileGlobalArrayReaders.EveryStep/*.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.StepsFileGlobalArray.Serial" "--gtest_filter=*/BPStepsFileGlobalArrayReaders.EveryStep/*" "BP5")
+set_tests_properties(Engine.BP.*/BPStepsFileGlobalArrayReaders.EveryStep/*.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;243;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.*/BPStepsFileGlobalArrayReaders.NewVarPerStep/*.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.StepsFileGlobalArray.Serial" "--gtest_filter=*/BPStepsFileGlobalArrayReaders.NewVarPerStep/*" "BP5")
+set_tests_properties(Engine.BP.*/BPStepsFileGlobalArrayReaders.NewVarPerStep/*.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;243;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.*/BPStepsFileGlobalArrayParameters.EveryOtherStep/*.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.StepsFileGlobalArray.Serial" "--gtest_filter=*/BPStepsFileGlobalArrayParameters.EveryOtherStep/*" "BP5")
+set_tests_properties(Engine.BP.*/BPStepsFileGlobalArrayParameters.EveryOtherStep/*.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;243;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.*/BPStepsFileLocalArrayReaders.EveryStep/*.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.StepsFileLocalArray.Serial" "--gtest_filter=*/BPStepsFileLocalArrayReaders.EveryStep/*" "BP3")
+set_tests_properties(Engine.BP.*/BPStepsFileLocalArrayReaders.EveryStep/*.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;244;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.*/BPStepsFileLocalArrayReaders.NewVarPerStep/*.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.StepsFileLocalArray.Serial" "--gtest_filter=*/BPStepsFileLocalArrayReaders.NewVarPerStep/*" "BP3")
+set_tests_properties(Engine.BP.*/BPStepsFileLocalArrayReaders.NewVarPerStep/*.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;244;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.*/BPStepsFileLocalArrayParameters.EveryOtherStep/*.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.StepsFileLocalArray.Serial" "--gtest_filter=*/BPStepsFileLocalArrayParameters.EveryOtherStep/*" "BP3")
+set_tests_properties(Engine.BP.*/BPStepsFileLocalArrayParameters.EveryOtherStep/*.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;244;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.*/BPStepsFileLocalArrayReaders.EveryStep/*.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.StepsFileLocalArray.Serial" "--gtest_filter=*/BPStepsFileLocalArrayReaders.EveryStep/*" "BP4")
+set_tests_properties(Engine.BP.*/BPStepsFileLocalArrayReaders.EveryStep/*.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;244;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.*/BPStepsFileLocalArrayReaders.NewVarPerStep/*.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.StepsFileLocalArray.Serial" "--gtest_filter=*/BPStepsFileLocalArrayReaders.NewVarPerStep/*" "BP4")
+set_tests_properties(Engine.BP.*/BPStepsFileLocalArrayReaders.NewVarPerStep/*.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;244;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.*/BPStepsFileLocalArrayParameters.EveryOtherStep/*.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.StepsFileLocalArray.Serial" "--gtest_filter=*/BPStepsFileLocalArrayParameters.EveryOtherStep/*" "BP4")
+set_tests_properties(Engine.BP.*/BPStepsFileLocalArrayParameters.EveryOtherStep/*.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;244;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.*/BPStepsFileLocalArrayReaders.EveryStep/*.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.StepsFileLocalArray.Serial" "--gtest_filter=*/BPStepsFileLocalArrayReaders.EveryStep/*" "BP5")
+set_tests_properties(Engine.BP.*/BPStepsFileLocalArrayReaders.EveryStep/*.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;244;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.*/BPStepsFileLocalArrayReaders.NewVarPerStep/*.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.StepsFileLocalArray.Serial" "--gtest_filter=*/BPStepsFileLocalArrayReaders.NewVarPerStep/*" "BP5")
+set_tests_properties(Engine.BP.*/BPStepsFileLocalArrayReaders.NewVarPerStep/*.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;244;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.*/BPStepsFileLocalArrayParameters.EveryOtherStep/*.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.StepsFileLocalArray.Serial" "--gtest_filter=*/BPStepsFileLocalArrayParameters.EveryOtherStep/*" "BP5")
+set_tests_properties(Engine.BP.*/BPStepsFileLocalArrayParameters.EveryOtherStep/*.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;244;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.ADIOSSelectionRowMajorTest.2D.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.SelectionsOnRowMajorData.Serial" "--gtest_filter=ADIOSSelectionRowMajorTest.2D" "BP3")
+set_tests_properties(Engine.BP.ADIOSSelectionRowMajorTest.2D.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;246;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.ADIOSSelectionRowMajorTest.3D.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.SelectionsOnRowMajorData.Serial" "--gtest_filter=ADIOSSelectionRowMajorTest.3D" "BP3")
+set_tests_properties(Engine.BP.ADIOSSelectionRowMajorTest.3D.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;246;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.ADIOSSelectionRowMajorTest.2D.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.SelectionsOnRowMajorData.Serial" "--gtest_filter=ADIOSSelectionRowMajorTest.2D" "BP4")
+set_tests_properties(Engine.BP.ADIOSSelectionRowMajorTest.2D.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;246;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.ADIOSSelectionRowMajorTest.3D.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.SelectionsOnRowMajorData.Serial" "--gtest_filter=ADIOSSelectionRowMajorTest.3D" "BP4")
+set_tests_properties(Engine.BP.ADIOSSelectionRowMajorTest.3D.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;246;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.ADIOSSelectionRowMajorTest.2D.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.SelectionsOnRowMajorData.Serial" "--gtest_filter=ADIOSSelectionRowMajorTest.2D" "BP5")
+set_tests_properties(Engine.BP.ADIOSSelectionRowMajorTest.2D.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;246;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.ADIOSSelectionRowMajorTest.3D.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.SelectionsOnRowMajorData.Serial" "--gtest_filter=ADIOSSelectionRowMajorTest.3D" "BP5")
+set_tests_properties(Engine.BP.ADIOSSelectionRowMajorTest.3D.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;246;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.ADIOSSelectionColumnMajorTest.2D.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.SelectionsOnColumnMajorData.Serial" "--gtest_filter=ADIOSSelectionColumnMajorTest.2D" "BP3")
+set_tests_properties(Engine.BP.ADIOSSelectionColumnMajorTest.2D.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;247;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.ADIOSSelectionColumnMajorTest.3D.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.SelectionsOnColumnMajorData.Serial" "--gtest_filter=ADIOSSelectionColumnMajorTest.3D" "BP3")
+set_tests_properties(Engine.BP.ADIOSSelectionColumnMajorTest.3D.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;247;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.ADIOSSelectionColumnMajorTest.2D.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.SelectionsOnColumnMajorData.Serial" "--gtest_filter=ADIOSSelectionColumnMajorTest.2D" "BP4")
+set_tests_properties(Engine.BP.ADIOSSelectionColumnMajorTest.2D.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;247;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.ADIOSSelectionColumnMajorTest.3D.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.SelectionsOnColumnMajorData.Serial" "--gtest_filter=ADIOSSelectionColumnMajorTest.3D" "BP4")
+set_tests_properties(Engine.BP.ADIOSSelectionColumnMajorTest.3D.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;247;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.ADIOSSelectionColumnMajorTest.2D.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.SelectionsOnColumnMajorData.Serial" "--gtest_filter=ADIOSSelectionColumnMajorTest.2D" "BP5")
+set_tests_properties(Engine.BP.ADIOSSelectionColumnMajorTest.2D.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;247;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.ADIOSSelectionColumnMajorTest.3D.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.SelectionsOnColumnMajorData.Serial" "--gtest_filter=ADIOSSelectionColumnMajorTest.3D" "BP5")
+set_tests_properties(Engine.BP.ADIOSSelectionColumnMajorTest.3D.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;247;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPBufferSizeTest.SyncDeferredIdenticalUsage.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.BufferSize.Serial" "--gtest_filter=BPBufferSizeTest.SyncDeferredIdenticalUsage" "BP3")
+set_tests_properties(Engine.BP.BPBufferSizeTest.SyncDeferredIdenticalUsage.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;258;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPBufferSizeTest.SyncDeferredIdenticalUsage.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.BufferSize.Serial" "--gtest_filter=BPBufferSizeTest.SyncDeferredIdenticalUsage" "BP4")
+set_tests_properties(Engine.BP.BPBufferSizeTest.SyncDeferredIdenticalUsage.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;258;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPBufferSizeTest.SyncDeferredIdenticalUsage.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.BufferSize.Serial" "--gtest_filter=BPBufferSizeTest.SyncDeferredIdenticalUsage" "BP5")
+set_tests_properties(Engine.BP.BPBufferSizeTest.SyncDeferredIdenticalUsage.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;258;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.*/BPParameterSelectStepsP.Read/*.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.ParameterSelectSteps.Serial" "--gtest_filter=*/BPParameterSelectStepsP.Read/*" "BP5")
+set_tests_properties(Engine.BP.*/BPParameterSelectStepsP.Read/*.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;266;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.*/BPParameterSelectStepsP.Stream/*.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.ParameterSelectSteps.Serial" "--gtest_filter=*/BPParameterSelectStepsP.Stream/*" "BP5")
+set_tests_properties(Engine.BP.*/BPParameterSelectStepsP.Stream/*.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;266;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.*/BPAppendAfterStepsP.Test/*.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.AppendAfterSteps.Serial" "--gtest_filter=*/BPAppendAfterStepsP.Test/*" "BP5")
+set_tests_properties(Engine.BP.*/BPAppendAfterStepsP.Test/*.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;269;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.ADIOSReadDirectIOTest.BufferResize.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.DirectIO.Serial" "--gtest_filter=ADIOSReadDirectIOTest.BufferResize" "BP5")
+set_tests_properties(Engine.BP.ADIOSReadDirectIOTest.BufferResize.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;272;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.*/BPReadMultithreadedTestP.ReadFile/*.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.ReadMultithreaded.Serial" "--gtest_filter=*/BPReadMultithreadedTestP.ReadFile/*" "BP5")
+set_tests_properties(Engine.BP.*/BPReadMultithreadedTestP.ReadFile/*.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;275;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.*/BPReadMultithreadedTestP.ReadStream/*.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.ReadMultithreaded.Serial" "--gtest_filter=*/BPReadMultithreadedTestP.ReadStream/*" "BP5")
+set_tests_properties(Engine.BP.*/BPReadMultithreadedTestP.ReadStream/*.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;275;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.*/BPReadMultithreadedTestP.ReadSubBox/*.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.ReadMultithreaded.Serial" "--gtest_filter=*/BPReadMultithreadedTestP.ReadSubBox/*" "BP5")
+set_tests_properties(Engine.BP.*/BPReadMultithreadedTestP.ReadSubBox/*.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;275;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.*/BPReadMultithreadedTestP.ReadSlabsAndColumns/*.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.ReadMultithreaded.Serial" "--gtest_filter=*/BPReadMultithreadedTestP.ReadSlabsAndColumns/*" "BP5")
+set_tests_properties(Engine.BP.*/BPReadMultithreadedTestP.ReadSlabsAndColumns/*.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;275;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.*/BPReadMultithreadedTestP.ReadUnitsOfOneSubfile/*.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.ReadMultithreaded.Serial" "--gtest_filter=*/BPReadMultithreadedTestP.ReadUnitsOfOneSubfile/*" "BP5")
+set_tests_properties(Engine.BP.*/BPReadMultithreadedTestP.ReadUnitsOfOneSubfile/*.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;275;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.AccuracyTests.DefaultAccuracy.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.AccuracyDefaults.Serial" "--gtest_filter=AccuracyTests.DefaultAccuracy" "BP5")
+set_tests_properties(Engine.BP.AccuracyTests.DefaultAccuracy.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;280;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteNullTest.BPWrite1D1x8.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteNull.Serial" "--gtest_filter=BPWriteNullTest.BPWrite1D1x8" "BP3")
+set_tests_properties(Engine.BP.BPWriteNullTest.BPWrite1D1x8.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;285;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteNullTest.BPWrite2D2x4.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteNull.Serial" "--gtest_filter=BPWriteNullTest.BPWrite2D2x4" "BP3")
+set_tests_properties(Engine.BP.BPWriteNullTest.BPWrite2D2x4.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;285;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteNullTest.BPWrite2D4x2.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteNull.Serial" "--gtest_filter=BPWriteNullTest.BPWrite2D4x2" "BP3")
+set_tests_properties(Engine.BP.BPWriteNullTest.BPWrite2D4x2.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;285;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteNullTest.BPWrite2D4x2_MultiSteps.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteNull.Serial" "--gtest_filter=BPWriteNullTest.BPWrite2D4x2_MultiSteps" "BP3")
+set_tests_properties(Engine.BP.BPWriteNullTest.BPWrite2D4x2_MultiSteps.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;285;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteAppendReadTestADIOS2.ADIOS2BPWriteAppendRead2D2x4.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteAppendReadADIOS2.Serial" "--gtest_filter=BPWriteAppendReadTestADIOS2.ADIOS2BPWriteAppendRead2D2x4" "BP4")
+set_tests_properties(Engine.BP.BPWriteAppendReadTestADIOS2.ADIOS2BPWriteAppendRead2D2x4.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;46;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;290;bp4_bp5_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteAppendReadTestADIOS2.ADIOS2BPWriteAppendReadAggregate.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteAppendReadADIOS2.Serial" "--gtest_filter=BPWriteAppendReadTestADIOS2.ADIOS2BPWriteAppendReadAggregate" "BP4")
+set_tests_properties(Engine.BP.BPWriteAppendReadTestADIOS2.ADIOS2BPWriteAppendReadAggregate.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;46;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;290;bp4_bp5_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteAppendReadTestADIOS2.ADIOS2BPWriteAppendReadVaryingAggregation.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteAppendReadADIOS2.Serial" "--gtest_filter=BPWriteAppendReadTestADIOS2.ADIOS2BPWriteAppendReadVaryingAggregation" "BP4")
+set_tests_properties(Engine.BP.BPWriteAppendReadTestADIOS2.ADIOS2BPWriteAppendReadVaryingAggregation.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;46;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;290;bp4_bp5_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteAppendReadTestADIOS2.ADIOS2BPWriteAppendRead2D2x4.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteAppendReadADIOS2.Serial" "--gtest_filter=BPWriteAppendReadTestADIOS2.ADIOS2BPWriteAppendRead2D2x4" "BP5")
+set_tests_properties(Engine.BP.BPWriteAppendReadTestADIOS2.ADIOS2BPWriteAppendRead2D2x4.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;49;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;290;bp4_bp5_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteAppendReadTestADIOS2.ADIOS2BPWriteAppendReadAggregate.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteAppendReadADIOS2.Serial" "--gtest_filter=BPWriteAppendReadTestADIOS2.ADIOS2BPWriteAppendReadAggregate" "BP5")
+set_tests_properties(Engine.BP.BPWriteAppendReadTestADIOS2.ADIOS2BPWriteAppendReadAggregate.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;49;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;290;bp4_bp5_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPWriteAppendReadTestADIOS2.ADIOS2BPWriteAppendReadVaryingAggregation.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteAppendReadADIOS2.Serial" "--gtest_filter=BPWriteAppendReadTestADIOS2.ADIOS2BPWriteAppendReadVaryingAggregation" "BP5")
+set_tests_properties(Engine.BP.BPWriteAppendReadTestADIOS2.ADIOS2BPWriteAppendReadVaryingAggregation.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;49;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;290;bp4_bp5_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPJoinedArray.MultiBlock.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.JoinedArray.Serial" "--gtest_filter=BPJoinedArray.MultiBlock" "BP4")
+set_tests_properties(Engine.BP.BPJoinedArray.MultiBlock.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;46;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;291;bp4_bp5_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPJoinedArray.MultiBlock.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.JoinedArray.Serial" "--gtest_filter=BPJoinedArray.MultiBlock" "BP5")
+set_tests_properties(Engine.BP.BPJoinedArray.MultiBlock.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;49;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;291;bp4_bp5_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPOpenWithMetadata.ADIOS2BPOpenWithMetadata.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.OpenWithMetadata.Serial" "--gtest_filter=BPOpenWithMetadata.ADIOS2BPOpenWithMetadata" "BP4")
+set_tests_properties(Engine.BP.BPOpenWithMetadata.ADIOS2BPOpenWithMetadata.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;46;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;292;bp4_bp5_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.BPOpenWithMetadata.ADIOS2BPOpenWithMetadata.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.OpenWithMetadata.Serial" "--gtest_filter=BPOpenWithMetadata.ADIOS2BPOpenWithMetadata" "BP5")
+set_tests_properties(Engine.BP.BPOpenWithMetadata.ADIOS2BPOpenWithMetadata.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;49;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;292;bp4_bp5_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.*/BPStepsInSituGlobalArrayReaders.EveryStep/*.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.StepsInSituGlobalArray.Serial" "--gtest_filter=*/BPStepsInSituGlobalArrayReaders.EveryStep/*" "BP4")
+set_tests_properties(Engine.BP.*/BPStepsInSituGlobalArrayReaders.EveryStep/*.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;298;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.*/BPStepsInSituGlobalArrayReaders.NewVarPerStep/*.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.StepsInSituGlobalArray.Serial" "--gtest_filter=*/BPStepsInSituGlobalArrayReaders.NewVarPerStep/*" "BP4")
+set_tests_properties(Engine.BP.*/BPStepsInSituGlobalArrayReaders.NewVarPerStep/*.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;298;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.*/BPStepsInSituGlobalArrayParameters.EveryOtherStep/*.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.StepsInSituGlobalArray.Serial" "--gtest_filter=*/BPStepsInSituGlobalArrayParameters.EveryOtherStep/*" "BP4")
+set_tests_properties(Engine.BP.*/BPStepsInSituGlobalArrayParameters.EveryOtherStep/*.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;298;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.*/BPStepsInSituLocalArrayReaders.EveryStep/*.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.StepsInSituLocalArray.Serial" "--gtest_filter=*/BPStepsInSituLocalArrayReaders.EveryStep/*" "BP4")
+set_tests_properties(Engine.BP.*/BPStepsInSituLocalArrayReaders.EveryStep/*.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;301;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.*/BPStepsInSituLocalArrayReaders.NewVarPerStep/*.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.StepsInSituLocalArray.Serial" "--gtest_filter=*/BPStepsInSituLocalArrayReaders.NewVarPerStep/*" "BP4")
+set_tests_properties(Engine.BP.*/BPStepsInSituLocalArrayReaders.NewVarPerStep/*.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;301;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.*/BPStepsInSituLocalArrayParameters.EveryOtherStep/*.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.StepsInSituLocalArray.Serial" "--gtest_filter=*/BPStepsInSituLocalArrayParameters.EveryOtherStep/*" "BP4")
+set_tests_properties(Engine.BP.*/BPStepsInSituLocalArrayParameters.EveryOtherStep/*.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;301;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.ADIOSInquireVariableException.Read.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.InquireVariableException.Serial" "--gtest_filter=ADIOSInquireVariableException.Read" "BP4")
+set_tests_properties(Engine.BP.ADIOSInquireVariableException.Read.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;309;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.ADIOSInquireDefineTest.Read.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.InquireDefine.Serial" "--gtest_filter=ADIOSInquireDefineTest.Read" "BP5")
+set_tests_properties(Engine.BP.ADIOSInquireDefineTest.Read.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;313;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.ADIOSInquireDefineTest.Read.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.InquireDefine.Serial" "--gtest_filter=ADIOSInquireDefineTest.Read" "BP4")
+set_tests_properties(Engine.BP.ADIOSInquireDefineTest.Read.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;317;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.*/BPStepsInSituGlobalArrayReaders.EveryStep/*.FileStream.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.StepsInSituGlobalArray.Serial" "--gtest_filter=*/BPStepsInSituGlobalArrayReaders.EveryStep/*" "FileStream")
+set_tests_properties(Engine.BP.*/BPStepsInSituGlobalArrayReaders.EveryStep/*.FileStream.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/filestream" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;322;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.*/BPStepsInSituGlobalArrayReaders.NewVarPerStep/*.FileStream.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.StepsInSituGlobalArray.Serial" "--gtest_filter=*/BPStepsInSituGlobalArrayReaders.NewVarPerStep/*" "FileStream")
+set_tests_properties(Engine.BP.*/BPStepsInSituGlobalArrayReaders.NewVarPerStep/*.FileStream.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/filestream" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;322;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.*/BPStepsInSituGlobalArrayParameters.EveryOtherStep/*.FileStream.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.StepsInSituGlobalArray.Serial" "--gtest_filter=*/BPStepsInSituGlobalArrayParameters.EveryOtherStep/*" "FileStream")
+set_tests_properties(Engine.BP.*/BPStepsInSituGlobalArrayParameters.EveryOtherStep/*.FileStream.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/filestream" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;322;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.*/BPStepsInSituLocalArrayReaders.EveryStep/*.FileStream.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.StepsInSituLocalArray.Serial" "--gtest_filter=*/BPStepsInSituLocalArrayReaders.EveryStep/*" "FileStream")
+set_tests_properties(Engine.BP.*/BPStepsInSituLocalArrayReaders.EveryStep/*.FileStream.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/filestream" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;325;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.*/BPStepsInSituLocalArrayReaders.NewVarPerStep/*.FileStream.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.StepsInSituLocalArray.Serial" "--gtest_filter=*/BPStepsInSituLocalArrayReaders.NewVarPerStep/*" "FileStream")
+set_tests_properties(Engine.BP.*/BPStepsInSituLocalArrayReaders.NewVarPerStep/*.FileStream.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/filestream" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;325;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+add_test(Engine.BP.*/BPStepsInSituLocalArrayParameters.EveryOtherStep/*.FileStream.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.StepsInSituLocalArray.Serial" "--gtest_filter=*/BPStepsInSituLocalArrayParameters.EveryOtherStep/*" "FileStream")
+set_tests_properties(Engine.BP.*/BPStepsInSituLocalArrayParameters.EveryOtherStep/*.FileStream.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/filestream" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;325;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;0;")
+subdirs("operations")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../../bin/Test.Engine.BP.WriteReadPNG.Serial"
+  "../../../../../bin/Test.Engine.BP.WriteReadPNG.Serial.pdb"
+  "CMakeFiles/Test.Engine.BP.WriteReadPNG.Serial.dir/TestBPWriteReadPNG.cpp.o"
+  "CMakeFiles/Test.Engine.BP.WriteReadPNG.Serial.dir/TestBPWriteReadPNG.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test.Engine.BP.WriteReadPNG.Serial.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,60 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/testing/adios2/engine/bp/operations
+# Build directory: /root/repo/_derived_build/testing/adios2/engine/bp/operations
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(Engine.BP.*/BPWriteReadBZIP2.ADIOS2BPWriteReadBZIP21D/*.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadBZIP2.Serial" "--gtest_filter=*/BPWriteReadBZIP2.ADIOS2BPWriteReadBZIP21D/*" "BP3")
+set_tests_properties(Engine.BP.*/BPWriteReadBZIP2.ADIOS2BPWriteReadBZIP21D/*.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/operations/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/operations/CMakeLists.txt;72;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/operations/CMakeLists.txt;0;")
+add_test(Engine.BP.*/BPWriteReadBZIP2.ADIOS2BPWriteReadBZIP21DLocal/*.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadBZIP2.Serial" "--gtest_filter=*/BPWriteReadBZIP2.ADIOS2BPWriteReadBZIP21DLocal/*" "BP3")
+set_tests_properties(Engine.BP.*/BPWriteReadBZIP2.ADIOS2BPWriteReadBZIP21DLocal/*.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/operations/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/operations/CMakeLists.txt;72;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/operations/CMakeLists.txt;0;")
+add_test(Engine.BP.*/BPWriteReadBZIP2.ADIOS2BPWriteReadBZIP22D/*.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadBZIP2.Serial" "--gtest_filter=*/BPWriteReadBZIP2.ADIOS2BPWriteReadBZIP22D/*" "BP3")
+set_tests_properties(Engine.BP.*/BPWriteReadBZIP2.ADIOS2BPWriteReadBZIP22D/*.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/operations/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/operations/CMakeLists.txt;72;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/operations/CMakeLists.txt;0;")
+add_test(Engine.BP.*/BPWriteReadBZIP2.ADIOS2BPWriteReadBZIP23D/*.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadBZIP2.Serial" "--gtest_filter=*/BPWriteReadBZIP2.ADIOS2BPWriteReadBZIP23D/*" "BP3")
+set_tests_properties(Engine.BP.*/BPWriteReadBZIP2.ADIOS2BPWriteReadBZIP23D/*.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/operations/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/operations/CMakeLists.txt;72;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/operations/CMakeLists.txt;0;")
+add_test(Engine.BP.*/BPWriteReadBZIP2.ADIOS2BPWriteReadBZIP21DSel/*.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadBZIP2.Serial" "--gtest_filter=*/BPWriteReadBZIP2.ADIOS2BPWriteReadBZIP21DSel/*" "BP3")
+set_tests_properties(Engine.BP.*/BPWriteReadBZIP2.ADIOS2BPWriteReadBZIP21DSel/*.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/operations/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/operations/CMakeLists.txt;72;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/operations/CMakeLists.txt;0;")
+add_test(Engine.BP.*/BPWriteReadBZIP2.ADIOS2BPWriteReadBZIP22DSel/*.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadBZIP2.Serial" "--gtest_filter=*/BPWriteReadBZIP2.ADIOS2BPWriteReadBZIP22DSel/*" "BP3")
+set_tests_properties(Engine.BP.*/BPWriteReadBZIP2.ADIOS2BPWriteReadBZIP22DSel/*.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/operations/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/operations/CMakeLists.txt;72;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/operations/CMakeLists.txt;0;")
+add_test(Engine.BP.*/BPWriteReadBZIP2.ADIOS2BPWriteReadBZIP23DSel/*.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadBZIP2.Serial" "--gtest_filter=*/BPWriteReadBZIP2.ADIOS2BPWriteReadBZIP23DSel/*" "BP3")
+set_tests_properties(Engine.BP.*/BPWriteReadBZIP2.ADIOS2BPWriteReadBZIP23DSel/*.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/operations/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/operations/CMakeLists.txt;72;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/operations/CMakeLists.txt;0;")
+add_test(Engine.BP.*/BPWriteReadBZIP2.ADIOS2BPWriteReadBZIP2CompressionThreads/*.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadBZIP2.Serial" "--gtest_filter=*/BPWriteReadBZIP2.ADIOS2BPWriteReadBZIP2CompressionThreads/*" "BP3")
+set_tests_properties(Engine.BP.*/BPWriteReadBZIP2.ADIOS2BPWriteReadBZIP2CompressionThreads/*.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/operations/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/operations/CMakeLists.txt;72;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/operations/CMakeLists.txt;0;")
+add_test(Engine.BP.*/BPWriteReadBZIP2.ADIOS2BPWriteReadBZIP21D/*.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadBZIP2.Serial" "--gtest_filter=*/BPWriteReadBZIP2.ADIOS2BPWriteReadBZIP21D/*" "BP4")
+set_tests_properties(Engine.BP.*/BPWriteReadBZIP2.ADIOS2BPWriteReadBZIP21D/*.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/operations/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/operations/CMakeLists.txt;72;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/operations/CMakeLists.txt;0;")
+add_test(Engine.BP.*/BPWriteReadBZIP2.ADIOS2BPWriteReadBZIP21DLocal/*.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadBZIP2.Serial" "--gtest_filter=*/BPWriteReadBZIP2.ADIOS2BPWriteReadBZIP21DLocal/*" "BP4")
+set_tests_properties(Engine.BP.*/BPWriteReadBZIP2.ADIOS2BPWriteReadBZIP21DLocal/*.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/operations/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/operations/CMakeLists.txt;72;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/operations/CMakeLists.txt;0;")
+add_test(Engine.BP.*/BPWriteReadBZIP2.ADIOS2BPWriteReadBZIP22D/*.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadBZIP2.Serial" "--gtest_filter=*/BPWriteReadBZIP2.ADIOS2BPWriteReadBZIP22D/*" "BP4")
+set_tests_properties(Engine.BP.*/BPWriteReadBZIP2.ADIOS2BPWriteReadBZIP22D/*.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/operations/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/operations/CMakeLists.txt;72;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/operations/CMakeLists.txt;0;")
+add_test(Engine.BP.*/BPWriteReadBZIP2.ADIOS2BPWriteReadBZIP23D/*.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadBZIP2.Serial" "--gtest_filter=*/BPWriteReadBZIP2.ADIOS2BPWriteReadBZIP23D/*" "BP4")
+set_tests_properties(Engine.BP.*/BPWriteReadBZIP2.ADIOS2BPWriteReadBZIP23D/*.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/operations/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/operations/CMakeLists.txt;72;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/operations/CMakeLists.txt;0;")
+add_test(Engine.BP.*/BPWriteReadBZIP2.ADIOS2BPWriteReadBZIP21DSel/*.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadBZIP2.Serial" "--gtest_filter=*/BPWriteReadBZIP2.ADIOS2BPWriteReadBZIP21DSel/*" "BP4")
+set_tests_properties(Engine.BP.*/BPWriteReadBZIP2.ADIOS2BPWriteReadBZIP21DSel/*.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/operations/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/operations/CMakeLists.txt;72;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/operations/CMakeLists.txt;0;")
+add_test(Engine.BP.*/BPWriteReadBZIP2.ADIOS2BPWriteReadBZIP22DSel/*.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadBZIP2.Serial" "--gtest_filter=*/BPWriteReadBZIP2.ADIOS2BPWriteReadBZIP22DSel/*" "BP4")
+set_tests_properties(Engine.BP.*/BPWriteReadBZIP2.ADIOS2BPWriteReadBZIP22DSel/*.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/operations/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/operations/CMakeLists.txt;72;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/operations/CMakeLists.txt;0;")
+add_test(Engine.BP.*/BPWriteReadBZIP2.ADIOS2BPWriteReadBZIP23DSel/*.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadBZIP2.Serial" "--gtest_filter=*/BPWriteReadBZIP2.ADIOS2BPWriteReadBZIP23DSel/*" "BP4")
+set_tests_properties(Engine.BP.*/BPWriteReadBZIP2.ADIOS2BPWriteReadBZIP23DSel/*.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/operations/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/operations/CMakeLists.txt;72;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/operations/CMakeLists.txt;0;")
+add_test(Engine.BP.*/BPWriteReadBZIP2.ADIOS2BPWriteReadBZIP2CompressionThreads/*.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadBZIP2.Serial" "--gtest_filter=*/BPWriteReadBZIP2.ADIOS2BPWriteReadBZIP2CompressionThreads/*" "BP4")
+set_tests_properties(Engine.BP.*/BPWriteReadBZIP2.ADIOS2BPWriteReadBZIP2CompressionThreads/*.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/operations/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/operations/CMakeLists.txt;72;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/operations/CMakeLists.txt;0;")
+add_test(Engine.BP.*/BPWriteReadBZIP2.ADIOS2BPWriteReadBZIP21D/*.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadBZIP2.Serial" "--gtest_filter=*/BPWriteReadBZIP2.ADIOS2BPWriteReadBZIP21D/*" "BP5")
+set_tests_properties(Engine.BP.*/BPWriteReadBZIP2.ADIOS2BPWriteReadBZIP21D/*.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/operations/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/operations/CMakeLists.txt;72;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/operations/CMakeLists.txt;0;")
+add_test(Engine.BP.*/BPWriteReadBZIP2.ADIOS2BPWriteReadBZIP21DLocal/*.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadBZIP2.Serial" "--gtest_filter=*/BPWriteReadBZIP2.ADIOS2BPWriteReadBZIP21DLocal/*" "BP5")
+set_tests_properties(Engine.BP.*/BPWriteReadBZIP2.ADIOS2BPWriteReadBZIP21DLocal/*.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/operations/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/operations/CMakeLists.txt;72;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/operations/CMakeLists.txt;0;")
+add_test(Engine.BP.*/BPWriteReadBZIP2.ADIOS2BPWriteReadBZIP22D/*.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadBZIP2.Serial" "--gtest_filter=*/BPWriteReadBZIP2.ADIOS2BPWriteReadBZIP22D/*" "BP5")
+set_tests_properties(Engine.BP.*/BPWriteReadBZIP2.ADIOS2BPWriteReadBZIP22D/*.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/operations/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/operations/CMakeLists.txt;72;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/operations/CMakeLists.txt;0;")
+add_test(Engine.BP.*/BPWriteReadBZIP2.ADIOS2BPWriteReadBZIP23D/*.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadBZIP2.Serial" "--gtest_filter=*/BPWriteReadBZIP2.ADIOS2BPWriteReadBZIP23D/*" "BP5")
+set_tests_properties(Engine.BP.*/BPWriteReadBZIP2.ADIOS2BPWriteReadBZIP23D/*.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/operations/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/operations/CMakeLists.txt;72;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/operations/CMakeLists.txt;0;")
+add_test(Engine.BP.*/BPWriteReadBZIP2.ADIOS2BPWriteReadBZIP21DSel/*.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadBZIP2.Serial" "--gtest_filter=*/BPWriteReadBZIP2.ADIOS2BPWriteReadBZIP21DSel/*" "BP5")
+set_tests_properties(Engine.BP.*/BPWriteReadBZIP2.ADIOS2BPWriteReadBZIP21DSel/*.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/operations/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/operations/CMakeLists.txt;72;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/operations/CMakeLists.txt;0;")
+add_test(Engine.BP.*/BPWriteReadBZIP2.ADIOS2BPWriteReadBZIP22DSel/*.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadBZIP2.Serial" "--gtest_filter=*/BPWriteReadBZIP2.ADIOS2BPWriteReadBZIP22DSel/*" "BP5")
+set_tests_properties(Engine.BP.*/BPWriteReadBZIP2.ADIOS2BPWriteReadBZIP22DSel/*.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/operations/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/operations/CMakeLists.txt;72;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/operations/CMakeLists.txt;0;")
+add_test(Engine.BP.*/BPWriteReadBZIP2.ADIOS2BPWriteReadBZIP23DSel/*.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadBZIP2.Serial" "--gtest_filter=*/BPWriteReadBZIP2.ADIOS2BPWriteReadBZIP23DSel/*" "BP5")
+set_tests_properties(Engine.BP.*/BPWriteReadBZIP2.ADIOS2BPWriteReadBZIP23DSel/*.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/operations/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/operations/CMakeLists.txt;72;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/operations/CMakeLists.txt;0;")
+add_test(Engine.BP.*/BPWriteReadBZIP2.ADIOS2BPWriteReadBZIP2CompressionThreads/*.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadBZIP2.Serial" "--gtest_filter=*/BPWriteReadBZIP2.ADIOS2BPWriteReadBZIP2CompressionThreads/*" "BP5")
+set_tests_properties(Engine.BP.*/BPWriteReadBZIP2.ADIOS2BPWriteReadBZIP2CompressionThreads/*.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/operations/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/operations/CMakeLists.txt;72;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/operations/CMakeLists.txt;0;")
+add_test(Engine.BP.*/BPWRPNG.BPWRPNG2D/*.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadPNG.Serial" "--gtest_filter=*/BPWRPNG.BPWRPNG2D/*" "BP3")
+set_tests_properties(Engine.BP.*/BPWRPNG.BPWRPNG2D/*.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/operations/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/operations/CMakeLists.txt;76;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/operations/CMakeLists.txt;0;")
+add_test(Engine.BP.*/BPWRPNG.BPWRPNG2D/*.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadPNG.Serial" "--gtest_filter=*/BPWRPNG.BPWRPNG2D/*" "BP4")
+set_tests_properties(Engine.BP.*/BPWRPNG.BPWRPNG2D/*.BP4.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/operations/bp4" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/operations/CMakeLists.txt;76;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/operations/CMakeLists.txt;0;")
+add_test(Engine.BP.*/BPWRPNG.BPWRPNG2D/*.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.WriteReadPNG.Serial" "--gtest_filter=*/BPWRPNG.BPWRPNG2D/*" "BP5")
+set_tests_properties(Engine.BP.*/BPWRPNG.BPWRPNG2D/*.BP5.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/bp/operations/bp5" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/operations/CMakeLists.txt;76;bp_gtest_add_tests_helper;/root/repo/testing/adios2/engine/bp/operations/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../bin/Test.Engine.Inline.WriteRead.Serial"
+  "../../../../bin/Test.Engine.Inline.WriteRead.Serial.pdb"
+  "CMakeFiles/Test.Engine.Inline.WriteRead.Serial.dir/TestInlineWriteRead.cpp.o"
+  "CMakeFiles/Test.Engine.Inline.WriteRead.Serial.dir/TestInlineWriteRead.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test.Engine.Inline.WriteRead.Serial.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
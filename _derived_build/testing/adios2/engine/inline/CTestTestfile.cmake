@@ -0,0 +1,18 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/testing/adios2/engine/inline
+# Build directory: /root/repo/_derived_build/testing/adios2/engine/inline
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(Engine.Inline.InlineWriteRead.InlineWriteRead1D8.Serial "/root/repo/_derived_build/bin/Test.Engine.Inline.WriteRead.Serial" "--gtest_filter=InlineWriteRead.InlineWriteRead1D8")
+set_tests_properties(Engine.Inline.InlineWriteRead.InlineWriteRead1D8.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/inline/CMakeLists.txt;6;gtest_add_tests_helper;/root/repo/testing/adios2/engine/inline/CMakeLists.txt;0;")
+add_test(Engine.Inline.InlineWriteRead.InlineWriteRead2D2x4.Serial "/root/repo/_derived_build/bin/Test.Engine.Inline.WriteRead.Serial" "--gtest_filter=InlineWriteRead.InlineWriteRead2D2x4")
+set_tests_properties(Engine.Inline.InlineWriteRead.InlineWriteRead2D2x4.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/inline/CMakeLists.txt;6;gtest_add_tests_helper;/root/repo/testing/adios2/engine/inline/CMakeLists.txt;0;")
+add_test(Engine.Inline.InlineWriteRead.InlineWriteReadContracts.Serial "/root/repo/_derived_build/bin/Test.Engine.Inline.WriteRead.Serial" "--gtest_filter=InlineWriteRead.InlineWriteReadContracts")
+set_tests_properties(Engine.Inline.InlineWriteRead.InlineWriteReadContracts.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/inline/CMakeLists.txt;6;gtest_add_tests_helper;/root/repo/testing/adios2/engine/inline/CMakeLists.txt;0;")
+add_test(Engine.Inline.InlineWriteRead.InlineWriteReadContracts2.Serial "/root/repo/_derived_build/bin/Test.Engine.Inline.WriteRead.Serial" "--gtest_filter=InlineWriteRead.InlineWriteReadContracts2")
+set_tests_properties(Engine.Inline.InlineWriteRead.InlineWriteReadContracts2.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/inline/CMakeLists.txt;6;gtest_add_tests_helper;/root/repo/testing/adios2/engine/inline/CMakeLists.txt;0;")
+add_test(Engine.Inline.InlineWriteRead.IOInvariants.Serial "/root/repo/_derived_build/bin/Test.Engine.Inline.WriteRead.Serial" "--gtest_filter=InlineWriteRead.IOInvariants")
+set_tests_properties(Engine.Inline.InlineWriteRead.IOInvariants.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/inline/CMakeLists.txt;6;gtest_add_tests_helper;/root/repo/testing/adios2/engine/inline/CMakeLists.txt;0;")
+add_test(Engine.Inline.InlineWriteRead.PointerArithmetic.Serial "/root/repo/_derived_build/bin/Test.Engine.Inline.WriteRead.Serial" "--gtest_filter=InlineWriteRead.PointerArithmetic")
+set_tests_properties(Engine.Inline.InlineWriteRead.PointerArithmetic.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/inline/CMakeLists.txt;6;gtest_add_tests_helper;/root/repo/testing/adios2/engine/inline/CMakeLists.txt;0;")
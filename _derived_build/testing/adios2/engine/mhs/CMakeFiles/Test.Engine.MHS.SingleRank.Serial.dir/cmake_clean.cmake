@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../bin/Test.Engine.MHS.SingleRank.Serial"
+  "../../../../bin/Test.Engine.MHS.SingleRank.Serial.pdb"
+  "CMakeFiles/Test.Engine.MHS.SingleRank.Serial.dir/TestMhsSingleRank.cpp.o"
+  "CMakeFiles/Test.Engine.MHS.SingleRank.Serial.dir/TestMhsSingleRank.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test.Engine.MHS.SingleRank.Serial.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../bin/Test.Engine.Null.WriteRead.Serial"
+  "../../../../bin/Test.Engine.Null.WriteRead.Serial.pdb"
+  "CMakeFiles/Test.Engine.Null.WriteRead.Serial.dir/TestNullWriteRead.cpp.o"
+  "CMakeFiles/Test.Engine.Null.WriteRead.Serial.dir/TestNullWriteRead.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test.Engine.Null.WriteRead.Serial.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
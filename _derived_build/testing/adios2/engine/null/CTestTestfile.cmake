@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/testing/adios2/engine/null
+# Build directory: /root/repo/_derived_build/testing/adios2/engine/null
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(Engine.Null.NullWriteReadTests.NullWriteRead1D8.Serial "/root/repo/_derived_build/bin/Test.Engine.Null.WriteRead.Serial" "--gtest_filter=NullWriteReadTests.NullWriteRead1D8")
+set_tests_properties(Engine.Null.NullWriteReadTests.NullWriteRead1D8.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/null/CMakeLists.txt;6;gtest_add_tests_helper;/root/repo/testing/adios2/engine/null/CMakeLists.txt;0;")
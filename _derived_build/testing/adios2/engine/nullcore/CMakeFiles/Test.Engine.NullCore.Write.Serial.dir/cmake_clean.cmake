@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../bin/Test.Engine.NullCore.Write.Serial"
+  "../../../../bin/Test.Engine.NullCore.Write.Serial.pdb"
+  "CMakeFiles/Test.Engine.NullCore.Write.Serial.dir/TestNullCoreWrite.cpp.o"
+  "CMakeFiles/Test.Engine.NullCore.Write.Serial.dir/TestNullCoreWrite.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test.Engine.NullCore.Write.Serial.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/testing/adios2/engine/nullcore
+# Build directory: /root/repo/_derived_build/testing/adios2/engine/nullcore
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(Engine.NullCore.NullCoreWriteTest.ADIOS2NullCoreWrite1D8.Serial "/root/repo/_derived_build/bin/Test.Engine.NullCore.Write.Serial" "--gtest_filter=NullCoreWriteTest.ADIOS2NullCoreWrite1D8")
+set_tests_properties(Engine.NullCore.NullCoreWriteTest.ADIOS2NullCoreWrite1D8.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/nullcore/CMakeLists.txt;6;gtest_add_tests_helper;/root/repo/testing/adios2/engine/nullcore/CMakeLists.txt;0;")
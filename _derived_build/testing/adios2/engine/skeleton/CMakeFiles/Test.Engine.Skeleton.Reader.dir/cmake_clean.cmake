@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../bin/Test.Engine.Skeleton.Reader"
+  "../../../../bin/Test.Engine.Skeleton.Reader.pdb"
+  "CMakeFiles/Test.Engine.Skeleton.Reader.dir/TestSkeletonReader.cpp.o"
+  "CMakeFiles/Test.Engine.Skeleton.Reader.dir/TestSkeletonReader.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test.Engine.Skeleton.Reader.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
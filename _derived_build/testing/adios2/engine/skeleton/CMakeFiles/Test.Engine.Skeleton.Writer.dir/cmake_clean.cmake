@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../bin/Test.Engine.Skeleton.Writer"
+  "../../../../bin/Test.Engine.Skeleton.Writer.pdb"
+  "CMakeFiles/Test.Engine.Skeleton.Writer.dir/TestSkeletonWriter.cpp.o"
+  "CMakeFiles/Test.Engine.Skeleton.Writer.dir/TestSkeletonWriter.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test.Engine.Skeleton.Writer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,16 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/testing/adios2/engine/skeleton
+# Build directory: /root/repo/_derived_build/testing/adios2/engine/skeleton
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(Engine.Skeleton.Writer "/root/repo/_derived_build/bin/Test.Engine.Skeleton.Writer")
+set_tests_properties(Engine.Skeleton.Writer PROPERTIES  DEPENDS "Engine.Skeleton.Setup" FIXTURES_REQUIRED "Engine.Skeleton.Writer" FIXTURES_SETUP "Engine.Skeleton.Reader;Engine.Skeleton.Writer.Validate" WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/skeleton/Engine.Skeleton" _BACKTRACE_TRIPLES "/root/repo/testing/adios2/engine/skeleton/CMakeLists.txt;24;add_test;/root/repo/testing/adios2/engine/skeleton/CMakeLists.txt;0;")
+add_test(Engine.Skeleton.Reader "/root/repo/_derived_build/bin/Test.Engine.Skeleton.Reader")
+set_tests_properties(Engine.Skeleton.Reader PROPERTIES  DEPENDS "Engine.Skeleton.Writer" FIXTURES_REQUIRED "Engine.Skeleton.Reader" FIXTURES_SETUP "Engine.Skeleton.Reader.Validate" WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/skeleton/Engine.Skeleton" _BACKTRACE_TRIPLES "/root/repo/testing/adios2/engine/skeleton/CMakeLists.txt;28;add_test;/root/repo/testing/adios2/engine/skeleton/CMakeLists.txt;0;")
+add_test(Engine.Skeleton.Setup "/usr/bin/cmake" "-DDIR_NAME=/root/repo/_derived_build/testing/adios2/engine/skeleton/Engine.Skeleton" "-P" "/root/repo/cmake/EmptyDir.cmake")
+set_tests_properties(Engine.Skeleton.Setup PROPERTIES  FIXTURES_SETUP "Engine.Skeleton.Writer" _BACKTRACE_TRIPLES "/root/repo/cmake/ADIOSFunctions.cmake;177;add_test;/root/repo/testing/adios2/engine/skeleton/CMakeLists.txt;31;SetupTestPipeline;/root/repo/testing/adios2/engine/skeleton/CMakeLists.txt;0;")
+add_test(Engine.Skeleton.Writer.Validate "/usr/bin/diff" "-u" "-w" "/root/repo/testing/adios2/engine/skeleton/TestSkeletonWriterExpectedOutput.txt" "TestSkeletonWriterOutput.txt")
+set_tests_properties(Engine.Skeleton.Writer.Validate PROPERTIES  DEPENDS "Engine.Skeleton.Writer" FIXTURES_REQUIRED "Engine.Skeleton.Writer.Validate" WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/skeleton/Engine.Skeleton" _BACKTRACE_TRIPLES "/root/repo/testing/adios2/engine/skeleton/CMakeLists.txt;33;add_test;/root/repo/testing/adios2/engine/skeleton/CMakeLists.txt;0;")
+add_test(Engine.Skeleton.Reader.Validate "/usr/bin/diff" "-u" "-w" "/root/repo/testing/adios2/engine/skeleton/TestSkeletonReaderExpectedOutput.txt" "TestSkeletonReaderOutput.txt")
+set_tests_properties(Engine.Skeleton.Reader.Validate PROPERTIES  DEPENDS "Engine.Skeleton.Reader" FIXTURES_REQUIRED "Engine.Skeleton.Reader.Validate" WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/engine/skeleton/Engine.Skeleton" _BACKTRACE_TRIPLES "/root/repo/testing/adios2/engine/skeleton/CMakeLists.txt;40;add_test;/root/repo/testing/adios2/engine/skeleton/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../bin/TestCommonClient"
+  "../../../../bin/TestCommonClient.pdb"
+  "CMakeFiles/TestCommonClient.dir/TestCommonClient.cpp.o"
+  "CMakeFiles/TestCommonClient.dir/TestCommonClient.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TestCommonClient.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
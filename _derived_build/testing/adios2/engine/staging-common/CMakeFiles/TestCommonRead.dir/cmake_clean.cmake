@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../bin/TestCommonRead"
+  "../../../../bin/TestCommonRead.pdb"
+  "CMakeFiles/TestCommonRead.dir/TestCommonRead.cpp.o"
+  "CMakeFiles/TestCommonRead.dir/TestCommonRead.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TestCommonRead.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../bin/TestCommonReadAttrs"
+  "../../../../bin/TestCommonReadAttrs.pdb"
+  "CMakeFiles/TestCommonReadAttrs.dir/TestCommonReadAttrs.cpp.o"
+  "CMakeFiles/TestCommonReadAttrs.dir/TestCommonReadAttrs.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TestCommonReadAttrs.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../bin/TestCommonReadLocal"
+  "../../../../bin/TestCommonReadLocal.pdb"
+  "CMakeFiles/TestCommonReadLocal.dir/TestCommonReadLocal.cpp.o"
+  "CMakeFiles/TestCommonReadLocal.dir/TestCommonReadLocal.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TestCommonReadLocal.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
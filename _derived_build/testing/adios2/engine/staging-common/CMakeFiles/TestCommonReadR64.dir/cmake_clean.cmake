@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../bin/TestCommonReadR64"
+  "../../../../bin/TestCommonReadR64.pdb"
+  "CMakeFiles/TestCommonReadR64.dir/TestCommonReadR64.cpp.o"
+  "CMakeFiles/TestCommonReadR64.dir/TestCommonReadR64.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TestCommonReadR64.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
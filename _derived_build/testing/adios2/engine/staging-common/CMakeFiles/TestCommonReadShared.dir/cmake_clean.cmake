@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../bin/TestCommonReadShared"
+  "../../../../bin/TestCommonReadShared.pdb"
+  "CMakeFiles/TestCommonReadShared.dir/TestCommonReadShared.cpp.o"
+  "CMakeFiles/TestCommonReadShared.dir/TestCommonReadShared.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TestCommonReadShared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../bin/TestCommonServer"
+  "../../../../bin/TestCommonServer.pdb"
+  "CMakeFiles/TestCommonServer.dir/TestCommonServer.cpp.o"
+  "CMakeFiles/TestCommonServer.dir/TestCommonServer.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TestCommonServer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../bin/TestCommonSpanRead"
+  "../../../../bin/TestCommonSpanRead.pdb"
+  "CMakeFiles/TestCommonSpanRead.dir/TestCommonSpanRead.cpp.o"
+  "CMakeFiles/TestCommonSpanRead.dir/TestCommonSpanRead.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TestCommonSpanRead.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
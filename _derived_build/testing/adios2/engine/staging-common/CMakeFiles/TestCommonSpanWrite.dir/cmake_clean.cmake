@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../bin/TestCommonSpanWrite"
+  "../../../../bin/TestCommonSpanWrite.pdb"
+  "CMakeFiles/TestCommonSpanWrite.dir/TestCommonSpanWrite.cpp.o"
+  "CMakeFiles/TestCommonSpanWrite.dir/TestCommonSpanWrite.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TestCommonSpanWrite.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../bin/TestCommonWrite"
+  "../../../../bin/TestCommonWrite.pdb"
+  "CMakeFiles/TestCommonWrite.dir/TestCommonWrite.cpp.o"
+  "CMakeFiles/TestCommonWrite.dir/TestCommonWrite.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TestCommonWrite.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
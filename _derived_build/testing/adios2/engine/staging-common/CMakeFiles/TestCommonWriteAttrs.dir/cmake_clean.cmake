@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../bin/TestCommonWriteAttrs"
+  "../../../../bin/TestCommonWriteAttrs.pdb"
+  "CMakeFiles/TestCommonWriteAttrs.dir/TestCommonWriteAttrs.cpp.o"
+  "CMakeFiles/TestCommonWriteAttrs.dir/TestCommonWriteAttrs.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TestCommonWriteAttrs.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../bin/TestCommonWriteLocal"
+  "../../../../bin/TestCommonWriteLocal.pdb"
+  "CMakeFiles/TestCommonWriteLocal.dir/TestCommonWriteLocal.cpp.o"
+  "CMakeFiles/TestCommonWriteLocal.dir/TestCommonWriteLocal.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TestCommonWriteLocal.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../bin/TestCommonWriteModes"
+  "../../../../bin/TestCommonWriteModes.pdb"
+  "CMakeFiles/TestCommonWriteModes.dir/TestCommonWriteModes.cpp.o"
+  "CMakeFiles/TestCommonWriteModes.dir/TestCommonWriteModes.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TestCommonWriteModes.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../bin/TestCommonWriteShared"
+  "../../../../bin/TestCommonWriteShared.pdb"
+  "CMakeFiles/TestCommonWriteShared.dir/TestCommonWriteShared.cpp.o"
+  "CMakeFiles/TestCommonWriteShared.dir/TestCommonWriteShared.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TestCommonWriteShared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../bin/TestDefSyncWrite"
+  "../../../../bin/TestDefSyncWrite.pdb"
+  "CMakeFiles/TestDefSyncWrite.dir/TestDefSyncWrite.cpp.o"
+  "CMakeFiles/TestDefSyncWrite.dir/TestDefSyncWrite.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TestDefSyncWrite.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../bin/TestDistributionRead"
+  "../../../../bin/TestDistributionRead.pdb"
+  "CMakeFiles/TestDistributionRead.dir/TestDistributionRead.cpp.o"
+  "CMakeFiles/TestDistributionRead.dir/TestDistributionRead.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TestDistributionRead.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
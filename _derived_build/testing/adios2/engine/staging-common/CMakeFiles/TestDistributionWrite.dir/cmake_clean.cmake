@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../bin/TestDistributionWrite"
+  "../../../../bin/TestDistributionWrite.pdb"
+  "CMakeFiles/TestDistributionWrite.dir/TestDistributionWrite.cpp.o"
+  "CMakeFiles/TestDistributionWrite.dir/TestDistributionWrite.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TestDistributionWrite.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
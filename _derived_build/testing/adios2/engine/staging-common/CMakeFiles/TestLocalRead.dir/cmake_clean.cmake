@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../bin/TestLocalRead"
+  "../../../../bin/TestLocalRead.pdb"
+  "CMakeFiles/TestLocalRead.dir/TestLocalRead.cpp.o"
+  "CMakeFiles/TestLocalRead.dir/TestLocalRead.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TestLocalRead.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../bin/TestLocalWrite"
+  "../../../../bin/TestLocalWrite.pdb"
+  "CMakeFiles/TestLocalWrite.dir/TestLocalWrite.cpp.o"
+  "CMakeFiles/TestLocalWrite.dir/TestLocalWrite.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TestLocalWrite.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../bin/TestOnDemandRead"
+  "../../../../bin/TestOnDemandRead.pdb"
+  "CMakeFiles/TestOnDemandRead.dir/TestOnDemandRead.cpp.o"
+  "CMakeFiles/TestOnDemandRead.dir/TestOnDemandRead.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TestOnDemandRead.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
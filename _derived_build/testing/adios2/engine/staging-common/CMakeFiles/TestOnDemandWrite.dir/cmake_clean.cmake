@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../bin/TestOnDemandWrite"
+  "../../../../bin/TestOnDemandWrite.pdb"
+  "CMakeFiles/TestOnDemandWrite.dir/TestOnDemandWrite.cpp.o"
+  "CMakeFiles/TestOnDemandWrite.dir/TestOnDemandWrite.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TestOnDemandWrite.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
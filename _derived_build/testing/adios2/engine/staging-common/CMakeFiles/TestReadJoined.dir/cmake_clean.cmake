@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../bin/TestReadJoined"
+  "../../../../bin/TestReadJoined.pdb"
+  "CMakeFiles/TestReadJoined.dir/TestReadJoined.cpp.o"
+  "CMakeFiles/TestReadJoined.dir/TestReadJoined.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TestReadJoined.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
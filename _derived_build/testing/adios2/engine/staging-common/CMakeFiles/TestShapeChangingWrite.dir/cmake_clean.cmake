@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../bin/TestShapeChangingWrite"
+  "../../../../bin/TestShapeChangingWrite.pdb"
+  "CMakeFiles/TestShapeChangingWrite.dir/TestShapeChangingWrite.cpp.o"
+  "CMakeFiles/TestShapeChangingWrite.dir/TestShapeChangingWrite.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TestShapeChangingWrite.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
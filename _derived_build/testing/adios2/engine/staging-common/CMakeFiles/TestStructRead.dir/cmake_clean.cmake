@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../bin/TestStructRead"
+  "../../../../bin/TestStructRead.pdb"
+  "CMakeFiles/TestStructRead.dir/TestStructRead.cpp.o"
+  "CMakeFiles/TestStructRead.dir/TestStructRead.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TestStructRead.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../bin/TestStructWrite"
+  "../../../../bin/TestStructWrite.pdb"
+  "CMakeFiles/TestStructWrite.dir/TestStructWrite.cpp.o"
+  "CMakeFiles/TestStructWrite.dir/TestStructWrite.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TestStructWrite.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
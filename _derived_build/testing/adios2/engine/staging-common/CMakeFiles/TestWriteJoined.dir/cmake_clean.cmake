@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../bin/TestWriteJoined"
+  "../../../../bin/TestWriteJoined.pdb"
+  "CMakeFiles/TestWriteJoined.dir/TestWriteJoined.cpp.o"
+  "CMakeFiles/TestWriteJoined.dir/TestWriteJoined.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TestWriteJoined.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
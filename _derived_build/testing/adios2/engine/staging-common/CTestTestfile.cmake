@@ -0,0 +1,98 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/testing/adios2/engine/staging-common
+# Build directory: /root/repo/_derived_build/testing/adios2/engine/staging-common
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(Staging.1x1.BP4 "/root/.pyenv/shims/python3" "/root/repo/_derived_build/bin/run_test.py.Release" "BP4" "Staging.1x1.BP4" "-nw" "1" "-nr" "1" "--disable_mpmd")
+set_tests_properties(Staging.1x1.BP4 PROPERTIES  PROCESSORS "2" TIMEOUT "60" _BACKTRACE_TRIPLES "/root/repo/testing/adios2/engine/staging-common/TestSupp.cmake;274;add_test;/root/repo/testing/adios2/engine/staging-common/CMakeLists.txt;229;add_common_test;/root/repo/testing/adios2/engine/staging-common/CMakeLists.txt;0;")
+add_test(Staging.1x1.Attrs.BP4 "/root/.pyenv/shims/python3" "/root/repo/_derived_build/bin/run_test.py.Release" "BP4" "Staging.1x1.Attrs.BP4" "-nw" "1" "-nr" "1" "-w" "/root/repo/_derived_build/bin/TestCommonWriteAttrs" "-r" "/root/repo/_derived_build/bin/TestCommonReadAttrs" "--disable_mpmd")
+set_tests_properties(Staging.1x1.Attrs.BP4 PROPERTIES  PROCESSORS "2" TIMEOUT "60" _BACKTRACE_TRIPLES "/root/repo/testing/adios2/engine/staging-common/TestSupp.cmake;274;add_test;/root/repo/testing/adios2/engine/staging-common/CMakeLists.txt;229;add_common_test;/root/repo/testing/adios2/engine/staging-common/CMakeLists.txt;0;")
+add_test(Staging.1x1DefSync.BP4 "/root/repo/_derived_build/bin/TestDefSyncWrite" "BP4" "Staging.1x1DefSync.BP4" "--data_size" "200" "--engine_params" "ChunkSize=500,MinDeferredSize=150" "--disable_mpmd")
+set_tests_properties(Staging.1x1DefSync.BP4 PROPERTIES  PROCESSORS "2" TIMEOUT "360" _BACKTRACE_TRIPLES "/root/repo/testing/adios2/engine/staging-common/TestSupp.cmake;274;add_test;/root/repo/testing/adios2/engine/staging-common/CMakeLists.txt;229;add_common_test;/root/repo/testing/adios2/engine/staging-common/CMakeLists.txt;0;")
+add_test(Staging.1x1.SpanMinMax.BP4 "/root/.pyenv/shims/python3" "/root/repo/_derived_build/bin/run_test.py.Release" "BP4" "Staging.1x1.SpanMinMax.BP4" "-nw" "1" "-nr" "1" "-w" "/root/repo/_derived_build/bin/TestCommonSpanWrite" "-r" "/root/repo/_derived_build/bin/TestCommonSpanRead" "--disable_mpmd")
+set_tests_properties(Staging.1x1.SpanMinMax.BP4 PROPERTIES  PROCESSORS "2" TIMEOUT "60" _BACKTRACE_TRIPLES "/root/repo/testing/adios2/engine/staging-common/TestSupp.cmake;274;add_test;/root/repo/testing/adios2/engine/staging-common/CMakeLists.txt;229;add_common_test;/root/repo/testing/adios2/engine/staging-common/CMakeLists.txt;0;")
+add_test(Staging.1x1.Local2.BP4 "/root/.pyenv/shims/python3" "/root/repo/_derived_build/bin/run_test.py.Release" "BP4" "Staging.1x1.Local2.BP4" "-nw" "1" "-nr" "1" "-w" "/root/repo/_derived_build/bin/TestLocalWrite" "-r" "/root/repo/_derived_build/bin/TestLocalRead" "--disable_mpmd")
+set_tests_properties(Staging.1x1.Local2.BP4 PROPERTIES  PROCESSORS "2" TIMEOUT "180" _BACKTRACE_TRIPLES "/root/repo/testing/adios2/engine/staging-common/TestSupp.cmake;274;add_test;/root/repo/testing/adios2/engine/staging-common/CMakeLists.txt;229;add_common_test;/root/repo/testing/adios2/engine/staging-common/CMakeLists.txt;0;")
+add_test(Staging.1x1Joined.BP4 "/root/.pyenv/shims/python3" "/root/repo/_derived_build/bin/run_test.py.Release" "BP4" "Staging.1x1Joined.BP4" "-nw" "1" "-nr" "1" "-r" "/root/repo/_derived_build/bin/TestReadJoined" "-w" "/root/repo/_derived_build/bin/TestWriteJoined" "--disable_mpmd")
+set_tests_properties(Staging.1x1Joined.BP4 PROPERTIES  PROCESSORS "2" TIMEOUT "60" _BACKTRACE_TRIPLES "/root/repo/testing/adios2/engine/staging-common/TestSupp.cmake;274;add_test;/root/repo/testing/adios2/engine/staging-common/CMakeLists.txt;229;add_common_test;/root/repo/testing/adios2/engine/staging-common/CMakeLists.txt;0;")
+add_test(Staging.1x1.BP3 "/root/.pyenv/shims/python3" "/root/repo/_derived_build/bin/run_test.py.Release" "BP3" "Staging.1x1.BP3" "-nw" "1" "-nr" "1" "--disable_mpmd")
+set_tests_properties(Staging.1x1.BP3 PROPERTIES  PROCESSORS "2" TIMEOUT "60" _BACKTRACE_TRIPLES "/root/repo/testing/adios2/engine/staging-common/TestSupp.cmake;274;add_test;/root/repo/testing/adios2/engine/staging-common/CMakeLists.txt;236;add_common_test;/root/repo/testing/adios2/engine/staging-common/CMakeLists.txt;0;")
+add_test(Staging.1x1.Attrs.BP3 "/root/.pyenv/shims/python3" "/root/repo/_derived_build/bin/run_test.py.Release" "BP3" "Staging.1x1.Attrs.BP3" "-nw" "1" "-nr" "1" "-w" "/root/repo/_derived_build/bin/TestCommonWriteAttrs" "-r" "/root/repo/_derived_build/bin/TestCommonReadAttrs" "--disable_mpmd")
+set_tests_properties(Staging.1x1.Attrs.BP3 PROPERTIES  PROCESSORS "2" TIMEOUT "60" _BACKTRACE_TRIPLES "/root/repo/testing/adios2/engine/staging-common/TestSupp.cmake;274;add_test;/root/repo/testing/adios2/engine/staging-common/CMakeLists.txt;236;add_common_test;/root/repo/testing/adios2/engine/staging-common/CMakeLists.txt;0;")
+add_test(Staging.1x1DefSync.BP3 "/root/repo/_derived_build/bin/TestDefSyncWrite" "BP3" "Staging.1x1DefSync.BP3" "--data_size" "200" "--engine_params" "ChunkSize=500,MinDeferredSize=150" "--disable_mpmd")
+set_tests_properties(Staging.1x1DefSync.BP3 PROPERTIES  PROCESSORS "2" TIMEOUT "360" _BACKTRACE_TRIPLES "/root/repo/testing/adios2/engine/staging-common/TestSupp.cmake;274;add_test;/root/repo/testing/adios2/engine/staging-common/CMakeLists.txt;236;add_common_test;/root/repo/testing/adios2/engine/staging-common/CMakeLists.txt;0;")
+add_test(Staging.1x1.SpanMinMax.BP3 "/root/.pyenv/shims/python3" "/root/repo/_derived_build/bin/run_test.py.Release" "BP3" "Staging.1x1.SpanMinMax.BP3" "-nw" "1" "-nr" "1" "-w" "/root/repo/_derived_build/bin/TestCommonSpanWrite" "-r" "/root/repo/_derived_build/bin/TestCommonSpanRead" "--disable_mpmd")
+set_tests_properties(Staging.1x1.SpanMinMax.BP3 PROPERTIES  PROCESSORS "2" TIMEOUT "60" _BACKTRACE_TRIPLES "/root/repo/testing/adios2/engine/staging-common/TestSupp.cmake;274;add_test;/root/repo/testing/adios2/engine/staging-common/CMakeLists.txt;236;add_common_test;/root/repo/testing/adios2/engine/staging-common/CMakeLists.txt;0;")
+add_test(Staging.1x1.Local2.BP3 "/root/.pyenv/shims/python3" "/root/repo/_derived_build/bin/run_test.py.Release" "BP3" "Staging.1x1.Local2.BP3" "-nw" "1" "-nr" "1" "-w" "/root/repo/_derived_build/bin/TestLocalWrite" "-r" "/root/repo/_derived_build/bin/TestLocalRead" "--disable_mpmd")
+set_tests_properties(Staging.1x1.Local2.BP3 PROPERTIES  PROCESSORS "2" TIMEOUT "180" _BACKTRACE_TRIPLES "/root/repo/testing/adios2/engine/staging-common/TestSupp.cmake;274;add_test;/root/repo/testing/adios2/engine/staging-common/CMakeLists.txt;236;add_common_test;/root/repo/testing/adios2/engine/staging-common/CMakeLists.txt;0;")
+add_test(Staging.1x1.BP5 "/root/.pyenv/shims/python3" "/root/repo/_derived_build/bin/run_test.py.Release" "BP5" "Staging.1x1.BP5" "-nw" "1" "-nr" "1" "--disable_mpmd")
+set_tests_properties(Staging.1x1.BP5 PROPERTIES  PROCESSORS "2" TIMEOUT "60" _BACKTRACE_TRIPLES "/root/repo/testing/adios2/engine/staging-common/TestSupp.cmake;274;add_test;/root/repo/testing/adios2/engine/staging-common/CMakeLists.txt;255;add_common_test;/root/repo/testing/adios2/engine/staging-common/CMakeLists.txt;0;")
+add_test(Staging.1x1.Attrs.BP5 "/root/.pyenv/shims/python3" "/root/repo/_derived_build/bin/run_test.py.Release" "BP5" "Staging.1x1.Attrs.BP5" "-nw" "1" "-nr" "1" "-w" "/root/repo/_derived_build/bin/TestCommonWriteAttrs" "-r" "/root/repo/_derived_build/bin/TestCommonReadAttrs" "--disable_mpmd")
+set_tests_properties(Staging.1x1.Attrs.BP5 PROPERTIES  PROCESSORS "2" TIMEOUT "60" _BACKTRACE_TRIPLES "/root/repo/testing/adios2/engine/staging-common/TestSupp.cmake;274;add_test;/root/repo/testing/adios2/engine/staging-common/CMakeLists.txt;255;add_common_test;/root/repo/testing/adios2/engine/staging-common/CMakeLists.txt;0;")
+add_test(Staging.1x1.ModAttrs.BP5 "/root/.pyenv/shims/python3" "/root/repo/_derived_build/bin/run_test.py.Release" "BP5" "Staging.1x1.ModAttrs.BP5" "-nw" "1" "-nr" "1" "-w" "/root/repo/_derived_build/bin/TestCommonWriteAttrs" "-r" "/root/repo/_derived_build/bin/TestCommonReadAttrs" "--rarg=--modifiable_attributes" "--warg=--modifiable_attributes" "--disable_mpmd")
+set_tests_properties(Staging.1x1.ModAttrs.BP5 PROPERTIES  PROCESSORS "2" TIMEOUT "60" _BACKTRACE_TRIPLES "/root/repo/testing/adios2/engine/staging-common/TestSupp.cmake;274;add_test;/root/repo/testing/adios2/engine/staging-common/CMakeLists.txt;255;add_common_test;/root/repo/testing/adios2/engine/staging-common/CMakeLists.txt;0;")
+add_test(Staging.1x1DefSync.BP5 "/root/repo/_derived_build/bin/TestDefSyncWrite" "BP5" "Staging.1x1DefSync.BP5" "--data_size" "200" "--engine_params" "ChunkSize=500,MinDeferredSize=150" "--disable_mpmd")
+set_tests_properties(Staging.1x1DefSync.BP5 PROPERTIES  PROCESSORS "2" TIMEOUT "360" _BACKTRACE_TRIPLES "/root/repo/testing/adios2/engine/staging-common/TestSupp.cmake;274;add_test;/root/repo/testing/adios2/engine/staging-common/CMakeLists.txt;255;add_common_test;/root/repo/testing/adios2/engine/staging-common/CMakeLists.txt;0;")
+add_test(Staging.1x1VarDestruction.BP5 "/root/.pyenv/shims/python3" "/root/repo/_derived_build/bin/run_test.py.Release" "BP5" "Staging.1x1VarDestruction.BP5" "-nw" "1" "-nr" "1" "--rarg=--var_destruction" "--disable_mpmd")
+set_tests_properties(Staging.1x1VarDestruction.BP5 PROPERTIES  PROCESSORS "2" TIMEOUT "60" _BACKTRACE_TRIPLES "/root/repo/testing/adios2/engine/staging-common/TestSupp.cmake;274;add_test;/root/repo/testing/adios2/engine/staging-common/CMakeLists.txt;255;add_common_test;/root/repo/testing/adios2/engine/staging-common/CMakeLists.txt;0;")
+add_test(Staging.1x1.SpanMinMax.BP5 "/root/.pyenv/shims/python3" "/root/repo/_derived_build/bin/run_test.py.Release" "BP5" "Staging.1x1.SpanMinMax.BP5" "-nw" "1" "-nr" "1" "-w" "/root/repo/_derived_build/bin/TestCommonSpanWrite" "-r" "/root/repo/_derived_build/bin/TestCommonSpanRead" "--disable_mpmd")
+set_tests_properties(Staging.1x1.SpanMinMax.BP5 PROPERTIES  PROCESSORS "2" TIMEOUT "60" _BACKTRACE_TRIPLES "/root/repo/testing/adios2/engine/staging-common/TestSupp.cmake;274;add_test;/root/repo/testing/adios2/engine/staging-common/CMakeLists.txt;255;add_common_test;/root/repo/testing/adios2/engine/staging-common/CMakeLists.txt;0;")
+add_test(Staging.1x1.Local2.BP5 "/root/.pyenv/shims/python3" "/root/repo/_derived_build/bin/run_test.py.Release" "BP5" "Staging.1x1.Local2.BP5" "-nw" "1" "-nr" "1" "-w" "/root/repo/_derived_build/bin/TestLocalWrite" "-r" "/root/repo/_derived_build/bin/TestLocalRead" "--disable_mpmd")
+set_tests_properties(Staging.1x1.Local2.BP5 PROPERTIES  PROCESSORS "2" TIMEOUT "180" _BACKTRACE_TRIPLES "/root/repo/testing/adios2/engine/staging-common/TestSupp.cmake;274;add_test;/root/repo/testing/adios2/engine/staging-common/CMakeLists.txt;255;add_common_test;/root/repo/testing/adios2/engine/staging-common/CMakeLists.txt;0;")
+add_test(Staging.1x1Struct.BP5 "/root/.pyenv/shims/python3" "/root/repo/_derived_build/bin/run_test.py.Release" "BP5" "Staging.1x1Struct.BP5" "-nw" "1" "-nr" "1" "-r" "/root/repo/_derived_build/bin/TestStructRead" "-w" "/root/repo/_derived_build/bin/TestStructWrite" "--disable_mpmd")
+set_tests_properties(Staging.1x1Struct.BP5 PROPERTIES  PROCESSORS "2" TIMEOUT "60" _BACKTRACE_TRIPLES "/root/repo/testing/adios2/engine/staging-common/TestSupp.cmake;274;add_test;/root/repo/testing/adios2/engine/staging-common/CMakeLists.txt;255;add_common_test;/root/repo/testing/adios2/engine/staging-common/CMakeLists.txt;0;")
+add_test(Staging.1x1Joined.BP5 "/root/.pyenv/shims/python3" "/root/repo/_derived_build/bin/run_test.py.Release" "BP5" "Staging.1x1Joined.BP5" "-nw" "1" "-nr" "1" "-r" "/root/repo/_derived_build/bin/TestReadJoined" "-w" "/root/repo/_derived_build/bin/TestWriteJoined" "--disable_mpmd")
+set_tests_properties(Staging.1x1Joined.BP5 PROPERTIES  PROCESSORS "2" TIMEOUT "60" _BACKTRACE_TRIPLES "/root/repo/testing/adios2/engine/staging-common/TestSupp.cmake;274;add_test;/root/repo/testing/adios2/engine/staging-common/CMakeLists.txt;255;add_common_test;/root/repo/testing/adios2/engine/staging-common/CMakeLists.txt;0;")
+add_test(Staging.TimeoutReader.1x1.BP5 "/root/.pyenv/shims/python3" "/root/repo/_derived_build/bin/run_test.py.Release" "BP5" "Staging.TimeoutReader.1x1.BP5" "--test_protocol" "one_client" "-nw" "1" "-nr" "1" "--rarg=--non_blocking" "--warg=--ms_delay" "--warg=2000" "--disable_mpmd")
+set_tests_properties(Staging.TimeoutReader.1x1.BP5 PROPERTIES  PROCESSORS "2" TIMEOUT "60" _BACKTRACE_TRIPLES "/root/repo/testing/adios2/engine/staging-common/TestSupp.cmake;274;add_test;/root/repo/testing/adios2/engine/staging-common/CMakeLists.txt;255;add_common_test;/root/repo/testing/adios2/engine/staging-common/CMakeLists.txt;0;")
+add_test(Staging.1x1.NoPreload.BP5 "/root/.pyenv/shims/python3" "/root/repo/_derived_build/bin/run_test.py.Release" "BP5" "Staging.1x1.NoPreload.BP5" "-nw" "1" "-nr" "1" "--rarg=PreloadMode=SstPreloadNone" "--disable_mpmd")
+set_tests_properties(Staging.1x1.NoPreload.BP5 PROPERTIES  PROCESSORS "2" TIMEOUT "60" _BACKTRACE_TRIPLES "/root/repo/testing/adios2/engine/staging-common/TestSupp.cmake;274;add_test;/root/repo/testing/adios2/engine/staging-common/CMakeLists.txt;255;add_common_test;/root/repo/testing/adios2/engine/staging-common/CMakeLists.txt;0;")
+add_test(Staging.1x1.ForcePreload.BP5 "/root/.pyenv/shims/python3" "/root/repo/_derived_build/bin/run_test.py.Release" "BP5" "Staging.1x1.ForcePreload.BP5" "-nw" "1" "-nr" "1" "--rarg=PreloadMode=SstPreloadOn" "--disable_mpmd")
+set_tests_properties(Staging.1x1.ForcePreload.BP5 PROPERTIES  PROCESSORS "2" TIMEOUT "60" _BACKTRACE_TRIPLES "/root/repo/testing/adios2/engine/staging-common/TestSupp.cmake;274;add_test;/root/repo/testing/adios2/engine/staging-common/CMakeLists.txt;255;add_common_test;/root/repo/testing/adios2/engine/staging-common/CMakeLists.txt;0;")
+add_test(Staging.1x1LockGeometry.BP5 "/root/.pyenv/shims/python3" "/root/repo/_derived_build/bin/run_test.py.Release" "BP5" "Staging.1x1LockGeometry.BP5" "-nw" "1" "-nr" "1" "--warg=--num_steps" "--warg=101" "--warg=--nx" "--warg=50" "--rarg=--num_steps" "--rarg=101" "--warg=--lock_geometry" "--rarg=--lock_geometry" "--rarg=PreloadMode=SstPreloadNone" "--disable_mpmd")
+set_tests_properties(Staging.1x1LockGeometry.BP5 PROPERTIES  PROCESSORS "2" TIMEOUT "60" _BACKTRACE_TRIPLES "/root/repo/testing/adios2/engine/staging-common/TestSupp.cmake;274;add_test;/root/repo/testing/adios2/engine/staging-common/CMakeLists.txt;255;add_common_test;/root/repo/testing/adios2/engine/staging-common/CMakeLists.txt;0;")
+add_test(Staging.1x1DataWrite.BP5 "/root/repo/_derived_build/bin/TestDefSyncWrite" "BP5" "Staging.1x1DataWrite.BP5" "--flush" "--data_size" "200" "--engine_params" "ChunkSize=500,MinDeferredSize=150" "--disable_mpmd")
+set_tests_properties(Staging.1x1DataWrite.BP5 PROPERTIES  PROCESSORS "2" TIMEOUT "360" _BACKTRACE_TRIPLES "/root/repo/testing/adios2/engine/staging-common/TestSupp.cmake;274;add_test;/root/repo/testing/adios2/engine/staging-common/CMakeLists.txt;255;add_common_test;/root/repo/testing/adios2/engine/staging-common/CMakeLists.txt;0;")
+add_test(Staging.1x1.ShapeChange.BP5 "/root/.pyenv/shims/python3" "/root/repo/_derived_build/bin/run_test.py.Release" "BP5" "Staging.1x1.ShapeChange.BP5" "-nw" "1" "-nr" "1" "-w" "/root/repo/_derived_build/bin/TestShapeChangingWrite" "--disable_mpmd")
+set_tests_properties(Staging.1x1.ShapeChange.BP5 PROPERTIES  PROCESSORS "2" TIMEOUT "60" _BACKTRACE_TRIPLES "/root/repo/testing/adios2/engine/staging-common/TestSupp.cmake;274;add_test;/root/repo/testing/adios2/engine/staging-common/CMakeLists.txt;255;add_common_test;/root/repo/testing/adios2/engine/staging-common/CMakeLists.txt;0;")
+add_test(Staging.1x1.BPS.BP4_stream "/root/.pyenv/shims/python3" "/root/repo/_derived_build/bin/run_test.py.Release" "BP4_stream" "Staging.1x1.BPS.BP4_stream" "-nw" "1" "-nr" "1" "--rarg=OpenTimeoutSecs=10,BeginStepPollingFrequencySecs=0.1" "--disable_mpmd")
+set_tests_properties(Staging.1x1.BPS.BP4_stream PROPERTIES  PROCESSORS "2" TIMEOUT "60" _BACKTRACE_TRIPLES "/root/repo/testing/adios2/engine/staging-common/TestSupp.cmake;274;add_test;/root/repo/testing/adios2/engine/staging-common/CMakeLists.txt;304;add_common_test;/root/repo/testing/adios2/engine/staging-common/CMakeLists.txt;0;")
+add_test(Staging.1x1.Attrs.BPS.BP4_stream "/root/.pyenv/shims/python3" "/root/repo/_derived_build/bin/run_test.py.Release" "BP4_stream" "Staging.1x1.Attrs.BPS.BP4_stream" "-nw" "1" "-nr" "1" "-w" "/root/repo/_derived_build/bin/TestCommonWriteAttrs" "-r" "/root/repo/_derived_build/bin/TestCommonReadAttrs" "--rarg=OpenTimeoutSecs=10,BeginStepPollingFrequencySecs=0.1" "--disable_mpmd")
+set_tests_properties(Staging.1x1.Attrs.BPS.BP4_stream PROPERTIES  PROCESSORS "2" TIMEOUT "60" _BACKTRACE_TRIPLES "/root/repo/testing/adios2/engine/staging-common/TestSupp.cmake;274;add_test;/root/repo/testing/adios2/engine/staging-common/CMakeLists.txt;304;add_common_test;/root/repo/testing/adios2/engine/staging-common/CMakeLists.txt;0;")
+add_test(Staging.1x1.SpanMinMax.BPS.BP4_stream "/root/.pyenv/shims/python3" "/root/repo/_derived_build/bin/run_test.py.Release" "BP4_stream" "Staging.1x1.SpanMinMax.BPS.BP4_stream" "-nw" "1" "-nr" "1" "-w" "/root/repo/_derived_build/bin/TestCommonSpanWrite" "-r" "/root/repo/_derived_build/bin/TestCommonSpanRead" "--rarg=OpenTimeoutSecs=10,BeginStepPollingFrequencySecs=0.1" "--disable_mpmd")
+set_tests_properties(Staging.1x1.SpanMinMax.BPS.BP4_stream PROPERTIES  PROCESSORS "2" TIMEOUT "60" _BACKTRACE_TRIPLES "/root/repo/testing/adios2/engine/staging-common/TestSupp.cmake;274;add_test;/root/repo/testing/adios2/engine/staging-common/CMakeLists.txt;304;add_common_test;/root/repo/testing/adios2/engine/staging-common/CMakeLists.txt;0;")
+add_test(Staging.1x1.Local2.BPS.BP4_stream "/root/.pyenv/shims/python3" "/root/repo/_derived_build/bin/run_test.py.Release" "BP4_stream" "Staging.1x1.Local2.BPS.BP4_stream" "-nw" "1" "-nr" "1" "-w" "/root/repo/_derived_build/bin/TestLocalWrite" "-r" "/root/repo/_derived_build/bin/TestLocalRead" "--rarg=OpenTimeoutSecs=10,BeginStepPollingFrequencySecs=0.1" "--disable_mpmd")
+set_tests_properties(Staging.1x1.Local2.BPS.BP4_stream PROPERTIES  PROCESSORS "2" TIMEOUT "180" _BACKTRACE_TRIPLES "/root/repo/testing/adios2/engine/staging-common/TestSupp.cmake;274;add_test;/root/repo/testing/adios2/engine/staging-common/CMakeLists.txt;304;add_common_test;/root/repo/testing/adios2/engine/staging-common/CMakeLists.txt;0;")
+add_test(Staging.1x1LockGeometry.BPS.BP4_stream "/root/.pyenv/shims/python3" "/root/repo/_derived_build/bin/run_test.py.Release" "BP4_stream" "Staging.1x1LockGeometry.BPS.BP4_stream" "-nw" "1" "-nr" "1" "--warg=--num_steps" "--warg=101" "--warg=--nx" "--warg=50" "--rarg=--num_steps" "--rarg=101" "--warg=--lock_geometry" "--rarg=--lock_geometry" "--rarg=PreloadMode=SstPreloadNone,OpenTimeoutSecs=10,BeginStepPollingFrequencySecs=0.1" "--disable_mpmd")
+set_tests_properties(Staging.1x1LockGeometry.BPS.BP4_stream PROPERTIES  PROCESSORS "2" TIMEOUT "60" _BACKTRACE_TRIPLES "/root/repo/testing/adios2/engine/staging-common/TestSupp.cmake;274;add_test;/root/repo/testing/adios2/engine/staging-common/CMakeLists.txt;304;add_common_test;/root/repo/testing/adios2/engine/staging-common/CMakeLists.txt;0;")
+add_test(Staging.1x1.BPS.BB.BP4_stream "/root/.pyenv/shims/python3" "/root/repo/_derived_build/bin/run_test.py.Release" "BP4_stream" "Staging.1x1.BPS.BB.BP4_stream" "-nw" "1" "-nr" "1" "--rarg=OpenTimeoutSecs=10,BeginStepPollingFrequencySecs=0.1" "--warg=BurstBufferPath=bb,BurstBufferVerbose=2" "--disable_mpmd")
+set_tests_properties(Staging.1x1.BPS.BB.BP4_stream PROPERTIES  PROCESSORS "2" TIMEOUT "60" _BACKTRACE_TRIPLES "/root/repo/testing/adios2/engine/staging-common/TestSupp.cmake;274;add_test;/root/repo/testing/adios2/engine/staging-common/CMakeLists.txt;310;add_common_test;/root/repo/testing/adios2/engine/staging-common/CMakeLists.txt;0;")
+add_test(Staging.1x1.Attrs.BPS.BB.BP4_stream "/root/.pyenv/shims/python3" "/root/repo/_derived_build/bin/run_test.py.Release" "BP4_stream" "Staging.1x1.Attrs.BPS.BB.BP4_stream" "-nw" "1" "-nr" "1" "-w" "/root/repo/_derived_build/bin/TestCommonWriteAttrs" "-r" "/root/repo/_derived_build/bin/TestCommonReadAttrs" "--rarg=OpenTimeoutSecs=10,BeginStepPollingFrequencySecs=0.1" "--warg=BurstBufferPath=bb,BurstBufferVerbose=2" "--disable_mpmd")
+set_tests_properties(Staging.1x1.Attrs.BPS.BB.BP4_stream PROPERTIES  PROCESSORS "2" TIMEOUT "60" _BACKTRACE_TRIPLES "/root/repo/testing/adios2/engine/staging-common/TestSupp.cmake;274;add_test;/root/repo/testing/adios2/engine/staging-common/CMakeLists.txt;310;add_common_test;/root/repo/testing/adios2/engine/staging-common/CMakeLists.txt;0;")
+add_test(Staging.1x1.SpanMinMax.BPS.BB.BP4_stream "/root/.pyenv/shims/python3" "/root/repo/_derived_build/bin/run_test.py.Release" "BP4_stream" "Staging.1x1.SpanMinMax.BPS.BB.BP4_stream" "-nw" "1" "-nr" "1" "-w" "/root/repo/_derived_build/bin/TestCommonSpanWrite" "-r" "/root/repo/_derived_build/bin/TestCommonSpanRead" "--rarg=OpenTimeoutSecs=10,BeginStepPollingFrequencySecs=0.1" "--warg=BurstBufferPath=bb,BurstBufferVerbose=2" "--disable_mpmd")
+set_tests_properties(Staging.1x1.SpanMinMax.BPS.BB.BP4_stream PROPERTIES  PROCESSORS "2" TIMEOUT "60" _BACKTRACE_TRIPLES "/root/repo/testing/adios2/engine/staging-common/TestSupp.cmake;274;add_test;/root/repo/testing/adios2/engine/staging-common/CMakeLists.txt;310;add_common_test;/root/repo/testing/adios2/engine/staging-common/CMakeLists.txt;0;")
+add_test(Staging.1x1.Local2.BPS.BB.BP4_stream "/root/.pyenv/shims/python3" "/root/repo/_derived_build/bin/run_test.py.Release" "BP4_stream" "Staging.1x1.Local2.BPS.BB.BP4_stream" "-nw" "1" "-nr" "1" "-w" "/root/repo/_derived_build/bin/TestLocalWrite" "-r" "/root/repo/_derived_build/bin/TestLocalRead" "--rarg=OpenTimeoutSecs=10,BeginStepPollingFrequencySecs=0.1" "--warg=BurstBufferPath=bb,BurstBufferVerbose=2" "--disable_mpmd")
+set_tests_properties(Staging.1x1.Local2.BPS.BB.BP4_stream PROPERTIES  PROCESSORS "2" TIMEOUT "180" _BACKTRACE_TRIPLES "/root/repo/testing/adios2/engine/staging-common/TestSupp.cmake;274;add_test;/root/repo/testing/adios2/engine/staging-common/CMakeLists.txt;310;add_common_test;/root/repo/testing/adios2/engine/staging-common/CMakeLists.txt;0;")
+add_test(Staging.1x1LockGeometry.BPS.BB.BP4_stream "/root/.pyenv/shims/python3" "/root/repo/_derived_build/bin/run_test.py.Release" "BP4_stream" "Staging.1x1LockGeometry.BPS.BB.BP4_stream" "-nw" "1" "-nr" "1" "--warg=--num_steps" "--warg=101" "--warg=--nx" "--warg=50" "--rarg=--num_steps" "--rarg=101" "--warg=--lock_geometry" "--rarg=--lock_geometry" "--rarg=PreloadMode=SstPreloadNone,OpenTimeoutSecs=10,BeginStepPollingFrequencySecs=0.1" "--warg=BurstBufferPath=bb,BurstBufferVerbose=2" "--disable_mpmd")
+set_tests_properties(Staging.1x1LockGeometry.BPS.BB.BP4_stream PROPERTIES  PROCESSORS "2" TIMEOUT "60" _BACKTRACE_TRIPLES "/root/repo/testing/adios2/engine/staging-common/TestSupp.cmake;274;add_test;/root/repo/testing/adios2/engine/staging-common/CMakeLists.txt;310;add_common_test;/root/repo/testing/adios2/engine/staging-common/CMakeLists.txt;0;")
+add_test(Staging.1x1.FS.FileStream "/root/.pyenv/shims/python3" "/root/repo/_derived_build/bin/run_test.py.Release" "FileStream" "Staging.1x1.FS.FileStream" "-nw" "1" "-nr" "1" "--rarg=OpenTimeoutSecs=10,BeginStepPollingFrequencySecs=0.1" "--disable_mpmd")
+set_tests_properties(Staging.1x1.FS.FileStream PROPERTIES  PROCESSORS "2" TIMEOUT "60" _BACKTRACE_TRIPLES "/root/repo/testing/adios2/engine/staging-common/TestSupp.cmake;274;add_test;/root/repo/testing/adios2/engine/staging-common/CMakeLists.txt;344;add_common_test;/root/repo/testing/adios2/engine/staging-common/CMakeLists.txt;0;")
+add_test(Staging.1x1.Attrs.FS.FileStream "/root/.pyenv/shims/python3" "/root/repo/_derived_build/bin/run_test.py.Release" "FileStream" "Staging.1x1.Attrs.FS.FileStream" "-nw" "1" "-nr" "1" "-w" "/root/repo/_derived_build/bin/TestCommonWriteAttrs" "-r" "/root/repo/_derived_build/bin/TestCommonReadAttrs" "--rarg=OpenTimeoutSecs=10,BeginStepPollingFrequencySecs=0.1" "--disable_mpmd")
+set_tests_properties(Staging.1x1.Attrs.FS.FileStream PROPERTIES  PROCESSORS "2" TIMEOUT "60" _BACKTRACE_TRIPLES "/root/repo/testing/adios2/engine/staging-common/TestSupp.cmake;274;add_test;/root/repo/testing/adios2/engine/staging-common/CMakeLists.txt;344;add_common_test;/root/repo/testing/adios2/engine/staging-common/CMakeLists.txt;0;")
+add_test(Staging.1x1.ModAttrs.FS.FileStream "/root/.pyenv/shims/python3" "/root/repo/_derived_build/bin/run_test.py.Release" "FileStream" "Staging.1x1.ModAttrs.FS.FileStream" "-nw" "1" "-nr" "1" "-w" "/root/repo/_derived_build/bin/TestCommonWriteAttrs" "-r" "/root/repo/_derived_build/bin/TestCommonReadAttrs" "--rarg=--modifiable_attributes" "--warg=--modifiable_attributes" "--rarg=OpenTimeoutSecs=10,BeginStepPollingFrequencySecs=0.1" "--disable_mpmd")
+set_tests_properties(Staging.1x1.ModAttrs.FS.FileStream PROPERTIES  PROCESSORS "2" TIMEOUT "60" _BACKTRACE_TRIPLES "/root/repo/testing/adios2/engine/staging-common/TestSupp.cmake;274;add_test;/root/repo/testing/adios2/engine/staging-common/CMakeLists.txt;344;add_common_test;/root/repo/testing/adios2/engine/staging-common/CMakeLists.txt;0;")
+add_test(Staging.1x1.SpanMinMax.FS.FileStream "/root/.pyenv/shims/python3" "/root/repo/_derived_build/bin/run_test.py.Release" "FileStream" "Staging.1x1.SpanMinMax.FS.FileStream" "-nw" "1" "-nr" "1" "-w" "/root/repo/_derived_build/bin/TestCommonSpanWrite" "-r" "/root/repo/_derived_build/bin/TestCommonSpanRead" "--rarg=OpenTimeoutSecs=10,BeginStepPollingFrequencySecs=0.1" "--disable_mpmd")
+set_tests_properties(Staging.1x1.SpanMinMax.FS.FileStream PROPERTIES  PROCESSORS "2" TIMEOUT "60" _BACKTRACE_TRIPLES "/root/repo/testing/adios2/engine/staging-common/TestSupp.cmake;274;add_test;/root/repo/testing/adios2/engine/staging-common/CMakeLists.txt;344;add_common_test;/root/repo/testing/adios2/engine/staging-common/CMakeLists.txt;0;")
+add_test(Staging.1x1.Local2.FS.FileStream "/root/.pyenv/shims/python3" "/root/repo/_derived_build/bin/run_test.py.Release" "FileStream" "Staging.1x1.Local2.FS.FileStream" "-nw" "1" "-nr" "1" "-w" "/root/repo/_derived_build/bin/TestLocalWrite" "-r" "/root/repo/_derived_build/bin/TestLocalRead" "--rarg=OpenTimeoutSecs=10,BeginStepPollingFrequencySecs=0.1" "--disable_mpmd")
+set_tests_properties(Staging.1x1.Local2.FS.FileStream PROPERTIES  PROCESSORS "2" TIMEOUT "180" _BACKTRACE_TRIPLES "/root/repo/testing/adios2/engine/staging-common/TestSupp.cmake;274;add_test;/root/repo/testing/adios2/engine/staging-common/CMakeLists.txt;344;add_common_test;/root/repo/testing/adios2/engine/staging-common/CMakeLists.txt;0;")
+add_test(Staging.1x1.FS.BB.FileStream "/root/.pyenv/shims/python3" "/root/repo/_derived_build/bin/run_test.py.Release" "FileStream" "Staging.1x1.FS.BB.FileStream" "-nw" "1" "-nr" "1" "--rarg=OpenTimeoutSecs=10,BeginStepPollingFrequencySecs=0.1" "--warg=BurstBufferPath=bb,BurstBufferVerbose=2" "--disable_mpmd")
+set_tests_properties(Staging.1x1.FS.BB.FileStream PROPERTIES  PROCESSORS "2" TIMEOUT "60" _BACKTRACE_TRIPLES "/root/repo/testing/adios2/engine/staging-common/TestSupp.cmake;274;add_test;/root/repo/testing/adios2/engine/staging-common/CMakeLists.txt;349;add_common_test;/root/repo/testing/adios2/engine/staging-common/CMakeLists.txt;0;")
+add_test(Staging.1x1.Attrs.FS.BB.FileStream "/root/.pyenv/shims/python3" "/root/repo/_derived_build/bin/run_test.py.Release" "FileStream" "Staging.1x1.Attrs.FS.BB.FileStream" "-nw" "1" "-nr" "1" "-w" "/root/repo/_derived_build/bin/TestCommonWriteAttrs" "-r" "/root/repo/_derived_build/bin/TestCommonReadAttrs" "--rarg=OpenTimeoutSecs=10,BeginStepPollingFrequencySecs=0.1" "--warg=BurstBufferPath=bb,BurstBufferVerbose=2" "--disable_mpmd")
+set_tests_properties(Staging.1x1.Attrs.FS.BB.FileStream PROPERTIES  PROCESSORS "2" TIMEOUT "60" _BACKTRACE_TRIPLES "/root/repo/testing/adios2/engine/staging-common/TestSupp.cmake;274;add_test;/root/repo/testing/adios2/engine/staging-common/CMakeLists.txt;349;add_common_test;/root/repo/testing/adios2/engine/staging-common/CMakeLists.txt;0;")
+add_test(Staging.1x1.ModAttrs.FS.BB.FileStream "/root/.pyenv/shims/python3" "/root/repo/_derived_build/bin/run_test.py.Release" "FileStream" "Staging.1x1.ModAttrs.FS.BB.FileStream" "-nw" "1" "-nr" "1" "-w" "/root/repo/_derived_build/bin/TestCommonWriteAttrs" "-r" "/root/repo/_derived_build/bin/TestCommonReadAttrs" "--rarg=--modifiable_attributes" "--warg=--modifiable_attributes" "--rarg=OpenTimeoutSecs=10,BeginStepPollingFrequencySecs=0.1" "--warg=BurstBufferPath=bb,BurstBufferVerbose=2" "--disable_mpmd")
+set_tests_properties(Staging.1x1.ModAttrs.FS.BB.FileStream PROPERTIES  PROCESSORS "2" TIMEOUT "60" _BACKTRACE_TRIPLES "/root/repo/testing/adios2/engine/staging-common/TestSupp.cmake;274;add_test;/root/repo/testing/adios2/engine/staging-common/CMakeLists.txt;349;add_common_test;/root/repo/testing/adios2/engine/staging-common/CMakeLists.txt;0;")
+add_test(Staging.1x1.SpanMinMax.FS.BB.FileStream "/root/.pyenv/shims/python3" "/root/repo/_derived_build/bin/run_test.py.Release" "FileStream" "Staging.1x1.SpanMinMax.FS.BB.FileStream" "-nw" "1" "-nr" "1" "-w" "/root/repo/_derived_build/bin/TestCommonSpanWrite" "-r" "/root/repo/_derived_build/bin/TestCommonSpanRead" "--rarg=OpenTimeoutSecs=10,BeginStepPollingFrequencySecs=0.1" "--warg=BurstBufferPath=bb,BurstBufferVerbose=2" "--disable_mpmd")
+set_tests_properties(Staging.1x1.SpanMinMax.FS.BB.FileStream PROPERTIES  PROCESSORS "2" TIMEOUT "60" _BACKTRACE_TRIPLES "/root/repo/testing/adios2/engine/staging-common/TestSupp.cmake;274;add_test;/root/repo/testing/adios2/engine/staging-common/CMakeLists.txt;349;add_common_test;/root/repo/testing/adios2/engine/staging-common/CMakeLists.txt;0;")
+add_test(Staging.1x1.Local2.FS.BB.FileStream "/root/.pyenv/shims/python3" "/root/repo/_derived_build/bin/run_test.py.Release" "FileStream" "Staging.1x1.Local2.FS.BB.FileStream" "-nw" "1" "-nr" "1" "-w" "/root/repo/_derived_build/bin/TestLocalWrite" "-r" "/root/repo/_derived_build/bin/TestLocalRead" "--rarg=OpenTimeoutSecs=10,BeginStepPollingFrequencySecs=0.1" "--warg=BurstBufferPath=bb,BurstBufferVerbose=2" "--disable_mpmd")
+set_tests_properties(Staging.1x1.Local2.FS.BB.FileStream PROPERTIES  PROCESSORS "2" TIMEOUT "180" _BACKTRACE_TRIPLES "/root/repo/testing/adios2/engine/staging-common/TestSupp.cmake;274;add_test;/root/repo/testing/adios2/engine/staging-common/CMakeLists.txt;349;add_common_test;/root/repo/testing/adios2/engine/staging-common/CMakeLists.txt;0;")
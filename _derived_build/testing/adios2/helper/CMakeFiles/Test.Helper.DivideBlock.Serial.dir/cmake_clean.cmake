@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/Test.Helper.DivideBlock.Serial"
+  "../../../bin/Test.Helper.DivideBlock.Serial.pdb"
+  "CMakeFiles/Test.Helper.DivideBlock.Serial.dir/TestDivideBlock.cpp.o"
+  "CMakeFiles/Test.Helper.DivideBlock.Serial.dir/TestDivideBlock.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test.Helper.DivideBlock.Serial.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
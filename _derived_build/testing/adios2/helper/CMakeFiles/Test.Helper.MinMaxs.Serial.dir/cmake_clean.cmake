@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/Test.Helper.MinMaxs.Serial"
+  "../../../bin/Test.Helper.MinMaxs.Serial.pdb"
+  "CMakeFiles/Test.Helper.MinMaxs.Serial.dir/TestMinMaxs.cpp.o"
+  "CMakeFiles/Test.Helper.MinMaxs.Serial.dir/TestMinMaxs.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test.Helper.MinMaxs.Serial.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
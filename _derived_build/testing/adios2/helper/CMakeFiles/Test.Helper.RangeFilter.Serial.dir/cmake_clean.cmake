@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/Test.Helper.RangeFilter.Serial"
+  "../../../bin/Test.Helper.RangeFilter.Serial.pdb"
+  "CMakeFiles/Test.Helper.RangeFilter.Serial.dir/TestRangeFilter.cpp.o"
+  "CMakeFiles/Test.Helper.RangeFilter.Serial.dir/TestRangeFilter.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test.Helper.RangeFilter.Serial.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/Test.Helper.ReadNonBPFile.Serial"
+  "../../../bin/Test.Helper.ReadNonBPFile.Serial.pdb"
+  "CMakeFiles/Test.Helper.ReadNonBPFile.Serial.dir/TestReadNonBPFile.cpp.o"
+  "CMakeFiles/Test.Helper.ReadNonBPFile.Serial.dir/TestReadNonBPFile.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test.Helper.ReadNonBPFile.Serial.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
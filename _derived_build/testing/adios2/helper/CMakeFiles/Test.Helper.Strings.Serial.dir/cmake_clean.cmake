@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/Test.Helper.Strings.Serial"
+  "../../../bin/Test.Helper.Strings.Serial.pdb"
+  "CMakeFiles/Test.Helper.Strings.Serial.dir/TestHelperStrings.cpp.o"
+  "CMakeFiles/Test.Helper.Strings.Serial.dir/TestHelperStrings.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test.Helper.Strings.Serial.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
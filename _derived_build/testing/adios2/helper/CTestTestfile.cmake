@@ -0,0 +1,62 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/testing/adios2/helper
+# Build directory: /root/repo/_derived_build/testing/adios2/helper
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(Helper.ADIOS2HelperString.ADIOS2HelperStringFNF.Serial "/root/repo/_derived_build/bin/Test.Helper.Strings.Serial" "--gtest_filter=ADIOS2HelperString.ADIOS2HelperStringFNF")
+set_tests_properties(Helper.ADIOS2HelperString.ADIOS2HelperStringFNF.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/helper/CMakeLists.txt;6;gtest_add_tests_helper;/root/repo/testing/adios2/helper/CMakeLists.txt;0;")
+add_test(Helper.ADIOS2HelperString.ADIOS2HelperStringParameterMapFromVector.Serial "/root/repo/_derived_build/bin/Test.Helper.Strings.Serial" "--gtest_filter=ADIOS2HelperString.ADIOS2HelperStringParameterMapFromVector")
+set_tests_properties(Helper.ADIOS2HelperString.ADIOS2HelperStringParameterMapFromVector.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/helper/CMakeLists.txt;6;gtest_add_tests_helper;/root/repo/testing/adios2/helper/CMakeLists.txt;0;")
+add_test(Helper.ADIOS2HelperString.ADIOS2HelperStringParameterMapFromString.Serial "/root/repo/_derived_build/bin/Test.Helper.Strings.Serial" "--gtest_filter=ADIOS2HelperString.ADIOS2HelperStringParameterMapFromString")
+set_tests_properties(Helper.ADIOS2HelperString.ADIOS2HelperStringParameterMapFromString.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/helper/CMakeLists.txt;6;gtest_add_tests_helper;/root/repo/testing/adios2/helper/CMakeLists.txt;0;")
+add_test(Helper.ADIOS2HelperString.ADIOS2HelperStringAddExtension.Serial "/root/repo/_derived_build/bin/Test.Helper.Strings.Serial" "--gtest_filter=ADIOS2HelperString.ADIOS2HelperStringAddExtension")
+set_tests_properties(Helper.ADIOS2HelperString.ADIOS2HelperStringAddExtension.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/helper/CMakeLists.txt;6;gtest_add_tests_helper;/root/repo/testing/adios2/helper/CMakeLists.txt;0;")
+add_test(Helper.ADIOS2HelperString.ADIOS2HelperStringEndsWithCaseSensitive.Serial "/root/repo/_derived_build/bin/Test.Helper.Strings.Serial" "--gtest_filter=ADIOS2HelperString.ADIOS2HelperStringEndsWithCaseSensitive")
+set_tests_properties(Helper.ADIOS2HelperString.ADIOS2HelperStringEndsWithCaseSensitive.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/helper/CMakeLists.txt;6;gtest_add_tests_helper;/root/repo/testing/adios2/helper/CMakeLists.txt;0;")
+add_test(Helper.ADIOS2HelperString.ADIOS2HelperStringEndsWithCaseInsensitive.Serial "/root/repo/_derived_build/bin/Test.Helper.Strings.Serial" "--gtest_filter=ADIOS2HelperString.ADIOS2HelperStringEndsWithCaseInsensitive")
+set_tests_properties(Helper.ADIOS2HelperString.ADIOS2HelperStringEndsWithCaseInsensitive.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/helper/CMakeLists.txt;6;gtest_add_tests_helper;/root/repo/testing/adios2/helper/CMakeLists.txt;0;")
+add_test(Helper.ADIOS2HelperString.ADIOS2HelperStringConversion.Serial "/root/repo/_derived_build/bin/Test.Helper.Strings.Serial" "--gtest_filter=ADIOS2HelperString.ADIOS2HelperStringConversion")
+set_tests_properties(Helper.ADIOS2HelperString.ADIOS2HelperStringConversion.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/helper/CMakeLists.txt;6;gtest_add_tests_helper;/root/repo/testing/adios2/helper/CMakeLists.txt;0;")
+add_test(Helper.ADIOS2HelperString.ADIOS2HelperDimString.Serial "/root/repo/_derived_build/bin/Test.Helper.Strings.Serial" "--gtest_filter=ADIOS2HelperString.ADIOS2HelperDimString")
+set_tests_properties(Helper.ADIOS2HelperString.ADIOS2HelperDimString.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/helper/CMakeLists.txt;6;gtest_add_tests_helper;/root/repo/testing/adios2/helper/CMakeLists.txt;0;")
+add_test(Helper.ADIOS2HelperString.ADIOS2HelperGlobalName.Serial "/root/repo/_derived_build/bin/Test.Helper.Strings.Serial" "--gtest_filter=ADIOS2HelperString.ADIOS2HelperGlobalName")
+set_tests_properties(Helper.ADIOS2HelperString.ADIOS2HelperGlobalName.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/helper/CMakeLists.txt;6;gtest_add_tests_helper;/root/repo/testing/adios2/helper/CMakeLists.txt;0;")
+add_test(Helper.ADIOS2DivideBlock.ADIOS2DivideBlock_1D_100.Serial "/root/repo/_derived_build/bin/Test.Helper.DivideBlock.Serial" "--gtest_filter=ADIOS2DivideBlock.ADIOS2DivideBlock_1D_100")
+set_tests_properties(Helper.ADIOS2DivideBlock.ADIOS2DivideBlock_1D_100.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/helper/CMakeLists.txt;7;gtest_add_tests_helper;/root/repo/testing/adios2/helper/CMakeLists.txt;0;")
+add_test(Helper.ADIOS2DivideBlock.ADIOS2DivideBlock_2D_10x10.Serial "/root/repo/_derived_build/bin/Test.Helper.DivideBlock.Serial" "--gtest_filter=ADIOS2DivideBlock.ADIOS2DivideBlock_2D_10x10")
+set_tests_properties(Helper.ADIOS2DivideBlock.ADIOS2DivideBlock_2D_10x10.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/helper/CMakeLists.txt;7;gtest_add_tests_helper;/root/repo/testing/adios2/helper/CMakeLists.txt;0;")
+add_test(Helper.ADIOS2DivideBlock.ADIOS2DivideBlock_3D_10x10x10.Serial "/root/repo/_derived_build/bin/Test.Helper.DivideBlock.Serial" "--gtest_filter=ADIOS2DivideBlock.ADIOS2DivideBlock_3D_10x10x10")
+set_tests_properties(Helper.ADIOS2DivideBlock.ADIOS2DivideBlock_3D_10x10x10.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/helper/CMakeLists.txt;7;gtest_add_tests_helper;/root/repo/testing/adios2/helper/CMakeLists.txt;0;")
+add_test(Helper.ADIOS2DivideBlock.ADIOS2DivideBlock_3D_24x24x48.Serial "/root/repo/_derived_build/bin/Test.Helper.DivideBlock.Serial" "--gtest_filter=ADIOS2DivideBlock.ADIOS2DivideBlock_3D_24x24x48")
+set_tests_properties(Helper.ADIOS2DivideBlock.ADIOS2DivideBlock_3D_24x24x48.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/helper/CMakeLists.txt;7;gtest_add_tests_helper;/root/repo/testing/adios2/helper/CMakeLists.txt;0;")
+add_test(Helper.ADIOS2DivideBlock.ADIOS2DivideBlock_3D_3x2x5.Serial "/root/repo/_derived_build/bin/Test.Helper.DivideBlock.Serial" "--gtest_filter=ADIOS2DivideBlock.ADIOS2DivideBlock_3D_3x2x5")
+set_tests_properties(Helper.ADIOS2DivideBlock.ADIOS2DivideBlock_3D_3x2x5.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/helper/CMakeLists.txt;7;gtest_add_tests_helper;/root/repo/testing/adios2/helper/CMakeLists.txt;0;")
+add_test(Helper.ADIOS2DivideBlock.ADIOS2DivideBlock_4D_3x2x5x4.Serial "/root/repo/_derived_build/bin/Test.Helper.DivideBlock.Serial" "--gtest_filter=ADIOS2DivideBlock.ADIOS2DivideBlock_4D_3x2x5x4")
+set_tests_properties(Helper.ADIOS2DivideBlock.ADIOS2DivideBlock_4D_3x2x5x4.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/helper/CMakeLists.txt;7;gtest_add_tests_helper;/root/repo/testing/adios2/helper/CMakeLists.txt;0;")
+add_test(Helper.ADIOS2MinMaxs.ADIOS2MinMaxs_1D_100.Serial "/root/repo/_derived_build/bin/Test.Helper.MinMaxs.Serial" "--gtest_filter=ADIOS2MinMaxs.ADIOS2MinMaxs_1D_100")
+set_tests_properties(Helper.ADIOS2MinMaxs.ADIOS2MinMaxs_1D_100.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/helper/CMakeLists.txt;8;gtest_add_tests_helper;/root/repo/testing/adios2/helper/CMakeLists.txt;0;")
+add_test(Helper.ADIOS2MinMaxs.ADIOS2MinMaxs_2D_10x10.Serial "/root/repo/_derived_build/bin/Test.Helper.MinMaxs.Serial" "--gtest_filter=ADIOS2MinMaxs.ADIOS2MinMaxs_2D_10x10")
+set_tests_properties(Helper.ADIOS2MinMaxs.ADIOS2MinMaxs_2D_10x10.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/helper/CMakeLists.txt;8;gtest_add_tests_helper;/root/repo/testing/adios2/helper/CMakeLists.txt;0;")
+add_test(Helper.ADIOS2MinMaxs.ADIOS2MinMaxs_3D_10x10x10.Serial "/root/repo/_derived_build/bin/Test.Helper.MinMaxs.Serial" "--gtest_filter=ADIOS2MinMaxs.ADIOS2MinMaxs_3D_10x10x10")
+set_tests_properties(Helper.ADIOS2MinMaxs.ADIOS2MinMaxs_3D_10x10x10.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/helper/CMakeLists.txt;8;gtest_add_tests_helper;/root/repo/testing/adios2/helper/CMakeLists.txt;0;")
+add_test(Helper.ADIOS2MinMaxs.ADIOS2MinMaxs_3D_24x24x48.Serial "/root/repo/_derived_build/bin/Test.Helper.MinMaxs.Serial" "--gtest_filter=ADIOS2MinMaxs.ADIOS2MinMaxs_3D_24x24x48")
+set_tests_properties(Helper.ADIOS2MinMaxs.ADIOS2MinMaxs_3D_24x24x48.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/helper/CMakeLists.txt;8;gtest_add_tests_helper;/root/repo/testing/adios2/helper/CMakeLists.txt;0;")
+add_test(Helper.ADIOS2MinMaxs.ADIOS2MinMaxs_4D_3x2x5x4.Serial "/root/repo/_derived_build/bin/Test.Helper.MinMaxs.Serial" "--gtest_filter=ADIOS2MinMaxs.ADIOS2MinMaxs_4D_3x2x5x4")
+set_tests_properties(Helper.ADIOS2MinMaxs.ADIOS2MinMaxs_4D_3x2x5x4.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/helper/CMakeLists.txt;8;gtest_add_tests_helper;/root/repo/testing/adios2/helper/CMakeLists.txt;0;")
+add_test(Helper.ADIOS2MinMaxs.ADIOS2MinMaxs_Kernels.Serial "/root/repo/_derived_build/bin/Test.Helper.MinMaxs.Serial" "--gtest_filter=ADIOS2MinMaxs.ADIOS2MinMaxs_Kernels")
+set_tests_properties(Helper.ADIOS2MinMaxs.ADIOS2MinMaxs_Kernels.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/helper/CMakeLists.txt;8;gtest_add_tests_helper;/root/repo/testing/adios2/helper/CMakeLists.txt;0;")
+add_test(Helper.ADIOS2RangeFilter.Elements.Serial "/root/repo/_derived_build/bin/Test.Helper.RangeFilter.Serial" "--gtest_filter=ADIOS2RangeFilter.Elements")
+set_tests_properties(Helper.ADIOS2RangeFilter.Elements.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/helper/CMakeLists.txt;9;gtest_add_tests_helper;/root/repo/testing/adios2/helper/CMakeLists.txt;0;")
+add_test(Helper.ADIOS2RangeFilter.Ranges.Serial "/root/repo/_derived_build/bin/Test.Helper.RangeFilter.Serial" "--gtest_filter=ADIOS2RangeFilter.Ranges")
+set_tests_properties(Helper.ADIOS2RangeFilter.Ranges.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/helper/CMakeLists.txt;9;gtest_add_tests_helper;/root/repo/testing/adios2/helper/CMakeLists.txt;0;")
+add_test(Helper.ADIOS2RangeFilter.UnlimitedRanges.Serial "/root/repo/_derived_build/bin/Test.Helper.RangeFilter.Serial" "--gtest_filter=ADIOS2RangeFilter.UnlimitedRanges")
+set_tests_properties(Helper.ADIOS2RangeFilter.UnlimitedRanges.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/helper/CMakeLists.txt;9;gtest_add_tests_helper;/root/repo/testing/adios2/helper/CMakeLists.txt;0;")
+add_test(Helper.ADIOS2RangeFilter.InvalidSelection.Serial "/root/repo/_derived_build/bin/Test.Helper.RangeFilter.Serial" "--gtest_filter=ADIOS2RangeFilter.InvalidSelection")
+set_tests_properties(Helper.ADIOS2RangeFilter.InvalidSelection.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/helper/CMakeLists.txt;9;gtest_add_tests_helper;/root/repo/testing/adios2/helper/CMakeLists.txt;0;")
+add_test(Helper.ADIOS2ReadNonBPFile.ShortBadFile.Serial "/root/repo/_derived_build/bin/Test.Helper.ReadNonBPFile.Serial" "--gtest_filter=ADIOS2ReadNonBPFile.ShortBadFile")
+set_tests_properties(Helper.ADIOS2ReadNonBPFile.ShortBadFile.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/helper/CMakeLists.txt;10;gtest_add_tests_helper;/root/repo/testing/adios2/helper/CMakeLists.txt;0;")
+add_test(Helper.ADIOS2ReadNonBPFile.LongBadFile.Serial "/root/repo/_derived_build/bin/Test.Helper.ReadNonBPFile.Serial" "--gtest_filter=ADIOS2ReadNonBPFile.LongBadFile")
+set_tests_properties(Helper.ADIOS2ReadNonBPFile.LongBadFile.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/helper/CMakeLists.txt;10;gtest_add_tests_helper;/root/repo/testing/adios2/helper/CMakeLists.txt;0;")
+add_test(Helper.ADIOS2ReadNonBPFile.LongBadFileWithValidEndianness.Serial "/root/repo/_derived_build/bin/Test.Helper.ReadNonBPFile.Serial" "--gtest_filter=ADIOS2ReadNonBPFile.LongBadFileWithValidEndianness")
+set_tests_properties(Helper.ADIOS2ReadNonBPFile.LongBadFileWithValidEndianness.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/helper/CMakeLists.txt;10;gtest_add_tests_helper;/root/repo/testing/adios2/helper/CMakeLists.txt;0;")
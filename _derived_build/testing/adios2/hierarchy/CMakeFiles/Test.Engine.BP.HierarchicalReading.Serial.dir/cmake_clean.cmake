@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/Test.Engine.BP.HierarchicalReading.Serial"
+  "../../../bin/Test.Engine.BP.HierarchicalReading.Serial.pdb"
+  "CMakeFiles/Test.Engine.BP.HierarchicalReading.Serial.dir/TestBPHierarchicalReading.cpp.o"
+  "CMakeFiles/Test.Engine.BP.HierarchicalReading.Serial.dir/TestBPHierarchicalReading.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test.Engine.BP.HierarchicalReading.Serial.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/testing/adios2/hierarchy
+# Build directory: /root/repo/_derived_build/testing/adios2/hierarchy
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(Engine.BP.ADIOSHierarchicalReadVariableTest.Read.BP3.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.HierarchicalReading.Serial" "--gtest_filter=ADIOSHierarchicalReadVariableTest.Read" "BP3")
+set_tests_properties(Engine.BP.ADIOSHierarchicalReadVariableTest.Read.BP3.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;55;gtest_add_tests_helper;/root/repo/testing/adios2/hierarchy/CMakeLists.txt;6;bp_gtest_add_tests_helper;/root/repo/testing/adios2/hierarchy/CMakeLists.txt;0;")
+add_test(Engine.BP.ADIOSHierarchicalReadVariableTest.Read.BP4.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.HierarchicalReading.Serial" "--gtest_filter=ADIOSHierarchicalReadVariableTest.Read" "BP4")
+set_tests_properties(Engine.BP.ADIOSHierarchicalReadVariableTest.Read.BP4.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;58;gtest_add_tests_helper;/root/repo/testing/adios2/hierarchy/CMakeLists.txt;6;bp_gtest_add_tests_helper;/root/repo/testing/adios2/hierarchy/CMakeLists.txt;0;")
+add_test(Engine.BP.ADIOSHierarchicalReadVariableTest.Read.BP5.Serial "/root/repo/_derived_build/bin/Test.Engine.BP.HierarchicalReading.Serial" "--gtest_filter=ADIOSHierarchicalReadVariableTest.Read" "BP5")
+set_tests_properties(Engine.BP.ADIOSHierarchicalReadVariableTest.Read.BP5.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/engine/bp/CMakeLists.txt;61;gtest_add_tests_helper;/root/repo/testing/adios2/hierarchy/CMakeLists.txt;6;bp_gtest_add_tests_helper;/root/repo/testing/adios2/hierarchy/CMakeLists.txt;0;")
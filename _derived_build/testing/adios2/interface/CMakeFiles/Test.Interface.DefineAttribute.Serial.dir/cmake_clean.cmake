@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/Test.Interface.DefineAttribute.Serial"
+  "../../../bin/Test.Interface.DefineAttribute.Serial.pdb"
+  "CMakeFiles/Test.Interface.DefineAttribute.Serial.dir/TestADIOSDefineAttribute.cpp.o"
+  "CMakeFiles/Test.Interface.DefineAttribute.Serial.dir/TestADIOSDefineAttribute.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test.Interface.DefineAttribute.Serial.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/Test.Interface.DefineVariable.Serial"
+  "../../../bin/Test.Interface.DefineVariable.Serial.pdb"
+  "CMakeFiles/Test.Interface.DefineVariable.Serial.dir/TestADIOSDefineVariable.cpp.o"
+  "CMakeFiles/Test.Interface.DefineVariable.Serial.dir/TestADIOSDefineVariable.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test.Interface.DefineVariable.Serial.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
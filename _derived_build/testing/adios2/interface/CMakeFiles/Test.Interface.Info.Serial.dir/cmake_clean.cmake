@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/Test.Interface.Info.Serial"
+  "../../../bin/Test.Interface.Info.Serial.pdb"
+  "CMakeFiles/Test.Interface.Info.Serial.dir/TestADIOSInfo.cpp.o"
+  "CMakeFiles/Test.Interface.Info.Serial.dir/TestADIOSInfo.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test.Interface.Info.Serial.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/Test.Interface.Interface.Serial"
+  "../../../bin/Test.Interface.Interface.Serial.pdb"
+  "CMakeFiles/Test.Interface.Interface.Serial.dir/TestADIOSInterface.cpp.o"
+  "CMakeFiles/Test.Interface.Interface.Serial.dir/TestADIOSInterface.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test.Interface.Interface.Serial.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/Test.Interface.NoMpi.Serial"
+  "../../../bin/Test.Interface.NoMpi.Serial.pdb"
+  "CMakeFiles/Test.Interface.NoMpi.Serial.dir/TestADIOSNoMpi.cpp.o"
+  "CMakeFiles/Test.Interface.NoMpi.Serial.dir/TestADIOSNoMpi.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test.Interface.NoMpi.Serial.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
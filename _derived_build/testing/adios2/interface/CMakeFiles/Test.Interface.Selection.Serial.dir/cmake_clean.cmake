@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/Test.Interface.Selection.Serial"
+  "../../../bin/Test.Interface.Selection.Serial.pdb"
+  "CMakeFiles/Test.Interface.Selection.Serial.dir/TestADIOSSelection.cpp.o"
+  "CMakeFiles/Test.Interface.Selection.Serial.dir/TestADIOSSelection.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test.Interface.Selection.Serial.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/Test.Interface.Write.Serial"
+  "../../../bin/Test.Interface.Write.Serial.pdb"
+  "CMakeFiles/Test.Interface.Write.Serial.dir/TestADIOSInterfaceWrite.cpp.o"
+  "CMakeFiles/Test.Interface.Write.Serial.dir/TestADIOSInterfaceWrite.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test.Interface.Write.Serial.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
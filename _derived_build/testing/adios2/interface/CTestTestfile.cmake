@@ -0,0 +1,218 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/testing/adios2/interface
+# Build directory: /root/repo/_derived_build/testing/adios2/interface
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(Interface.ADIOSInterface.MPICommRemoved.BP3.Serial "/root/repo/_derived_build/bin/Test.Interface.Interface.Serial" "--gtest_filter=ADIOSInterface.MPICommRemoved" "BP3")
+set_tests_properties(Interface.ADIOSInterface.MPICommRemoved.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/interface/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;20;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.ADIOSInterface.BADConfigFile.BP3.Serial "/root/repo/_derived_build/bin/Test.Interface.Interface.Serial" "--gtest_filter=ADIOSInterface.BADConfigFile" "BP3")
+set_tests_properties(Interface.ADIOSInterface.BADConfigFile.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/interface/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;20;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.ADIOS2_CXX11_API.ToString.BP3.Serial "/root/repo/_derived_build/bin/Test.Interface.Interface.Serial" "--gtest_filter=ADIOS2_CXX11_API.ToString" "BP3")
+set_tests_properties(Interface.ADIOS2_CXX11_API.ToString.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/interface/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;20;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.ADIOS2_CXX11_API.APIToString.BP3.Serial "/root/repo/_derived_build/bin/Test.Interface.Interface.Serial" "--gtest_filter=ADIOS2_CXX11_API.APIToString" "BP3")
+set_tests_properties(Interface.ADIOS2_CXX11_API.APIToString.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/interface/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;20;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.ADIOS2_CXX11_API.operatorLL.BP3.Serial "/root/repo/_derived_build/bin/Test.Interface.Interface.Serial" "--gtest_filter=ADIOS2_CXX11_API.operatorLL" "BP3")
+set_tests_properties(Interface.ADIOS2_CXX11_API.operatorLL.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/interface/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;20;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.ADIOS2_CXX11_API_IO.Engine.BP3.Serial "/root/repo/_derived_build/bin/Test.Interface.Interface.Serial" "--gtest_filter=ADIOS2_CXX11_API_IO.Engine" "BP3")
+set_tests_properties(Interface.ADIOS2_CXX11_API_IO.Engine.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/interface/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;20;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.ADIOS2_CXX11_API_IO.EngineDefault.BP3.Serial "/root/repo/_derived_build/bin/Test.Interface.Interface.Serial" "--gtest_filter=ADIOS2_CXX11_API_IO.EngineDefault" "BP3")
+set_tests_properties(Interface.ADIOS2_CXX11_API_IO.EngineDefault.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/interface/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;20;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.ADIOS2_CXX11_API_MultiBlock/*.Put.BP3.Serial "/root/repo/_derived_build/bin/Test.Interface.Interface.Serial" "--gtest_filter=ADIOS2_CXX11_API_MultiBlock/*.Put" "BP3")
+set_tests_properties(Interface.ADIOS2_CXX11_API_MultiBlock/*.Put.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/interface/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;20;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.ADIOS2_CXX11_API_MultiBlock/*.PutMixed.BP3.Serial "/root/repo/_derived_build/bin/Test.Interface.Interface.Serial" "--gtest_filter=ADIOS2_CXX11_API_MultiBlock/*.PutMixed" "BP3")
+set_tests_properties(Interface.ADIOS2_CXX11_API_MultiBlock/*.PutMixed.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/interface/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;20;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.ADIOS2_CXX11_API_MultiBlock/*.PutZeroCopy.BP3.Serial "/root/repo/_derived_build/bin/Test.Interface.Interface.Serial" "--gtest_filter=ADIOS2_CXX11_API_MultiBlock/*.PutZeroCopy" "BP3")
+set_tests_properties(Interface.ADIOS2_CXX11_API_MultiBlock/*.PutZeroCopy.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/interface/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;20;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.ADIOS2_CXX11_API_MultiBlock/*.PutZeroCopyMixed.BP3.Serial "/root/repo/_derived_build/bin/Test.Interface.Interface.Serial" "--gtest_filter=ADIOS2_CXX11_API_MultiBlock/*.PutZeroCopyMixed" "BP3")
+set_tests_properties(Interface.ADIOS2_CXX11_API_MultiBlock/*.PutZeroCopyMixed.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/interface/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;20;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.ADIOS2_CXX11_API_MultiBlock/*.Put2File.BP3.Serial "/root/repo/_derived_build/bin/Test.Interface.Interface.Serial" "--gtest_filter=ADIOS2_CXX11_API_MultiBlock/*.Put2File" "BP3")
+set_tests_properties(Interface.ADIOS2_CXX11_API_MultiBlock/*.Put2File.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/interface/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;20;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.ADIOS2_CXX11_API_MultiBlock/*.Put2Writers.BP3.Serial "/root/repo/_derived_build/bin/Test.Interface.Interface.Serial" "--gtest_filter=ADIOS2_CXX11_API_MultiBlock/*.Put2Writers" "BP3")
+set_tests_properties(Interface.ADIOS2_CXX11_API_MultiBlock/*.Put2Writers.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/interface/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;20;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.ADIOSInterface.MPICommRemoved.BPfile.Serial "/root/repo/_derived_build/bin/Test.Interface.Interface.Serial" "--gtest_filter=ADIOSInterface.MPICommRemoved" "BPfile")
+set_tests_properties(Interface.ADIOSInterface.MPICommRemoved.BPfile.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/interface/bpfile" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;22;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.ADIOSInterface.BADConfigFile.BPfile.Serial "/root/repo/_derived_build/bin/Test.Interface.Interface.Serial" "--gtest_filter=ADIOSInterface.BADConfigFile" "BPfile")
+set_tests_properties(Interface.ADIOSInterface.BADConfigFile.BPfile.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/interface/bpfile" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;22;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.ADIOS2_CXX11_API.ToString.BPfile.Serial "/root/repo/_derived_build/bin/Test.Interface.Interface.Serial" "--gtest_filter=ADIOS2_CXX11_API.ToString" "BPfile")
+set_tests_properties(Interface.ADIOS2_CXX11_API.ToString.BPfile.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/interface/bpfile" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;22;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.ADIOS2_CXX11_API.APIToString.BPfile.Serial "/root/repo/_derived_build/bin/Test.Interface.Interface.Serial" "--gtest_filter=ADIOS2_CXX11_API.APIToString" "BPfile")
+set_tests_properties(Interface.ADIOS2_CXX11_API.APIToString.BPfile.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/interface/bpfile" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;22;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.ADIOS2_CXX11_API.operatorLL.BPfile.Serial "/root/repo/_derived_build/bin/Test.Interface.Interface.Serial" "--gtest_filter=ADIOS2_CXX11_API.operatorLL" "BPfile")
+set_tests_properties(Interface.ADIOS2_CXX11_API.operatorLL.BPfile.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/interface/bpfile" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;22;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.ADIOS2_CXX11_API_IO.Engine.BPfile.Serial "/root/repo/_derived_build/bin/Test.Interface.Interface.Serial" "--gtest_filter=ADIOS2_CXX11_API_IO.Engine" "BPfile")
+set_tests_properties(Interface.ADIOS2_CXX11_API_IO.Engine.BPfile.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/interface/bpfile" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;22;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.ADIOS2_CXX11_API_IO.EngineDefault.BPfile.Serial "/root/repo/_derived_build/bin/Test.Interface.Interface.Serial" "--gtest_filter=ADIOS2_CXX11_API_IO.EngineDefault" "BPfile")
+set_tests_properties(Interface.ADIOS2_CXX11_API_IO.EngineDefault.BPfile.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/interface/bpfile" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;22;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.ADIOS2_CXX11_API_MultiBlock/*.Put.BPfile.Serial "/root/repo/_derived_build/bin/Test.Interface.Interface.Serial" "--gtest_filter=ADIOS2_CXX11_API_MultiBlock/*.Put" "BPfile")
+set_tests_properties(Interface.ADIOS2_CXX11_API_MultiBlock/*.Put.BPfile.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/interface/bpfile" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;22;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.ADIOS2_CXX11_API_MultiBlock/*.PutMixed.BPfile.Serial "/root/repo/_derived_build/bin/Test.Interface.Interface.Serial" "--gtest_filter=ADIOS2_CXX11_API_MultiBlock/*.PutMixed" "BPfile")
+set_tests_properties(Interface.ADIOS2_CXX11_API_MultiBlock/*.PutMixed.BPfile.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/interface/bpfile" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;22;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.ADIOS2_CXX11_API_MultiBlock/*.PutZeroCopy.BPfile.Serial "/root/repo/_derived_build/bin/Test.Interface.Interface.Serial" "--gtest_filter=ADIOS2_CXX11_API_MultiBlock/*.PutZeroCopy" "BPfile")
+set_tests_properties(Interface.ADIOS2_CXX11_API_MultiBlock/*.PutZeroCopy.BPfile.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/interface/bpfile" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;22;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.ADIOS2_CXX11_API_MultiBlock/*.PutZeroCopyMixed.BPfile.Serial "/root/repo/_derived_build/bin/Test.Interface.Interface.Serial" "--gtest_filter=ADIOS2_CXX11_API_MultiBlock/*.PutZeroCopyMixed" "BPfile")
+set_tests_properties(Interface.ADIOS2_CXX11_API_MultiBlock/*.PutZeroCopyMixed.BPfile.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/interface/bpfile" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;22;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.ADIOS2_CXX11_API_MultiBlock/*.Put2File.BPfile.Serial "/root/repo/_derived_build/bin/Test.Interface.Interface.Serial" "--gtest_filter=ADIOS2_CXX11_API_MultiBlock/*.Put2File" "BPfile")
+set_tests_properties(Interface.ADIOS2_CXX11_API_MultiBlock/*.Put2File.BPfile.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/interface/bpfile" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;22;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.ADIOS2_CXX11_API_MultiBlock/*.Put2Writers.BPfile.Serial "/root/repo/_derived_build/bin/Test.Interface.Interface.Serial" "--gtest_filter=ADIOS2_CXX11_API_MultiBlock/*.Put2Writers" "BPfile")
+set_tests_properties(Interface.ADIOS2_CXX11_API_MultiBlock/*.Put2Writers.BPfile.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/interface/bpfile" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;22;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.ADIOSInterfaceWriteTest.DefineVar_int8_t_1x10.Serial "/root/repo/_derived_build/bin/Test.Interface.Write.Serial" "--gtest_filter=ADIOSInterfaceWriteTest.DefineVar_int8_t_1x10")
+set_tests_properties(Interface.ADIOSInterfaceWriteTest.DefineVar_int8_t_1x10.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;24;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.ADIOSInterfaceWriteTest.DefineVar_int16_t_1x10.Serial "/root/repo/_derived_build/bin/Test.Interface.Write.Serial" "--gtest_filter=ADIOSInterfaceWriteTest.DefineVar_int16_t_1x10")
+set_tests_properties(Interface.ADIOSInterfaceWriteTest.DefineVar_int16_t_1x10.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;24;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.ADIOSInterfaceWriteTest.DefineVar_int32_t_1x10.Serial "/root/repo/_derived_build/bin/Test.Interface.Write.Serial" "--gtest_filter=ADIOSInterfaceWriteTest.DefineVar_int32_t_1x10")
+set_tests_properties(Interface.ADIOSInterfaceWriteTest.DefineVar_int32_t_1x10.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;24;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.ADIOSInterfaceWriteTest.DefineVar_int64_t_1x10.Serial "/root/repo/_derived_build/bin/Test.Interface.Write.Serial" "--gtest_filter=ADIOSInterfaceWriteTest.DefineVar_int64_t_1x10")
+set_tests_properties(Interface.ADIOSInterfaceWriteTest.DefineVar_int64_t_1x10.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;24;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.ADIOSInterfaceWriteTest.DefineVar_uint8_t_1x10.Serial "/root/repo/_derived_build/bin/Test.Interface.Write.Serial" "--gtest_filter=ADIOSInterfaceWriteTest.DefineVar_uint8_t_1x10")
+set_tests_properties(Interface.ADIOSInterfaceWriteTest.DefineVar_uint8_t_1x10.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;24;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.ADIOSInterfaceWriteTest.DefineVar_uint16_t_1x10.Serial "/root/repo/_derived_build/bin/Test.Interface.Write.Serial" "--gtest_filter=ADIOSInterfaceWriteTest.DefineVar_uint16_t_1x10")
+set_tests_properties(Interface.ADIOSInterfaceWriteTest.DefineVar_uint16_t_1x10.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;24;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.ADIOSInterfaceWriteTest.DefineVar_uint32_t_1x10.Serial "/root/repo/_derived_build/bin/Test.Interface.Write.Serial" "--gtest_filter=ADIOSInterfaceWriteTest.DefineVar_uint32_t_1x10")
+set_tests_properties(Interface.ADIOSInterfaceWriteTest.DefineVar_uint32_t_1x10.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;24;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.ADIOSInterfaceWriteTest.DefineVar_uint64_t_1x10.Serial "/root/repo/_derived_build/bin/Test.Interface.Write.Serial" "--gtest_filter=ADIOSInterfaceWriteTest.DefineVar_uint64_t_1x10")
+set_tests_properties(Interface.ADIOSInterfaceWriteTest.DefineVar_uint64_t_1x10.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;24;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.ADIOSInterfaceWriteTest.DefineVar_int8_t_2x5.Serial "/root/repo/_derived_build/bin/Test.Interface.Write.Serial" "--gtest_filter=ADIOSInterfaceWriteTest.DefineVar_int8_t_2x5")
+set_tests_properties(Interface.ADIOSInterfaceWriteTest.DefineVar_int8_t_2x5.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;24;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.ADIOSInterfaceWriteTest.DefineVar_int16_t_2x5.Serial "/root/repo/_derived_build/bin/Test.Interface.Write.Serial" "--gtest_filter=ADIOSInterfaceWriteTest.DefineVar_int16_t_2x5")
+set_tests_properties(Interface.ADIOSInterfaceWriteTest.DefineVar_int16_t_2x5.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;24;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.ADIOSInterfaceWriteTest.DefineVar_int32_t_2x5.Serial "/root/repo/_derived_build/bin/Test.Interface.Write.Serial" "--gtest_filter=ADIOSInterfaceWriteTest.DefineVar_int32_t_2x5")
+set_tests_properties(Interface.ADIOSInterfaceWriteTest.DefineVar_int32_t_2x5.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;24;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.ADIOSInterfaceWriteTest.DefineVar_int64_t_2x5.Serial "/root/repo/_derived_build/bin/Test.Interface.Write.Serial" "--gtest_filter=ADIOSInterfaceWriteTest.DefineVar_int64_t_2x5")
+set_tests_properties(Interface.ADIOSInterfaceWriteTest.DefineVar_int64_t_2x5.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;24;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.ADIOSInterfaceWriteTest.DefineVar_uint8_t_2x5.Serial "/root/repo/_derived_build/bin/Test.Interface.Write.Serial" "--gtest_filter=ADIOSInterfaceWriteTest.DefineVar_uint8_t_2x5")
+set_tests_properties(Interface.ADIOSInterfaceWriteTest.DefineVar_uint8_t_2x5.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;24;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.ADIOSInterfaceWriteTest.DefineVar_uint16_t_2x5.Serial "/root/repo/_derived_build/bin/Test.Interface.Write.Serial" "--gtest_filter=ADIOSInterfaceWriteTest.DefineVar_uint16_t_2x5")
+set_tests_properties(Interface.ADIOSInterfaceWriteTest.DefineVar_uint16_t_2x5.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;24;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.ADIOSInterfaceWriteTest.DefineVar_uint32_t_2x5.Serial "/root/repo/_derived_build/bin/Test.Interface.Write.Serial" "--gtest_filter=ADIOSInterfaceWriteTest.DefineVar_uint32_t_2x5")
+set_tests_properties(Interface.ADIOSInterfaceWriteTest.DefineVar_uint32_t_2x5.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;24;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.ADIOSInterfaceWriteTest.DefineVar_uint64_t_2x5.Serial "/root/repo/_derived_build/bin/Test.Interface.Write.Serial" "--gtest_filter=ADIOSInterfaceWriteTest.DefineVar_uint64_t_2x5")
+set_tests_properties(Interface.ADIOSInterfaceWriteTest.DefineVar_uint64_t_2x5.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;24;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.ADIOSInterfaceWriteTest.Exceptions.Serial "/root/repo/_derived_build/bin/Test.Interface.Write.Serial" "--gtest_filter=ADIOSInterfaceWriteTest.Exceptions")
+set_tests_properties(Interface.ADIOSInterfaceWriteTest.Exceptions.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;24;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.ADIOSDefineVariableTest.DefineGlobalValue.Serial "/root/repo/_derived_build/bin/Test.Interface.DefineVariable.Serial" "--gtest_filter=ADIOSDefineVariableTest.DefineGlobalValue")
+set_tests_properties(Interface.ADIOSDefineVariableTest.DefineGlobalValue.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;25;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.ADIOSDefineVariableTest.DefineLocalValue.Serial "/root/repo/_derived_build/bin/Test.Interface.DefineVariable.Serial" "--gtest_filter=ADIOSDefineVariableTest.DefineLocalValue")
+set_tests_properties(Interface.ADIOSDefineVariableTest.DefineLocalValue.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;25;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.ADIOSDefineVariableTest.DefineGlobalArray.Serial "/root/repo/_derived_build/bin/Test.Interface.DefineVariable.Serial" "--gtest_filter=ADIOSDefineVariableTest.DefineGlobalArray")
+set_tests_properties(Interface.ADIOSDefineVariableTest.DefineGlobalArray.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;25;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.ADIOSDefineVariableTest.DefineGlobalArrayWithSelections.Serial "/root/repo/_derived_build/bin/Test.Interface.DefineVariable.Serial" "--gtest_filter=ADIOSDefineVariableTest.DefineGlobalArrayWithSelections")
+set_tests_properties(Interface.ADIOSDefineVariableTest.DefineGlobalArrayWithSelections.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;25;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.ADIOSDefineVariableTest.DefineGlobalArrayConstantDims.Serial "/root/repo/_derived_build/bin/Test.Interface.DefineVariable.Serial" "--gtest_filter=ADIOSDefineVariableTest.DefineGlobalArrayConstantDims")
+set_tests_properties(Interface.ADIOSDefineVariableTest.DefineGlobalArrayConstantDims.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;25;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.ADIOSDefineVariableTest.DefineGlobalArrayInvalidLocalValueDim.Serial "/root/repo/_derived_build/bin/Test.Interface.DefineVariable.Serial" "--gtest_filter=ADIOSDefineVariableTest.DefineGlobalArrayInvalidLocalValueDim")
+set_tests_properties(Interface.ADIOSDefineVariableTest.DefineGlobalArrayInvalidLocalValueDim.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;25;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.ADIOSDefineVariableTest.DefineLocalArray.Serial "/root/repo/_derived_build/bin/Test.Interface.DefineVariable.Serial" "--gtest_filter=ADIOSDefineVariableTest.DefineLocalArray")
+set_tests_properties(Interface.ADIOSDefineVariableTest.DefineLocalArray.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;25;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.ADIOSDefineVariableTest.DefineLocalArrayWithSelection.Serial "/root/repo/_derived_build/bin/Test.Interface.DefineVariable.Serial" "--gtest_filter=ADIOSDefineVariableTest.DefineLocalArrayWithSelection")
+set_tests_properties(Interface.ADIOSDefineVariableTest.DefineLocalArrayWithSelection.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;25;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.ADIOSDefineVariableTest.DefineLocalArrayConstantDims.Serial "/root/repo/_derived_build/bin/Test.Interface.DefineVariable.Serial" "--gtest_filter=ADIOSDefineVariableTest.DefineLocalArrayConstantDims")
+set_tests_properties(Interface.ADIOSDefineVariableTest.DefineLocalArrayConstantDims.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;25;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.ADIOSDefineVariableTest.DefineLocalArrayInvalidOffsets.Serial "/root/repo/_derived_build/bin/Test.Interface.DefineVariable.Serial" "--gtest_filter=ADIOSDefineVariableTest.DefineLocalArrayInvalidOffsets")
+set_tests_properties(Interface.ADIOSDefineVariableTest.DefineLocalArrayInvalidOffsets.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;25;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.ADIOSDefineVariableTest.DefineJoinedArrayFirstDim.Serial "/root/repo/_derived_build/bin/Test.Interface.DefineVariable.Serial" "--gtest_filter=ADIOSDefineVariableTest.DefineJoinedArrayFirstDim")
+set_tests_properties(Interface.ADIOSDefineVariableTest.DefineJoinedArrayFirstDim.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;25;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.ADIOSDefineVariableTest.DefineJoinedArraySecondDim.Serial "/root/repo/_derived_build/bin/Test.Interface.DefineVariable.Serial" "--gtest_filter=ADIOSDefineVariableTest.DefineJoinedArraySecondDim")
+set_tests_properties(Interface.ADIOSDefineVariableTest.DefineJoinedArraySecondDim.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;25;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.ADIOSDefineVariableTest.DefineJoinedArrayTooManyJoinedDims.Serial "/root/repo/_derived_build/bin/Test.Interface.DefineVariable.Serial" "--gtest_filter=ADIOSDefineVariableTest.DefineJoinedArrayTooManyJoinedDims")
+set_tests_properties(Interface.ADIOSDefineVariableTest.DefineJoinedArrayTooManyJoinedDims.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;25;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.ADIOSDefineVariableTest.DefineJoinedArrayInvalidStart.Serial "/root/repo/_derived_build/bin/Test.Interface.DefineVariable.Serial" "--gtest_filter=ADIOSDefineVariableTest.DefineJoinedArrayInvalidStart")
+set_tests_properties(Interface.ADIOSDefineVariableTest.DefineJoinedArrayInvalidStart.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;25;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.ADIOSDefineVariableTest.DefineString.Serial "/root/repo/_derived_build/bin/Test.Interface.DefineVariable.Serial" "--gtest_filter=ADIOSDefineVariableTest.DefineString")
+set_tests_properties(Interface.ADIOSDefineVariableTest.DefineString.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;25;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.ADIOSDefineVariableTest.DefineAndRemove.Serial "/root/repo/_derived_build/bin/Test.Interface.DefineVariable.Serial" "--gtest_filter=ADIOSDefineVariableTest.DefineAndRemove")
+set_tests_properties(Interface.ADIOSDefineVariableTest.DefineAndRemove.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;25;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.ADIOSDefineVariableTest.DefineRemoveDefine.Serial "/root/repo/_derived_build/bin/Test.Interface.DefineVariable.Serial" "--gtest_filter=ADIOSDefineVariableTest.DefineRemoveDefine")
+set_tests_properties(Interface.ADIOSDefineVariableTest.DefineRemoveDefine.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;25;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.ADIOSDefineVariableTest.DefineAndRemoveAll.Serial "/root/repo/_derived_build/bin/Test.Interface.DefineVariable.Serial" "--gtest_filter=ADIOSDefineVariableTest.DefineAndRemoveAll")
+set_tests_properties(Interface.ADIOSDefineVariableTest.DefineAndRemoveAll.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;25;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.ADIOSDefineVariableTest.DefineCheckType.Serial "/root/repo/_derived_build/bin/Test.Interface.DefineVariable.Serial" "--gtest_filter=ADIOSDefineVariableTest.DefineCheckType")
+set_tests_properties(Interface.ADIOSDefineVariableTest.DefineCheckType.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;25;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.ADIOSDefineVariableTest.DefineStructVariable.Serial "/root/repo/_derived_build/bin/Test.Interface.DefineVariable.Serial" "--gtest_filter=ADIOSDefineVariableTest.DefineStructVariable")
+set_tests_properties(Interface.ADIOSDefineVariableTest.DefineStructVariable.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;25;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.ADIOSDefineAttributeTest.DefineAttributeNameException.Serial "/root/repo/_derived_build/bin/Test.Interface.DefineAttribute.Serial" "--gtest_filter=ADIOSDefineAttributeTest.DefineAttributeNameException")
+set_tests_properties(Interface.ADIOSDefineAttributeTest.DefineAttributeNameException.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;26;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.ADIOSDefineAttributeTest.DefineAttributeTypeByValue.Serial "/root/repo/_derived_build/bin/Test.Interface.DefineAttribute.Serial" "--gtest_filter=ADIOSDefineAttributeTest.DefineAttributeTypeByValue")
+set_tests_properties(Interface.ADIOSDefineAttributeTest.DefineAttributeTypeByValue.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;26;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.ADIOSDefineAttributeTest.DefineAttributeTypeByReference.Serial "/root/repo/_derived_build/bin/Test.Interface.DefineAttribute.Serial" "--gtest_filter=ADIOSDefineAttributeTest.DefineAttributeTypeByReference")
+set_tests_properties(Interface.ADIOSDefineAttributeTest.DefineAttributeTypeByReference.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;26;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.ADIOSDefineAttributeTest.GetAttribute.Serial "/root/repo/_derived_build/bin/Test.Interface.DefineAttribute.Serial" "--gtest_filter=ADIOSDefineAttributeTest.GetAttribute")
+set_tests_properties(Interface.ADIOSDefineAttributeTest.GetAttribute.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;26;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.ADIOSDefineAttributeTest.DefineAndRemove.Serial "/root/repo/_derived_build/bin/Test.Interface.DefineAttribute.Serial" "--gtest_filter=ADIOSDefineAttributeTest.DefineAndRemove")
+set_tests_properties(Interface.ADIOSDefineAttributeTest.DefineAndRemove.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;26;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.ADIOSDefineAttributeTest.DefineRemoveDefine.Serial "/root/repo/_derived_build/bin/Test.Interface.DefineAttribute.Serial" "--gtest_filter=ADIOSDefineAttributeTest.DefineRemoveDefine")
+set_tests_properties(Interface.ADIOSDefineAttributeTest.DefineRemoveDefine.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;26;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.ADIOSDefineAttributeTest.DefineAndRemoveAll.Serial "/root/repo/_derived_build/bin/Test.Interface.DefineAttribute.Serial" "--gtest_filter=ADIOSDefineAttributeTest.DefineAndRemoveAll")
+set_tests_properties(Interface.ADIOSDefineAttributeTest.DefineAndRemoveAll.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;26;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.ADIOSDefineAttributeTest.DefineCheckType.Serial "/root/repo/_derived_build/bin/Test.Interface.DefineAttribute.Serial" "--gtest_filter=ADIOSDefineAttributeTest.DefineCheckType")
+set_tests_properties(Interface.ADIOSDefineAttributeTest.DefineCheckType.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;26;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.ADIOSDefineAttributeTest.VariableException.Serial "/root/repo/_derived_build/bin/Test.Interface.DefineAttribute.Serial" "--gtest_filter=ADIOSDefineAttributeTest.VariableException")
+set_tests_properties(Interface.ADIOSDefineAttributeTest.VariableException.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;26;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.MultiArray.Constructor.BP3.Serial "/root/repo/_derived_build/bin/Test.Interface.Selection.Serial" "--gtest_filter=MultiArray.Constructor" "BP3")
+set_tests_properties(Interface.MultiArray.Constructor.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/interface/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;27;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.MultiArray.Access.BP3.Serial "/root/repo/_derived_build/bin/Test.Interface.Selection.Serial" "--gtest_filter=MultiArray.Access" "BP3")
+set_tests_properties(Interface.MultiArray.Access.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/interface/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;27;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.MultiArray.Data.BP3.Serial "/root/repo/_derived_build/bin/Test.Interface.Selection.Serial" "--gtest_filter=MultiArray.Data" "BP3")
+set_tests_properties(Interface.MultiArray.Data.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/interface/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;27;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.MultiArray.Make.BP3.Serial "/root/repo/_derived_build/bin/Test.Interface.Selection.Serial" "--gtest_filter=MultiArray.Make" "BP3")
+set_tests_properties(Interface.MultiArray.Make.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/interface/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;27;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.ADIOS2_CXX11_API_Selection.SelectionNone.BP3.Serial "/root/repo/_derived_build/bin/Test.Interface.Selection.Serial" "--gtest_filter=ADIOS2_CXX11_API_Selection.SelectionNone" "BP3")
+set_tests_properties(Interface.ADIOS2_CXX11_API_Selection.SelectionNone.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/interface/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;27;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.ADIOS2_CXX11_API_Selection.SelectionWrite.BP3.Serial "/root/repo/_derived_build/bin/Test.Interface.Selection.Serial" "--gtest_filter=ADIOS2_CXX11_API_Selection.SelectionWrite" "BP3")
+set_tests_properties(Interface.ADIOS2_CXX11_API_Selection.SelectionWrite.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/interface/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;27;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.ADIOS2_CXX11_API_Selection.SelectionWriteStart.BP3.Serial "/root/repo/_derived_build/bin/Test.Interface.Selection.Serial" "--gtest_filter=ADIOS2_CXX11_API_Selection.SelectionWriteStart" "BP3")
+set_tests_properties(Interface.ADIOS2_CXX11_API_Selection.SelectionWriteStart.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/interface/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;27;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.ADIOS2_CXX11_API_Selection.SelectionRead.BP3.Serial "/root/repo/_derived_build/bin/Test.Interface.Selection.Serial" "--gtest_filter=ADIOS2_CXX11_API_Selection.SelectionRead" "BP3")
+set_tests_properties(Interface.ADIOS2_CXX11_API_Selection.SelectionRead.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/interface/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;27;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.ADIOS2_CXX11_API_Selection.SelectionReadStart.BP3.Serial "/root/repo/_derived_build/bin/Test.Interface.Selection.Serial" "--gtest_filter=ADIOS2_CXX11_API_Selection.SelectionReadStart" "BP3")
+set_tests_properties(Interface.ADIOS2_CXX11_API_Selection.SelectionReadStart.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/interface/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;27;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.ADIOS2_CXX11_API_Selection.MemorySelectionNone.BP3.Serial "/root/repo/_derived_build/bin/Test.Interface.Selection.Serial" "--gtest_filter=ADIOS2_CXX11_API_Selection.MemorySelectionNone" "BP3")
+set_tests_properties(Interface.ADIOS2_CXX11_API_Selection.MemorySelectionNone.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/interface/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;27;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.ADIOS2_CXX11_API_Selection.MemorySelectionWrite.BP3.Serial "/root/repo/_derived_build/bin/Test.Interface.Selection.Serial" "--gtest_filter=ADIOS2_CXX11_API_Selection.MemorySelectionWrite" "BP3")
+set_tests_properties(Interface.ADIOS2_CXX11_API_Selection.MemorySelectionWrite.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/interface/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;27;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.ADIOS2_CXX11_API_Selection.MemorySelectionWriteStart.BP3.Serial "/root/repo/_derived_build/bin/Test.Interface.Selection.Serial" "--gtest_filter=ADIOS2_CXX11_API_Selection.MemorySelectionWriteStart" "BP3")
+set_tests_properties(Interface.ADIOS2_CXX11_API_Selection.MemorySelectionWriteStart.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/interface/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;27;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.ADIOS2_CXX11_API_Selection.MemorySelectionRead.BP3.Serial "/root/repo/_derived_build/bin/Test.Interface.Selection.Serial" "--gtest_filter=ADIOS2_CXX11_API_Selection.MemorySelectionRead" "BP3")
+set_tests_properties(Interface.ADIOS2_CXX11_API_Selection.MemorySelectionRead.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/interface/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;27;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.ADIOS2_CXX11_API_Selection.MemorySelectionReadStart.BP3.Serial "/root/repo/_derived_build/bin/Test.Interface.Selection.Serial" "--gtest_filter=ADIOS2_CXX11_API_Selection.MemorySelectionReadStart" "BP3")
+set_tests_properties(Interface.ADIOS2_CXX11_API_Selection.MemorySelectionReadStart.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/interface/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;27;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.ADIOS2_CXX11_API_Selection.MemorySelectionComplex.BP3.Serial "/root/repo/_derived_build/bin/Test.Interface.Selection.Serial" "--gtest_filter=ADIOS2_CXX11_API_Selection.MemorySelectionComplex" "BP3")
+set_tests_properties(Interface.ADIOS2_CXX11_API_Selection.MemorySelectionComplex.BP3.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/interface/bp3" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;27;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.MultiArray.Constructor.BPfile.Serial "/root/repo/_derived_build/bin/Test.Interface.Selection.Serial" "--gtest_filter=MultiArray.Constructor" "BPfile")
+set_tests_properties(Interface.MultiArray.Constructor.BPfile.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/interface/bpfile" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;29;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.MultiArray.Access.BPfile.Serial "/root/repo/_derived_build/bin/Test.Interface.Selection.Serial" "--gtest_filter=MultiArray.Access" "BPfile")
+set_tests_properties(Interface.MultiArray.Access.BPfile.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/interface/bpfile" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;29;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.MultiArray.Data.BPfile.Serial "/root/repo/_derived_build/bin/Test.Interface.Selection.Serial" "--gtest_filter=MultiArray.Data" "BPfile")
+set_tests_properties(Interface.MultiArray.Data.BPfile.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/interface/bpfile" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;29;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.MultiArray.Make.BPfile.Serial "/root/repo/_derived_build/bin/Test.Interface.Selection.Serial" "--gtest_filter=MultiArray.Make" "BPfile")
+set_tests_properties(Interface.MultiArray.Make.BPfile.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/interface/bpfile" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;29;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.ADIOS2_CXX11_API_Selection.SelectionNone.BPfile.Serial "/root/repo/_derived_build/bin/Test.Interface.Selection.Serial" "--gtest_filter=ADIOS2_CXX11_API_Selection.SelectionNone" "BPfile")
+set_tests_properties(Interface.ADIOS2_CXX11_API_Selection.SelectionNone.BPfile.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/interface/bpfile" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;29;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.ADIOS2_CXX11_API_Selection.SelectionWrite.BPfile.Serial "/root/repo/_derived_build/bin/Test.Interface.Selection.Serial" "--gtest_filter=ADIOS2_CXX11_API_Selection.SelectionWrite" "BPfile")
+set_tests_properties(Interface.ADIOS2_CXX11_API_Selection.SelectionWrite.BPfile.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/interface/bpfile" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;29;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.ADIOS2_CXX11_API_Selection.SelectionWriteStart.BPfile.Serial "/root/repo/_derived_build/bin/Test.Interface.Selection.Serial" "--gtest_filter=ADIOS2_CXX11_API_Selection.SelectionWriteStart" "BPfile")
+set_tests_properties(Interface.ADIOS2_CXX11_API_Selection.SelectionWriteStart.BPfile.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/interface/bpfile" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;29;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.ADIOS2_CXX11_API_Selection.SelectionRead.BPfile.Serial "/root/repo/_derived_build/bin/Test.Interface.Selection.Serial" "--gtest_filter=ADIOS2_CXX11_API_Selection.SelectionRead" "BPfile")
+set_tests_properties(Interface.ADIOS2_CXX11_API_Selection.SelectionRead.BPfile.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/interface/bpfile" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;29;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.ADIOS2_CXX11_API_Selection.SelectionReadStart.BPfile.Serial "/root/repo/_derived_build/bin/Test.Interface.Selection.Serial" "--gtest_filter=ADIOS2_CXX11_API_Selection.SelectionReadStart" "BPfile")
+set_tests_properties(Interface.ADIOS2_CXX11_API_Selection.SelectionReadStart.BPfile.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/interface/bpfile" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;29;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.ADIOS2_CXX11_API_Selection.MemorySelectionNone.BPfile.Serial "/root/repo/_derived_build/bin/Test.Interface.Selection.Serial" "--gtest_filter=ADIOS2_CXX11_API_Selection.MemorySelectionNone" "BPfile")
+set_tests_properties(Interface.ADIOS2_CXX11_API_Selection.MemorySelectionNone.BPfile.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/interface/bpfile" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;29;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.ADIOS2_CXX11_API_Selection.MemorySelectionWrite.BPfile.Serial "/root/repo/_derived_build/bin/Test.Interface.Selection.Serial" "--gtest_filter=ADIOS2_CXX11_API_Selection.MemorySelectionWrite" "BPfile")
+set_tests_properties(Interface.ADIOS2_CXX11_API_Selection.MemorySelectionWrite.BPfile.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/interface/bpfile" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;29;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.ADIOS2_CXX11_API_Selection.MemorySelectionWriteStart.BPfile.Serial "/root/repo/_derived_build/bin/Test.Interface.Selection.Serial" "--gtest_filter=ADIOS2_CXX11_API_Selection.MemorySelectionWriteStart" "BPfile")
+set_tests_properties(Interface.ADIOS2_CXX11_API_Selection.MemorySelectionWriteStart.BPfile.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/interface/bpfile" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;29;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.ADIOS2_CXX11_API_Selection.MemorySelectionRead.BPfile.Serial "/root/repo/_derived_build/bin/Test.Interface.Selection.Serial" "--gtest_filter=ADIOS2_CXX11_API_Selection.MemorySelectionRead" "BPfile")
+set_tests_properties(Interface.ADIOS2_CXX11_API_Selection.MemorySelectionRead.BPfile.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/interface/bpfile" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;29;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.ADIOS2_CXX11_API_Selection.MemorySelectionReadStart.BPfile.Serial "/root/repo/_derived_build/bin/Test.Interface.Selection.Serial" "--gtest_filter=ADIOS2_CXX11_API_Selection.MemorySelectionReadStart" "BPfile")
+set_tests_properties(Interface.ADIOS2_CXX11_API_Selection.MemorySelectionReadStart.BPfile.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/interface/bpfile" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;29;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.ADIOS2_CXX11_API_Selection.MemorySelectionComplex.BPfile.Serial "/root/repo/_derived_build/bin/Test.Interface.Selection.Serial" "--gtest_filter=ADIOS2_CXX11_API_Selection.MemorySelectionComplex" "BPfile")
+set_tests_properties(Interface.ADIOS2_CXX11_API_Selection.MemorySelectionComplex.BPfile.Serial PROPERTIES  WORKING_DIRECTORY "/root/repo/_derived_build/testing/adios2/interface/bpfile" _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;29;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.ADIOSInterface.ADIOSNoMpi.Serial "/root/repo/_derived_build/bin/Test.Interface.NoMpi.Serial" "--gtest_filter=ADIOSInterface.ADIOSNoMpi")
+set_tests_properties(Interface.ADIOSInterface.ADIOSNoMpi.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;31;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.ADIOSInterface.info_available_features.Serial "/root/repo/_derived_build/bin/Test.Interface.Info.Serial" "--gtest_filter=ADIOSInterface.info_available_features")
+set_tests_properties(Interface.ADIOSInterface.info_available_features.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;32;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.ADIOSInterface.info_available_engines.Serial "/root/repo/_derived_build/bin/Test.Interface.Info.Serial" "--gtest_filter=ADIOSInterface.info_available_engines")
+set_tests_properties(Interface.ADIOSInterface.info_available_engines.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;32;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
+add_test(Interface.ADIOSInterface.info_available_operators.Serial "/root/repo/_derived_build/bin/Test.Interface.Info.Serial" "--gtest_filter=ADIOSInterface.info_available_operators")
+set_tests_properties(Interface.ADIOSInterface.info_available_operators.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/interface/CMakeLists.txt;32;gtest_add_tests_helper;/root/repo/testing/adios2/interface/CMakeLists.txt;0;")
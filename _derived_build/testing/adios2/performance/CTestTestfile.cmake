@@ -0,0 +1,9 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/testing/adios2/performance
+# Build directory: /root/repo/_derived_build/testing/adios2/performance
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("manyvars")
+subdirs("query")
+subdirs("metadata")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../bin/PerfReadPlanning"
+  "../../../../bin/PerfReadPlanning.pdb"
+  "CMakeFiles/PerfReadPlanning.dir/PerfReadPlanning.cpp.o"
+  "CMakeFiles/PerfReadPlanning.dir/PerfReadPlanning.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/PerfReadPlanning.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
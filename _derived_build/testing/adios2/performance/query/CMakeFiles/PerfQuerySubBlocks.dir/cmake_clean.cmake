@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../bin/PerfQuerySubBlocks"
+  "../../../../bin/PerfQuerySubBlocks.pdb"
+  "CMakeFiles/PerfQuerySubBlocks.dir/PerfQuerySubBlocks.cpp.o"
+  "CMakeFiles/PerfQuerySubBlocks.dir/PerfQuerySubBlocks.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/PerfQuerySubBlocks.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../bin/Test.Performance.Query.Serial"
+  "../../../../bin/Test.Performance.Query.Serial.pdb"
+  "CMakeFiles/Test.Performance.Query.Serial.dir/TestBPQuery.cpp.o"
+  "CMakeFiles/Test.Performance.Query.Serial.dir/TestBPQuery.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test.Performance.Query.Serial.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
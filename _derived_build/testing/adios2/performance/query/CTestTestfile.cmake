@@ -0,0 +1,14 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/testing/adios2/performance/query
+# Build directory: /root/repo/_derived_build/testing/adios2/performance/query
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(Performance.BPQueryTest.BP5.Serial "/root/repo/_derived_build/bin/Test.Performance.Query.Serial" "--gtest_filter=BPQueryTest.BP5")
+set_tests_properties(Performance.BPQueryTest.BP5.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/performance/query/CMakeLists.txt;6;gtest_add_tests_helper;/root/repo/testing/adios2/performance/query/CMakeLists.txt;0;")
+add_test(Performance.BPQueryTest.BP5SubBlocks.Serial "/root/repo/_derived_build/bin/Test.Performance.Query.Serial" "--gtest_filter=BPQueryTest.BP5SubBlocks")
+set_tests_properties(Performance.BPQueryTest.BP5SubBlocks.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/performance/query/CMakeLists.txt;6;gtest_add_tests_helper;/root/repo/testing/adios2/performance/query/CMakeLists.txt;0;")
+add_test(Performance.BPQueryTest.BP5BitmapIndex.Serial "/root/repo/_derived_build/bin/Test.Performance.Query.Serial" "--gtest_filter=BPQueryTest.BP5BitmapIndex")
+set_tests_properties(Performance.BPQueryTest.BP5BitmapIndex.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/performance/query/CMakeLists.txt;6;gtest_add_tests_helper;/root/repo/testing/adios2/performance/query/CMakeLists.txt;0;")
+add_test(Performance.BPQueryTest.BP4.Serial "/root/repo/_derived_build/bin/Test.Performance.Query.Serial" "--gtest_filter=BPQueryTest.BP4")
+set_tests_properties(Performance.BPQueryTest.BP4.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/performance/query/CMakeLists.txt;6;gtest_add_tests_helper;/root/repo/testing/adios2/performance/query/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/Test.Transports.File.Serial"
+  "../../../bin/Test.Transports.File.Serial.pdb"
+  "CMakeFiles/Test.Transports.File.Serial.dir/TestFile.cpp.o"
+  "CMakeFiles/Test.Transports.File.Serial.dir/TestFile.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test.Transports.File.Serial.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
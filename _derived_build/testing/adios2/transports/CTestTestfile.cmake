@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/testing/adios2/transports
+# Build directory: /root/repo/_derived_build/testing/adios2/transports
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(Transports.*/BufferTest.WriteRead/*.Serial "/root/repo/_derived_build/bin/Test.Transports.File.Serial" "--gtest_filter=*/BufferTest.WriteRead/*")
+set_tests_properties(Transports.*/BufferTest.WriteRead/*.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/transports/CMakeLists.txt;6;gtest_add_tests_helper;/root/repo/testing/adios2/transports/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/Test.Unit.BP5ReadBufferPool.Serial"
+  "../../../bin/Test.Unit.BP5ReadBufferPool.Serial.pdb"
+  "CMakeFiles/Test.Unit.BP5ReadBufferPool.Serial.dir/TestBP5ReadBufferPool.cpp.o"
+  "CMakeFiles/Test.Unit.BP5ReadBufferPool.Serial.dir/TestBP5ReadBufferPool.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test.Unit.BP5ReadBufferPool.Serial.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
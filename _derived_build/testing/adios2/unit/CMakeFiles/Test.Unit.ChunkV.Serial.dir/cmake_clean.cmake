@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/Test.Unit.ChunkV.Serial"
+  "../../../bin/Test.Unit.ChunkV.Serial.pdb"
+  "CMakeFiles/Test.Unit.ChunkV.Serial.dir/TestChunkV.cpp.o"
+  "CMakeFiles/Test.Unit.ChunkV.Serial.dir/TestChunkV.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test.Unit.ChunkV.Serial.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/Test.Unit.CoreDims.Serial"
+  "../../../bin/Test.Unit.CoreDims.Serial.pdb"
+  "CMakeFiles/Test.Unit.CoreDims.Serial.dir/TestCoreDims.cpp.o"
+  "CMakeFiles/Test.Unit.CoreDims.Serial.dir/TestCoreDims.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test.Unit.CoreDims.Serial.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
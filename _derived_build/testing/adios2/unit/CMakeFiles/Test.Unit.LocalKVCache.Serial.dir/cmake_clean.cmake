@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/Test.Unit.LocalKVCache.Serial"
+  "../../../bin/Test.Unit.LocalKVCache.Serial.pdb"
+  "CMakeFiles/Test.Unit.LocalKVCache.Serial.dir/TestLocalKVCache.cpp.o"
+  "CMakeFiles/Test.Unit.LocalKVCache.Serial.dir/TestLocalKVCache.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test.Unit.LocalKVCache.Serial.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/Test.Unit.PosixTransport.Serial"
+  "../../../bin/Test.Unit.PosixTransport.Serial.pdb"
+  "CMakeFiles/Test.Unit.PosixTransport.Serial.dir/TestPosixTransport.cpp.o"
+  "CMakeFiles/Test.Unit.PosixTransport.Serial.dir/TestPosixTransport.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test.Unit.PosixTransport.Serial.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/Test.Unit.ProfilingCounters.Serial"
+  "../../../bin/Test.Unit.ProfilingCounters.Serial.pdb"
+  "CMakeFiles/Test.Unit.ProfilingCounters.Serial.dir/TestProfilingCounters.cpp.o"
+  "CMakeFiles/Test.Unit.ProfilingCounters.Serial.dir/TestProfilingCounters.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test.Unit.ProfilingCounters.Serial.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
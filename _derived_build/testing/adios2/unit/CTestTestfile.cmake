@@ -0,0 +1,32 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/testing/adios2/unit
+# Build directory: /root/repo/_derived_build/testing/adios2/unit
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(Unit.ChunkV.AlignmentToMemBlockSize.Serial "/root/repo/_derived_build/bin/Test.Unit.ChunkV.Serial" "--gtest_filter=ChunkV.AlignmentToMemBlockSize")
+set_tests_properties(Unit.ChunkV.AlignmentToMemBlockSize.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/unit/CMakeLists.txt;6;gtest_add_tests_helper;/root/repo/testing/adios2/unit/CMakeLists.txt;0;")
+add_test(Unit.ChunkV.PooledChunksAcrossSteps.Serial "/root/repo/_derived_build/bin/Test.Unit.ChunkV.Serial" "--gtest_filter=ChunkV.PooledChunksAcrossSteps")
+set_tests_properties(Unit.ChunkV.PooledChunksAcrossSteps.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/unit/CMakeLists.txt;6;gtest_add_tests_helper;/root/repo/testing/adios2/unit/CMakeLists.txt;0;")
+add_test(Unit.BP5ReadBufferPool.Reuse.Serial "/root/repo/_derived_build/bin/Test.Unit.BP5ReadBufferPool.Serial" "--gtest_filter=BP5ReadBufferPool.Reuse")
+set_tests_properties(Unit.BP5ReadBufferPool.Reuse.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/unit/CMakeLists.txt;7;gtest_add_tests_helper;/root/repo/testing/adios2/unit/CMakeLists.txt;0;")
+add_test(Unit.BP5ReadBufferPool.RetainLimit.Serial "/root/repo/_derived_build/bin/Test.Unit.BP5ReadBufferPool.Serial" "--gtest_filter=BP5ReadBufferPool.RetainLimit")
+set_tests_properties(Unit.BP5ReadBufferPool.RetainLimit.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/unit/CMakeLists.txt;7;gtest_add_tests_helper;/root/repo/testing/adios2/unit/CMakeLists.txt;0;")
+add_test(Unit.LocalKVCache.SetGetPersist.Serial "/root/repo/_derived_build/bin/Test.Unit.LocalKVCache.Serial" "--gtest_filter=LocalKVCache.SetGetPersist")
+set_tests_properties(Unit.LocalKVCache.SetGetPersist.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/unit/CMakeLists.txt;8;gtest_add_tests_helper;/root/repo/testing/adios2/unit/CMakeLists.txt;0;")
+add_test(Unit.LocalKVCache.EvictLeastRecentlyUsed.Serial "/root/repo/_derived_build/bin/Test.Unit.LocalKVCache.Serial" "--gtest_filter=LocalKVCache.EvictLeastRecentlyUsed")
+set_tests_properties(Unit.LocalKVCache.EvictLeastRecentlyUsed.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/unit/CMakeLists.txt;8;gtest_add_tests_helper;/root/repo/testing/adios2/unit/CMakeLists.txt;0;")
+add_test(Unit.LocalKVCache.RemovedByAnotherProcess.Serial "/root/repo/_derived_build/bin/Test.Unit.LocalKVCache.Serial" "--gtest_filter=LocalKVCache.RemovedByAnotherProcess")
+set_tests_properties(Unit.LocalKVCache.RemovedByAnotherProcess.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/unit/CMakeLists.txt;8;gtest_add_tests_helper;/root/repo/testing/adios2/unit/CMakeLists.txt;0;")
+add_test(Unit.CoreDims.Basic.Serial "/root/repo/_derived_build/bin/Test.Unit.CoreDims.Serial" "--gtest_filter=CoreDims.Basic")
+set_tests_properties(Unit.CoreDims.Basic.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/unit/CMakeLists.txt;9;gtest_add_tests_helper;/root/repo/testing/adios2/unit/CMakeLists.txt;0;")
+add_test(Unit.ProfilingCounters.Names.Serial "/root/repo/_derived_build/bin/Test.Unit.ProfilingCounters.Serial" "--gtest_filter=ProfilingCounters.Names")
+set_tests_properties(Unit.ProfilingCounters.Names.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/unit/CMakeLists.txt;10;gtest_add_tests_helper;/root/repo/testing/adios2/unit/CMakeLists.txt;0;")
+add_test(Unit.ProfilingCounters.Threads.Serial "/root/repo/_derived_build/bin/Test.Unit.ProfilingCounters.Serial" "--gtest_filter=ProfilingCounters.Threads")
+set_tests_properties(Unit.ProfilingCounters.Threads.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/unit/CMakeLists.txt;10;gtest_add_tests_helper;/root/repo/testing/adios2/unit/CMakeLists.txt;0;")
+add_test(Unit.ProfilingCounters.Trace.Serial "/root/repo/_derived_build/bin/Test.Unit.ProfilingCounters.Serial" "--gtest_filter=ProfilingCounters.Trace")
+set_tests_properties(Unit.ProfilingCounters.Trace.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/unit/CMakeLists.txt;10;gtest_add_tests_helper;/root/repo/testing/adios2/unit/CMakeLists.txt;0;")
+add_test(Unit.FileTransport.FailOnEOF.Serial "/root/repo/_derived_build/bin/Test.Unit.PosixTransport.Serial" "--gtest_filter=FileTransport.FailOnEOF")
+set_tests_properties(Unit.FileTransport.FailOnEOF.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/unit/CMakeLists.txt;12;gtest_add_tests_helper;/root/repo/testing/adios2/unit/CMakeLists.txt;0;")
+add_test(Unit.FileTransport.WaitForData.Serial "/root/repo/_derived_build/bin/Test.Unit.PosixTransport.Serial" "--gtest_filter=FileTransport.WaitForData")
+set_tests_properties(Unit.FileTransport.WaitForData.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/unit/CMakeLists.txt;12;gtest_add_tests_helper;/root/repo/testing/adios2/unit/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/Test.XMLConfig.Serial"
+  "../../../bin/Test.XMLConfig.Serial.pdb"
+  "CMakeFiles/Test.XMLConfig.Serial.dir/TestXMLConfig.cpp.o"
+  "CMakeFiles/Test.XMLConfig.Serial.dir/TestXMLConfig.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test.XMLConfig.Serial.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
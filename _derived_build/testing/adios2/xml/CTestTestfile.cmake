@@ -0,0 +1,18 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/testing/adios2/xml
+# Build directory: /root/repo/_derived_build/testing/adios2/xml
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(XMLConfigTest.TwoIOs.Serial "/root/repo/_derived_build/bin/Test.XMLConfig.Serial" "--gtest_filter=XMLConfigTest.TwoIOs")
+set_tests_properties(XMLConfigTest.TwoIOs.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/xml/CMakeLists.txt;6;gtest_add_tests_helper;/root/repo/testing/adios2/xml/CMakeLists.txt;0;")
+add_test(XMLConfigTest.TwoEnginesException.Serial "/root/repo/_derived_build/bin/Test.XMLConfig.Serial" "--gtest_filter=XMLConfigTest.TwoEnginesException")
+set_tests_properties(XMLConfigTest.TwoEnginesException.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/xml/CMakeLists.txt;6;gtest_add_tests_helper;/root/repo/testing/adios2/xml/CMakeLists.txt;0;")
+add_test(XMLConfigTest.OpTypeException.Serial "/root/repo/_derived_build/bin/Test.XMLConfig.Serial" "--gtest_filter=XMLConfigTest.OpTypeException")
+set_tests_properties(XMLConfigTest.OpTypeException.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/xml/CMakeLists.txt;6;gtest_add_tests_helper;/root/repo/testing/adios2/xml/CMakeLists.txt;0;")
+add_test(XMLConfigTest.OpNullException.Serial "/root/repo/_derived_build/bin/Test.XMLConfig.Serial" "--gtest_filter=XMLConfigTest.OpNullException")
+set_tests_properties(XMLConfigTest.OpNullException.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/xml/CMakeLists.txt;6;gtest_add_tests_helper;/root/repo/testing/adios2/xml/CMakeLists.txt;0;")
+add_test(XMLConfigTest.OpNoneException.Serial "/root/repo/_derived_build/bin/Test.XMLConfig.Serial" "--gtest_filter=XMLConfigTest.OpNoneException")
+set_tests_properties(XMLConfigTest.OpNoneException.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/xml/CMakeLists.txt;6;gtest_add_tests_helper;/root/repo/testing/adios2/xml/CMakeLists.txt;0;")
+add_test(XMLConfigTest.RemoveIO.Serial "/root/repo/_derived_build/bin/Test.XMLConfig.Serial" "--gtest_filter=XMLConfigTest.RemoveIO")
+set_tests_properties(XMLConfigTest.RemoveIO.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/xml/CMakeLists.txt;6;gtest_add_tests_helper;/root/repo/testing/adios2/xml/CMakeLists.txt;0;")
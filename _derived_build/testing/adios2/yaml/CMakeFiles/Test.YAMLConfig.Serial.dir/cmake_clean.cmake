@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/Test.YAMLConfig.Serial"
+  "../../../bin/Test.YAMLConfig.Serial.pdb"
+  "CMakeFiles/Test.YAMLConfig.Serial.dir/TestYAMLConfig.cpp.o"
+  "CMakeFiles/Test.YAMLConfig.Serial.dir/TestYAMLConfig.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test.YAMLConfig.Serial.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/testing/adios2/yaml
+# Build directory: /root/repo/_derived_build/testing/adios2/yaml
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(YAMLConfigTest.TwoIOs.Serial "/root/repo/_derived_build/bin/Test.YAMLConfig.Serial" "--gtest_filter=YAMLConfigTest.TwoIOs")
+set_tests_properties(YAMLConfigTest.TwoIOs.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/yaml/CMakeLists.txt;6;gtest_add_tests_helper;/root/repo/testing/adios2/yaml/CMakeLists.txt;0;")
+add_test(YAMLConfigTest.OpTypeException.Serial "/root/repo/_derived_build/bin/Test.YAMLConfig.Serial" "--gtest_filter=YAMLConfigTest.OpTypeException")
+set_tests_properties(YAMLConfigTest.OpTypeException.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/yaml/CMakeLists.txt;6;gtest_add_tests_helper;/root/repo/testing/adios2/yaml/CMakeLists.txt;0;")
+add_test(YAMLConfigTest.OpNullException.Serial "/root/repo/_derived_build/bin/Test.YAMLConfig.Serial" "--gtest_filter=YAMLConfigTest.OpNullException")
+set_tests_properties(YAMLConfigTest.OpNullException.Serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/upstream/GoogleTest.cmake;225;add_test;/root/repo/testing/CMakeLists.txt;70;gtest_add_tests;/root/repo/testing/adios2/yaml/CMakeLists.txt;6;gtest_add_tests_helper;/root/repo/testing/adios2/yaml/CMakeLists.txt;0;")
@@ -0,0 +1,18 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/testing/install
+# Build directory: /root/repo/_derived_build/testing/install
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(Install.Setup "/usr/bin/cmake" "-DADIOS2_SOURCE_DIR=/root/repo" "-DADIOS2_BINARY_DIR=/root/repo/_derived_build" "-DBUILD_TYPE=Release" "-P" "/root/repo/testing/install/run_install.cmake")
+set_tests_properties(Install.Setup PROPERTIES  FIXTURES_SETUP "Install" _BACKTRACE_TRIPLES "/root/repo/testing/install/CMakeLists.txt;75;add_test;/root/repo/testing/install/CMakeLists.txt;0;")
+add_test(Install.CMake.C "/usr/bin/cmake" "-DADIOS2_SOURCE_DIR=/root/repo" "-DADIOS2_BINARY_DIR=/root/repo/_derived_build" "-DCMAKE_GENERATOR=Unix Makefiles" "-DCMAKE_GENERATOR_PLATFORM=" "-DCMAKE_GENERATOR_TOOLSET=" "-DCMAKE_MAKE_PROGRAM=/usr/bin/gmake" "-DTEST_CASE=C" "-DCMAKE_INSTALL_BINDIR=bin" "-DCMAKE_INSTALL_CMAKEDIR=lib/cmake/adios2" "-DCMAKE_C_COMPILER=/usr/bin/cc" "-DCMAKE_CXX_COMPILER=/usr/bin/c++" "-DCMAKE_Fortran_COMPILER=" "-DCMAKE_C_FLAGS=" "-DCMAKE_CXX_FLAGS=" "-DCMAKE_Fortran_FLAGS=" "-DCMAKE_EXE_LINKER_FLAGS=" "-DBUILD_TYPE=Release" "-DMPIEXEC_EXECUTABLE=" "-DMPIEXEC_EXTRA_FLAGS=" "-P" "/root/repo/testing/install/run_cmake.cmake")
+set_tests_properties(Install.CMake.C PROPERTIES  DEPENDS "Install.Setup" FIXTURES_REQUIRED "Install" _BACKTRACE_TRIPLES "/root/repo/testing/install/CMakeLists.txt;7;add_test;/root/repo/testing/install/CMakeLists.txt;94;add_install_cmake_test;/root/repo/testing/install/CMakeLists.txt;0;")
+add_test(Install.CMake.CXX11 "/usr/bin/cmake" "-DADIOS2_SOURCE_DIR=/root/repo" "-DADIOS2_BINARY_DIR=/root/repo/_derived_build" "-DCMAKE_GENERATOR=Unix Makefiles" "-DCMAKE_GENERATOR_PLATFORM=" "-DCMAKE_GENERATOR_TOOLSET=" "-DCMAKE_MAKE_PROGRAM=/usr/bin/gmake" "-DTEST_CASE=CXX11" "-DCMAKE_INSTALL_BINDIR=bin" "-DCMAKE_INSTALL_CMAKEDIR=lib/cmake/adios2" "-DCMAKE_C_COMPILER=/usr/bin/cc" "-DCMAKE_CXX_COMPILER=/usr/bin/c++" "-DCMAKE_Fortran_COMPILER=" "-DCMAKE_C_FLAGS=" "-DCMAKE_CXX_FLAGS=" "-DCMAKE_Fortran_FLAGS=" "-DCMAKE_EXE_LINKER_FLAGS=" "-DBUILD_TYPE=Release" "-DMPIEXEC_EXECUTABLE=" "-DMPIEXEC_EXTRA_FLAGS=" "-P" "/root/repo/testing/install/run_cmake.cmake")
+set_tests_properties(Install.CMake.CXX11 PROPERTIES  DEPENDS "Install.Setup" FIXTURES_REQUIRED "Install" _BACKTRACE_TRIPLES "/root/repo/testing/install/CMakeLists.txt;7;add_test;/root/repo/testing/install/CMakeLists.txt;95;add_install_cmake_test;/root/repo/testing/install/CMakeLists.txt;0;")
+add_test(Install.Make.C "/usr/bin/cmake" "-DADIOS2_SOURCE_DIR=/root/repo" "-DADIOS2_BINARY_DIR=/root/repo/_derived_build" "-DADIOS2_HAVE_MPI=" "-DADIOS2_EXECUTABLE_SUFFIX=" "-DMAKE_COMMAND=/usr/bin/make" "-DCMAKE_C_COMPILER=/usr/bin/cc" "-DCMAKE_CXX_COMPILER=/usr/bin/c++" "-DCMAKE_Fortran_COMPILER=" "-DCMAKE_C_FLAGS=" "-DCMAKE_CXX_FLAGS=" "-DCMAKE_Fortran_FLAGS=" "-DCMAKE_EXE_LINKER_FLAGS=" "-DTEST_CASE=C" "-DCMAKE_INSTALL_BINDIR=bin" "-DMPIEXEC_EXECUTABLE=" "-DMPIEXEC_EXTRA_FLAGS=" "-DCMAKE_OSX_SYSROOT=" "-P" "/root/repo/testing/install/run_make.cmake")
+set_tests_properties(Install.Make.C PROPERTIES  DEPENDS "Install.Setup" FIXTURES_REQUIRED "Install" _BACKTRACE_TRIPLES "/root/repo/testing/install/CMakeLists.txt;49;add_test;/root/repo/testing/install/CMakeLists.txt;103;add_install_make_test;/root/repo/testing/install/CMakeLists.txt;0;")
+add_test(Install.Make.CXX11 "/usr/bin/cmake" "-DADIOS2_SOURCE_DIR=/root/repo" "-DADIOS2_BINARY_DIR=/root/repo/_derived_build" "-DADIOS2_HAVE_MPI=" "-DADIOS2_EXECUTABLE_SUFFIX=" "-DMAKE_COMMAND=/usr/bin/make" "-DCMAKE_C_COMPILER=/usr/bin/cc" "-DCMAKE_CXX_COMPILER=/usr/bin/c++" "-DCMAKE_Fortran_COMPILER=" "-DCMAKE_C_FLAGS=" "-DCMAKE_CXX_FLAGS=" "-DCMAKE_Fortran_FLAGS=" "-DCMAKE_EXE_LINKER_FLAGS=" "-DTEST_CASE=CXX11" "-DCMAKE_INSTALL_BINDIR=bin" "-DMPIEXEC_EXECUTABLE=" "-DMPIEXEC_EXTRA_FLAGS=" "-DCMAKE_OSX_SYSROOT=" "-P" "/root/repo/testing/install/run_make.cmake")
+set_tests_properties(Install.Make.CXX11 PROPERTIES  DEPENDS "Install.Setup" FIXTURES_REQUIRED "Install" _BACKTRACE_TRIPLES "/root/repo/testing/install/CMakeLists.txt;49;add_test;/root/repo/testing/install/CMakeLists.txt;104;add_install_make_test;/root/repo/testing/install/CMakeLists.txt;0;")
+add_test(Install.CMake.EnginePlugin "/usr/bin/cmake" "-DADIOS2_SOURCE_DIR=/root/repo" "-DADIOS2_BINARY_DIR=/root/repo/_derived_build" "-DCMAKE_GENERATOR=Unix Makefiles" "-DCMAKE_GENERATOR_PLATFORM=" "-DCMAKE_GENERATOR_TOOLSET=" "-DCMAKE_MAKE_PROGRAM=/usr/bin/gmake" "-DTEST_CASE=EnginePlugin" "-DCMAKE_INSTALL_BINDIR=bin" "-DCMAKE_INSTALL_CMAKEDIR=lib/cmake/adios2" "-DCMAKE_C_COMPILER=/usr/bin/cc" "-DCMAKE_CXX_COMPILER=/usr/bin/c++" "-DCMAKE_Fortran_COMPILER=" "-DCMAKE_C_FLAGS=" "-DCMAKE_CXX_FLAGS=" "-DCMAKE_Fortran_FLAGS=" "-DCMAKE_EXE_LINKER_FLAGS=" "-DBUILD_TYPE=Release" "-DMPIEXEC_EXECUTABLE=" "-DMPIEXEC_EXTRA_FLAGS=" "-P" "/root/repo/testing/install/run_cmake.cmake")
+set_tests_properties(Install.CMake.EnginePlugin PROPERTIES  DEPENDS "Install.Setup" FIXTURES_REQUIRED "Install" _BACKTRACE_TRIPLES "/root/repo/testing/install/CMakeLists.txt;7;add_test;/root/repo/testing/install/CMakeLists.txt;111;add_install_cmake_test;/root/repo/testing/install/CMakeLists.txt;0;")
@@ -0,0 +1,9 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/testing/utils
+# Build directory: /root/repo/_derived_build/testing/utils
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("cwriter")
+subdirs("changingshape")
+subdirs("reorganize")
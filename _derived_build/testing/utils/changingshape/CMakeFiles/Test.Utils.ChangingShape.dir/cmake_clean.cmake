@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/Test.Utils.ChangingShape"
+  "../../../bin/Test.Utils.ChangingShape.pdb"
+  "CMakeFiles/Test.Utils.ChangingShape.dir/TestUtilsChangingShape.cpp.o"
+  "CMakeFiles/Test.Utils.ChangingShape.dir/TestUtilsChangingShape.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Test.Utils.ChangingShape.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,22 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/testing/utils/changingshape
+# Build directory: /root/repo/_derived_build/testing/utils/changingshape
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(Utils.ChangingShape "/root/repo/_derived_build/bin/Test.Utils.ChangingShape")
+set_tests_properties(Utils.ChangingShape PROPERTIES  DEPENDS "Utils.ChangingShape.Setup" FIXTURES_REQUIRED "Utils.ChangingShape" FIXTURES_SETUP "Utils.ChangingShape.Screen;Utils.ChangingShape.AlternatingStepsAndChangingShapeVar.Dump;Utils.ChangingShape.AlternatingStepsVarSelection.Dump;Utils.ChangingShape.ChangingShapeVarOneStep.Dump;Utils.ChangingShape.FixedShapeVarTooManySteps.Dump" WORKING_DIRECTORY "/root/repo/_derived_build/testing/utils/changingshape/Utils.ChangingShape" _BACKTRACE_TRIPLES "/root/repo/testing/utils/changingshape/CMakeLists.txt;18;add_test;/root/repo/testing/utils/changingshape/CMakeLists.txt;0;")
+add_test(Utils.ChangingShape.Screen "/usr/bin/cmake" "-DARG1=-la" "-DINPUT_FILE=TestUtilsChangingShape.bp" "-P" "/root/repo/_derived_build/Release/bpls.cmake")
+set_tests_properties(Utils.ChangingShape.Screen PROPERTIES  DEPENDS "Utils.ChangingShape" FIXTURES_REQUIRED "Utils.ChangingShape.Screen" FIXTURES_SETUP "Utils.ChangingShape.Dump" WORKING_DIRECTORY "/root/repo/_derived_build/testing/utils/changingshape/Utils.ChangingShape" _BACKTRACE_TRIPLES "/root/repo/testing/utils/changingshape/CMakeLists.txt;25;add_test;/root/repo/testing/utils/changingshape/CMakeLists.txt;0;")
+add_test(Utils.ChangingShape.Dump "/usr/bin/cmake" "-DARG1=-la" "-DINPUT_FILE=TestUtilsChangingShape.bp" "-DOUTPUT_FILE=TestUtilsChangingShape.bplsla.result.txt" "-P" "/root/repo/_derived_build/Release/bpls.cmake")
+set_tests_properties(Utils.ChangingShape.Dump PROPERTIES  DEPENDS "Utils.ChangingShape.Screen" FIXTURES_REQUIRED "Utils.ChangingShape.Dump" WORKING_DIRECTORY "/root/repo/_derived_build/testing/utils/changingshape/Utils.ChangingShape" _BACKTRACE_TRIPLES "/root/repo/testing/utils/changingshape/CMakeLists.txt;32;add_test;/root/repo/testing/utils/changingshape/CMakeLists.txt;0;")
+add_test(Utils.ChangingShape.Setup "/usr/bin/cmake" "-DDIR_NAME=/root/repo/_derived_build/testing/utils/changingshape/Utils.ChangingShape" "-P" "/root/repo/cmake/EmptyDir.cmake")
+set_tests_properties(Utils.ChangingShape.Setup PROPERTIES  FIXTURES_SETUP "Utils.ChangingShape" _BACKTRACE_TRIPLES "/root/repo/cmake/ADIOSFunctions.cmake;177;add_test;/root/repo/testing/utils/changingshape/CMakeLists.txt;48;SetupTestPipeline;/root/repo/testing/utils/changingshape/CMakeLists.txt;0;")
+add_test(Utils.ChangingShape.AlternatingStepsAndChangingShapeVar.Dump "/usr/bin/cmake" "-DARG1=-ld" "-DARG2=AlternatingStepsAndChangingShapeVar" "-DINPUT_FILE=TestUtilsChangingShape.bp" "-DOUTPUT_FILE=TestUtilsChangingShape.bplsldAlternatingStepsAndChangingShapeVar.result.txt" "-P" "/root/repo/_derived_build/Release/bpls.cmake")
+set_tests_properties(Utils.ChangingShape.AlternatingStepsAndChangingShapeVar.Dump PROPERTIES  DEPENDS "Utils.ChangingShape" FIXTURES_REQUIRED "Utils.ChangingShape.AlternatingStepsAndChangingShapeVar.Dump" WORKING_DIRECTORY "/root/repo/_derived_build/testing/utils/changingshape/Utils.ChangingShape" _BACKTRACE_TRIPLES "/root/repo/testing/utils/changingshape/CMakeLists.txt;55;add_test;/root/repo/testing/utils/changingshape/CMakeLists.txt;0;")
+add_test(Utils.ChangingShape.AlternatingStepsVarSelection.Dump "/usr/bin/cmake" "-DARG1=-ld" "-DARG2=AlternatingStepsVar" "-DARG3=-s" "-DARG4=1,0,0" "-DARG5=-c" "-DARG6=3,-1,-1" "-DARG7=-n" "-DARG8=8" "-DINPUT_FILE=TestUtilsChangingShape.bp" "-DOUTPUT_FILE=TestUtilsChangingShape.bplsldAlternatingStepsVarSelection.result.txt" "-P" "/root/repo/_derived_build/Release/bpls.cmake")
+set_tests_properties(Utils.ChangingShape.AlternatingStepsVarSelection.Dump PROPERTIES  DEPENDS "Utils.ChangingShape" FIXTURES_REQUIRED "Utils.ChangingShape.AlternatingStepsVarSelection.Dump" WORKING_DIRECTORY "/root/repo/_derived_build/testing/utils/changingshape/Utils.ChangingShape" _BACKTRACE_TRIPLES "/root/repo/testing/utils/changingshape/CMakeLists.txt;83;add_test;/root/repo/testing/utils/changingshape/CMakeLists.txt;0;")
+add_test(Utils.ChangingShape.ChangingShapeVarOneStep.Dump "/usr/bin/cmake" "-DARG1=-ld" "-DARG2=ChangingShapeVar" "-DARG3=-s" "-DARG4=5,0,0" "-DARG5=-c" "-DARG6=1,-1,-1" "-DARG7=-n" "-DARG8=12" "-DINPUT_FILE=TestUtilsChangingShape.bp" "-DOUTPUT_FILE=TestUtilsChangingShape.bplsldChangingShapeVarOneStep.result.txt" "-P" "/root/repo/_derived_build/Release/bpls.cmake")
+set_tests_properties(Utils.ChangingShape.ChangingShapeVarOneStep.Dump PROPERTIES  DEPENDS "Utils.ChangingShape" FIXTURES_REQUIRED "Utils.ChangingShape.ChangingShapeVarOneStep.Dump" WORKING_DIRECTORY "/root/repo/_derived_build/testing/utils/changingshape/Utils.ChangingShape" _BACKTRACE_TRIPLES "/root/repo/testing/utils/changingshape/CMakeLists.txt;117;add_test;/root/repo/testing/utils/changingshape/CMakeLists.txt;0;")
+add_test(Utils.ChangingShape.FixedShapeVarTooManySteps.Dump "/usr/bin/cmake" "-DARG1=-ld" "-DARG2=FixedShapeVar" "-DARG3=-s" "-DARG4=5,0,0" "-DARG5=-c" "-DARG6=10,-1,-1" "-DINPUT_FILE=TestUtilsChangingShape.bp" "-DOUTPUT_FILE=TestUtilsChangingShape.bplsldFixedShapeVarTooManySteps.result.txt" "-P" "/root/repo/_derived_build/Release/bpls.cmake")
+set_tests_properties(Utils.ChangingShape.FixedShapeVarTooManySteps.Dump PROPERTIES  DEPENDS "Utils.ChangingShape" FIXTURES_REQUIRED "Utils.ChangingShape.FixedShapeVarTooManySteps.Dump" WORKING_DIRECTORY "/root/repo/_derived_build/testing/utils/changingshape/Utils.ChangingShape" _BACKTRACE_TRIPLES "/root/repo/testing/utils/changingshape/CMakeLists.txt;148;add_test;/root/repo/testing/utils/changingshape/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/Test.Utils.CWriter"
+  "../../../bin/Test.Utils.CWriter.pdb"
+  "CMakeFiles/Test.Utils.CWriter.dir/TestUtilsCWriter.c.o"
+  "CMakeFiles/Test.Utils.CWriter.dir/TestUtilsCWriter.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/Test.Utils.CWriter.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,24 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/testing/utils/cwriter
+# Build directory: /root/repo/_derived_build/testing/utils/cwriter
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(Utils.CWriter "/root/repo/_derived_build/bin/Test.Utils.CWriter")
+set_tests_properties(Utils.CWriter PROPERTIES  DEPENDS "Utils.CWriter.Setup" FIXTURES_REQUIRED "Utils.CWriter" FIXTURES_SETUP "Utils.CWriter.Bpls.h.Dump;Utils.CWriter.Bpls.la.Screen;Utils.CWriter.Bpls.Al.Dump;Utils.CWriter.Bpls.ldDav.Dump;Utils.CWriter.Bpls.ldDavvv.Dump;Utils.CWriter.Bpls.ldvarI16.Dump" WORKING_DIRECTORY "/root/repo/_derived_build/testing/utils/cwriter/Utils.CWriter" _BACKTRACE_TRIPLES "/root/repo/testing/utils/cwriter/CMakeLists.txt;18;add_test;/root/repo/testing/utils/cwriter/CMakeLists.txt;0;")
+add_test(Utils.CWriter.Bpls.h.Dump "/usr/bin/cmake" "-DARG1=-h" "-DINPUT_FILE=TestUtilsCWriter.bp" "-DOUTPUT_FILE=TestUtilsCWriter.bplsh.result.txt" "-P" "/root/repo/_derived_build/Release/bpls.cmake")
+set_tests_properties(Utils.CWriter.Bpls.h.Dump PROPERTIES  DEPENDS "Utils.CWriter" FIXTURES_REQUIRED "Utils.CWriter.Bpls.h.Dump" WORKING_DIRECTORY "/root/repo/_derived_build/testing/utils/cwriter/Utils.CWriter" _BACKTRACE_TRIPLES "/root/repo/testing/utils/cwriter/CMakeLists.txt;26;add_test;/root/repo/testing/utils/cwriter/CMakeLists.txt;0;")
+add_test(Utils.CWriter.Setup "/usr/bin/cmake" "-DDIR_NAME=/root/repo/_derived_build/testing/utils/cwriter/Utils.CWriter" "-P" "/root/repo/cmake/EmptyDir.cmake")
+set_tests_properties(Utils.CWriter.Setup PROPERTIES  FIXTURES_SETUP "Utils.CWriter" _BACKTRACE_TRIPLES "/root/repo/cmake/ADIOSFunctions.cmake;177;add_test;/root/repo/testing/utils/cwriter/CMakeLists.txt;42;SetupTestPipeline;/root/repo/testing/utils/cwriter/CMakeLists.txt;0;")
+add_test(Utils.CWriter.Bpls.la.Screen "/usr/bin/cmake" "-DARG1=-la" "-DINPUT_FILE=TestUtilsCWriter.bp" "-P" "/root/repo/_derived_build/Release/bpls.cmake")
+set_tests_properties(Utils.CWriter.Bpls.la.Screen PROPERTIES  DEPENDS "Utils.CWriter" FIXTURES_REQUIRED "Utils.CWriter.Bpls.la.Screen" FIXTURES_SETUP "Utils.CWriter.Bpls.la.Dump" WORKING_DIRECTORY "/root/repo/_derived_build/testing/utils/cwriter/Utils.CWriter" _BACKTRACE_TRIPLES "/root/repo/testing/utils/cwriter/CMakeLists.txt;49;add_test;/root/repo/testing/utils/cwriter/CMakeLists.txt;0;")
+add_test(Utils.CWriter.Bpls.la.Dump "/usr/bin/cmake" "-DARG1=-la" "-DINPUT_FILE=TestUtilsCWriter.bp" "-DOUTPUT_FILE=TestUtilsCWriter.bplsla.result.txt" "-P" "/root/repo/_derived_build/Release/bpls.cmake")
+set_tests_properties(Utils.CWriter.Bpls.la.Dump PROPERTIES  DEPENDS "Utils.CWriter.Bpls.la.Screen" FIXTURES_REQUIRED "Utils.CWriter.Bpls.la.Dump" WORKING_DIRECTORY "/root/repo/_derived_build/testing/utils/cwriter/Utils.CWriter" _BACKTRACE_TRIPLES "/root/repo/testing/utils/cwriter/CMakeLists.txt;57;add_test;/root/repo/testing/utils/cwriter/CMakeLists.txt;0;")
+add_test(Utils.CWriter.Bpls.Al.Dump "/usr/bin/cmake" "-DARG1=-Al" "-DINPUT_FILE=TestUtilsCWriter.bp" "-DOUTPUT_FILE=TestUtilsCWriter.bplsAl.result.txt" "-P" "/root/repo/_derived_build/Release/bpls.cmake")
+set_tests_properties(Utils.CWriter.Bpls.Al.Dump PROPERTIES  DEPENDS "Utils.CWriter" FIXTURES_REQUIRED "Utils.CWriter.Bpls.Al.Dump" WORKING_DIRECTORY "/root/repo/_derived_build/testing/utils/cwriter/Utils.CWriter" _BACKTRACE_TRIPLES "/root/repo/testing/utils/cwriter/CMakeLists.txt;82;add_test;/root/repo/testing/utils/cwriter/CMakeLists.txt;0;")
+add_test(Utils.CWriter.Bpls.ldDav.Dump "/usr/bin/cmake" "-DARG1='-ldDav'" "-DINPUT_FILE=TestUtilsCWriter.bp" "-DOUTPUT_FILE=TestUtilsCWriter.bplsldDav.result.txt" "-P" "/root/repo/_derived_build/Release/bpls.cmake")
+set_tests_properties(Utils.CWriter.Bpls.ldDav.Dump PROPERTIES  DEPENDS "Utils.CWriter" FIXTURES_REQUIRED "Utils.CWriter.Bpls.ldDav.Dump" WORKING_DIRECTORY "/root/repo/_derived_build/testing/utils/cwriter/Utils.CWriter" _BACKTRACE_TRIPLES "/root/repo/testing/utils/cwriter/CMakeLists.txt;104;add_test;/root/repo/testing/utils/cwriter/CMakeLists.txt;0;")
+add_test(Utils.CWriter.Bpls.ldDavvv.Dump "/usr/bin/cmake" "-DARG1='-ldDavvv'" "-DINPUT_FILE=TestUtilsCWriter.bp" "-DOUTPUT_FILE=TestUtilsCWriter.bplsldDavvv.result.txt" "-P" "/root/repo/_derived_build/Release/bpls.cmake")
+set_tests_properties(Utils.CWriter.Bpls.ldDavvv.Dump PROPERTIES  DEPENDS "Utils.CWriter" FIXTURES_REQUIRED "Utils.CWriter.Bpls.ldDavvv.Dump" WORKING_DIRECTORY "/root/repo/_derived_build/testing/utils/cwriter/Utils.CWriter" _BACKTRACE_TRIPLES "/root/repo/testing/utils/cwriter/CMakeLists.txt;127;add_test;/root/repo/testing/utils/cwriter/CMakeLists.txt;0;")
+add_test(Utils.CWriter.Bpls.ldvarI16.Dump "/usr/bin/cmake" "-DARG1=-ld" "-DARG2=varI16" "-DARG3=-n" "-DARG4=10" "-DINPUT_FILE=TestUtilsCWriter.bp" "-DOUTPUT_FILE=TestUtilsCWriter.bplsldvarI16.result.txt" "-P" "/root/repo/_derived_build/Release/bpls.cmake")
+set_tests_properties(Utils.CWriter.Bpls.ldvarI16.Dump PROPERTIES  DEPENDS "Utils.CWriter" FIXTURES_REQUIRED "Utils.CWriter.Bpls.ldvarI16.Dump" WORKING_DIRECTORY "/root/repo/_derived_build/testing/utils/cwriter/Utils.CWriter" _BACKTRACE_TRIPLES "/root/repo/testing/utils/cwriter/CMakeLists.txt;152;add_test;/root/repo/testing/utils/cwriter/CMakeLists.txt;0;")
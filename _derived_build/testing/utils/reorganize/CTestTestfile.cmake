@@ -0,0 +1,26 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/testing/utils/reorganize
+# Build directory: /root/repo/_derived_build/testing/utils/reorganize
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(Utils.Reorganize.Write "/root/repo/_derived_build/bin/Test.Utils.CWriter")
+set_tests_properties(Utils.Reorganize.Write PROPERTIES  DEPENDS "Utils.Reorganize.Setup" FIXTURES_REQUIRED "Utils.Reorganize.Write" FIXTURES_SETUP "Utils.Reorganize.Default" WORKING_DIRECTORY "/root/repo/_derived_build/testing/utils/reorganize/Utils.Reorganize" _BACKTRACE_TRIPLES "/root/repo/testing/utils/reorganize/CMakeLists.txt;20;add_test;/root/repo/testing/utils/reorganize/CMakeLists.txt;0;")
+add_test(Utils.Reorganize.Default "/root/repo/_derived_build/bin/adios2_reorganize" "TestUtilsCWriter.bp" "Default.bp" "BP5" "" "BP5" "" "1")
+set_tests_properties(Utils.Reorganize.Default PROPERTIES  DEPENDS "Utils.Reorganize.Write" FIXTURES_REQUIRED "Utils.Reorganize.Default" FIXTURES_SETUP "Utils.Reorganize.Budget" WORKING_DIRECTORY "/root/repo/_derived_build/testing/utils/reorganize/Utils.Reorganize" _BACKTRACE_TRIPLES "/root/repo/testing/utils/reorganize/CMakeLists.txt;28;add_test;/root/repo/testing/utils/reorganize/CMakeLists.txt;0;")
+add_test(Utils.Reorganize.Budget "/root/repo/_derived_build/bin/adios2_reorganize" "--memory-budget=40" "TestUtilsCWriter.bp" "Budget.bp" "BP5" "" "BP5" "" "1")
+set_tests_properties(Utils.Reorganize.Budget PROPERTIES  DEPENDS "Utils.Reorganize.Default" FIXTURES_REQUIRED "Utils.Reorganize.Budget" FIXTURES_SETUP "Utils.Reorganize.Pipeline" WORKING_DIRECTORY "/root/repo/_derived_build/testing/utils/reorganize/Utils.Reorganize" _BACKTRACE_TRIPLES "/root/repo/testing/utils/reorganize/CMakeLists.txt;33;add_test;/root/repo/testing/utils/reorganize/CMakeLists.txt;0;")
+add_test(Utils.Reorganize.Pipeline "/root/repo/_derived_build/bin/adios2_reorganize" "--pipeline" "--memory-budget=40" "TestUtilsCWriter.bp" "Pipeline.bp" "BP5" "" "BP5" "" "1")
+set_tests_properties(Utils.Reorganize.Pipeline PROPERTIES  DEPENDS "Utils.Reorganize.Budget" FIXTURES_REQUIRED "Utils.Reorganize.Pipeline" FIXTURES_SETUP "Utils.Reorganize.Default.Dump" WORKING_DIRECTORY "/root/repo/_derived_build/testing/utils/reorganize/Utils.Reorganize" _BACKTRACE_TRIPLES "/root/repo/testing/utils/reorganize/CMakeLists.txt;38;add_test;/root/repo/testing/utils/reorganize/CMakeLists.txt;0;")
+add_test(Utils.Reorganize.Default.Dump "/usr/bin/cmake" "-DARG1=-la" "-DARG2=-d" "-DINPUT_FILE=Default.bp" "-DOUTPUT_FILE=Default.bplslad.result.txt" "-P" "/root/repo/_derived_build/Release/bpls.cmake")
+set_tests_properties(Utils.Reorganize.Default.Dump PROPERTIES  DEPENDS "Utils.Reorganize.Pipeline" FIXTURES_REQUIRED "Utils.Reorganize.Default.Dump" FIXTURES_SETUP "Utils.Reorganize.Budget.Dump" WORKING_DIRECTORY "/root/repo/_derived_build/testing/utils/reorganize/Utils.Reorganize" _BACKTRACE_TRIPLES "/root/repo/testing/utils/reorganize/CMakeLists.txt;46;add_test;/root/repo/testing/utils/reorganize/CMakeLists.txt;0;")
+add_test(Utils.Reorganize.Budget.Dump "/usr/bin/cmake" "-DARG1=-la" "-DARG2=-d" "-DINPUT_FILE=Budget.bp" "-DOUTPUT_FILE=Budget.bplslad.result.txt" "-P" "/root/repo/_derived_build/Release/bpls.cmake")
+set_tests_properties(Utils.Reorganize.Budget.Dump PROPERTIES  DEPENDS "Utils.Reorganize.Default.Dump" FIXTURES_REQUIRED "Utils.Reorganize.Budget.Dump" FIXTURES_SETUP "Utils.Reorganize.Pipeline.Dump" WORKING_DIRECTORY "/root/repo/_derived_build/testing/utils/reorganize/Utils.Reorganize" _BACKTRACE_TRIPLES "/root/repo/testing/utils/reorganize/CMakeLists.txt;55;add_test;/root/repo/testing/utils/reorganize/CMakeLists.txt;0;")
+add_test(Utils.Reorganize.Pipeline.Dump "/usr/bin/cmake" "-DARG1=-la" "-DARG2=-d" "-DINPUT_FILE=Pipeline.bp" "-DOUTPUT_FILE=Pipeline.bplslad.result.txt" "-P" "/root/repo/_derived_build/Release/bpls.cmake")
+set_tests_properties(Utils.Reorganize.Pipeline.Dump PROPERTIES  DEPENDS "Utils.Reorganize.Budget.Dump" FIXTURES_REQUIRED "Utils.Reorganize.Pipeline.Dump" FIXTURES_SETUP "Utils.Reorganize.Budget.Validate" WORKING_DIRECTORY "/root/repo/_derived_build/testing/utils/reorganize/Utils.Reorganize" _BACKTRACE_TRIPLES "/root/repo/testing/utils/reorganize/CMakeLists.txt;64;add_test;/root/repo/testing/utils/reorganize/CMakeLists.txt;0;")
+add_test(Utils.Reorganize.Budget.Validate "/usr/bin/diff" "-u" "-w" "Default.bplslad.result.txt" "Budget.bplslad.result.txt")
+set_tests_properties(Utils.Reorganize.Budget.Validate PROPERTIES  DEPENDS "Utils.Reorganize.Pipeline.Dump" FIXTURES_REQUIRED "Utils.Reorganize.Budget.Validate" FIXTURES_SETUP "Utils.Reorganize.Pipeline.Validate" WORKING_DIRECTORY "/root/repo/_derived_build/testing/utils/reorganize/Utils.Reorganize" _BACKTRACE_TRIPLES "/root/repo/testing/utils/reorganize/CMakeLists.txt;73;add_test;/root/repo/testing/utils/reorganize/CMakeLists.txt;0;")
+add_test(Utils.Reorganize.Pipeline.Validate "/usr/bin/diff" "-u" "-w" "Default.bplslad.result.txt" "Pipeline.bplslad.result.txt")
+set_tests_properties(Utils.Reorganize.Pipeline.Validate PROPERTIES  DEPENDS "Utils.Reorganize.Budget.Validate" FIXTURES_REQUIRED "Utils.Reorganize.Pipeline.Validate" WORKING_DIRECTORY "/root/repo/_derived_build/testing/utils/reorganize/Utils.Reorganize" _BACKTRACE_TRIPLES "/root/repo/testing/utils/reorganize/CMakeLists.txt;79;add_test;/root/repo/testing/utils/reorganize/CMakeLists.txt;0;")
+add_test(Utils.Reorganize.Setup "/usr/bin/cmake" "-DDIR_NAME=/root/repo/_derived_build/testing/utils/reorganize/Utils.Reorganize" "-P" "/root/repo/cmake/EmptyDir.cmake")
+set_tests_properties(Utils.Reorganize.Setup PROPERTIES  FIXTURES_SETUP "Utils.Reorganize.Write" _BACKTRACE_TRIPLES "/root/repo/cmake/ADIOSFunctions.cmake;177;add_test;/root/repo/testing/utils/reorganize/CMakeLists.txt;85;SetupTestPipeline;/root/repo/testing/utils/reorganize/CMakeLists.txt;0;")
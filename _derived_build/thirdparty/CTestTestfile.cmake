@@ -0,0 +1,17 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/thirdparty
+# Build directory: /root/repo/_derived_build/thirdparty
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("KWSys")
+subdirs("perfstubs")
+subdirs("GTest")
+subdirs("pugixml")
+subdirs("nlohmann_json")
+subdirs("yaml-cpp")
+subdirs("atl")
+subdirs("dill")
+subdirs("ffs")
+subdirs("enet")
+subdirs("EVPath")
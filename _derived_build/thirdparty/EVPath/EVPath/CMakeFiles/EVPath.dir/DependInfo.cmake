@@ -0,0 +1,54 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/thirdparty/EVPath/EVPath/chr_time.c" "thirdparty/EVPath/EVPath/CMakeFiles/EVPath.dir/chr_time.c.o" "gcc" "thirdparty/EVPath/EVPath/CMakeFiles/EVPath.dir/chr_time.c.o.d"
+  "/root/repo/thirdparty/EVPath/EVPath/cm.c" "thirdparty/EVPath/EVPath/CMakeFiles/EVPath.dir/cm.c.o" "gcc" "thirdparty/EVPath/EVPath/CMakeFiles/EVPath.dir/cm.c.o.d"
+  "/root/repo/thirdparty/EVPath/EVPath/cm_control.c" "thirdparty/EVPath/EVPath/CMakeFiles/EVPath.dir/cm_control.c.o" "gcc" "thirdparty/EVPath/EVPath/CMakeFiles/EVPath.dir/cm_control.c.o.d"
+  "/root/repo/thirdparty/EVPath/EVPath/cm_evol.c" "thirdparty/EVPath/EVPath/CMakeFiles/EVPath.dir/cm_evol.c.o" "gcc" "thirdparty/EVPath/EVPath/CMakeFiles/EVPath.dir/cm_evol.c.o.d"
+  "/root/repo/thirdparty/EVPath/EVPath/cm_formats.c" "thirdparty/EVPath/EVPath/CMakeFiles/EVPath.dir/cm_formats.c.o" "gcc" "thirdparty/EVPath/EVPath/CMakeFiles/EVPath.dir/cm_formats.c.o.d"
+  "/root/repo/_derived_build/thirdparty/EVPath/EVPath/cm_interface.c" "thirdparty/EVPath/EVPath/CMakeFiles/EVPath.dir/cm_interface.c.o" "gcc" "thirdparty/EVPath/EVPath/CMakeFiles/EVPath.dir/cm_interface.c.o.d"
+  "/root/repo/thirdparty/EVPath/EVPath/cm_lock.c" "thirdparty/EVPath/EVPath/CMakeFiles/EVPath.dir/cm_lock.c.o" "gcc" "thirdparty/EVPath/EVPath/CMakeFiles/EVPath.dir/cm_lock.c.o.d"
+  "/root/repo/thirdparty/EVPath/EVPath/cm_pbio.c" "thirdparty/EVPath/EVPath/CMakeFiles/EVPath.dir/cm_pbio.c.o" "gcc" "thirdparty/EVPath/EVPath/CMakeFiles/EVPath.dir/cm_pbio.c.o.d"
+  "/root/repo/thirdparty/EVPath/EVPath/cm_perf.c" "thirdparty/EVPath/EVPath/CMakeFiles/EVPath.dir/cm_perf.c.o" "gcc" "thirdparty/EVPath/EVPath/CMakeFiles/EVPath.dir/cm_perf.c.o.d"
+  "/root/repo/thirdparty/EVPath/EVPath/cm_threadio.c" "thirdparty/EVPath/EVPath/CMakeFiles/EVPath.dir/cm_threadio.c.o" "gcc" "thirdparty/EVPath/EVPath/CMakeFiles/EVPath.dir/cm_threadio.c.o.d"
+  "/root/repo/thirdparty/EVPath/EVPath/cm_transport.c" "thirdparty/EVPath/EVPath/CMakeFiles/EVPath.dir/cm_transport.c.o" "gcc" "thirdparty/EVPath/EVPath/CMakeFiles/EVPath.dir/cm_transport.c.o.d"
+  "/root/repo/thirdparty/EVPath/EVPath/cm_util.c" "thirdparty/EVPath/EVPath/CMakeFiles/EVPath.dir/cm_util.c.o" "gcc" "thirdparty/EVPath/EVPath/CMakeFiles/EVPath.dir/cm_util.c.o.d"
+  "/root/repo/thirdparty/EVPath/EVPath/dlloader.c" "thirdparty/EVPath/EVPath/CMakeFiles/EVPath.dir/dlloader.c.o" "gcc" "thirdparty/EVPath/EVPath/CMakeFiles/EVPath.dir/dlloader.c.o.d"
+  "/root/repo/thirdparty/EVPath/EVPath/ev_dfg.c" "thirdparty/EVPath/EVPath/CMakeFiles/EVPath.dir/ev_dfg.c.o" "gcc" "thirdparty/EVPath/EVPath/CMakeFiles/EVPath.dir/ev_dfg.c.o.d"
+  "/root/repo/thirdparty/EVPath/EVPath/evp.c" "thirdparty/EVPath/EVPath/CMakeFiles/EVPath.dir/evp.c.o" "gcc" "thirdparty/EVPath/EVPath/CMakeFiles/EVPath.dir/evp.c.o.d"
+  "/root/repo/thirdparty/EVPath/EVPath/evp_compat.c" "thirdparty/EVPath/EVPath/CMakeFiles/EVPath.dir/evp_compat.c.o" "gcc" "thirdparty/EVPath/EVPath/CMakeFiles/EVPath.dir/evp_compat.c.o.d"
+  "/root/repo/thirdparty/EVPath/EVPath/evp_threads.c" "thirdparty/EVPath/EVPath/CMakeFiles/EVPath.dir/evp_threads.c.o" "gcc" "thirdparty/EVPath/EVPath/CMakeFiles/EVPath.dir/evp_threads.c.o.d"
+  "/root/repo/thirdparty/EVPath/EVPath/ip_config.c" "thirdparty/EVPath/EVPath/CMakeFiles/EVPath.dir/ip_config.c.o" "gcc" "thirdparty/EVPath/EVPath/CMakeFiles/EVPath.dir/ip_config.c.o.d"
+  "/root/repo/thirdparty/EVPath/EVPath/metrics.c" "thirdparty/EVPath/EVPath/CMakeFiles/EVPath.dir/metrics.c.o" "gcc" "thirdparty/EVPath/EVPath/CMakeFiles/EVPath.dir/metrics.c.o.d"
+  "/root/repo/thirdparty/EVPath/EVPath/response.c" "thirdparty/EVPath/EVPath/CMakeFiles/EVPath.dir/response.c.o" "gcc" "thirdparty/EVPath/EVPath/CMakeFiles/EVPath.dir/response.c.o.d"
+  "/root/repo/_derived_build/thirdparty/EVPath/EVPath/revp.c" "thirdparty/EVPath/EVPath/CMakeFiles/EVPath.dir/revp.c.o" "gcc" "thirdparty/EVPath/EVPath/CMakeFiles/EVPath.dir/revp.c.o.d"
+  "/root/repo/thirdparty/EVPath/EVPath/thin_server.c" "thirdparty/EVPath/EVPath/CMakeFiles/EVPath.dir/thin_server.c.o" "gcc" "thirdparty/EVPath/EVPath/CMakeFiles/EVPath.dir/thin_server.c.o.d"
+  "/root/repo/thirdparty/EVPath/EVPath/version.c" "thirdparty/EVPath/EVPath/CMakeFiles/EVPath.dir/version.c.o" "gcc" "thirdparty/EVPath/EVPath/CMakeFiles/EVPath.dir/version.c.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_derived_build/lib/libadios2_evpath.so" "/root/repo/_derived_build/lib/libadios2_evpath.so.2.10.0"
+  "/root/repo/_derived_build/lib/libadios2_evpath.so.2.10" "/root/repo/_derived_build/lib/libadios2_evpath.so.2.10.0"
+  "/root/repo/_derived_build/thirdparty/EVPath/EVPath/revp.c" "/root/repo/_derived_build/thirdparty/EVPath/EVPath/cm_interface.c"
+  "/root/repo/_derived_build/thirdparty/EVPath/EVPath/revp_internal.h" "/root/repo/_derived_build/thirdparty/EVPath/EVPath/cm_interface.c"
+  "/root/repo/_derived_build/thirdparty/EVPath/EVPath/revpath.h" "/root/repo/_derived_build/thirdparty/EVPath/EVPath/cm_interface.c"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_derived_build/thirdparty/ffs/ffs/CMakeFiles/ffs.dir/DependInfo.cmake"
+  "/root/repo/_derived_build/thirdparty/dill/dill/CMakeFiles/dill.dir/DependInfo.cmake"
+  "/root/repo/_derived_build/thirdparty/atl/atl/CMakeFiles/atl.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
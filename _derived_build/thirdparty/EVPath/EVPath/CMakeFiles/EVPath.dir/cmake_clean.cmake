@@ -0,0 +1,61 @@
+file(REMOVE_RECURSE
+  "../../../lib/libadios2_evpath.pdb"
+  "../../../lib/libadios2_evpath.so"
+  "../../../lib/libadios2_evpath.so.2.10"
+  "../../../lib/libadios2_evpath.so.2.10.0"
+  "CMakeFiles/EVPath.dir/chr_time.c.o"
+  "CMakeFiles/EVPath.dir/chr_time.c.o.d"
+  "CMakeFiles/EVPath.dir/cm.c.o"
+  "CMakeFiles/EVPath.dir/cm.c.o.d"
+  "CMakeFiles/EVPath.dir/cm_control.c.o"
+  "CMakeFiles/EVPath.dir/cm_control.c.o.d"
+  "CMakeFiles/EVPath.dir/cm_evol.c.o"
+  "CMakeFiles/EVPath.dir/cm_evol.c.o.d"
+  "CMakeFiles/EVPath.dir/cm_formats.c.o"
+  "CMakeFiles/EVPath.dir/cm_formats.c.o.d"
+  "CMakeFiles/EVPath.dir/cm_interface.c.o"
+  "CMakeFiles/EVPath.dir/cm_interface.c.o.d"
+  "CMakeFiles/EVPath.dir/cm_lock.c.o"
+  "CMakeFiles/EVPath.dir/cm_lock.c.o.d"
+  "CMakeFiles/EVPath.dir/cm_pbio.c.o"
+  "CMakeFiles/EVPath.dir/cm_pbio.c.o.d"
+  "CMakeFiles/EVPath.dir/cm_perf.c.o"
+  "CMakeFiles/EVPath.dir/cm_perf.c.o.d"
+  "CMakeFiles/EVPath.dir/cm_threadio.c.o"
+  "CMakeFiles/EVPath.dir/cm_threadio.c.o.d"
+  "CMakeFiles/EVPath.dir/cm_transport.c.o"
+  "CMakeFiles/EVPath.dir/cm_transport.c.o.d"
+  "CMakeFiles/EVPath.dir/cm_util.c.o"
+  "CMakeFiles/EVPath.dir/cm_util.c.o.d"
+  "CMakeFiles/EVPath.dir/dlloader.c.o"
+  "CMakeFiles/EVPath.dir/dlloader.c.o.d"
+  "CMakeFiles/EVPath.dir/ev_dfg.c.o"
+  "CMakeFiles/EVPath.dir/ev_dfg.c.o.d"
+  "CMakeFiles/EVPath.dir/evp.c.o"
+  "CMakeFiles/EVPath.dir/evp.c.o.d"
+  "CMakeFiles/EVPath.dir/evp_compat.c.o"
+  "CMakeFiles/EVPath.dir/evp_compat.c.o.d"
+  "CMakeFiles/EVPath.dir/evp_threads.c.o"
+  "CMakeFiles/EVPath.dir/evp_threads.c.o.d"
+  "CMakeFiles/EVPath.dir/ip_config.c.o"
+  "CMakeFiles/EVPath.dir/ip_config.c.o.d"
+  "CMakeFiles/EVPath.dir/metrics.c.o"
+  "CMakeFiles/EVPath.dir/metrics.c.o.d"
+  "CMakeFiles/EVPath.dir/response.c.o"
+  "CMakeFiles/EVPath.dir/response.c.o.d"
+  "CMakeFiles/EVPath.dir/revp.c.o"
+  "CMakeFiles/EVPath.dir/revp.c.o.d"
+  "CMakeFiles/EVPath.dir/thin_server.c.o"
+  "CMakeFiles/EVPath.dir/thin_server.c.o.d"
+  "CMakeFiles/EVPath.dir/version.c.o"
+  "CMakeFiles/EVPath.dir/version.c.o.d"
+  "cm_interface.c"
+  "revp.c"
+  "revp_internal.h"
+  "revpath.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/EVPath.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
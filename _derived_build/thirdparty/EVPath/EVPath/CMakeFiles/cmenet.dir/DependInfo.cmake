@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/thirdparty/EVPath/EVPath/cmenet.c" "thirdparty/EVPath/EVPath/CMakeFiles/cmenet.dir/cmenet.c.o" "gcc" "thirdparty/EVPath/EVPath/CMakeFiles/cmenet.dir/cmenet.c.o.d"
+  "/root/repo/thirdparty/EVPath/EVPath/ip_config.c" "thirdparty/EVPath/EVPath/CMakeFiles/cmenet.dir/ip_config.c.o" "gcc" "thirdparty/EVPath/EVPath/CMakeFiles/cmenet.dir/ip_config.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_derived_build/thirdparty/atl/atl/CMakeFiles/atl.dir/DependInfo.cmake"
+  "/root/repo/_derived_build/thirdparty/enet/enet/CMakeFiles/enet.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cmenet.dir/cmenet.c.o"
+  "CMakeFiles/cmenet.dir/cmenet.c.o.d"
+  "CMakeFiles/cmenet.dir/ip_config.c.o"
+  "CMakeFiles/cmenet.dir/ip_config.c.o.d"
+  "lib/adios2-evpath-modules-2_10/libadios2_cmenet.pdb"
+  "lib/adios2-evpath-modules-2_10/libadios2_cmenet.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/cmenet.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
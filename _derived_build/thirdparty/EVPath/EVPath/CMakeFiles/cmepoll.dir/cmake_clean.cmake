@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cmepoll.dir/cmepoll.c.o"
+  "CMakeFiles/cmepoll.dir/cmepoll.c.o.d"
+  "lib/adios2-evpath-modules-2_10/libadios2_cmepoll.pdb"
+  "lib/adios2-evpath-modules-2_10/libadios2_cmepoll.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/cmepoll.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cmmulticast.dir/cmmulticast.c.o"
+  "CMakeFiles/cmmulticast.dir/cmmulticast.c.o.d"
+  "lib/adios2-evpath-modules-2_10/libadios2_cmmulticast.pdb"
+  "lib/adios2-evpath-modules-2_10/libadios2_cmmulticast.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/cmmulticast.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cmselect.dir/cmselect.c.o"
+  "CMakeFiles/cmselect.dir/cmselect.c.o.d"
+  "lib/adios2-evpath-modules-2_10/libadios2_cmselect.pdb"
+  "lib/adios2-evpath-modules-2_10/libadios2_cmselect.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/cmselect.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
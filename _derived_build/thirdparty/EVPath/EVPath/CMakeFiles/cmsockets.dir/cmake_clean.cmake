@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cmsockets.dir/cmsockets.c.o"
+  "CMakeFiles/cmsockets.dir/cmsockets.c.o.d"
+  "CMakeFiles/cmsockets.dir/ip_config.c.o"
+  "CMakeFiles/cmsockets.dir/ip_config.c.o.d"
+  "lib/adios2-evpath-modules-2_10/libadios2_cmsockets.pdb"
+  "lib/adios2-evpath-modules-2_10/libadios2_cmsockets.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/cmsockets.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cmudp.dir/cmudp.c.o"
+  "CMakeFiles/cmudp.dir/cmudp.c.o.d"
+  "lib/adios2-evpath-modules-2_10/libadios2_cmudp.pdb"
+  "lib/adios2-evpath-modules-2_10/libadios2_cmudp.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/cmudp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/thirdparty/GTest/googletest/googletest
+# Build directory: /root/repo/_derived_build/thirdparty/GTest/googletest/googletest
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
@@ -0,0 +1,28 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/thirdparty/KWSys/adios2sys/EncodingC.c" "thirdparty/KWSys/adios2sys/CMakeFiles/adios2sys_objects.dir/EncodingC.c.o" "gcc" "thirdparty/KWSys/adios2sys/CMakeFiles/adios2sys_objects.dir/EncodingC.c.o.d"
+  "/root/repo/thirdparty/KWSys/adios2sys/MD5.c" "thirdparty/KWSys/adios2sys/CMakeFiles/adios2sys_objects.dir/MD5.c.o" "gcc" "thirdparty/KWSys/adios2sys/CMakeFiles/adios2sys_objects.dir/MD5.c.o.d"
+  "/root/repo/thirdparty/KWSys/adios2sys/CommandLineArguments.cxx" "thirdparty/KWSys/adios2sys/CMakeFiles/adios2sys_objects.dir/CommandLineArguments.cxx.o" "gcc" "thirdparty/KWSys/adios2sys/CMakeFiles/adios2sys_objects.dir/CommandLineArguments.cxx.o.d"
+  "/root/repo/thirdparty/KWSys/adios2sys/Directory.cxx" "thirdparty/KWSys/adios2sys/CMakeFiles/adios2sys_objects.dir/Directory.cxx.o" "gcc" "thirdparty/KWSys/adios2sys/CMakeFiles/adios2sys_objects.dir/Directory.cxx.o.d"
+  "/root/repo/thirdparty/KWSys/adios2sys/DynamicLoader.cxx" "thirdparty/KWSys/adios2sys/CMakeFiles/adios2sys_objects.dir/DynamicLoader.cxx.o" "gcc" "thirdparty/KWSys/adios2sys/CMakeFiles/adios2sys_objects.dir/DynamicLoader.cxx.o.d"
+  "/root/repo/thirdparty/KWSys/adios2sys/EncodingCXX.cxx" "thirdparty/KWSys/adios2sys/CMakeFiles/adios2sys_objects.dir/EncodingCXX.cxx.o" "gcc" "thirdparty/KWSys/adios2sys/CMakeFiles/adios2sys_objects.dir/EncodingCXX.cxx.o.d"
+  "/root/repo/thirdparty/KWSys/adios2sys/FStream.cxx" "thirdparty/KWSys/adios2sys/CMakeFiles/adios2sys_objects.dir/FStream.cxx.o" "gcc" "thirdparty/KWSys/adios2sys/CMakeFiles/adios2sys_objects.dir/FStream.cxx.o.d"
+  "/root/repo/thirdparty/KWSys/adios2sys/RegularExpression.cxx" "thirdparty/KWSys/adios2sys/CMakeFiles/adios2sys_objects.dir/RegularExpression.cxx.o" "gcc" "thirdparty/KWSys/adios2sys/CMakeFiles/adios2sys_objects.dir/RegularExpression.cxx.o.d"
+  "/root/repo/thirdparty/KWSys/adios2sys/Status.cxx" "thirdparty/KWSys/adios2sys/CMakeFiles/adios2sys_objects.dir/Status.cxx.o" "gcc" "thirdparty/KWSys/adios2sys/CMakeFiles/adios2sys_objects.dir/Status.cxx.o.d"
+  "/root/repo/thirdparty/KWSys/adios2sys/SystemTools.cxx" "thirdparty/KWSys/adios2sys/CMakeFiles/adios2sys_objects.dir/SystemTools.cxx.o" "gcc" "thirdparty/KWSys/adios2sys/CMakeFiles/adios2sys_objects.dir/SystemTools.cxx.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,27 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/adios2sys_objects.dir/CommandLineArguments.cxx.o"
+  "CMakeFiles/adios2sys_objects.dir/CommandLineArguments.cxx.o.d"
+  "CMakeFiles/adios2sys_objects.dir/Directory.cxx.o"
+  "CMakeFiles/adios2sys_objects.dir/Directory.cxx.o.d"
+  "CMakeFiles/adios2sys_objects.dir/DynamicLoader.cxx.o"
+  "CMakeFiles/adios2sys_objects.dir/DynamicLoader.cxx.o.d"
+  "CMakeFiles/adios2sys_objects.dir/EncodingC.c.o"
+  "CMakeFiles/adios2sys_objects.dir/EncodingC.c.o.d"
+  "CMakeFiles/adios2sys_objects.dir/EncodingCXX.cxx.o"
+  "CMakeFiles/adios2sys_objects.dir/EncodingCXX.cxx.o.d"
+  "CMakeFiles/adios2sys_objects.dir/FStream.cxx.o"
+  "CMakeFiles/adios2sys_objects.dir/FStream.cxx.o.d"
+  "CMakeFiles/adios2sys_objects.dir/MD5.c.o"
+  "CMakeFiles/adios2sys_objects.dir/MD5.c.o.d"
+  "CMakeFiles/adios2sys_objects.dir/RegularExpression.cxx.o"
+  "CMakeFiles/adios2sys_objects.dir/RegularExpression.cxx.o.d"
+  "CMakeFiles/adios2sys_objects.dir/Status.cxx.o"
+  "CMakeFiles/adios2sys_objects.dir/Status.cxx.o.d"
+  "CMakeFiles/adios2sys_objects.dir/SystemTools.cxx.o"
+  "CMakeFiles/adios2sys_objects.dir/SystemTools.cxx.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/adios2sys_objects.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
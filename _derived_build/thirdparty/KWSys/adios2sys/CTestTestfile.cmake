@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/thirdparty/KWSys/adios2sys
+# Build directory: /root/repo/_derived_build/thirdparty/KWSys/adios2sys
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
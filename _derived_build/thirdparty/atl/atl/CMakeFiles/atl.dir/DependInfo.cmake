@@ -0,0 +1,29 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/thirdparty/atl/atl/atom.c" "thirdparty/atl/atl/CMakeFiles/atl.dir/atom.c.o" "gcc" "thirdparty/atl/atl/CMakeFiles/atl.dir/atom.c.o.d"
+  "/root/repo/thirdparty/atl/atl/attr.c" "thirdparty/atl/atl/CMakeFiles/atl.dir/attr.c.o" "gcc" "thirdparty/atl/atl/CMakeFiles/atl.dir/attr.c.o.d"
+  "/root/repo/thirdparty/atl/atl/lookup3.c" "thirdparty/atl/atl/CMakeFiles/atl.dir/lookup3.c.o" "gcc" "thirdparty/atl/atl/CMakeFiles/atl.dir/lookup3.c.o.d"
+  "/root/repo/thirdparty/atl/atl/tclHash.c" "thirdparty/atl/atl/CMakeFiles/atl.dir/tclHash.c.o" "gcc" "thirdparty/atl/atl/CMakeFiles/atl.dir/tclHash.c.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_derived_build/lib/libadios2_atl.so" "/root/repo/_derived_build/lib/libadios2_atl.so.2.10.0"
+  "/root/repo/_derived_build/lib/libadios2_atl.so.2.10" "/root/repo/_derived_build/lib/libadios2_atl.so.2.10.0"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "../../../lib/libadios2_atl.pdb"
+  "../../../lib/libadios2_atl.so"
+  "../../../lib/libadios2_atl.so.2.10"
+  "../../../lib/libadios2_atl.so.2.10.0"
+  "CMakeFiles/atl.dir/atom.c.o"
+  "CMakeFiles/atl.dir/atom.c.o.d"
+  "CMakeFiles/atl.dir/attr.c.o"
+  "CMakeFiles/atl.dir/attr.c.o.d"
+  "CMakeFiles/atl.dir/lookup3.c.o"
+  "CMakeFiles/atl.dir/lookup3.c.o.d"
+  "CMakeFiles/atl.dir/tclHash.c.o"
+  "CMakeFiles/atl.dir/tclHash.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/atl.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
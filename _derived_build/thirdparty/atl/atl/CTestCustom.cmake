@@ -0,0 +1,15 @@
+set(CTEST_CUSTOM_MAXIMUM_NUMBER_OF_ERRORS 1000)
+set(CTEST_CUSTOM_MAXIMUM_NUMBER_OF_WARNINGS 1000)
+set(CTEST_CUSTOM_MAXIMUM_PASSED_TEST_OUTPUT_SIZE 1048576)
+set(CTEST_CUSTOM_MAXIMUM_FAILED_TEST_OUTPUT_SIZE 1048576)
+
+list(APPEND CTEST_CUSTOM_WARNING_EXCEPTION
+  "warning:.*__d0"
+  "warning:.*__d1"
+)
+
+list(APPEND CTEST_CUSTOM_COVERAGE_EXCLUDE
+)
+
+list(APPEND CTEST_CUSTOM_TESTS_IGNORE
+)
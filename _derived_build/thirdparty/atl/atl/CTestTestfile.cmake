@@ -0,0 +1,7 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/thirdparty/atl/atl
+# Build directory: /root/repo/_derived_build/thirdparty/atl/atl
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+set_directory_properties(PROPERTIES LABELS "ATL")
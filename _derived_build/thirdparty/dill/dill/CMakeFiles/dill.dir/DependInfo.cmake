@@ -0,0 +1,38 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/_derived_build/thirdparty/dill/dill/dill.c" "thirdparty/dill/dill/CMakeFiles/dill.dir/dill.c.o" "gcc" "thirdparty/dill/dill/CMakeFiles/dill.dir/dill.c.o.d"
+  "/root/repo/thirdparty/dill/dill/dill_cplus.c" "thirdparty/dill/dill/CMakeFiles/dill.dir/dill_cplus.c.o" "gcc" "thirdparty/dill/dill/CMakeFiles/dill.dir/dill_cplus.c.o.d"
+  "/root/repo/thirdparty/dill/dill/dill_pkg.c" "thirdparty/dill/dill/CMakeFiles/dill.dir/dill_pkg.c.o" "gcc" "thirdparty/dill/dill/CMakeFiles/dill.dir/dill_pkg.c.o.d"
+  "/root/repo/thirdparty/dill/dill/dill_util.c" "thirdparty/dill/dill/CMakeFiles/dill.dir/dill_util.c.o" "gcc" "thirdparty/dill/dill/CMakeFiles/dill.dir/dill_util.c.o.d"
+  "/root/repo/_derived_build/thirdparty/dill/dill/dill_virtual.c" "thirdparty/dill/dill/CMakeFiles/dill.dir/dill_virtual.c.o" "gcc" "thirdparty/dill/dill/CMakeFiles/dill.dir/dill_virtual.c.o.d"
+  "/root/repo/_derived_build/thirdparty/dill/dill/dill_x86_64.c" "thirdparty/dill/dill/CMakeFiles/dill.dir/dill_x86_64.c.o" "gcc" "thirdparty/dill/dill/CMakeFiles/dill.dir/dill_x86_64.c.o.d"
+  "/root/repo/thirdparty/dill/dill/virtual.c" "thirdparty/dill/dill/CMakeFiles/dill.dir/virtual.c.o" "gcc" "thirdparty/dill/dill/CMakeFiles/dill.dir/virtual.c.o.d"
+  "/root/repo/thirdparty/dill/dill/vm.c" "thirdparty/dill/dill/CMakeFiles/dill.dir/vm.c.o" "gcc" "thirdparty/dill/dill/CMakeFiles/dill.dir/vm.c.o.d"
+  "/root/repo/thirdparty/dill/dill/x86_64.c" "thirdparty/dill/dill/CMakeFiles/dill.dir/x86_64.c.o" "gcc" "thirdparty/dill/dill/CMakeFiles/dill.dir/x86_64.c.o.d"
+  "/root/repo/thirdparty/dill/dill/x86_64_disassembler.c" "thirdparty/dill/dill/CMakeFiles/dill.dir/x86_64_disassembler.c.o" "gcc" "thirdparty/dill/dill/CMakeFiles/dill.dir/x86_64_disassembler.c.o.d"
+  "/root/repo/thirdparty/dill/dill/x86_64_rt.c" "thirdparty/dill/dill/CMakeFiles/dill.dir/x86_64_rt.c.o" "gcc" "thirdparty/dill/dill/CMakeFiles/dill.dir/x86_64_rt.c.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_derived_build/lib/libadios2_dill.so" "/root/repo/_derived_build/lib/libadios2_dill.so.2.10.0"
+  "/root/repo/_derived_build/lib/libadios2_dill.so.2.10" "/root/repo/_derived_build/lib/libadios2_dill.so.2.10.0"
+  "/root/repo/_derived_build/thirdparty/dill/dill/dill.c" "/root/repo/_derived_build/thirdparty/dill/dill/dill.h"
+  "/root/repo/_derived_build/thirdparty/dill/dill/vm_include.c" "/root/repo/_derived_build/thirdparty/dill/dill/dill_virtual.c"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
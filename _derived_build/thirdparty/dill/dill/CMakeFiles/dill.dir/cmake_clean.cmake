@@ -0,0 +1,38 @@
+file(REMOVE_RECURSE
+  "../../../lib/libadios2_dill.pdb"
+  "../../../lib/libadios2_dill.so"
+  "../../../lib/libadios2_dill.so.2.10"
+  "../../../lib/libadios2_dill.so.2.10.0"
+  "CMakeFiles/dill.dir/dill.c.o"
+  "CMakeFiles/dill.dir/dill.c.o.d"
+  "CMakeFiles/dill.dir/dill_cplus.c.o"
+  "CMakeFiles/dill.dir/dill_cplus.c.o.d"
+  "CMakeFiles/dill.dir/dill_pkg.c.o"
+  "CMakeFiles/dill.dir/dill_pkg.c.o.d"
+  "CMakeFiles/dill.dir/dill_util.c.o"
+  "CMakeFiles/dill.dir/dill_util.c.o.d"
+  "CMakeFiles/dill.dir/dill_virtual.c.o"
+  "CMakeFiles/dill.dir/dill_virtual.c.o.d"
+  "CMakeFiles/dill.dir/dill_x86_64.c.o"
+  "CMakeFiles/dill.dir/dill_x86_64.c.o.d"
+  "CMakeFiles/dill.dir/virtual.c.o"
+  "CMakeFiles/dill.dir/virtual.c.o.d"
+  "CMakeFiles/dill.dir/vm.c.o"
+  "CMakeFiles/dill.dir/vm.c.o.d"
+  "CMakeFiles/dill.dir/x86_64.c.o"
+  "CMakeFiles/dill.dir/x86_64.c.o.d"
+  "CMakeFiles/dill.dir/x86_64_disassembler.c.o"
+  "CMakeFiles/dill.dir/x86_64_disassembler.c.o.d"
+  "CMakeFiles/dill.dir/x86_64_rt.c.o"
+  "CMakeFiles/dill.dir/x86_64_rt.c.o.d"
+  "dill.c"
+  "dill.h"
+  "dill_virtual.c"
+  "dill_x86_64.c"
+  "vm_include.c"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dill.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/generate_vm_include"
+  "dill_virtual.c"
+  "vm_include.c"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/generate_vm_include.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
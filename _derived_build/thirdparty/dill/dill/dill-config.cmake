@@ -0,0 +1,15 @@
+set(_DILL_CMAKE_MODULE_PATH ${CMAKE_MODULE_PATH})
+set(_DILL_CMAKE_PREFIX_PATH ${CMAKE_PREFIX_PATH})
+
+list(INSERT CMAKE_MODULE_PATH 0 "/root/repo/thirdparty/dill/dill/cmake")
+if(NOT ON AND OFF)
+  list(INSERT CMAKE_PREFIX_PATH 0 "")
+endif()
+
+set(${CMAKE_FIND_PACKAGE_NAME}_CONFIG "${CMAKE_CURRENT_LIST_FILE}")
+include("${CMAKE_CURRENT_LIST_DIR}/dill-config-common.cmake")
+
+set(CMAKE_MODULE_PATH ${_DILL_CMAKE_MODULE_PATH})
+set(CMAKE_PREFIX_PATH ${_DILL_CMAKE_PREFIX_PATH})
+unset(_DILL_CMAKE_MODULE_PATH)
+unset(_DILL_CMAKE_PREFIX_PATH)
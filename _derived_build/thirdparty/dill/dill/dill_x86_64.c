@@ -0,0 +1,912 @@
+/* This file is generated from x86_64.ops.  Do not edit directly. */
+
+#include "config.h"
+#include "dill.h"
+#include "dill_internal.h"
+#include "x86_64.h"
+DECLARE_JUMP_TABLE(x86_64);
+#ifdef __has_feature
+#if __has_feature(thread_sanitizer)
+#define NO_SANITIZE_THREAD __attribute__((no_sanitize("thread")))
+#endif
+#endif
+#ifndef NO_SANITIZE_THREAD
+#define NO_SANITIZE_THREAD
+#endif
+extern void NO_SANITIZE_THREAD dill_x86_64_init(dill_stream s)
+{
+	  FILL_JUMP_STRUCTURE(x86_64);
+	  x86_64_jump_table->jmp_a3[dill_jmp_addi] = x86_64_arith3;
+	  x86_64_jump_table->a3_data[dill_jmp_addi].data1 = 0x03;
+	  x86_64_jump_table->a3_data[dill_jmp_addi].data2 = DILL_I;
+	  x86_64_jump_table->jmp_a3[dill_jmp_addu] = x86_64_arith3;
+	  x86_64_jump_table->a3_data[dill_jmp_addu].data1 = 0x03;
+	  x86_64_jump_table->a3_data[dill_jmp_addu].data2 = DILL_U;
+	  x86_64_jump_table->jmp_a3[dill_jmp_addul] = x86_64_arith3;
+	  x86_64_jump_table->a3_data[dill_jmp_addul].data1 = 0x03;
+	  x86_64_jump_table->a3_data[dill_jmp_addul].data2 = DILL_UL;
+	  x86_64_jump_table->jmp_a3[dill_jmp_addl] = x86_64_arith3;
+	  x86_64_jump_table->a3_data[dill_jmp_addl].data1 = 0x03;
+	  x86_64_jump_table->a3_data[dill_jmp_addl].data2 = DILL_L;
+	  x86_64_jump_table->jmp_a3[dill_jmp_addp] = x86_64_arith3;
+	  x86_64_jump_table->a3_data[dill_jmp_addp].data1 = 0x03;
+	  x86_64_jump_table->a3_data[dill_jmp_addp].data2 = DILL_P;
+	  x86_64_jump_table->jmp_a3[dill_jmp_subi] = x86_64_arith3;
+	  x86_64_jump_table->a3_data[dill_jmp_subi].data1 = 0x2b;
+	  x86_64_jump_table->a3_data[dill_jmp_subi].data2 = DILL_I;
+	  x86_64_jump_table->jmp_a3[dill_jmp_subu] = x86_64_arith3;
+	  x86_64_jump_table->a3_data[dill_jmp_subu].data1 = 0x2b;
+	  x86_64_jump_table->a3_data[dill_jmp_subu].data2 = DILL_U;
+	  x86_64_jump_table->jmp_a3[dill_jmp_subul] = x86_64_arith3;
+	  x86_64_jump_table->a3_data[dill_jmp_subul].data1 = 0x2b;
+	  x86_64_jump_table->a3_data[dill_jmp_subul].data2 = DILL_UL;
+	  x86_64_jump_table->jmp_a3[dill_jmp_subl] = x86_64_arith3;
+	  x86_64_jump_table->a3_data[dill_jmp_subl].data1 = 0x2b;
+	  x86_64_jump_table->a3_data[dill_jmp_subl].data2 = DILL_L;
+	  x86_64_jump_table->jmp_a3[dill_jmp_subp] = x86_64_arith3;
+	  x86_64_jump_table->a3_data[dill_jmp_subp].data1 = 0x2b;
+	  x86_64_jump_table->a3_data[dill_jmp_subp].data2 = DILL_P;
+	  x86_64_jump_table->jmp_a3[dill_jmp_mulu] = (arith_op3)x86_64_mul;
+	  x86_64_jump_table->a3_data[dill_jmp_mulu].data1 = 0 /*unsigned*/;
+	  x86_64_jump_table->a3_data[dill_jmp_mulu].data2 = 0;
+	  x86_64_jump_table->jmp_a3[dill_jmp_mulul] = (arith_op3)x86_64_mul;
+	  x86_64_jump_table->a3_data[dill_jmp_mulul].data1 = 0 /*unsigned*/;
+	  x86_64_jump_table->a3_data[dill_jmp_mulul].data2 = 0;
+	  x86_64_jump_table->jmp_a3[dill_jmp_muli] = (arith_op3)x86_64_mul;
+	  x86_64_jump_table->a3_data[dill_jmp_muli].data1 = 1 /*signed*/;
+	  x86_64_jump_table->a3_data[dill_jmp_muli].data2 = 0;
+	  x86_64_jump_table->jmp_a3[dill_jmp_mull] = (arith_op3)x86_64_mul;
+	  x86_64_jump_table->a3_data[dill_jmp_mull].data1 = 1 /*signed*/;
+	  x86_64_jump_table->a3_data[dill_jmp_mull].data2 = 0;
+	  x86_64_jump_table->jmp_a3[dill_jmp_divu] = x86_64_div_mod;
+	  x86_64_jump_table->a3_data[dill_jmp_divu].data1 = 1;
+	  x86_64_jump_table->a3_data[dill_jmp_divu].data2 = DILL_U;
+	  x86_64_jump_table->jmp_a3[dill_jmp_divul] = x86_64_div_mod;
+	  x86_64_jump_table->a3_data[dill_jmp_divul].data1 = 1;
+	  x86_64_jump_table->a3_data[dill_jmp_divul].data2 = DILL_UL;
+	  x86_64_jump_table->jmp_a3[dill_jmp_divi] = x86_64_div_mod;
+	  x86_64_jump_table->a3_data[dill_jmp_divi].data1 = 1;
+	  x86_64_jump_table->a3_data[dill_jmp_divi].data2 = DILL_I;
+	  x86_64_jump_table->jmp_a3[dill_jmp_divl] = x86_64_div_mod;
+	  x86_64_jump_table->a3_data[dill_jmp_divl].data1 = 1;
+	  x86_64_jump_table->a3_data[dill_jmp_divl].data2 = DILL_L;
+	  x86_64_jump_table->jmp_a3[dill_jmp_modu] = x86_64_div_mod;
+	  x86_64_jump_table->a3_data[dill_jmp_modu].data1 = 0;
+	  x86_64_jump_table->a3_data[dill_jmp_modu].data2 = DILL_U;
+	  x86_64_jump_table->jmp_a3[dill_jmp_modul] = x86_64_div_mod;
+	  x86_64_jump_table->a3_data[dill_jmp_modul].data1 = 0;
+	  x86_64_jump_table->a3_data[dill_jmp_modul].data2 = DILL_UL;
+	  x86_64_jump_table->jmp_a3[dill_jmp_modi] = x86_64_div_mod;
+	  x86_64_jump_table->a3_data[dill_jmp_modi].data1 = 0;
+	  x86_64_jump_table->a3_data[dill_jmp_modi].data2 = DILL_I;
+	  x86_64_jump_table->jmp_a3[dill_jmp_modl] = x86_64_div_mod;
+	  x86_64_jump_table->a3_data[dill_jmp_modl].data1 = 0;
+	  x86_64_jump_table->a3_data[dill_jmp_modl].data2 = DILL_L;
+	  x86_64_jump_table->jmp_a3[dill_jmp_andi] = x86_64_arith3;
+	  x86_64_jump_table->a3_data[dill_jmp_andi].data1 = 0x23;
+	  x86_64_jump_table->a3_data[dill_jmp_andi].data2 = DILL_I;
+	  x86_64_jump_table->jmp_a3[dill_jmp_andu] = x86_64_arith3;
+	  x86_64_jump_table->a3_data[dill_jmp_andu].data1 = 0x23;
+	  x86_64_jump_table->a3_data[dill_jmp_andu].data2 = DILL_U;
+	  x86_64_jump_table->jmp_a3[dill_jmp_andul] = x86_64_arith3;
+	  x86_64_jump_table->a3_data[dill_jmp_andul].data1 = 0x23;
+	  x86_64_jump_table->a3_data[dill_jmp_andul].data2 = DILL_UL;
+	  x86_64_jump_table->jmp_a3[dill_jmp_andl] = x86_64_arith3;
+	  x86_64_jump_table->a3_data[dill_jmp_andl].data1 = 0x23;
+	  x86_64_jump_table->a3_data[dill_jmp_andl].data2 = DILL_L;
+	  x86_64_jump_table->jmp_a3[dill_jmp_ori] = x86_64_arith3;
+	  x86_64_jump_table->a3_data[dill_jmp_ori].data1 = 0x0b;
+	  x86_64_jump_table->a3_data[dill_jmp_ori].data2 = DILL_I;
+	  x86_64_jump_table->jmp_a3[dill_jmp_oru] = x86_64_arith3;
+	  x86_64_jump_table->a3_data[dill_jmp_oru].data1 = 0x0b;
+	  x86_64_jump_table->a3_data[dill_jmp_oru].data2 = DILL_U;
+	  x86_64_jump_table->jmp_a3[dill_jmp_orul] = x86_64_arith3;
+	  x86_64_jump_table->a3_data[dill_jmp_orul].data1 = 0x0b;
+	  x86_64_jump_table->a3_data[dill_jmp_orul].data2 = DILL_UL;
+	  x86_64_jump_table->jmp_a3[dill_jmp_orl] = x86_64_arith3;
+	  x86_64_jump_table->a3_data[dill_jmp_orl].data1 = 0x0b;
+	  x86_64_jump_table->a3_data[dill_jmp_orl].data2 = DILL_L;
+	  x86_64_jump_table->jmp_a3[dill_jmp_xori] = x86_64_arith3;
+	  x86_64_jump_table->a3_data[dill_jmp_xori].data1 = 0x33;
+	  x86_64_jump_table->a3_data[dill_jmp_xori].data2 = DILL_I;
+	  x86_64_jump_table->jmp_a3[dill_jmp_xoru] = x86_64_arith3;
+	  x86_64_jump_table->a3_data[dill_jmp_xoru].data1 = 0x33;
+	  x86_64_jump_table->a3_data[dill_jmp_xoru].data2 = DILL_U;
+	  x86_64_jump_table->jmp_a3[dill_jmp_xorul] = x86_64_arith3;
+	  x86_64_jump_table->a3_data[dill_jmp_xorul].data1 = 0x33;
+	  x86_64_jump_table->a3_data[dill_jmp_xorul].data2 = DILL_UL;
+	  x86_64_jump_table->jmp_a3[dill_jmp_xorl] = x86_64_arith3;
+	  x86_64_jump_table->a3_data[dill_jmp_xorl].data1 = 0x33;
+	  x86_64_jump_table->a3_data[dill_jmp_xorl].data2 = DILL_L;
+	  x86_64_jump_table->jmp_a3[dill_jmp_lshi] = x86_64_shift;
+	  x86_64_jump_table->a3_data[dill_jmp_lshi].data1 = 0x4;
+	  x86_64_jump_table->a3_data[dill_jmp_lshi].data2 = DILL_I;
+	  x86_64_jump_table->jmp_a3[dill_jmp_lshu] = x86_64_shift;
+	  x86_64_jump_table->a3_data[dill_jmp_lshu].data1 = 0x4;
+	  x86_64_jump_table->a3_data[dill_jmp_lshu].data2 = DILL_U;
+	  x86_64_jump_table->jmp_a3[dill_jmp_lshul] = x86_64_shift;
+	  x86_64_jump_table->a3_data[dill_jmp_lshul].data1 = 0x4;
+	  x86_64_jump_table->a3_data[dill_jmp_lshul].data2 = DILL_UL;
+	  x86_64_jump_table->jmp_a3[dill_jmp_lshl] = x86_64_shift;
+	  x86_64_jump_table->a3_data[dill_jmp_lshl].data1 = 0x4;
+	  x86_64_jump_table->a3_data[dill_jmp_lshl].data2 = DILL_L;
+	  x86_64_jump_table->jmp_a3[dill_jmp_rshi] = x86_64_shift;
+	  x86_64_jump_table->a3_data[dill_jmp_rshi].data1 = 0x7;
+	  x86_64_jump_table->a3_data[dill_jmp_rshi].data2 = DILL_I;
+	  x86_64_jump_table->jmp_a3[dill_jmp_rshl] = x86_64_shift;
+	  x86_64_jump_table->a3_data[dill_jmp_rshl].data1 = 0x7;
+	  x86_64_jump_table->a3_data[dill_jmp_rshl].data2 = DILL_L;
+	  x86_64_jump_table->jmp_a3[dill_jmp_rshu] = x86_64_shift;
+	  x86_64_jump_table->a3_data[dill_jmp_rshu].data1 = 0x5;
+	  x86_64_jump_table->a3_data[dill_jmp_rshu].data2 = DILL_U;
+	  x86_64_jump_table->jmp_a3[dill_jmp_rshul] = x86_64_shift;
+	  x86_64_jump_table->a3_data[dill_jmp_rshul].data1 = 0x5;
+	  x86_64_jump_table->a3_data[dill_jmp_rshul].data2 = DILL_UL;
+	  x86_64_jump_table->jmp_a3[dill_jmp_addf] = x86_64_farith;
+	  x86_64_jump_table->a3_data[dill_jmp_addf].data1 = 0x58;
+	  x86_64_jump_table->a3_data[dill_jmp_addf].data2 = DILL_F;
+	  x86_64_jump_table->jmp_a3[dill_jmp_addd] = x86_64_farith;
+	  x86_64_jump_table->a3_data[dill_jmp_addd].data1 = 0x58;
+	  x86_64_jump_table->a3_data[dill_jmp_addd].data2 = DILL_D;
+	  x86_64_jump_table->jmp_a3[dill_jmp_subf] = x86_64_farith;
+	  x86_64_jump_table->a3_data[dill_jmp_subf].data1 = 0x5c;
+	  x86_64_jump_table->a3_data[dill_jmp_subf].data2 = DILL_F;
+	  x86_64_jump_table->jmp_a3[dill_jmp_subd] = x86_64_farith;
+	  x86_64_jump_table->a3_data[dill_jmp_subd].data1 = 0x5c;
+	  x86_64_jump_table->a3_data[dill_jmp_subd].data2 = DILL_D;
+	  x86_64_jump_table->jmp_a3[dill_jmp_mulf] = x86_64_farith;
+	  x86_64_jump_table->a3_data[dill_jmp_mulf].data1 = 0x59;
+	  x86_64_jump_table->a3_data[dill_jmp_mulf].data2 = DILL_F;
+	  x86_64_jump_table->jmp_a3[dill_jmp_muld] = x86_64_farith;
+	  x86_64_jump_table->a3_data[dill_jmp_muld].data1 = 0x59;
+	  x86_64_jump_table->a3_data[dill_jmp_muld].data2 = DILL_D;
+	  x86_64_jump_table->jmp_a3[dill_jmp_divf] = x86_64_farith;
+	  x86_64_jump_table->a3_data[dill_jmp_divf].data1 = 0x5e;
+	  x86_64_jump_table->a3_data[dill_jmp_divf].data2 = DILL_F;
+	  x86_64_jump_table->jmp_a3[dill_jmp_divd] = x86_64_farith;
+	  x86_64_jump_table->a3_data[dill_jmp_divd].data1 = 0x5e;
+	  x86_64_jump_table->a3_data[dill_jmp_divd].data2 = DILL_D;
+	  x86_64_jump_table->jmp_a3i[dill_jmp_addi] = x86_64_arith3i;
+	  x86_64_jump_table->a3i_data[dill_jmp_addi].data1 = 0x0;
+	  x86_64_jump_table->a3i_data[dill_jmp_addi].data2 = DILL_I;
+	  x86_64_jump_table->jmp_a3i[dill_jmp_addu] = x86_64_arith3i;
+	  x86_64_jump_table->a3i_data[dill_jmp_addu].data1 = 0x0;
+	  x86_64_jump_table->a3i_data[dill_jmp_addu].data2 = DILL_U;
+	  x86_64_jump_table->jmp_a3i[dill_jmp_addul] = x86_64_arith3i;
+	  x86_64_jump_table->a3i_data[dill_jmp_addul].data1 = 0x0;
+	  x86_64_jump_table->a3i_data[dill_jmp_addul].data2 = DILL_UL;
+	  x86_64_jump_table->jmp_a3i[dill_jmp_addl] = x86_64_arith3i;
+	  x86_64_jump_table->a3i_data[dill_jmp_addl].data1 = 0x0;
+	  x86_64_jump_table->a3i_data[dill_jmp_addl].data2 = DILL_L;
+	  x86_64_jump_table->jmp_a3i[dill_jmp_addp] = x86_64_arith3i;
+	  x86_64_jump_table->a3i_data[dill_jmp_addp].data1 = 0x0;
+	  x86_64_jump_table->a3i_data[dill_jmp_addp].data2 = DILL_P;
+	  x86_64_jump_table->jmp_a3i[dill_jmp_subi] = x86_64_arith3i;
+	  x86_64_jump_table->a3i_data[dill_jmp_subi].data1 = 0x05;
+	  x86_64_jump_table->a3i_data[dill_jmp_subi].data2 = DILL_I;
+	  x86_64_jump_table->jmp_a3i[dill_jmp_subu] = x86_64_arith3i;
+	  x86_64_jump_table->a3i_data[dill_jmp_subu].data1 = 0x05;
+	  x86_64_jump_table->a3i_data[dill_jmp_subu].data2 = DILL_U;
+	  x86_64_jump_table->jmp_a3i[dill_jmp_subul] = x86_64_arith3i;
+	  x86_64_jump_table->a3i_data[dill_jmp_subul].data1 = 0x05;
+	  x86_64_jump_table->a3i_data[dill_jmp_subul].data2 = DILL_UL;
+	  x86_64_jump_table->jmp_a3i[dill_jmp_subl] = x86_64_arith3i;
+	  x86_64_jump_table->a3i_data[dill_jmp_subl].data1 = 0x05;
+	  x86_64_jump_table->a3i_data[dill_jmp_subl].data2 = DILL_L;
+	  x86_64_jump_table->jmp_a3i[dill_jmp_subp] = x86_64_arith3i;
+	  x86_64_jump_table->a3i_data[dill_jmp_subp].data1 = 0x05;
+	  x86_64_jump_table->a3i_data[dill_jmp_subp].data2 = DILL_P;
+	  x86_64_jump_table->jmp_a3i[dill_jmp_mulu] = (arith_op3i)x86_64_mul;
+	  x86_64_jump_table->a3i_data[dill_jmp_mulu].data1 = 0;
+	  x86_64_jump_table->a3i_data[dill_jmp_mulu].data2 = 1;
+	  x86_64_jump_table->jmp_a3i[dill_jmp_mulul] = (arith_op3i)x86_64_mul;
+	  x86_64_jump_table->a3i_data[dill_jmp_mulul].data1 = 0;
+	  x86_64_jump_table->a3i_data[dill_jmp_mulul].data2 = 1;
+	  x86_64_jump_table->jmp_a3i[dill_jmp_muli] = (arith_op3i)x86_64_mul;
+	  x86_64_jump_table->a3i_data[dill_jmp_muli].data1 = 1;
+	  x86_64_jump_table->a3i_data[dill_jmp_muli].data2 = 1;
+	  x86_64_jump_table->jmp_a3i[dill_jmp_mull] = (arith_op3i)x86_64_mul;
+	  x86_64_jump_table->a3i_data[dill_jmp_mull].data1 = 1;
+	  x86_64_jump_table->a3i_data[dill_jmp_mull].data2 = 1;
+	  x86_64_jump_table->jmp_a3i[dill_jmp_divu] = x86_64_div_modi;
+	  x86_64_jump_table->a3i_data[dill_jmp_divu].data1 = 1;
+	  x86_64_jump_table->a3i_data[dill_jmp_divu].data2 = DILL_U;
+	  x86_64_jump_table->jmp_a3i[dill_jmp_divul] = x86_64_div_modi;
+	  x86_64_jump_table->a3i_data[dill_jmp_divul].data1 = 1;
+	  x86_64_jump_table->a3i_data[dill_jmp_divul].data2 = DILL_UL;
+	  x86_64_jump_table->jmp_a3i[dill_jmp_divi] = x86_64_div_modi;
+	  x86_64_jump_table->a3i_data[dill_jmp_divi].data1 = 1;
+	  x86_64_jump_table->a3i_data[dill_jmp_divi].data2 = DILL_I;
+	  x86_64_jump_table->jmp_a3i[dill_jmp_divl] = x86_64_div_modi;
+	  x86_64_jump_table->a3i_data[dill_jmp_divl].data1 = 1;
+	  x86_64_jump_table->a3i_data[dill_jmp_divl].data2 = DILL_L;
+	  x86_64_jump_table->jmp_a3i[dill_jmp_modu] = x86_64_div_modi;
+	  x86_64_jump_table->a3i_data[dill_jmp_modu].data1 = 0;
+	  x86_64_jump_table->a3i_data[dill_jmp_modu].data2 = DILL_U;
+	  x86_64_jump_table->jmp_a3i[dill_jmp_modul] = x86_64_div_modi;
+	  x86_64_jump_table->a3i_data[dill_jmp_modul].data1 = 0;
+	  x86_64_jump_table->a3i_data[dill_jmp_modul].data2 = DILL_UL;
+	  x86_64_jump_table->jmp_a3i[dill_jmp_modi] = x86_64_div_modi;
+	  x86_64_jump_table->a3i_data[dill_jmp_modi].data1 = 0;
+	  x86_64_jump_table->a3i_data[dill_jmp_modi].data2 = DILL_I;
+	  x86_64_jump_table->jmp_a3i[dill_jmp_modl] = x86_64_div_modi;
+	  x86_64_jump_table->a3i_data[dill_jmp_modl].data1 = 0;
+	  x86_64_jump_table->a3i_data[dill_jmp_modl].data2 = DILL_L;
+	  x86_64_jump_table->jmp_a3i[dill_jmp_andi] = x86_64_arith3i;
+	  x86_64_jump_table->a3i_data[dill_jmp_andi].data1 = 0x4;
+	  x86_64_jump_table->a3i_data[dill_jmp_andi].data2 = DILL_I;
+	  x86_64_jump_table->jmp_a3i[dill_jmp_andu] = x86_64_arith3i;
+	  x86_64_jump_table->a3i_data[dill_jmp_andu].data1 = 0x4;
+	  x86_64_jump_table->a3i_data[dill_jmp_andu].data2 = DILL_U;
+	  x86_64_jump_table->jmp_a3i[dill_jmp_andul] = x86_64_arith3i;
+	  x86_64_jump_table->a3i_data[dill_jmp_andul].data1 = 0x4;
+	  x86_64_jump_table->a3i_data[dill_jmp_andul].data2 = DILL_UL;
+	  x86_64_jump_table->jmp_a3i[dill_jmp_andl] = x86_64_arith3i;
+	  x86_64_jump_table->a3i_data[dill_jmp_andl].data1 = 0x4;
+	  x86_64_jump_table->a3i_data[dill_jmp_andl].data2 = DILL_L;
+	  x86_64_jump_table->jmp_a3i[dill_jmp_ori] = x86_64_arith3i;
+	  x86_64_jump_table->a3i_data[dill_jmp_ori].data1 = 0x1;
+	  x86_64_jump_table->a3i_data[dill_jmp_ori].data2 = DILL_I;
+	  x86_64_jump_table->jmp_a3i[dill_jmp_oru] = x86_64_arith3i;
+	  x86_64_jump_table->a3i_data[dill_jmp_oru].data1 = 0x1;
+	  x86_64_jump_table->a3i_data[dill_jmp_oru].data2 = DILL_U;
+	  x86_64_jump_table->jmp_a3i[dill_jmp_orul] = x86_64_arith3i;
+	  x86_64_jump_table->a3i_data[dill_jmp_orul].data1 = 0x1;
+	  x86_64_jump_table->a3i_data[dill_jmp_orul].data2 = DILL_UL;
+	  x86_64_jump_table->jmp_a3i[dill_jmp_orl] = x86_64_arith3i;
+	  x86_64_jump_table->a3i_data[dill_jmp_orl].data1 = 0x1;
+	  x86_64_jump_table->a3i_data[dill_jmp_orl].data2 = DILL_L;
+	  x86_64_jump_table->jmp_a3i[dill_jmp_xori] = x86_64_arith3i;
+	  x86_64_jump_table->a3i_data[dill_jmp_xori].data1 = 0x06;
+	  x86_64_jump_table->a3i_data[dill_jmp_xori].data2 = DILL_I;
+	  x86_64_jump_table->jmp_a3i[dill_jmp_xoru] = x86_64_arith3i;
+	  x86_64_jump_table->a3i_data[dill_jmp_xoru].data1 = 0x06;
+	  x86_64_jump_table->a3i_data[dill_jmp_xoru].data2 = DILL_U;
+	  x86_64_jump_table->jmp_a3i[dill_jmp_xorul] = x86_64_arith3i;
+	  x86_64_jump_table->a3i_data[dill_jmp_xorul].data1 = 0x06;
+	  x86_64_jump_table->a3i_data[dill_jmp_xorul].data2 = DILL_UL;
+	  x86_64_jump_table->jmp_a3i[dill_jmp_xorl] = x86_64_arith3i;
+	  x86_64_jump_table->a3i_data[dill_jmp_xorl].data1 = 0x06;
+	  x86_64_jump_table->a3i_data[dill_jmp_xorl].data2 = DILL_L;
+	  x86_64_jump_table->jmp_a3i[dill_jmp_lshi] = x86_64_shifti;
+	  x86_64_jump_table->a3i_data[dill_jmp_lshi].data1 = 0x4;
+	  x86_64_jump_table->a3i_data[dill_jmp_lshi].data2 = DILL_I;
+	  x86_64_jump_table->jmp_a3i[dill_jmp_lshu] = x86_64_shifti;
+	  x86_64_jump_table->a3i_data[dill_jmp_lshu].data1 = 0x4;
+	  x86_64_jump_table->a3i_data[dill_jmp_lshu].data2 = DILL_U;
+	  x86_64_jump_table->jmp_a3i[dill_jmp_lshul] = x86_64_shifti;
+	  x86_64_jump_table->a3i_data[dill_jmp_lshul].data1 = 0x4;
+	  x86_64_jump_table->a3i_data[dill_jmp_lshul].data2 = DILL_UL;
+	  x86_64_jump_table->jmp_a3i[dill_jmp_lshl] = x86_64_shifti;
+	  x86_64_jump_table->a3i_data[dill_jmp_lshl].data1 = 0x4;
+	  x86_64_jump_table->a3i_data[dill_jmp_lshl].data2 = DILL_L;
+	  x86_64_jump_table->jmp_a3i[dill_jmp_rshi] = x86_64_shifti;
+	  x86_64_jump_table->a3i_data[dill_jmp_rshi].data1 = 0x7;
+	  x86_64_jump_table->a3i_data[dill_jmp_rshi].data2 = DILL_I;
+	  x86_64_jump_table->jmp_a3i[dill_jmp_rshl] = x86_64_shifti;
+	  x86_64_jump_table->a3i_data[dill_jmp_rshl].data1 = 0x7;
+	  x86_64_jump_table->a3i_data[dill_jmp_rshl].data2 = DILL_L;
+	  x86_64_jump_table->jmp_a3i[dill_jmp_rshu] = x86_64_shifti;
+	  x86_64_jump_table->a3i_data[dill_jmp_rshu].data1 = 0x5;
+	  x86_64_jump_table->a3i_data[dill_jmp_rshu].data2 = DILL_U;
+	  x86_64_jump_table->jmp_a3i[dill_jmp_rshul] = x86_64_shifti;
+	  x86_64_jump_table->a3i_data[dill_jmp_rshul].data1 = 0x5;
+	  x86_64_jump_table->a3i_data[dill_jmp_rshul].data2 = DILL_UL;
+	  x86_64_jump_table->jmp_a2[dill_jmp_comi] = x86_64_arith2;
+	  x86_64_jump_table->a2_data[dill_jmp_comi].data1 = 0xf7;
+	  x86_64_jump_table->a2_data[dill_jmp_comi].data2 = 2;
+	  x86_64_jump_table->jmp_a2[dill_jmp_comu] = x86_64_arith2;
+	  x86_64_jump_table->a2_data[dill_jmp_comu].data1 = 0xf7;
+	  x86_64_jump_table->a2_data[dill_jmp_comu].data2 = 2;
+	  x86_64_jump_table->jmp_a2[dill_jmp_comul] = x86_64_arith2;
+	  x86_64_jump_table->a2_data[dill_jmp_comul].data1 = 0xf7;
+	  x86_64_jump_table->a2_data[dill_jmp_comul].data2 = 2;
+	  x86_64_jump_table->jmp_a2[dill_jmp_coml] = x86_64_arith2;
+	  x86_64_jump_table->a2_data[dill_jmp_coml].data1 = 0xf7;
+	  x86_64_jump_table->a2_data[dill_jmp_coml].data2 = 2;
+	  x86_64_jump_table->jmp_a2[dill_jmp_negi] = x86_64_arith2;
+	  x86_64_jump_table->a2_data[dill_jmp_negi].data1 = 0xf7;
+	  x86_64_jump_table->a2_data[dill_jmp_negi].data2 = 3;
+	  x86_64_jump_table->jmp_a2[dill_jmp_negu] = x86_64_arith2;
+	  x86_64_jump_table->a2_data[dill_jmp_negu].data1 = 0xf7;
+	  x86_64_jump_table->a2_data[dill_jmp_negu].data2 = 3;
+	  x86_64_jump_table->jmp_a2[dill_jmp_negul] = x86_64_arith2;
+	  x86_64_jump_table->a2_data[dill_jmp_negul].data1 = 0xf7;
+	  x86_64_jump_table->a2_data[dill_jmp_negul].data2 = 3;
+	  x86_64_jump_table->jmp_a2[dill_jmp_negl] = x86_64_arith2;
+	  x86_64_jump_table->a2_data[dill_jmp_negl].data1 = 0xf7;
+	  x86_64_jump_table->a2_data[dill_jmp_negl].data2 = 3;
+	  x86_64_jump_table->jmp_a2[dill_jmp_noti] = x86_64_arith2;
+	  x86_64_jump_table->a2_data[dill_jmp_noti].data1 = dill_jmp_noti;
+	  x86_64_jump_table->a2_data[dill_jmp_noti].data2 = 0;
+	  x86_64_jump_table->jmp_a2[dill_jmp_notu] = x86_64_arith2;
+	  x86_64_jump_table->a2_data[dill_jmp_notu].data1 = dill_jmp_noti;
+	  x86_64_jump_table->a2_data[dill_jmp_notu].data2 = 0;
+	  x86_64_jump_table->jmp_a2[dill_jmp_notul] = x86_64_arith2;
+	  x86_64_jump_table->a2_data[dill_jmp_notul].data1 = dill_jmp_noti;
+	  x86_64_jump_table->a2_data[dill_jmp_notul].data2 = 0;
+	  x86_64_jump_table->jmp_a2[dill_jmp_notl] = x86_64_arith2;
+	  x86_64_jump_table->a2_data[dill_jmp_notl].data1 = dill_jmp_noti;
+	  x86_64_jump_table->a2_data[dill_jmp_notl].data2 = 0;
+	  x86_64_jump_table->jmp_a2[dill_jmp_negf] = x86_64_farith2;
+	  x86_64_jump_table->a2_data[dill_jmp_negf].data1 = 0x5c;
+	  x86_64_jump_table->a2_data[dill_jmp_negf].data2 = DILL_F;
+	  x86_64_jump_table->jmp_a2[dill_jmp_negd] = x86_64_farith2;
+	  x86_64_jump_table->a2_data[dill_jmp_negd].data1 = 0x5c;
+	  x86_64_jump_table->a2_data[dill_jmp_negd].data2 = DILL_D;
+	  x86_64_jump_table->jmp_a2[dill_jmp_bswaps] = x86_64_bswap;
+	  x86_64_jump_table->a2_data[dill_jmp_bswaps].data1 = 0;
+	  x86_64_jump_table->a2_data[dill_jmp_bswaps].data2 = DILL_S;
+	  x86_64_jump_table->jmp_a2[dill_jmp_bswapus] = x86_64_bswap;
+	  x86_64_jump_table->a2_data[dill_jmp_bswapus].data1 = 0;
+	  x86_64_jump_table->a2_data[dill_jmp_bswapus].data2 = DILL_US;
+	  x86_64_jump_table->jmp_a2[dill_jmp_bswapi] = x86_64_bswap;
+	  x86_64_jump_table->a2_data[dill_jmp_bswapi].data1 = 0;
+	  x86_64_jump_table->a2_data[dill_jmp_bswapi].data2 = DILL_I;
+	  x86_64_jump_table->jmp_a2[dill_jmp_bswapu] = x86_64_bswap;
+	  x86_64_jump_table->a2_data[dill_jmp_bswapu].data1 = 0;
+	  x86_64_jump_table->a2_data[dill_jmp_bswapu].data2 = DILL_U;
+	  x86_64_jump_table->jmp_a2[dill_jmp_bswapul] = x86_64_bswap;
+	  x86_64_jump_table->a2_data[dill_jmp_bswapul].data1 = 0;
+	  x86_64_jump_table->a2_data[dill_jmp_bswapul].data2 = DILL_UL;
+	  x86_64_jump_table->jmp_a2[dill_jmp_bswapl] = x86_64_bswap;
+	  x86_64_jump_table->a2_data[dill_jmp_bswapl].data1 = 0;
+	  x86_64_jump_table->a2_data[dill_jmp_bswapl].data2 = DILL_L;
+	  x86_64_jump_table->jmp_a2[dill_jmp_bswapf] = x86_64_bswap;
+	  x86_64_jump_table->a2_data[dill_jmp_bswapf].data1 = 0;
+	  x86_64_jump_table->a2_data[dill_jmp_bswapf].data2 = DILL_F;
+	  x86_64_jump_table->jmp_a2[dill_jmp_bswapd] = x86_64_bswap;
+	  x86_64_jump_table->a2_data[dill_jmp_bswapd].data1 = 0;
+	  x86_64_jump_table->a2_data[dill_jmp_bswapd].data2 = DILL_D;
+	  x86_64_jump_table->jmp_b[dill_jmp_beqc] = x86_64_branch;
+	  x86_64_jump_table->b_data[dill_jmp_beqc].data1 = dill_eq_code;
+	  x86_64_jump_table->b_data[dill_jmp_beqc].data2 = DILL_C;
+	  x86_64_jump_table->jmp_b[dill_jmp_bequc] = x86_64_branch;
+	  x86_64_jump_table->b_data[dill_jmp_bequc].data1 = dill_eq_code;
+	  x86_64_jump_table->b_data[dill_jmp_bequc].data2 = DILL_UC;
+	  x86_64_jump_table->jmp_b[dill_jmp_beqs] = x86_64_branch;
+	  x86_64_jump_table->b_data[dill_jmp_beqs].data1 = dill_eq_code;
+	  x86_64_jump_table->b_data[dill_jmp_beqs].data2 = DILL_S;
+	  x86_64_jump_table->jmp_b[dill_jmp_bequs] = x86_64_branch;
+	  x86_64_jump_table->b_data[dill_jmp_bequs].data1 = dill_eq_code;
+	  x86_64_jump_table->b_data[dill_jmp_bequs].data2 = DILL_US;
+	  x86_64_jump_table->jmp_b[dill_jmp_beqi] = x86_64_branch;
+	  x86_64_jump_table->b_data[dill_jmp_beqi].data1 = dill_eq_code;
+	  x86_64_jump_table->b_data[dill_jmp_beqi].data2 = DILL_I;
+	  x86_64_jump_table->jmp_b[dill_jmp_bequ] = x86_64_branch;
+	  x86_64_jump_table->b_data[dill_jmp_bequ].data1 = dill_eq_code;
+	  x86_64_jump_table->b_data[dill_jmp_bequ].data2 = DILL_U;
+	  x86_64_jump_table->jmp_b[dill_jmp_bequl] = x86_64_branch;
+	  x86_64_jump_table->b_data[dill_jmp_bequl].data1 = dill_eq_code;
+	  x86_64_jump_table->b_data[dill_jmp_bequl].data2 = DILL_UL;
+	  x86_64_jump_table->jmp_b[dill_jmp_beql] = x86_64_branch;
+	  x86_64_jump_table->b_data[dill_jmp_beql].data1 = dill_eq_code;
+	  x86_64_jump_table->b_data[dill_jmp_beql].data2 = DILL_L;
+	  x86_64_jump_table->jmp_b[dill_jmp_beqp] = x86_64_branch;
+	  x86_64_jump_table->b_data[dill_jmp_beqp].data1 = dill_eq_code;
+	  x86_64_jump_table->b_data[dill_jmp_beqp].data2 = DILL_P;
+	  x86_64_jump_table->jmp_b[dill_jmp_beqd] = x86_64_branch;
+	  x86_64_jump_table->b_data[dill_jmp_beqd].data1 = dill_eq_code;
+	  x86_64_jump_table->b_data[dill_jmp_beqd].data2 = DILL_D;
+	  x86_64_jump_table->jmp_b[dill_jmp_beqf] = x86_64_branch;
+	  x86_64_jump_table->b_data[dill_jmp_beqf].data1 = dill_eq_code;
+	  x86_64_jump_table->b_data[dill_jmp_beqf].data2 = DILL_F;
+	  x86_64_jump_table->jmp_b[dill_jmp_bgec] = x86_64_branch;
+	  x86_64_jump_table->b_data[dill_jmp_bgec].data1 = dill_ge_code;
+	  x86_64_jump_table->b_data[dill_jmp_bgec].data2 = DILL_C;
+	  x86_64_jump_table->jmp_b[dill_jmp_bgeuc] = x86_64_branch;
+	  x86_64_jump_table->b_data[dill_jmp_bgeuc].data1 = dill_ge_code;
+	  x86_64_jump_table->b_data[dill_jmp_bgeuc].data2 = DILL_UC;
+	  x86_64_jump_table->jmp_b[dill_jmp_bges] = x86_64_branch;
+	  x86_64_jump_table->b_data[dill_jmp_bges].data1 = dill_ge_code;
+	  x86_64_jump_table->b_data[dill_jmp_bges].data2 = DILL_S;
+	  x86_64_jump_table->jmp_b[dill_jmp_bgeus] = x86_64_branch;
+	  x86_64_jump_table->b_data[dill_jmp_bgeus].data1 = dill_ge_code;
+	  x86_64_jump_table->b_data[dill_jmp_bgeus].data2 = DILL_US;
+	  x86_64_jump_table->jmp_b[dill_jmp_bgei] = x86_64_branch;
+	  x86_64_jump_table->b_data[dill_jmp_bgei].data1 = dill_ge_code;
+	  x86_64_jump_table->b_data[dill_jmp_bgei].data2 = DILL_I;
+	  x86_64_jump_table->jmp_b[dill_jmp_bgeu] = x86_64_branch;
+	  x86_64_jump_table->b_data[dill_jmp_bgeu].data1 = dill_ge_code;
+	  x86_64_jump_table->b_data[dill_jmp_bgeu].data2 = DILL_U;
+	  x86_64_jump_table->jmp_b[dill_jmp_bgeul] = x86_64_branch;
+	  x86_64_jump_table->b_data[dill_jmp_bgeul].data1 = dill_ge_code;
+	  x86_64_jump_table->b_data[dill_jmp_bgeul].data2 = DILL_UL;
+	  x86_64_jump_table->jmp_b[dill_jmp_bgel] = x86_64_branch;
+	  x86_64_jump_table->b_data[dill_jmp_bgel].data1 = dill_ge_code;
+	  x86_64_jump_table->b_data[dill_jmp_bgel].data2 = DILL_L;
+	  x86_64_jump_table->jmp_b[dill_jmp_bgep] = x86_64_branch;
+	  x86_64_jump_table->b_data[dill_jmp_bgep].data1 = dill_ge_code;
+	  x86_64_jump_table->b_data[dill_jmp_bgep].data2 = DILL_P;
+	  x86_64_jump_table->jmp_b[dill_jmp_bged] = x86_64_branch;
+	  x86_64_jump_table->b_data[dill_jmp_bged].data1 = dill_ge_code;
+	  x86_64_jump_table->b_data[dill_jmp_bged].data2 = DILL_D;
+	  x86_64_jump_table->jmp_b[dill_jmp_bgef] = x86_64_branch;
+	  x86_64_jump_table->b_data[dill_jmp_bgef].data1 = dill_ge_code;
+	  x86_64_jump_table->b_data[dill_jmp_bgef].data2 = DILL_F;
+	  x86_64_jump_table->jmp_b[dill_jmp_bgtc] = x86_64_branch;
+	  x86_64_jump_table->b_data[dill_jmp_bgtc].data1 = dill_gt_code;
+	  x86_64_jump_table->b_data[dill_jmp_bgtc].data2 = DILL_C;
+	  x86_64_jump_table->jmp_b[dill_jmp_bgtuc] = x86_64_branch;
+	  x86_64_jump_table->b_data[dill_jmp_bgtuc].data1 = dill_gt_code;
+	  x86_64_jump_table->b_data[dill_jmp_bgtuc].data2 = DILL_UC;
+	  x86_64_jump_table->jmp_b[dill_jmp_bgts] = x86_64_branch;
+	  x86_64_jump_table->b_data[dill_jmp_bgts].data1 = dill_gt_code;
+	  x86_64_jump_table->b_data[dill_jmp_bgts].data2 = DILL_S;
+	  x86_64_jump_table->jmp_b[dill_jmp_bgtus] = x86_64_branch;
+	  x86_64_jump_table->b_data[dill_jmp_bgtus].data1 = dill_gt_code;
+	  x86_64_jump_table->b_data[dill_jmp_bgtus].data2 = DILL_US;
+	  x86_64_jump_table->jmp_b[dill_jmp_bgti] = x86_64_branch;
+	  x86_64_jump_table->b_data[dill_jmp_bgti].data1 = dill_gt_code;
+	  x86_64_jump_table->b_data[dill_jmp_bgti].data2 = DILL_I;
+	  x86_64_jump_table->jmp_b[dill_jmp_bgtu] = x86_64_branch;
+	  x86_64_jump_table->b_data[dill_jmp_bgtu].data1 = dill_gt_code;
+	  x86_64_jump_table->b_data[dill_jmp_bgtu].data2 = DILL_U;
+	  x86_64_jump_table->jmp_b[dill_jmp_bgtul] = x86_64_branch;
+	  x86_64_jump_table->b_data[dill_jmp_bgtul].data1 = dill_gt_code;
+	  x86_64_jump_table->b_data[dill_jmp_bgtul].data2 = DILL_UL;
+	  x86_64_jump_table->jmp_b[dill_jmp_bgtl] = x86_64_branch;
+	  x86_64_jump_table->b_data[dill_jmp_bgtl].data1 = dill_gt_code;
+	  x86_64_jump_table->b_data[dill_jmp_bgtl].data2 = DILL_L;
+	  x86_64_jump_table->jmp_b[dill_jmp_bgtp] = x86_64_branch;
+	  x86_64_jump_table->b_data[dill_jmp_bgtp].data1 = dill_gt_code;
+	  x86_64_jump_table->b_data[dill_jmp_bgtp].data2 = DILL_P;
+	  x86_64_jump_table->jmp_b[dill_jmp_bgtd] = x86_64_branch;
+	  x86_64_jump_table->b_data[dill_jmp_bgtd].data1 = dill_gt_code;
+	  x86_64_jump_table->b_data[dill_jmp_bgtd].data2 = DILL_D;
+	  x86_64_jump_table->jmp_b[dill_jmp_bgtf] = x86_64_branch;
+	  x86_64_jump_table->b_data[dill_jmp_bgtf].data1 = dill_gt_code;
+	  x86_64_jump_table->b_data[dill_jmp_bgtf].data2 = DILL_F;
+	  x86_64_jump_table->jmp_b[dill_jmp_blec] = x86_64_branch;
+	  x86_64_jump_table->b_data[dill_jmp_blec].data1 = dill_le_code;
+	  x86_64_jump_table->b_data[dill_jmp_blec].data2 = DILL_C;
+	  x86_64_jump_table->jmp_b[dill_jmp_bleuc] = x86_64_branch;
+	  x86_64_jump_table->b_data[dill_jmp_bleuc].data1 = dill_le_code;
+	  x86_64_jump_table->b_data[dill_jmp_bleuc].data2 = DILL_UC;
+	  x86_64_jump_table->jmp_b[dill_jmp_bles] = x86_64_branch;
+	  x86_64_jump_table->b_data[dill_jmp_bles].data1 = dill_le_code;
+	  x86_64_jump_table->b_data[dill_jmp_bles].data2 = DILL_S;
+	  x86_64_jump_table->jmp_b[dill_jmp_bleus] = x86_64_branch;
+	  x86_64_jump_table->b_data[dill_jmp_bleus].data1 = dill_le_code;
+	  x86_64_jump_table->b_data[dill_jmp_bleus].data2 = DILL_US;
+	  x86_64_jump_table->jmp_b[dill_jmp_blei] = x86_64_branch;
+	  x86_64_jump_table->b_data[dill_jmp_blei].data1 = dill_le_code;
+	  x86_64_jump_table->b_data[dill_jmp_blei].data2 = DILL_I;
+	  x86_64_jump_table->jmp_b[dill_jmp_bleu] = x86_64_branch;
+	  x86_64_jump_table->b_data[dill_jmp_bleu].data1 = dill_le_code;
+	  x86_64_jump_table->b_data[dill_jmp_bleu].data2 = DILL_U;
+	  x86_64_jump_table->jmp_b[dill_jmp_bleul] = x86_64_branch;
+	  x86_64_jump_table->b_data[dill_jmp_bleul].data1 = dill_le_code;
+	  x86_64_jump_table->b_data[dill_jmp_bleul].data2 = DILL_UL;
+	  x86_64_jump_table->jmp_b[dill_jmp_blel] = x86_64_branch;
+	  x86_64_jump_table->b_data[dill_jmp_blel].data1 = dill_le_code;
+	  x86_64_jump_table->b_data[dill_jmp_blel].data2 = DILL_L;
+	  x86_64_jump_table->jmp_b[dill_jmp_blep] = x86_64_branch;
+	  x86_64_jump_table->b_data[dill_jmp_blep].data1 = dill_le_code;
+	  x86_64_jump_table->b_data[dill_jmp_blep].data2 = DILL_P;
+	  x86_64_jump_table->jmp_b[dill_jmp_bled] = x86_64_branch;
+	  x86_64_jump_table->b_data[dill_jmp_bled].data1 = dill_le_code;
+	  x86_64_jump_table->b_data[dill_jmp_bled].data2 = DILL_D;
+	  x86_64_jump_table->jmp_b[dill_jmp_blef] = x86_64_branch;
+	  x86_64_jump_table->b_data[dill_jmp_blef].data1 = dill_le_code;
+	  x86_64_jump_table->b_data[dill_jmp_blef].data2 = DILL_F;
+	  x86_64_jump_table->jmp_b[dill_jmp_bltc] = x86_64_branch;
+	  x86_64_jump_table->b_data[dill_jmp_bltc].data1 = dill_lt_code;
+	  x86_64_jump_table->b_data[dill_jmp_bltc].data2 = DILL_C;
+	  x86_64_jump_table->jmp_b[dill_jmp_bltuc] = x86_64_branch;
+	  x86_64_jump_table->b_data[dill_jmp_bltuc].data1 = dill_lt_code;
+	  x86_64_jump_table->b_data[dill_jmp_bltuc].data2 = DILL_UC;
+	  x86_64_jump_table->jmp_b[dill_jmp_blts] = x86_64_branch;
+	  x86_64_jump_table->b_data[dill_jmp_blts].data1 = dill_lt_code;
+	  x86_64_jump_table->b_data[dill_jmp_blts].data2 = DILL_S;
+	  x86_64_jump_table->jmp_b[dill_jmp_bltus] = x86_64_branch;
+	  x86_64_jump_table->b_data[dill_jmp_bltus].data1 = dill_lt_code;
+	  x86_64_jump_table->b_data[dill_jmp_bltus].data2 = DILL_US;
+	  x86_64_jump_table->jmp_b[dill_jmp_blti] = x86_64_branch;
+	  x86_64_jump_table->b_data[dill_jmp_blti].data1 = dill_lt_code;
+	  x86_64_jump_table->b_data[dill_jmp_blti].data2 = DILL_I;
+	  x86_64_jump_table->jmp_b[dill_jmp_bltu] = x86_64_branch;
+	  x86_64_jump_table->b_data[dill_jmp_bltu].data1 = dill_lt_code;
+	  x86_64_jump_table->b_data[dill_jmp_bltu].data2 = DILL_U;
+	  x86_64_jump_table->jmp_b[dill_jmp_bltul] = x86_64_branch;
+	  x86_64_jump_table->b_data[dill_jmp_bltul].data1 = dill_lt_code;
+	  x86_64_jump_table->b_data[dill_jmp_bltul].data2 = DILL_UL;
+	  x86_64_jump_table->jmp_b[dill_jmp_bltl] = x86_64_branch;
+	  x86_64_jump_table->b_data[dill_jmp_bltl].data1 = dill_lt_code;
+	  x86_64_jump_table->b_data[dill_jmp_bltl].data2 = DILL_L;
+	  x86_64_jump_table->jmp_b[dill_jmp_bltp] = x86_64_branch;
+	  x86_64_jump_table->b_data[dill_jmp_bltp].data1 = dill_lt_code;
+	  x86_64_jump_table->b_data[dill_jmp_bltp].data2 = DILL_P;
+	  x86_64_jump_table->jmp_b[dill_jmp_bltd] = x86_64_branch;
+	  x86_64_jump_table->b_data[dill_jmp_bltd].data1 = dill_lt_code;
+	  x86_64_jump_table->b_data[dill_jmp_bltd].data2 = DILL_D;
+	  x86_64_jump_table->jmp_b[dill_jmp_bltf] = x86_64_branch;
+	  x86_64_jump_table->b_data[dill_jmp_bltf].data1 = dill_lt_code;
+	  x86_64_jump_table->b_data[dill_jmp_bltf].data2 = DILL_F;
+	  x86_64_jump_table->jmp_b[dill_jmp_bnec] = x86_64_branch;
+	  x86_64_jump_table->b_data[dill_jmp_bnec].data1 = dill_ne_code;
+	  x86_64_jump_table->b_data[dill_jmp_bnec].data2 = DILL_C;
+	  x86_64_jump_table->jmp_b[dill_jmp_bneuc] = x86_64_branch;
+	  x86_64_jump_table->b_data[dill_jmp_bneuc].data1 = dill_ne_code;
+	  x86_64_jump_table->b_data[dill_jmp_bneuc].data2 = DILL_UC;
+	  x86_64_jump_table->jmp_b[dill_jmp_bnes] = x86_64_branch;
+	  x86_64_jump_table->b_data[dill_jmp_bnes].data1 = dill_ne_code;
+	  x86_64_jump_table->b_data[dill_jmp_bnes].data2 = DILL_S;
+	  x86_64_jump_table->jmp_b[dill_jmp_bneus] = x86_64_branch;
+	  x86_64_jump_table->b_data[dill_jmp_bneus].data1 = dill_ne_code;
+	  x86_64_jump_table->b_data[dill_jmp_bneus].data2 = DILL_US;
+	  x86_64_jump_table->jmp_b[dill_jmp_bnei] = x86_64_branch;
+	  x86_64_jump_table->b_data[dill_jmp_bnei].data1 = dill_ne_code;
+	  x86_64_jump_table->b_data[dill_jmp_bnei].data2 = DILL_I;
+	  x86_64_jump_table->jmp_b[dill_jmp_bneu] = x86_64_branch;
+	  x86_64_jump_table->b_data[dill_jmp_bneu].data1 = dill_ne_code;
+	  x86_64_jump_table->b_data[dill_jmp_bneu].data2 = DILL_U;
+	  x86_64_jump_table->jmp_b[dill_jmp_bneul] = x86_64_branch;
+	  x86_64_jump_table->b_data[dill_jmp_bneul].data1 = dill_ne_code;
+	  x86_64_jump_table->b_data[dill_jmp_bneul].data2 = DILL_UL;
+	  x86_64_jump_table->jmp_b[dill_jmp_bnel] = x86_64_branch;
+	  x86_64_jump_table->b_data[dill_jmp_bnel].data1 = dill_ne_code;
+	  x86_64_jump_table->b_data[dill_jmp_bnel].data2 = DILL_L;
+	  x86_64_jump_table->jmp_b[dill_jmp_bnep] = x86_64_branch;
+	  x86_64_jump_table->b_data[dill_jmp_bnep].data1 = dill_ne_code;
+	  x86_64_jump_table->b_data[dill_jmp_bnep].data2 = DILL_P;
+	  x86_64_jump_table->jmp_b[dill_jmp_bned] = x86_64_branch;
+	  x86_64_jump_table->b_data[dill_jmp_bned].data1 = dill_ne_code;
+	  x86_64_jump_table->b_data[dill_jmp_bned].data2 = DILL_D;
+	  x86_64_jump_table->jmp_b[dill_jmp_bnef] = x86_64_branch;
+	  x86_64_jump_table->b_data[dill_jmp_bnef].data1 = dill_ne_code;
+	  x86_64_jump_table->b_data[dill_jmp_bnef].data2 = DILL_F;
+	  x86_64_jump_table->jmp_bi[dill_jmp_beqc] = x86_64_branchi;
+	  x86_64_jump_table->jmp_bi[dill_jmp_bequc] = x86_64_branchi;
+	  x86_64_jump_table->jmp_bi[dill_jmp_beqs] = x86_64_branchi;
+	  x86_64_jump_table->jmp_bi[dill_jmp_bequs] = x86_64_branchi;
+	  x86_64_jump_table->jmp_bi[dill_jmp_beqi] = x86_64_branchi;
+	  x86_64_jump_table->jmp_bi[dill_jmp_bequ] = x86_64_branchi;
+	  x86_64_jump_table->jmp_bi[dill_jmp_bequl] = x86_64_branchi;
+	  x86_64_jump_table->jmp_bi[dill_jmp_beql] = x86_64_branchi;
+	  x86_64_jump_table->jmp_bi[dill_jmp_beqp] = x86_64_branchi;
+	  x86_64_jump_table->jmp_bi[dill_jmp_bgec] = x86_64_branchi;
+	  x86_64_jump_table->jmp_bi[dill_jmp_bgeuc] = x86_64_branchi;
+	  x86_64_jump_table->jmp_bi[dill_jmp_bges] = x86_64_branchi;
+	  x86_64_jump_table->jmp_bi[dill_jmp_bgeus] = x86_64_branchi;
+	  x86_64_jump_table->jmp_bi[dill_jmp_bgei] = x86_64_branchi;
+	  x86_64_jump_table->jmp_bi[dill_jmp_bgeu] = x86_64_branchi;
+	  x86_64_jump_table->jmp_bi[dill_jmp_bgeul] = x86_64_branchi;
+	  x86_64_jump_table->jmp_bi[dill_jmp_bgel] = x86_64_branchi;
+	  x86_64_jump_table->jmp_bi[dill_jmp_bgep] = x86_64_branchi;
+	  x86_64_jump_table->jmp_bi[dill_jmp_bgtc] = x86_64_branchi;
+	  x86_64_jump_table->jmp_bi[dill_jmp_bgtuc] = x86_64_branchi;
+	  x86_64_jump_table->jmp_bi[dill_jmp_bgts] = x86_64_branchi;
+	  x86_64_jump_table->jmp_bi[dill_jmp_bgtus] = x86_64_branchi;
+	  x86_64_jump_table->jmp_bi[dill_jmp_bgti] = x86_64_branchi;
+	  x86_64_jump_table->jmp_bi[dill_jmp_bgtu] = x86_64_branchi;
+	  x86_64_jump_table->jmp_bi[dill_jmp_bgtul] = x86_64_branchi;
+	  x86_64_jump_table->jmp_bi[dill_jmp_bgtl] = x86_64_branchi;
+	  x86_64_jump_table->jmp_bi[dill_jmp_bgtp] = x86_64_branchi;
+	  x86_64_jump_table->jmp_bi[dill_jmp_blec] = x86_64_branchi;
+	  x86_64_jump_table->jmp_bi[dill_jmp_bleuc] = x86_64_branchi;
+	  x86_64_jump_table->jmp_bi[dill_jmp_bles] = x86_64_branchi;
+	  x86_64_jump_table->jmp_bi[dill_jmp_bleus] = x86_64_branchi;
+	  x86_64_jump_table->jmp_bi[dill_jmp_blei] = x86_64_branchi;
+	  x86_64_jump_table->jmp_bi[dill_jmp_bleu] = x86_64_branchi;
+	  x86_64_jump_table->jmp_bi[dill_jmp_bleul] = x86_64_branchi;
+	  x86_64_jump_table->jmp_bi[dill_jmp_blel] = x86_64_branchi;
+	  x86_64_jump_table->jmp_bi[dill_jmp_blep] = x86_64_branchi;
+	  x86_64_jump_table->jmp_bi[dill_jmp_bltc] = x86_64_branchi;
+	  x86_64_jump_table->jmp_bi[dill_jmp_bltuc] = x86_64_branchi;
+	  x86_64_jump_table->jmp_bi[dill_jmp_blts] = x86_64_branchi;
+	  x86_64_jump_table->jmp_bi[dill_jmp_bltus] = x86_64_branchi;
+	  x86_64_jump_table->jmp_bi[dill_jmp_blti] = x86_64_branchi;
+	  x86_64_jump_table->jmp_bi[dill_jmp_bltu] = x86_64_branchi;
+	  x86_64_jump_table->jmp_bi[dill_jmp_bltul] = x86_64_branchi;
+	  x86_64_jump_table->jmp_bi[dill_jmp_bltl] = x86_64_branchi;
+	  x86_64_jump_table->jmp_bi[dill_jmp_bltp] = x86_64_branchi;
+	  x86_64_jump_table->jmp_bi[dill_jmp_bnec] = x86_64_branchi;
+	  x86_64_jump_table->jmp_bi[dill_jmp_bneuc] = x86_64_branchi;
+	  x86_64_jump_table->jmp_bi[dill_jmp_bnes] = x86_64_branchi;
+	  x86_64_jump_table->jmp_bi[dill_jmp_bneus] = x86_64_branchi;
+	  x86_64_jump_table->jmp_bi[dill_jmp_bnei] = x86_64_branchi;
+	  x86_64_jump_table->jmp_bi[dill_jmp_bneu] = x86_64_branchi;
+	  x86_64_jump_table->jmp_bi[dill_jmp_bneul] = x86_64_branchi;
+	  x86_64_jump_table->jmp_bi[dill_jmp_bnel] = x86_64_branchi;
+	  x86_64_jump_table->jmp_bi[dill_jmp_bnep] = x86_64_branchi;
+	  x86_64_jump_table->jmp_c[dill_jmp_ceqc] = x86_64_compare;
+	  x86_64_jump_table->c_data[dill_jmp_ceqc].data1 = dill_eq_code;
+	  x86_64_jump_table->c_data[dill_jmp_ceqc].data2 = DILL_C;
+	  x86_64_jump_table->jmp_c[dill_jmp_cequc] = x86_64_compare;
+	  x86_64_jump_table->c_data[dill_jmp_cequc].data1 = dill_eq_code;
+	  x86_64_jump_table->c_data[dill_jmp_cequc].data2 = DILL_UC;
+	  x86_64_jump_table->jmp_c[dill_jmp_ceqs] = x86_64_compare;
+	  x86_64_jump_table->c_data[dill_jmp_ceqs].data1 = dill_eq_code;
+	  x86_64_jump_table->c_data[dill_jmp_ceqs].data2 = DILL_S;
+	  x86_64_jump_table->jmp_c[dill_jmp_cequs] = x86_64_compare;
+	  x86_64_jump_table->c_data[dill_jmp_cequs].data1 = dill_eq_code;
+	  x86_64_jump_table->c_data[dill_jmp_cequs].data2 = DILL_US;
+	  x86_64_jump_table->jmp_c[dill_jmp_ceqi] = x86_64_compare;
+	  x86_64_jump_table->c_data[dill_jmp_ceqi].data1 = dill_eq_code;
+	  x86_64_jump_table->c_data[dill_jmp_ceqi].data2 = DILL_I;
+	  x86_64_jump_table->jmp_c[dill_jmp_cequ] = x86_64_compare;
+	  x86_64_jump_table->c_data[dill_jmp_cequ].data1 = dill_eq_code;
+	  x86_64_jump_table->c_data[dill_jmp_cequ].data2 = DILL_U;
+	  x86_64_jump_table->jmp_c[dill_jmp_cequl] = x86_64_compare;
+	  x86_64_jump_table->c_data[dill_jmp_cequl].data1 = dill_eq_code;
+	  x86_64_jump_table->c_data[dill_jmp_cequl].data2 = DILL_UL;
+	  x86_64_jump_table->jmp_c[dill_jmp_ceql] = x86_64_compare;
+	  x86_64_jump_table->c_data[dill_jmp_ceql].data1 = dill_eq_code;
+	  x86_64_jump_table->c_data[dill_jmp_ceql].data2 = DILL_L;
+	  x86_64_jump_table->jmp_c[dill_jmp_ceqp] = x86_64_compare;
+	  x86_64_jump_table->c_data[dill_jmp_ceqp].data1 = dill_eq_code;
+	  x86_64_jump_table->c_data[dill_jmp_ceqp].data2 = DILL_P;
+	  x86_64_jump_table->jmp_c[dill_jmp_ceqd] = x86_64_compare;
+	  x86_64_jump_table->c_data[dill_jmp_ceqd].data1 = dill_eq_code;
+	  x86_64_jump_table->c_data[dill_jmp_ceqd].data2 = DILL_D;
+	  x86_64_jump_table->jmp_c[dill_jmp_ceqf] = x86_64_compare;
+	  x86_64_jump_table->c_data[dill_jmp_ceqf].data1 = dill_eq_code;
+	  x86_64_jump_table->c_data[dill_jmp_ceqf].data2 = DILL_F;
+	  x86_64_jump_table->jmp_c[dill_jmp_cgec] = x86_64_compare;
+	  x86_64_jump_table->c_data[dill_jmp_cgec].data1 = dill_ge_code;
+	  x86_64_jump_table->c_data[dill_jmp_cgec].data2 = DILL_C;
+	  x86_64_jump_table->jmp_c[dill_jmp_cgeuc] = x86_64_compare;
+	  x86_64_jump_table->c_data[dill_jmp_cgeuc].data1 = dill_ge_code;
+	  x86_64_jump_table->c_data[dill_jmp_cgeuc].data2 = DILL_UC;
+	  x86_64_jump_table->jmp_c[dill_jmp_cges] = x86_64_compare;
+	  x86_64_jump_table->c_data[dill_jmp_cges].data1 = dill_ge_code;
+	  x86_64_jump_table->c_data[dill_jmp_cges].data2 = DILL_S;
+	  x86_64_jump_table->jmp_c[dill_jmp_cgeus] = x86_64_compare;
+	  x86_64_jump_table->c_data[dill_jmp_cgeus].data1 = dill_ge_code;
+	  x86_64_jump_table->c_data[dill_jmp_cgeus].data2 = DILL_US;
+	  x86_64_jump_table->jmp_c[dill_jmp_cgei] = x86_64_compare;
+	  x86_64_jump_table->c_data[dill_jmp_cgei].data1 = dill_ge_code;
+	  x86_64_jump_table->c_data[dill_jmp_cgei].data2 = DILL_I;
+	  x86_64_jump_table->jmp_c[dill_jmp_cgeu] = x86_64_compare;
+	  x86_64_jump_table->c_data[dill_jmp_cgeu].data1 = dill_ge_code;
+	  x86_64_jump_table->c_data[dill_jmp_cgeu].data2 = DILL_U;
+	  x86_64_jump_table->jmp_c[dill_jmp_cgeul] = x86_64_compare;
+	  x86_64_jump_table->c_data[dill_jmp_cgeul].data1 = dill_ge_code;
+	  x86_64_jump_table->c_data[dill_jmp_cgeul].data2 = DILL_UL;
+	  x86_64_jump_table->jmp_c[dill_jmp_cgel] = x86_64_compare;
+	  x86_64_jump_table->c_data[dill_jmp_cgel].data1 = dill_ge_code;
+	  x86_64_jump_table->c_data[dill_jmp_cgel].data2 = DILL_L;
+	  x86_64_jump_table->jmp_c[dill_jmp_cgep] = x86_64_compare;
+	  x86_64_jump_table->c_data[dill_jmp_cgep].data1 = dill_ge_code;
+	  x86_64_jump_table->c_data[dill_jmp_cgep].data2 = DILL_P;
+	  x86_64_jump_table->jmp_c[dill_jmp_cged] = x86_64_compare;
+	  x86_64_jump_table->c_data[dill_jmp_cged].data1 = dill_ge_code;
+	  x86_64_jump_table->c_data[dill_jmp_cged].data2 = DILL_D;
+	  x86_64_jump_table->jmp_c[dill_jmp_cgef] = x86_64_compare;
+	  x86_64_jump_table->c_data[dill_jmp_cgef].data1 = dill_ge_code;
+	  x86_64_jump_table->c_data[dill_jmp_cgef].data2 = DILL_F;
+	  x86_64_jump_table->jmp_c[dill_jmp_cgtc] = x86_64_compare;
+	  x86_64_jump_table->c_data[dill_jmp_cgtc].data1 = dill_gt_code;
+	  x86_64_jump_table->c_data[dill_jmp_cgtc].data2 = DILL_C;
+	  x86_64_jump_table->jmp_c[dill_jmp_cgtuc] = x86_64_compare;
+	  x86_64_jump_table->c_data[dill_jmp_cgtuc].data1 = dill_gt_code;
+	  x86_64_jump_table->c_data[dill_jmp_cgtuc].data2 = DILL_UC;
+	  x86_64_jump_table->jmp_c[dill_jmp_cgts] = x86_64_compare;
+	  x86_64_jump_table->c_data[dill_jmp_cgts].data1 = dill_gt_code;
+	  x86_64_jump_table->c_data[dill_jmp_cgts].data2 = DILL_S;
+	  x86_64_jump_table->jmp_c[dill_jmp_cgtus] = x86_64_compare;
+	  x86_64_jump_table->c_data[dill_jmp_cgtus].data1 = dill_gt_code;
+	  x86_64_jump_table->c_data[dill_jmp_cgtus].data2 = DILL_US;
+	  x86_64_jump_table->jmp_c[dill_jmp_cgti] = x86_64_compare;
+	  x86_64_jump_table->c_data[dill_jmp_cgti].data1 = dill_gt_code;
+	  x86_64_jump_table->c_data[dill_jmp_cgti].data2 = DILL_I;
+	  x86_64_jump_table->jmp_c[dill_jmp_cgtu] = x86_64_compare;
+	  x86_64_jump_table->c_data[dill_jmp_cgtu].data1 = dill_gt_code;
+	  x86_64_jump_table->c_data[dill_jmp_cgtu].data2 = DILL_U;
+	  x86_64_jump_table->jmp_c[dill_jmp_cgtul] = x86_64_compare;
+	  x86_64_jump_table->c_data[dill_jmp_cgtul].data1 = dill_gt_code;
+	  x86_64_jump_table->c_data[dill_jmp_cgtul].data2 = DILL_UL;
+	  x86_64_jump_table->jmp_c[dill_jmp_cgtl] = x86_64_compare;
+	  x86_64_jump_table->c_data[dill_jmp_cgtl].data1 = dill_gt_code;
+	  x86_64_jump_table->c_data[dill_jmp_cgtl].data2 = DILL_L;
+	  x86_64_jump_table->jmp_c[dill_jmp_cgtp] = x86_64_compare;
+	  x86_64_jump_table->c_data[dill_jmp_cgtp].data1 = dill_gt_code;
+	  x86_64_jump_table->c_data[dill_jmp_cgtp].data2 = DILL_P;
+	  x86_64_jump_table->jmp_c[dill_jmp_cgtd] = x86_64_compare;
+	  x86_64_jump_table->c_data[dill_jmp_cgtd].data1 = dill_gt_code;
+	  x86_64_jump_table->c_data[dill_jmp_cgtd].data2 = DILL_D;
+	  x86_64_jump_table->jmp_c[dill_jmp_cgtf] = x86_64_compare;
+	  x86_64_jump_table->c_data[dill_jmp_cgtf].data1 = dill_gt_code;
+	  x86_64_jump_table->c_data[dill_jmp_cgtf].data2 = DILL_F;
+	  x86_64_jump_table->jmp_c[dill_jmp_clec] = x86_64_compare;
+	  x86_64_jump_table->c_data[dill_jmp_clec].data1 = dill_le_code;
+	  x86_64_jump_table->c_data[dill_jmp_clec].data2 = DILL_C;
+	  x86_64_jump_table->jmp_c[dill_jmp_cleuc] = x86_64_compare;
+	  x86_64_jump_table->c_data[dill_jmp_cleuc].data1 = dill_le_code;
+	  x86_64_jump_table->c_data[dill_jmp_cleuc].data2 = DILL_UC;
+	  x86_64_jump_table->jmp_c[dill_jmp_cles] = x86_64_compare;
+	  x86_64_jump_table->c_data[dill_jmp_cles].data1 = dill_le_code;
+	  x86_64_jump_table->c_data[dill_jmp_cles].data2 = DILL_S;
+	  x86_64_jump_table->jmp_c[dill_jmp_cleus] = x86_64_compare;
+	  x86_64_jump_table->c_data[dill_jmp_cleus].data1 = dill_le_code;
+	  x86_64_jump_table->c_data[dill_jmp_cleus].data2 = DILL_US;
+	  x86_64_jump_table->jmp_c[dill_jmp_clei] = x86_64_compare;
+	  x86_64_jump_table->c_data[dill_jmp_clei].data1 = dill_le_code;
+	  x86_64_jump_table->c_data[dill_jmp_clei].data2 = DILL_I;
+	  x86_64_jump_table->jmp_c[dill_jmp_cleu] = x86_64_compare;
+	  x86_64_jump_table->c_data[dill_jmp_cleu].data1 = dill_le_code;
+	  x86_64_jump_table->c_data[dill_jmp_cleu].data2 = DILL_U;
+	  x86_64_jump_table->jmp_c[dill_jmp_cleul] = x86_64_compare;
+	  x86_64_jump_table->c_data[dill_jmp_cleul].data1 = dill_le_code;
+	  x86_64_jump_table->c_data[dill_jmp_cleul].data2 = DILL_UL;
+	  x86_64_jump_table->jmp_c[dill_jmp_clel] = x86_64_compare;
+	  x86_64_jump_table->c_data[dill_jmp_clel].data1 = dill_le_code;
+	  x86_64_jump_table->c_data[dill_jmp_clel].data2 = DILL_L;
+	  x86_64_jump_table->jmp_c[dill_jmp_clep] = x86_64_compare;
+	  x86_64_jump_table->c_data[dill_jmp_clep].data1 = dill_le_code;
+	  x86_64_jump_table->c_data[dill_jmp_clep].data2 = DILL_P;
+	  x86_64_jump_table->jmp_c[dill_jmp_cled] = x86_64_compare;
+	  x86_64_jump_table->c_data[dill_jmp_cled].data1 = dill_le_code;
+	  x86_64_jump_table->c_data[dill_jmp_cled].data2 = DILL_D;
+	  x86_64_jump_table->jmp_c[dill_jmp_clef] = x86_64_compare;
+	  x86_64_jump_table->c_data[dill_jmp_clef].data1 = dill_le_code;
+	  x86_64_jump_table->c_data[dill_jmp_clef].data2 = DILL_F;
+	  x86_64_jump_table->jmp_c[dill_jmp_cltc] = x86_64_compare;
+	  x86_64_jump_table->c_data[dill_jmp_cltc].data1 = dill_lt_code;
+	  x86_64_jump_table->c_data[dill_jmp_cltc].data2 = DILL_C;
+	  x86_64_jump_table->jmp_c[dill_jmp_cltuc] = x86_64_compare;
+	  x86_64_jump_table->c_data[dill_jmp_cltuc].data1 = dill_lt_code;
+	  x86_64_jump_table->c_data[dill_jmp_cltuc].data2 = DILL_UC;
+	  x86_64_jump_table->jmp_c[dill_jmp_clts] = x86_64_compare;
+	  x86_64_jump_table->c_data[dill_jmp_clts].data1 = dill_lt_code;
+	  x86_64_jump_table->c_data[dill_jmp_clts].data2 = DILL_S;
+	  x86_64_jump_table->jmp_c[dill_jmp_cltus] = x86_64_compare;
+	  x86_64_jump_table->c_data[dill_jmp_cltus].data1 = dill_lt_code;
+	  x86_64_jump_table->c_data[dill_jmp_cltus].data2 = DILL_US;
+	  x86_64_jump_table->jmp_c[dill_jmp_clti] = x86_64_compare;
+	  x86_64_jump_table->c_data[dill_jmp_clti].data1 = dill_lt_code;
+	  x86_64_jump_table->c_data[dill_jmp_clti].data2 = DILL_I;
+	  x86_64_jump_table->jmp_c[dill_jmp_cltu] = x86_64_compare;
+	  x86_64_jump_table->c_data[dill_jmp_cltu].data1 = dill_lt_code;
+	  x86_64_jump_table->c_data[dill_jmp_cltu].data2 = DILL_U;
+	  x86_64_jump_table->jmp_c[dill_jmp_cltul] = x86_64_compare;
+	  x86_64_jump_table->c_data[dill_jmp_cltul].data1 = dill_lt_code;
+	  x86_64_jump_table->c_data[dill_jmp_cltul].data2 = DILL_UL;
+	  x86_64_jump_table->jmp_c[dill_jmp_cltl] = x86_64_compare;
+	  x86_64_jump_table->c_data[dill_jmp_cltl].data1 = dill_lt_code;
+	  x86_64_jump_table->c_data[dill_jmp_cltl].data2 = DILL_L;
+	  x86_64_jump_table->jmp_c[dill_jmp_cltp] = x86_64_compare;
+	  x86_64_jump_table->c_data[dill_jmp_cltp].data1 = dill_lt_code;
+	  x86_64_jump_table->c_data[dill_jmp_cltp].data2 = DILL_P;
+	  x86_64_jump_table->jmp_c[dill_jmp_cltd] = x86_64_compare;
+	  x86_64_jump_table->c_data[dill_jmp_cltd].data1 = dill_lt_code;
+	  x86_64_jump_table->c_data[dill_jmp_cltd].data2 = DILL_D;
+	  x86_64_jump_table->jmp_c[dill_jmp_cltf] = x86_64_compare;
+	  x86_64_jump_table->c_data[dill_jmp_cltf].data1 = dill_lt_code;
+	  x86_64_jump_table->c_data[dill_jmp_cltf].data2 = DILL_F;
+	  x86_64_jump_table->jmp_c[dill_jmp_cnec] = x86_64_compare;
+	  x86_64_jump_table->c_data[dill_jmp_cnec].data1 = dill_ne_code;
+	  x86_64_jump_table->c_data[dill_jmp_cnec].data2 = DILL_C;
+	  x86_64_jump_table->jmp_c[dill_jmp_cneuc] = x86_64_compare;
+	  x86_64_jump_table->c_data[dill_jmp_cneuc].data1 = dill_ne_code;
+	  x86_64_jump_table->c_data[dill_jmp_cneuc].data2 = DILL_UC;
+	  x86_64_jump_table->jmp_c[dill_jmp_cnes] = x86_64_compare;
+	  x86_64_jump_table->c_data[dill_jmp_cnes].data1 = dill_ne_code;
+	  x86_64_jump_table->c_data[dill_jmp_cnes].data2 = DILL_S;
+	  x86_64_jump_table->jmp_c[dill_jmp_cneus] = x86_64_compare;
+	  x86_64_jump_table->c_data[dill_jmp_cneus].data1 = dill_ne_code;
+	  x86_64_jump_table->c_data[dill_jmp_cneus].data2 = DILL_US;
+	  x86_64_jump_table->jmp_c[dill_jmp_cnei] = x86_64_compare;
+	  x86_64_jump_table->c_data[dill_jmp_cnei].data1 = dill_ne_code;
+	  x86_64_jump_table->c_data[dill_jmp_cnei].data2 = DILL_I;
+	  x86_64_jump_table->jmp_c[dill_jmp_cneu] = x86_64_compare;
+	  x86_64_jump_table->c_data[dill_jmp_cneu].data1 = dill_ne_code;
+	  x86_64_jump_table->c_data[dill_jmp_cneu].data2 = DILL_U;
+	  x86_64_jump_table->jmp_c[dill_jmp_cneul] = x86_64_compare;
+	  x86_64_jump_table->c_data[dill_jmp_cneul].data1 = dill_ne_code;
+	  x86_64_jump_table->c_data[dill_jmp_cneul].data2 = DILL_UL;
+	  x86_64_jump_table->jmp_c[dill_jmp_cnel] = x86_64_compare;
+	  x86_64_jump_table->c_data[dill_jmp_cnel].data1 = dill_ne_code;
+	  x86_64_jump_table->c_data[dill_jmp_cnel].data2 = DILL_L;
+	  x86_64_jump_table->jmp_c[dill_jmp_cnep] = x86_64_compare;
+	  x86_64_jump_table->c_data[dill_jmp_cnep].data1 = dill_ne_code;
+	  x86_64_jump_table->c_data[dill_jmp_cnep].data2 = DILL_P;
+	  x86_64_jump_table->jmp_c[dill_jmp_cned] = x86_64_compare;
+	  x86_64_jump_table->c_data[dill_jmp_cned].data1 = dill_ne_code;
+	  x86_64_jump_table->c_data[dill_jmp_cned].data2 = DILL_D;
+	  x86_64_jump_table->jmp_c[dill_jmp_cnef] = x86_64_compare;
+	  x86_64_jump_table->c_data[dill_jmp_cnef].data1 = dill_ne_code;
+	  x86_64_jump_table->c_data[dill_jmp_cnef].data2 = DILL_F;
+	  x86_64_jump_table->jmp_ci[dill_jmp_ceqc] = x86_64_comparei;
+	  x86_64_jump_table->jmp_ci[dill_jmp_cequc] = x86_64_comparei;
+	  x86_64_jump_table->jmp_ci[dill_jmp_ceqs] = x86_64_comparei;
+	  x86_64_jump_table->jmp_ci[dill_jmp_cequs] = x86_64_comparei;
+	  x86_64_jump_table->jmp_ci[dill_jmp_ceqi] = x86_64_comparei;
+	  x86_64_jump_table->jmp_ci[dill_jmp_cequ] = x86_64_comparei;
+	  x86_64_jump_table->jmp_ci[dill_jmp_cequl] = x86_64_comparei;
+	  x86_64_jump_table->jmp_ci[dill_jmp_ceql] = x86_64_comparei;
+	  x86_64_jump_table->jmp_ci[dill_jmp_ceqp] = x86_64_comparei;
+	  x86_64_jump_table->jmp_ci[dill_jmp_cgec] = x86_64_comparei;
+	  x86_64_jump_table->jmp_ci[dill_jmp_cgeuc] = x86_64_comparei;
+	  x86_64_jump_table->jmp_ci[dill_jmp_cges] = x86_64_comparei;
+	  x86_64_jump_table->jmp_ci[dill_jmp_cgeus] = x86_64_comparei;
+	  x86_64_jump_table->jmp_ci[dill_jmp_cgei] = x86_64_comparei;
+	  x86_64_jump_table->jmp_ci[dill_jmp_cgeu] = x86_64_comparei;
+	  x86_64_jump_table->jmp_ci[dill_jmp_cgeul] = x86_64_comparei;
+	  x86_64_jump_table->jmp_ci[dill_jmp_cgel] = x86_64_comparei;
+	  x86_64_jump_table->jmp_ci[dill_jmp_cgep] = x86_64_comparei;
+	  x86_64_jump_table->jmp_ci[dill_jmp_cgtc] = x86_64_comparei;
+	  x86_64_jump_table->jmp_ci[dill_jmp_cgtuc] = x86_64_comparei;
+	  x86_64_jump_table->jmp_ci[dill_jmp_cgts] = x86_64_comparei;
+	  x86_64_jump_table->jmp_ci[dill_jmp_cgtus] = x86_64_comparei;
+	  x86_64_jump_table->jmp_ci[dill_jmp_cgti] = x86_64_comparei;
+	  x86_64_jump_table->jmp_ci[dill_jmp_cgtu] = x86_64_comparei;
+	  x86_64_jump_table->jmp_ci[dill_jmp_cgtul] = x86_64_comparei;
+	  x86_64_jump_table->jmp_ci[dill_jmp_cgtl] = x86_64_comparei;
+	  x86_64_jump_table->jmp_ci[dill_jmp_cgtp] = x86_64_comparei;
+	  x86_64_jump_table->jmp_ci[dill_jmp_clec] = x86_64_comparei;
+	  x86_64_jump_table->jmp_ci[dill_jmp_cleuc] = x86_64_comparei;
+	  x86_64_jump_table->jmp_ci[dill_jmp_cles] = x86_64_comparei;
+	  x86_64_jump_table->jmp_ci[dill_jmp_cleus] = x86_64_comparei;
+	  x86_64_jump_table->jmp_ci[dill_jmp_clei] = x86_64_comparei;
+	  x86_64_jump_table->jmp_ci[dill_jmp_cleu] = x86_64_comparei;
+	  x86_64_jump_table->jmp_ci[dill_jmp_cleul] = x86_64_comparei;
+	  x86_64_jump_table->jmp_ci[dill_jmp_clel] = x86_64_comparei;
+	  x86_64_jump_table->jmp_ci[dill_jmp_clep] = x86_64_comparei;
+	  x86_64_jump_table->jmp_ci[dill_jmp_cltc] = x86_64_comparei;
+	  x86_64_jump_table->jmp_ci[dill_jmp_cltuc] = x86_64_comparei;
+	  x86_64_jump_table->jmp_ci[dill_jmp_clts] = x86_64_comparei;
+	  x86_64_jump_table->jmp_ci[dill_jmp_cltus] = x86_64_comparei;
+	  x86_64_jump_table->jmp_ci[dill_jmp_clti] = x86_64_comparei;
+	  x86_64_jump_table->jmp_ci[dill_jmp_cltu] = x86_64_comparei;
+	  x86_64_jump_table->jmp_ci[dill_jmp_cltul] = x86_64_comparei;
+	  x86_64_jump_table->jmp_ci[dill_jmp_cltl] = x86_64_comparei;
+	  x86_64_jump_table->jmp_ci[dill_jmp_cltp] = x86_64_comparei;
+	  x86_64_jump_table->jmp_ci[dill_jmp_cnec] = x86_64_comparei;
+	  x86_64_jump_table->jmp_ci[dill_jmp_cneuc] = x86_64_comparei;
+	  x86_64_jump_table->jmp_ci[dill_jmp_cnes] = x86_64_comparei;
+	  x86_64_jump_table->jmp_ci[dill_jmp_cneus] = x86_64_comparei;
+	  x86_64_jump_table->jmp_ci[dill_jmp_cnei] = x86_64_comparei;
+	  x86_64_jump_table->jmp_ci[dill_jmp_cneu] = x86_64_comparei;
+	  x86_64_jump_table->jmp_ci[dill_jmp_cneul] = x86_64_comparei;
+	  x86_64_jump_table->jmp_ci[dill_jmp_cnel] = x86_64_comparei;
+	  x86_64_jump_table->jmp_ci[dill_jmp_cnep] = x86_64_comparei;
+	  x86_64_jump_table->proc_start = (dill_mach_proc_start) x86_64_proc_start;
+	  x86_64_jump_table->end = x86_64_end;
+	  x86_64_jump_table->package_end = x86_64_package_end;
+	  x86_64_jump_table->clone_code = x86_64_clone_code;
+	  x86_64_jump_table->type_align = x86_64_type_align;
+	  x86_64_jump_table->type_size = x86_64_type_size;
+	  x86_64_jump_table->ret = x86_64_ret;
+	  x86_64_jump_table->reti = x86_64_reti;
+	  x86_64_jump_table->retf = (ret_opf)x86_64_retf;
+	  x86_64_jump_table->load = x86_64_pload;
+	  x86_64_jump_table->bsload = x86_64_pbsload;
+	  x86_64_jump_table->loadi = x86_64_ploadi;
+	  x86_64_jump_table->bsloadi = x86_64_pbsloadi;
+	  x86_64_jump_table->loadi = x86_64_ploadi;
+	  x86_64_jump_table->store = x86_64_pstore;
+	  x86_64_jump_table->storei = x86_64_pstorei;
+	  x86_64_jump_table->convert = x86_64_convert;
+	  x86_64_jump_table->mov = x86_64_mov;
+	  x86_64_jump_table->set = x86_64_pset;
+	  x86_64_jump_table->setf = x86_64_setf;
+	  x86_64_jump_table->setp = x86_64_setp;
+	  x86_64_jump_table->jv = x86_64_jump_to_label;
+	  x86_64_jump_table->jp = x86_64_jump_to_reg;
+	  x86_64_jump_table->jpi = x86_64_jump_to_imm;
+	  x86_64_jump_table->jal = x86_64_jal;
+	  x86_64_jump_table->special = x86_64_special;
+	  x86_64_jump_table->push = x86_64_push;
+	  x86_64_jump_table->pushi = x86_64_pushi;
+	  x86_64_jump_table->pushpi = x86_64_pushpi;
+	  x86_64_jump_table->pushfi = x86_64_pushfi;
+	  x86_64_jump_table->calli = x86_64_calli;
+	  x86_64_jump_table->callr = x86_64_callr;
+	  x86_64_jump_table->local = x86_64_local_op;
+	  x86_64_jump_table->save_restore = x86_64_save_restore_op;
+	  x86_64_jump_table->init_disassembly = x86_64_init_disassembly_info;
+	  x86_64_jump_table->print_insn = x86_64_print_insn;
+	  x86_64_jump_table->print_reg = x86_64_print_reg;
+	  x86_64_jump_table->count_insn = x86_64_count_insn;
+	  x86_64_jump_table->do_reverse_push = 0;
+	  x86_64_jump_table->target_byte_order = 2;  /* Format_Integer_littleendian */
+	  x86_64_jump_table->target_float_format = 2;  /* Format_IEEE_754_littleendian */ 
+	s->j = x86_64_jump_table;
+	s->dill_local_pointer = EBP;
+	s->dill_param_reg_pointer = EBP;
+	s->p->mach_info = (void*)gen_x86_64_mach_info(s);
+	s->p->machine_strr_tmp_reg = EAX;
+	return;
+}
@@ -0,0 +1,33 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/thirdparty/enet/enet/callbacks.c" "thirdparty/enet/enet/CMakeFiles/enet.dir/callbacks.c.o" "gcc" "thirdparty/enet/enet/CMakeFiles/enet.dir/callbacks.c.o.d"
+  "/root/repo/thirdparty/enet/enet/compress.c" "thirdparty/enet/enet/CMakeFiles/enet.dir/compress.c.o" "gcc" "thirdparty/enet/enet/CMakeFiles/enet.dir/compress.c.o.d"
+  "/root/repo/thirdparty/enet/enet/host.c" "thirdparty/enet/enet/CMakeFiles/enet.dir/host.c.o" "gcc" "thirdparty/enet/enet/CMakeFiles/enet.dir/host.c.o.d"
+  "/root/repo/thirdparty/enet/enet/list.c" "thirdparty/enet/enet/CMakeFiles/enet.dir/list.c.o" "gcc" "thirdparty/enet/enet/CMakeFiles/enet.dir/list.c.o.d"
+  "/root/repo/thirdparty/enet/enet/packet.c" "thirdparty/enet/enet/CMakeFiles/enet.dir/packet.c.o" "gcc" "thirdparty/enet/enet/CMakeFiles/enet.dir/packet.c.o.d"
+  "/root/repo/thirdparty/enet/enet/peer.c" "thirdparty/enet/enet/CMakeFiles/enet.dir/peer.c.o" "gcc" "thirdparty/enet/enet/CMakeFiles/enet.dir/peer.c.o.d"
+  "/root/repo/thirdparty/enet/enet/protocol.c" "thirdparty/enet/enet/CMakeFiles/enet.dir/protocol.c.o" "gcc" "thirdparty/enet/enet/CMakeFiles/enet.dir/protocol.c.o.d"
+  "/root/repo/thirdparty/enet/enet/unix.c" "thirdparty/enet/enet/CMakeFiles/enet.dir/unix.c.o" "gcc" "thirdparty/enet/enet/CMakeFiles/enet.dir/unix.c.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_derived_build/lib/libadios2_enet.so" "/root/repo/_derived_build/lib/libadios2_enet.so.2.10.0"
+  "/root/repo/_derived_build/lib/libadios2_enet.so.2.10" "/root/repo/_derived_build/lib/libadios2_enet.so.2.10.0"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,27 @@
+file(REMOVE_RECURSE
+  "../../../lib/libadios2_enet.pdb"
+  "../../../lib/libadios2_enet.so"
+  "../../../lib/libadios2_enet.so.2.10"
+  "../../../lib/libadios2_enet.so.2.10.0"
+  "CMakeFiles/enet.dir/callbacks.c.o"
+  "CMakeFiles/enet.dir/callbacks.c.o.d"
+  "CMakeFiles/enet.dir/compress.c.o"
+  "CMakeFiles/enet.dir/compress.c.o.d"
+  "CMakeFiles/enet.dir/host.c.o"
+  "CMakeFiles/enet.dir/host.c.o.d"
+  "CMakeFiles/enet.dir/list.c.o"
+  "CMakeFiles/enet.dir/list.c.o.d"
+  "CMakeFiles/enet.dir/packet.c.o"
+  "CMakeFiles/enet.dir/packet.c.o.d"
+  "CMakeFiles/enet.dir/peer.c.o"
+  "CMakeFiles/enet.dir/peer.c.o.d"
+  "CMakeFiles/enet.dir/protocol.c.o"
+  "CMakeFiles/enet.dir/protocol.c.o.d"
+  "CMakeFiles/enet.dir/unix.c.o"
+  "CMakeFiles/enet.dir/unix.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/enet.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/docs"
+  "cod_node.c"
+  "lex.yy.c"
+  "structs.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/docs.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,48 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/_derived_build/thirdparty/ffs/ffs/cod.tab.c" "thirdparty/ffs/ffs/CMakeFiles/ffs.dir/cod.tab.c.o" "gcc" "thirdparty/ffs/ffs/CMakeFiles/ffs.dir/cod.tab.c.o.d"
+  "/root/repo/thirdparty/ffs/ffs/cod/cg.c" "thirdparty/ffs/ffs/CMakeFiles/ffs.dir/cod/cg.c.o" "gcc" "thirdparty/ffs/ffs/CMakeFiles/ffs.dir/cod/cg.c.o.d"
+  "/root/repo/thirdparty/ffs/ffs/cod/standard.c" "thirdparty/ffs/ffs/CMakeFiles/ffs.dir/cod/standard.c.o" "gcc" "thirdparty/ffs/ffs/CMakeFiles/ffs.dir/cod/standard.c.o.d"
+  "/root/repo/_derived_build/thirdparty/ffs/ffs/cod_node.c" "thirdparty/ffs/ffs/CMakeFiles/ffs.dir/cod_node.c.o" "gcc" "thirdparty/ffs/ffs/CMakeFiles/ffs.dir/cod_node.c.o.d"
+  "/root/repo/thirdparty/ffs/ffs/ffs/evol.c" "thirdparty/ffs/ffs/CMakeFiles/ffs.dir/ffs/evol.c.o" "gcc" "thirdparty/ffs/ffs/CMakeFiles/ffs.dir/ffs/evol.c.o.d"
+  "/root/repo/thirdparty/ffs/ffs/ffs/ffs.c" "thirdparty/ffs/ffs/CMakeFiles/ffs.dir/ffs/ffs.c.o" "gcc" "thirdparty/ffs/ffs/CMakeFiles/ffs.dir/ffs/ffs.c.o.d"
+  "/root/repo/thirdparty/ffs/ffs/ffs/ffs_conv.c" "thirdparty/ffs/ffs/CMakeFiles/ffs.dir/ffs/ffs_conv.c.o" "gcc" "thirdparty/ffs/ffs/CMakeFiles/ffs.dir/ffs/ffs_conv.c.o.d"
+  "/root/repo/thirdparty/ffs/ffs/ffs/ffs_file.c" "thirdparty/ffs/ffs/CMakeFiles/ffs.dir/ffs/ffs_file.c.o" "gcc" "thirdparty/ffs/ffs/CMakeFiles/ffs.dir/ffs/ffs_file.c.o.d"
+  "/root/repo/thirdparty/ffs/ffs/ffs/ffs_formats.c" "thirdparty/ffs/ffs/CMakeFiles/ffs.dir/ffs/ffs_formats.c.o" "gcc" "thirdparty/ffs/ffs/CMakeFiles/ffs.dir/ffs/ffs_formats.c.o.d"
+  "/root/repo/thirdparty/ffs/ffs/ffs/ffs_gen.c" "thirdparty/ffs/ffs/CMakeFiles/ffs.dir/ffs/ffs_gen.c.o" "gcc" "thirdparty/ffs/ffs/CMakeFiles/ffs.dir/ffs/ffs_gen.c.o.d"
+  "/root/repo/thirdparty/ffs/ffs/ffs/ffs_marshal.c" "thirdparty/ffs/ffs/CMakeFiles/ffs.dir/ffs/ffs_marshal.c.o" "gcc" "thirdparty/ffs/ffs/CMakeFiles/ffs.dir/ffs/ffs_marshal.c.o.d"
+  "/root/repo/thirdparty/ffs/ffs/fm/fm_dump.c" "thirdparty/ffs/ffs/CMakeFiles/ffs.dir/fm/fm_dump.c.o" "gcc" "thirdparty/ffs/ffs/CMakeFiles/ffs.dir/fm/fm_dump.c.o.d"
+  "/root/repo/thirdparty/ffs/ffs/fm/fm_formats.c" "thirdparty/ffs/ffs/CMakeFiles/ffs.dir/fm/fm_formats.c.o" "gcc" "thirdparty/ffs/ffs/CMakeFiles/ffs.dir/fm/fm_formats.c.o.d"
+  "/root/repo/thirdparty/ffs/ffs/fm/fm_get.c" "thirdparty/ffs/ffs/CMakeFiles/ffs.dir/fm/fm_get.c.o" "gcc" "thirdparty/ffs/ffs/CMakeFiles/ffs.dir/fm/fm_get.c.o.d"
+  "/root/repo/thirdparty/ffs/ffs/fm/lookup3.c" "thirdparty/ffs/ffs/CMakeFiles/ffs.dir/fm/lookup3.c.o" "gcc" "thirdparty/ffs/ffs/CMakeFiles/ffs.dir/fm/lookup3.c.o.d"
+  "/root/repo/thirdparty/ffs/ffs/fm/server_acts.c" "thirdparty/ffs/ffs/CMakeFiles/ffs.dir/fm/server_acts.c.o" "gcc" "thirdparty/ffs/ffs/CMakeFiles/ffs.dir/fm/server_acts.c.o.d"
+  "/root/repo/thirdparty/ffs/ffs/fm/string_conversion.c" "thirdparty/ffs/ffs/CMakeFiles/ffs.dir/fm/string_conversion.c.o" "gcc" "thirdparty/ffs/ffs/CMakeFiles/ffs.dir/fm/string_conversion.c.o.d"
+  "/root/repo/thirdparty/ffs/ffs/fm/unix_io.c" "thirdparty/ffs/ffs/CMakeFiles/ffs.dir/fm/unix_io.c.o" "gcc" "thirdparty/ffs/ffs/CMakeFiles/ffs.dir/fm/unix_io.c.o.d"
+  "/root/repo/thirdparty/ffs/ffs/fm/xml.c" "thirdparty/ffs/ffs/CMakeFiles/ffs.dir/fm/xml.c.o" "gcc" "thirdparty/ffs/ffs/CMakeFiles/ffs.dir/fm/xml.c.o.d"
+  "/root/repo/thirdparty/ffs/ffs/version.c" "thirdparty/ffs/ffs/CMakeFiles/ffs.dir/version.c.o" "gcc" "thirdparty/ffs/ffs/CMakeFiles/ffs.dir/version.c.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_derived_build/lib/libadios2_ffs.so" "/root/repo/_derived_build/lib/libadios2_ffs.so.2.10.0"
+  "/root/repo/_derived_build/lib/libadios2_ffs.so.2.10" "/root/repo/_derived_build/lib/libadios2_ffs.so.2.10.0"
+  "/root/repo/_derived_build/thirdparty/ffs/ffs/structs.h" "/root/repo/_derived_build/thirdparty/ffs/ffs/cod_node.c"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_derived_build/thirdparty/dill/dill/CMakeFiles/dill.dir/DependInfo.cmake"
+  "/root/repo/_derived_build/thirdparty/atl/atl/CMakeFiles/atl.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,55 @@
+file(REMOVE_RECURSE
+  "../../../lib/libadios2_ffs.pdb"
+  "../../../lib/libadios2_ffs.so"
+  "../../../lib/libadios2_ffs.so.2.10"
+  "../../../lib/libadios2_ffs.so.2.10.0"
+  "CMakeFiles/ffs.dir/cod.tab.c.o"
+  "CMakeFiles/ffs.dir/cod.tab.c.o.d"
+  "CMakeFiles/ffs.dir/cod/cg.c.o"
+  "CMakeFiles/ffs.dir/cod/cg.c.o.d"
+  "CMakeFiles/ffs.dir/cod/standard.c.o"
+  "CMakeFiles/ffs.dir/cod/standard.c.o.d"
+  "CMakeFiles/ffs.dir/cod_node.c.o"
+  "CMakeFiles/ffs.dir/cod_node.c.o.d"
+  "CMakeFiles/ffs.dir/ffs/evol.c.o"
+  "CMakeFiles/ffs.dir/ffs/evol.c.o.d"
+  "CMakeFiles/ffs.dir/ffs/ffs.c.o"
+  "CMakeFiles/ffs.dir/ffs/ffs.c.o.d"
+  "CMakeFiles/ffs.dir/ffs/ffs_conv.c.o"
+  "CMakeFiles/ffs.dir/ffs/ffs_conv.c.o.d"
+  "CMakeFiles/ffs.dir/ffs/ffs_file.c.o"
+  "CMakeFiles/ffs.dir/ffs/ffs_file.c.o.d"
+  "CMakeFiles/ffs.dir/ffs/ffs_formats.c.o"
+  "CMakeFiles/ffs.dir/ffs/ffs_formats.c.o.d"
+  "CMakeFiles/ffs.dir/ffs/ffs_gen.c.o"
+  "CMakeFiles/ffs.dir/ffs/ffs_gen.c.o.d"
+  "CMakeFiles/ffs.dir/ffs/ffs_marshal.c.o"
+  "CMakeFiles/ffs.dir/ffs/ffs_marshal.c.o.d"
+  "CMakeFiles/ffs.dir/fm/fm_dump.c.o"
+  "CMakeFiles/ffs.dir/fm/fm_dump.c.o.d"
+  "CMakeFiles/ffs.dir/fm/fm_formats.c.o"
+  "CMakeFiles/ffs.dir/fm/fm_formats.c.o.d"
+  "CMakeFiles/ffs.dir/fm/fm_get.c.o"
+  "CMakeFiles/ffs.dir/fm/fm_get.c.o.d"
+  "CMakeFiles/ffs.dir/fm/lookup3.c.o"
+  "CMakeFiles/ffs.dir/fm/lookup3.c.o.d"
+  "CMakeFiles/ffs.dir/fm/server_acts.c.o"
+  "CMakeFiles/ffs.dir/fm/server_acts.c.o.d"
+  "CMakeFiles/ffs.dir/fm/string_conversion.c.o"
+  "CMakeFiles/ffs.dir/fm/string_conversion.c.o.d"
+  "CMakeFiles/ffs.dir/fm/unix_io.c.o"
+  "CMakeFiles/ffs.dir/fm/unix_io.c.o.d"
+  "CMakeFiles/ffs.dir/fm/xml.c.o"
+  "CMakeFiles/ffs.dir/fm/xml.c.o.d"
+  "CMakeFiles/ffs.dir/version.c.o"
+  "CMakeFiles/ffs.dir/version.c.o.d"
+  "cod.tab.c"
+  "cod_node.c"
+  "lex.yy.c"
+  "structs.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ffs.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/generated"
+  "cod.tab.c"
+  "cod_node.c"
+  "lex.yy.c"
+  "structs.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/generated.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,158 @@
+/* config.h is generated from config.h.cmake by cmake.  */
+
+/* Define with the name of the host which will run the format server */
+#define FORMAT_SERVER_HOST "formathost.cercs.gatech.edu"
+
+/* Define with a list of domains from which the server will accept format clients  */
+/* #undef FORMAT_SERVICE_DOMAIN */
+
+/* define if struct hostent is declared in netdb.h or winsock.h */
+/* #undef HAS_STRUCT_HOSTENT */
+
+/* Define to 1 if you have the <atl.h> header file. */
+#define HAVE_ATL_H
+
+/* Define to 1 if you have the <dill.h> header file. */
+#define HAVE_DILL_H
+
+/* Define to 1 if you have the `getdomainname' function. */
+#define HAVE_GETDOMAINNAME
+
+/* Define to 1 if you have the `gethostbyname' function. */
+/* #undef HAVE_GETHOSTBYNAME */
+
+/* Define to 1 if you have the <inttypes.h> header file. */
+/* #undef HAVE_INTTYPES_H */
+
+/* Define to 1 if you have the struct iovec defined in a header file. */
+#define HAVE_IOVEC_DEFINE
+
+/* Define to 1 if you have the <malloc.h> header file. */
+#define HAVE_MALLOC_H
+
+/* Define to 1 if you have the <memory.h> header file. */
+#define HAVE_MEMORY_H
+
+/* Define to 1 if you have the <netdb.h> header file. */
+#define HAVE_NETDB_H
+
+/* Define to 1 if you have the <netinet/in.h> header file. */
+#define HAVE_NETINET_IN_H
+
+/* Define to 1 if you have the <arpa/inet.h> header file. */
+#define HAVE_ARPA_INET_H
+
+/* Define to 1 if you have the <sockLib.h> header file. */
+/* #undef HAVE_SOCKLIB_H */
+
+/* Define to 1 if you have stdc headers. */
+#define STDC_HEADERS
+
+/* Define to 1 if you have the <stdlib.h> header file. */
+#define HAVE_STDLIB_H
+
+/* Define to 1 if you have the <strings.h> header file. */
+/* #undef HAVE_STRINGS_H */
+
+/* Define to 1 if you have the <string.h> header file. */
+#define HAVE_STRING_H
+
+/* Define to 1 if you have the `strtod' function. */
+#define HAVE_STRTOD
+
+/* Define to 1 if you have the `strtof' function. */
+#define HAVE_STRTOF
+
+/* Define to 1 if you have the `strtold' function. */
+#define HAVE_STRTOLD
+
+/* Define to 1 if you have the <sys/select.h> header file. */
+#define HAVE_SYS_SELECT_H
+
+/* Define to 1 if you have the <sys/socket.h> header file. */
+#define HAVE_SYS_SOCKET_H
+
+/* Define to 1 if you have the <sys/sockio.h> header file. */
+/* #undef HAVE_SYS_SOCKIO_H */
+
+/* Define to 1 if you have the <sys/stat.h> header file. */
+/* #undef HAVE_SYS_STAT_H */
+
+/* Define to 1 if you have the <sys/times.h> header file. */
+#define HAVE_SYS_TIMES_H
+
+/* Define to 1 if you have the <sys/time.h> header file. */
+#define HAVE_SYS_TIME_H
+
+/* Define to 1 if you have the <sys/types.h> header file. */
+#define HAVE_SYS_TYPES_H
+
+/* Define to 1 if you have the <sys/uio.h> header file. */
+#define HAVE_SYS_UIO_H
+
+/* Define to 1 if you have the <sys/un.h> header file. */
+#define HAVE_SYS_UN_H
+
+/* Define to 1 if you have the <unistd.h> header file. */
+#define HAVE_UNISTD_H
+
+/* Define to 1 if you have the <windows.h> header file. */
+/* #undef HAVE_WINDOWS_H */
+
+/* Define to 1 if you have the <winsock.h> header file. */
+/* #undef HAVE_WINSOCK_H */
+
+/* Define to 1 if you have the <winsock2.h> header file. */
+/* #undef HAVE_WINSOCK2_H */
+
+/* Define if you need struct iovec to be defined */
+/* #undef NEED_IOVEC_DEFINE */
+
+/* Define if there is no socket support */
+/* #undef NO_SOCKET */
+
+/* The number of bytes in type double */
+#define SIZEOF_DOUBLE 8
+
+/* The number of bytes in type off_t */
+#define SIZEOF_OFF_T 8
+
+/* The number of bytes in type float */
+#define SIZEOF_FLOAT 4
+
+/* The number of bytes in type int */
+#define SIZEOF_INT 4
+
+/* The number of bytes in type long */
+#define SIZEOF_LONG 8
+
+/* The number of bytes in type long double */
+#define SIZEOF_LONG_DOUBLE 16
+
+/* The number of bytes in type long long */
+#define SIZEOF_LONG_LONG 8
+
+/* The number of bytes in type size_t */
+#define SIZEOF_SIZE_T 8
+
+/* Define to `int' if <sys/types.h> does not define. */
+/* #undef pid_t */
+
+/* Define as the 8-byte type to use for data length */
+#define DATA_LEN_TYPE long
+
+/* Define if ffs should do dynamic code generation */
+#define DO_DCG
+
+/* Define with a boolean to specify if DCG conversions will be generated by
+   default */
+#define FFS_CONVERSION_GENERATION_DEFAULT 0
+
+/* define to the string value of shared library suffix */
+#define LIBRARY_EXT ".so"
+
+/* Set to 1 to build without dynamic linking  */
+#define NO_DYNAMIC_LINKING  1
+
+/* set to 1 if bigendian, 0 otherwise */
+#define WORDS_BIGENDIAN 0
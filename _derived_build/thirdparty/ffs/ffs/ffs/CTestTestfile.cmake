@@ -0,0 +1,7 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/thirdparty/ffs/ffs/ffs
+# Build directory: /root/repo/_derived_build/thirdparty/ffs/ffs/ffs
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+set_directory_properties(PROPERTIES LABELS "FFS")
@@ -0,0 +1,7 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/thirdparty/nlohmann_json
+# Build directory: /root/repo/_derived_build/thirdparty/nlohmann_json
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("nlohmann_json_wrapper")
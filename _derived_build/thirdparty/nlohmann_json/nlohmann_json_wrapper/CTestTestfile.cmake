@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/thirdparty/nlohmann_json/nlohmann_json_wrapper
+# Build directory: /root/repo/_derived_build/thirdparty/nlohmann_json/nlohmann_json_wrapper
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
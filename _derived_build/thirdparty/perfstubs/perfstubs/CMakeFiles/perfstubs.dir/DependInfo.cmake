@@ -0,0 +1,26 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/thirdparty/perfstubs/perfstubs/perfstubs_api/timer.c" "thirdparty/perfstubs/perfstubs/CMakeFiles/perfstubs.dir/perfstubs_api/timer.c.o" "gcc" "thirdparty/perfstubs/perfstubs/CMakeFiles/perfstubs.dir/perfstubs_api/timer.c.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_derived_build/lib/libadios2_perfstubs.so" "/root/repo/_derived_build/lib/libadios2_perfstubs.so.2.10.0"
+  "/root/repo/_derived_build/lib/libadios2_perfstubs.so.2.10" "/root/repo/_derived_build/lib/libadios2_perfstubs.so.2.10.0"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
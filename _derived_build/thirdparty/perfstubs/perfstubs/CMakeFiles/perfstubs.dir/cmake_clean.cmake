@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../lib/libadios2_perfstubs.pdb"
+  "../../../lib/libadios2_perfstubs.so"
+  "../../../lib/libadios2_perfstubs.so.2.10"
+  "../../../lib/libadios2_perfstubs.so.2.10.0"
+  "CMakeFiles/perfstubs.dir/perfstubs_api/timer.c.o"
+  "CMakeFiles/perfstubs.dir/perfstubs_api/timer.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/perfstubs.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
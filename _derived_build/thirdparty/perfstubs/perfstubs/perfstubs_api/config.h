@@ -0,0 +1,10 @@
+// the configured options and settings for Tutorial
+// Copyright (c) 2019-2022 University of Oregon
+// Distributed under the BSD Software License
+// (See accompanying file LICENSE.txt)
+#define PerfStubs_VERSION_MAJOR 
+#define PerfStubs_VERSION_MINOR 
+// #define PERFSTUBS_USE_TIMERS
+/* #undef PERFSTUBS_USE_DEFAULT_IMPLEMENTATION */
+/* #undef PERFSTUBS_USE_STATIC */
+
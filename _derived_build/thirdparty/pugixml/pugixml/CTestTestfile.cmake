@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/thirdparty/pugixml/pugixml
+# Build directory: /root/repo/_derived_build/thirdparty/pugixml/pugixml
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
@@ -0,0 +1,7 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/thirdparty/yaml-cpp
+# Build directory: /root/repo/_derived_build/thirdparty/yaml-cpp
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("yaml-cpp")
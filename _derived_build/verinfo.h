@@ -0,0 +1,6 @@
+#define ADIOS_INFO_VER_GIT       ""
+#define ADIOS_INFO_COMPILER_ID   "GNU"
+#define ADIOS_INFO_COMPILER_VER  "12.2.0"
+#define ADIOS_INFO_COMPILER_WRAP ""
+#define ADIOS_INFO_SYSTEM        "Linux-6.18.44-fc-v139"
+#define ADIOS_INFO_ARCH          "x86_64"
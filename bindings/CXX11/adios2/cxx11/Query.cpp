@@ -32,4 +32,16 @@ void QueryWorker::GetResultCoverage(const adios2::Box<adios2::Dims> &outputSelec
         return m_Worker->GetResultCoverage(outputSelection, touched_blocks);
 }
 
+void QueryWorker::GetResultHits(std::vector<adios2::Dims> &hits)
+{
+    if (m_Worker)
+        m_Worker->GetResultHits(hits);
+}
+
+void QueryWorker::GetResultHitCounts(std::vector<std::pair<size_t, size_t>> &block_hit_counts)
+{
+    if (m_Worker)
+        m_Worker->GetResultHitCounts(block_hit_counts);
+}
+
 } // namespace
@@ -38,6 +38,16 @@ public:
     void GetResultCoverage(const adios2::Box<adios2::Dims> &,
                            std::vector<adios2::Box<adios2::Dims>> &touched_blocks);
 
+    // hits are the global coordinates of all elements that satisfy the query,
+    // sorted. Exact, uses the bitmap index written with BP5 QueryIndexBins
+    // if there is one, reads the data of the candidate blocks otherwise.
+    // Global arrays only.
+    void GetResultHits(std::vector<adios2::Dims> &hits);
+
+    // number of elements that satisfy the query in each block that has any,
+    // as (block ID, count) pairs. Single variable queries only.
+    void GetResultHitCounts(std::vector<std::pair<size_t, size_t>> &block_hit_counts);
+
 private:
     std::shared_ptr<adios2::query::Worker> m_Worker;
 }; // class QueryWorker
@@ -325,20 +325,11 @@ class Stream:
 
         self.write(variable, content)
 
-    def _read_var(self, variable: Variable):
+    def _output_shape(self, variable: Variable):
         """
-        Internal common function to read. Settings must be done to Variable before the call.
-
-        Parameters
-            variable
-                adios2.Variable object to be read
-                Use variable.set_selection(), set_block_selection(), set_step_selection()
-                to prepare a read
-        Returns
-            array
-                resulting array from selection
+        Internal function to compute the shape of the array that a read of the
+        variable returns. Settings must be done to Variable before the call.
         """
-        dtype = type_adios_to_numpy(variable.type())
         count = variable.count()
 
         if count != []:
@@ -370,12 +361,81 @@ class Stream:
             else:
                 output_shape = []
 
-        output = np.zeros(output_shape, dtype=dtype)
-        self._engine.get(variable, output)
+        return output_shape
+
+    def _read_output(self, variable: Variable, output=None):
+        """
+        Internal function to check the output array of a read, or to allocate
+        one if output is None. Settings must be done to Variable before the call.
+        """
+        dtype = type_adios_to_numpy(variable.type())
+        output_shape = tuple(int(n) for n in self._output_shape(variable))
+
+        if output is None:
+            # the engine writes every element, no need to zero the array first
+            return np.empty(output_shape, dtype=dtype)
+        if (
+            output.dtype != dtype
+            or output.shape != output_shape
+            or not output.flags.c_contiguous
+            or not output.flags.writeable
+        ):
+            raise ValueError(
+                f"Stream read(), output array for variable {variable.name()} must be a"
+                f" writeable, C contiguous array of shape {output_shape}"
+                f" and type {np.dtype(dtype).name}"
+            )
+        return output
+
+    def _read_var(self, variable: Variable, output=None, mode=bindings.Mode.Sync):
+        """
+        Internal common function to read. Settings must be done to Variable before the call.
+
+        Parameters
+            variable
+                adios2.Variable object to be read
+                Use variable.set_selection(), set_block_selection(), set_step_selection()
+                to prepare a read
+
+            output
+                optional numpy array to read into, it must have the type of the
+                variable, be C contiguous and have the shape of the selection
+
+            mode
+                adios2.bindings.Mode.Deferred leaves the read to a later
+                engine.perform_gets()
+        Returns
+            array
+                resulting array from selection
+        """
+        output = self._read_output(variable, output)
+        self._engine.get(variable, output, mode)
         return output
 
+    def _select(self, variable: Variable, start, count, block_id, step_selection):
+        """Internal common function to apply the selection arguments of read()"""
+        if step_selection is not None and not self._mode == bindings.Mode.ReadRandomAccess:
+            raise RuntimeError("step_selection parameter requires 'rra' mode")
+
+        if step_selection is not None:
+            variable.set_step_selection(step_selection)
+
+        if block_id is not None:
+            variable.set_block_selection(block_id)
+
+        if start != [] and count != []:
+            variable.set_selection([start, count])
+
     @singledispatchmethod
-    def read(self, variable: Variable, start=[], count=[], block_id=None, step_selection=None):
+    def read(
+        self,
+        variable: Variable,
+        start=[],
+        count=[],
+        block_id=None,
+        step_selection=None,
+        output=None,
+    ):
         """
         Read a variable.
         Random access read allowed to select steps.
@@ -398,29 +458,24 @@ class Stream:
 
             step_selection
                 (list): On the form of [start, count].
+
+            output
+                (numpy array) Optional array to read into instead of allocating
+                a new one, e.g. the array returned for the previous step. It must
+                have the type of the variable and as many elements as the selection.
         Returns
             array
                 resulting array from selection
         """
-        if step_selection is not None and not self._mode == bindings.Mode.ReadRandomAccess:
-            raise RuntimeError("step_selection parameter requires 'rra' mode")
-
-        if step_selection is not None:
-            variable.set_step_selection(step_selection)
-
-        if block_id is not None:
-            variable.set_block_selection(block_id)
+        self._select(variable, start, count, block_id, step_selection)
 
         if variable.type() == "string" and variable.single_value() is True:
             return self._engine.get(variable)
 
-        if start != [] and count != []:
-            variable.set_selection([start, count])
-
-        return self._read_var(variable)
+        return self._read_var(variable, output)
 
     @read.register(str)
-    def _(self, name: str, start=[], count=[], block_id=None, step_selection=None):
+    def _(self, name: str, start=[], count=[], block_id=None, step_selection=None, output=None):
         """
         Read a variable.
         Random access read allowed to select steps.
@@ -441,6 +496,10 @@ class Stream:
 
             step_selection
                 (list): On the form of [start, count].
+
+            output
+                (numpy array) Optional array to read into instead of allocating
+                a new one, e.g. the array returned for the previous step.
         Returns
             array
                 resulting array from selection
@@ -449,7 +508,58 @@ class Stream:
         if not variable:
             raise ValueError()
 
-        return self.read(variable, start, count, block_id, step_selection)
+        return self.read(variable, start, count, block_id, step_selection, output)
+
+    def read_many(self, variables, outputs=None):
+        """
+        Read several variables at once.
+        The reads are queued as deferred Gets and resolved together in a single
+        engine.perform_gets(), which lets the engine schedule all of them at once
+        instead of going through a synchronous read for each variable.
+
+        Parameters
+            variables
+                list of variable names or adios2.Variable objects. Selections
+                are set on the Variable objects before the call, as for read()
+
+            outputs
+                optional list of the same length with numpy arrays (or None) to
+                read into, e.g. the list returned for the previous step
+        Returns
+            list
+                resulting arrays in the order of variables, single value
+                strings are returned as str
+        """
+        if outputs is None:
+            outputs = [None] * len(variables)
+        elif len(outputs) != len(variables):
+            raise ValueError("Stream read_many(), outputs must have one entry per variable")
+
+        # check every variable and output before queuing any Get, so that an
+        # error does not leave deferred Gets pending in the engine
+        reads = []
+        for variable, output in zip(variables, outputs):
+            if isinstance(variable, str):
+                name = variable
+                variable = self._io.inquire_variable(name)
+                if not variable:
+                    raise ValueError(f"Stream read_many(), variable {name} not found")
+
+            if variable.type() == "string" and variable.single_value() is True:
+                reads.append((variable, None))
+            else:
+                reads.append((variable, self._read_output(variable, output)))
+
+        results = []
+        for variable, output in reads:
+            if output is None:
+                results.append(self._engine.get(variable))
+            else:
+                self._engine.get(variable, output, bindings.Mode.Deferred)
+                results.append(output)
+
+        self._engine.perform_gets()
+        return results
 
     def write_attribute(self, name, content, variable_name="", separator="/"):
         """
@@ -220,6 +220,11 @@ struct MinBlockInfo
     size_t *Count;
     MinMaxStruct MinMax;
     void *BufferP = NULL;
+    /* per sub-block min/max, only when the writer divided the block
+     * (BP5 StatsBlockSize), otherwise SubBlockCount is 0 */
+    size_t SubBlockCount = 0;
+    const size_t *SubBlockDiv = NULL; // divisions of the block in each dimension [Dims]
+    const void *SubBlockMinMax = NULL; // min/max pairs of the element type [SubBlockCount]
 };
 
 struct MinVarInfo
@@ -263,6 +268,35 @@ constexpr uint64_t DefaultBufferChunkSize = 128 * 1024 * 1024;
  *  4Mb */
 constexpr size_t DefaultMinDeferredSize = 4 * 1024 * 1024;
 
+/** default largest gap between the contiguous runs of a strided read
+ *  selection that is read through rather than skipped
+ *  64Kb */
+constexpr size_t DefaultStridedReadGapSize = 64 * 1024;
+
+/** default most memory kept for reuse by the pool of temporary read buffers
+ *  256Mb */
+constexpr size_t DefaultReadBufferPoolSize = 256 * 1024 * 1024;
+
+/** default most memory used to read the next step ahead in streaming mode
+ *  1Gb */
+constexpr size_t DefaultReadAheadBufferSize = 1024 * 1024 * 1024;
+
+/** default most data kept in the local cache of remote data
+ *  4Gb */
+constexpr size_t DefaultRemoteCacheSize = 4ULL * 1024 * 1024 * 1024;
+
+/** default largest span of the file read in one call for nearby blocks
+ *  16Mb */
+constexpr size_t DefaultReadCoalesceMaxSize = 16 * 1024 * 1024;
+
+/** default largest gap between nearby blocks that are read in one call
+ *  16Kb */
+constexpr size_t DefaultReadCoalesceGapSize = 16 * 1024;
+
+/** default number of elements per sub-block with its own min/max,
+ *  0 keeps one min/max per block */
+constexpr size_t DefaultStatsBlockSize = 0;
+
 /** default size for writing/reading files using POSIX/fstream/stdio write
  *  2Gb - 100Kb (tolerance)*/
 constexpr size_t DefaultMaxFileBatchSize = 2147381248;
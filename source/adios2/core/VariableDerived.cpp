@@ -21,6 +21,7 @@ VariableDerived::VariableDerived(const std::string &name, adios2::derived::Expre
 DerivedVarType VariableDerived::GetDerivedType() { return m_DerivedType; }
 
 std::vector<std::string> VariableDerived::VariableNameList() { return m_Expr.VariableNameList(); }
+bool VariableDerived::SelectionHalo(size_t &halo) { return m_Expr.SelectionHalo(halo); }
 void VariableDerived::UpdateExprDim(std::map<std::string, std::tuple<Dims, Dims, Dims>> NameToDims)
 {
     m_Expr.SetDims(NameToDims);
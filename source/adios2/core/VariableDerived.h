@@ -30,6 +30,7 @@ public:
 
     DerivedVarType GetDerivedType();
     std::vector<std::string> VariableNameList();
+    bool SelectionHalo(size_t &halo);
     void UpdateExprDim(std::map<std::string, std::tuple<Dims, Dims, Dims>> NameToDims);
 
     std::vector<std::tuple<void *, Dims, Dims>>
@@ -139,6 +139,9 @@ public:
     MACRO(StreamReader, Bool, bool, false)                                                         \
     MACRO(BurstBufferDrain, Bool, bool, true)                                                      \
     MACRO(BurstBufferPath, String, std::string, "")                                                \
+    MACRO(BurstBufferDrainThreads, UInt, unsigned int, 1)                                          \
+    MACRO(BurstBufferDrainBandwidth, SizeBytes, size_t, 0)                                         \
+    MACRO(BurstBufferVerbose, Int, int, 0)                                                         \
     MACRO(NodeLocal, Bool, bool, false)                                                            \
     MACRO(verbose, Int, int, 0)                                                                    \
     MACRO(NumAggregators, UInt, unsigned int, 0)                                                   \
@@ -154,13 +157,27 @@ public:
     MACRO(GrowthFactor, Float, float, DefaultBufferGrowthFactor)                                   \
     MACRO(InitialBufferSize, SizeBytes, size_t, DefaultInitialBufferSize)                          \
     MACRO(MinDeferredSize, SizeBytes, size_t, DefaultMinDeferredSize)                              \
+    MACRO(StridedReadGapSize, SizeBytes, size_t, DefaultStridedReadGapSize)                        \
+    MACRO(ReadBufferPoolSize, SizeBytes, size_t, DefaultReadBufferPoolSize)                        \
+    MACRO(ReadAhead, Bool, bool, false)                                                            \
+    MACRO(ReadAheadBufferSize, SizeBytes, size_t, DefaultReadAheadBufferSize)                      \
+    MACRO(ReadCoalesceMaxSize, SizeBytes, size_t, DefaultReadCoalesceMaxSize)                      \
+    MACRO(ReadCoalesceGapSize, SizeBytes, size_t, DefaultReadCoalesceGapSize)                      \
     MACRO(BufferChunkSize, SizeBytes, size_t, DefaultBufferChunkSize)                              \
+    MACRO(BufferChunkPool, Bool, bool, false)                                                      \
+    MACRO(BufferChunkPrefault, Bool, bool, false)                                                  \
+    MACRO(BufferChunkHugePages, Bool, bool, false)                                                 \
     MACRO(MaxShmSize, SizeBytes, size_t, DefaultMaxShmSize)                                        \
     MACRO(BufferVType, BufferVType, int, (int)BufferVType::ChunkVType)                             \
     MACRO(AppendAfterSteps, Int, int, INT_MAX)                                                     \
     MACRO(SelectSteps, String, std::string, "")                                                    \
+    MACRO(MaxInstalledSteps, UInt, unsigned int, 0)                                                \
+    MACRO(NodeSharedMetadata, Bool, bool, false)                                                   \
     MACRO(ReaderShortCircuitReads, Bool, bool, false)                                              \
     MACRO(StatsLevel, UInt, unsigned int, 1)                                                       \
+    MACRO(StatsBlockSize, SizeBytes, size_t, DefaultStatsBlockSize)                                \
+    MACRO(QueryIndexBins, UInt, unsigned int, 0)                                                   \
+    MACRO(CompressionThreads, UInt, unsigned int, 0)                                               \
     MACRO(Threads, UInt, unsigned int, 0)                                                          \
     MACRO(UseOneTimeAttributes, Bool, bool, true)                                                  \
     MACRO(UseSelectiveMetadataAggregation, Bool, bool, true)                                       \
@@ -169,7 +186,13 @@ public:
     MACRO(IgnoreFlattenSteps, Bool, bool, false)                                                   \
     MACRO(RemoteDataPath, String, std::string, "")                                                 \
     MACRO(RemoteHost, String, std::string, "")                                                     \
-    MACRO(MaxOpenFilesAtOnce, UInt, unsigned int, UINT_MAX)
+    MACRO(RemoteCompression, String, std::string, "")                                              \
+    MACRO(RemoteCompressionAccuracy, String, std::string, "")                                      \
+    MACRO(RemoteCache, String, std::string, "")                                                    \
+    MACRO(RemoteCachePath, String, std::string, "")                                                \
+    MACRO(RemoteCacheSize, SizeBytes, size_t, DefaultRemoteCacheSize)                              \
+    MACRO(MaxOpenFilesAtOnce, UInt, unsigned int, UINT_MAX)                                        \
+    MACRO(ProfileTraceEvents, UInt, unsigned int, 0)
 
     struct BP5Params
     {
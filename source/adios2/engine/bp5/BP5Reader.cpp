@@ -10,16 +10,26 @@
 #include "BP5Reader.tcc"
 
 #include "adios2/helper/adiosMath.h" // SetWithinLimit
+#include "adios2/toolkit/kvcache/LocalKVCache.h"
+#ifdef ADIOS2_HAVE_KVCACHE
+#include "adios2/toolkit/kvcache/RedisKVCache.h"
+#endif
 #include "adios2/toolkit/remote/EVPathRemote.h"
 #include "adios2/toolkit/remote/XrootdRemote.h"
 #include "adios2/toolkit/transport/file/FileFStream.h"
 #include "adios2sys/SystemTools.hxx"
 #include <adios2-perfstubs-interface.h>
 
+#include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <cstdio>
+#include <cstring>
 #include <errno.h>
+#include <functional>
+#include <future>
 #include <iostream>
+#include <memory>
 #include <mutex>
 #include <thread>
 
@@ -38,7 +48,7 @@ BP5Reader::BP5Reader(IO &io, const std::string &name, const Mode mode, helper::C
 : Engine("BP5Reader", io, name, mode, std::move(comm)), m_MDFileManager(io, m_Comm),
   m_DataFileManager(io, m_Comm), m_MDIndexFileManager(io, m_Comm),
   m_FileMetaMetadataManager(io, m_Comm), m_ActiveFlagFileManager(io, m_Comm), m_Remote(),
-  m_JSONProfiler(m_Comm)
+  m_JSONProfiler(m_Comm), m_ReadBufferPool(0)
 {
     PERFSTUBS_SCOPED_TIMER("BP5Reader::Open");
     Init();
@@ -50,7 +60,7 @@ BP5Reader::BP5Reader(IO &io, const std::string &name, const Mode mode, helper::C
 : Engine("BP5Reader", io, name, mode, std::move(comm)), m_MDFileManager(io, m_Comm),
   m_DataFileManager(io, m_Comm), m_MDIndexFileManager(io, m_Comm),
   m_FileMetaMetadataManager(io, m_Comm), m_ActiveFlagFileManager(io, m_Comm), m_Remote(),
-  m_JSONProfiler(m_Comm)
+  m_JSONProfiler(m_Comm), m_ReadBufferPool(0)
 {
     PERFSTUBS_SCOPED_TIMER("BP5Reader::Open");
     m_ReadMetadataFromFile = false;
@@ -61,6 +71,7 @@ BP5Reader::BP5Reader(IO &io, const std::string &name, const Mode mode, helper::C
 
 BP5Reader::~BP5Reader()
 {
+    DiscardReadAhead();
     if (m_BP5Deserializer)
         delete m_BP5Deserializer;
     if (m_IsOpen)
@@ -79,7 +90,7 @@ void BP5Reader::DestructorClose(bool Verbose) noexcept
 
 void BP5Reader::GetMetadata(char **md, size_t *size)
 {
-    uint64_t sizes[3] = {m_Metadata.Size(), m_MetaMetadata.m_Buffer.size(),
+    uint64_t sizes[3] = {MetadataSize(), m_MetaMetadata.m_Buffer.size(),
                          m_MetadataIndex.m_Buffer.size()};
 
     /* BP5 modifies the metadata block in memory during processing
@@ -116,6 +127,8 @@ void BP5Reader::ProcessMetadataFromMemory(const char *md)
     p = p + sizeof(uint64_t);
 
     std::string hint("when processing metadata from memory");
+    // every rank is given its own copy
+    m_NodeSharedMetadata = false;
 
     m_Metadata.Resize(size_md, hint);
     std::memcpy(m_Metadata.Data(), p, size_md);
@@ -149,6 +162,11 @@ void BP5Reader::ProcessMetadataFromMemory(const char *md)
         m_BP5Deserializer = new format::BP5Deserializer(m_WriterIsRowMajor, m_ReaderIsRowMajor,
                                                         (m_OpenMode == Mode::ReadRandomAccess));
         m_BP5Deserializer->m_Engine = this;
+        m_BP5Deserializer->m_AllowStridedReads = true;
+        m_BP5Deserializer->m_ReadBufferPool = &m_ReadBufferPool;
+        m_BP5Deserializer->m_Profiler = &m_JSONProfiler;
+        m_BP5Deserializer->m_MaxInstalledSteps = m_Parameters.MaxInstalledSteps;
+        m_BP5Deserializer->m_Threads = m_Threads;
     }
 
     if (m_StepsCount > stepsBefore)
@@ -167,34 +185,80 @@ void BP5Reader::ProcessMetadataFromMemory(const char *md)
     }
 }
 
+void BP5Reader::AllocateSharedMetadata(const size_t size)
+{
+    FreeSharedMetadata();
+    const std::string hint("allocating node-shared metadata in call to BP5Reader Open");
+    if (m_NodeComm.Rank() == 0)
+    {
+        m_MetadataWin = m_NodeComm.Win_allocate_shared(size, 1, &m_SharedMetadata, hint);
+    }
+    else
+    {
+        m_MetadataWin = m_NodeComm.Win_allocate_shared(0, 1, &m_SharedMetadata, hint);
+        size_t shmsize;
+        int disp_unit;
+        m_NodeComm.Win_shared_query(m_MetadataWin, 0, &shmsize, &disp_unit, &m_SharedMetadata,
+                                    hint);
+    }
+    m_SharedMetadataSize = size;
+}
+
+void BP5Reader::FreeSharedMetadata()
+{
+    m_MetadataWin.Free("freeing node-shared metadata in BP5Reader");
+    m_SharedMetadata = nullptr;
+    m_SharedMetadataSize = 0;
+}
+
+char *BP5Reader::MetadataData()
+{
+    return m_NodeSharedMetadata ? m_SharedMetadata : m_Metadata.Data();
+}
+
+size_t BP5Reader::MetadataSize() const
+{
+    return m_NodeSharedMetadata ? m_SharedMetadataSize : m_Metadata.Size();
+}
+
 void BP5Reader::InstallMetadataForTimestep(size_t Step)
 {
     size_t pgstart = m_MetadataIndexTable[Step][0];
     size_t Position = pgstart + sizeof(uint64_t); // skip total data size
     const uint64_t WriterCount = m_WriterMap[m_WriterMapIndex[Step]].WriterCount;
     size_t MDPosition = Position + 2 * sizeof(uint64_t) * WriterCount;
+    std::vector<std::pair<void *, size_t>> Blocks;
     for (size_t WriterRank = 0; WriterRank < WriterCount; WriterRank++)
     {
         // variable metadata for timestep
         size_t ThisMDSize =
-            helper::ReadValue<uint64_t>(m_Metadata.Data(), Position, m_Minifooter.IsLittleEndian);
-        char *ThisMD = m_Metadata.Data() + MDPosition;
-        if ((m_OpenMode == Mode::ReadRandomAccess) || (m_FlattenSteps))
+            helper::ReadValue<uint64_t>(MetadataData(), Position, m_Minifooter.IsLittleEndian);
+        char *ThisMD = MetadataData() + MDPosition;
+        Blocks.push_back(std::make_pair(ThisMD, ThisMDSize));
+        MDPosition += ThisMDSize;
+    }
+    if (!Blocks.empty())
+    {
+        if ((m_OpenMode == Mode::ReadRandomAccess) && !m_FlattenSteps)
         {
-            m_BP5Deserializer->InstallMetaData(ThisMD, ThisMDSize, WriterRank, Step);
+            // installed when a variable first needs the step
+            m_BP5Deserializer->ScanMetaData(Blocks, Step);
+        }
+        else if ((m_OpenMode == Mode::ReadRandomAccess) || (m_FlattenSteps))
+        {
+            m_BP5Deserializer->InstallMetaData(Blocks, Step);
         }
         else
         {
-            m_BP5Deserializer->InstallMetaData(ThisMD, ThisMDSize, WriterRank);
+            m_BP5Deserializer->InstallMetaData(Blocks);
         }
-        MDPosition += ThisMDSize;
     }
     for (size_t WriterRank = 0; WriterRank < WriterCount; WriterRank++)
     {
         // attribute metadata for timestep
         size_t ThisADSize =
-            helper::ReadValue<uint64_t>(m_Metadata.Data(), Position, m_Minifooter.IsLittleEndian);
-        char *ThisAD = m_Metadata.Data() + MDPosition;
+            helper::ReadValue<uint64_t>(MetadataData(), Position, m_Minifooter.IsLittleEndian);
+        char *ThisAD = MetadataData() + MDPosition;
         if (ThisADSize > 0)
             m_BP5Deserializer->InstallAttributeData(ThisAD, ThisADSize);
         MDPosition += ThisADSize;
@@ -304,6 +368,11 @@ void BP5Reader::EndStep()
     m_BetweenStepPairs = false;
     PERFSTUBS_SCOPED_TIMER("BP5Reader::EndStep");
     PerformGets();
+    if (m_Parameters.ReadAhead)
+    {
+        DiscardReadAhead();
+        StartReadAhead();
+    }
     for (auto &item : MinBlocksInfoMap)
     {
         delete item.second;
@@ -311,21 +380,21 @@ void BP5Reader::EndStep()
     MinBlocksInfoMap.clear();
 }
 
-std::pair<double, double> BP5Reader::ReadData(adios2::transportman::TransportMan &FileManager,
-                                              const size_t maxOpenFiles, const size_t WriterRank,
-                                              const size_t Timestep, const size_t StartOffset,
-                                              const size_t Length, char *Destination)
+size_t BP5Reader::OpenDataFile(adios2::transportman::TransportMan &FileManager,
+                               const size_t maxOpenFiles, const size_t WriterRank,
+                               const size_t Timestep)
 {
-    /*
-     * Warning: this function is called by multiple threads
-     */
-    size_t FlushCount = m_MetadataIndexTable[Timestep][2];
-    size_t DataPosPos = m_MetadataIndexTable[Timestep][3];
     size_t SubfileNum =
         static_cast<size_t>(m_WriterMap[m_WriterMapIndex[Timestep]].RankToSubfile[WriterRank]);
+    OpenSubfile(FileManager, maxOpenFiles, SubfileNum, !m_WriterIsActive);
+    return SubfileNum;
+}
 
+void BP5Reader::OpenSubfile(adios2::transportman::TransportMan &FileManager,
+                            const size_t maxOpenFiles, const size_t SubfileNum,
+                            const bool FailOnEOF)
+{
     // check if subfile is already opened
-    TP startSubfile = NOW();
     if (FileManager.m_Transports.count(SubfileNum) == 0)
     {
         const std::string subFileName =
@@ -337,20 +406,24 @@ std::pair<double, double> BP5Reader::ReadData(adios2::transportman::TransportMan
         }
         FileManager.OpenFileID(subFileName, SubfileNum, Mode::Read, m_IO.m_TransportsParameters[0],
                                /*{{"transport", "File"}},*/ true);
-        if (!m_WriterIsActive)
+        if (FailOnEOF)
         {
             Params transportParameters;
             transportParameters["FailOnEOF"] = "true";
             FileManager.SetParameters(transportParameters, -1);
         }
     }
-    TP endSubfile = NOW();
-    double timeSubfile = DURATION(startSubfile, endSubfile);
+}
+
+size_t BP5Reader::DataFilePosition(const size_t WriterRank, const size_t Timestep,
+                                   const size_t StartOffset)
+{
+    size_t FlushCount = m_MetadataIndexTable[Timestep][2];
+    size_t DataPosPos = m_MetadataIndexTable[Timestep][3];
 
     /* Each block is in exactly one flush. The StartOffset was calculated
        as if all the flushes were in a single contiguous block in file.
     */
-    TP startRead = NOW();
     size_t InfoStartPos = DataPosPos + (WriterRank * (2 * FlushCount + 1) * sizeof(uint64_t));
     size_t SumDataSize = 0; // count in contiguous space
     for (size_t flush = 0; flush < FlushCount; flush++)
@@ -363,25 +436,274 @@ std::pair<double, double> BP5Reader::ReadData(adios2::transportman::TransportMan
         if (StartOffset < SumDataSize + ThisDataSize)
         {
             // discount offsets of skipped flushes
-            size_t Offset = StartOffset - SumDataSize;
-            FileManager.ReadFile(Destination, Length, ThisDataPos + Offset, SubfileNum);
-            TP endRead = NOW();
-            double timeRead = DURATION(startRead, endRead);
-            return std::make_pair(timeSubfile, timeRead);
+            return ThisDataPos + StartOffset - SumDataSize;
         }
         SumDataSize += ThisDataSize;
     }
 
     size_t ThisDataPos = helper::ReadValue<uint64_t>(m_MetadataIndex.m_Buffer, InfoStartPos,
                                                      m_Minifooter.IsLittleEndian);
-    size_t Offset = StartOffset - SumDataSize;
-    FileManager.ReadFile(Destination, Length, ThisDataPos + Offset, SubfileNum);
+    return ThisDataPos + StartOffset - SumDataSize;
+}
 
+std::pair<double, double> BP5Reader::ReadData(adios2::transportman::TransportMan &FileManager,
+                                              const size_t maxOpenFiles, const size_t WriterRank,
+                                              const size_t Timestep, const size_t StartOffset,
+                                              const size_t Length, char *Destination)
+{
+    /*
+     * Warning: this function is called by multiple threads
+     */
+    TP startSubfile = NOW();
+    const size_t SubfileNum = OpenDataFile(FileManager, maxOpenFiles, WriterRank, Timestep);
+    TP endSubfile = NOW();
+    double timeSubfile = DURATION(startSubfile, endSubfile);
+
+    TP startRead = NOW();
+    FileManager.ReadFile(Destination, Length, DataFilePosition(WriterRank, Timestep, StartOffset),
+                         SubfileNum);
     TP endRead = NOW();
     double timeRead = DURATION(startRead, endRead);
     return std::make_pair(timeSubfile, timeRead);
 }
 
+std::pair<double, double>
+BP5Reader::ReadStridedData(adios2::transportman::TransportMan &FileManager,
+                           const size_t maxOpenFiles,
+                           const format::BP5Deserializer::ReadRequest &Req,
+                           std::vector<format::BP5Deserializer::ReadRun> &Runs,
+                           std::vector<char> &Sink)
+{
+    /*
+     * Warning: this function is called by multiple threads
+     */
+    TP startSubfile = NOW();
+    const size_t SubfileNum = OpenDataFile(FileManager, maxOpenFiles, Req.WriterRank, Req.Timestep);
+    TP endSubfile = NOW();
+    double timeSubfile = DURATION(startSubfile, endSubfile);
+
+    TP startRead = NOW();
+    m_BP5Deserializer->StridedReadRuns(Req, Runs);
+    // all runs are in one block, so in one flush and contiguous in file
+    const size_t BlockFilePos = DataFilePosition(Req.WriterRank, Req.Timestep, Runs[0].Offset);
+
+    // gaps up to StridedReadGapSize are read into Sink rather than
+    // splitting the read, size Sink for the largest of them up front
+    const size_t MaxGap = m_Parameters.StridedReadGapSize;
+    size_t SinkSize = 0;
+    for (size_t r = 1; r < Runs.size(); r++)
+    {
+        const size_t Gap = Runs[r].Offset - (Runs[r - 1].Offset + Runs[r - 1].Length);
+        if ((Gap <= MaxGap) && (Gap > SinkSize))
+        {
+            SinkSize = Gap;
+        }
+    }
+    if (Sink.size() < SinkSize)
+    {
+        Sink.resize(SinkSize);
+    }
+
+    std::vector<core::iovec> iov;
+    size_t r = 0;
+    while (r < Runs.size())
+    {
+        const size_t SegmentStart = Runs[r].Offset;
+        size_t SegmentEnd = SegmentStart;
+        iov.clear();
+        for (; r < Runs.size(); r++)
+        {
+            const size_t Gap = Runs[r].Offset - SegmentEnd;
+            if (Gap > MaxGap)
+            {
+                break;
+            }
+            if (Gap > 0)
+            {
+                iov.push_back({Sink.data(), Gap});
+            }
+            iov.push_back({Req.DestinationAddr + Runs[r].DestOffset, Runs[r].Length});
+            SegmentEnd = Runs[r].Offset + Runs[r].Length;
+        }
+        FileManager.ReadFile(iov.data(), iov.size(), BlockFilePos + (SegmentStart - Runs[0].Offset),
+                             SubfileNum);
+    }
+    TP endRead = NOW();
+    double timeRead = DURATION(startRead, endRead);
+    return std::make_pair(timeSubfile, timeRead);
+}
+
+void BP5Reader::RecordReadAheadPattern(
+    const std::vector<format::BP5Deserializer::ReadRequest> &ReadRequests,
+    std::vector<format::BP5Deserializer::ReadRun> &Runs)
+{
+    for (const auto &Req : ReadRequests)
+    {
+        size_t Start = Req.StartOffset;
+        size_t End = Req.StartOffset + Req.ReadLength;
+        if (Req.Strided)
+        {
+            m_BP5Deserializer->StridedReadRuns(Req, Runs);
+            Start = Runs.front().Offset;
+            End = Runs.back().Offset + Runs.back().Length;
+        }
+        ReadAheadRange Range;
+        Range.WriterRank = Req.WriterRank;
+        Range.StartOffset = Start;
+        Range.Length = End - Start;
+        m_ReadAheadPattern.push_back(Range);
+    }
+}
+
+void BP5Reader::StartReadAhead()
+{
+    const size_t Step = m_CurrentStep + 1;
+    if (m_ReadAheadPattern.empty() || (Step >= m_StepsCount))
+    {
+        // nothing to replay, or the next step isn't known yet
+        m_ReadAheadPattern.clear();
+        return;
+    }
+
+    // merge overlapping and adjacent ranges of each writer
+    std::sort(m_ReadAheadPattern.begin(), m_ReadAheadPattern.end());
+    std::vector<ReadAheadRange> Merged;
+    for (const auto &Range : m_ReadAheadPattern)
+    {
+        if (!Merged.empty() && (Merged.back().WriterRank == Range.WriterRank) &&
+            (Range.StartOffset <= Merged.back().StartOffset + Merged.back().Length))
+        {
+            auto &Last = Merged.back();
+            Last.Length =
+                std::max(Last.StartOffset + Last.Length, Range.StartOffset + Range.Length) -
+                Last.StartOffset;
+        }
+        else
+        {
+            Merged.push_back(Range);
+        }
+    }
+    m_ReadAheadPattern.clear();
+
+    /* Everything the background thread needs from the metadata is looked
+     * up here, since BeginStep() may update it while the thread runs. */
+    const auto &WriterMap = m_WriterMap[m_WriterMapIndex[Step]];
+    size_t TotalSize = 0;
+    for (auto &Range : Merged)
+    {
+        if ((Range.WriterRank >= WriterMap.WriterCount) || (Range.Length == 0) ||
+            (TotalSize + Range.Length > m_Parameters.ReadAheadBufferSize))
+        {
+            continue;
+        }
+        Range.FilePos = DataFilePosition(Range.WriterRank, Step, Range.StartOffset);
+        if (DataFilePosition(Range.WriterRank, Step, Range.StartOffset + Range.Length - 1) !=
+            Range.FilePos + Range.Length - 1)
+        {
+            continue; // not contiguous in the file on this step
+        }
+        Range.SubfileNum = static_cast<size_t>(WriterMap.RankToSubfile[Range.WriterRank]);
+        Range.Buffer = m_ReadBufferPool.Get(Range.Length);
+        TotalSize += Range.Length;
+        m_ReadAhead.push_back(Range);
+    }
+    if (m_ReadAhead.empty())
+    {
+        return;
+    }
+    m_ReadAheadStep = Step;
+
+    const size_t maxOpenFiles =
+        helper::SetWithinLimit((size_t)m_Parameters.MaxOpenFilesAtOnce, (size_t)1, MaxSizeT);
+    const bool FailOnEOF = !m_WriterIsActive;
+    m_ReadAheadFuture = std::async(std::launch::async, [this, maxOpenFiles, FailOnEOF]() {
+        // fileManagers are only used by PerformLocalGets(), which waits for us
+        auto &FileManager = fileManagers[0];
+        for (auto &Range : m_ReadAhead)
+        {
+            try
+            {
+                OpenSubfile(FileManager, maxOpenFiles, Range.SubfileNum, FailOnEOF);
+                if (Range.FilePos + Range.Length <= FileManager.GetFileSize(Range.SubfileNum))
+                {
+                    FileManager.ReadFile(Range.Buffer, Range.Length, Range.FilePos,
+                                         Range.SubfileNum);
+                    Range.Ready = true;
+                }
+            }
+            catch (...)
+            {
+                // leave it to the step's own reads
+            }
+        }
+    });
+}
+
+bool BP5Reader::ServeFromReadAhead(format::BP5Deserializer::ReadRequest &Req,
+                                   std::vector<format::BP5Deserializer::ReadRun> &Runs)
+{
+    if (Req.Timestep != m_ReadAheadStep)
+    {
+        return false;
+    }
+    size_t Start = Req.StartOffset;
+    size_t End = Req.StartOffset + Req.ReadLength;
+    if (Req.Strided)
+    {
+        m_BP5Deserializer->StridedReadRuns(Req, Runs);
+        Start = Runs.front().Offset;
+        End = Runs.back().Offset + Runs.back().Length;
+    }
+    ReadAheadRange Key;
+    Key.WriterRank = Req.WriterRank;
+    Key.StartOffset = Start;
+    auto It = std::upper_bound(m_ReadAhead.begin(), m_ReadAhead.end(), Key);
+    if (It == m_ReadAhead.begin())
+    {
+        return false;
+    }
+    const ReadAheadRange &Range = *(--It);
+    if ((Range.WriterRank != Req.WriterRank) || !Range.Ready ||
+        (End > Range.StartOffset + Range.Length))
+    {
+        return false;
+    }
+
+    if (Req.Strided)
+    {
+        for (const auto &Run : Runs)
+        {
+            std::memcpy(Req.DestinationAddr + Run.DestOffset,
+                        Range.Buffer + (Run.Offset - Range.StartOffset), Run.Length);
+        }
+    }
+    else if (Req.DestinationAddr)
+    {
+        std::memcpy(Req.DestinationAddr, Range.Buffer + (Req.StartOffset - Range.StartOffset),
+                    Req.ReadLength);
+    }
+    else
+    {
+        // FinalizeGet() can work straight out of the read-ahead buffer
+        Req.DestinationAddr = Range.Buffer + (Req.StartOffset - Range.StartOffset);
+    }
+    return true;
+}
+
+void BP5Reader::DiscardReadAhead()
+{
+    if (m_ReadAheadFuture.valid())
+    {
+        m_ReadAheadFuture.get();
+    }
+    for (auto &Range : m_ReadAhead)
+    {
+        m_ReadBufferPool.Release(Range.Buffer);
+    }
+    m_ReadAhead.clear();
+    m_ReadAheadStep = MaxSizeT;
+}
+
 void BP5Reader::PerformGets()
 {
     // if dataIsRemote is true and m_Remote is not true, this is our first time through
@@ -418,19 +740,12 @@ void BP5Reader::PerformGets()
             m_Remote = std::unique_ptr<EVPathRemote>(new EVPathRemote(m_HostOptions));
             int localPort =
                 m_Remote->LaunchRemoteServerViaConnectionManager(m_Parameters.RemoteHost);
+            m_Remote->SetResponseCompression(m_Parameters.RemoteCompression,
+                                             m_Parameters.RemoteCompressionAccuracy);
             m_Remote->Open("localhost", localPort, RemoteName, m_OpenMode, RowMajorOrdering);
         }
 #endif
-#ifdef ADIOS2_HAVE_KVCACHE
-        if (getenv("useKVCache"))
-        {
-            m_KVCache.OpenConnection();
-            if (m_Fingerprint.empty())
-            {
-                m_KVCache.RemotePathHashMd5(RemoteName, m_Fingerprint);
-            }
-        }
-#endif
+        InitRemoteCache(RemoteName);
         if (m_Remote == nullptr)
         {
             helper::Throw<std::ios_base::failure>(
@@ -447,28 +762,98 @@ void BP5Reader::PerformGets()
         }
     }
 
-    if (m_Remote)
+    auto lf_ClearGetState = [&]() {
+        // clear pending requests inside deserializer
+        m_BP5Deserializer->ClearGetState();
+        if ((m_OpenMode == Mode::ReadRandomAccess) && m_Parameters.MaxInstalledSteps)
+        {
+            // the blocks may point into metadata released by ClearGetState()
+            for (auto &item : MinBlocksInfoMap)
+            {
+                delete item.second;
+            }
+            MinBlocksInfoMap.clear();
+        }
+    };
+
+    try
     {
-#ifdef ADIOS2_HAVE_KVCACHE
-        if (getenv("useKVCache"))
+        if (m_Remote)
         {
-            PerformRemoteGetsWithKVCache();
+            const size_t compressedGets = m_Remote->m_CompressedGets;
+            if (m_KVCache)
+            {
+                PerformRemoteGetsWithKVCache();
+            }
+            else
+            {
+                PerformRemoteGets();
+            }
+            m_JSONProfiler.AddEvents(profiling::EventID::RemoteCompressedGet,
+                                     m_Remote->m_CompressedGets - compressedGets);
         }
         else
         {
-            PerformRemoteGets();
+            PerformLocalGets();
         }
-#else
-        PerformRemoteGets();
-#endif
     }
-    else
+    catch (...)
     {
-        PerformLocalGets();
+        // do not leave the failed Gets pending for the next PerformGets()
+        lf_ClearGetState();
+        throw;
     }
+    lf_ClearGetState();
+}
 
-    // clear pending requests inside deserializer
-    m_BP5Deserializer->ClearGetState();
+void BP5Reader::InitRemoteCache(const std::string &RemoteName)
+{
+    std::string CacheType = helper::LowerCase(m_Parameters.RemoteCache);
+    bool FromEnv = false;
+    if (CacheType.empty() && getenv("useKVCache"))
+    {
+        // useKVCache=local selects the local cache, any other value Redis
+        CacheType = (std::string(getenv("useKVCache")) == "local") ? "local" : "redis";
+        FromEnv = true;
+    }
+
+    if (CacheType == "local")
+    {
+        std::string CachePath = m_Parameters.RemoteCachePath;
+        if (CachePath.empty())
+        {
+            const char *Home = getenv("HOME");
+            CachePath = Home ? std::string(Home) + PathSeparator + ".cache" + PathSeparator +
+                                   "adios2" + PathSeparator + "kvcache"
+                             : std::string(".adios2-kvcache");
+        }
+        m_KVCache.reset(new kvcache::LocalKVCache(CachePath, m_Parameters.RemoteCacheSize));
+    }
+#ifdef ADIOS2_HAVE_KVCACHE
+    else if (CacheType == "redis")
+    {
+        m_KVCache.reset(new kvcache::RedisKVCache());
+    }
+#endif
+    else if (!CacheType.empty() && !FromEnv)
+    {
+        helper::Throw<std::invalid_argument>("Engine", "BP5Reader", "InitRemoteCache",
+                                             "RemoteCache=" + m_Parameters.RemoteCache +
+                                                 " is not available, use local"
+#ifdef ADIOS2_HAVE_KVCACHE
+                                                 " or redis"
+#endif
+        );
+    }
+
+    if (m_KVCache)
+    {
+        m_KVCache->OpenConnection();
+        if (m_Fingerprint.empty())
+        {
+            m_KVCache->RemotePathHashMd5(RemoteName, m_Fingerprint);
+        }
+    }
 }
 
 void BP5Reader::PerformRemoteGetsWithKVCache()
@@ -535,14 +920,18 @@ void BP5Reader::PerformRemoteGetsWithKVCache()
         std::string targetKey = keyPrefix + targetBox.toString();
 
         // Exact Match: check if targetKey exists
-        if (m_KVCache.Exists(targetKey))
+        if (m_KVCache->Exists(targetKey))
         {
             ReqInfo.CacheKey = targetKey;
             ReqInfo.DirectCopy = true;
             ReqInfo.ReqSize = targetBox.size();
+            ReqInfo.ReqBox = targetBox;
             cachedRequestsInfo.push_back(ReqInfo);
 
-            std::cout << "Found " << targetKey << " in cache" << std::endl;
+            if (m_Parameters.verbose > 0)
+            {
+                std::cout << "Found " << targetKey << " in cache" << std::endl;
+            }
         }
         else
         {
@@ -555,7 +944,7 @@ void BP5Reader::PerformRemoteGetsWithKVCache()
             std::unordered_set<std::string> samePrefixKeys;
             std::vector<kvcache::QueryBox> regularBoxes;
             std::vector<kvcache::QueryBox> cachedBoxes;
-            m_KVCache.KeyPrefixExistence(keyPrefix, samePrefixKeys);
+            m_KVCache->KeyPrefixExistence(keyPrefix, samePrefixKeys);
 
             if (samePrefixKeys.size() > 0)
             {
@@ -567,9 +956,12 @@ void BP5Reader::PerformRemoteGetsWithKVCache()
                 regularBoxes.push_back(targetBox);
             }
 
-            std::cout << "Going to retrieve " << regularBoxes.size()
-                      << " boxes from remote server, and " << cachedBoxes.size()
-                      << " boxes from cache" << std::endl;
+            if (m_Parameters.verbose > 0)
+            {
+                std::cout << "Going to retrieve " << regularBoxes.size()
+                          << " boxes from remote server, and " << cachedBoxes.size()
+                          << " boxes from cache" << std::endl;
+            }
 
             // Get data from remote server
             for (auto &box : regularBoxes)
@@ -584,7 +976,7 @@ void BP5Reader::PerformRemoteGetsWithKVCache()
                 box.StartToVector(start);
                 box.CountToVector(count);
                 auto handle = m_Remote->Get(Req.VarName, Req.RelStep, Req.BlockID, count, start,
-                                            ReqInfo.Data);
+                                            ReqInfo.Data, ReqInfo.ReqSize * ReqInfo.TypeSize);
                 handles.push_back(handle);
                 remoteRequestsInfo.push_back(ReqInfo);
             }
@@ -603,7 +995,7 @@ void BP5Reader::PerformRemoteGetsWithKVCache()
     // Get data from cache server
     for (auto &ReqInfo : cachedRequestsInfo)
     {
-        m_KVCache.AppendCommandInBatch(ReqInfo.CacheKey.c_str(), 1, 0, nullptr);
+        m_KVCache->AppendCommandInBatch(ReqInfo.CacheKey.c_str(), 1, 0, nullptr);
     }
 
     for (auto &ReqInfo : cachedRequestsInfo)
@@ -611,19 +1003,43 @@ void BP5Reader::PerformRemoteGetsWithKVCache()
         auto &Req = GetRequests[ReqInfo.ReqSeq];
         if (ReqInfo.DirectCopy)
         {
-            m_KVCache.ExecuteBatch(ReqInfo.CacheKey.c_str(), 1, ReqInfo.ReqSize * ReqInfo.TypeSize,
-                                   Req.Data);
+            if (m_KVCache->ExecuteBatch(ReqInfo.CacheKey.c_str(), 1,
+                                       ReqInfo.ReqSize * ReqInfo.TypeSize, Req.Data))
+            {
+                continue;
+            }
         }
         else
         {
             void *data = malloc(ReqInfo.ReqBox.size() * ReqInfo.TypeSize);
-            m_KVCache.ExecuteBatch(ReqInfo.CacheKey.c_str(), 1,
-                                   ReqInfo.ReqBox.size() * ReqInfo.TypeSize, data);
-            helper::NdCopy(reinterpret_cast<char *>(data), ReqInfo.ReqBox.Start,
-                           ReqInfo.ReqBox.Count, true, false, reinterpret_cast<char *>(Req.Data),
-                           Req.Start, Req.Count, true, false, static_cast<int>(ReqInfo.TypeSize));
+            const bool cached = m_KVCache->ExecuteBatch(
+                ReqInfo.CacheKey.c_str(), 1, ReqInfo.ReqBox.size() * ReqInfo.TypeSize, data);
+            if (cached)
+            {
+                helper::NdCopy(reinterpret_cast<char *>(data), ReqInfo.ReqBox.Start,
+                               ReqInfo.ReqBox.Count, true, false,
+                               reinterpret_cast<char *>(Req.Data), Req.Start, Req.Count, true,
+                               false, static_cast<int>(ReqInfo.TypeSize));
+            }
             free(data);
+            if (cached)
+            {
+                continue;
+            }
         }
+
+        // the block was evicted since Exists() (e.g. by another process sharing
+        // the cache), fetch it from the remote server like an uncached box
+        ReqInfo.ReqSize = ReqInfo.ReqBox.size();
+        ReqInfo.Data = malloc(ReqInfo.ReqSize * ReqInfo.TypeSize);
+        std::vector<size_t> start;
+        std::vector<size_t> count;
+        ReqInfo.ReqBox.StartToVector(start);
+        ReqInfo.ReqBox.CountToVector(count);
+        auto handle = m_Remote->Get(Req.VarName, Req.RelStep, Req.BlockID, count, start,
+                                    ReqInfo.Data, ReqInfo.ReqSize * ReqInfo.TypeSize);
+        handles.push_back(handle);
+        remoteRequestsInfo.push_back(ReqInfo);
     }
 
     for (size_t handle_seq = 0; handle_seq < handles.size(); handle_seq++)
@@ -636,7 +1052,7 @@ void BP5Reader::PerformRemoteGetsWithKVCache()
                        ReqInfo.ReqBox.Count, true, false, reinterpret_cast<char *>(Req.Data),
                        Req.Start, Req.Count, true, false, static_cast<int>(ReqInfo.TypeSize));
 
-        m_KVCache.AppendCommandInBatch(ReqInfo.CacheKey.c_str(), 0,
+        m_KVCache->AppendCommandInBatch(ReqInfo.CacheKey.c_str(), 0,
                                        ReqInfo.ReqSize * ReqInfo.TypeSize, ReqInfo.Data);
         free(ReqInfo.Data);
     }
@@ -645,7 +1061,7 @@ void BP5Reader::PerformRemoteGetsWithKVCache()
     for (size_t handle_seq = 0; handle_seq < handles.size(); handle_seq++)
     {
         auto &ReqInfo = remoteRequestsInfo[handle_seq];
-        m_KVCache.ExecuteBatch(ReqInfo.CacheKey.c_str(), 0, 0, nullptr);
+        m_KVCache->ExecuteBatch(ReqInfo.CacheKey.c_str(), 0, 0, nullptr);
     }
 }
 
@@ -654,10 +1070,28 @@ void BP5Reader::PerformRemoteGets()
     // TP startGenerate = NOW();
     auto GetRequests = m_BP5Deserializer->PendingGetRequests;
     std::vector<Remote::GetHandle> handles;
+
+    // size of the destination, a whole block of a local array has no Count
+    auto lf_DestSize = [&](const format::BP5Deserializer::BP5ArrayRequest &Req) -> size_t {
+        const size_t elemSize = helper::GetDataTypeSize(m_IO.InquireVariableType(Req.VarName));
+        if (!Req.Count.empty() || (Req.BlockID == std::numeric_limits<std::size_t>::max()))
+        {
+            return helper::GetTotalSize(Req.Count, elemSize);
+        }
+        VariableBase *VB = m_BP5Deserializer->GetVariableBaseFromBP5VarRec(Req.VarRec);
+        std::unique_ptr<MinVarInfo> MVI(MinBlocksInfo(*VB, Req.RelStep));
+        if (!MVI || (MVI->Dims == 0) || (Req.BlockID >= MVI->BlocksInfo.size()))
+        {
+            return elemSize;
+        }
+        const size_t *count = MVI->BlocksInfo[Req.BlockID].Count;
+        return helper::GetTotalSize(Dims(count, count + MVI->Dims), elemSize);
+    };
+
     for (auto &Req : GetRequests)
     {
-        auto handle =
-            m_Remote->Get(Req.VarName, Req.RelStep, Req.BlockID, Req.Count, Req.Start, Req.Data);
+        auto handle = m_Remote->Get(Req.VarName, Req.RelStep, Req.BlockID, Req.Count, Req.Start,
+                                    Req.Data, lf_DestSize(Req));
         handles.push_back(handle);
     }
     for (auto &handle : handles)
@@ -668,13 +1102,6 @@ void BP5Reader::PerformRemoteGets()
 
 void BP5Reader::PerformLocalGets()
 {
-    auto lf_CompareReqSubfile =
-        [&](const adios2::format::BP5Deserializer::ReadRequest &r1,
-            const adios2::format::BP5Deserializer::ReadRequest &r2) -> bool {
-        return (m_WriterMap[m_WriterMapIndex[r1.Timestep]].RankToSubfile[r1.WriterRank] <
-                m_WriterMap[m_WriterMapIndex[r2.Timestep]].RankToSubfile[r2.WriterRank]);
-    };
-
     if (!m_InitialWriterActiveCheckDone)
     {
         CheckWriterActive();
@@ -682,82 +1109,306 @@ void BP5Reader::PerformLocalGets()
     }
     // TP start = NOW();
     PERFSTUBS_SCOPED_TIMER("BP5Reader::PerformGets");
-    m_JSONProfiler.Start("DataRead");
+    m_JSONProfiler.Start(profiling::TimerID::DataRead);
     size_t maxReadSize;
 
     // TP startGenerate = NOW();
     auto ReadRequests = m_BP5Deserializer->GenerateReadRequests(false, &maxReadSize);
+    if (m_Parameters.ReadAhead && (m_OpenMode == Mode::Read))
+    {
+        std::vector<format::BP5Deserializer::ReadRun> runs;
+        RecordReadAheadPattern(ReadRequests, runs);
+        if (m_ReadAheadFuture.valid())
+        {
+            m_ReadAheadFuture.get();
+        }
+        if (!m_ReadAhead.empty())
+        {
+            auto lf_Served = [&](format::BP5Deserializer::ReadRequest &Req) -> bool {
+                char *tmp = nullptr;
+                if (Req.Strided && !Req.DestinationAddr)
+                {
+                    tmp = Req.DestinationAddr = m_ReadBufferPool.Get(Req.ReadLength);
+                }
+                const bool served = ServeFromReadAhead(Req, runs);
+                if (served)
+                {
+                    m_BP5Deserializer->FinalizeGet(Req, false);
+                    m_JSONProfiler.AddEvents(profiling::EventID::ReadAheadHit);
+                }
+                if (tmp)
+                {
+                    m_ReadBufferPool.Release(tmp);
+                    Req.DestinationAddr = nullptr;
+                }
+                return served;
+            };
+            ReadRequests.erase(
+                std::remove_if(ReadRequests.begin(), ReadRequests.end(), lf_Served),
+                ReadRequests.end());
+        }
+    }
     size_t nRequest = ReadRequests.size();
     // TP endGenerate = NOW();
     // double generateTime = DURATION(startGenerate, endGenerate);
 
-    size_t nextRequest = 0;
-    std::mutex mutexReadRequests;
+    /* Coalescing: requests sorted by (subfile, file position) are put into
+     * read units, requests that are adjacent in the file or separated by
+     * at most ReadCoalesceGapSize bytes are read together in one I/O call
+     * as long as the unit spans at most ReadCoalesceMaxSize bytes.
+     * Unit u covers the requests [unitStart[u], unitStart[u+1]). */
+    std::vector<size_t> reqSubfile(nRequest);
+    std::vector<size_t> reqFilePos(nRequest);
+    {
+        std::vector<size_t> order(nRequest);
+        for (size_t i = 0; i < nRequest; ++i)
+        {
+            const auto &Req = ReadRequests[i];
+            order[i] = i;
+            reqSubfile[i] = static_cast<size_t>(
+                m_WriterMap[m_WriterMapIndex[Req.Timestep]].RankToSubfile[Req.WriterRank]);
+            reqFilePos[i] = DataFilePosition(Req.WriterRank, Req.Timestep, Req.StartOffset);
+        }
+        std::sort(order.begin(), order.end(), [&](const size_t a, const size_t b) {
+            return (reqSubfile[a] < reqSubfile[b]) ||
+                   ((reqSubfile[a] == reqSubfile[b]) && (reqFilePos[a] < reqFilePos[b]));
+        });
+        std::vector<format::BP5Deserializer::ReadRequest> sorted;
+        sorted.reserve(nRequest);
+        std::vector<size_t> sortedSubfile(nRequest);
+        std::vector<size_t> sortedFilePos(nRequest);
+        for (size_t i = 0; i < nRequest; ++i)
+        {
+            sorted.push_back(ReadRequests[order[i]]);
+            sortedSubfile[i] = reqSubfile[order[i]];
+            sortedFilePos[i] = reqFilePos[order[i]];
+        }
+        ReadRequests.swap(sorted);
+        reqSubfile.swap(sortedSubfile);
+        reqFilePos.swap(sortedFilePos);
+    }
+
+    std::vector<size_t> unitStart;
+    {
+        const size_t maxSize = m_Parameters.ReadCoalesceMaxSize;
+        const size_t maxGap = m_Parameters.ReadCoalesceGapSize;
+        size_t spanStart = 0;
+        size_t spanEnd = 0;
+        for (size_t i = 0; i < nRequest; ++i)
+        {
+            const auto &Req = ReadRequests[i];
+            const size_t pos = reqFilePos[i];
+            const bool merge = (i > 0) && !Req.Strided && !ReadRequests[i - 1].Strided &&
+                               (reqSubfile[i] == reqSubfile[i - 1]) && (pos >= spanEnd) &&
+                               (pos - spanEnd <= maxGap) &&
+                               (pos + Req.ReadLength - spanStart <= maxSize);
+            if (!merge)
+            {
+                unitStart.push_back(i);
+                spanStart = pos;
+            }
+            spanEnd = pos + Req.ReadLength;
+        }
+        unitStart.push_back(nRequest);
+    }
+    const size_t nUnits = unitStart.size() - 1;
+    // requests read in the I/O call of another one
+    m_JSONProfiler.AddEvents(profiling::EventID::ReadCoalesced, nRequest - nUnits);
+
+    /* read one unit and finalize its requests, returns the time spent on
+     * opening subfiles, reading and copying, and the bytes read */
+    auto lf_ReadUnit = [&](adios2::transportman::TransportMan &FileManager,
+                           const size_t maxOpenFiles, const size_t unit, char *buf,
+                           std::vector<format::BP5Deserializer::ReadRun> &runs,
+                           std::vector<char> &sink, std::vector<core::iovec> &iov)
+        -> std::tuple<double, double, double, size_t> {
+        // counted per thread, see profiling::Counters
+        m_JSONProfiler.Start(profiling::TimerID::ReadUnit);
+        const size_t first = unitStart[unit];
+        const size_t last = unitStart[unit + 1];
+        std::pair<double, double> t;
+        size_t nBytes = 0;
+        std::unique_ptr<char, std::function<void(char *)>> spanBuf(
+            nullptr, [this](char *b) { m_ReadBufferPool.Release(b); });
+        if (last - first == 1)
+        {
+            auto &Req = ReadRequests[first];
+            if (!Req.DestinationAddr)
+            {
+                Req.DestinationAddr = buf;
+            }
+            t = Req.Strided ? ReadStridedData(FileManager, maxOpenFiles, Req, runs, sink)
+                            : ReadData(FileManager, maxOpenFiles, Req.WriterRank, Req.Timestep,
+                                       Req.StartOffset, Req.ReadLength, Req.DestinationAddr);
+            nBytes = Req.ReadLength;
+        }
+        else
+        {
+            TP startSubfile = NOW();
+            OpenSubfile(FileManager, maxOpenFiles, reqSubfile[first], !m_WriterIsActive);
+            TP endSubfile = NOW();
+
+            TP startRead = NOW();
+            // gaps and requests without a destination go to a buffer for
+            // the whole span, the others are read in place
+            const size_t spanStart = reqFilePos[first];
+            bool needSpanBuf = false;
+            size_t pos = spanStart;
+            for (size_t r = first; r < last; ++r)
+            {
+                needSpanBuf |= (reqFilePos[r] > pos) || !ReadRequests[r].DestinationAddr;
+                pos = reqFilePos[r] + ReadRequests[r].ReadLength;
+            }
+            if (needSpanBuf)
+            {
+                spanBuf.reset(m_ReadBufferPool.Get(pos - spanStart));
+            }
+            iov.clear();
+            pos = spanStart;
+            for (size_t r = first; r < last; ++r)
+            {
+                auto &Req = ReadRequests[r];
+                if (reqFilePos[r] > pos)
+                {
+                    iov.push_back({spanBuf.get() + (pos - spanStart), reqFilePos[r] - pos});
+                }
+                if (!Req.DestinationAddr)
+                {
+                    Req.DestinationAddr = spanBuf.get() + (reqFilePos[r] - spanStart);
+                }
+                iov.push_back({Req.DestinationAddr, Req.ReadLength});
+                pos = reqFilePos[r] + Req.ReadLength;
+                nBytes += Req.ReadLength;
+            }
+            FileManager.ReadFile(iov.data(), iov.size(), spanStart, reqSubfile[first]);
+            TP endRead = NOW();
+            double timeSubfile = DURATION(startSubfile, endSubfile);
+            double timeRead = DURATION(startRead, endRead);
+            t = std::make_pair(timeSubfile, timeRead);
+        }
+
+        TP startCopy = NOW();
+        for (size_t r = first; r < last; ++r)
+        {
+            m_BP5Deserializer->FinalizeGet(ReadRequests[r], false);
+        }
+        TP endCopy = NOW();
+        double timeCopy = DURATION(startCopy, endCopy);
+        m_JSONProfiler.Stop(profiling::TimerID::ReadUnit);
+        return std::make_tuple(t.first, t.second, timeCopy, nBytes);
+    };
+
+    /* Work distribution for the threaded reads: units are sorted by
+     * subfile and each thread starts on its own share of whole subfiles.
+     * A thread that runs out of work takes units from the front of
+     * another share, preferring one whose next subfile it has open
+     * already.  Taking a unit is a single atomic increment. */
+    struct ThreadShare
+    {
+        std::atomic<size_t> Next;
+        size_t End;
+    };
+    std::vector<ThreadShare> shares;
 
-    auto lf_GetNextRequest = [&]() -> size_t {
-        std::lock_guard<std::mutex> lockGuard(mutexReadRequests);
-        size_t reqidx = MaxSizeT;
-        if (nextRequest < nRequest)
+    auto lf_GetNextUnit = [&](const size_t tid) -> size_t {
+        const size_t unit = shares[tid].Next.fetch_add(1, std::memory_order_relaxed);
+        if (unit < shares[tid].End)
         {
-            reqidx = nextRequest;
-            ++nextRequest;
+            return unit;
         }
-        if (reqidx <= nRequest)
+        auto &FileManager = fileManagers[tid];
+        while (true)
         {
-            m_JSONProfiler.AddBytes("dataread", ReadRequests[reqidx].ReadLength);
+            size_t victim = MaxSizeT;
+            size_t mostLeft = 0;
+            for (size_t v = 0; v < shares.size(); ++v)
+            {
+                const size_t next = shares[v].Next.load(std::memory_order_relaxed);
+                if (next >= shares[v].End)
+                {
+                    continue;
+                }
+                if (FileManager.m_Transports.count(reqSubfile[unitStart[next]]))
+                {
+                    victim = v;
+                    break;
+                }
+                if (shares[v].End - next > mostLeft)
+                {
+                    victim = v;
+                    mostLeft = shares[v].End - next;
+                }
+            }
+            if (victim == MaxSizeT)
+            {
+                return MaxSizeT;
+            }
+            const size_t stolen = shares[victim].Next.fetch_add(1, std::memory_order_relaxed);
+            if (stolen < shares[victim].End)
+            {
+                return stolen;
+            }
         }
-        return reqidx;
     };
 
-    auto lf_Reader = [&](const int FileManagerID,
-                         const size_t maxOpenFiles) -> std::tuple<double, double, double, size_t> {
+    auto lf_Reader = [&](const int FileManagerID, const size_t maxOpenFiles)
+        -> std::tuple<double, double, double, size_t, size_t> {
         double copyTotal = 0.0;
         double readTotal = 0.0;
         double subfileTotal = 0.0;
         size_t nReads = 0;
-        std::vector<char> buf(maxReadSize);
+        size_t nBytes = 0;
+        std::unique_ptr<char, std::function<void(char *)>> buf(
+            m_ReadBufferPool.Get(maxReadSize), [this](char *b) { m_ReadBufferPool.Release(b); });
+        std::vector<format::BP5Deserializer::ReadRun> runs;
+        std::vector<char> sink;
+        std::vector<core::iovec> iov;
 
         while (true)
         {
-            const auto reqidx = lf_GetNextRequest();
-            if (reqidx > nRequest)
+            const auto unit = lf_GetNextUnit(FileManagerID);
+            if (unit >= nUnits)
             {
                 break;
             }
-            auto &Req = ReadRequests[reqidx];
-            if (!Req.DestinationAddr)
-            {
-                Req.DestinationAddr = buf.data();
-            }
-            std::pair<double, double> t =
-                ReadData(fileManagers[FileManagerID], maxOpenFiles, Req.WriterRank, Req.Timestep,
-                         Req.StartOffset, Req.ReadLength, Req.DestinationAddr);
-
-            TP startCopy = NOW();
-            m_BP5Deserializer->FinalizeGet(Req, false);
-            TP endCopy = NOW();
-            subfileTotal += t.first;
-            readTotal += t.second;
-            copyTotal += DURATION(startCopy, endCopy);
+            auto t = lf_ReadUnit(fileManagers[FileManagerID], maxOpenFiles, unit, buf.get(), runs,
+                                 sink, iov);
+            subfileTotal += std::get<0>(t);
+            readTotal += std::get<1>(t);
+            copyTotal += std::get<2>(t);
             ++nReads;
+            nBytes += std::get<3>(t);
         }
-        return std::make_tuple(subfileTotal, readTotal, copyTotal, nReads);
+        return std::make_tuple(subfileTotal, readTotal, copyTotal, nReads, nBytes);
     };
 
     // TP startRead = NOW();
-    // double sortTime = 0.0;
-    if (m_Threads > 1 && nRequest > 1)
+    if (m_Threads > 1 && nUnits > 1)
     {
-        // TP startSort = NOW();
-        std::sort(ReadRequests.begin(), ReadRequests.end(), lf_CompareReqSubfile);
-        // TP endSort = NOW();
-        // sortTime = DURATION(startSort, endSort);
-        size_t nThreads = (m_Threads < nRequest ? m_Threads : nRequest);
+        size_t nThreads = (m_Threads < nUnits ? m_Threads : nUnits);
+
+        std::vector<ThreadShare> initShares(nThreads);
+        shares.swap(initShares);
+        size_t begin = 0;
+        for (size_t tid = 0; tid < nThreads; ++tid)
+        {
+            size_t end = std::max(begin, (tid + 1) * nUnits / nThreads);
+            // don't split a subfile between shares
+            while ((end > 0) && (end < nUnits) &&
+                   (reqSubfile[unitStart[end]] == reqSubfile[unitStart[end - 1]]))
+            {
+                ++end;
+            }
+            shares[tid].Next.store(begin);
+            shares[tid].End = end;
+            begin = end;
+        }
 
         size_t maxOpenFiles = helper::SetWithinLimit(
             (size_t)m_Parameters.MaxOpenFilesAtOnce / nThreads, (size_t)1, MaxSizeT);
 
-        std::vector<std::future<std::tuple<double, double, double, size_t>>> futures(nThreads - 1);
+        std::vector<std::future<std::tuple<double, double, double, size_t, size_t>>> futures(
+            nThreads - 1);
 
         // launch Threads-1 threads to process subsets of requests,
         // then main thread process the last subset
@@ -766,7 +1417,7 @@ void BP5Reader::PerformLocalGets()
             futures[tid] = std::async(std::launch::async, lf_Reader, (int)(tid + 1), maxOpenFiles);
         }
         // main thread runs last subset of reads
-        /*auto tMain = */ lf_Reader(0, maxOpenFiles);
+        auto tMain = lf_Reader(0, maxOpenFiles);
         /*{
             double tSubfile = std::get<0>(tMain);
             double tRead = std::get<1>(tMain);
@@ -777,33 +1428,33 @@ void BP5Reader::PerformLocalGets()
                       << "s, read = " << tRead << "s, copy = " << tCopy
                       << ", nReads = " << nReads << std::endl;
         }*/
+        size_t nBytes = std::get<4>(tMain);
 
         // wait for all async threads
         for (auto &f : futures)
         {
-            f.get();
+            nBytes += std::get<4>(f.get());
         }
+        m_JSONProfiler.AddBytes(profiling::BytesID::dataread, nBytes);
     }
     else
     {
         size_t maxOpenFiles =
             helper::SetWithinLimit((size_t)m_Parameters.MaxOpenFilesAtOnce, (size_t)1, MaxSizeT);
-        std::vector<char> buf(maxReadSize);
-        for (auto &Req : ReadRequests)
+        std::unique_ptr<char, std::function<void(char *)>> buf(
+            m_ReadBufferPool.Get(maxReadSize), [this](char *b) { m_ReadBufferPool.Release(b); });
+        std::vector<format::BP5Deserializer::ReadRun> runs;
+        std::vector<char> sink;
+        std::vector<core::iovec> iov;
+        for (size_t unit = 0; unit < nUnits; ++unit)
         {
-            if (!Req.DestinationAddr)
-            {
-                Req.DestinationAddr = buf.data();
-            }
-            m_JSONProfiler.AddBytes("dataread", Req.ReadLength);
-            ReadData(m_DataFileManager, maxOpenFiles, Req.WriterRank, Req.Timestep, Req.StartOffset,
-                     Req.ReadLength, Req.DestinationAddr);
-            m_BP5Deserializer->FinalizeGet(Req, false);
+            auto t = lf_ReadUnit(m_DataFileManager, maxOpenFiles, unit, buf.get(), runs, sink, iov);
+            m_JSONProfiler.AddBytes(profiling::BytesID::dataread, std::get<3>(t));
         }
     }
     m_BP5Deserializer->FinalizeDerivedGets(ReadRequests);
     m_BP5Deserializer->ClearGetState();
-    m_JSONProfiler.Stop("DataRead");
+    m_JSONProfiler.Stop(profiling::TimerID::DataRead);
     /*TP end = NOW();
     double t1 = DURATION(start, end);
     double t2 = DURATION(startRead, end);
@@ -827,6 +1478,7 @@ void BP5Reader::Init()
     m_IO.m_ReadStreaming = false;
     m_ReaderIsRowMajor = (m_IO.m_ArrayOrder == ArrayOrdering::RowMajor);
     InitParameters();
+    m_JSONProfiler.EnableTrace(m_Parameters.ProfileTraceEvents);
     InitTransports();
     if (!m_Parameters.SelectSteps.empty())
     {
@@ -872,10 +1524,34 @@ void BP5Reader::InitParameters()
         }
     }
 
+    m_ReadBufferPool.SetMaxRetainedBytes(m_Parameters.ReadBufferPoolSize);
+
+    /* The metadata is decoded by every rank into its own structures, the
+     * window only saves memory when the raw metadata is kept for reinstalling
+     * steps, i.e. in ReadRandomAccess mode with MaxInstalledSteps */
+    m_NodeSharedMetadata = m_Parameters.NodeSharedMetadata && (m_Comm.Size() > 1) &&
+                           (m_OpenMode == Mode::ReadRandomAccess) &&
+                           (m_Parameters.MaxInstalledSteps > 0);
+    if (m_Parameters.NodeSharedMetadata && !m_NodeSharedMetadata &&
+        (m_Parameters.verbose > 0) && (m_Comm.Rank() == 0))
+    {
+        std::cout << "BP5Reader: NodeSharedMetadata is ignored, it requires ReadRandomAccess "
+                     "mode with MaxInstalledSteps > 0 on more than one rank"
+                  << std::endl;
+    }
     m_Threads = m_Parameters.Threads;
+    if ((m_Threads == 0) || m_NodeSharedMetadata)
+    {
+        m_NodeComm = m_Comm.GroupByShm("creating per-node comm at BP5 Open(read)");
+    }
+    if (m_NodeSharedMetadata)
+    {
+        // the first rank of each node receives the metadata for the node
+        m_NodeLeaderComm = m_Comm.Split(m_NodeComm.Rank() == 0 ? 0 : 1, m_Comm.Rank(),
+                                        "creating node leaders comm at BP5 Open(read)");
+    }
     if (m_Threads == 0)
     {
-        helper::Comm m_NodeComm = m_Comm.GroupByShm("creating per-node comm at BP5 Open(read)");
         unsigned int NodeSize = static_cast<unsigned int>(m_NodeComm.Size());
         unsigned int NodeThreadSize = helper::NumHardwareThreadsPerNode();
         if (NodeThreadSize > 0)
@@ -1169,6 +1845,12 @@ void BP5Reader::UpdateBuffer(const TimePoint &timeoutInstant, const Seconds &pol
                 new format::BP5Deserializer(m_WriterIsRowMajor, m_ReaderIsRowMajor,
                                             (m_OpenMode != Mode::Read), (m_FlattenSteps));
             m_BP5Deserializer->m_Engine = this;
+            m_BP5Deserializer->m_AllowStridedReads = true;
+            m_BP5Deserializer->m_ReadBufferPool = &m_ReadBufferPool;
+            m_BP5Deserializer->m_Profiler = &m_JSONProfiler;
+            m_BP5Deserializer->m_MaxInstalledSteps = m_Parameters.MaxInstalledSteps;
+            m_BP5Deserializer->m_Threads = m_Threads;
+            m_BP5Deserializer->m_ReadOnlyMetadata = m_NodeSharedMetadata;
         }
     }
 
@@ -1176,10 +1858,21 @@ void BP5Reader::UpdateBuffer(const TimePoint &timeoutInstant, const Seconds &pol
     {
         m_Metadata.Reset(true, false);
         m_MetaMetadata.Reset(true, false);
+        // How much metadata do we need to read?
+        size_t fileFilteredSize = 0;
+        auto lf_ReadMetadata = [&](char *buffer) {
+            m_JSONProfiler.Start(profiling::TimerID::MetaDataRead);
+            size_t mempos = 0;
+            for (auto p : m_FilteredMetadataInfo)
+            {
+                m_JSONProfiler.AddBytes(profiling::BytesID::metadataread, p.second);
+                m_MDFileManager.ReadFile(buffer + mempos, p.second, p.first);
+                mempos += p.second;
+            }
+            m_JSONProfiler.Stop(profiling::TimerID::MetaDataRead);
+        };
         if (m_Comm.Rank() == 0)
         {
-            // How much metadata do we need to read?
-            size_t fileFilteredSize = 0;
             for (auto p : m_FilteredMetadataInfo)
             {
                 fileFilteredSize += p.second;
@@ -1201,18 +1894,14 @@ void BP5Reader::UpdateBuffer(const TimePoint &timeoutInstant, const Seconds &pol
 
             if (actualFileSize >= expectedMinFileSize)
             {
-                m_JSONProfiler.Start("MetaDataRead");
-                m_Metadata.Resize(fileFilteredSize, "allocating metadata buffer, "
-                                                    "in call to BP5Reader Open");
-                size_t mempos = 0;
-                for (auto p : m_FilteredMetadataInfo)
+                // with NodeSharedMetadata it is read into the window below
+                if (!m_NodeSharedMetadata)
                 {
-                    m_JSONProfiler.AddBytes("metadataread", p.second);
-                    m_MDFileManager.ReadFile(m_Metadata.Data() + mempos, p.second, p.first);
-                    mempos += p.second;
+                    m_Metadata.Resize(fileFilteredSize, "allocating metadata buffer, "
+                                                        "in call to BP5Reader Open");
+                    lf_ReadMetadata(m_Metadata.Data());
                 }
                 m_MDFileAlreadyReadSize = expectedMinFileSize;
-                m_JSONProfiler.Stop("MetaDataRead");
             }
             else
             {
@@ -1238,15 +1927,15 @@ void BP5Reader::UpdateBuffer(const TimePoint &timeoutInstant, const Seconds &pol
             if (metametadataFileSize > m_MetaMetaDataFileAlreadyReadSize)
             {
                 const size_t newMMDSize = metametadataFileSize - m_MetaMetaDataFileAlreadyReadSize;
-                m_JSONProfiler.Start("MetaMetaDataRead");
-                m_JSONProfiler.AddBytes("metametadataread", newMMDSize);
+                m_JSONProfiler.Start(profiling::TimerID::MetaMetaDataRead);
+                m_JSONProfiler.AddBytes(profiling::BytesID::metametadataread, newMMDSize);
                 m_MetaMetadata.Resize(metametadataFileSize, "(re)allocating meta-meta-data buffer, "
                                                             "in call to BP5Reader Open");
                 m_FileMetaMetadataManager.ReadFile(m_MetaMetadata.m_Buffer.data() +
                                                        m_MetaMetaDataFileAlreadyReadSize,
                                                    newMMDSize, m_MetaMetaDataFileAlreadyReadSize);
                 m_MetaMetaDataFileAlreadyReadSize += newMMDSize;
-                m_JSONProfiler.Stop("MetaMetaDataRead");
+                m_JSONProfiler.Stop(profiling::TimerID::MetaMetaDataRead);
             }
         }
 
@@ -1255,14 +1944,37 @@ void BP5Reader::UpdateBuffer(const TimePoint &timeoutInstant, const Seconds &pol
 
         InstallMetaMetaData(m_MetaMetadata);
 
-        size_t inputSize = m_Comm.BroadcastValue(m_Metadata.Size(), 0);
+        size_t inputSize = m_Comm.BroadcastValue(fileFilteredSize, 0);
 
-        if (m_Comm.Rank() != 0)
+        if (m_NodeSharedMetadata)
         {
-            m_Metadata.Resize(inputSize, "metadata broadcast");
+            // one copy per node: rank 0 reads into the window of its node,
+            // the first rank of every other node receives into its window
+            AllocateSharedMetadata(inputSize);
+            if (m_Comm.Rank() == 0)
+            {
+                lf_ReadMetadata(m_SharedMetadata);
+            }
+            if (m_NodeComm.Rank() == 0)
+            {
+                m_NodeLeaderComm.Bcast(m_SharedMetadata, inputSize, 0);
+            }
+            m_NodeComm.Barrier();
+            if (m_NodeComm.Rank() == 0)
+            {
+                m_JSONProfiler.AddEvents(profiling::EventID::MetadataCopy);
+            }
         }
+        else
+        {
+            if (m_Comm.Rank() != 0)
+            {
+                m_Metadata.Resize(inputSize, "metadata broadcast");
+            }
 
-        m_Comm.Bcast(m_Metadata.Data(), inputSize, 0);
+            m_Comm.Bcast(m_Metadata.Data(), inputSize, 0);
+            m_JSONProfiler.AddEvents(profiling::EventID::MetadataCopy);
+        }
 
         if ((m_OpenMode == Mode::ReadRandomAccess) || m_FlattenSteps)
         {
@@ -1633,7 +2345,21 @@ void BP5Reader::DoClose(const int transportIndex)
     {
         EndStep();
     }
+    DiscardReadAhead();
+    const auto PoolStats = m_ReadBufferPool.GetStats();
+    m_JSONProfiler.AddEvents(profiling::EventID::ReadBufferReuse, PoolStats.Hits);
     FlushProfiler();
+    if (m_Parameters.verbose > 0)
+    {
+        std::cout << "BP5Reader rank " << m_Comm.Rank() << " read buffers: " << PoolStats.Gets
+                  << " requested, " << PoolStats.Hits << " reused from pool, high water "
+                  << PoolStats.HighWaterBytes << " bytes" << std::endl;
+    }
+    m_ReadBufferPool.Trim();
+    if (m_KVCache)
+    {
+        m_KVCache->CloseConnection();
+    }
     m_DataFileManager.CloseFiles();
     m_MDFileManager.CloseFiles();
     m_MDIndexFileManager.CloseFiles();
@@ -1642,6 +2368,7 @@ void BP5Reader::DoClose(const int transportIndex)
     {
         fileManagers[i].CloseFiles();
     }
+    FreeSharedMetadata();
 }
 
 #if defined(_WIN32)
@@ -1685,27 +2412,44 @@ void BP5Reader::FlushProfiler()
 
     const std::vector<char> profilingJSON(m_JSONProfiler.AggregateProfilingJSON(LineJSON));
 
+    // Chrome trace / Perfetto JSON array with the traced events of all ranks
+    std::vector<char> traceJSON;
+    if (m_Parameters.ProfileTraceEvents > 0)
+    {
+        traceJSON =
+            m_JSONProfiler.AggregateProfilingJSON(m_JSONProfiler.GetRankTraceJSON() + ",\n");
+    }
+
     if (m_RankMPI == 0)
     {
-        std::string profileFileName;
-        transport::FileFStream profilingJSONStream(m_Comm);
         std::string bpBaseName = adios2sys::SystemTools::GetFilenameName(m_Name);
 
         auto PID = getpid();
         std::stringstream PIDstr;
         PIDstr << std::hex << PID;
         // write profile json in /tmp
-        profileFileName = "/tmp/" + bpBaseName + "_" + PIDstr.str() + "_profiling.json";
+        const std::string profileBaseName =
+            "/tmp/" + bpBaseName + "_" + PIDstr.str() + "_profiling";
 
-        try
+        auto lf_WriteProfile = [&](const std::string &profileFileName,
+                                   const std::vector<char> &json) {
+            transport::FileFStream profilingJSONStream(m_Comm);
+            try
+            {
+                (void)remove(profileFileName.c_str());
+                profilingJSONStream.Open(profileFileName, Mode::Write);
+                profilingJSONStream.Write(json.data(), json.size());
+                profilingJSONStream.Close();
+            }
+            catch (...)
+            { // do nothing
+            }
+        };
+
+        lf_WriteProfile(profileBaseName + ".json", profilingJSON);
+        if (!traceJSON.empty())
         {
-            (void)remove(profileFileName.c_str());
-            profilingJSONStream.Open(profileFileName, Mode::Write);
-            profilingJSONStream.Write(profilingJSON.data(), profilingJSON.size());
-            profilingJSONStream.Close();
-        }
-        catch (...)
-        { // do nothing
+            lf_WriteProfile(profileBaseName + "_trace.json", traceJSON);
         }
     }
 }
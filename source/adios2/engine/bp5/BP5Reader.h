@@ -22,6 +22,7 @@
 #include "adios2/toolkit/transportman/TransportMan.h"
 
 #include <chrono>
+#include <future>
 #include <map>
 #include <vector>
 
@@ -105,9 +106,46 @@ private:
     std::unique_ptr<Remote> m_Remote;
     bool m_WriterIsActive = true;
     adios2::profiling::JSONProfiler m_JSONProfiler;
-
-    /* KVCache for remote data */
-    kvcache::KVCacheCommon m_KVCache;
+    /* temporary read buffers, reused across PerformGets() and steps */
+    format::BP5ReadBufferPool m_ReadBufferPool;
+
+    /* Read-ahead in streaming mode (ReadAhead parameter): the file ranges
+     * read in a step are read again for the next step by a background
+     * thread after EndStep(), and requests of the next step that fall in
+     * them are served from memory.  Ranges are in the StartOffset space
+     * of ReadRequest, per writer. */
+    struct ReadAheadRange
+    {
+        size_t WriterRank = 0;
+        size_t StartOffset = 0;
+        size_t Length = 0;
+        size_t SubfileNum = 0;
+        size_t FilePos = 0;
+        char *Buffer = nullptr;
+        bool Ready = false;
+        bool operator<(const ReadAheadRange &Other) const
+        {
+            if (WriterRank != Other.WriterRank)
+            {
+                return WriterRank < Other.WriterRank;
+            }
+            return StartOffset < Other.StartOffset;
+        }
+    };
+    std::vector<ReadAheadRange> m_ReadAheadPattern; // read in the current step
+    std::vector<ReadAheadRange> m_ReadAhead;        // for step m_ReadAheadStep
+    size_t m_ReadAheadStep = MaxSizeT;
+    std::future<void> m_ReadAheadFuture;
+    void RecordReadAheadPattern(
+        const std::vector<format::BP5Deserializer::ReadRequest> &ReadRequests,
+        std::vector<format::BP5Deserializer::ReadRun> &Runs);
+    void StartReadAhead();
+    bool ServeFromReadAhead(format::BP5Deserializer::ReadRequest &Req,
+                            std::vector<format::BP5Deserializer::ReadRun> &Runs);
+    void DiscardReadAhead();
+
+    /* KVCache for remote data (RemoteCache parameter) */
+    std::unique_ptr<kvcache::KVCacheCommon> m_KVCache;
     std::unordered_map<std::string, MinVarInfo *> MinBlocksInfoMap;
 
     /* Fingerprint to verify local validity against remote data */
@@ -246,12 +284,39 @@ private:
     format::BufferSTL m_MetaMetadata;
     format::BufferMalloc m_Metadata;
 
+    /* NodeSharedMetadata: the metadata is received once per node into a
+     * shared memory window instead of m_Metadata of every rank, only in
+     * ReadRandomAccess mode with MaxInstalledSteps */
+    bool m_NodeSharedMetadata = false;
+    helper::Comm m_NodeLeaderComm;
+    helper::Comm::Win m_MetadataWin;
+    char *m_SharedMetadata = nullptr;
+    size_t m_SharedMetadataSize = 0;
+    /** collective over the node, frees the window of the previous metadata */
+    void AllocateSharedMetadata(const size_t size);
+    void FreeSharedMetadata();
+    char *MetadataData();
+    size_t MetadataSize() const;
+
     void InstallMetaMetaData(format::BufferSTL MetaMetadata);
     void InstallMetadataForTimestep(size_t Step);
     std::pair<double, double> ReadData(adios2::transportman::TransportMan &FileManager,
                                        const size_t maxOpenFiles, const size_t WriterRank,
                                        const size_t Timestep, const size_t StartOffset,
                                        const size_t Length, char *Destination);
+    /* read the contiguous runs of a Strided request into its
+     * DestinationAddr, small gaps between runs are read into Sink */
+    std::pair<double, double> ReadStridedData(adios2::transportman::TransportMan &FileManager,
+                                              const size_t maxOpenFiles,
+                                              const format::BP5Deserializer::ReadRequest &Req,
+                                              std::vector<format::BP5Deserializer::ReadRun> &Runs,
+                                              std::vector<char> &Sink);
+    size_t OpenDataFile(adios2::transportman::TransportMan &FileManager, const size_t maxOpenFiles,
+                        const size_t WriterRank, const size_t Timestep);
+    void OpenSubfile(adios2::transportman::TransportMan &FileManager, const size_t maxOpenFiles,
+                     const size_t SubfileNum, const bool FailOnEOF);
+    size_t DataFilePosition(const size_t WriterRank, const size_t Timestep,
+                            const size_t StartOffset);
 
     struct WriterMapStruct
     {
@@ -270,12 +335,14 @@ private:
 
     void PerformRemoteGets();
 
+    void InitRemoteCache(const std::string &RemoteName);
     void PerformRemoteGetsWithKVCache();
 
     void DestructorClose(bool Verbose) noexcept;
 
     /* Communicator connecting ranks on each Compute Node.
-       Only used to calculate the number of threads available for reading */
+       Used to calculate the number of threads available for reading and
+       to share the metadata on the node */
     helper::Comm m_NodeComm;
     helper::Comm singleComm;
     unsigned int m_Threads;
@@ -8,6 +8,8 @@
 
 #include "BP5Writer.h"
 #include "BP5Writer.tcc"
+#include "adios2/toolkit/burstbuffer/FileDrainerMultiThread.h"
+#include "adios2/toolkit/burstbuffer/FileDrainerSingleThread.h"
 #include "adios2/toolkit/format/bp5/BP5Helper.h"
 
 #include "adios2/common/ADIOSMacros.h"
@@ -17,6 +19,7 @@
 #include "adios2/helper/adiosMemory.h"    // NdCopy
 #include "adios2/toolkit/format/buffer/chunk/ChunkV.h"
 #include "adios2/toolkit/format/buffer/malloc/MallocV.h"
+#include "adios2/toolkit/query/BitmapIndex.h"
 #include "adios2/toolkit/transport/file/FileFStream.h"
 #include <adios2-perfstubs-interface.h>
 
@@ -94,10 +97,14 @@ StepStatus BP5Writer::BeginStep(StepMode mode, const float timeoutSeconds)
         TimePoint wait_start = Now();
         if (m_WriteFuture.valid())
         {
-            m_Profiler.Start("BS_WaitOnAsync");
+            m_Profiler.Start(profiling::TimerID::BS_WaitOnAsync);
             m_WriteFuture.get();
             m_Comm.Barrier();
             AsyncWriteDataCleanup();
+            if (m_DrainBB)
+            {
+                DrainData();
+            }
             Seconds wait = Now() - wait_start;
             if (m_Comm.Rank() == 0)
             {
@@ -110,7 +117,7 @@ StepStatus BP5Writer::BeginStep(StepMode mode, const float timeoutSeconds)
                               << std::endl;
                 }
             }
-            m_Profiler.Stop("BS_WaitOnAsync");
+            m_Profiler.Stop(profiling::TimerID::BS_WaitOnAsync);
         }
     }
 
@@ -124,7 +131,7 @@ StepStatus BP5Writer::BeginStep(StepMode mode, const float timeoutSeconds)
     {
         m_BP5Serializer.InitStep(new ChunkV("BP5Writer", false, m_BP5Serializer.m_BufferAlign,
                                             m_BP5Serializer.m_BufferBlockSize,
-                                            m_Parameters.BufferChunkSize));
+                                            m_Parameters.BufferChunkSize, m_ChunkPool));
     }
     m_ThisTimestepDataSize = 0;
 
@@ -138,9 +145,9 @@ size_t BP5Writer::CurrentStep() const { return m_WriterStep; }
 void BP5Writer::PerformPuts()
 {
     PERFSTUBS_SCOPED_TIMER("BP5Writer::PerformPuts");
-    m_Profiler.Start("PP");
+    m_Profiler.Start(profiling::TimerID::PP);
     m_BP5Serializer.PerformPuts(m_Parameters.AsyncWrite || m_Parameters.DirectIO);
-    m_Profiler.Stop("PP");
+    m_Profiler.Stop(profiling::TimerID::PP);
     return;
 }
 
@@ -153,6 +160,16 @@ void BP5Writer::WriteMetaMetadata(
         m_FileMetaMetadataManager.WriteFiles((char *)&b.MetaMetaInfoLen, sizeof(size_t));
         m_FileMetaMetadataManager.WriteFiles((char *)b.MetaMetaID, b.MetaMetaIDLen);
         m_FileMetaMetadataManager.WriteFiles((char *)b.MetaMetaInfo, b.MetaMetaInfoLen);
+        if (m_DrainBB)
+        {
+            for (const auto &name : m_DrainMetaMetadataFileNames)
+            {
+                m_FileDrainer->AddOperationWrite(name, sizeof(size_t), &b.MetaMetaIDLen);
+                m_FileDrainer->AddOperationWrite(name, sizeof(size_t), &b.MetaMetaInfoLen);
+                m_FileDrainer->AddOperationWrite(name, b.MetaMetaIDLen, b.MetaMetaID);
+                m_FileDrainer->AddOperationWrite(name, b.MetaMetaInfoLen, b.MetaMetaInfo);
+            }
+        }
     }
     m_FileMetaMetadataManager.FlushFiles();
 }
@@ -184,7 +201,7 @@ uint64_t BP5Writer::WriteMetadata(const std::vector<core::iovec> &MetaDataBlocks
     m_FileMetadataManager.WriteFiles((char *)AttrSizeVector.data(),
                                      sizeof(uint64_t) * AttrSizeVector.size());
     MetaDataSize += sizeof(uint64_t) * AttrSizeVector.size();
-    m_Profiler.Start("MetadataBlockWrite");
+    m_Profiler.Start(profiling::TimerID::MetadataBlockWrite);
     for (auto &b : MetaDataBlocks)
     {
         if (!b.iov_base)
@@ -192,7 +209,7 @@ uint64_t BP5Writer::WriteMetadata(const std::vector<core::iovec> &MetaDataBlocks
         m_FileMetadataManager.WriteFiles((char *)b.iov_base, b.iov_len);
         MetaDataSize += b.iov_len;
     }
-    m_Profiler.Stop("MetadataBlockWrite");
+    m_Profiler.Stop(profiling::TimerID::MetadataBlockWrite);
 
     for (auto &b : AttributeBlocks)
     {
@@ -204,6 +221,15 @@ uint64_t BP5Writer::WriteMetadata(const std::vector<core::iovec> &MetaDataBlocks
 
     m_FileMetadataManager.FlushFiles();
 
+    if (m_DrainBB)
+    {
+        for (size_t i = 0; i < m_MetadataFileNames.size(); ++i)
+        {
+            m_FileDrainer->AddOperationCopyAt(m_MetadataFileNames[i], m_DrainMetadataFileNames[i],
+                                              m_MetaDataPos, m_MetaDataPos, MetaDataSize);
+        }
+    }
+
     m_MetaDataPos += MetaDataSize;
     return MetaDataSize;
 }
@@ -240,9 +266,9 @@ uint64_t BP5Writer::WriteMetadata(const std::vector<char> &ContigMetaData,
     m_FileMetadataManager.WriteFiles((char *)AttrSizeVector.data(),
                                      sizeof(uint64_t) * AttrSizeVector.size());
     MetaDataSize += sizeof(uint64_t) * AttrSizeVector.size();
-    m_Profiler.Start("MetadataBlockWrite");
+    m_Profiler.Start(profiling::TimerID::MetadataBlockWrite);
     m_FileMetadataManager.WriteFiles(ContigMetaData.data(), ContigMetaData.size());
-    m_Profiler.Stop("MetadataBlockWrite");
+    m_Profiler.Stop(profiling::TimerID::MetadataBlockWrite);
     MetaDataSize += ContigMetaData.size();
 
     for (auto &b : AttributeBlocks)
@@ -255,6 +281,15 @@ uint64_t BP5Writer::WriteMetadata(const std::vector<char> &ContigMetaData,
 
     m_FileMetadataManager.FlushFiles();
 
+    if (m_DrainBB)
+    {
+        for (size_t i = 0; i < m_MetadataFileNames.size(); ++i)
+        {
+            m_FileDrainer->AddOperationCopyAt(m_MetadataFileNames[i], m_DrainMetadataFileNames[i],
+                                              m_MetaDataPos, m_MetaDataPos, MetaDataSize);
+        }
+    }
+
     m_MetaDataPos += MetaDataSize;
     return MetaDataSize;
 }
@@ -442,6 +477,18 @@ void BP5Writer::WriteMetadataFileIndex(uint64_t MetaDataPos, uint64_t MetaDataSi
     }
 
     m_FileMetadataIndexManager.WriteFiles((char *)buf.data(), buf.size());
+    if (m_DrainBB)
+    {
+        /* readers of the target must not see the step before its data, but
+         * the fence only orders the drain of this process; the data of
+         * other aggregators may still be in flight (see the BurstBufferPath
+         * documentation) */
+        m_FileDrainer->AddOperationFence();
+        for (const auto &name : m_DrainMetadataIndexFileNames)
+        {
+            m_FileDrainer->AddOperationWrite(name, buf.size(), buf.data());
+        }
+    }
 #ifdef DUMPDATALOCINFO
     std::cout << "Flush count is :" << FlushPosSizeInfo.size() << std::endl;
     std::cout << "Write Index positions = {" << std::endl;
@@ -565,7 +612,7 @@ void BP5Writer::ComputeDerivedVariables()
     auto const &m_VariablesDerived = m_IO.GetDerivedVariables();
     auto const &m_Variables = m_IO.GetVariables();
     // parse all derived variables
-    m_Profiler.Start("DeriveVars");
+    m_Profiler.Start(profiling::TimerID::DeriveVars);
     for (auto it = m_VariablesDerived.begin(); it != m_VariablesDerived.end(); it++)
     {
         // identify the variables used in the derived variable
@@ -616,7 +663,7 @@ void BP5Writer::ComputeDerivedVariables()
                 free(std::get<0>(derivedBlock));
         }
     }
-    m_Profiler.Stop("DeriveVars");
+    m_Profiler.Stop(profiling::TimerID::DeriveVars);
 }
 #endif
 
@@ -635,15 +682,15 @@ void BP5Writer::SelectiveAggregationMetadata(format::BP5Serializer::TimestepInfo
     size_t AlignedMetadataSize = (TSInfo.MetaEncodeBuffer->m_FixedSize + 7) & ~0x7;
     MetaEncodeSize.push_back(AlignedMetadataSize);
 
-    m_Profiler.Start("ES_aggregate_info");
+    m_Profiler.Start(profiling::TimerID::ES_aggregate_info);
     BP5Helper::BP5AggregateInformation(m_Comm, m_Profiler, UniqueMetaMetaBlocks, AttributeBlocks,
                                        MetaEncodeSize, m_WriterDataPos);
 
-    m_Profiler.Stop("ES_aggregate_info");
-    m_Profiler.Start("ES_gather_write_meta");
+    m_Profiler.Stop(profiling::TimerID::ES_aggregate_info);
+    m_Profiler.Start(profiling::TimerID::ES_gather_write_meta);
     if (m_Comm.Rank() == 0)
     {
-        m_Profiler.Start("ES_AGG1");
+        m_Profiler.Start(profiling::TimerID::ES_AGG1);
         size_t MetadataTotalSize =
             std::accumulate(MetaEncodeSize.begin(), MetaEncodeSize.end(), size_t(0));
         assert(m_WriterDataPos.size() == static_cast<size_t>(m_Comm.Size()));
@@ -659,8 +706,8 @@ void BP5Writer::SelectiveAggregationMetadata(format::BP5Serializer::TimestepInfo
         auto AlignedCounts = MetaEncodeSize;
         for (auto &C : AlignedCounts)
             C /= 8;
-        m_Profiler.Stop("ES_AGG1");
-        m_Profiler.Start("ES_GatherMetadataBlocks");
+        m_Profiler.Stop(profiling::TimerID::ES_AGG1);
+        m_Profiler.Start(profiling::TimerID::ES_GatherMetadataBlocks);
         if (m_Comm.Size() > m_Parameters.OneLevelGatherRanksLimit)
         {
             BP5Helper::GathervArraysTwoLevel(
@@ -674,11 +721,11 @@ void BP5Writer::SelectiveAggregationMetadata(format::BP5Serializer::TimestepInfo
                                  AlignedMetadataSize / 8, AlignedCounts.data(),
                                  AlignedCounts.size(), (uint64_t *)ContigMetadata.data(), 0);
         }
-        m_Profiler.Stop("ES_GatherMetadataBlocks");
-        m_Profiler.Start("ES_write_metadata");
+        m_Profiler.Stop(profiling::TimerID::ES_GatherMetadataBlocks);
+        m_Profiler.Start(profiling::TimerID::ES_write_metadata);
         m_LatestMetaDataSize = WriteMetadata(ContigMetadata, MetaEncodeSize, AttributeBlocks);
 
-        m_Profiler.Stop("ES_write_metadata");
+        m_Profiler.Stop(profiling::TimerID::ES_write_metadata);
         for (auto &a : AttributeBlocks)
             free((void *)a.iov_base);
         if (!m_Parameters.AsyncWrite)
@@ -702,7 +749,7 @@ void BP5Writer::SelectiveAggregationMetadata(format::BP5Serializer::TimestepInfo
                                  MetaEncodeSize.data(), MetaEncodeSize.size(), (char *)nullptr, 0);
         }
     }
-    m_Profiler.Stop("ES_gather_write_meta");
+    m_Profiler.Stop(profiling::TimerID::ES_gather_write_meta);
 }
 
 void BP5Writer::TwoLevelAggregationMetadata(format::BP5Serializer::TimestepInfo TSInfo)
@@ -710,7 +757,7 @@ void BP5Writer::TwoLevelAggregationMetadata(format::BP5Serializer::TimestepInfo
     /*
      * Two-step metadata aggregation
      */
-    m_Profiler.Start("ES_meta1");
+    m_Profiler.Start(profiling::TimerID::ES_meta1);
     std::vector<char> MetaBuffer;
     core::iovec m{TSInfo.MetaEncodeBuffer->Data(), TSInfo.MetaEncodeBuffer->m_FixedSize};
     core::iovec a{nullptr, 0};
@@ -723,7 +770,7 @@ void BP5Writer::TwoLevelAggregationMetadata(format::BP5Serializer::TimestepInfo
 
     if (m_AggregatorMetadata.m_Comm.Size() > 1)
     { // level 1
-        m_Profiler.Start("ES_meta1_gather");
+        m_Profiler.Start(profiling::TimerID::ES_meta1_gather);
         size_t LocalSize = MetaBuffer.size();
         std::vector<size_t> RecvCounts = m_AggregatorMetadata.m_Comm.GatherValues(LocalSize, 0);
         std::vector<char> RecvBuffer;
@@ -736,7 +783,7 @@ void BP5Writer::TwoLevelAggregationMetadata(format::BP5Serializer::TimestepInfo
         }
         m_AggregatorMetadata.m_Comm.GathervArrays(MetaBuffer.data(), LocalSize, RecvCounts.data(),
                                                   RecvCounts.size(), RecvBuffer.data(), 0);
-        m_Profiler.Stop("ES_meta1_gather");
+        m_Profiler.Stop(profiling::TimerID::ES_meta1_gather);
         if (m_AggregatorMetadata.m_Comm.Rank() == 0)
         {
             std::vector<format::BP5Base::MetaMetaInfoBlock> UniqueMetaMetaBlocks;
@@ -752,8 +799,8 @@ void BP5Writer::TwoLevelAggregationMetadata(format::BP5Serializer::TimestepInfo
                 UniqueMetaMetaBlocks, Metadata, AttributeBlocks, DataSizes, WriterDataPositions);
         }
     } // level 1
-    m_Profiler.Stop("ES_meta1");
-    m_Profiler.Start("ES_meta2");
+    m_Profiler.Stop(profiling::TimerID::ES_meta1);
+    m_Profiler.Start(profiling::TimerID::ES_meta2);
     // level 2
     if (m_AggregatorMetadata.m_Comm.Rank() == 0)
     {
@@ -763,7 +810,7 @@ void BP5Writer::TwoLevelAggregationMetadata(format::BP5Serializer::TimestepInfo
         size_t LocalSize = MetaBuffer.size();
         if (m_CommMetadataAggregators.Size() > 1)
         {
-            m_Profiler.Start("ES_meta2_gather");
+            m_Profiler.Start(profiling::TimerID::ES_meta2_gather);
             RecvCounts = m_CommMetadataAggregators.GatherValues(LocalSize, 0);
             if (m_CommMetadataAggregators.Rank() == 0)
             {
@@ -779,7 +826,7 @@ void BP5Writer::TwoLevelAggregationMetadata(format::BP5Serializer::TimestepInfo
             m_CommMetadataAggregators.GathervArrays(MetaBuffer.data(), LocalSize, RecvCounts.data(),
                                                     RecvCounts.size(), RecvBuffer.data(), 0);
             buf = &RecvBuffer;
-            m_Profiler.Stop("ES_meta2_gather");
+            m_Profiler.Stop(profiling::TimerID::ES_meta2_gather);
         }
         else
         {
@@ -799,16 +846,16 @@ void BP5Writer::TwoLevelAggregationMetadata(format::BP5Serializer::TimestepInfo
             assert(m_WriterDataPos.size() == static_cast<size_t>(m_Comm.Size()));
             WriteMetaMetadata(UniqueMetaMetaBlocks);
             m_LatestMetaDataPos = m_MetaDataPos;
-            m_Profiler.Start("ES_write_metadata");
+            m_Profiler.Start(profiling::TimerID::ES_write_metadata);
             m_LatestMetaDataSize = WriteMetadata(Metadata, AttributeBlocks);
-            m_Profiler.Stop("ES_write_metadata");
+            m_Profiler.Stop(profiling::TimerID::ES_write_metadata);
             if (!m_Parameters.AsyncWrite)
             {
                 WriteMetadataFileIndex(m_LatestMetaDataPos, m_LatestMetaDataSize);
             }
         }
     } // level 2
-    m_Profiler.Stop("ES_meta2");
+    m_Profiler.Stop(profiling::TimerID::ES_meta2);
 }
 
 void BP5Writer::EndStep()
@@ -818,9 +865,9 @@ void BP5Writer::EndStep()
 #endif
     m_BetweenStepPairs = false;
     PERFSTUBS_SCOPED_TIMER("BP5Writer::EndStep");
-    m_Profiler.Start("ES");
+    m_Profiler.Start(profiling::TimerID::ES);
 
-    m_Profiler.Start("ES_close");
+    m_Profiler.Start(profiling::TimerID::ES_close);
     MarshalAttributes();
 
     // true: advances step
@@ -831,9 +878,9 @@ void BP5Writer::EndStep()
      * AttributeEncodeBuffer and the data encode Vector */
 
     m_ThisTimestepDataSize += TSInfo.DataBuffer->Size();
-    m_Profiler.Stop("ES_close");
+    m_Profiler.Stop(profiling::TimerID::ES_close);
 
-    m_Profiler.Start("ES_AWD");
+    m_Profiler.Start(profiling::TimerID::ES_AWD);
     // TSInfo destructor would delete the DataBuffer so we need to save it
     // for async IO and let the writer free it up when not needed anymore
     m_AsyncWriteLock.lock();
@@ -843,8 +890,17 @@ void BP5Writer::EndStep()
     // WriteData will free TSInfo.DataBuffer
     WriteData(TSInfo.DataBuffer);
     TSInfo.DataBuffer = NULL;
+    if (m_DrainBB && !m_Parameters.AsyncWrite)
+    {
+        DrainData();
+    }
 
-    m_Profiler.Stop("ES_AWD");
+    if (m_ChunkPool)
+    {
+        m_ChunkPool->Trim();
+    }
+
+    m_Profiler.Stop(profiling::TimerID::ES_AWD);
 
     if (m_Parameters.UseSelectiveMetadataAggregation)
     {
@@ -872,7 +928,7 @@ void BP5Writer::EndStep()
     m_FileMetaMetadataManager.FlushFiles();
     m_FileDataManager.FlushFiles();
 
-    m_Profiler.Stop("ES");
+    m_Profiler.Stop(profiling::TimerID::ES);
     m_WriterStep++;
     m_EndStepEnd = Now();
     if (!m_RankMPI)
@@ -889,9 +945,11 @@ void BP5Writer::Init()
     m_BP5Serializer.m_Engine = this;
     m_RankMPI = m_Comm.Rank();
     InitParameters();
+    m_Profiler.EnableTrace(m_Parameters.ProfileTraceEvents);
     InitAggregator();
     InitTransports();
     InitBPBuffer();
+    m_DrainedDataPos = m_DataPos;
 }
 
 MinVarInfo *BP5Writer::WriterMinBlocksInfo(const core::VariableBase &Var)
@@ -904,6 +962,21 @@ void BP5Writer::InitParameters()
     ParseParams(m_IO, m_Parameters);
     m_WriteToBB = !(m_Parameters.BurstBufferPath.empty());
     m_DrainBB = m_WriteToBB && m_Parameters.BurstBufferDrain;
+    if (m_DrainBB)
+    {
+        if (m_Parameters.BurstBufferDrainThreads > 1)
+        {
+            auto drainer = new burstbuffer::FileDrainerMultiThread();
+            drainer->SetThreads(m_Parameters.BurstBufferDrainThreads);
+            drainer->SetBandwidth(static_cast<double>(m_Parameters.BurstBufferDrainBandwidth));
+            m_FileDrainer.reset(drainer);
+        }
+        else
+        {
+            m_FileDrainer.reset(new burstbuffer::FileDrainerSingleThread());
+        }
+        m_FileDrainer->SetVerbose(m_Parameters.BurstBufferVerbose, m_Comm.Rank());
+    }
 
     unsigned int nproc = (unsigned int)m_Comm.Size();
     m_Parameters.NumAggregators = helper::SetWithinLimit(m_Parameters.NumAggregators, 0U, nproc);
@@ -953,6 +1026,20 @@ void BP5Writer::InitParameters()
     }
 
     m_BP5Serializer.m_StatsLevel = m_Parameters.StatsLevel;
+    m_BP5Serializer.m_StatsBlockSize = m_Parameters.StatsBlockSize;
+    m_BP5Serializer.SetCompressionThreads(m_Parameters.CompressionThreads);
+
+    if (m_Parameters.BufferChunkPool &&
+        (m_Parameters.BufferVType == (int)BufferVType::ChunkVType))
+    {
+        // the size ChunkV asks for a regular chunk, see ChunkV::ChunkAlloc()
+        const size_t blockSize = m_BP5Serializer.m_BufferBlockSize;
+        const size_t chunkSize =
+            (m_Parameters.BufferChunkSize + blockSize - 1) / blockSize * blockSize;
+        m_ChunkPool = std::make_shared<format::ChunkPool>(
+            chunkSize, m_BP5Serializer.m_BufferAlign, m_Parameters.BufferChunkPrefault,
+            m_Parameters.BufferChunkHugePages);
+    }
 }
 
 uint64_t BP5Writer::CountStepsInMetadataIndex(format::BufferSTL &bufferSTL)
@@ -1263,20 +1350,20 @@ void BP5Writer::InitTransports()
     // /path/name.bp.dir/name.bp.rank
     m_SubStreamNames = GetBPSubStreamNames(transportsNames, m_Aggregator->m_SubStreamIndex);
 
-    if (m_IAmDraining)
+    if (m_DrainBB)
     {
-        // Only (master)aggregators will run draining processes
-        if (m_DrainBB)
+        // Only (master)aggregators drain data, rank 0 drains metadata
+        if (m_IAmDraining)
         {
             const std::vector<std::string> drainTransportNames =
                 m_FileDataManager.GetFilesBaseNames(m_Name, m_IO.m_TransportsParameters);
             m_DrainSubStreamNames =
                 GetBPSubStreamNames(drainTransportNames, m_Aggregator->m_SubStreamIndex);
-            /* start up BB thread */
-            //            m_FileDrainer.SetVerbose(
-            //				     m_Parameters.BurstBufferVerbose,
-            //				     m_Comm.Rank());
-            m_FileDrainer.Start();
+        }
+        if (m_IAmDraining || m_Comm.Rank() == 0)
+        {
+            /* start up BB thread(s) */
+            m_FileDrainer->Start();
         }
     }
 
@@ -1331,7 +1418,7 @@ void BP5Writer::InitTransports()
         {
             for (const auto &name : m_DrainSubStreamNames)
             {
-                m_FileDrainer.AddOperationOpen(name, m_OpenMode);
+                m_FileDrainer->AddOperationOpen(name, m_OpenMode);
             }
         }
     }
@@ -1357,15 +1444,20 @@ void BP5Writer::InitTransports()
             const std::vector<std::string> drainTransportNames =
                 m_FileDataManager.GetFilesBaseNames(m_Name, m_IO.m_TransportsParameters);
             m_DrainMetadataFileNames = GetBPMetadataFileNames(drainTransportNames);
+            m_DrainMetaMetadataFileNames = GetBPMetaMetadataFileNames(drainTransportNames);
             m_DrainMetadataIndexFileNames = GetBPMetadataIndexFileNames(drainTransportNames);
 
             for (const auto &name : m_DrainMetadataFileNames)
             {
-                m_FileDrainer.AddOperationOpen(name, m_OpenMode);
+                m_FileDrainer->AddOperationOpen(name, m_OpenMode);
+            }
+            for (const auto &name : m_DrainMetaMetadataFileNames)
+            {
+                m_FileDrainer->AddOperationOpen(name, m_OpenMode);
             }
             for (const auto &name : m_DrainMetadataIndexFileNames)
             {
-                m_FileDrainer.AddOperationOpen(name, m_OpenMode);
+                m_FileDrainer->AddOperationOpen(name, m_OpenMode);
             }
         }
     }
@@ -1504,10 +1596,30 @@ void BP5Writer::UpdateActiveFlag(const bool active)
     {
         for (size_t i = 0; i < m_MetadataIndexFileNames.size(); ++i)
         {
-            m_FileDrainer.AddOperationWriteAt(m_DrainMetadataIndexFileNames[i],
+            m_FileDrainer->AddOperationWriteAt(m_DrainMetadataIndexFileNames[i],
                                               m_ActiveFlagPosition, 1, &activeChar);
-            m_FileDrainer.AddOperationSeekEnd(m_DrainMetadataIndexFileNames[i]);
+            m_FileDrainer->AddOperationSeekEnd(m_DrainMetadataIndexFileNames[i]);
+        }
+    }
+}
+
+void BP5Writer::DrainData()
+{
+    /* all processes writing to the subfile finished writing this step
+     * before the draining process starts copying it */
+    if (m_IAmWritingData)
+    {
+        DataWritingComm->Barrier();
+    }
+    if (m_IAmDraining && m_DataPos > m_DrainedDataPos)
+    {
+        const size_t count = m_DataPos - m_DrainedDataPos;
+        for (size_t i = 0; i < m_SubStreamNames.size(); ++i)
+        {
+            m_FileDrainer->AddOperationCopyAt(m_SubStreamNames[i], m_DrainSubStreamNames[i],
+                                              m_DrainedDataPos, m_DrainedDataPos, count);
         }
+        m_DrainedDataPos = m_DataPos;
     }
 }
 
@@ -1675,7 +1787,8 @@ void BP5Writer::FlushData(const bool isFinal)
     {
         DataBuf = m_BP5Serializer.ReinitStepData(
             new ChunkV("BP5Writer", false, m_BP5Serializer.m_BufferAlign,
-                       m_BP5Serializer.m_BufferBlockSize, m_Parameters.BufferChunkSize),
+                       m_BP5Serializer.m_BufferBlockSize, m_Parameters.BufferChunkSize,
+                       m_ChunkPool),
             m_Parameters.AsyncWrite || m_Parameters.DirectIO);
     }
 
@@ -1710,9 +1823,9 @@ void BP5Writer::Flush(const int transportIndex) {}
 
 void BP5Writer::PerformDataWrite()
 {
-    m_Profiler.Start("PDW");
+    m_Profiler.Start(profiling::TimerID::PDW);
     FlushData(false);
-    m_Profiler.Stop("PDW");
+    m_Profiler.Stop(profiling::TimerID::PDW);
 }
 
 void BP5Writer::DestructorClose(bool Verbose) noexcept
@@ -1755,13 +1868,13 @@ void BP5Writer::DoClose(const int transportIndex)
     Seconds wait(0.0);
     if (m_WriteFuture.valid())
     {
-        m_Profiler.Start("DC_WaitOnAsync1");
+        m_Profiler.Start(profiling::TimerID::DC_WaitOnAsync1);
         m_AsyncWriteLock.lock();
         m_flagRush = true;
         m_AsyncWriteLock.unlock();
         m_WriteFuture.get();
         wait += Now() - wait_start;
-        m_Profiler.Stop("DC_WaitOnAsync1");
+        m_Profiler.Stop(profiling::TimerID::DC_WaitOnAsync1);
     }
 
     m_FileDataManager.CloseFiles(transportIndex);
@@ -1779,17 +1892,21 @@ void BP5Writer::DoClose(const int transportIndex)
     if (m_Parameters.AsyncWrite)
     {
         // wait until all process' writing thread completes
-        m_Profiler.Start("DC_WaitOnAsync2");
+        m_Profiler.Start(profiling::TimerID::DC_WaitOnAsync2);
         wait_start = Now();
         m_Comm.Barrier();
         AsyncWriteDataCleanup();
+        if (m_DrainBB)
+        {
+            DrainData();
+        }
         wait += Now() - wait_start;
         if (m_Comm.Rank() == 0 && m_Parameters.verbose > 0)
         {
             std::cout << "Close waited " << wait.count() << " seconds on async threads"
                       << std::endl;
         }
-        m_Profiler.Stop("DC_WaitOnAsync2");
+        m_Profiler.Stop(profiling::TimerID::DC_WaitOnAsync2);
     }
 
     if (m_Comm.Rank() == 0)
@@ -1803,7 +1920,26 @@ void BP5Writer::DoClose(const int transportIndex)
         m_FileMetadataIndexManager.CloseFiles();
     }
 
+    if (m_ChunkPool)
+    {
+        const auto PoolStats = m_ChunkPool->GetStats();
+        m_Profiler.AddEvents(profiling::EventID::BufferChunkReuse, PoolStats.Reuses);
+        if (m_Parameters.verbose > 0)
+        {
+            std::cout << "BP5Writer rank " << m_Comm.Rank() << " buffer chunks: " << PoolStats.Gets
+                      << " requested, " << PoolStats.Reuses << " reused, "
+                      << PoolStats.Allocations << " allocated, " << PoolStats.Frees
+                      << " trimmed, high water " << PoolStats.HighWater << " chunks" << std::endl;
+        }
+    }
+
     FlushProfiler();
+
+    if (m_DrainBB)
+    {
+        // threads terminate once the queued operations are done
+        m_FileDrainer->Finish();
+    }
 }
 
 void BP5Writer::FlushProfiler()
@@ -1837,43 +1973,48 @@ void BP5Writer::FlushProfiler()
 
     const std::vector<char> profilingJSON(m_Profiler.AggregateProfilingJSON(lineJSON));
 
+    // Chrome trace / Perfetto JSON array with the traced events of all ranks
+    std::vector<char> traceJSON;
+    if (m_Parameters.ProfileTraceEvents > 0)
+    {
+        traceJSON = m_Profiler.AggregateProfilingJSON(m_Profiler.GetRankTraceJSON() + ",\n");
+    }
+
     if (m_RankMPI == 0)
     {
         // std::cout << "write profiling file!" << std::endl;
-        std::string profileFileName;
-        if (m_DrainBB)
+        // auto bpBaseNames =
+        // m_BP4Serializer.GetBPBaseNames({m_BBName});
+        std::vector<std::string> bpBaseNames = {m_Name};
+        std::string profileBaseName;
+        if (fileTransportIdx > -1)
         {
-            // auto bpTargetNames =
-            // m_BP4Serializer.GetBPBaseNames({m_Name});
-            std::vector<std::string> bpTargetNames = {m_Name};
-            if (fileTransportIdx > -1)
-            {
-                profileFileName = bpTargetNames[fileTransportIdx] + "/profiling.json";
-            }
-            else
-            {
-                profileFileName = bpTargetNames[0] + "_profiling.json";
-            }
-            m_FileDrainer.AddOperationWrite(profileFileName, profilingJSON.size(),
-                                            profilingJSON.data());
+            profileBaseName = bpBaseNames[fileTransportIdx] + "/profiling";
         }
         else
         {
-            transport::FileFStream profilingJSONStream(m_Comm);
-            // auto bpBaseNames =
-            // m_BP4Serializer.GetBPBaseNames({m_BBName});
-            std::vector<std::string> bpBaseNames = {m_Name};
-            if (fileTransportIdx > -1)
+            profileBaseName = bpBaseNames[0] + "_profiling";
+        }
+
+        auto lf_WriteProfile = [&](const std::string &profileFileName,
+                                   const std::vector<char> &json) {
+            if (m_DrainBB)
             {
-                profileFileName = bpBaseNames[fileTransportIdx] + "/profiling.json";
+                m_FileDrainer->AddOperationWrite(profileFileName, json.size(), json.data());
             }
             else
             {
-                profileFileName = bpBaseNames[0] + "_profiling.json";
+                transport::FileFStream profilingJSONStream(m_Comm);
+                profilingJSONStream.Open(profileFileName, Mode::Write);
+                profilingJSONStream.Write(json.data(), json.size());
+                profilingJSONStream.Close();
             }
-            profilingJSONStream.Open(profileFileName, Mode::Write);
-            profilingJSONStream.Write(profilingJSON.data(), profilingJSON.size());
-            profilingJSONStream.Close();
+        };
+
+        lf_WriteProfile(profileBaseName + ".json", profilingJSON);
+        if (!traceJSON.empty())
+        {
+            lf_WriteProfile(profileBaseName + "_trace.json", traceJSON);
         }
     }
 }
@@ -1929,9 +2070,12 @@ void BP5Writer::PutCommon(VariableBase &variable, const void *values, bool sync)
     if (!sync)
     {
         /* If arrays is small, force copying to internal buffer to aggregate
-         * small writes */
+         * small writes.  Blocks compressed by the worker threads are
+         * copied into the buffer anyway, keep them deferred. */
         size_t n = helper::GetTotalSize(variable.m_Count) * ObjSize;
-        if (n < m_Parameters.MinDeferredSize)
+        const bool threadCompressed =
+            (m_Parameters.CompressionThreads > 0) && !variable.m_Operations.empty();
+        if ((n < m_Parameters.MinDeferredSize) && !threadCompressed)
         {
             sync = true;
         }
@@ -1983,12 +2127,61 @@ void BP5Writer::PutCommon(VariableBase &variable, const void *values, bool sync)
     }
 }
 
+void BP5Writer::PutQueryIndex(VariableBase &variable, const void *values)
+{
+    if ((m_Parameters.QueryIndexBins == 0) || query::IsBitmapIndexName(variable.m_Name) ||
+        ((variable.m_ShapeID != ShapeID::GlobalArray) &&
+         (variable.m_ShapeID != ShapeID::LocalArray)))
+    {
+        return;
+    }
+
+    std::vector<uint8_t> index;
+    const bool indexable = (values != nullptr) && variable.m_MemoryCount.empty() &&
+                           (variable.GetMemorySpace(values) == MemorySpace::Host);
+    const size_t nElems = helper::GetTotalSize(variable.m_Count);
+    bool isIndexType = false;
+#define declare_type(T)                                                                            \
+    if (variable.m_Type == helper::GetDataType<T>())                                               \
+    {                                                                                              \
+        isIndexType = true;                                                                        \
+        if (indexable)                                                                             \
+            query::BuildBitmapIndex(static_cast<const T *>(values), nElems,                        \
+                                    m_Parameters.QueryIndexBins, index);                           \
+    }
+    ADIOS2_FOREACH_ATTRIBUTE_PRIMITIVE_STDTYPE_1ARG(declare_type)
+#undef declare_type
+    if (!isIndexType)
+    {
+        return;
+    }
+    if (!indexable)
+    {
+        // keep one index block per data block so that block IDs match
+        query::BuildEmptyBitmapIndex(index);
+    }
+
+    // the index of every block goes into the same local array, one block each
+    const std::string indexName = query::BitmapIndexName(variable.m_Name);
+    Variable<uint8_t> *indexVar = m_IO.InquireVariable<uint8_t>(indexName);
+    if (indexVar == nullptr)
+    {
+        indexVar = &m_IO.DefineVariable<uint8_t>(indexName, {}, {}, {index.size()});
+    }
+    else
+    {
+        indexVar->SetSelection({{}, {index.size()}});
+    }
+    PutCommon(*indexVar, index.data(), true);
+}
+
 #define declare_type(T)                                                                            \
     void BP5Writer::DoPut(Variable<T> &variable, typename Variable<T>::Span &span,                 \
                           const bool initialize, const T &value)                                   \
     {                                                                                              \
         PERFSTUBS_SCOPED_TIMER("BP5Writer::Put");                                                  \
         PutCommonSpan(variable, span, initialize, value);                                          \
+        PutQueryIndex(variable, nullptr);                                                          \
     }
 
 ADIOS2_FOREACH_PRIMITIVE_STDTYPE_1ARG(declare_type)
@@ -1998,10 +2191,12 @@ ADIOS2_FOREACH_PRIMITIVE_STDTYPE_1ARG(declare_type)
     void BP5Writer::DoPutSync(Variable<T> &variable, const T *data)                                \
     {                                                                                              \
         PutCommon(variable, data, true);                                                           \
+        PutQueryIndex(variable, data);                                                             \
     }                                                                                              \
     void BP5Writer::DoPutDeferred(Variable<T> &variable, const T *data)                            \
     {                                                                                              \
         PutCommon(variable, data, false);                                                          \
+        PutQueryIndex(variable, data);                                                             \
     }
 
 ADIOS2_FOREACH_STDTYPE_1ARG(declare_type)
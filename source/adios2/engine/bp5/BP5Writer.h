@@ -17,9 +17,10 @@
 #include "adios2/helper/adiosMemory.h" // PaddingToAlignOffset
 #include "adios2/toolkit/aggregator/mpi/MPIChain.h"
 #include "adios2/toolkit/aggregator/mpi/MPIShmChain.h"
-#include "adios2/toolkit/burstbuffer/FileDrainerSingleThread.h"
+#include "adios2/toolkit/burstbuffer/FileDrainer.h"
 #include "adios2/toolkit/format/bp5/BP5Serializer.h"
 #include "adios2/toolkit/format/buffer/BufferV.h"
+#include "adios2/toolkit/format/buffer/chunk/ChunkPool.h"
 #include "adios2/toolkit/shm/Spinlock.h"
 #include "adios2/toolkit/shm/TokenChain.h"
 #include "adios2/toolkit/transportman/TransportMan.h"
@@ -58,6 +59,9 @@ private:
     /** Single object controlling BP buffering */
     format::BP5Serializer m_BP5Serializer;
 
+    /** Chunks reused by the ChunkV buffers of all steps (BufferChunkPool) */
+    std::shared_ptr<format::ChunkPool> m_ChunkPool;
+
     /** Manage BP data files Transports from IO AddTransport */
     transportman::TransportMan m_FileDataManager;
 
@@ -78,8 +82,12 @@ private:
     bool m_WriteToBB = false;
     /** true if burst buffer is drained to disk  */
     bool m_DrainBB = true;
-    /** File drainer thread if burst buffer is used */
-    burstbuffer::FileDrainerSingleThread m_FileDrainer;
+    /** File drainer thread(s) if burst buffer is used, single or
+     * multi-threaded depending on BurstBufferDrainThreads */
+    std::unique_ptr<burstbuffer::FileDrainer> m_FileDrainer;
+    /** On draining processes, the data in the subfile up to this offset
+     * has been handed to the drainer */
+    uint64_t m_DrainedDataPos = 0;
     /** m_Name modified with burst buffer path if BB is used,
      * == m_Name otherwise.
      * m_Name is a constant of Engine and is the user provided target path
@@ -94,6 +102,7 @@ private:
     std::vector<std::string> m_MetadataFileNames;
     std::vector<std::string> m_DrainMetadataFileNames;
     std::vector<std::string> m_MetaMetadataFileNames;
+    std::vector<std::string> m_DrainMetaMetadataFileNames;
     std::vector<std::string> m_MetadataIndexFileNames;
     std::vector<std::string> m_DrainMetadataIndexFileNames;
     std::vector<std::string> m_ActiveFlagFileNames;
@@ -144,6 +153,10 @@ private:
 
     void PutCommon(VariableBase &variable, const void *data, bool sync);
 
+    /** Put the bitmap index block of the block just put (QueryIndexBins),
+     * values is nullptr for spans */
+    void PutQueryIndex(VariableBase &variable, const void *values);
+
 #define declare_type(T, L)                                                                         \
     T *DoBufferData_##L(const int bufferIdx, const size_t payloadPosition,                         \
                         const size_t bufferID = 0) noexcept final;
@@ -187,6 +200,11 @@ private:
 
     void UpdateActiveFlag(const bool active);
 
+    /** Hand the data written into the subfile since the last call to the
+     * drainer, once every process writing to the subfile is done with it.
+     * Collective over DataWritingComm */
+    void DrainData();
+
     void WriteCollectiveMetadataFile(const bool isFinal = false);
 
     void MarshalAttributes();
@@ -282,11 +282,12 @@ static bool isFileNewer(const std::string path, int64_t ctime)
     return (ctSec > ctimeSec);
 }
 
-void SaveToFile(sqlite3 *db, const std::string &path, const CampaignBPFile &bpfile)
+bool ReadFromDB(sqlite3 *db, const std::string &path, const CampaignBPFile &bpfile,
+                std::vector<char> &blob)
 {
     if (isFileNewer(path, bpfile.ctime))
     {
-        return;
+        return false;
     }
 
     int rc;
@@ -312,34 +313,51 @@ void SaveToFile(sqlite3 *db, const std::string &path, const CampaignBPFile &bpfi
     result = sqlite3_step(statement);
     if (result != SQLITE_ROW)
     {
+        sqlite3_finalize(statement);
         helper::Throw<std::invalid_argument>("Engine", "CampaignReader", "SaveToFIle",
                                              "Did not find record for :" + bpfile.name);
     }
 
     int iBlobsize = sqlite3_column_bytes(statement, 0);
-    const void *p = sqlite3_column_blob(statement, 0);
+    const char *p = static_cast<const char *>(sqlite3_column_blob(statement, 0));
 
     /*std::cout << "-- Retrieved from DB data of " << bpfile.name << " size = " << iBlobsize
               << " compressed = " << bpfile.compressed
               << " compressed size = " << bpfile.lengthCompressed
               << " original size = " << bpfile.lengthOriginal << " blob = " << p << "\n";*/
 
-    size_t blobsize = static_cast<size_t>(iBlobsize);
+    blob.assign(p, p + static_cast<size_t>(iBlobsize));
+    sqlite3_finalize(statement);
+    return true;
+}
+
+void SaveToFile(const std::string &path, const CampaignBPFile &bpfile,
+                const std::vector<char> &blob)
+{
     std::ofstream f;
     f.rdbuf()->pubsetbuf(0, 0);
     f.open(path, std::ios::out | std::ios::binary);
     if (bpfile.compressed)
     {
-        const unsigned char *ptr = static_cast<const unsigned char *>(p);
-        inflateToFile(ptr, blobsize, &f);
+        const unsigned char *ptr = reinterpret_cast<const unsigned char *>(blob.data());
+        inflateToFile(ptr, blob.size(), &f);
     }
     else
     {
-        f.write(static_cast<const char *>(p), blobsize);
+        f.write(blob.data(), blob.size());
     }
     f.close();
 }
 
+void SaveToFile(sqlite3 *db, const std::string &path, const CampaignBPFile &bpfile)
+{
+    std::vector<char> blob;
+    if (ReadFromDB(db, path, bpfile, blob))
+    {
+        SaveToFile(path, bpfile, blob);
+    }
+}
+
 } // end namespace engine
 } // end namespace core
 } // end namespace adios2
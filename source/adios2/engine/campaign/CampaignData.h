@@ -63,6 +63,14 @@ struct CampaignData
 
 void ReadCampaignData(sqlite3 *db, CampaignData &cd);
 
+/** the stored content of bpfile, false if the file at path is already newer */
+bool ReadFromDB(sqlite3 *db, const std::string &path, const CampaignBPFile &bpfile,
+                std::vector<char> &blob);
+
+/** write the content read by ReadFromDB to path, decompressed */
+void SaveToFile(const std::string &path, const CampaignBPFile &bpfile,
+                const std::vector<char> &blob);
+
 void SaveToFile(sqlite3 *db, const std::string &path, const CampaignBPFile &bpfile);
 
 } // end namespace engine
@@ -17,8 +17,12 @@
 #include <adios2-perfstubs-interface.h>
 #include <adios2sys/SystemTools.hxx>
 
+#include <algorithm>
+#include <cstdio>
 #include <fstream>
 #include <iostream>
+#include <iterator>
+#include <numeric>
 
 #include <nlohmann_json.hpp>
 
@@ -83,6 +87,25 @@ void CampaignReader::PerformGets()
     {
         std::cout << "Campaign Reader " << m_ReaderRank << "     PerformGets()\n";
     }
+
+    // open all datasets of the pending Gets at once
+    std::vector<size_t> idxs;
+    for (const auto &get : m_LazyGets)
+    {
+        idxs.push_back(get.first);
+    }
+    OpenDatasets(idxs);
+    for (const auto &get : m_LazyGets)
+    {
+        get.second();
+    }
+    m_LazyGets.clear();
+
+    for (const size_t idx : m_GetDatasets)
+    {
+        m_Engines[idx]->PerformGets();
+    }
+    m_GetDatasets.clear();
     m_NeedPerformGets = false;
 }
 
@@ -148,6 +171,20 @@ void CampaignReader::InitParameters()
         {
             m_Options.cachepath = pair.second;
         }
+        if (key == "openthreads")
+        {
+            int n = std::stoi(value);
+            if (n < 1)
+                helper::Throw<std::invalid_argument>("Engine", "CampaignReader", "InitParameters",
+                                                     "Method OpenThreads argument must be a "
+                                                     "positive integer, in call to "
+                                                     "Open or Engine constructor");
+            m_OpenThreads = static_cast<size_t>(n);
+        }
+        if (key == "lazyopen")
+        {
+            m_LazyOpen = (value == "yes" || value == "true" || value == "on");
+        }
     }
 
     if (m_Options.hostname.empty())
@@ -161,6 +198,8 @@ void CampaignReader::InitParameters()
         std::cout << "  Hostname = " << m_Options.hostname << std::endl;
         std::cout << "  Campaign Store Path = " << m_Options.campaignstorepath << std::endl;
         std::cout << "  Cache Path = " << m_Options.cachepath << std::endl;
+        std::cout << "  Lazy Open = " << (m_LazyOpen ? "true" : "false") << std::endl;
+        std::cout << "  Open Threads = " << m_OpenThreads << std::endl;
     }
 }
 
@@ -220,157 +259,442 @@ void CampaignReader::InitTransports()
     // nlohmann::json js = nlohmann::json::parse(cs);
     // std::cout << "JSON rank " << m_ReaderRank << ": " << js.size() <<
     // std::endl;
+    if (m_LazyOpen)
+    {
+        m_DatasetComm = m_Comm.Split(m_ReaderRank, 0, "CampaignReader datasets");
+    }
+    else
+    {
+        m_DatasetComm = m_Comm.Duplicate("CampaignReader datasets");
+    }
+    if (m_LazyOpen && (m_OpenThreads > 1))
+    {
+        m_OpenPool.reset(new helper::ThreadPool(m_OpenThreads));
+    }
+
     int i = 0;
     for (auto &it : m_CampaignData.bpdatasets)
     {
         CampaignBPDataset &ds = it.second;
         adios2::core::IO &io = m_IO.m_ADIOS.DeclareIO("CampaignReader" + std::to_string(i));
-        std::string localPath;
-        if (m_CampaignData.hosts[ds.hostIdx].hostname != m_Options.hostname)
+        DatasetInfo info;
+        info.ds = &ds;
+        info.catalogPath = m_Options.cachepath + PathSeparator +
+                           m_CampaignData.hosts[ds.hostIdx].hostname + PathSeparator + m_Name +
+                           PathSeparator + ds.name + PathSeparator + "catalog.json";
+        m_Datasets.push_back(std::move(info));
+        m_IOs.push_back(&io);
+        m_Engines.push_back(nullptr);
+        PrepareDataset(m_Datasets.size() - 1);
+        ++i;
+    }
+
+    if (!m_LazyOpen)
+    {
+        // every dataset is opened collectively, in the same order everywhere
+        std::vector<size_t> all(m_Datasets.size());
+        std::iota(all.begin(), all.end(), 0);
+        OpenDatasets(all);
+    }
+
+    // datasets without a valid catalog are opened to make one
+    std::vector<std::string> catalogs(m_Datasets.size());
+    std::vector<size_t> idxs;
+    for (size_t idx = 0; idx < m_Datasets.size(); ++idx)
+    {
+        catalogs[idx] = ReadCatalog(idx);
+        if (catalogs[idx].empty())
+        {
+            idxs.push_back(idx);
+        }
+    }
+    OpenDatasets(idxs);
+    for (const size_t idx : idxs)
+    {
+        catalogs[idx] = BuildCatalog(idx);
+        if (m_ReaderRank == 0)
+        {
+            WriteCatalog(idx, catalogs[idx]);
+        }
+    }
+    for (size_t idx = 0; idx < m_Datasets.size(); ++idx)
+    {
+        DefineCatalog(idx, catalogs[idx]);
+    }
+}
+
+void CampaignReader::PrepareDataset(const size_t idx)
+{
+    DatasetInfo &info = m_Datasets[idx];
+    const CampaignBPDataset &ds = *info.ds;
+    adios2::core::IO &io = *m_IOs[idx];
+    if (m_CampaignData.hosts[ds.hostIdx].hostname != m_Options.hostname)
+    {
+        bool done = false;
+        auto it = m_HostOptions.find(m_CampaignData.hosts[ds.hostIdx].hostname);
+        if (it != m_HostOptions.end())
         {
-            bool done = false;
-            auto it = m_HostOptions.find(m_CampaignData.hosts[ds.hostIdx].hostname);
-            if (it != m_HostOptions.end())
+            const HostConfig &ho = (it->second).front();
+            if (ho.protocol == HostAccessProtocol::S3)
             {
-                const HostConfig &ho = (it->second).front();
-                if (ho.protocol == HostAccessProtocol::S3)
-                {
-                    const std::string endpointURL = ho.endpoint;
-                    const std::string objPath = m_CampaignData.directory[ds.dirIdx] + "/" + ds.name;
-                    Params p;
-                    p.emplace("Library", "awssdk");
-                    p.emplace("endpoint", endpointURL);
-                    p.emplace("cache", m_Options.cachepath + PathSeparator +
-                                           m_CampaignData.hosts[ds.hostIdx].hostname +
-                                           PathSeparator + m_Name);
-                    p.emplace("verbose", std::to_string(ho.verbose));
-                    p.emplace("recheck_metadata", (ho.recheckMetadata ? "true" : "false"));
-                    io.AddTransport("File", p);
-                    io.SetEngine("BP5");
-                    localPath = m_CampaignData.directory[ds.dirIdx] + PathSeparator + ds.name;
-                    if (ho.isAWS_EC2)
-                    {
-                        adios2sys::SystemTools::PutEnv("AWS_EC2_METADATA_DISABLED=false");
-                    }
-                    else
-                    {
-                        adios2sys::SystemTools::PutEnv("AWS_EC2_METADATA_DISABLED=true");
-                    }
-
-                    if (ho.awsProfile.empty())
-                    {
-                        adios2sys::SystemTools::PutEnv("AWS_PROFILE=default");
-                    }
-                    else
-                    {
-                        std::string es = "AWS_PROFILE=" + ho.awsProfile;
-                        adios2sys::SystemTools::PutEnv(es);
-                    }
-
-                    done = true;
-                }
+                const std::string endpointURL = ho.endpoint;
+                const std::string objPath = m_CampaignData.directory[ds.dirIdx] + "/" + ds.name;
+                Params p;
+                p.emplace("Library", "awssdk");
+                p.emplace("endpoint", endpointURL);
+                p.emplace("cache", m_Options.cachepath + PathSeparator +
+                                       m_CampaignData.hosts[ds.hostIdx].hostname +
+                                       PathSeparator + m_Name);
+                p.emplace("verbose", std::to_string(ho.verbose));
+                p.emplace("recheck_metadata", (ho.recheckMetadata ? "true" : "false"));
+                io.AddTransport("File", p);
+                io.SetEngine("BP5");
+                info.localPath = m_CampaignData.directory[ds.dirIdx] + PathSeparator + ds.name;
+                // applied in OpenDatasets, the S3 client reads them when it is created
+                info.env.push_back(std::string("AWS_EC2_METADATA_DISABLED=") +
+                                   (ho.isAWS_EC2 ? "false" : "true"));
+                info.env.push_back("AWS_PROFILE=" +
+                                   (ho.awsProfile.empty() ? std::string("default")
+                                                          : ho.awsProfile));
+
+                done = true;
             }
+        }
 
-            if (!done)
+        if (!done)
+        {
+            const std::string remotePath =
+                m_CampaignData.directory[ds.dirIdx] + PathSeparator + ds.name;
+            info.localPath = m_Options.cachepath + PathSeparator +
+                             m_CampaignData.hosts[ds.hostIdx].hostname + PathSeparator + m_Name +
+                             PathSeparator + ds.name;
+            info.remote = true;
+            io.SetParameter("RemoteDataPath", remotePath);
+            io.SetParameter("RemoteHost", m_CampaignData.hosts[ds.hostIdx].hostname);
+        }
+    }
+    else
+    {
+        info.localPath = m_CampaignData.directory[ds.dirIdx] + PathSeparator + ds.name;
+    }
+}
+
+void CampaignReader::OpenDatasets(const std::vector<size_t> &idxs)
+{
+    std::vector<size_t> toOpen;
+    for (const size_t idx : idxs)
+    {
+        if (!m_Engines[idx] && std::find(toOpen.begin(), toOpen.end(), idx) == toOpen.end())
+        {
+            toOpen.push_back(idx);
+            // communicators are created here, not on the threads
+            m_Datasets[idx].comm = m_DatasetComm.Duplicate();
+        }
+    }
+
+    auto lf_Open = [&](const size_t idx) -> Engine * {
+        DatasetInfo &info = m_Datasets[idx];
+        const CampaignBPDataset &ds = *info.ds;
+        if (info.remote)
+        {
+            if (m_Options.verbose > 0)
+            {
+                std::cout << "Open remote file " << m_CampaignData.hosts[ds.hostIdx].hostname
+                          << ":" << m_CampaignData.directory[ds.dirIdx] << PathSeparator
+                          << ds.name << "\n    and use local cache for metadata at "
+                          << info.localPath << " \n";
+            }
+            helper::CreateDirectory(info.localPath);
+            for (auto &bpf : ds.files)
             {
-                const std::string remotePath =
-                    m_CampaignData.directory[ds.dirIdx] + PathSeparator + ds.name;
-                const std::string remoteURL =
-                    m_CampaignData.hosts[ds.hostIdx].hostname + ":" + remotePath;
-                localPath = m_Options.cachepath + PathSeparator +
-                            m_CampaignData.hosts[ds.hostIdx].hostname + PathSeparator + m_Name +
-                            PathSeparator + ds.name;
-                if (m_Options.verbose > 0)
+                // only the database access is serialized, not the writing
+                const std::string path = info.localPath + PathSeparator + bpf.name;
+                std::vector<char> blob;
+                bool changed;
                 {
-                    std::cout << "Open remote file " << remoteURL
-                              << "\n    and use local cache for metadata at " << localPath << " \n";
+                    std::lock_guard<std::mutex> lockGuard(m_DBMutex);
+                    changed = ReadFromDB(m_DB, path, bpf, blob);
                 }
-                helper::CreateDirectory(localPath);
-                for (auto &bpf : ds.files)
+                if (changed)
                 {
-                    /*std::cout << "     save file " << remoteURL << "/" <<
-                       bpf.name
-                              << " to " << localPath << "/" << bpf.name << "\n";*/
-                    SaveToFile(m_DB, localPath + PathSeparator + bpf.name, bpf);
+                    SaveToFile(path, bpf, blob);
                 }
-                io.SetParameter("RemoteDataPath", remotePath);
-                io.SetParameter("RemoteHost", m_CampaignData.hosts[ds.hostIdx].hostname);
             }
         }
-        else
+        else if (m_Options.verbose > 0)
         {
-            localPath = m_CampaignData.directory[ds.dirIdx] + PathSeparator + ds.name;
-            if (m_Options.verbose > 0)
+            std::cout << "Open local file " << info.localPath << "\n";
+        }
+        // the IOs and engines share the ADIOS object, create one at a time;
+        // the environment is process wide, keep it until this dataset is opened
+        std::lock_guard<std::mutex> openLock(m_OpenMutex);
+        for (const auto &e : info.env)
+        {
+            adios2sys::SystemTools::PutEnv(e);
+        }
+        return &m_IOs[idx]->Open(info.localPath, m_OpenMode, std::move(info.comm));
+    };
+
+    if (!m_OpenPool || toOpen.size() < 2)
+    {
+        for (const size_t idx : toOpen)
+        {
+            m_Engines[idx] = lf_Open(idx);
+        }
+        return;
+    }
+
+    std::vector<std::future<Engine *>> futures;
+    for (const size_t idx : toOpen)
+    {
+        futures.push_back(m_OpenPool->Submit([&lf_Open, idx]() { return lf_Open(idx); }));
+    }
+    // wait for all opens before rethrowing the first error
+    std::exception_ptr error;
+    for (size_t k = 0; k < toOpen.size(); ++k)
+    {
+        try
+        {
+            m_Engines[toOpen[k]] = futures[k].get();
+        }
+        catch (...)
+        {
+            if (!error)
             {
-                std::cout << "Open local file " << localPath << "\n";
+                error = std::current_exception();
             }
         }
+    }
+    if (error)
+    {
+        std::rethrow_exception(error);
+    }
+}
 
-        adios2::core::Engine &e = io.Open(localPath, m_OpenMode, m_Comm.Duplicate());
+Engine *CampaignReader::DatasetEngine(const size_t idx) const
+{
+    if (!m_Engines[idx])
+    {
+        // opening is not a visible change of the campaign engine
+        const_cast<CampaignReader *>(this)->OpenDatasets({idx});
+    }
+    return m_Engines[idx];
+}
 
-        m_IOs.push_back(&io);
-        m_Engines.push_back(&e);
+VariableBase *CampaignReader::ActualVariable(const std::string &name) const
+{
+    auto it = m_VarInternalInfo.find(name);
+    if (it == m_VarInternalInfo.end())
+    {
+        return nullptr;
+    }
+    const VarInternalInfo &vii = it->second;
+    if (!vii.originalVar)
+    {
+        DatasetEngine(vii.engineIdx);
+        const VarMap &vars = m_IOs[vii.ioIdx]->GetVariables();
+        auto itVar = vars.find(vii.originalName);
+        if (itVar == vars.end())
+        {
+            helper::Throw<std::runtime_error>("Engine", "CampaignReader", "ActualVariable",
+                                              "variable " + vii.originalName +
+                                                  " of the catalog is not found in dataset " +
+                                                  m_Datasets[vii.ioIdx].localPath);
+        }
+        const_cast<VarInternalInfo &>(vii).originalVar = itVar->second.get();
+    }
+    return static_cast<VariableBase *>(vii.originalVar);
+}
 
-        auto vmap = io.GetAvailableVariables();
-        auto amap = io.GetAvailableAttributes();
-        VarInternalInfo internalInfo(nullptr, m_IOs.size() - 1, m_Engines.size() - 1);
+std::string CampaignReader::CatalogKey(const size_t idx) const
+{
+    std::string key;
+    for (const auto &bpf : m_Datasets[idx].ds->files)
+    {
+        key += bpf.name + ":" + std::to_string(bpf.ctime) + ":" +
+               std::to_string(bpf.lengthOriginal) + ";";
+    }
+    return key;
+}
 
-        for (auto &vr : vmap)
+std::string CampaignReader::ReadCatalog(const size_t idx) const
+{
+    std::ifstream f(m_Datasets[idx].catalogPath);
+    if (!f)
+    {
+        return std::string();
+    }
+    std::string text((std::istreambuf_iterator<char>(f)), std::istreambuf_iterator<char>());
+    try
+    {
+        nlohmann::json j = nlohmann::json::parse(text);
+        if (j.at("key").get<std::string>() == CatalogKey(idx))
         {
-            auto vname = vr.first;
-            std::string fname = ds.name;
-            std::string newname = fname + "/" + vname;
+            return text;
+        }
+    }
+    catch (std::exception &)
+    {
+    }
+    if (m_Options.verbose > 0)
+    {
+        std::cout << "Catalog " << m_Datasets[idx].catalogPath << " is out of date\n";
+    }
+    return std::string();
+}
 
-            const DataType type = io.InquireVariableType(vname);
+std::string CampaignReader::BuildCatalog(const size_t idx)
+{
+    IO &io = *m_IOs[idx];
+    Engine &e = *m_Engines[idx];
+    nlohmann::json j;
+    j["key"] = CatalogKey(idx);
 
-            if (type == DataType::Struct)
-            {
-            }
+    nlohmann::json vars = nlohmann::json::object();
+    for (auto &vr : io.GetVariables())
+    {
+        const DataType type = vr.second->m_Type;
+        if (type == DataType::Struct)
+        {
+        }
 #define declare_type(T)                                                                            \
     else if (type == helper::GetDataType<T>())                                                     \
     {                                                                                              \
-        Variable<T> *vi = io.InquireVariable<T>(vname);                                            \
-        Variable<T> v = DuplicateVariable(vi, m_IO, newname, internalInfo);                        \
+        vars[vr.first] = CatalogVariable(e, *static_cast<Variable<T> *>(vr.second.get()));         \
     }
-
-            ADIOS2_FOREACH_STDTYPE_1ARG(declare_type)
+        ADIOS2_FOREACH_STDTYPE_1ARG(declare_type)
 #undef declare_type
+    }
+    j["variables"] = vars;
+
+    nlohmann::json attrs = nlohmann::json::object();
+    for (auto &ar : io.GetAttributes())
+    {
+        const DataType type = ar.second->m_Type;
+        if (type == DataType::Struct)
+        {
         }
+#define declare_type(T)                                                                            \
+    else if (type == helper::GetDataType<T>())                                                     \
+    {                                                                                              \
+        attrs[ar.first] = CatalogAttribute(*static_cast<Attribute<T> *>(ar.second.get()));        \
+    }
+        ADIOS2_FOREACH_STDTYPE_1ARG(declare_type)
+#undef declare_type
+    }
+    j["attributes"] = attrs;
+    return j.dump();
+}
 
-        for (auto &ar : amap)
+void CampaignReader::WriteCatalog(const size_t idx, const std::string &text) const
+{
+    const std::string &path = m_Datasets[idx].catalogPath;
+    const std::string dir = adios2sys::SystemTools::GetFilenamePath(path);
+    // write a temporary file and rename it so that readers never see a partial catalog
+    const std::string tmpPath = path + ".tmp" + std::to_string(m_ReaderRank);
+    bool written = false;
+    if (helper::CreateDirectory(dir))
+    {
+        std::ofstream f(tmpPath);
+        written = static_cast<bool>(f << text);
+    }
+    if (!written || std::rename(tmpPath.c_str(), path.c_str()) != 0)
+    {
+        std::remove(tmpPath.c_str());
+        if (m_Options.verbose > 0)
         {
-            auto aname = ar.first;
-            std::string fname = ds.name;
-            std::string newname = fname + "/" + aname;
+            std::cout << "Cannot write catalog " << path << "\n";
+        }
+    }
+}
 
-            const DataType type = io.InquireAttributeType(aname);
+void CampaignReader::DefineCatalog(const size_t idx, const std::string &text)
+{
+    const std::string &dsname = m_Datasets[idx].ds->name;
+    nlohmann::json j = nlohmann::json::parse(text);
 
-            if (type == DataType::Struct)
-            {
-            }
+    for (auto &vr : j.at("variables").items())
+    {
+        const std::string &vname = vr.key();
+        const nlohmann::json &jv = vr.value();
+        std::string newname = dsname + "/" + vname;
+        VarInternalInfo internalInfo(nullptr, vname, idx, idx);
+
+        const DataType type = helper::GetDataTypeFromString(jv.at("type").get<std::string>());
+
+        if (type == DataType::Struct)
+        {
+        }
 #define declare_type(T)                                                                            \
     else if (type == helper::GetDataType<T>())                                                     \
     {                                                                                              \
-        Attribute<T> *ai = io.InquireAttribute<T>(aname);                                          \
-        Attribute<T> v = DuplicateAttribute(ai, m_IO, newname);                                    \
+        Variable<T> &v = DefineCatalogVariable<T>(m_IO, newname, jv, internalInfo.hasMinMax,       \
+                                                  internalInfo.minMax);                            \
+        v.m_Engine = this; /* Variable::Shape() uses this member to call engine */                 \
     }
 
-            ADIOS2_FOREACH_STDTYPE_1ARG(declare_type)
+        ADIOS2_FOREACH_STDTYPE_1ARG(declare_type)
 #undef declare_type
+        m_VarInternalInfo.emplace(newname, internalInfo);
+    }
+
+    for (auto &ar : j.at("attributes").items())
+    {
+        std::string newname = dsname + "/" + ar.key();
+        const nlohmann::json &ja = ar.value();
+
+        const DataType type = helper::GetDataTypeFromString(ja.at("type").get<std::string>());
+
+        if (type == DataType::Struct)
+        {
         }
-        ++i;
+#define declare_type(T)                                                                            \
+    else if (type == helper::GetDataType<T>())                                                     \
+    {                                                                                              \
+        DefineCatalogAttribute<T>(m_IO, newname, ja);                                              \
+    }
+
+        ADIOS2_FOREACH_STDTYPE_1ARG(declare_type)
+#undef declare_type
     }
 }
 
+CampaignReader::VarSelection::VarSelection(const VariableBase &v)
+: selectionType(v.m_SelectionType), start(v.m_Start), count(v.m_Count),
+  memoryStart(v.m_MemoryStart), memoryCount(v.m_MemoryCount), stepsStart(v.m_StepsStart),
+  stepsCount(v.m_StepsCount), blockID(v.m_BlockID), memSpace(v.m_MemSpace)
+{
+}
+
+void CampaignReader::VarSelection::Apply(VariableBase &v) const
+{
+    v.m_SelectionType = selectionType;
+    v.m_Start = start;
+    v.m_Count = count;
+    v.m_StepsStart = stepsStart;
+    v.m_StepsCount = stepsCount;
+    v.m_BlockID = blockID;
+    v.m_MemoryStart = memoryStart;
+    v.m_MemoryCount = memoryCount;
+    v.m_MemSpace = memSpace;
+}
+
 void CampaignReader::DoClose(const int transportIndex)
 {
     if (m_Options.verbose > 1)
     {
         std::cout << "Campaign Reader " << m_ReaderRank << " Close(" << m_Name << ")\n";
     }
+    if (m_NeedPerformGets)
+    {
+        PerformGets();
+    }
     for (auto ep : m_Engines)
     {
-        ep->Close();
+        if (ep)
+        {
+            ep->Close();
+        }
     }
     sqlite3_close(m_DB);
     m_IsOpen = false;
@@ -390,11 +714,10 @@ void CampaignReader::DestructorClose(bool Verbose) noexcept { sqlite3_close(m_DB
 
 MinVarInfo *CampaignReader::MinBlocksInfo(const VariableBase &Var, size_t Step) const
 {
-    auto it = m_VarInternalInfo.find(Var.m_Name);
-    if (it != m_VarInternalInfo.end())
+    VariableBase *vb = ActualVariable(Var.m_Name);
+    if (vb)
     {
-        VariableBase *vb = reinterpret_cast<VariableBase *>(it->second.originalVar);
-        Engine *e = m_Engines[it->second.engineIdx];
+        Engine *e = m_Engines[m_VarInternalInfo.at(Var.m_Name).engineIdx];
         MinVarInfo *MV = e->MinBlocksInfo(*vb, Step);
         if (MV)
         {
@@ -407,9 +730,10 @@ MinVarInfo *CampaignReader::MinBlocksInfo(const VariableBase &Var, size_t Step)
 bool CampaignReader::VarShape(const VariableBase &Var, const size_t Step, Dims &Shape) const
 {
     auto it = m_VarInternalInfo.find(Var.m_Name);
-    if (it != m_VarInternalInfo.end())
+    // an unopened dataset has its shapes in the catalog
+    if (it != m_VarInternalInfo.end() && m_Engines[it->second.engineIdx])
     {
-        VariableBase *vb = reinterpret_cast<VariableBase *>(it->second.originalVar);
+        VariableBase *vb = ActualVariable(Var.m_Name);
         Engine *e = m_Engines[it->second.engineIdx];
         return e->VarShape(*vb, Step, Shape);
     }
@@ -422,7 +746,12 @@ bool CampaignReader::VariableMinMax(const VariableBase &Var, const size_t Step,
     auto it = m_VarInternalInfo.find(Var.m_Name);
     if (it != m_VarInternalInfo.end())
     {
-        VariableBase *vb = reinterpret_cast<VariableBase *>(it->second.originalVar);
+        if (Step == DefaultSizeT && it->second.hasMinMax && !m_Engines[it->second.engineIdx])
+        {
+            MinMax = it->second.minMax;
+            return true;
+        }
+        VariableBase *vb = ActualVariable(Var.m_Name);
         Engine *e = m_Engines[it->second.engineIdx];
         return e->VariableMinMax(*vb, Step, MinMax);
     }
@@ -431,11 +760,10 @@ bool CampaignReader::VariableMinMax(const VariableBase &Var, const size_t Step,
 
 std::string CampaignReader::VariableExprStr(const VariableBase &Var)
 {
-    auto it = m_VarInternalInfo.find(Var.m_Name);
-    if (it != m_VarInternalInfo.end())
+    VariableBase *vb = ActualVariable(Var.m_Name);
+    if (vb)
     {
-        VariableBase *vb = reinterpret_cast<VariableBase *>(it->second.originalVar);
-        Engine *e = m_Engines[it->second.engineIdx];
+        Engine *e = m_Engines[m_VarInternalInfo.at(Var.m_Name).engineIdx];
         return e->VariableExprStr(*vb);
     }
     return "";
@@ -451,19 +779,15 @@ std::string CampaignReader::VariableExprStr(const VariableBase &Var)
     void CampaignReader::DoGetDeferred(Variable<T> &variable, T *data)                             \
     {                                                                                              \
         PERFSTUBS_SCOPED_TIMER("CampaignReader::Get");                                             \
-        auto it = m_VarInternalInfo.find(variable.m_Name);                                         \
-        Variable<T> *v = reinterpret_cast<Variable<T> *>(it->second.originalVar);                  \
-        Engine *e = m_Engines[it->second.engineIdx];                                               \
-        e->Get(*v, data, adios2::Mode::Deferred);                                                  \
+        GetDeferredCommon(variable, data);                                                         \
     }                                                                                              \
                                                                                                    \
     std::map<size_t, std::vector<typename Variable<T>::BPInfo>>                                    \
     CampaignReader::DoAllStepsBlocksInfo(const Variable<T> &variable) const                        \
     {                                                                                              \
         PERFSTUBS_SCOPED_TIMER("CampaignReader::AllStepsBlocksInfo");                              \
-        auto it = m_VarInternalInfo.find(variable.m_Name);                                         \
-        Variable<T> *v = reinterpret_cast<Variable<T> *>(it->second.originalVar);                  \
-        Engine *e = m_Engines[it->second.engineIdx];                                               \
+        Variable<T> *v = reinterpret_cast<Variable<T> *>(ActualVariable(variable.m_Name));         \
+        Engine *e = m_Engines[m_VarInternalInfo.at(variable.m_Name).engineIdx];                    \
         return e->AllStepsBlocksInfo(*v);                                                          \
     }                                                                                              \
                                                                                                    \
@@ -471,9 +795,8 @@ std::string CampaignReader::VariableExprStr(const VariableBase &Var)
     CampaignReader::DoAllRelativeStepsBlocksInfo(const Variable<T> &variable) const                \
     {                                                                                              \
         PERFSTUBS_SCOPED_TIMER("CampaignReader::AllRelativeStepsBlocksInfo");                      \
-        auto it = m_VarInternalInfo.find(variable.m_Name);                                         \
-        Variable<T> *v = reinterpret_cast<Variable<T> *>(it->second.originalVar);                  \
-        Engine *e = m_Engines[it->second.engineIdx];                                               \
+        Variable<T> *v = reinterpret_cast<Variable<T> *>(ActualVariable(variable.m_Name));         \
+        Engine *e = m_Engines[m_VarInternalInfo.at(variable.m_Name).engineIdx];                    \
         return e->AllRelativeStepsBlocksInfo(*v);                                                  \
     }                                                                                              \
                                                                                                    \
@@ -481,9 +804,8 @@ std::string CampaignReader::VariableExprStr(const VariableBase &Var)
         const Variable<T> &variable, const size_t step) const                                      \
     {                                                                                              \
         PERFSTUBS_SCOPED_TIMER("CampaignReader::BlocksInfo");                                      \
-        auto it = m_VarInternalInfo.find(variable.m_Name);                                         \
-        Variable<T> *v = reinterpret_cast<Variable<T> *>(it->second.originalVar);                  \
-        Engine *e = m_Engines[it->second.engineIdx];                                               \
+        Variable<T> *v = reinterpret_cast<Variable<T> *>(ActualVariable(variable.m_Name));         \
+        Engine *e = m_Engines[m_VarInternalInfo.at(variable.m_Name).engineIdx];                    \
         return e->BlocksInfo(*v, step);                                                            \
     }
 
@@ -18,6 +18,12 @@
 #include "adios2/core/Engine.h"
 #include "adios2/helper/adiosComm.h"
 #include "adios2/helper/adiosFunctions.h"
+#include "adios2/helper/adiosThreadPool.h"
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <set>
 
 #include <sqlite3.h>
 
@@ -63,24 +69,105 @@ private:
     // EndStep must call PerformGets if necessary
     bool m_NeedPerformGets = false;
 
+    /** open a dataset on first use in each process instead of all of them
+     * collectively in Open */
+    bool m_LazyOpen = false;
+
+    /** with LazyOpen, datasets prepared for opening concurrently on this many
+     * threads, 1: one after another */
+    size_t m_OpenThreads = 1;
+    std::unique_ptr<helper::ThreadPool> m_OpenPool;
+
+    /** the engines of the datasets get a duplicate of the engine communicator,
+     * or with LazyOpen a communicator of one process, because each process
+     * opens a dataset separately whenever it first needs it */
+    helper::Comm m_DatasetComm;
+
+    /** how to open a dataset, its engine is created on first use */
+    struct DatasetInfo
+    {
+        CampaignBPDataset *ds;
+        std::string localPath;   // path given to Open
+        std::string catalogPath; // cached list of variables and attributes
+        bool remote = false;     // metadata is unpacked from the database into localPath
+        std::vector<std::string> env; // process environment the S3 transport reads in Open
+        helper::Comm comm;
+    };
+    std::vector<DatasetInfo> m_Datasets;
+
     std::vector<adios2::core::IO *> m_IOs;
-    std::vector<adios2::core::Engine *> m_Engines;
+    std::vector<adios2::core::Engine *> m_Engines; // nullptr until the dataset is opened
+
+    /** serializes the database access of concurrent opens */
+    std::mutex m_DBMutex;
+    /** serializes IO::Open of concurrent opens, with setting the environment
+     * of the dataset */
+    std::mutex m_OpenMutex;
 
     struct VarInternalInfo
     {
-        void *originalVar; // Variable<T> in the actual IO
-        size_t ioIdx;      // actual IO in m_IOs
-        size_t engineIdx;  // actual engine in m_Engines
-        VarInternalInfo(void *p, size_t i, size_t e) : originalVar(p), ioIdx(i), engineIdx(e) {}
+        void *originalVar;        // Variable<T> in the actual IO, nullptr until opened
+        std::string originalName; // name in the actual IO
+        size_t ioIdx;             // actual IO in m_IOs
+        size_t engineIdx;         // actual engine in m_Engines
+        bool hasMinMax = false;   // min/max of all steps known from the catalog
+        MinMaxStruct minMax;
+        VarInternalInfo(void *p, const std::string &n, size_t i, size_t e)
+        : originalVar(p), originalName(n), ioIdx(i), engineIdx(e)
+        {
+        }
     };
     std::unordered_map<std::string, VarInternalInfo> m_VarInternalInfo;
 
+    /** selection of a variable at the time of a Get */
+    struct VarSelection
+    {
+        SelectionType selectionType;
+        Dims start, count, memoryStart, memoryCount;
+        size_t stepsStart, stepsCount, blockID;
+        MemorySpace memSpace;
+        VarSelection(const VariableBase &v);
+        void Apply(VariableBase &v) const;
+    };
+
+    /** deferred Gets on datasets that are not open yet, issued in PerformGets
+     * after opening all the datasets they need at once */
+    std::vector<std::pair<size_t, std::function<void()>>> m_LazyGets;
+    /** datasets with deferred Gets to perform */
+    std::set<size_t> m_GetDatasets;
+
     void Init() final; ///< called from constructor, gets the selected Skeleton
                        /// transport method from settings
     void ReadConfig(std::string path);
     void InitParameters() final;
     void InitTransports() final;
 
+    /** set up the IO of a dataset for Open */
+    void PrepareDataset(const size_t idx);
+
+    /** open the datasets not open yet, concurrently if OpenThreads > 1 */
+    void OpenDatasets(const std::vector<size_t> &idxs);
+
+    /** engine of a dataset, opened on first use */
+    Engine *DatasetEngine(const size_t idx) const;
+
+    /** variable in the engine of its dataset, opening the dataset if needed */
+    VariableBase *ActualVariable(const std::string &name) const;
+
+    /** catalog key: the metadata files of the dataset as recorded in the database */
+    std::string CatalogKey(const size_t idx) const;
+
+    /** catalog text from the catalog file if it matches the database, empty otherwise */
+    std::string ReadCatalog(const size_t idx) const;
+
+    /** list the variables and attributes of an opened dataset */
+    std::string BuildCatalog(const size_t idx);
+
+    void WriteCatalog(const size_t idx, const std::string &text) const;
+
+    /** define the variables and attributes of a catalog in the campaign IO */
+    void DefineCatalog(const size_t idx, const std::string &text);
+
 #define declare_type(T)                                                                            \
     void DoGetSync(Variable<T> &, T *) final;                                                      \
     void DoGetDeferred(Variable<T> &, T *) final;
@@ -109,26 +196,14 @@ private:
     void DestructorClose(bool Verbose) noexcept final;
 
     /**
-     * Create a new variable with name `name` in `io`
-     * based on an existing variable.
-     */
-    template <class T>
-    Variable<T> DuplicateVariable(Variable<T> *variable, IO &io, std::string &name,
-                                  VarInternalInfo &vii);
-
-    /**
-     * Create a new attribute with name `name` in `io`
-     * based on an existing attribute.
+     * Find the variable in the actual engine and copy the selection
+     * of the campaign variable into it.
      */
     template <class T>
-    Attribute<T> DuplicateAttribute(Attribute<T> *attribute, IO &io, std::string &name);
+    std::pair<Variable<T> *, Engine *> TranslateToActualVariable(Variable<T> &variable);
 
-    /**
-     * Create a new variable with name `name` in `io`
-     * based on an existing variable.
-     */
     template <class T>
-    std::pair<Variable<T> *, Engine *> TranslateToActualVariable(Variable<T> &variable);
+    void GetDeferredCommon(Variable<T> &variable, T *data);
 
     sqlite3 *m_DB;
     CampaignData m_CampaignData;
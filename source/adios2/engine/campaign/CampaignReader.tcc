@@ -13,7 +13,12 @@
 
 #include "CampaignReader.h"
 
+#include <cmath>
+#include <complex>
 #include <iostream>
+#include <limits>
+
+#include <nlohmann_json.hpp>
 
 namespace adios2
 {
@@ -22,68 +27,287 @@ namespace core
 namespace engine
 {
 
+/*
+ * The catalog of a dataset lists its variables and attributes so that a
+ * campaign can be opened without opening the engines of its datasets.
+ */
+
+/* JSON has no NaN and infinity, they are stored as strings (nlohmann::json
+ * would write null) */
+template <class T>
+nlohmann::json CatalogFloat(const T value)
+{
+    if (std::isnan(value))
+    {
+        return "nan";
+    }
+    if (std::isinf(value))
+    {
+        return (value < 0 ? "-inf" : "inf");
+    }
+    return nlohmann::json(value);
+}
+
+template <class T>
+void CatalogFloat(const nlohmann::json &j, T &value)
+{
+    if (j.is_number())
+    {
+        value = j.get<T>();
+    }
+    else if (j.is_string() && j.get<std::string>() == "inf")
+    {
+        value = std::numeric_limits<T>::infinity();
+    }
+    else if (j.is_string() && j.get<std::string>() == "-inf")
+    {
+        value = -std::numeric_limits<T>::infinity();
+    }
+    else if (j.is_string() || j.is_null())
+    {
+        value = std::numeric_limits<T>::quiet_NaN();
+    }
+    else
+    {
+        value = j.get<T>(); // throws the type error
+    }
+}
+
+inline nlohmann::json CatalogValue(const float &value) { return CatalogFloat(value); }
+inline nlohmann::json CatalogValue(const double &value) { return CatalogFloat(value); }
+inline nlohmann::json CatalogValue(const long double &value) { return CatalogFloat(value); }
+inline void CatalogValue(const nlohmann::json &j, float &value) { CatalogFloat(j, value); }
+inline void CatalogValue(const nlohmann::json &j, double &value) { CatalogFloat(j, value); }
+inline void CatalogValue(const nlohmann::json &j, long double &value) { CatalogFloat(j, value); }
+
+template <class T>
+nlohmann::json CatalogValue(const T &value)
+{
+    return nlohmann::json(value);
+}
+
+template <class T>
+nlohmann::json CatalogValue(const std::complex<T> &value)
+{
+    return nlohmann::json::array({CatalogValue(value.real()), CatalogValue(value.imag())});
+}
+
+template <class T>
+void CatalogValue(const nlohmann::json &j, T &value)
+{
+    value = j.get<T>();
+}
+
+template <class T>
+void CatalogValue(const nlohmann::json &j, std::complex<T> &value)
+{
+    T re, im;
+    CatalogValue(j.at(0), re);
+    CatalogValue(j.at(1), im);
+    value = std::complex<T>(re, im);
+}
+
+template <class T>
+void SetMinMax(const T &min, const T &max, MinMaxStruct &mm)
+{
+    *(T *)&mm.MinUnion = min;
+    *(T *)&mm.MaxUnion = max;
+}
+
+inline void SetMinMax(const std::string &, const std::string &, MinMaxStruct &) {}
+
+template <class T>
+bool GetMinMax(const MinMaxStruct &mm, T &min, T &max)
+{
+    min = *(const T *)&mm.MinUnion;
+    max = *(const T *)&mm.MaxUnion;
+    return true;
+}
+
+inline bool GetMinMax(const MinMaxStruct &, std::string &, std::string &) { return false; }
+
+template <class T>
+nlohmann::json CatalogVariable(Engine &engine, Variable<T> &variable)
+{
+    nlohmann::json j;
+    j["type"] = ToString(variable.m_Type);
+    j["shapeid"] = static_cast<int>(variable.m_ShapeID);
+    j["shape"] = variable.m_Shape;
+    j["start"] = variable.m_Start;
+    j["count"] = variable.m_Count;
+    j["singlevalue"] = variable.m_SingleValue;
+    j["readasjoined"] = variable.m_ReadAsJoined;
+    j["readaslocalvalue"] = variable.m_ReadAsLocalValue;
+    j["randomaccess"] = variable.m_RandomAccess;
+    j["joineddimpos"] = variable.m_JoinedDimPos;
+    j["availablestepsstart"] = variable.GetAvailableStepsStart();
+    j["availablestepscount"] = variable.GetAvailableStepsCount();
+    j["stepsstart"] = variable.m_StepsStart;
+    j["stepscount"] = variable.m_StepsCount;
+    j["min"] = CatalogValue(variable.m_Min);
+    j["max"] = CatalogValue(variable.m_Max);
+    j["value"] = CatalogValue(variable.m_Value);
+
+    // engines that do not fill m_AvailableStepBlockIndexOffsets still get its
+    // keys (step + 1), so that the steps are known without opening the dataset
+    nlohmann::json offsets = nlohmann::json::array();
+    for (const auto &it : variable.m_AvailableStepBlockIndexOffsets)
+    {
+        offsets.push_back({it.first, it.second});
+    }
+    if (variable.m_AvailableStepBlockIndexOffsets.empty())
+    {
+        for (const size_t step : engine.GetAbsoluteSteps(variable))
+        {
+            offsets.push_back({step + 1, std::vector<size_t>()});
+        }
+    }
+    j["stepblockoffsets"] = offsets;
+
+    // shapes that differ from m_Shape, keyed by step + 1 as in m_AvailableShapes
+    std::map<size_t, Dims> shapes = variable.m_AvailableShapes;
+    if (variable.m_ShapeID == ShapeID::GlobalArray)
+    {
+        const size_t steps = variable.GetAvailableStepsCount();
+        for (size_t step = 0; step < steps; ++step)
+        {
+            Dims shape;
+            if (engine.VarShape(variable, step, shape) && shape != variable.m_Shape)
+            {
+                shapes[step + 1] = shape;
+            }
+        }
+    }
+    nlohmann::json jshapes = nlohmann::json::array();
+    for (const auto &it : shapes)
+    {
+        jshapes.push_back({it.first, it.second});
+    }
+    j["shapes"] = jshapes;
+
+    MinMaxStruct mm;
+    T min, max;
+    if (engine.VariableMinMax(variable, DefaultSizeT, mm) && GetMinMax(mm, min, max))
+    {
+        j["minmax"] = {CatalogValue(min), CatalogValue(max)};
+    }
+    return j;
+}
+
 template <class T>
-inline Variable<T> CampaignReader::DuplicateVariable(Variable<T> *variable, IO &io,
-                                                     std::string &name, VarInternalInfo &vii)
-{
-    auto &v = io.DefineVariable<T>(name, variable->Shape());
-    v.m_AvailableStepsCount = variable->GetAvailableStepsCount();
-    v.m_AvailableStepsStart = variable->GetAvailableStepsStart();
-    v.m_ShapeID = variable->m_ShapeID;
-    v.m_SingleValue = variable->m_SingleValue;
-    v.m_ReadAsJoined = variable->m_ReadAsJoined;
-    v.m_ReadAsLocalValue = variable->m_ReadAsLocalValue;
-    v.m_RandomAccess = variable->m_RandomAccess;
-    v.m_MemSpace = variable->m_MemSpace;
-    v.m_JoinedDimPos = variable->m_JoinedDimPos;
-    v.m_AvailableStepBlockIndexOffsets = variable->m_AvailableStepBlockIndexOffsets;
-    v.m_AvailableShapes = variable->m_AvailableShapes;
-    v.m_Min = variable->m_Min;
-    v.m_Max = variable->m_Max;
-    v.m_Value = variable->m_Value;
-    v.m_StepsStart = variable->m_StepsStart;
-    v.m_StepsCount = variable->m_StepsCount;
-    v.m_Start = variable->m_Start;
-    v.m_Count = variable->m_Count;
-
-    v.m_Engine = this; // Variable::Shape() uses this member to call engine
-    vii.originalVar = static_cast<void *>(variable);
-    m_VarInternalInfo.emplace(name, vii);
+Variable<T> &DefineCatalogVariable(IO &io, const std::string &name, const nlohmann::json &j,
+                                   bool &hasMinMax, MinMaxStruct &minMax)
+{
+    auto &v = io.DefineVariable<T>(name, j.at("shape").get<Dims>());
+    v.m_ShapeID = static_cast<ShapeID>(j.at("shapeid").get<int>());
+    v.m_Start = j.at("start").get<Dims>();
+    v.m_Count = j.at("count").get<Dims>();
+    v.m_SingleValue = j.at("singlevalue").get<bool>();
+    v.m_ReadAsJoined = j.at("readasjoined").get<bool>();
+    v.m_ReadAsLocalValue = j.at("readaslocalvalue").get<bool>();
+    v.m_RandomAccess = j.at("randomaccess").get<bool>();
+    v.m_JoinedDimPos = j.at("joineddimpos").get<size_t>();
+    v.m_AvailableStepsStart = j.at("availablestepsstart").get<size_t>();
+    v.m_AvailableStepsCount = j.at("availablestepscount").get<size_t>();
+    v.m_StepsStart = j.at("stepsstart").get<size_t>();
+    v.m_StepsCount = j.at("stepscount").get<size_t>();
+    CatalogValue(j.at("min"), v.m_Min);
+    CatalogValue(j.at("max"), v.m_Max);
+    CatalogValue(j.at("value"), v.m_Value);
+    for (const auto &it : j.at("stepblockoffsets"))
+    {
+        v.m_AvailableStepBlockIndexOffsets[it.at(0).get<size_t>()] =
+            it.at(1).get<std::vector<size_t>>();
+    }
+    for (const auto &it : j.at("shapes"))
+    {
+        v.m_AvailableShapes[it.at(0).get<size_t>()] = it.at(1).get<Dims>();
+    }
+    hasMinMax = (j.find("minmax") != j.end());
+    if (hasMinMax)
+    {
+        T min, max;
+        CatalogValue(j.at("minmax").at(0), min);
+        CatalogValue(j.at("minmax").at(1), max);
+        SetMinMax(min, max, minMax);
+    }
     return v;
 }
 
 template <class T>
-inline Attribute<T> CampaignReader::DuplicateAttribute(Attribute<T> *attribute, IO &io,
-                                                       std::string &name)
+nlohmann::json CatalogAttribute(Attribute<T> &attribute)
 {
-    if (attribute->m_IsSingleValue)
+    nlohmann::json j;
+    j["type"] = ToString(attribute.m_Type);
+    if (attribute.m_IsSingleValue)
     {
-        auto &a = io.DefineAttribute<T>(name, attribute->m_DataSingleValue);
-        return a;
+        j["value"] = CatalogValue(attribute.m_DataSingleValue);
     }
-    auto &a = io.DefineAttribute<T>(name, attribute->m_DataArray.data(), attribute->m_Elements);
-    return a;
+    else
+    {
+        nlohmann::json values = nlohmann::json::array();
+        for (const auto &value : attribute.m_DataArray)
+        {
+            values.push_back(CatalogValue(value));
+        }
+        j["array"] = values;
+    }
+    return j;
+}
+
+template <class T>
+void DefineCatalogAttribute(IO &io, const std::string &name, const nlohmann::json &j)
+{
+    auto it = j.find("value");
+    if (it != j.end())
+    {
+        T value;
+        CatalogValue(*it, value);
+        io.DefineAttribute<T>(name, value);
+        return;
+    }
+    const nlohmann::json &values = j.at("array");
+    std::vector<T> data(values.size());
+    for (size_t i = 0; i < data.size(); ++i)
+    {
+        CatalogValue(values[i], data[i]);
+    }
+    io.DefineAttribute<T>(name, data.data(), data.size());
 }
 
 template <class T>
 inline std::pair<Variable<T> *, Engine *>
 CampaignReader::TranslateToActualVariable(Variable<T> &variable)
 {
-    auto it = m_VarInternalInfo.find(variable.m_Name);
-    Variable<T> *v = reinterpret_cast<Variable<T> *>(it->second.originalVar);
-    Engine *e = m_Engines[it->second.engineIdx];
-    v->m_SelectionType = variable.m_SelectionType;
-    v->m_Start = variable.m_Start;
-    v->m_Count = variable.m_Count;
-    v->m_StepsStart = variable.m_StepsStart;
-    v->m_StepsCount = variable.m_StepsCount;
-    v->m_BlockID = variable.m_BlockID;
-    v->m_MemoryStart = variable.m_MemoryStart;
-    v->m_MemoryCount = variable.m_MemoryCount;
-    v->m_MemSpace = variable.m_MemSpace;
+    Variable<T> *v = reinterpret_cast<Variable<T> *>(ActualVariable(variable.m_Name));
+    Engine *e = m_Engines[m_VarInternalInfo.at(variable.m_Name).engineIdx];
+    VarSelection(variable).Apply(*v);
     return std::make_pair(v, e);
 }
 
+template <class T>
+inline void CampaignReader::GetDeferredCommon(Variable<T> &variable, T *data)
+{
+    const size_t idx = m_VarInternalInfo.at(variable.m_Name).engineIdx;
+    m_NeedPerformGets = true;
+    m_GetDatasets.insert(idx);
+    if (m_Engines[idx])
+    {
+        auto p = TranslateToActualVariable(variable);
+        p.second->Get(*p.first, data, adios2::Mode::Deferred);
+        return;
+    }
+
+    // keep the selection for when the dataset is opened in PerformGets
+    const std::string name = variable.m_Name;
+    const VarSelection selection(variable);
+    m_LazyGets.emplace_back(idx, [this, name, selection, data]() {
+        Variable<T> *v = reinterpret_cast<Variable<T> *>(ActualVariable(name));
+        selection.Apply(*v);
+        m_Engines[m_VarInternalInfo.at(name).engineIdx]->Get(*v, data, adios2::Mode::Deferred);
+    });
+}
+
 } // end namespace engine
 } // end namespace core
 } // end namespace adios2
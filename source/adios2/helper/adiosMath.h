@@ -57,6 +57,30 @@ template <class T>
 void GetMinMax(const T *values, const size_t size, T &min, T &max,
                const MemorySpace memSpace) noexcept;
 
+/**
+ * Host version of GetMinMax, keeps independent running min/max values for
+ * a number of lanes so that the compiler can vectorize the pass over values
+ * (SSE/AVX/NEON, depending on the target)
+ * @param values input array, size must be > 0
+ * @param size of values array
+ * @param min of values
+ * @param max of values
+ */
+template <class T>
+void GetMinMaxHost(const T *values, const size_t size, T &min, T &max) noexcept;
+
+/**
+ * Copies a host array and gets its min and max in the same pass, each piece
+ * of values is copied and then scanned while it is still in cache
+ * @param values input array, size must be > 0
+ * @param size of values array
+ * @param dest output array of size elements, must not overlap values
+ * @param min of values
+ * @param max of values
+ */
+template <class T>
+void CopyAndGetMinMax(const T *values, const size_t size, T *dest, T &min, T &max) noexcept;
+
 #ifdef ADIOS2_HAVE_GPU_SUPPORT
 template <class T>
 void GetGPUMinMax(const T *values, const size_t size, T &min, T &max) noexcept;
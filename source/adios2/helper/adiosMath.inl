@@ -16,6 +16,7 @@
 
 #include <algorithm> // std::minmax_element, std::min_element, std::max_element
                      // std::transform
+#include <cstring>   // std::memcpy
 #include <limits>    //std::numeri_limits
 #include <thread>
 
@@ -196,9 +197,67 @@ inline void GetMinMax(const T *values, const size_t size, T &min, T &max,
         return;
     }
 #endif
-    auto bounds = std::minmax_element(values, values + size);
-    min = *bounds.first;
-    max = *bounds.second;
+    GetMinMaxHost(values, size, min, max);
+}
+
+template <class T>
+void GetMinMaxHost(const T *values, const size_t size, T &min, T &max) noexcept
+{
+    // a cache line of lanes, a few vector registers for each of min and max
+    constexpr size_t lanes = (64 / sizeof(T) > 0) ? 64 / sizeof(T) : 1;
+    T mins[lanes];
+    T maxs[lanes];
+    for (size_t j = 0; j < lanes; ++j)
+    {
+        mins[j] = values[0];
+        maxs[j] = values[0];
+    }
+
+    size_t i = 0;
+    for (; i + lanes <= size; i += lanes)
+    {
+        for (size_t j = 0; j < lanes; ++j)
+        {
+            const T v = values[i + j];
+            mins[j] = (v < mins[j]) ? v : mins[j];
+            maxs[j] = (maxs[j] < v) ? v : maxs[j];
+        }
+    }
+
+    T lo = mins[0];
+    T hi = maxs[0];
+    for (size_t j = 1; j < lanes; ++j)
+    {
+        lo = (mins[j] < lo) ? mins[j] : lo;
+        hi = (hi < maxs[j]) ? maxs[j] : hi;
+    }
+    for (; i < size; ++i)
+    {
+        lo = (values[i] < lo) ? values[i] : lo;
+        hi = (hi < values[i]) ? values[i] : hi;
+    }
+    min = lo;
+    max = hi;
+}
+
+template <class T>
+void CopyAndGetMinMax(const T *values, const size_t size, T *dest, T &min, T &max) noexcept
+{
+    // pieces small enough to stay in L1 between the copy and the scan
+    constexpr size_t piece = (16384 / sizeof(T) > 0) ? 16384 / sizeof(T) : 1;
+    T lo = values[0];
+    T hi = values[0];
+    for (size_t i = 0; i < size; i += piece)
+    {
+        const size_t n = (size - i < piece) ? size - i : piece;
+        std::memcpy(dest + i, values + i, n * sizeof(T));
+        T pieceMin, pieceMax;
+        GetMinMaxHost(dest + i, n, pieceMin, pieceMax);
+        lo = (pieceMin < lo) ? pieceMin : lo;
+        hi = (hi < pieceMax) ? pieceMax : hi;
+    }
+    min = lo;
+    max = hi;
 }
 
 template <>
@@ -0,0 +1,59 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ *
+ * adiosThreadPool.cpp
+ */
+
+#include "adiosThreadPool.h"
+
+namespace adios2
+{
+namespace helper
+{
+
+ThreadPool::ThreadPool(const size_t nThreads)
+{
+    const size_t n = (nThreads > 0 ? nThreads : 1);
+    m_Threads.reserve(n);
+    for (size_t i = 0; i < n; ++i)
+    {
+        m_Threads.emplace_back(&ThreadPool::Worker, this);
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lockGuard(m_Mutex);
+        m_Stop = true;
+    }
+    m_CV.notify_all();
+    for (auto &t : m_Threads)
+    {
+        t.join();
+    }
+}
+
+void ThreadPool::Worker()
+{
+    while (true)
+    {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(m_Mutex);
+            m_CV.wait(lock, [this]() { return m_Stop || !m_Tasks.empty(); });
+            if (m_Tasks.empty())
+            {
+                // stopped and nothing left to do
+                return;
+            }
+            task = std::move(m_Tasks.front());
+            m_Tasks.pop_front();
+        }
+        task();
+    }
+}
+
+} // end namespace helper
+} // end namespace adios2
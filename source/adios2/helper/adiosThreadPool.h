@@ -0,0 +1,76 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ *
+ * adiosThreadPool.h a fixed set of worker threads running queued tasks
+ */
+
+#ifndef ADIOS2_HELPER_ADIOSTHREADPOOL_H_
+#define ADIOS2_HELPER_ADIOSTHREADPOOL_H_
+
+/// \cond EXCLUDE_FROM_DOXYGEN
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+/// \endcond
+
+namespace adios2
+{
+namespace helper
+{
+
+class ThreadPool
+{
+public:
+    /** Start nThreads worker threads (at least one) */
+    ThreadPool(const size_t nThreads);
+
+    /** Runs all tasks still in the queue, then joins the workers */
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    /**
+     * Queue a task for the workers, tasks start in the order they were
+     * submitted
+     * @param task callable without arguments
+     * @return future for the result of the task, exceptions thrown by the
+     * task are rethrown by get()
+     */
+    template <class F>
+    auto Submit(F &&task) -> std::future<decltype(task())>
+    {
+        using R = decltype(task());
+        auto packaged = std::make_shared<std::packaged_task<R()>>(std::forward<F>(task));
+        std::future<R> result = packaged->get_future();
+        {
+            std::lock_guard<std::mutex> lockGuard(m_Mutex);
+            m_Tasks.push_back([packaged]() { (*packaged)(); });
+        }
+        m_CV.notify_one();
+        return result;
+    }
+
+    size_t Size() const noexcept { return m_Threads.size(); }
+
+private:
+    void Worker();
+
+    std::vector<std::thread> m_Threads;
+    std::deque<std::function<void()>> m_Tasks;
+    std::mutex m_Mutex;
+    std::condition_variable m_CV;
+    bool m_Stop = false;
+};
+
+} // end namespace helper
+} // end namespace adios2
+
+#endif /* ADIOS2_HELPER_ADIOSTHREADPOOL_H_ */
@@ -40,18 +40,21 @@ FileDrainOperation::FileDrainOperation(DrainOperation op, const std::string &fro
 
 void FileDrainer::AddOperation(FileDrainOperation &operation)
 {
-    std::lock_guard<std::mutex> lockGuard(operationsMutex);
-    operations.push(operation);
+    Enqueue(FileDrainOperation(operation));
 }
 
 void FileDrainer::AddOperation(DrainOperation op, const std::string &fromFileName,
                                const std::string &toFileName, size_t fromOffset, size_t toOffset,
                                size_t countBytes, const void *data)
 {
-    FileDrainOperation operation(op, fromFileName, toFileName, countBytes, fromOffset, toOffset,
-                                 data);
+    Enqueue(FileDrainOperation(op, fromFileName, toFileName, countBytes, fromOffset, toOffset,
+                               data));
+}
+
+void FileDrainer::Enqueue(FileDrainOperation &&operation)
+{
     std::lock_guard<std::mutex> lockGuard(operationsMutex);
-    operations.push(operation);
+    operations.push(std::move(operation));
 }
 
 void FileDrainer::AddOperationSeekEnd(const std::string &toFileName)
@@ -109,6 +112,12 @@ void FileDrainer::AddOperationDelete(const std::string &toFileName)
     AddOperation(DrainOperation::Delete, emptyStr, toFileName, 0, 0, 0);
 }
 
+void FileDrainer::AddOperationFence()
+{
+    std::string emptyStr;
+    AddOperation(DrainOperation::Fence, emptyStr, emptyStr, 0, 0, 0);
+}
+
 InputFile FileDrainer::GetFileForRead(const std::string &path)
 {
     auto it = m_InputFileMap.find(path);
@@ -33,14 +33,15 @@ enum class DrainOperation
     SeekEnd, // Seek to the end of target file toFileName (for future
              // copyAppend). Seeking to End of fromFile is not allowed
              // since another thread is writing to it
-    CopyAt,  // DO NOT USE: Copy countBytes from fromOffset to toOffset (does
-             // seek)
+    CopyAt,  // Copy countBytes from fromOffset to toOffset (does seek). The
+             // single thread drainer appends if toFile was opened for append
     Copy,    // Copy countBytes (without seek)
     WriteAt, // Write data from memory to toFileName directly at offset
     Write,   // Write data from memory to toFileName directly (without seek)
     Create,  // Open file for writing (creat) - only toFile
     Open,    // Open file for append - only toFile
-    Delete   // Remove a file on disk (file will be opened if not already opened)
+    Delete,  // Remove a file on disk (file will be opened if not already opened)
+    Fence    // Start later operations only after all earlier ones completed
 };
 
 struct FileDrainOperation
@@ -87,6 +88,10 @@ public:
 
     void AddOperationDelete(const std::string &toFileName);
 
+    /** Operations added after the fence start only after all operations added
+     * before it completed, even if they target different files */
+    void AddOperationFence();
+
     /** Create thread */
     virtual void Start() = 0;
 
@@ -119,6 +124,9 @@ protected:
 
     void CloseAll();
 
+    /** Queue an operation for the drain thread(s) */
+    virtual void Enqueue(FileDrainOperation &&operation);
+
     void Seek(InputFile &f, size_t offset, const std::string &path);
     void Seek(OutputFile &f, size_t offset, const std::string &path);
     void SeekEnd(OutputFile &f);
@@ -0,0 +1,624 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ *
+ * FileDrainerMultiThread.cpp
+ */
+
+#include "FileDrainerMultiThread.h"
+#include "adios2/helper/adiosLog.h"
+
+#include <algorithm> // std::min
+#include <cstdio>    // std::remove
+#include <cstring>   // strerror
+#include <errno.h>
+#include <fcntl.h>
+#include <future>
+#include <iostream>
+#include <sstream>
+#include <sys/stat.h>
+#include <sys/types.h>
+
+#ifndef _MSC_VER
+#include <unistd.h>
+#ifndef O_BINARY
+#define O_BINARY 0
+#endif
+#else
+#include <io.h>
+#define close _close
+#define open _open
+#define lseek(a, b, c) _lseeki64(a, b, c)
+#define write(a, b, c) _write(a, b, (unsigned int)c)
+#define read(a, b, c) _read(a, b, (unsigned int)c)
+#endif
+
+#if defined(__linux__)
+#include <sys/sendfile.h>
+#if defined(__GLIBC__) && ((__GLIBC__ > 2) || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 27))
+#define ADIOS2_DRAIN_COPY_FILE_RANGE
+#endif
+#endif
+
+/// \cond EXCLUDE_FROM_DOXYGEN
+#include <ios> //std::ios_base::failure
+/// \endcond
+
+#include "../../core/CoreTypes.h"
+
+#if defined(__has_feature)
+#if __has_feature(thread_sanitizer)
+#define NO_SANITIZE_THREAD __attribute__((no_sanitize("thread")))
+#endif
+#endif
+
+namespace adios2
+{
+namespace burstbuffer
+{
+
+namespace
+{
+size_t FileSize(int fd)
+{
+    struct stat fileStat;
+    if (fstat(fd, &fileStat) == -1)
+    {
+        return 0;
+    }
+    return static_cast<size_t>(fileStat.st_size);
+}
+} // end anonymous namespace
+
+void FileDrainerMultiThread::Stats::Add(const Stats &other)
+{
+    timeRead += other.timeRead;
+    timeWrite += other.timeWrite;
+    timeThrottle += other.timeThrottle;
+    timeWaitOnRead += other.timeWaitOnRead;
+    nReadBytesTasked += other.nReadBytesTasked;
+    nReadBytesSucc += other.nReadBytesSucc;
+    nWriteBytesTasked += other.nWriteBytesTasked;
+    nWriteBytesSucc += other.nWriteBytesSucc;
+    nKernelCopyBytes += other.nKernelCopyBytes;
+    nOperations += other.nOperations;
+}
+
+FileDrainerMultiThread::FileDrainerMultiThread() : FileDrainer(), m_KernelCopy(true) {}
+
+FileDrainerMultiThread::~FileDrainerMultiThread() { Join(); }
+
+void FileDrainerMultiThread::SetBufferSize(size_t bufferSizeBytes)
+{
+    bufferSize = bufferSizeBytes;
+}
+
+void FileDrainerMultiThread::SetThreads(size_t nThreads)
+{
+    m_NThreads = (nThreads > 0 ? nThreads : 1);
+}
+
+void FileDrainerMultiThread::SetBandwidth(double bytesPerSecond)
+{
+    m_Bandwidth = (bytesPerSecond > 0.0 ? bytesPerSecond : 0.0);
+}
+
+void FileDrainerMultiThread::Start()
+{
+    m_ThrottleNext = std::chrono::steady_clock::now();
+    for (size_t t = 0; t < m_NThreads; ++t)
+    {
+        m_Threads.emplace_back(&FileDrainerMultiThread::DrainThread, this);
+    }
+}
+
+void FileDrainerMultiThread::Finish()
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    finish = true;
+    m_Wakeup.notify_all();
+}
+
+void FileDrainerMultiThread::Join()
+{
+    if (m_Threads.empty())
+    {
+        return;
+    }
+    const auto tTotalStart = core::Now();
+    Finish();
+    for (auto &th : m_Threads)
+    {
+        th.join();
+    }
+    m_Threads.clear();
+    const core::Seconds timeJoin = core::Now() - tTotalStart;
+
+    const auto ts = core::Now();
+    for (auto &it : m_Lanes)
+    {
+        CloseLane(it.second);
+    }
+    m_Lanes.clear();
+    const core::Seconds timeClose = core::Now() - ts;
+
+    const Stats &s = m_Stats;
+    const bool shouldReport =
+        (m_Verbose || (s.nReadBytesTasked != s.nReadBytesSucc) ||
+         (s.nWriteBytesTasked != s.nWriteBytesSucc) || (s.timeWaitOnRead > 0.0));
+    if (shouldReport)
+    {
+#ifndef NO_SANITIZE_THREAD
+        std::cout << "Drain " << m_Rank << ": " << m_NThreads << " threads, "
+                  << "waited for threads to join = " << timeJoin.count()
+                  << " seconds, thread times read = " << s.timeRead
+                  << " write = " << s.timeWrite << " throttled = " << s.timeThrottle
+                  << " close = " << timeClose.count() << " seconds"
+                  << ". Operations = " << s.nOperations << ", max queue size = " << m_MaxQueueSize
+                  << ".";
+        if (s.nReadBytesTasked == s.nReadBytesSucc)
+        {
+            std::cout << " Read " << s.nReadBytesSucc << " bytes";
+        }
+        else
+        {
+            std::cout << " WARNING Read wanted = " << s.nReadBytesTasked
+                      << " but successfully read = " << s.nReadBytesSucc << " bytes.";
+        }
+        if (s.nWriteBytesTasked == s.nWriteBytesSucc)
+        {
+            std::cout << " Wrote " << s.nWriteBytesSucc << " bytes";
+        }
+        else
+        {
+            std::cout << " WARNING Write wanted = " << s.nWriteBytesTasked
+                      << " but successfully wrote = " << s.nWriteBytesSucc << " bytes.";
+        }
+        std::cout << " (" << s.nKernelCopyBytes << " bytes copied by the kernel)";
+        if (s.timeWaitOnRead > 0.0)
+        {
+            std::cout << " WARNING Read had to wait " << s.timeWaitOnRead
+                      << " seconds for the data to arrive on disk.";
+        }
+        std::cout << std::endl;
+#endif
+    }
+}
+
+void FileDrainerMultiThread::Enqueue(FileDrainOperation &&operation)
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    const uint64_t seq = m_NextSeq++;
+    if (operation.op == DrainOperation::Fence)
+    {
+        m_Fences.push_back(seq);
+        return;
+    }
+    m_Outstanding.insert(seq);
+    m_Lanes[operation.toFileName].ops.push_back({seq, std::move(operation)});
+    if (m_Outstanding.size() > m_MaxQueueSize)
+    {
+        m_MaxQueueSize = m_Outstanding.size();
+    }
+    m_Wakeup.notify_one();
+}
+
+FileDrainerMultiThread::Lane *FileDrainerMultiThread::NextLane()
+{
+    // pass the fences whose earlier operations all completed
+    while (!m_Fences.empty() &&
+           (m_Outstanding.empty() || *m_Outstanding.begin() > m_Fences.front()))
+    {
+        m_Fences.pop_front();
+    }
+    for (auto &it : m_Lanes)
+    {
+        Lane &lane = it.second;
+        if (!lane.busy && !lane.ops.empty() &&
+            (m_Fences.empty() || lane.ops.front().seq < m_Fences.front()))
+        {
+            return &lane;
+        }
+    }
+    return nullptr;
+}
+
+/*
+ * This function is running in m_NThreads separate threads from all other
+ * member function calls.
+ */
+void FileDrainerMultiThread::DrainThread()
+{
+    Stats stats;
+    std::vector<char> buffers[2]; // allocated at the first copy
+    std::unique_lock<std::mutex> lock(m_Mutex);
+    while (true)
+    {
+        Lane *lane = NextLane();
+        if (lane == nullptr)
+        {
+            if (finish && m_Outstanding.empty())
+            {
+                break;
+            }
+            m_Wakeup.wait(lock);
+            continue;
+        }
+        lane->busy = true;
+        Pending p = std::move(lane->ops.front());
+        lane->ops.pop_front();
+        lock.unlock();
+
+        Execute(*lane, p.fdo, buffers, stats);
+        ++stats.nOperations;
+
+        lock.lock();
+        lane->busy = false;
+        m_Outstanding.erase(p.seq);
+        // the lane is free and a fence may have passed
+        m_Wakeup.notify_all();
+    }
+    m_Stats.Add(stats);
+}
+
+void FileDrainerMultiThread::Execute(Lane &lane, FileDrainOperation &fdo,
+                                     std::vector<char> (&buffers)[2], Stats &stats)
+{
+    if (m_Verbose >= 2)
+    {
+#ifndef NO_SANITIZE_THREAD
+        // one write per line, the threads print concurrently
+        std::ostringstream ss;
+        ss << "Drain " << m_Rank << ": operation " << static_cast<int>(fdo.op) << " on "
+           << fdo.toFileName << " " << fdo.countBytes << " bytes";
+        if (!fdo.fromFileName.empty())
+        {
+            ss << " from " << fdo.fromFileName;
+        }
+        if (lane.failed)
+        {
+            ss << " -- Skip because of previous error";
+        }
+        ss << "\n";
+        std::cout << ss.str() << std::flush;
+#endif
+    }
+    if (lane.failed)
+    {
+        return;
+    }
+
+    auto ts = core::Now();
+    try
+    {
+        switch (fdo.op)
+        {
+        case DrainOperation::CopyAt:
+        case DrainOperation::Copy: {
+            OpenForWrite(lane, fdo.toFileName, fdo.op == DrainOperation::Copy);
+            Copy(lane, fdo, buffers, stats);
+            break;
+        }
+        case DrainOperation::SeekEnd: {
+            OpenForWrite(lane, fdo.toFileName, false);
+            lane.pos = FileSize(lane.fd);
+            break;
+        }
+        case DrainOperation::WriteAt:
+        case DrainOperation::Write: {
+            OpenForWrite(lane, fdo.toFileName, false);
+            if (fdo.op == DrainOperation::WriteAt)
+            {
+                lane.pos = fdo.toOffset;
+            }
+            stats.nWriteBytesTasked += fdo.countBytes;
+            stats.timeThrottle += Throttle(fdo.countBytes);
+            ts = core::Now();
+            WriteAt(lane.fd, fdo.dataToWrite.data(), fdo.countBytes, lane.pos, fdo.toFileName);
+            stats.timeWrite += core::Seconds(core::Now() - ts).count();
+            lane.pos += fdo.countBytes;
+            stats.nWriteBytesSucc += fdo.countBytes;
+            break;
+        }
+        case DrainOperation::Create:
+        case DrainOperation::Open: {
+            OpenForWrite(lane, fdo.toFileName, fdo.op == DrainOperation::Open);
+            stats.timeWrite += core::Seconds(core::Now() - ts).count();
+            break;
+        }
+        case DrainOperation::Delete: {
+            CloseLane(lane);
+            std::remove(fdo.toFileName.c_str());
+            break;
+        }
+        default:
+            break;
+        }
+    }
+    catch (std::ios_base::failure &e)
+    {
+        lane.failed = true;
+        helper::Log("BurstBuffer", "FileDrainerMultiThread", "DrainThread", std::string(e.what()),
+                    helper::FATALERROR);
+    }
+}
+
+void FileDrainerMultiThread::Copy(Lane &lane, FileDrainOperation &fdo,
+                                  std::vector<char> (&buffers)[2], Stats &stats)
+{
+    const int fdr = OpenForRead(lane, fdo.fromFileName);
+    size_t &readPos = lane.readPos[fdo.fromFileName];
+    const size_t fromOffset = (fdo.op == DrainOperation::CopyAt ? fdo.fromOffset : readPos);
+    const size_t toOffset = (fdo.op == DrainOperation::CopyAt ? fdo.toOffset : lane.pos);
+    const size_t count = fdo.countBytes;
+    stats.nReadBytesTasked += count;
+    stats.nWriteBytesTasked += count;
+
+    size_t done = KernelCopy(fdr, fromOffset, lane.fd, toOffset, count, stats);
+    stats.nKernelCopyBytes += done;
+
+    if (done < count)
+    {
+        /* Double buffering: read the next chunk while writing this one */
+        for (auto &b : buffers)
+        {
+            if (b.size() < bufferSize)
+            {
+                b.resize(bufferSize);
+            }
+        }
+        const std::string &path = fdo.fromFileName;
+        auto lf_Read = [this, fdr, &path](char *buffer, size_t n, size_t offset) {
+            const auto ts = core::Now();
+            const double waited = ReadAt(fdr, buffer, n, offset, path);
+            return std::make_pair(core::Seconds(core::Now() - ts).count(), waited);
+        };
+
+        int cur = 0;
+        size_t n = std::min(bufferSize, count - done);
+        std::future<std::pair<double, double>> next =
+            std::async(std::launch::async, lf_Read, buffers[cur].data(), n, fromOffset + done);
+        while (done < count)
+        {
+            const auto r = next.get();
+            stats.timeRead += r.first;
+            stats.timeWaitOnRead += r.second;
+            stats.nReadBytesSucc += n;
+
+            const size_t nextN = std::min(bufferSize, count - done - n);
+            if (nextN)
+            {
+                next = std::async(std::launch::async, lf_Read, buffers[1 - cur].data(), nextN,
+                                  fromOffset + done + n);
+            }
+
+            stats.timeThrottle += Throttle(n);
+            const auto ts = core::Now();
+            WriteAt(lane.fd, buffers[cur].data(), n, toOffset + done, fdo.toFileName);
+            stats.timeWrite += core::Seconds(core::Now() - ts).count();
+            stats.nWriteBytesSucc += n;
+
+            done += n;
+            n = nextN;
+            cur = 1 - cur;
+        }
+    }
+
+    if (fdo.op == DrainOperation::Copy)
+    {
+        readPos = fromOffset + count;
+    }
+    lane.pos = toOffset + count;
+}
+
+size_t FileDrainerMultiThread::KernelCopy(int fdr, size_t fromOffset, int fdw, size_t toOffset,
+                                          size_t count, Stats &stats)
+{
+    size_t done = 0;
+#if defined(__linux__)
+    /* only copy data already on disk, the kernel does not wait for the
+     * writer to catch up */
+    if (!m_KernelCopy.load(std::memory_order_relaxed) || FileSize(fdr) < fromOffset + count)
+    {
+        return 0;
+    }
+    // copy chunks so that the bandwidth limit can be applied
+    while (done < count)
+    {
+        const size_t n = std::min(bufferSize, count - done);
+        stats.timeThrottle += Throttle(n);
+        const auto ts = core::Now();
+        ssize_t r;
+#ifdef ADIOS2_DRAIN_COPY_FILE_RANGE
+        loff_t offIn = static_cast<loff_t>(fromOffset + done);
+        loff_t offOut = static_cast<loff_t>(toOffset + done);
+        r = copy_file_range(fdr, &offIn, fdw, &offOut, n, 0);
+        if (r < 0 && (errno == EXDEV || errno == ENOSYS || errno == EINVAL || errno == EOPNOTSUPP))
+#endif
+        {
+            // sendfile writes at the file position of the target
+            off_t offIn = static_cast<off_t>(fromOffset + done);
+            if (lseek(fdw, static_cast<off_t>(toOffset + done), SEEK_SET) == -1)
+            {
+                r = -1;
+            }
+            else
+            {
+                r = sendfile(fdw, fdr, &offIn, n);
+            }
+        }
+        stats.timeWrite += core::Seconds(core::Now() - ts).count();
+        if (r <= 0)
+        {
+            if (r < 0 && errno == EINTR)
+            {
+                continue;
+            }
+            // not supported between these file systems, use the buffers
+            m_KernelCopy.store(false, std::memory_order_relaxed);
+            break;
+        }
+        done += static_cast<size_t>(r);
+        stats.nReadBytesSucc += static_cast<size_t>(r);
+        stats.nWriteBytesSucc += static_cast<size_t>(r);
+    }
+#else
+    (void)fdr;
+    (void)fromOffset;
+    (void)fdw;
+    (void)toOffset;
+    (void)count;
+    (void)stats;
+#endif
+    return done;
+}
+
+int FileDrainerMultiThread::OpenForRead(Lane &lane, const std::string &path)
+{
+    auto it = lane.inputs.find(path);
+    if (it != lane.inputs.end())
+    {
+        return it->second;
+    }
+    const int fd = open(path.c_str(), O_RDONLY | O_BINARY);
+    if (fd == -1)
+    {
+        helper::Throw<std::ios_base::failure>("Toolkit", "BurstBuffer::FileDrainerMultiThread",
+                                              "OpenForRead",
+                                              "couldn't open file " + path + " for reading, " +
+                                                  std::string(strerror(errno)));
+    }
+    lane.inputs.emplace(path, fd);
+    return fd;
+}
+
+void FileDrainerMultiThread::OpenForWrite(Lane &lane, const std::string &path, bool append)
+{
+    if (lane.fd != -1)
+    {
+        return;
+    }
+    // no O_APPEND, all writes are positioned, append starts at the end
+    const int flags = O_WRONLY | O_CREAT | O_BINARY | (append ? 0 : O_TRUNC);
+    lane.fd = open(path.c_str(), flags, 0777);
+    if (lane.fd == -1)
+    {
+        helper::Throw<std::ios_base::failure>("Toolkit", "BurstBuffer::FileDrainerMultiThread",
+                                              "OpenForWrite",
+                                              "couldn't open file " + path + " for writing, " +
+                                                  std::string(strerror(errno)));
+    }
+    lane.pos = (append ? FileSize(lane.fd) : 0);
+}
+
+void FileDrainerMultiThread::CloseLane(Lane &lane)
+{
+    if (lane.fd != -1)
+    {
+        close(lane.fd);
+        lane.fd = -1;
+    }
+    for (auto &it : lane.inputs)
+    {
+        close(it.second);
+    }
+    lane.inputs.clear();
+    lane.readPos.clear();
+}
+
+double FileDrainerMultiThread::ReadAt(int fd, char *buffer, size_t count, size_t offset,
+                                      const std::string &path)
+{
+    double totalSlept = 0.0;
+    const double sleepUnit = 0.01; // seconds
+    while (count > 0)
+    {
+#ifndef _MSC_VER
+        const ssize_t r = pread(fd, buffer, count, static_cast<off_t>(offset));
+#else
+        auto r = (lseek(fd, offset, SEEK_SET) == -1 ? -1 : read(fd, buffer, count));
+#endif
+        if (r < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            helper::Throw<std::ios_base::failure>(
+                "Toolkit", "BurstBuffer::FileDrainerMultiThread", "ReadAt",
+                "couldn't read from file " + path + " offset = " + std::to_string(offset) +
+                    " count = " + std::to_string(count) + " bytes, " +
+                    std::string(strerror(errno)));
+        }
+        if (r == 0)
+        {
+            // the writer has not written this part yet
+            std::chrono::duration<double> d(sleepUnit);
+            std::this_thread::sleep_for(d);
+            totalSlept += sleepUnit;
+            continue;
+        }
+        buffer += r;
+        offset += static_cast<size_t>(r);
+        count -= static_cast<size_t>(r);
+    }
+    return totalSlept;
+}
+
+void FileDrainerMultiThread::WriteAt(int fd, const char *buffer, size_t count, size_t offset,
+                                     const std::string &path)
+{
+    while (count > 0)
+    {
+#ifndef _MSC_VER
+        const ssize_t r = pwrite(fd, buffer, count, static_cast<off_t>(offset));
+#else
+        auto r = (lseek(fd, offset, SEEK_SET) == -1 ? -1 : write(fd, buffer, count));
+#endif
+        if (r < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            helper::Throw<std::ios_base::failure>(
+                "Toolkit", "BurstBuffer::FileDrainerMultiThread", "WriteAt",
+                "couldn't write to file " + path + " offset = " + std::to_string(offset) +
+                    " count = " + std::to_string(count) + " bytes, " +
+                    std::string(strerror(errno)));
+        }
+        buffer += r;
+        offset += static_cast<size_t>(r);
+        count -= static_cast<size_t>(r);
+    }
+}
+
+double FileDrainerMultiThread::Throttle(size_t bytes)
+{
+    if (m_Bandwidth <= 0.0)
+    {
+        return 0.0;
+    }
+    std::chrono::steady_clock::time_point start;
+    {
+        std::lock_guard<std::mutex> lock(m_ThrottleMutex);
+        const auto now = std::chrono::steady_clock::now();
+        if (m_ThrottleNext < now)
+        {
+            m_ThrottleNext = now;
+        }
+        start = m_ThrottleNext;
+        m_ThrottleNext += std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+            std::chrono::duration<double>(static_cast<double>(bytes) / m_Bandwidth));
+    }
+    const auto now = std::chrono::steady_clock::now();
+    if (start <= now)
+    {
+        return 0.0;
+    }
+    std::this_thread::sleep_until(start);
+    return std::chrono::duration<double>(start - now).count();
+}
+
+} // end namespace burstbuffer
+} // end namespace adios2
@@ -0,0 +1,152 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ *
+ * FileDrainerMultiThread.h
+ *
+ * Drainer with a pool of threads. Operations on the same target file are
+ * executed in the order they were added, operations on different target
+ * files run concurrently. A copy overlaps reading the next chunk with
+ * writing the current one, or lets the kernel copy (copy_file_range,
+ * sendfile) when the source data is already complete on disk.
+ */
+
+#ifndef ADIOS2_TOOLKIT_BURSTBUFFER_FILEDRAINERMULTITHREAD_H_
+#define ADIOS2_TOOLKIT_BURSTBUFFER_FILEDRAINERMULTITHREAD_H_
+
+#include "adios2/toolkit/burstbuffer/FileDrainer.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <set>
+#include <thread>
+#include <vector>
+
+namespace adios2
+{
+namespace burstbuffer
+{
+
+class FileDrainerMultiThread : public FileDrainer
+{
+
+public:
+    static const size_t defaultBufferSize = 4194304; // 4MB
+    static const size_t defaultThreads = 4;
+
+    FileDrainerMultiThread();
+
+    ~FileDrainerMultiThread();
+
+    /** size of each of the two buffers of a copy, call before Start() */
+    void SetBufferSize(size_t bufferSizeBytes);
+
+    /** number of drain threads, call before Start() */
+    void SetThreads(size_t nThreads);
+
+    /** limit the total rate of all drain threads writing to the targets,
+     * in bytes per second, 0 means no limit */
+    void SetBandwidth(double bytesPerSecond);
+
+    /** Create the threads. They idle if there are no operations given.
+     *  Finish() will complete all work then join the threads */
+    void Start();
+
+    /** Tell threads to terminate when all draining has finished. */
+    void Finish();
+
+    /** Join the threads. Main thread will block until they terminate */
+    void Join();
+
+protected:
+    void Enqueue(FileDrainOperation &&operation);
+
+private:
+    struct Pending
+    {
+        uint64_t seq;
+        FileDrainOperation fdo;
+    };
+
+    /** The queue and the open files of one target file. Only the thread
+     * that marked the lane busy touches the files and positions */
+    struct Lane
+    {
+        std::deque<Pending> ops;
+        bool busy = false;
+        bool failed = false;
+        int fd = -1;
+        size_t pos = 0;                        // position of the Write operations
+        std::map<std::string, int> inputs;     // source files of copies
+        std::map<std::string, size_t> readPos; // positions of the Copy operations
+    };
+
+    struct Stats
+    {
+        double timeRead = 0.0;  // includes time waiting for the data to arrive
+        double timeWrite = 0.0; // includes time of kernel copies
+        double timeThrottle = 0.0;
+        double timeWaitOnRead = 0.0;
+        size_t nReadBytesTasked = 0;
+        size_t nReadBytesSucc = 0;
+        size_t nWriteBytesTasked = 0;
+        size_t nWriteBytesSucc = 0;
+        size_t nKernelCopyBytes = 0;
+        size_t nOperations = 0;
+        void Add(const Stats &other);
+    };
+
+    size_t bufferSize = defaultBufferSize;
+    size_t m_NThreads = defaultThreads;
+    double m_Bandwidth = 0.0;
+
+    std::vector<std::thread> m_Threads;
+    std::mutex m_Mutex; // protects everything below until m_Stats
+    std::condition_variable m_Wakeup;
+    std::map<std::string, Lane> m_Lanes;
+    /** sequence number of every operation added but not completed yet */
+    std::set<uint64_t> m_Outstanding;
+    /** sequence numbers of fences not passed yet */
+    std::deque<uint64_t> m_Fences;
+    uint64_t m_NextSeq = 0;
+    size_t m_MaxQueueSize = 0;
+    bool finish = false;
+    Stats m_Stats;
+
+    std::mutex m_ThrottleMutex;
+    std::chrono::steady_clock::time_point m_ThrottleNext;
+
+    /** cleared once the file systems turn out not to support it */
+    std::atomic<bool> m_KernelCopy;
+
+    void DrainThread(); // the thread function
+    /** a lane with an operation that may start now, nullptr if none */
+    Lane *NextLane();
+    void Execute(Lane &lane, FileDrainOperation &fdo, std::vector<char> (&buffers)[2],
+                 Stats &stats);
+    void Copy(Lane &lane, FileDrainOperation &fdo, std::vector<char> (&buffers)[2],
+              Stats &stats);
+    /** copy by the kernel, returns the number of bytes copied which is less
+     * than count if the rest has to go through the buffers */
+    size_t KernelCopy(int fdr, size_t fromOffset, int fdw, size_t toOffset, size_t count,
+                      Stats &stats);
+
+    int OpenForRead(Lane &lane, const std::string &path);
+    void OpenForWrite(Lane &lane, const std::string &path, bool append);
+    void CloseLane(Lane &lane);
+
+    /** Read exactly count bytes at offset, waiting for the data to arrive.
+     * Returns the seconds spent waiting */
+    double ReadAt(int fd, char *buffer, size_t count, size_t offset, const std::string &path);
+    void WriteAt(int fd, const char *buffer, size_t count, size_t offset, const std::string &path);
+    /** block until bytes more may be written under the bandwidth limit,
+     * returns the seconds slept */
+    double Throttle(size_t bytes);
+};
+
+} // end namespace burstbuffer
+} // end namespace adios2
+
+#endif /* ADIOS2_TOOLKIT_BURSTBUFFER_FILEDRAINERMULTITHREAD_H_ */
@@ -3,9 +3,11 @@
 
 #include "Expression.h"
 #include "Function.h"
+#include "FusedExpression.h"
 #include "adios2/helper/adiosLog.h"
 #include "parser/ASTDriver.h"
 
+#include <algorithm>
 #include <functional>
 
 namespace adios2
@@ -166,6 +168,8 @@ Expression::Expression(std::string string_exp)
 
 std::vector<std::string> Expression::VariableNameList() { return m_Expr.VariableNameList(); }
 
+bool Expression::SelectionHalo(size_t &halo) { return m_Expr.SelectionHalo(halo); }
+
 Dims Expression::GetShape() { return m_Shape; }
 
 Dims Expression::GetStart() { return m_Start; }
@@ -233,6 +237,32 @@ std::vector<std::string> ExpressionTree::VariableNameList()
     return var_list;
 }
 
+bool ExpressionTree::SelectionHalo(size_t &halo)
+{
+    size_t subHalo = 0;
+    for (auto subexp : sub_exprs)
+    {
+        if (!std::get<2>(subexp))
+            continue;
+        size_t h = 0;
+        if (!std::get<0>(subexp).SelectionHalo(h))
+            return false;
+        subHalo = std::max(subHalo, h);
+    }
+    switch (detail.operation)
+    {
+    case adios2::detail::ExpressionOperator::OP_INDEX:
+        return false;
+    case adios2::detail::ExpressionOperator::OP_CURL:
+        // central differences use one neighbour on each side
+        halo = subHalo + 1;
+        return true;
+    default:
+        halo = subHalo;
+        return true;
+    }
+}
+
 void ExpressionTree::print()
 {
     std::cout << "Print Expression:" << std::endl;
@@ -343,6 +373,16 @@ std::vector<DerivedData>
 ExpressionTree::ApplyExpression(DataType type, size_t numBlocks,
                                 std::map<std::string, std::vector<DerivedData>> nameToData)
 {
+    // element-wise subtrees are computed in one pass over each block
+    if ((numBlocks > 0) && FusedExpression::IsFusible(*this))
+    {
+        std::map<std::string, DataType> nameToType;
+        for (auto &varData : nameToData)
+            nameToType[varData.first] = varData.second[0].Type;
+        FusedExpression fused(*this, nameToType);
+        return fused.ApplyExpression(numBlocks, nameToData);
+    }
+
     // create operands for the computation function
     // exprData[0] = list of void* data for block 0 for each variable
     std::vector<std::vector<DerivedData>> exprData(numBlocks);
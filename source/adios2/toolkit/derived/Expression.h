@@ -74,6 +74,7 @@ public:
     void add_child(std::string var);
 
     std::vector<std::string> VariableNameList();
+    bool SelectionHalo(size_t &halo);
     std::tuple<Dims, Dims, Dims>
     GetDims(std::map<std::string, std::tuple<Dims, Dims, Dims>> NameToDims);
     DataType GetType(std::map<std::string, DataType> NameToType);
@@ -107,6 +108,10 @@ public:
     GetDims(std::map<std::string, std::tuple<Dims, Dims, Dims>> NameToDims);
     void SetDims(std::map<std::string, std::tuple<Dims, Dims, Dims>> NameToDims);
     std::vector<std::string> VariableNameList();
+    /* Number of neighbours in each direction the expression needs to compute
+     * one element (e.g. 1 for curl). Returns false if the expression can only
+     * be computed on whole blocks. */
+    bool SelectionHalo(size_t &halo);
     std::vector<DerivedData>
     ApplyExpression(DataType type, size_t numBlocks,
                     std::map<std::string, std::vector<DerivedData>> nameToData);
@@ -0,0 +1,360 @@
+#ifndef ADIOS2_DERIVED_FusedExpression_CPP_
+#define ADIOS2_DERIVED_FusedExpression_CPP_
+
+#include "FusedExpression.h"
+#include "Function.h"
+#include "adios2/helper/adiosFunctions.h"
+#include "adios2/helper/adiosLog.h"
+#include <adios2-perfstubs-interface.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+
+namespace adios2
+{
+namespace detail
+{
+/* Kernels on one tile. Each operator gets its own plain loop so that the
+ * compiler can vectorize it, the order of the operations is the same as in
+ * the node by node functions (Function.cpp) so the results are identical. */
+
+template <class T>
+void FusedAdd(T *out, const std::vector<const void *> &args, size_t n)
+{
+    const T *a = static_cast<const T *>(args[0]);
+    for (size_t i = 0; i < n; ++i)
+        out[i] = (T)0 + a[i];
+    for (size_t k = 1; k < args.size(); ++k)
+    {
+        const T *b = static_cast<const T *>(args[k]);
+        for (size_t i = 0; i < n; ++i)
+            out[i] += b[i];
+    }
+}
+
+template <class T>
+void FusedSubtract(T *out, const std::vector<const void *> &args, size_t n)
+{
+    for (size_t i = 0; i < n; ++i)
+        out[i] = (T)0;
+    for (size_t k = 1; k < args.size(); ++k)
+    {
+        const T *b = static_cast<const T *>(args[k]);
+        for (size_t i = 0; i < n; ++i)
+            out[i] += b[i];
+    }
+    const T *a = static_cast<const T *>(args[0]);
+    for (size_t i = 0; i < n; ++i)
+        out[i] = a[i] - out[i];
+}
+
+template <class T>
+void FusedMult(T *out, const std::vector<const void *> &args, size_t n)
+{
+    const T *a = static_cast<const T *>(args[0]);
+    for (size_t i = 0; i < n; ++i)
+        out[i] = (T)1 * a[i];
+    for (size_t k = 1; k < args.size(); ++k)
+    {
+        const T *b = static_cast<const T *>(args[k]);
+        for (size_t i = 0; i < n; ++i)
+            out[i] *= b[i];
+    }
+}
+
+template <class T>
+void FusedDiv(T *out, const std::vector<const void *> &args, size_t n)
+{
+    for (size_t i = 0; i < n; ++i)
+        out[i] = (T)1;
+    for (size_t k = 1; k < args.size(); ++k)
+    {
+        const T *b = static_cast<const T *>(args[k]);
+        for (size_t i = 0; i < n; ++i)
+            out[i] *= b[i];
+    }
+    const T *a = static_cast<const T *>(args[0]);
+    for (size_t i = 0; i < n; ++i)
+        out[i] = a[i] / out[i];
+}
+
+template <class T>
+void FusedMagnitude(T *out, const std::vector<const void *> &args, size_t n)
+{
+    const T *a = static_cast<const T *>(args[0]);
+    for (size_t i = 0; i < n; ++i)
+        out[i] = (T)0 + a[i] * a[i];
+    for (size_t k = 1; k < args.size(); ++k)
+    {
+        const T *b = static_cast<const T *>(args[k]);
+        for (size_t i = 0; i < n; ++i)
+            out[i] += b[i] * b[i];
+    }
+    for (size_t i = 0; i < n; ++i)
+        out[i] = (T)std::sqrt(out[i]);
+}
+
+template <class T, class TOut>
+void FusedUnary(ExpressionOperator op, TOut *out, const T *a, size_t n)
+{
+    switch (op)
+    {
+    case ExpressionOperator::OP_SQRT:
+        for (size_t i = 0; i < n; ++i)
+            out[i] = std::sqrt(a[i]);
+        break;
+    case ExpressionOperator::OP_POW:
+        for (size_t i = 0; i < n; ++i)
+            out[i] = std::pow(a[i], 2);
+        break;
+    case ExpressionOperator::OP_SIN:
+        for (size_t i = 0; i < n; ++i)
+            out[i] = std::sin(a[i]);
+        break;
+    case ExpressionOperator::OP_COS:
+        for (size_t i = 0; i < n; ++i)
+            out[i] = std::cos(a[i]);
+        break;
+    case ExpressionOperator::OP_TAN:
+        for (size_t i = 0; i < n; ++i)
+            out[i] = std::tan(a[i]);
+        break;
+    case ExpressionOperator::OP_ASIN:
+        for (size_t i = 0; i < n; ++i)
+            out[i] = std::asin(a[i]);
+        break;
+    case ExpressionOperator::OP_ACOS:
+        for (size_t i = 0; i < n; ++i)
+            out[i] = std::acos(a[i]);
+        break;
+    case ExpressionOperator::OP_ATAN:
+        for (size_t i = 0; i < n; ++i)
+            out[i] = std::atan(a[i]);
+        break;
+    default:
+        break;
+    }
+}
+
+inline bool IsFusedUnaryOp(ExpressionOperator op)
+{
+    return (op == ExpressionOperator::OP_SQRT) || (op == ExpressionOperator::OP_POW) ||
+           (op == ExpressionOperator::OP_SIN) || (op == ExpressionOperator::OP_COS) ||
+           (op == ExpressionOperator::OP_TAN) || (op == ExpressionOperator::OP_ASIN) ||
+           (op == ExpressionOperator::OP_ACOS) || (op == ExpressionOperator::OP_ATAN);
+}
+}
+
+namespace derived
+{
+bool FusedExpression::IsFusible(const ExpressionTree &expr)
+{
+    const size_t nArgs = expr.sub_exprs.size();
+    switch (expr.detail.operation)
+    {
+    case adios2::detail::ExpressionOperator::OP_ADD:
+    case adios2::detail::ExpressionOperator::OP_MAGN:
+        // one operand means reducing over the last dimension
+        if (nArgs < 2)
+            return false;
+        break;
+    case adios2::detail::ExpressionOperator::OP_SUBTRACT:
+    case adios2::detail::ExpressionOperator::OP_MULT:
+    case adios2::detail::ExpressionOperator::OP_DIV:
+        if (nArgs < 1)
+            return false;
+        break;
+    default:
+        if (!adios2::detail::IsFusedUnaryOp(expr.detail.operation) || (nArgs != 1))
+            return false;
+    }
+
+    for (auto &subexp : expr.sub_exprs)
+    {
+        if (std::get<2>(subexp) && !IsFusible(std::get<0>(subexp)))
+            return false;
+    }
+    return true;
+}
+
+FusedExpression::FusedExpression(const ExpressionTree &expr,
+                                 const std::map<std::string, DataType> &nameToType)
+{
+    std::map<std::string, size_t> leafIndex;
+    AddNode(expr, nameToType, leafIndex);
+}
+
+size_t FusedExpression::AddNode(const ExpressionTree &expr,
+                                const std::map<std::string, DataType> &nameToType,
+                                std::map<std::string, size_t> &leafIndex)
+{
+    Node node;
+    node.Op = expr.detail.operation;
+    for (auto &subexp : expr.sub_exprs)
+    {
+        if (std::get<2>(subexp))
+        {
+            node.Args.push_back(AddNode(std::get<0>(subexp), nameToType, leafIndex));
+            continue;
+        }
+
+        // every variable is one leaf, however often it is used
+        const std::string &varName = std::get<1>(subexp);
+        auto it = leafIndex.find(varName);
+        if (it == leafIndex.end())
+        {
+            Node leaf;
+            leaf.Op = adios2::detail::ExpressionOperator::OP_NULL;
+            leaf.Type = nameToType.at(varName);
+            leaf.VarName = varName;
+            m_Nodes.push_back(leaf);
+            it = leafIndex.insert({varName, m_Nodes.size() - 1}).first;
+        }
+        node.Args.push_back(it->second);
+    }
+
+    const DataType argType = m_Nodes[node.Args[0]].Type;
+    for (size_t arg : node.Args)
+        if (m_Nodes[arg].Type != argType)
+            helper::Throw<std::invalid_argument>("Derived", "FusedExpression", "AddNode",
+                                                 "Derived expression operators are not the same");
+    if (adios2::detail::IsFusedUnaryOp(node.Op))
+        node.Type = FloatTypeFunc(argType);
+    else
+        node.Type = argType;
+
+    m_Nodes.push_back(node);
+    return m_Nodes.size() - 1;
+}
+
+void FusedExpression::ComputeTile(const Node &node, void *out,
+                                  const std::vector<const void *> &args, size_t n) const
+{
+    const DataType argType = m_Nodes[node.Args[0]].Type;
+    if (adios2::detail::IsFusedUnaryOp(node.Op))
+    {
+        if (argType == DataType::LongDouble)
+        {
+            adios2::detail::FusedUnary(node.Op, static_cast<long double *>(out),
+                                       static_cast<const long double *>(args[0]), n);
+            return;
+        }
+#define declare_type_unary(T)                                                                      \
+    if (argType == helper::GetDataType<T>())                                                       \
+    {                                                                                              \
+        adios2::detail::FusedUnary(node.Op, static_cast<double *>(out),                            \
+                                   static_cast<const T *>(args[0]), n);                            \
+        return;                                                                                    \
+    }
+        ADIOS2_FOREACH_ATTRIBUTE_PRIMITIVE_STDTYPE_1ARG(declare_type_unary)
+#undef declare_type_unary
+    }
+    else
+    {
+#define declare_type_op(T)                                                                         \
+    if (argType == helper::GetDataType<T>())                                                       \
+    {                                                                                              \
+        T *tOut = static_cast<T *>(out);                                                           \
+        switch (node.Op)                                                                           \
+        {                                                                                          \
+        case adios2::detail::ExpressionOperator::OP_ADD:                                           \
+            adios2::detail::FusedAdd(tOut, args, n);                                               \
+            break;                                                                                 \
+        case adios2::detail::ExpressionOperator::OP_SUBTRACT:                                      \
+            adios2::detail::FusedSubtract(tOut, args, n);                                          \
+            break;                                                                                 \
+        case adios2::detail::ExpressionOperator::OP_MULT:                                          \
+            adios2::detail::FusedMult(tOut, args, n);                                              \
+            break;                                                                                 \
+        case adios2::detail::ExpressionOperator::OP_DIV:                                           \
+            adios2::detail::FusedDiv(tOut, args, n);                                               \
+            break;                                                                                 \
+        case adios2::detail::ExpressionOperator::OP_MAGN:                                          \
+            adios2::detail::FusedMagnitude(tOut, args, n);                                         \
+            break;                                                                                 \
+        default:                                                                                   \
+            break;                                                                                 \
+        }                                                                                          \
+        return;                                                                                    \
+    }
+        ADIOS2_FOREACH_ATTRIBUTE_PRIMITIVE_STDTYPE_1ARG(declare_type_op)
+#undef declare_type_op
+    }
+    helper::Throw<std::invalid_argument>("Derived", "FusedExpression", "ComputeTile",
+                                         "Invalid variable types");
+}
+
+std::vector<DerivedData> FusedExpression::ApplyExpression(
+    size_t numBlocks, const std::map<std::string, std::vector<DerivedData>> &nameToData) const
+{
+    PERFSTUBS_SCOPED_TIMER("derived::FusedExpression::ApplyExpression");
+    const size_t nNodes = m_Nodes.size();
+    const Node &root = m_Nodes.back();
+    const size_t outElemSize = helper::GetDataTypeSize(root.Type);
+
+    // one tile per operator node, the root writes into the output
+    std::vector<std::vector<char>> tiles(nNodes);
+    std::vector<size_t> elemSize(nNodes);
+    for (size_t k = 0; k < nNodes; ++k)
+    {
+        elemSize[k] = helper::GetDataTypeSize(m_Nodes[k].Type);
+        if (!m_Nodes[k].Args.empty() && (k + 1 < nNodes))
+            tiles[k].resize(FusedTileSize * elemSize[k]);
+    }
+
+    std::vector<DerivedData> outputData(numBlocks);
+    std::vector<const void *> slots(nNodes);
+    std::vector<const void *> args;
+    for (size_t blk = 0; blk < numBlocks; ++blk)
+    {
+        const DerivedData *first = nullptr;
+        std::vector<const char *> leafData(nNodes, nullptr);
+        for (size_t k = 0; k < nNodes; ++k)
+        {
+            if (!m_Nodes[k].Args.empty())
+                continue;
+            const DerivedData &data = nameToData.at(m_Nodes[k].VarName)[blk];
+            leafData[k] = static_cast<const char *>(data.Data);
+            if (first == nullptr)
+                first = &data;
+        }
+
+        const size_t dataSize = helper::GetTotalSize(first->Count);
+        char *outValues = (char *)malloc(dataSize * outElemSize);
+        if (outValues == nullptr && dataSize > 0)
+        {
+            helper::Throw<std::invalid_argument>(
+                "Derived", "FusedExpression", "ApplyExpression",
+                "Error allocating memory for the derived variable");
+        }
+
+        for (size_t offset = 0; offset < dataSize; offset += FusedTileSize)
+        {
+            const size_t n = std::min(FusedTileSize, dataSize - offset);
+            for (size_t k = 0; k < nNodes; ++k)
+            {
+                const Node &node = m_Nodes[k];
+                if (node.Args.empty())
+                {
+                    slots[k] = leafData[k] + offset * elemSize[k];
+                    continue;
+                }
+
+                void *out = (k + 1 == nNodes) ? outValues + offset * outElemSize
+                                              : static_cast<void *>(tiles[k].data());
+                args.clear();
+                for (size_t arg : node.Args)
+                    args.push_back(slots[arg]);
+                ComputeTile(node, out, args, n);
+                slots[k] = out;
+            }
+        }
+        outputData[blk] = DerivedData({(void *)outValues, first->Start, first->Count, root.Type});
+    }
+    return outputData;
+}
+
+}
+}
+#endif
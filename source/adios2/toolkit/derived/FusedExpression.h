@@ -0,0 +1,60 @@
+#ifndef ADIOS2_DERIVED_FusedExpression_H_
+#define ADIOS2_DERIVED_FusedExpression_H_
+
+#include "DerivedData.h"
+#include "Expression.h"
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace adios2
+{
+namespace derived
+{
+/*
+ A Note on FusedExpression:
+ - Evaluates an expression tree of element-wise operators (+, -, *, /, sqrt, pow,
+   trigonometric functions, magnitude of separate components) in a single pass
+   over each block, instead of one pass and one full size temporary per operator
+ - The block is processed in tiles of FusedTileSize elements, every operator node
+   keeps only one tile of its result, the root writes straight into the output
+ - Operators that are not element-wise (cross, curl, indexing, add/magnitude
+   over the last dimension) are evaluated node by node by ExpressionTree
+ - Each node computes in the type ExpressionTree::GetType gives it
+ */
+constexpr size_t FusedTileSize = 1024;
+
+class FusedExpression
+{
+public:
+    static bool IsFusible(const ExpressionTree &expr);
+
+    FusedExpression(const ExpressionTree &expr, const std::map<std::string, DataType> &nameToType);
+
+    DataType GetType() const { return m_Nodes.back().Type; }
+
+    std::vector<DerivedData>
+    ApplyExpression(size_t numBlocks,
+                    const std::map<std::string, std::vector<DerivedData>> &nameToData) const;
+
+private:
+    struct Node
+    {
+        adios2::detail::ExpressionOperator Op;
+        DataType Type;
+        std::vector<size_t> Args; // indices of the operand nodes
+        std::string VarName;      // leaf nodes only
+    };
+    // operands come before the nodes using them, the root is last
+    std::vector<Node> m_Nodes;
+
+    size_t AddNode(const ExpressionTree &expr, const std::map<std::string, DataType> &nameToType,
+                   std::map<std::string, size_t> &leafIndex);
+    void ComputeTile(const Node &node, void *out, const std::vector<const void *> &args,
+                     size_t n) const;
+};
+
+}
+}
+#endif
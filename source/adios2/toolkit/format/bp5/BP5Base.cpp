@@ -115,6 +115,69 @@ static FMField MetaArrayRecOperatorMM16List[] = {
                        FMOffset(BP5Base::MetaArrayRecOperator *, DataBlockSize)},
     {"MinMax", "char[32][BlockCount]", 1, FMOffset(BP5Base::MetaArrayRecOperatorMM *, MinMax)},
     {NULL, NULL, 0, 0}};
+#define SUBBLOCK_FIELD_ENTRIES(RecType, MinMaxType)                                                \
+    {"SubBlockCount", "integer", sizeof(size_t),                                                   \
+     FMOffset(BP5Base::RecType *, SubBlocks.SubBlockCount)},                                       \
+        {"SubBlockDiv", "integer[DBCount]", sizeof(size_t),                                        \
+         FMOffset(BP5Base::RecType *, SubBlocks.SubBlockDiv)},                                     \
+        {"SubBlockMinMax", MinMaxType, 1, FMOffset(BP5Base::RecType *, SubBlocks.SubBlockMinMax)},
+
+static FMField MetaArrayRecMMSub1List[] = {
+    BASE_FIELD_ENTRIES{"MinMax", "char[2][BlockCount]", 1,
+                       FMOffset(BP5Base::MetaArrayRecMMSub *, MinMax)},
+    SUBBLOCK_FIELD_ENTRIES(MetaArrayRecMMSub, "char[2][SubBlockCount]"){NULL, NULL, 0, 0}};
+
+static FMField MetaArrayRecOperatorMMSub1List[] = {
+    BASE_FIELD_ENTRIES{"DataBlockSize", "integer[BlockCount]", sizeof(size_t),
+                       FMOffset(BP5Base::MetaArrayRecOperatorMMSub *, DataBlockSize)},
+    {"MinMax", "char[2][BlockCount]", 1, FMOffset(BP5Base::MetaArrayRecOperatorMMSub *, MinMax)},
+    SUBBLOCK_FIELD_ENTRIES(MetaArrayRecOperatorMMSub, "char[2][SubBlockCount]"){NULL, NULL, 0,
+                                                                                  0}};
+static FMField MetaArrayRecMMSub2List[] = {
+    BASE_FIELD_ENTRIES{"MinMax", "char[4][BlockCount]", 1,
+                       FMOffset(BP5Base::MetaArrayRecMMSub *, MinMax)},
+    SUBBLOCK_FIELD_ENTRIES(MetaArrayRecMMSub, "char[4][SubBlockCount]"){NULL, NULL, 0, 0}};
+
+static FMField MetaArrayRecOperatorMMSub2List[] = {
+    BASE_FIELD_ENTRIES{"DataBlockSize", "integer[BlockCount]", sizeof(size_t),
+                       FMOffset(BP5Base::MetaArrayRecOperatorMMSub *, DataBlockSize)},
+    {"MinMax", "char[4][BlockCount]", 1, FMOffset(BP5Base::MetaArrayRecOperatorMMSub *, MinMax)},
+    SUBBLOCK_FIELD_ENTRIES(MetaArrayRecOperatorMMSub, "char[4][SubBlockCount]"){NULL, NULL, 0,
+                                                                                  0}};
+static FMField MetaArrayRecMMSub4List[] = {
+    BASE_FIELD_ENTRIES{"MinMax", "char[8][BlockCount]", 1,
+                       FMOffset(BP5Base::MetaArrayRecMMSub *, MinMax)},
+    SUBBLOCK_FIELD_ENTRIES(MetaArrayRecMMSub, "char[8][SubBlockCount]"){NULL, NULL, 0, 0}};
+
+static FMField MetaArrayRecOperatorMMSub4List[] = {
+    BASE_FIELD_ENTRIES{"DataBlockSize", "integer[BlockCount]", sizeof(size_t),
+                       FMOffset(BP5Base::MetaArrayRecOperatorMMSub *, DataBlockSize)},
+    {"MinMax", "char[8][BlockCount]", 1, FMOffset(BP5Base::MetaArrayRecOperatorMMSub *, MinMax)},
+    SUBBLOCK_FIELD_ENTRIES(MetaArrayRecOperatorMMSub, "char[8][SubBlockCount]"){NULL, NULL, 0,
+                                                                                  0}};
+static FMField MetaArrayRecMMSub8List[] = {
+    BASE_FIELD_ENTRIES{"MinMax", "char[16][BlockCount]", 1,
+                       FMOffset(BP5Base::MetaArrayRecMMSub *, MinMax)},
+    SUBBLOCK_FIELD_ENTRIES(MetaArrayRecMMSub, "char[16][SubBlockCount]"){NULL, NULL, 0, 0}};
+
+static FMField MetaArrayRecOperatorMMSub8List[] = {
+    BASE_FIELD_ENTRIES{"DataBlockSize", "integer[BlockCount]", sizeof(size_t),
+                       FMOffset(BP5Base::MetaArrayRecOperatorMMSub *, DataBlockSize)},
+    {"MinMax", "char[16][BlockCount]", 1, FMOffset(BP5Base::MetaArrayRecOperatorMMSub *, MinMax)},
+    SUBBLOCK_FIELD_ENTRIES(MetaArrayRecOperatorMMSub, "char[16][SubBlockCount]"){NULL, NULL, 0,
+                                                                                  0}};
+static FMField MetaArrayRecMMSub16List[] = {
+    BASE_FIELD_ENTRIES{"MinMax", "char[32][BlockCount]", 1,
+                       FMOffset(BP5Base::MetaArrayRecMMSub *, MinMax)},
+    SUBBLOCK_FIELD_ENTRIES(MetaArrayRecMMSub, "char[32][SubBlockCount]"){NULL, NULL, 0, 0}};
+
+static FMField MetaArrayRecOperatorMMSub16List[] = {
+    BASE_FIELD_ENTRIES{"DataBlockSize", "integer[BlockCount]", sizeof(size_t),
+                       FMOffset(BP5Base::MetaArrayRecOperatorMMSub *, DataBlockSize)},
+    {"MinMax", "char[32][BlockCount]", 1, FMOffset(BP5Base::MetaArrayRecOperatorMMSub *, MinMax)},
+    SUBBLOCK_FIELD_ENTRIES(MetaArrayRecOperatorMMSub, "char[32][SubBlockCount]"){NULL, NULL, 0,
+                                                                                  0}};
+#undef SUBBLOCK_FIELD_ENTRIES
 #undef BASE_FIELD_ENTRIES
 
 BP5Base::BP5Base()
@@ -131,6 +194,16 @@ BP5Base::BP5Base()
     MetaArrayRecOperatorMM8ListPtr = &MetaArrayRecOperatorMM8List[0];
     MetaArrayRecMM16ListPtr = &MetaArrayRecMM16List[0];
     MetaArrayRecOperatorMM16ListPtr = &MetaArrayRecOperatorMM16List[0];
+    MetaArrayRecMMSub1ListPtr = &MetaArrayRecMMSub1List[0];
+    MetaArrayRecOperatorMMSub1ListPtr = &MetaArrayRecOperatorMMSub1List[0];
+    MetaArrayRecMMSub2ListPtr = &MetaArrayRecMMSub2List[0];
+    MetaArrayRecOperatorMMSub2ListPtr = &MetaArrayRecOperatorMMSub2List[0];
+    MetaArrayRecMMSub4ListPtr = &MetaArrayRecMMSub4List[0];
+    MetaArrayRecOperatorMMSub4ListPtr = &MetaArrayRecOperatorMMSub4List[0];
+    MetaArrayRecMMSub8ListPtr = &MetaArrayRecMMSub8List[0];
+    MetaArrayRecOperatorMMSub8ListPtr = &MetaArrayRecOperatorMMSub8List[0];
+    MetaArrayRecMMSub16ListPtr = &MetaArrayRecMMSub16List[0];
+    MetaArrayRecOperatorMMSub16ListPtr = &MetaArrayRecOperatorMMSub16List[0];
 }
 }
 }
@@ -70,6 +70,29 @@ public:
         char *MinMax;          // char[TYPESIZE][BlockCount]  varies by type
     } MetaArrayRecOperatorMM;
 
+    /* min/max of the sub-blocks of each block, follows MinMax */
+    struct MetaSubBlockStats
+    {
+        size_t SubBlockCount;  // sub-blocks of all blocks
+        size_t *SubBlockDiv;   // Per-block divisions of each dimension [DBCount]
+        char *SubBlockMinMax;  // char[TYPESIZE][SubBlockCount]  varies by type
+    };
+
+    typedef struct _MetaArrayRecMMSub
+    {
+        BASE_FIELDS
+        char *MinMax; // char[TYPESIZE][BlockCount]  varies by type
+        struct MetaSubBlockStats SubBlocks;
+    } MetaArrayRecMMSub;
+
+    typedef struct _MetaArrayRecOperatorMMSub
+    {
+        BASE_FIELDS
+        size_t *DataBlockSize; // Per-block Lengths [BlockCount]
+        char *MinMax;          // char[TYPESIZE][BlockCount]  varies by type
+        struct MetaSubBlockStats SubBlocks;
+    } MetaArrayRecOperatorMMSub;
+
 #undef BASE_FIELDS
 
     struct BP5MetadataInfoStruct
@@ -163,6 +186,16 @@ public:
     FMField *MetaArrayRecOperatorMM8ListPtr;
     FMField *MetaArrayRecMM16ListPtr;
     FMField *MetaArrayRecOperatorMM16ListPtr;
+    FMField *MetaArrayRecMMSub1ListPtr;
+    FMField *MetaArrayRecOperatorMMSub1ListPtr;
+    FMField *MetaArrayRecMMSub2ListPtr;
+    FMField *MetaArrayRecOperatorMMSub2ListPtr;
+    FMField *MetaArrayRecMMSub4ListPtr;
+    FMField *MetaArrayRecOperatorMMSub4ListPtr;
+    FMField *MetaArrayRecMMSub8ListPtr;
+    FMField *MetaArrayRecOperatorMMSub8ListPtr;
+    FMField *MetaArrayRecMMSub16ListPtr;
+    FMField *MetaArrayRecOperatorMMSub16ListPtr;
 };
 } // end namespace format
 } // end namespace adios2
@@ -32,10 +32,14 @@
 
 #include "adios2/operator/OperatorFactory.h"
 
+#include <algorithm>
 #include <array>
 #include <float.h>
+#include <functional>
+#include <future>
 #include <limits.h>
 #include <math.h>
+#include <memory>
 #include <string.h>
 
 using namespace adios2::helper;
@@ -50,6 +54,9 @@ namespace adios2
 namespace format
 {
 static void ApplyElementMinMax(MinMaxStruct &MinMax, DataType Type, void *Element);
+static size_t ApplySubBlockStats(MinBlockInfo &Blk, const BP5Base::MetaSubBlockStats *SubBlocks,
+                                 const size_t Dims, const size_t BlockNum, size_t FirstSubBlock,
+                                 const size_t ElementSize);
 
 void BP5Deserializer::InstallMetaMetaData(MetaMetaInfoBlock &MM)
 {
@@ -64,16 +71,12 @@ void BP5Deserializer::InstallMetaMetaData(MetaMetaInfoBlock &MM)
 
 BP5Deserializer::ControlInfo *BP5Deserializer::GetPriorControl(FMFormat Format)
 {
-    struct ControlInfo *tmp = ControlBlocks;
-    while (tmp)
+    auto it = m_ControlByFormat.find(Format);
+    if (it == m_ControlByFormat.end())
     {
-        if (tmp->Format == Format)
-        {
-            return tmp;
-        }
-        tmp = tmp->Next;
+        return NULL;
     }
-    return NULL;
+    return it->second;
 }
 
 bool BP5Deserializer::NameIndicatesArray(const char *Name)
@@ -180,7 +183,8 @@ const char *BP5Deserializer::BreakdownVarName(const char *Name, DataType *type_p
     return p;
 }
 
-void BP5Deserializer::BreakdownFieldType(const char *FieldType, bool &Operator, bool &MinMax)
+void BP5Deserializer::BreakdownFieldType(const char *FieldType, bool &Operator, bool &MinMax,
+                                         bool &SubBlocks)
 {
     if (FieldType[0] != 'M')
     {
@@ -199,6 +203,9 @@ void BP5Deserializer::BreakdownFieldType(const char *FieldType, bool &Operator,
     if (FieldType[0] == 'M')
     {
         MinMax = true;
+        FieldType += strlen("MM");
+        // written with StatsBlockSize
+        SubBlocks = (strncmp(FieldType, "Sub", 3) == 0);
     }
 }
 
@@ -423,6 +430,7 @@ BP5Deserializer::ControlInfo *BP5Deserializer::BuildControl(FMFormat Format)
             int ElementSize;
             bool Operator = false;
             bool MinMax = false;
+            bool SubBlocks = false;
             bool V1_fields = true;
             FMFormat StructFormat = NULL;
             if (FieldList[i].field_type[0] == 'M')
@@ -434,7 +442,7 @@ BP5Deserializer::ControlInfo *BP5Deserializer::BuildControl(FMFormat Format)
             }
             else
             {
-                BreakdownFieldType(FieldList[i].field_type, Operator, MinMax);
+                BreakdownFieldType(FieldList[i].field_type, Operator, MinMax, SubBlocks);
                 BreakdownArrayName(FieldList[i].field_name + HeaderSkip, &ArrayName, &Type,
                                    &ElementSize, &StructFormat);
             }
@@ -491,6 +499,8 @@ BP5Deserializer::ControlInfo *BP5Deserializer::BuildControl(FMFormat Format)
 
                 VarRec->MinMaxOffset = MetaRecFields * sizeof(void *);
                 MetaRecFields++;
+                if (SubBlocks)
+                    VarRec->SubBlockStatsOffset = MetaRecFields * sizeof(void *);
             }
             if (V1_fields)
             {
@@ -535,6 +545,7 @@ BP5Deserializer::ControlInfo *BP5Deserializer::BuildControl(FMFormat Format)
     ret->ControlCount = ControlCount;
     ret->Next = ControlBlocks;
     ControlBlocks = ret;
+    m_ControlByFormat[Format] = ret;
     return ret;
 }
 
@@ -650,6 +661,18 @@ void BP5Deserializer::SetupForStep(size_t Step, size_t WriterCount)
     else
     {
         PendingGetRequests.clear();
+        if (!m_FlattenSteps)
+        {
+            // the decoded metadata of the prior step
+            for (auto &Decoded : m_DecodedMetadata)
+            {
+                for (void *BaseData : Decoded.second)
+                {
+                    free(BaseData);
+                }
+            }
+            m_DecodedMetadata.clear();
+        }
 
         for (auto RecPair : VarByKey)
         {
@@ -659,6 +682,11 @@ void BP5Deserializer::SetupForStep(size_t Step, size_t WriterCount)
 #endif
             RecPair.second->Variable = NULL;
         }
+        for (auto RecPair : VarByName)
+        {
+            // block indices point into the metadata of the prior step
+            RecPair.second->BlockIndexByStep.clear();
+        }
     }
     for (auto RecPair : VarByKey)
     {
@@ -692,14 +720,9 @@ size_t BP5Deserializer::WriterCohortSize(size_t Step) const
     }
 }
 
-void BP5Deserializer::InstallMetaData(void *MetadataBlock, size_t BlockLen, size_t WriterRank,
-                                      size_t Step)
+FFSTypeHandle BP5Deserializer::MetadataFormat(FFSContext Context, void *MetadataBlock)
 {
-    const size_t writerCohortSize = WriterCohortSize(Step);
-    FFSTypeHandle FFSformat;
-    void *BaseData;
-    static int DumpMetadata = -1;
-    FFSformat = FFSTypeHandle_from_encode(ReaderFFSContext, (char *)MetadataBlock);
+    FFSTypeHandle FFSformat = FFSTypeHandle_from_encode(Context, (char *)MetadataBlock);
     if (!FFSformat)
     {
         helper::Throw<std::logic_error>("Toolkit", "format::BP5Deserializer", "InstallMetaData",
@@ -708,23 +731,210 @@ void BP5Deserializer::InstallMetaData(void *MetadataBlock, size_t BlockLen, size
     }
     if (!FFShas_conversion(FFSformat))
     {
-        FMContext FMC = FMContext_from_FFS(ReaderFFSContext);
+        FMContext FMC = FMContext_from_FFS(Context);
         FMFormat Format = FMformat_from_ID(FMC, (char *)MetadataBlock);
         FMStructDescList List = FMcopy_struct_list(format_list_of_FMFormat(Format));
         // GSE - restrict to homogenous FTM       FMlocalize_structs(List);
-        establish_conversion(ReaderFFSContext, FFSformat, List);
+        establish_conversion(Context, FFSformat, List);
         FMfree_struct_list(List);
     }
-    if (FFSdecode_in_place_possible(FFSformat))
+    return FFSformat;
+}
+
+void *BP5Deserializer::DecodeMetaData(FFSContext Context, FFSTypeHandle FFSformat,
+                                      void *MetadataBlock, size_t BlockLen, bool &Allocated)
+{
+    void *BaseData;
+    // a step decoded in place cannot be installed again, so with a limit on the
+    // installed steps they are decoded into allocated memory to be released
+    Allocated = m_ReadOnlyMetadata || (m_RandomAccessMode && m_MaxInstalledSteps) ||
+                !FFSdecode_in_place_possible(FFSformat);
+    if (!Allocated)
     {
-        FFSdecode_in_place(ReaderFFSContext, (char *)MetadataBlock, &BaseData);
+        FFSdecode_in_place(Context, (char *)MetadataBlock, &BaseData);
     }
     else
     {
-        auto DecodedLength =
-            FFS_est_decode_length(ReaderFFSContext, (char *)MetadataBlock, BlockLen);
+        auto DecodedLength = FFS_est_decode_length(Context, (char *)MetadataBlock, BlockLen);
         BaseData = malloc(DecodedLength);
-        FFSdecode_to_buffer(ReaderFFSContext, (char *)MetadataBlock, BaseData);
+        FFSdecode_to_buffer(Context, (char *)MetadataBlock, BaseData);
+    }
+    return BaseData;
+}
+
+void BP5Deserializer::ReverseMetaDataDimensions(const ControlInfo *Control, void *BaseData)
+{
+    if (m_WriterIsRowMajor == m_ReaderIsRowMajor)
+    {
+        return;
+    }
+    const struct ControlStruct *ControlFields = &Control->Controls[0];
+    for (int i = 0; i < Control->ControlCount; i++)
+    {
+        const ShapeID OrigShapeID = ControlFields[i].OrigShapeID;
+        if (((OrigShapeID != ShapeID::GlobalArray) && (OrigShapeID != ShapeID::LocalArray) &&
+             (OrigShapeID != ShapeID::JoinedArray)) ||
+            !BP5BitfieldTest((BP5MetadataInfoStruct *)BaseData, i))
+        {
+            continue;
+        }
+        MetaArrayRec *meta_base = (MetaArrayRec *)((char *)BaseData + ControlFields[i].FieldOffset);
+        size_t BlockCount = meta_base->Dims ? meta_base->DBCount / meta_base->Dims : 1;
+        if (meta_base->Dims > 1)
+        {
+            /* if we're getting data from someone of the other array
+             * gender, switcheroo */
+            ReverseDimensions(meta_base->Count, meta_base->Dims, BlockCount);
+            if ((OrigShapeID == ShapeID::GlobalArray) || (OrigShapeID == ShapeID::JoinedArray))
+            {
+                ReverseDimensions(meta_base->Shape, meta_base->Dims, 1);
+                if (OrigShapeID == ShapeID::GlobalArray)
+                {
+                    ReverseDimensions(meta_base->Offsets, meta_base->Dims, BlockCount);
+                }
+            }
+        }
+    }
+}
+
+void BP5Deserializer::InstallMetaData(void *MetadataBlock, size_t BlockLen, size_t WriterRank,
+                                      size_t Step)
+{
+    FFSTypeHandle FFSformat = MetadataFormat(ReaderFFSContext, MetadataBlock);
+    bool Allocated;
+    void *BaseData = DecodeMetaData(ReaderFFSContext, FFSformat, MetadataBlock, BlockLen, Allocated);
+    struct ControlInfo *Control = GetPriorControl(FMFormat_of_original(FFSformat));
+    if (!Control)
+    {
+        Control = BuildControl(FMFormat_of_original(FFSformat));
+    }
+    ReverseMetaDataDimensions(Control, BaseData);
+    InstallDecodedMetaData(BaseData, Allocated, Control, WriterRank, Step);
+}
+
+void BP5Deserializer::InstallMetaData(const std::vector<std::pair<void *, size_t>> &Blocks,
+                                      size_t Step)
+{
+    const size_t nThreads = std::min(static_cast<size_t>(m_Threads), Blocks.size());
+    if (nThreads <= 1)
+    {
+        for (size_t WriterRank = 0; WriterRank < Blocks.size(); WriterRank++)
+        {
+            InstallMetaData(Blocks[WriterRank].first, Blocks[WriterRank].second, WriterRank,
+                            Step);
+        }
+        return;
+    }
+    while (m_DecodeFFSContexts.size() < nThreads)
+    {
+        m_DecodeFFSContexts.push_back(create_FFSContext_FM(FMContext_from_FFS(ReaderFFSContext)));
+    }
+
+    /* Thread t decodes a contiguous range of writers with its own FFS
+     * context.  Finding the formats, establishing the conversions and
+     * building the controls is done here beforehand, FFS contexts and the
+     * variable records may not be changed by the threads.  Consecutive
+     * writers usually have the same format. */
+    const size_t PerThread = (Blocks.size() + nThreads - 1) / nThreads;
+    std::vector<FFSTypeHandle> Formats(Blocks.size());
+    std::vector<ControlInfo *> Controls(Blocks.size());
+    for (size_t WriterRank = 0; WriterRank < Blocks.size(); WriterRank++)
+    {
+        char *ID = (char *)Blocks[WriterRank].first;
+        char *PrevID = (WriterRank % PerThread) ? (char *)Blocks[WriterRank - 1].first : NULL;
+        if (PrevID && (FMformatID_len(ID) == FMformatID_len(PrevID)) &&
+            (memcmp(ID, PrevID, FMformatID_len(ID)) == 0))
+        {
+            Formats[WriterRank] = Formats[WriterRank - 1];
+            Controls[WriterRank] = Controls[WriterRank - 1];
+            continue;
+        }
+        Formats[WriterRank] = MetadataFormat(m_DecodeFFSContexts[WriterRank / PerThread], ID);
+        FMFormat Format = FMFormat_of_original(Formats[WriterRank]);
+        Controls[WriterRank] = GetPriorControl(Format);
+        if (!Controls[WriterRank])
+        {
+            Controls[WriterRank] = BuildControl(Format);
+        }
+    }
+
+    std::vector<void *> BaseData(Blocks.size());
+    std::unique_ptr<bool[]> Allocated(new bool[Blocks.size()]);
+    auto lf_Decode = [&](size_t t) {
+        const size_t Last = std::min(Blocks.size(), (t + 1) * PerThread);
+        for (size_t WriterRank = t * PerThread; WriterRank < Last; WriterRank++)
+        {
+            BaseData[WriterRank] =
+                DecodeMetaData(m_DecodeFFSContexts[t], Formats[WriterRank],
+                               Blocks[WriterRank].first, Blocks[WriterRank].second,
+                               Allocated[WriterRank]);
+            ReverseMetaDataDimensions(Controls[WriterRank], BaseData[WriterRank]);
+        }
+    };
+    RunOnThreads(nThreads, lf_Decode);
+
+    // in writer order, joined arrays are laid out in that order
+    for (size_t WriterRank = 0; WriterRank < Blocks.size(); WriterRank++)
+    {
+        InstallDecodedMetaData(BaseData[WriterRank], Allocated[WriterRank], Controls[WriterRank],
+                               WriterRank, Step);
+    }
+}
+
+void BP5Deserializer::RunOnThreads(size_t nThreads, const std::function<void(size_t)> &Task)
+{
+    if (!m_DecodePool)
+    {
+        // the calling thread is one of the m_Threads
+        m_DecodePool.reset(new helper::ThreadPool(m_Threads - 1));
+    }
+    if (m_Profiler)
+    {
+        m_Profiler->AddEvents(profiling::EventID::MetadataDecodeRange, nThreads);
+    }
+    std::vector<std::future<void>> Tasks;
+    for (size_t t = 1; t < nThreads; t++)
+    {
+        Tasks.push_back(m_DecodePool->Submit([&Task, t]() { Task(t); }));
+    }
+    // the tasks use the caller's variables, wait for all of them before rethrowing
+    std::exception_ptr Error;
+    try
+    {
+        Task(0);
+    }
+    catch (...)
+    {
+        Error = std::current_exception();
+    }
+    for (auto &T : Tasks)
+    {
+        try
+        {
+            T.get();
+        }
+        catch (...)
+        {
+            if (!Error)
+            {
+                Error = std::current_exception();
+            }
+        }
+    }
+    if (Error)
+    {
+        std::rethrow_exception(Error);
+    }
+}
+
+void BP5Deserializer::InstallDecodedMetaData(void *BaseData, bool Allocated, ControlInfo *Control,
+                                             size_t WriterRank, size_t Step)
+{
+    const size_t writerCohortSize = WriterCohortSize(Step);
+    static int DumpMetadata = -1;
+    if (Allocated && (m_RandomAccessMode || m_ReadOnlyMetadata))
+    {
+        m_DecodedMetadata[Step].push_back(BaseData);
     }
     if (DumpMetadata == -1)
     {
@@ -733,17 +943,10 @@ void BP5Deserializer::InstallMetaData(void *MetadataBlock, size_t BlockLen, size
     if (DumpMetadata)
     {
         printf("\nIncomingMetadatablock from WriterRank %d is %p :\n", (int)WriterRank, BaseData);
-        FMdump_data(FMFormat_of_original(FFSformat), BaseData, 1024000);
+        FMdump_data(Control->Format, BaseData, 1024000);
         printf("\n\n");
     }
-    struct ControlInfo *Control;
-    struct ControlStruct *ControlFields;
-    Control = GetPriorControl(FMFormat_of_original(FFSformat));
-    if (!Control)
-    {
-        Control = BuildControl(FMFormat_of_original(FFSformat));
-    }
-    ControlFields = &Control->Controls[0];
+    struct ControlStruct *ControlFields = &Control->Controls[0];
 
     if (m_RandomAccessMode)
     {
@@ -757,14 +960,17 @@ void BP5Deserializer::InstallMetaData(void *MetadataBlock, size_t BlockLen, size
         }
         m_ControlArray[Step][WriterRank] = Control;
 
-        MetadataBaseArray.resize(Step + 1);
+        if (MetadataBaseArray.size() < Step + 1)
+        {
+            MetadataBaseArray.resize(Step + 1);
+        }
         if (MetadataBaseArray[Step] == nullptr)
         {
-            m_MetadataBaseAddrs = new std::vector<void *>();
-            m_MetadataBaseAddrs->resize(writerCohortSize);
-            MetadataBaseArray[Step] = m_MetadataBaseAddrs;
+            MetadataBaseArray[Step] = new std::vector<void *>();
+            MetadataBaseArray[Step]->resize(writerCohortSize);
             m_FreeableMBA = nullptr;
         }
+        m_MetadataBaseAddrs = MetadataBaseArray[Step];
 
         JDAIdx = Step;
     }
@@ -782,7 +988,10 @@ void BP5Deserializer::InstallMetaData(void *MetadataBlock, size_t BlockLen, size
 
         JDAIdx = 0;
     }
-    JoinedDimArray.resize(JDAIdx + 1);
+    if (JoinedDimArray.size() < JDAIdx + 1)
+    {
+        JoinedDimArray.resize(JDAIdx + 1);
+    }
     JoinedDimArray[JDAIdx].resize(writerCohortSize);
 
     (*m_MetadataBaseAddrs)[WriterRank] = BaseData;
@@ -845,12 +1054,17 @@ void BP5Deserializer::InstallMetaData(void *MetadataBlock, size_t BlockLen, size
                 }
                 VarRec->PerWriterMetaFieldOffset[WriterRank] = FieldOffset;
             }
-            else
+            else if (!m_InstallOnDemand)
             {
                 if ((VarRec->AbsStepFromRel.size() == 0) || (VarRec->AbsStepFromRel.back() != Step))
                 {
                     VarRec->AbsStepFromRel.push_back(Step);
                 }
+                if (!VarRec->BlockIndexByStep.empty())
+                {
+                    // new blocks for this step, rebuild the index on next use
+                    VarRec->BlockIndexByStep.erase(Step);
+                }
             }
             if ((ControlFields[i].OrigShapeID == ShapeID::GlobalArray) ||
                 (ControlFields[i].OrigShapeID == ShapeID::LocalArray) ||
@@ -858,21 +1072,6 @@ void BP5Deserializer::InstallMetaData(void *MetadataBlock, size_t BlockLen, size
             {
                 MetaArrayRec *meta_base = (MetaArrayRec *)field_data;
                 size_t BlockCount = meta_base->Dims ? meta_base->DBCount / meta_base->Dims : 1;
-                if ((meta_base->Dims > 1) && (m_WriterIsRowMajor != m_ReaderIsRowMajor))
-                {
-                    /* if we're getting data from someone of the other array
-                     * gender, switcheroo */
-                    ReverseDimensions(meta_base->Count, meta_base->Dims, BlockCount);
-                    if ((ControlFields[i].OrigShapeID == ShapeID::GlobalArray) ||
-                        (ControlFields[i].OrigShapeID == ShapeID::JoinedArray))
-                    {
-                        ReverseDimensions(meta_base->Shape, meta_base->Dims, 1);
-                        if (ControlFields[i].OrigShapeID == ShapeID::GlobalArray)
-                        {
-                            ReverseDimensions(meta_base->Offsets, meta_base->Dims, BlockCount);
-                        }
-                    }
-                }
                 if ((WriterRank == 0) || (VarRec->GlobalDims == NULL))
                 {
                     // use the shape from rank 0 (or first non-NULL)
@@ -977,6 +1176,10 @@ void BP5Deserializer::InstallMetaData(void *MetadataBlock, size_t BlockLen, size
                     VarRec->LastTSAdded = Step;
                 }
             }
+            if (m_InstallOnDemand)
+            {
+                continue;
+            }
             if (VarRec->FirstTSSeen == SIZE_MAX)
             {
                 VarRec->FirstTSSeen = Step;
@@ -1027,6 +1230,246 @@ void BP5Deserializer::InstallMetaData(void *MetadataBlock, size_t BlockLen, size
     }
 }
 
+static FMField MetadataBitFieldList[] = {
+    {"BitFieldCount", "integer", sizeof(size_t),
+     FMOffset(BP5Base::BP5MetadataInfoStruct *, BitFieldCount)},
+    {"BitField", "integer[BitFieldCount]", sizeof(size_t),
+     FMOffset(BP5Base::BP5MetadataInfoStruct *, BitField)},
+    {"DataBlockSize", "integer", sizeof(size_t),
+     FMOffset(BP5Base::BP5MetadataInfoStruct *, DataBlockSize)},
+    {NULL, NULL, 0, 0}};
+
+FFSTypeHandle BP5Deserializer::ScanFormat(size_t Thread, void *MetadataBlock)
+{
+    while (m_ScanFFSContexts.size() <= Thread)
+    {
+        // shares the formats of ReaderFFSContext, but converts to a record
+        // of the leading fields only, leaving the encoded block untouched
+        m_ScanFFSContexts.push_back(create_FFSContext_FM(FMContext_from_FFS(ReaderFFSContext)));
+    }
+    FFSContext Context = m_ScanFFSContexts[Thread];
+    FFSTypeHandle FFSformat = FFSTypeHandle_from_encode(Context, (char *)MetadataBlock);
+    if (!FFSformat)
+    {
+        helper::Throw<std::logic_error>("Toolkit", "format::BP5Deserializer", "ScanMetaData",
+                                        "Internal error or file corruption, no "
+                                        "know format for Metadata Block");
+    }
+    if (!FFShas_conversion(FFSformat))
+    {
+        FMFormat Format = FMFormat_of_original(FFSformat);
+        FMStructDescRec List[] = {{name_of_FMformat(Format), MetadataBitFieldList,
+                                   sizeof(BP5MetadataInfoStruct), NULL},
+                                  {NULL, NULL, 0, NULL}};
+        establish_conversion(Context, FFSformat, List);
+    }
+    return FFSformat;
+}
+
+void BP5Deserializer::ScanMetaData(void *MetadataBlock, size_t BlockLen, size_t WriterRank,
+                                   size_t Step)
+{
+    FFSTypeHandle FFSformat = ScanFormat(0, MetadataBlock);
+    const size_t DecodedLength =
+        FFS_est_decode_length(m_ScanFFSContexts[0], (char *)MetadataBlock, BlockLen);
+    if (m_ScanBuffer.size() < DecodedLength)
+    {
+        m_ScanBuffer.resize(DecodedLength);
+    }
+    FFSdecode_to_buffer(m_ScanFFSContexts[0], (char *)MetadataBlock, m_ScanBuffer.data());
+
+    FMFormat Format = FMFormat_of_original(FFSformat);
+    struct ControlInfo *Control = GetPriorControl(Format);
+    if (!Control)
+    {
+        Control = BuildControl(Format);
+    }
+    ScanDecodedMetaData((BP5MetadataInfoStruct *)m_ScanBuffer.data(), Control, MetadataBlock,
+                        BlockLen, WriterRank, Step);
+}
+
+void BP5Deserializer::ScanMetaData(const std::vector<std::pair<void *, size_t>> &Blocks,
+                                   size_t Step)
+{
+    const size_t nThreads = std::min(static_cast<size_t>(m_Threads), Blocks.size());
+    if (nThreads <= 1)
+    {
+        for (size_t WriterRank = 0; WriterRank < Blocks.size(); WriterRank++)
+        {
+            ScanMetaData(Blocks[WriterRank].first, Blocks[WriterRank].second, WriterRank, Step);
+        }
+        return;
+    }
+
+    /* As in InstallMetaData(Blocks, Step), thread t decodes the bitfields of
+     * a contiguous range of writers with its own FFS context, the formats
+     * and controls are found here beforehand and the variables are updated
+     * afterwards in writer order. */
+    const size_t PerThread = (Blocks.size() + nThreads - 1) / nThreads;
+    std::vector<FFSTypeHandle> Formats(Blocks.size());
+    std::vector<ControlInfo *> Controls(Blocks.size());
+    for (size_t WriterRank = 0; WriterRank < Blocks.size(); WriterRank++)
+    {
+        char *ID = (char *)Blocks[WriterRank].first;
+        char *PrevID = (WriterRank % PerThread) ? (char *)Blocks[WriterRank - 1].first : NULL;
+        if (PrevID && (FMformatID_len(ID) == FMformatID_len(PrevID)) &&
+            (memcmp(ID, PrevID, FMformatID_len(ID)) == 0))
+        {
+            Formats[WriterRank] = Formats[WriterRank - 1];
+            Controls[WriterRank] = Controls[WriterRank - 1];
+            continue;
+        }
+        Formats[WriterRank] = ScanFormat(WriterRank / PerThread, ID);
+        FMFormat Format = FMFormat_of_original(Formats[WriterRank]);
+        Controls[WriterRank] = GetPriorControl(Format);
+        if (!Controls[WriterRank])
+        {
+            Controls[WriterRank] = BuildControl(Format);
+        }
+    }
+
+    std::vector<std::vector<char>> Decoded(Blocks.size());
+    auto lf_Decode = [&](size_t t) {
+        const size_t Last = std::min(Blocks.size(), (t + 1) * PerThread);
+        for (size_t WriterRank = t * PerThread; WriterRank < Last; WriterRank++)
+        {
+            char *Block = (char *)Blocks[WriterRank].first;
+            Decoded[WriterRank].resize(FFS_est_decode_length(m_ScanFFSContexts[t], Block,
+                                                             Blocks[WriterRank].second));
+            FFSdecode_to_buffer(m_ScanFFSContexts[t], Block, Decoded[WriterRank].data());
+        }
+    };
+    RunOnThreads(nThreads, lf_Decode);
+
+    for (size_t WriterRank = 0; WriterRank < Blocks.size(); WriterRank++)
+    {
+        ScanDecodedMetaData((BP5MetadataInfoStruct *)Decoded[WriterRank].data(),
+                            Controls[WriterRank], Blocks[WriterRank].first,
+                            Blocks[WriterRank].second, WriterRank, Step);
+    }
+}
+
+void BP5Deserializer::ScanDecodedMetaData(BP5MetadataInfoStruct *BaseData, ControlInfo *Control,
+                                          void *MetadataBlock, size_t BlockLen,
+                                          size_t WriterRank, size_t Step)
+{
+    const size_t writerCohortSize = WriterCohortSize(Step);
+    if (m_ControlArray.size() < Step + 1)
+    {
+        m_ControlArray.resize(Step + 1);
+        m_EncodedMetadata.resize(Step + 1);
+        m_StepLastUse.resize(Step + 1);
+    }
+    if (m_ControlArray[Step].size() == 0)
+    {
+        m_ControlArray[Step].resize(writerCohortSize);
+        m_EncodedMetadata[Step].resize(writerCohortSize);
+    }
+    m_ControlArray[Step][WriterRank] = Control;
+    m_EncodedMetadata[Step][WriterRank] = std::make_pair(MetadataBlock, BlockLen);
+
+    for (int i = 0; i < Control->ControlCount; i++)
+    {
+        if (!BP5BitfieldTest(BaseData, i))
+        {
+            continue;
+        }
+        BP5VarRec *VarRec = Control->Controls[i].VarRec;
+        if (!VarRec->Variable)
+        {
+            // defined by InstallMetaData
+            m_ScanFoundNewVariable = true;
+            continue;
+        }
+        if ((VarRec->AbsStepFromRel.size() == 0) || (VarRec->AbsStepFromRel.back() != Step))
+        {
+            VarRec->AbsStepFromRel.push_back(Step);
+        }
+        if (VarRec->LastTSAdded != Step)
+        {
+            static_cast<VariableBase *>(VarRec->Variable)->m_AvailableStepsCount++;
+            VarRec->LastTSAdded = Step;
+        }
+    }
+    if ((WriterRank == writerCohortSize - 1) && m_ScanFoundNewVariable)
+    {
+        m_ScanFoundNewVariable = false;
+        InstallStep(Step, false);
+    }
+}
+
+void BP5Deserializer::InstallStep(size_t Step, bool OnDemand)
+{
+    // offsets of joined arrays accumulate over the writers of the step
+    for (auto RecPair : VarByKey)
+    {
+        if (RecPair.second->OrigShapeID == ShapeID::JoinedArray)
+        {
+            RecPair.second->JoinedDimen = SIZE_MAX;
+            RecPair.second->LastJoinedOffset = NULL;
+            RecPair.second->LastJoinedShape = NULL;
+        }
+    }
+    m_InstallOnDemand = OnDemand;
+    InstallMetaData(m_EncodedMetadata[Step], Step);
+    m_InstallOnDemand = false;
+    if (m_Profiler)
+    {
+        m_Profiler->AddEvents(profiling::EventID::MetadataStepInstall);
+    }
+}
+
+void BP5Deserializer::ReleaseInstalledSteps()
+{
+    m_Operation++;
+    if ((m_MaxInstalledSteps == 0) || (m_DecodedMetadata.size() <= m_MaxInstalledSteps) ||
+        !PendingGetRequests.empty())
+    {
+        return;
+    }
+    // a step can be installed again only if no block was decoded in place
+    std::vector<std::pair<size_t, size_t>> ByLastUse;
+    for (const auto &Decoded : m_DecodedMetadata)
+    {
+        const size_t Step = Decoded.first;
+        if ((Step < m_EncodedMetadata.size()) &&
+            (Decoded.second.size() == m_EncodedMetadata[Step].size()))
+        {
+            ByLastUse.push_back(std::make_pair(m_StepLastUse[Step], Step));
+        }
+    }
+    if (ByLastUse.size() <= m_MaxInstalledSteps)
+    {
+        return;
+    }
+    std::sort(ByLastUse.begin(), ByLastUse.end());
+    for (size_t i = 0; i < ByLastUse.size() - m_MaxInstalledSteps; i++)
+    {
+        const size_t Step = ByLastUse[i].second;
+        for (void *BaseData : m_DecodedMetadata[Step])
+        {
+            free(BaseData);
+        }
+        m_DecodedMetadata.erase(Step);
+        delete MetadataBaseArray[Step];
+        MetadataBaseArray[Step] = nullptr;
+        for (auto &JoinedDims : JoinedDimArray[Step])
+        {
+            free(JoinedDims);
+            JoinedDims = nullptr;
+        }
+        for (auto RecPair : VarByName)
+        {
+            RecPair.second->BlockIndexByStep.erase(Step);
+        }
+        if (m_Profiler)
+        {
+            m_Profiler->AddEvents(profiling::EventID::MetadataStepRelease);
+        }
+    }
+    m_MetadataBaseAddrs = nullptr;
+}
+
 void BP5Deserializer::InstallAttributeData(void *AttributeBlock, size_t BlockLen, size_t Step)
 {
     static int DumpMetadata = -1;
@@ -1054,7 +1497,7 @@ void BP5Deserializer::InstallAttributeData(void *AttributeBlock, size_t BlockLen
         FMfree_struct_list(List);
     }
 
-    if (FFSdecode_in_place_possible(FFSformat))
+    if (!m_ReadOnlyMetadata && FFSdecode_in_place_possible(FFSformat))
     {
         FFSdecode_in_place(ReaderFFSContext, (char *)AttributeBlock, &BaseData);
     }
@@ -1063,8 +1506,7 @@ void BP5Deserializer::InstallAttributeData(void *AttributeBlock, size_t BlockLen
         auto DecodedLength =
             FFS_est_decode_length(ReaderFFSContext, (char *)AttributeBlock, BlockLen);
         BaseData = malloc(DecodedLength);
-        FFSBuffer decode_buf = create_fixed_FFSBuffer((char *)BaseData, DecodedLength);
-        FFSdecode_to_buffer(ReaderFFSContext, (char *)AttributeBlock, decode_buf);
+        FFSdecode_to_buffer(ReaderFFSContext, (char *)AttributeBlock, BaseData);
     }
     if (DumpMetadata == -1)
     {
@@ -1091,6 +1533,11 @@ void BP5Deserializer::InstallAttributeData(void *AttributeBlock, size_t BlockLen
                                         "Internal error or file corruption, "
                                         "not able to install this format");
     }
+    if (m_ReadOnlyMetadata)
+    {
+        // the attributes were copied into the IO
+        free(BaseData);
+    }
 }
 
 void BP5Deserializer::InstallAttributesV1(FFSTypeHandle FFSformat, void *BaseData, size_t Step)
@@ -1536,15 +1983,226 @@ static size_t CalcBlockLength(const size_t dimensionsSize, const size_t *count)
  * contiguous, but it should never return true when it is not
  * contiguous.
  */
+/*
+ * true if a Count sized box is contiguous in memory laid out as Dims,
+ * that is it spans whole rows below its slowest varying dimension that
+ * isn't 1.  Dims and Count are in the reader's dimension order.
+ */
+static bool IsContiguousBox(const size_t DimCount, const size_t *Dims, const size_t *Count,
+                            const bool IsRowMajor)
+{
+    bool Spanning = false;
+    for (size_t i = 0; i < DimCount; i++)
+    {
+        const size_t Dim = IsRowMajor ? i : DimCount - 1 - i;
+        if (Spanning && (Count[Dim] != Dims[Dim]))
+        {
+            return false;
+        }
+        if (Count[Dim] != 1)
+        {
+            Spanning = true;
+        }
+    }
+    return true;
+}
+
+/*
+ * true if the runs of a strided read scattered into the application buffer
+ * are as long as its runs in the block.  If the intersection spans a
+ * dimension of the block that the selection is wider than, the runs in the
+ * block are longer, and reading them packed and copying the selection out
+ * takes fewer I/O calls.  Dims are in the reader's dimension order.
+ */
+static bool ScatteredRunsAreWhole(const size_t DimCount, const size_t *BlockCount,
+                                  const size_t *SelCount, const size_t *ICount,
+                                  const bool IsRowMajor)
+{
+    for (size_t i = DimCount - 1; i > 0; i--)
+    {
+        const size_t Dim = IsRowMajor ? i : DimCount - 1 - i;
+        if (ICount[Dim] != BlockCount[Dim])
+        {
+            return true;
+        }
+        if (ICount[Dim] != SelCount[Dim])
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
 bool BP5Deserializer::IsContiguousTransfer(BP5ArrayRequest *Req, size_t *offsets, size_t *count)
 {
     /*
      * All 1 dimensional requests in ADIOS involve the transfer of
-     * contiguous blocks.  Multidimensional requests may or may not
-     * involve contiguous blocks, but for now all multimensional
-     * requests are assumed to be non-contiguous.
+     * contiguous blocks.  Multidimensional requests are contiguous if
+     * the part of the block that is read is contiguous both in the block
+     * and in the application buffer, e.g. full rows of both, or a single
+     * row.  Memory selections change the layout of the application
+     * buffer, so those are never treated as contiguous.
      */
-    return (((struct BP5VarRec *)Req->VarRec)->DimCount == 1);
+    auto VarRec = (struct BP5VarRec *)Req->VarRec;
+    const size_t DimCount = VarRec->DimCount;
+    if (DimCount == 1)
+    {
+        return true;
+    }
+    VariableBase *VB = static_cast<VariableBase *>(VarRec->Variable);
+    if (!VB->m_MemoryStart.empty())
+    {
+        return false;
+    }
+    if (Req->RequestType == Local)
+    {
+        // the selection is relative to the block and fills the buffer
+        return Req->Start.empty() ||
+               IsContiguousBox(DimCount, count, Req->Count.data(), m_ReaderIsRowMajor);
+    }
+    std::array<size_t, helper::MAX_DIMS> IStart, ICount;
+    if (!IntersectionStartCount(DimCount, Req->Start.data(), Req->Count.data(), offsets, count,
+                                &IStart[0], &ICount[0]))
+    {
+        return false;
+    }
+    return IsContiguousBox(DimCount, count, &ICount[0], m_ReaderIsRowMajor) &&
+           IsContiguousBox(DimCount, Req->Count.data(), &ICount[0], m_ReaderIsRowMajor);
+}
+
+/*
+ * Building an index only pays off for steps with many blocks, and only
+ * once a step is planned against more than once (a one-shot streaming
+ * read would spend more time sorting than the plain scan costs).
+ */
+static const size_t BlockIndexMinBlocks = 64;
+
+void BP5Deserializer::BuildBlockIndex(BP5VarRec *VarRec, size_t Step, BP5BlockIndex &Index)
+{
+    const size_t DimCount = VarRec->DimCount;
+    std::vector<BlockIndexEntry> Entries;
+    const size_t writerCohortSize = WriterCohortSize(Step);
+
+    Index.Built = true;
+    Index.ByDim.clear();
+    Index.MaxExtent.assign(DimCount, 0);
+    for (size_t WriterRank = 0; WriterRank < writerCohortSize; WriterRank++)
+    {
+        MetaArrayRec *writer_meta_base = (MetaArrayRec *)GetMetadataBase(VarRec, Step, WriterRank);
+        if (!writer_meta_base || !writer_meta_base->Offsets)
+            continue;
+        for (size_t Block = 0; Block < writer_meta_base->BlockCount; Block++)
+        {
+            const size_t *Count = &writer_meta_base->Count[Block * DimCount];
+            if (std::find(Count, Count + DimCount, (size_t)0) != Count + DimCount)
+                continue; // empty blocks never intersect anything
+            for (size_t Dim = 0; Dim < DimCount; Dim++)
+            {
+                Index.MaxExtent[Dim] = std::max(Index.MaxExtent[Dim], Count[Dim]);
+            }
+            Entries.push_back({0, 0, WriterRank, Block});
+        }
+    }
+    if (Entries.size() < BlockIndexMinBlocks)
+    {
+        return; // leave ByDim empty, plain scan is cheap enough
+    }
+
+    Index.ByDim.resize(DimCount);
+    for (size_t Dim = 0; Dim < DimCount; Dim++)
+    {
+        auto &DimEntries = Index.ByDim[Dim];
+        DimEntries = Entries;
+        for (auto &Entry : DimEntries)
+        {
+            MetaArrayRec *writer_meta_base =
+                (MetaArrayRec *)GetMetadataBase(VarRec, Step, Entry.WriterRank);
+            const size_t Pos = Entry.Block * DimCount + Dim;
+            Entry.Start = writer_meta_base->Offsets[Pos];
+            Entry.End = writer_meta_base->Offsets[Pos] + writer_meta_base->Count[Pos] - 1;
+        }
+        std::sort(DimEntries.begin(), DimEntries.end(),
+                  [](const BlockIndexEntry &A, const BlockIndexEntry &B) {
+                      return A.Start < B.Start;
+                  });
+    }
+}
+
+/*
+ * Return true if the block index for this step was used, in which case
+ * Blocks holds the (WriterRank, Block) pairs that may intersect the
+ * selection of Req, in writer and block order.  Return false if the
+ * caller should scan all blocks of all writers instead.
+ */
+bool BP5Deserializer::IndexedBlocks(BP5VarRec *VarRec, size_t Step, const BP5ArrayRequest *Req,
+                                    std::vector<std::pair<size_t, size_t>> &Blocks)
+{
+    if ((VarRec->DimCount == 0) || (Req->Start.size() != VarRec->DimCount))
+    {
+        return false;
+    }
+    if (!m_RandomAccessMode && (VarRec->BlockIndexByStep.count(Step) == 0))
+    {
+        // streaming keeps only the index of the current step
+        VarRec->BlockIndexByStep.clear();
+    }
+    BP5BlockIndex &Index = VarRec->BlockIndexByStep[Step];
+    if (!Index.Built)
+    {
+        if (Index.Uses++ == 0)
+        {
+            return false;
+        }
+        BuildBlockIndex(VarRec, Step, Index);
+    }
+    if (Index.ByDim.empty())
+    {
+        return false;
+    }
+
+    // find the dimension that narrows the candidate range the most
+    using EntryIter = std::vector<BlockIndexEntry>::const_iterator;
+    size_t BestDim = 0;
+    EntryIter BestLo, BestHi;
+    for (size_t Dim = 0; Dim < VarRec->DimCount; Dim++)
+    {
+        if (Req->Count[Dim] == 0)
+        {
+            Blocks.clear();
+            return true;
+        }
+        const size_t SelStart = Req->Start[Dim];
+        const size_t SelEnd = SelStart + Req->Count[Dim] - 1;
+        const size_t Reach = Index.MaxExtent[Dim] - 1;
+        // a block that starts before Lowest cannot reach SelStart
+        const size_t Lowest = (SelStart > Reach) ? SelStart - Reach : 0;
+        const auto &DimEntries = Index.ByDim[Dim];
+        EntryIter Lo = std::lower_bound(
+            DimEntries.begin(), DimEntries.end(), Lowest,
+            [](const BlockIndexEntry &Entry, size_t Value) { return Entry.Start < Value; });
+        EntryIter Hi = std::upper_bound(
+            Lo, DimEntries.end(), SelEnd,
+            [](size_t Value, const BlockIndexEntry &Entry) { return Value < Entry.Start; });
+        if ((Dim == 0) || ((Hi - Lo) < (BestHi - BestLo)))
+        {
+            BestDim = Dim;
+            BestLo = Lo;
+            BestHi = Hi;
+        }
+    }
+
+    Blocks.clear();
+    const size_t SelStart = Req->Start[BestDim];
+    for (EntryIter It = BestLo; It != BestHi; ++It)
+    {
+        if (It->End >= SelStart)
+        {
+            Blocks.emplace_back(It->WriterRank, It->Block);
+        }
+    }
+    // keep requests in the same order a full scan would produce them
+    std::sort(Blocks.begin(), Blocks.end());
+    return true;
 }
 
 std::vector<BP5Deserializer::ReadRequest>
@@ -1565,6 +2223,10 @@ BP5Deserializer::GenerateReadRequests(const bool doAllocTempBuffers, size_t *max
             std::vector<std::string> derivedVarInputNameList;
             std::vector<VariableBase *> derivedVarInputVarList;
             std::map<std::string, std::unique_ptr<MinVarInfo>> *nameToVarInfo;
+            std::vector<DerivedInputBlock> *derivedInputBlocks;
+            // read only the selected region of the input blocks (and its halo)
+            bool derivedRegion = false;
+            size_t derivedHalo = 0;
 
             if (m_FlattenSteps)
             {
@@ -1587,6 +2249,9 @@ BP5Deserializer::GenerateReadRequests(const bool doAllocTempBuffers, size_t *max
                 nameToVarInfo = new std::map<std::string, std::unique_ptr<MinVarInfo>>();
                 // to create a mapping between variable name and the varInfo (dim and data pointer)
                 Req->DerivedInputMap = nameToVarInfo;
+                derivedInputBlocks = new std::vector<DerivedInputBlock>();
+                Req->DerivedInputBlocks = derivedInputBlocks;
+                derivedRegion = derivedVar->SelectionHalo(derivedHalo);
                 for (auto varName : derivedVarInputNameList)
                 {
                     auto itVariable = var_map.find(varName);
@@ -1596,12 +2261,17 @@ BP5Deserializer::GenerateReadRequests(const bool doAllocTempBuffers, size_t *max
                             "using undefine variable " + varName +
                                 " in defining the derived variable ");
                     // extract the dimensions and data for each variable
+                    // a variable used more than once in the expression is read once
                     VariableBase *varBase = itVariable->second.get();
-                    nameToVarInfo->insert({varName, std::unique_ptr<MinVarInfo>(nullptr)});
-                    derivedVarInputVarList.push_back(varBase);
+                    if (nameToVarInfo->insert({varName, std::unique_ptr<MinVarInfo>(nullptr)})
+                            .second)
+                        derivedVarInputVarList.push_back(varBase);
                 }
 #else
                 (void)nameToVarInfo;
+                (void)derivedInputBlocks;
+                (void)derivedRegion;
+                (void)derivedHalo;
                 (void)var_map;
 #endif
             }
@@ -1660,10 +2330,11 @@ BP5Deserializer::GenerateReadRequests(const bool doAllocTempBuffers, size_t *max
                                     RR.ReadLength =
                                         helper::GetDataTypeSize(VarRec->Type) *
                                         CalcBlockLength(VarRec->DimCount, Req->Count.data());
-                                    /* DirectToAppMemory handles only 1D, so offset calc
-                                     * is 1D only for the moment */
-                                    RR.StartOffset +=
-                                        helper::GetDataTypeSize(VarRec->Type) * Req->Start[0];
+                                    RR.StartOffset += helper::GetDataTypeSize(VarRec->Type) *
+                                                      LinearIndex(VarRec->DimCount,
+                                                                  &writer_meta_base->Count[StartDim],
+                                                                  Req->Start.data(),
+                                                                  m_ReaderIsRowMajor);
                                 }
                             }
                             else
@@ -1671,7 +2342,7 @@ BP5Deserializer::GenerateReadRequests(const bool doAllocTempBuffers, size_t *max
                                 RR.DestinationAddr = nullptr;
                                 if (doAllocTempBuffers)
                                 {
-                                    RR.DestinationAddr = (char *)malloc(RR.ReadLength);
+                                    RR.DestinationAddr = AllocReadBuffer(RR.ReadLength);
                                 }
                                 *maxReadSize =
                                     (*maxReadSize < RR.ReadLength ? RR.ReadLength : *maxReadSize);
@@ -1688,8 +2359,251 @@ BP5Deserializer::GenerateReadRequests(const bool doAllocTempBuffers, size_t *max
             else
             {
                 /* global case */
+                auto GlobalBlockRequests = [&](const size_t Step, const size_t WriterRank,
+                                               MetaArrayRecOperator *writer_meta_base,
+                                               const size_t Block) {
+                    std::array<size_t, helper::MAX_DIMS> intersectionstart;
+                    std::array<size_t, helper::MAX_DIMS> intersectionend;
+                    std::array<size_t, helper::MAX_DIMS> intersectioncount;
+
+                    size_t StartDim = Block * VarRec->DimCount;
+                    if (!IntersectionStartCount(VarRec->DimCount, Req->Start.data(),
+                                                Req->Count.data(),
+                                                &writer_meta_base->Offsets[StartDim],
+                                                &writer_meta_base->Count[StartDim],
+                                                &intersectionstart[0], &intersectioncount[0]))
+                    {
+                        return;
+                    }
+                    if (VarRec->Derived)
+                    {
+#ifdef ADIOS2_HAVE_DERIVED_VARIABLE
+                        for (auto varBase : derivedVarInputVarList)
+                        {
+                            ReadRequest RR;
+                            BP5VarRec *VarPrimaryRec = VarByName.at(varBase->m_Name);
+                            MetaArrayRecOperator *writer_meta_base_input =
+                                (MetaArrayRecOperator *)GetMetadataBase(VarPrimaryRec, Step,
+                                                                        WriterRank);
+                            RR.Timestep = Step;
+                            RR.WriterRank = WriterRank;
+                            const size_t InputDims = writer_meta_base_input->Dims;
+                            const size_t InputStartDim = Block * InputDims;
+                            const size_t *InputOffsets =
+                                &writer_meta_base_input->Offsets[InputStartDim];
+                            const size_t *InputCount =
+                                &writer_meta_base_input->Count[InputStartDim];
+                            DerivedInputBlock IB;
+                            IB.VarName = varBase->m_Name;
+                            IB.ElementSize = helper::GetDataTypeSize(VarPrimaryRec->Type);
+                            IB.BlockStart.assign(InputOffsets, InputOffsets + InputDims);
+                            IB.BlockCount.assign(InputCount, InputCount + InputDims);
+                            IB.Start = IB.BlockStart;
+                            IB.Count = IB.BlockCount;
+                            if (derivedRegion && (VarPrimaryRec->Operator == NULL))
+                            {
+                                // dimensions the input has beyond the derived variable
+                                // (e.g. the components of a magnitude) are read whole
+                                const size_t SharedDims = std::min(InputDims, VarRec->DimCount);
+                                for (size_t Dim = 0; Dim < SharedDims; Dim++)
+                                {
+                                    const size_t BlockEnd = IB.BlockStart[Dim] + IB.BlockCount[Dim];
+                                    const size_t Lo =
+                                        (intersectionstart[Dim] > IB.BlockStart[Dim] + derivedHalo)
+                                            ? intersectionstart[Dim] - derivedHalo
+                                            : IB.BlockStart[Dim];
+                                    const size_t SelEnd = intersectionstart[Dim] +
+                                                          intersectioncount[Dim] + derivedHalo;
+                                    const size_t Hi = std::min(BlockEnd, SelEnd);
+                                    IB.Start[Dim] = Lo;
+                                    IB.Count[Dim] = Hi - Lo;
+                                }
+                            }
+                            std::array<size_t, helper::MAX_DIMS> RegionFirst;
+                            std::array<size_t, helper::MAX_DIMS> RegionLast;
+                            for (size_t Dim = 0; Dim < InputDims; Dim++)
+                            {
+                                RegionFirst[Dim] = IB.Start[Dim] - IB.BlockStart[Dim];
+                                RegionLast[Dim] = RegionFirst[Dim] + IB.Count[Dim] - 1;
+                            }
+                            IB.OffsetInBlock =
+                                IB.ElementSize *
+                                LinearIndex(InputDims, InputCount, &RegionFirst[0], true);
+                            const size_t EndOffsetInBlock =
+                                IB.ElementSize *
+                                (LinearIndex(InputDims, InputCount, &RegionLast[0], true) + 1);
+                            RR.StartOffset = writer_meta_base_input->DataBlockLocation[Block] +
+                                             IB.OffsetInBlock;
+                            RR.ReadLength = EndOffsetInBlock - IB.OffsetInBlock;
+                            IB.Gather = (RR.ReadLength !=
+                                         IB.ElementSize * helper::GetTotalSize(IB.Count));
+                            RR.DestinationAddr = AllocReadBuffer(RR.ReadLength);
+                            RR.DirectToAppMemory = false;
+                            RR.ReqIndex = ReqIndex;
+                            RR.BlockID = Block;
+                            RR.OffsetInBlock = 0;
+                            Ret.push_back(RR);
+                            auto mvi = m_Engine->MinBlocksInfo(*varBase, Step, WriterRank, Block);
+                            mvi->BlocksInfo[0].BufferP = RR.DestinationAddr;
+                            if ((*nameToVarInfo)[varBase->m_Name] == nullptr)
+                            {
+                                // new blocks info for this input variable
+                                (*nameToVarInfo)[varBase->m_Name] =
+                                    std::unique_ptr<MinVarInfo>(std::move(mvi));
+                            }
+                            else
+                            {
+                                // add to existing blocks info for this input variable
+                                (*nameToVarInfo)[varBase->m_Name]->BlocksInfo.push_back(
+                                    mvi->BlocksInfo[0]);
+                            }
+                            IB.BlockIndex =
+                                (*nameToVarInfo)[varBase->m_Name]->BlocksInfo.size() - 1;
+                            derivedInputBlocks->push_back(std::move(IB));
+                        }
+#endif
+                    }
+                    else if (VarRec->Operator != NULL)
+                    {
+                        // need the whole thing for decompression anyway
+                        ReadRequest RR;
+                        RR.Timestep = Step;
+                        RR.WriterRank = WriterRank;
+                        RR.StartOffset = writer_meta_base->DataBlockLocation[Block];
+                        RR.ReadLength = writer_meta_base->DataBlockSize[Block];
+                        RR.DestinationAddr = nullptr;
+                        if (RR.StartOffset == (size_t)-1)
+                            throw std::runtime_error("No data exists for this variable");
+                        if (doAllocTempBuffers)
+                        {
+                            RR.DestinationAddr = AllocReadBuffer(RR.ReadLength);
+                        }
+                        *maxReadSize =
+                            (*maxReadSize < RR.ReadLength ? RR.ReadLength : *maxReadSize);
+                        RR.DirectToAppMemory = false;
+                        RR.ReqIndex = ReqIndex;
+                        RR.BlockID = Block;
+                        RR.OffsetInBlock = 0;
+                        Ret.push_back(RR);
+                    }
+                    else
+                    {
+                        for (size_t Dim = 0; Dim < VarRec->DimCount; Dim++)
+                        {
+                            intersectionstart[Dim] -= writer_meta_base->Offsets[StartDim + Dim];
+                        }
+                        size_t StartOffsetInBlock =
+                            VB->m_ElementSize * LinearIndex(VarRec->DimCount,
+                                                            &writer_meta_base->Count[StartDim],
+                                                            &intersectionstart[0],
+                                                            m_ReaderIsRowMajor);
+                        for (size_t Dim = 0; Dim < VarRec->DimCount; Dim++)
+                        {
+                            intersectionend[Dim] =
+                                intersectionstart[Dim] + intersectioncount[Dim] - 1;
+                        }
+                        size_t EndOffsetInBlock =
+                            VB->m_ElementSize * (LinearIndex(VarRec->DimCount,
+                                                             &writer_meta_base->Count[StartDim],
+                                                             &intersectionend[0],
+                                                             m_ReaderIsRowMajor) +
+                                                 1);
+                        ReadRequest RR;
+                        RR.Timestep = Step;
+                        RR.WriterRank = WriterRank;
+                        RR.StartOffset =
+                            writer_meta_base->DataBlockLocation[Block] + StartOffsetInBlock;
+                        if (writer_meta_base->DataBlockLocation[Block] == (size_t)-1)
+                            throw std::runtime_error("No data exists for this variable");
+                        RR.ReadLength = EndOffsetInBlock - StartOffsetInBlock;
+                        if (Req->MemSpace != MemorySpace::Host)
+                            RR.DirectToAppMemory = false;
+                        else
+                            RR.DirectToAppMemory =
+                                IsContiguousTransfer(Req, &writer_meta_base->Offsets[StartDim],
+                                                     &writer_meta_base->Count[StartDim]);
+                        if (RR.DirectToAppMemory)
+                        {
+                            /*
+                             * ContigOffset handles the case where our
+                             * destination is not the start of the
+                             * destination memory (because some other block
+                             * filled in that start)
+                             */
+                            std::array<size_t, helper::MAX_DIMS> SelPos;
+                            for (size_t Dim = 0; Dim < VarRec->DimCount; Dim++)
+                            {
+                                SelPos[Dim] = intersectionstart[Dim] +
+                                              writer_meta_base->Offsets[StartDim + Dim] -
+                                              Req->Start[Dim];
+                            }
+                            const size_t ContigOffset =
+                                VB->m_ElementSize * LinearIndex(VarRec->DimCount,
+                                                                Req->Count.data(), &SelPos[0],
+                                                                m_ReaderIsRowMajor);
+                            RR.DestinationAddr = (char *)Req->Data + ContigOffset;
+                        }
+                        else
+                        {
+                            const size_t IntersectionLength =
+                                VB->m_ElementSize *
+                                CalcBlockLength(VarRec->DimCount, &intersectioncount[0]);
+                            RR.DestinationAddr = nullptr;
+                            if (m_AllowStridedReads && VB->m_MemoryStart.empty() &&
+                                (Req->MemSpace == MemorySpace::Host) &&
+                                ScatteredRunsAreWhole(VarRec->DimCount,
+                                                      &writer_meta_base->Count[StartDim],
+                                                      Req->Count.data(), &intersectioncount[0],
+                                                      m_ReaderIsRowMajor))
+                            {
+                                // scatter the runs of the selection straight
+                                // into the application buffer, see
+                                // StridedReadRuns()
+                                RR.Strided = true;
+                                RR.DirectToAppMemory = true;
+                                RR.ReadLength = IntersectionLength;
+                                RR.DestinationAddr = (char *)Req->Data;
+                            }
+                            else if (m_AllowStridedReads && VB->m_MemoryStart.empty() &&
+                                     (IntersectionLength < RR.ReadLength))
+                            {
+                                // read only the runs of the selection, see StridedReadRuns()
+                                RR.Strided = true;
+                                RR.ReadLength = IntersectionLength;
+                            }
+                            if (!RR.DirectToAppMemory)
+                            {
+                                if (doAllocTempBuffers)
+                                {
+                                    RR.DestinationAddr = AllocReadBuffer(RR.ReadLength);
+                                }
+                                *maxReadSize =
+                                    (*maxReadSize < RR.ReadLength ? RR.ReadLength : *maxReadSize);
+                            }
+                        }
+                        RR.OffsetInBlock = StartOffsetInBlock;
+                        RR.ReqIndex = ReqIndex;
+                        RR.BlockID = Block;
+                        Ret.push_back(RR);
+                    }
+                };
+
+                std::vector<std::pair<size_t, size_t>> IndexedList;
                 for (size_t Step = StepLoopStart; Step < StepLoopEnd; Step++)
                 {
+                    if (IndexedBlocks(VarRec, Step, Req, IndexedList))
+                    {
+                        // only visit the blocks the index says may intersect
+                        for (const auto &WriterBlock : IndexedList)
+                        {
+                            MetaArrayRecOperator *writer_meta_base =
+                                (MetaArrayRecOperator *)GetMetadataBase(VarRec, Step,
+                                                                        WriterBlock.first);
+                            GlobalBlockRequests(Step, WriterBlock.first, writer_meta_base,
+                                                WriterBlock.second);
+                        }
+                        continue;
+                    }
                     const size_t writerCohortSize = WriterCohortSize(Step);
                     for (size_t WriterRank = 0; WriterRank < writerCohortSize; WriterRank++)
                     {
@@ -1701,159 +2615,7 @@ BP5Deserializer::GenerateReadRequests(const bool doAllocTempBuffers, size_t *max
 
                         for (size_t Block = 0; Block < writer_meta_base->BlockCount; Block++)
                         {
-                            std::array<size_t, helper::MAX_DIMS> intersectionstart;
-                            std::array<size_t, helper::MAX_DIMS> intersectionend;
-                            std::array<size_t, helper::MAX_DIMS> intersectioncount;
-
-                            size_t StartDim = Block * VarRec->DimCount;
-                            if (IntersectionStartCount(
-                                    VarRec->DimCount, Req->Start.data(), Req->Count.data(),
-                                    &writer_meta_base->Offsets[StartDim],
-                                    &writer_meta_base->Count[StartDim], &intersectionstart[0],
-                                    &intersectioncount[0]))
-                            {
-                                if (VarRec->Derived)
-                                {
-#ifdef ADIOS2_HAVE_DERIVED_VARIABLE
-                                    for (auto varBase : derivedVarInputVarList)
-                                    {
-                                        ReadRequest RR;
-                                        BP5VarRec *VarPrimaryRec = VarByName.at(varBase->m_Name);
-                                        MetaArrayRecOperator *writer_meta_base_input =
-                                            (MetaArrayRecOperator *)GetMetadataBase(
-                                                VarPrimaryRec, Step, WriterRank);
-                                        RR.Timestep = Step;
-                                        RR.WriterRank = WriterRank;
-                                        RR.StartOffset =
-                                            writer_meta_base_input->DataBlockLocation[Block];
-                                        // read whole block
-                                        size_t InputStartDim = Block * writer_meta_base_input->Dims;
-                                        RR.ReadLength =
-                                            helper::GetDataTypeSize(VarPrimaryRec->Type) *
-                                            CalcBlockLength(
-                                                writer_meta_base_input->Dims,
-                                                &writer_meta_base_input->Count[InputStartDim]);
-                                        RR.DestinationAddr = (char *)malloc(RR.ReadLength);
-                                        RR.DirectToAppMemory = false;
-                                        RR.ReqIndex = ReqIndex;
-                                        RR.BlockID = Block;
-                                        RR.OffsetInBlock = 0;
-                                        Ret.push_back(RR);
-                                        auto mvi = m_Engine->MinBlocksInfo(*varBase, Step,
-                                                                           WriterRank, Block);
-                                        mvi->BlocksInfo[0].BufferP = RR.DestinationAddr;
-                                        if ((*nameToVarInfo)[varBase->m_Name] == nullptr)
-                                        {
-                                            // new blocks info for this input variable
-                                            (*nameToVarInfo)[varBase->m_Name] =
-                                                std::unique_ptr<MinVarInfo>(std::move(mvi));
-                                        }
-                                        else
-                                        {
-                                            // add to existing blocks info for this input variable
-                                            (*nameToVarInfo)[varBase->m_Name]->BlocksInfo.push_back(
-                                                mvi->BlocksInfo[0]);
-                                        }
-                                    }
-#endif
-                                }
-                                else if (VarRec->Operator != NULL)
-                                {
-                                    // need the whole thing for decompression anyway
-                                    ReadRequest RR;
-                                    RR.Timestep = Step;
-                                    RR.WriterRank = WriterRank;
-                                    RR.StartOffset = writer_meta_base->DataBlockLocation[Block];
-                                    RR.ReadLength = writer_meta_base->DataBlockSize[Block];
-                                    RR.DestinationAddr = nullptr;
-                                    if (RR.StartOffset == (size_t)-1)
-                                        throw std::runtime_error(
-                                            "No data exists for this variable");
-                                    if (doAllocTempBuffers)
-                                    {
-                                        RR.DestinationAddr = (char *)malloc(RR.ReadLength);
-                                    }
-                                    *maxReadSize = (*maxReadSize < RR.ReadLength ? RR.ReadLength
-                                                                                 : *maxReadSize);
-                                    RR.DirectToAppMemory = false;
-                                    RR.ReqIndex = ReqIndex;
-                                    RR.BlockID = Block;
-                                    RR.OffsetInBlock = 0;
-                                    Ret.push_back(RR);
-                                }
-                                else
-                                {
-                                    for (size_t Dim = 0; Dim < VarRec->DimCount; Dim++)
-                                    {
-                                        intersectionstart[Dim] -=
-                                            writer_meta_base->Offsets[StartDim + Dim];
-                                    }
-                                    size_t StartOffsetInBlock =
-                                        VB->m_ElementSize *
-                                        LinearIndex(VarRec->DimCount,
-                                                    &writer_meta_base->Count[StartDim],
-                                                    &intersectionstart[0], m_ReaderIsRowMajor);
-                                    for (size_t Dim = 0; Dim < VarRec->DimCount; Dim++)
-                                    {
-                                        intersectionend[Dim] =
-                                            intersectionstart[Dim] + intersectioncount[Dim] - 1;
-                                    }
-                                    size_t EndOffsetInBlock =
-                                        VB->m_ElementSize *
-                                        (LinearIndex(VarRec->DimCount,
-                                                     &writer_meta_base->Count[StartDim],
-                                                     &intersectionend[0], m_ReaderIsRowMajor) +
-                                         1);
-                                    ReadRequest RR;
-                                    RR.Timestep = Step;
-                                    RR.WriterRank = WriterRank;
-                                    RR.StartOffset = writer_meta_base->DataBlockLocation[Block] +
-                                                     StartOffsetInBlock;
-                                    if (writer_meta_base->DataBlockLocation[Block] == (size_t)-1)
-                                        throw std::runtime_error(
-                                            "No data exists for this variable");
-                                    RR.ReadLength = EndOffsetInBlock - StartOffsetInBlock;
-                                    if (Req->MemSpace != MemorySpace::Host)
-                                        RR.DirectToAppMemory = false;
-                                    else
-                                        RR.DirectToAppMemory = IsContiguousTransfer(
-                                            Req, &writer_meta_base->Offsets[StartDim],
-                                            &writer_meta_base->Count[StartDim]);
-                                    if (RR.DirectToAppMemory)
-                                    {
-                                        /*
-                                         * DirectToAppMemory handles only 1D, so offset
-                                         * calc is 1D only for the moment ContigOffset
-                                         * handles the case where our destination is not
-                                         * the start of the destination memory (because
-                                         * some other block filled in that start)
-                                         */
-
-                                        ssize_t ContigOffset =
-                                            (writer_meta_base->Offsets[StartDim + 0] -
-                                             Req->Start[0]) *
-                                            VB->m_ElementSize;
-                                        if (ContigOffset < 0)
-                                            ContigOffset = 0;
-                                        RR.DestinationAddr = (char *)Req->Data + ContigOffset;
-                                    }
-                                    else
-                                    {
-                                        RR.DestinationAddr = nullptr;
-                                        if (doAllocTempBuffers)
-                                        {
-                                            RR.DestinationAddr = (char *)malloc(RR.ReadLength);
-                                        }
-                                        *maxReadSize =
-                                            (*maxReadSize < RR.ReadLength ? RR.ReadLength
-                                                                          : *maxReadSize);
-                                    }
-                                    RR.OffsetInBlock = StartOffsetInBlock;
-                                    RR.ReqIndex = ReqIndex;
-                                    RR.BlockID = Block;
-                                    Ret.push_back(RR);
-                                }
-                            }
+                            GlobalBlockRequests(Step, WriterRank, writer_meta_base, Block);
                         }
                     }
                 }
@@ -1872,6 +2634,109 @@ BP5Deserializer::GenerateReadRequests(const bool doAllocTempBuffers, size_t *max
     return Ret;
 }
 
+void BP5Deserializer::StridedReadRuns(const ReadRequest &Read, std::vector<ReadRun> &Runs)
+{
+    const auto &Req = PendingGetRequests[Read.ReqIndex];
+    auto VarRec = (struct BP5VarRec *)Req.VarRec;
+    VariableBase *VB = static_cast<VariableBase *>(VarRec->Variable);
+    MetaArrayRec *writer_meta_base =
+        (MetaArrayRec *)GetMetadataBase(VarRec, Read.Timestep, Read.WriterRank);
+    const size_t DimCount = VarRec->DimCount;
+    const size_t *BlockOffsets = &writer_meta_base->Offsets[Read.BlockID * DimCount];
+    const size_t *BlockCounts = &writer_meta_base->Count[Read.BlockID * DimCount];
+
+    std::array<size_t, helper::MAX_DIMS> IStart, ICount;
+    std::array<size_t, helper::MAX_DIMS> Start, Count, BlockCount, Pos;
+    std::array<size_t, helper::MAX_DIMS> BlockOffset, SelStart, SelCount;
+    IntersectionStartCount(DimCount, Req.Start.data(), Req.Count.data(), BlockOffsets,
+                           BlockCounts, &IStart[0], &ICount[0]);
+    // block-relative, slowest varying dimension first
+    for (size_t Dim = 0; Dim < DimCount; Dim++)
+    {
+        const size_t From = m_ReaderIsRowMajor ? Dim : DimCount - 1 - Dim;
+        Start[Dim] = IStart[From] - BlockOffsets[From];
+        Count[Dim] = ICount[From];
+        BlockCount[Dim] = BlockCounts[From];
+        Pos[Dim] = Start[Dim];
+        BlockOffset[Dim] = BlockOffsets[From];
+        SelStart[Dim] = Req.Start[From];
+        SelCount[Dim] = Req.Count[From];
+    }
+
+    // each run covers dimensions [Inner, DimCount) of the intersection,
+    // which have to be contiguous in the destination as well
+    size_t Inner = DimCount - 1;
+    while ((Inner > 0) && (Count[Inner] == BlockCount[Inner]) &&
+           (!Read.DirectToAppMemory || (Count[Inner] == SelCount[Inner])))
+    {
+        Inner--;
+    }
+    size_t RunLength = VB->m_ElementSize;
+    for (size_t Dim = Inner; Dim < DimCount; Dim++)
+    {
+        RunLength *= Count[Dim];
+    }
+
+    Runs.clear();
+    const size_t BlockStart = writer_meta_base->DataBlockLocation[Read.BlockID];
+    std::array<size_t, helper::MAX_DIMS> SelPos;
+    size_t DestOffset = 0;
+    while (true)
+    {
+        if (Read.DirectToAppMemory)
+        {
+            // offset in the application buffer, which holds the selection
+            for (size_t Dim = 0; Dim < DimCount; Dim++)
+            {
+                SelPos[Dim] = Pos[Dim] + BlockOffset[Dim] - SelStart[Dim];
+            }
+            DestOffset = VB->m_ElementSize * LinearIndex(DimCount, &SelCount[0], &SelPos[0], true);
+        }
+        Runs.push_back({BlockStart + VB->m_ElementSize *
+                                         LinearIndex(DimCount, &BlockCount[0], &Pos[0], true),
+                        RunLength, DestOffset});
+        if (!Read.DirectToAppMemory)
+        {
+            DestOffset += RunLength; // packed
+        }
+        // advance over the dimensions outside of the run
+        size_t Dim = Inner;
+        for (; Dim > 0; Dim--)
+        {
+            if (++Pos[Dim - 1] < Start[Dim - 1] + Count[Dim - 1])
+            {
+                break;
+            }
+            Pos[Dim - 1] = Start[Dim - 1];
+        }
+        if (Dim == 0)
+        {
+            break;
+        }
+    }
+}
+
+char *BP5Deserializer::AllocReadBuffer(size_t Size)
+{
+    if (m_ReadBufferPool)
+    {
+        return m_ReadBufferPool->Get(Size);
+    }
+    return (char *)malloc(Size);
+}
+
+void BP5Deserializer::FreeReadBuffer(char *Buffer)
+{
+    if (m_ReadBufferPool)
+    {
+        m_ReadBufferPool->Release(Buffer);
+    }
+    else
+    {
+        free(Buffer);
+    }
+}
+
 void BP5Deserializer::FinalizeGet(const ReadRequest &Read, const bool freeAddr)
 {
     auto &Req = PendingGetRequests[Read.ReqIndex];
@@ -1903,7 +2768,8 @@ void BP5Deserializer::FinalizeGet(const ReadRequest &Read, const bool freeAddr)
     const size_t *SelSize = NULL;
     char *IncomingData = Read.DestinationAddr;
     char *VirtualIncomingData = Read.DestinationAddr - Read.OffsetInBlock;
-    std::vector<char> decompressBuffer;
+    std::unique_ptr<char, std::function<void(char *)>> decompressBuffer(
+        nullptr, [this](char *Buffer) { FreeReadBuffer(Buffer); });
     if (((struct BP5VarRec *)Req.VarRec)->Operator != NULL)
     {
         size_t DestSize = ((struct BP5VarRec *)Req.VarRec)->ElementSize;
@@ -1911,7 +2777,7 @@ void BP5Deserializer::FinalizeGet(const ReadRequest &Read, const bool freeAddr)
         {
             DestSize *= writer_meta_base->Count[dim + Read.BlockID * writer_meta_base->Dims];
         }
-        decompressBuffer.resize(DestSize);
+        decompressBuffer.reset(AllocReadBuffer(DestSize));
 
         // Get the operator of the variable if exists or create one
         std::shared_ptr<Operator> op = nullptr;
@@ -1933,10 +2799,10 @@ void BP5Deserializer::FinalizeGet(const ReadRequest &Read, const bool freeAddr)
             core::Decompress(
                 IncomingData,
                 ((MetaArrayRecOperator *)writer_meta_base)->DataBlockSize[Read.BlockID],
-                decompressBuffer.data(), Req.MemSpace, op);
+                decompressBuffer.get(), Req.MemSpace, op);
             VB->m_AccuracyProvided = op->GetAccuracy();
         }
-        IncomingData = decompressBuffer.data();
+        IncomingData = decompressBuffer.get();
         VirtualIncomingData = IncomingData;
     }
     if (Req.Start.size())
@@ -1947,6 +2813,16 @@ void BP5Deserializer::FinalizeGet(const ReadRequest &Read, const bool freeAddr)
     {
         SelSize = Req.Count.data();
     }
+    std::array<size_t, helper::MAX_DIMS> StridedOffset, StridedSize;
+    if (Read.Strided)
+    {
+        // only the intersection of block and selection is in the buffer
+        IntersectionStartCount(DimCount, RankOffset, RankSize, SelOffset, SelSize,
+                               &StridedOffset[0], &StridedSize[0]);
+        RankOffset = &StridedOffset[0];
+        RankSize = &StridedSize[0];
+        VirtualIncomingData = IncomingData;
+    }
     if (Req.RequestType == Local)
     {
         RankOffset = ZeroRankOffset.data();
@@ -2034,7 +2910,7 @@ void BP5Deserializer::FinalizeGet(const ReadRequest &Read, const bool freeAddr)
     }
     if (freeAddr)
     {
-        free((char *)Read.DestinationAddr);
+        FreeReadBuffer(Read.DestinationAddr);
     }
 }
 
@@ -2051,6 +2927,24 @@ void BP5Deserializer::FinalizeDerivedGets(std::vector<ReadRequest> &Reads)
         auto derivedVar = static_cast<VariableDerived *>(derivedMap.at(VarRec->VarName).get());
 
         auto nameToVarInfo = Req.DerivedInputMap;
+        // the expression is applied to the region of each input block that was read
+        for (auto &IB : *Req.DerivedInputBlocks)
+        {
+            auto &mbi = (*nameToVarInfo)[IB.VarName]->BlocksInfo[IB.BlockIndex];
+            if (IB.Gather)
+            {
+                char *Region = AllocReadBuffer(IB.ElementSize * helper::GetTotalSize(IB.Count));
+                // the read buffer starts OffsetInBlock bytes into the block
+                const char *VirtualBlock = (const char *)mbi.BufferP - IB.OffsetInBlock;
+                helper::NdCopy(VirtualBlock, IB.BlockStart, IB.BlockCount, true, true, Region,
+                               IB.Start, IB.Count, true, true, IB.ElementSize, CoreDims(),
+                               CoreDims(), CoreDims(), CoreDims(), false);
+                FreeReadBuffer((char *)mbi.BufferP);
+                mbi.BufferP = Region;
+            }
+            mbi.Start = IB.Start.data();
+            mbi.Count = IB.Count.data();
+        }
         auto DerivedBlockData = derivedVar->ApplyExpression(*nameToVarInfo);
 
         for (size_t i = 0; i < DerivedBlockData.size(); i++)
@@ -2070,15 +2964,20 @@ void BP5Deserializer::FinalizeDerivedGets(std::vector<ReadRequest> &Reads)
         {
             for (auto &mbi : entry.second->BlocksInfo)
             {
-                free(mbi.BufferP);
+                FreeReadBuffer((char *)mbi.BufferP);
             }
         }
         delete nameToVarInfo;
+        delete Req.DerivedInputBlocks;
     }
 #endif
 }
 
-void BP5Deserializer::ClearGetState() { PendingGetRequests.clear(); }
+void BP5Deserializer::ClearGetState()
+{
+    PendingGetRequests.clear();
+    ReleaseInstalledSteps();
+}
 
 void BP5Deserializer::FinalizeGets(std::vector<ReadRequest> &Reads)
 {
@@ -2154,6 +3053,14 @@ BP5Deserializer::BP5Deserializer(bool WriterIsRowMajor, bool ReaderIsRowMajor,
 BP5Deserializer::~BP5Deserializer()
 {
     struct ControlInfo *tmp = ControlBlocks;
+    for (FFSContext Context : m_ScanFFSContexts)
+    {
+        free_FFSContext(Context);
+    }
+    for (FFSContext Context : m_DecodeFFSContexts)
+    {
+        free_FFSContext(Context);
+    }
     free_FFSContext(ReaderFFSContext);
     ControlBlocks = NULL;
     while (tmp)
@@ -2189,6 +3096,13 @@ BP5Deserializer::~BP5Deserializer()
     {
         delete step;
     }
+    for (auto &Decoded : m_DecodedMetadata)
+    {
+        for (void *BaseData : Decoded.second)
+        {
+            free(BaseData);
+        }
+    }
     for (auto &pvec : JoinedDimArray)
     {
         for (auto &p : pvec)
@@ -2201,7 +3115,7 @@ BP5Deserializer::~BP5Deserializer()
     }
 }
 
-void *BP5Deserializer::GetMetadataBase(BP5VarRec *VarRec, size_t Step, size_t WriterRank) const
+void *BP5Deserializer::GetMetadataBase(BP5VarRec *VarRec, size_t Step, size_t WriterRank)
 {
     MetaArrayRec *writer_meta_base = NULL;
     if (m_RandomAccessMode)
@@ -2217,6 +3131,16 @@ void *BP5Deserializer::GetMetadataBase(BP5VarRec *VarRec, size_t Step, size_t Wr
             // Var does not appear in this record
             return NULL;
         }
+        if ((Step >= MetadataBaseArray.size()) || (MetadataBaseArray[Step] == nullptr))
+        {
+            // scanned but not installed yet, or released
+            InstallStep(Step, true);
+        }
+        if ((Step < m_StepLastUse.size()) && (m_StepLastUse[Step] != m_Operation))
+        {
+            // the read threads only find steps used in this operation
+            m_StepLastUse[Step] = m_Operation;
+        }
         size_t CI_VarIndex = (*CI->CIVarIndex)[VarRec->VarNum];
         BP5MetadataInfoStruct *BaseData =
             (BP5MetadataInfoStruct *)(*MetadataBaseArray[Step])[WriterRank];
@@ -2244,6 +3168,7 @@ void *BP5Deserializer::GetMetadataBase(BP5VarRec *VarRec, size_t Step, size_t Wr
 
 MinVarInfo *BP5Deserializer::MinBlocksInfo(const VariableBase &Var, size_t RelStep)
 {
+    ReleaseInstalledSteps();
     auto PossiblyAddValueBlocks = [this](MinVarInfo *MV, BP5VarRec *VarRec, size_t &Id,
                                          const size_t AbsStep) {
         const size_t writerCohortSize = WriterCohortSize(AbsStep);
@@ -2363,6 +3288,13 @@ MinVarInfo *BP5Deserializer::MinBlocksInfo(const VariableBase &Var, size_t RelSt
             {
                 MMs = *(MinMaxStruct **)(((char *)writer_meta_base) + VarRec->MinMaxOffset);
             }
+            MetaSubBlockStats *SubBlocks = NULL;
+            if (VarRec->SubBlockStatsOffset != SIZE_MAX)
+            {
+                SubBlocks = (MetaSubBlockStats *)(((char *)writer_meta_base) +
+                                                  VarRec->SubBlockStatsOffset);
+            }
+            size_t SubBlockPos = 0;
             for (size_t i = 0; i < WriterBlockCount; i++)
             {
                 size_t *Offsets = NULL;
@@ -2385,6 +3317,11 @@ MinVarInfo *BP5Deserializer::MinBlocksInfo(const VariableBase &Var, size_t RelSt
                     ApplyElementMinMax(Blk.MinMax, VarRec->Type, (void *)BlockMinAddr);
                     ApplyElementMinMax(Blk.MinMax, VarRec->Type, (void *)BlockMaxAddr);
                 }
+                if (SubBlocks)
+                {
+                    SubBlockPos = ApplySubBlockStats(Blk, SubBlocks, MV->Dims, i, SubBlockPos,
+                                                     VarRec->ElementSize);
+                }
                 // Blk.BufferP
                 MV->BlocksInfo.push_back(Blk);
             }
@@ -2396,6 +3333,7 @@ MinVarInfo *BP5Deserializer::MinBlocksInfo(const VariableBase &Var, size_t RelSt
 MinVarInfo *BP5Deserializer::MinBlocksInfo(const VariableBase &Var, size_t RelStep,
                                            size_t WriterRank, size_t BlockID)
 {
+    ReleaseInstalledSteps();
     // this is only called for global and local arrays, so limited
     BP5VarRec *VarRec = LookupVarByKey((void *)&Var);
 
@@ -2480,12 +3418,47 @@ MinVarInfo *BP5Deserializer::MinBlocksInfo(const VariableBase &Var, size_t RelSt
             ApplyElementMinMax(Blk.MinMax, VarRec->Type, (void *)BlockMinAddr);
             ApplyElementMinMax(Blk.MinMax, VarRec->Type, (void *)BlockMaxAddr);
         }
+        if (VarRec->SubBlockStatsOffset != SIZE_MAX)
+        {
+            MetaSubBlockStats *SubBlocks = (MetaSubBlockStats *)(((char *)writer_meta_base) +
+                                                                 VarRec->SubBlockStatsOffset);
+            size_t SubBlockPos = 0;
+            for (size_t i = 0; (i < BlockID) && (SubBlockPos != SIZE_MAX); i++)
+            {
+                MinBlockInfo Skipped;
+                SubBlockPos = ApplySubBlockStats(Skipped, SubBlocks, MV->Dims, i, SubBlockPos,
+                                                 VarRec->ElementSize);
+            }
+            ApplySubBlockStats(Blk, SubBlocks, MV->Dims, BlockID, SubBlockPos,
+                               VarRec->ElementSize);
+        }
         // Blk.BufferP
         MV->BlocksInfo.push_back(Blk);
     }
     return MV;
 }
 
+/* point Blk at the sub-block min/max of block BlockNum of a writer, which
+ * start at FirstSubBlock.  Returns where the sub-blocks of the next block
+ * start, SIZE_MAX if the metadata has no consistent sub-blocks */
+static size_t ApplySubBlockStats(MinBlockInfo &Blk, const BP5Base::MetaSubBlockStats *SubBlocks,
+                                 const size_t Dims, const size_t BlockNum, size_t FirstSubBlock,
+                                 const size_t ElementSize)
+{
+    if ((FirstSubBlock == SIZE_MAX) || !SubBlocks->SubBlockDiv || !SubBlocks->SubBlockMinMax)
+        return SIZE_MAX;
+    const size_t *Div = SubBlocks->SubBlockDiv + BlockNum * Dims;
+    size_t Count = 1;
+    for (size_t d = 0; d < Dims; d++)
+        Count *= Div[d];
+    if (FirstSubBlock + Count > SubBlocks->SubBlockCount)
+        return SIZE_MAX;
+    Blk.SubBlockCount = Count;
+    Blk.SubBlockDiv = Div;
+    Blk.SubBlockMinMax = SubBlocks->SubBlockMinMax + 2 * FirstSubBlock * ElementSize;
+    return FirstSubBlock + Count;
+}
+
 static void ApplyElementMinMax(MinMaxStruct &MinMax, DataType Type, void *Element)
 {
     switch (Type)
@@ -2606,22 +3579,11 @@ void BP5Deserializer::GetAbsoluteSteps(const VariableBase &Var, std::vector<size
     if (!m_RandomAccessMode)
         return;
 
-    for (size_t Step = 0; Step < m_ControlArray.size(); Step++)
-    {
-        for (size_t WriterRank = 0; WriterRank < WriterCohortSize(Step); WriterRank++)
-        {
-            MetaArrayRec *writer_meta_base =
-                (MetaArrayRec *)GetMetadataBase(VarRec, Step, WriterRank);
-            if (writer_meta_base)
-            {
-                keys.push_back(Step);
-                break;
-            }
-        }
-    }
+    // the steps the variable was written on, without installing any step
+    keys.insert(keys.end(), VarRec->AbsStepFromRel.begin(), VarRec->AbsStepFromRel.end());
 }
 
-bool BP5Deserializer::VarShape(const VariableBase &Var, const size_t RelStep, Dims &Shape) const
+bool BP5Deserializer::VarShape(const VariableBase &Var, const size_t RelStep, Dims &Shape)
 {
     BP5VarRec *VarRec = LookupVarByKey((void *)&Var);
     if (!((VarRec->OrigShapeID == ShapeID::GlobalArray) ||
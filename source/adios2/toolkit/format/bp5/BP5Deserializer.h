@@ -12,12 +12,18 @@
 #include "adios2/core/Attribute.h"
 #include "adios2/core/IO.h"
 #include "adios2/core/Variable.h"
+#include "adios2/helper/adiosThreadPool.h"
+#include "adios2/toolkit/profiling/iochrono/IOChrono.h"
 
 #include "BP5Base.h"
+#include "BP5ReadBufferPool.h"
 #include "atl.h"
 #include "ffs.h"
 #include "fm.h"
 
+#include <functional>
+#include <map>
+#include <memory>
 #include <mutex>
 
 #ifdef _WIN32
@@ -51,13 +57,32 @@ public:
         size_t ReqIndex;
         size_t OffsetInBlock;
         size_t BlockID;
+        // Only the contiguous runs of the selection are read, ReadLength is
+        // their total.  See StridedReadRuns().
+        bool Strided = false;
     };
     void InstallMetaMetaData(MetaMetaInfoBlock &MMList);
     void InstallMetaData(void *MetadataBlock, size_t BlockLen, size_t WriterRank,
                          size_t Step = SIZE_MAX);
+    /* install the metadata blocks of all writers of a step, the same as
+     * calling InstallMetaData for each writer in order, but the blocks are
+     * decoded on up to m_Threads threads */
+    void InstallMetaData(const std::vector<std::pair<void *, size_t>> &Blocks,
+                         size_t Step = SIZE_MAX);
     void InstallAttributeData(void *AttributeBlock, size_t BlockLen, size_t Step = SIZE_MAX);
     void InstallAttributesV1(FFSTypeHandle FFSformat, void *BaseData, size_t Step);
     void InstallAttributesV2(FFSTypeHandle FFSformat, void *BaseData, size_t Step);
+    /* random access mode: take note of the metadata block of a writer for a
+     * step without installing it.  Only the bitfield of the variables written
+     * is decoded, to extend the list of steps of each variable.  The step is
+     * installed when it is first used, or right away if it defines new
+     * variables.  The block must stay in memory and unchanged.
+     */
+    void ScanMetaData(void *MetadataBlock, size_t BlockLen, size_t WriterRank, size_t Step);
+    /* scan the metadata blocks of all writers of a step, the same as calling
+     * ScanMetaData for each writer in order, but the bitfields are decoded on
+     * up to m_Threads threads */
+    void ScanMetaData(const std::vector<std::pair<void *, size_t>> &Blocks, size_t Step);
 
     void SetupForStep(size_t Step, size_t WriterCount);
     // return from QueueGet is true if a sync is needed to fill the data
@@ -75,6 +100,17 @@ public:
      */
     std::vector<ReadRequest> GenerateReadRequests(const bool doAllocTempBuffers,
                                                   size_t *maxReadSize);
+    struct ReadRun
+    {
+        size_t Offset; // relative to the same origin as ReadRequest::StartOffset
+        size_t Length;
+        size_t DestOffset; // relative to ReadRequest::DestinationAddr
+    };
+    /* return the contiguous runs that make up a Strided read request, in
+     * increasing offset order.  Runs of a DirectToAppMemory request are
+     * placed in the application buffer, others are packed back to back.
+     */
+    void StridedReadRuns(const ReadRequest &Read, std::vector<ReadRun> &Runs);
     void FinalizeGet(const ReadRequest &, const bool freeAddr);
     void FinalizeGets(std::vector<ReadRequest> &);
     void FinalizeDerivedGets(std::vector<ReadRequest> &);
@@ -85,7 +121,7 @@ public:
     MinVarInfo *MinBlocksInfo(const VariableBase &Var, const size_t Step);
     MinVarInfo *MinBlocksInfo(const VariableBase &Var, const size_t Step, const size_t WriterID,
                               const size_t BlockID);
-    bool VarShape(const VariableBase &, const size_t Step, Dims &Shape) const;
+    bool VarShape(const VariableBase &, const size_t Step, Dims &Shape);
     bool VariableMinMax(const VariableBase &var, const size_t Step, MinMaxStruct &MinMax);
     char *VariableExprStr(const VariableBase &var);
     void GetAbsoluteSteps(const VariableBase &variable, std::vector<size_t> &keys) const;
@@ -93,6 +129,23 @@ public:
     const bool m_WriterIsRowMajor;
     const bool m_ReaderIsRowMajor;
     core::Engine *m_Engine = NULL;
+    // the engine can read Strided requests (see ReadRequest)
+    bool m_AllowStridedReads = false;
+    // if set, temporary read buffers come from (and go back to) this pool
+    BP5ReadBufferPool *m_ReadBufferPool = nullptr;
+    // if set, counts the steps installed and released in random access mode
+    profiling::JSONProfiler *m_Profiler = nullptr;
+    // random access mode: how many steps installed on demand are kept between
+    // operations, 0 keeps all of them; if set, all metadata is decoded into
+    // allocated memory
+    size_t m_MaxInstalledSteps = 0;
+    // the metadata blocks are shared with other processes, decode them into
+    // allocated memory instead of in place
+    bool m_ReadOnlyMetadata = false;
+    // threads decoding the metadata blocks of a step
+    unsigned int m_Threads = 1;
+    char *AllocReadBuffer(size_t Size);
+    void FreeReadBuffer(char *Buffer);
 
     enum RequestTypeEnum
     {
@@ -100,6 +153,27 @@ public:
         Local = 1
     };
 
+    /*
+     * The part of one block of an input of a derived variable that a derived
+     * read needs: the selection and the halo of the expression, clipped to the
+     * block.  Only the bytes from the first to the last element of the region
+     * are read, OffsetInBlock bytes into the block.  Gather is set when those
+     * bytes are more than the region and it has to be compacted before the
+     * expression is applied.
+     */
+    struct DerivedInputBlock
+    {
+        std::string VarName;
+        size_t BlockIndex; // in the BlocksInfo of VarName in DerivedInputMap
+        size_t ElementSize;
+        size_t OffsetInBlock;
+        bool Gather;
+        Dims BlockStart;
+        Dims BlockCount;
+        Dims Start;
+        Dims Count;
+    };
+
     struct BP5ArrayRequest
     {
         void *VarRec = NULL;
@@ -112,12 +186,38 @@ public:
         Dims Count;
         MemorySpace MemSpace;
         std::map<std::string, std::unique_ptr<MinVarInfo>> *DerivedInputMap;
+        std::vector<DerivedInputBlock> *DerivedInputBlocks;
         void *Data;
     };
     std::vector<BP5ArrayRequest> PendingGetRequests;
 
 private:
     size_t m_VarCount = 0;
+
+    /*
+     * Spatial index over the blocks of one global array variable on one
+     * step.  For each dimension, the blocks of all writers are kept
+     * sorted by their start offset in that dimension.  Together with the
+     * largest block extent in that dimension, this bounds the range of
+     * blocks that can possibly intersect a selection, so that read
+     * planning doesn't have to visit every block of every writer.
+     */
+    struct BlockIndexEntry
+    {
+        size_t Start;
+        size_t End; // inclusive
+        size_t WriterRank;
+        size_t Block;
+    };
+
+    struct BP5BlockIndex
+    {
+        size_t Uses = 0; // global requests planned against this step
+        bool Built = false;
+        std::vector<std::vector<BlockIndexEntry>> ByDim;
+        std::vector<size_t> MaxExtent;
+    };
+
     struct BP5VarRec
     {
         size_t VarNum;
@@ -137,12 +237,14 @@ private:
         DataType Type;
         int ElementSize = 0;
         size_t MinMaxOffset = SIZE_MAX;
+        size_t SubBlockStatsOffset = SIZE_MAX; // MetaSubBlockStats
         size_t *GlobalDims = NULL;
         size_t LastTSAdded = SIZE_MAX;
         size_t FirstTSSeen = SIZE_MAX;
         size_t LastStepAdded = SIZE_MAX;
         std::vector<size_t> AbsStepFromRel; // per relative step vector
         std::vector<size_t> PerWriterMetaFieldOffset;
+        std::unordered_map<size_t, BP5BlockIndex> BlockIndexByStep; // by absolute step
     };
 
     struct ControlStruct
@@ -209,7 +311,48 @@ private:
     std::vector<std::vector<size_t *>> JoinedDimArray;
     size_t JDAIdx = 0;
 
+    // for random access mode, for each timestep, for each writerrank, the
+    // encoded metadata given to ScanMetaData
+    std::vector<std::vector<std::pair<void *, size_t>>> m_EncodedMetadata;
+    // decode only the bitfield of the metadata, see ScanMetaData, one per
+    // scanning thread
+    std::vector<FFSContext> m_ScanFFSContexts;
+    std::vector<char> m_ScanBuffer;
+    // the format of a metadata block in m_ScanFFSContexts[Thread], ready for
+    // decoding the bitfield
+    FFSTypeHandle ScanFormat(size_t Thread, void *MetadataBlock);
+    void ScanDecodedMetaData(BP5MetadataInfoStruct *BaseData, ControlInfo *Control,
+                             void *MetadataBlock, size_t BlockLen, size_t WriterRank, size_t Step);
+    bool m_ScanFoundNewVariable = false;
+    // installing a step that was scanned before, the per variable step
+    // lists are complete
+    bool m_InstallOnDemand = false;
+    // metadata of a step that could not be decoded in place, by step
+    std::map<size_t, std::vector<void *>> m_DecodedMetadata;
+    // the operation that last used a step, see ReleaseInstalledSteps
+    std::vector<size_t> m_StepLastUse;
+    size_t m_Operation = 0;
+    void InstallStep(size_t Step, bool OnDemand);
+    // starts a new operation, and drops the least recently used steps that
+    // were installed on demand beyond m_MaxInstalledSteps
+    void ReleaseInstalledSteps();
+
     ControlInfo *ControlBlocks = nullptr;
+    std::unordered_map<FMFormat, ControlInfo *> m_ControlByFormat;
+    // one per decoding thread, an FFS context may not be used concurrently
+    std::vector<FFSContext> m_DecodeFFSContexts;
+    // workers for the decoding threads beyond the calling one, kept across steps
+    std::unique_ptr<helper::ThreadPool> m_DecodePool;
+    // runs Task(t) for t in [0, nThreads), t = 0 on the calling thread
+    void RunOnThreads(size_t nThreads, const std::function<void(size_t)> &Task);
+    // the format of a metadata block in Context, ready for decoding
+    FFSTypeHandle MetadataFormat(FFSContext Context, void *MetadataBlock);
+    // decodes in place if possible, otherwise into Allocated memory
+    void *DecodeMetaData(FFSContext Context, FFSTypeHandle FFSformat, void *MetadataBlock,
+                         size_t BlockLen, bool &Allocated);
+    void ReverseMetaDataDimensions(const ControlInfo *Control, void *BaseData);
+    void InstallDecodedMetaData(void *BaseData, bool Allocated, ControlInfo *Control,
+                                size_t WriterRank, size_t Step);
     ControlInfo *GetPriorControl(FMFormat Format);
     ControlInfo *BuildControl(FMFormat Format);
     bool NameIndicatesArray(const char *Name);
@@ -220,7 +363,8 @@ private:
     BP5VarRec *CreateVarRec(const char *ArrayName);
     void ReverseDimensions(size_t *Dimensions, size_t count, size_t times);
     const char *BreakdownVarName(const char *Name, DataType *type_p, int *element_size_p);
-    void BreakdownFieldType(const char *FieldType, bool &Operator, bool &MinMax);
+    void BreakdownFieldType(const char *FieldType, bool &Operator, bool &MinMax,
+                            bool &SubBlocks);
     void BreakdownArrayName(const char *Name, char **base_name_p, DataType *type_p,
                             int *element_size_p, FMFormat *Format);
     void BreakdownV1ArrayName(const char *Name, char **base_name_p, DataType *type_p,
@@ -237,8 +381,11 @@ private:
                                     size_t Step, size_t WriterRank);
     void StructQueueReadChecks(core::VariableStruct *variable, BP5VarRec *VarRec);
 
-    void *GetMetadataBase(BP5VarRec *VarRec, size_t Step, size_t WriterRank) const;
+    void *GetMetadataBase(BP5VarRec *VarRec, size_t Step, size_t WriterRank);
     bool IsContiguousTransfer(BP5ArrayRequest *Req, size_t *offsets, size_t *count);
+    void BuildBlockIndex(BP5VarRec *VarRec, size_t Step, BP5BlockIndex &Index);
+    bool IndexedBlocks(BP5VarRec *VarRec, size_t Step, const BP5ArrayRequest *Req,
+                       std::vector<std::pair<size_t, size_t>> &Blocks);
     char *FillBlock(std::map<BP5VarRec *, MinVarInfo *> &map);
 
     size_t CurTimestep = 0;
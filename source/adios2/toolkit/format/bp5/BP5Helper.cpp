@@ -8,6 +8,7 @@
 #include "BP5Helper.h"
 #include "adios2/helper/adiosFunctions.h"
 #include <adios2sys/MD5.h> // Include the MD5 header
+#include <functional>      // bit_or
 #include <iomanip>         // put_time
 
 #include "fm.h"
@@ -292,11 +293,11 @@ void BP5Helper::GathervArraysTwoLevel(helper::Comm &groupComm, helper::Comm &gro
     /*
      * Two-step aggregation of data that requires no intermediate processing
      */
-    Profiler.Start("ES_meta1");
+    Profiler.Start(profiling::TimerID::ES_meta1);
     std::vector<uint64_t> RecvBuffer;
     if (groupComm.Size() > 1)
     { // level 1
-        Profiler.Start("ES_meta1_gather");
+        Profiler.Start(profiling::TimerID::ES_meta1_gather);
         std::vector<size_t> RecvCounts = groupComm.GatherValues(LocalSize, 0);
         if (groupComm.Rank() == 0)
         {
@@ -310,10 +311,10 @@ void BP5Helper::GathervArraysTwoLevel(helper::Comm &groupComm, helper::Comm &gro
         }
         groupComm.GathervArrays(MyContrib, LocalSize, RecvCounts.data(), RecvCounts.size(),
                                 RecvBuffer.data(), 0);
-        Profiler.Stop("ES_meta1_gather");
+        Profiler.Stop(profiling::TimerID::ES_meta1_gather);
     } // level 1
-    Profiler.Stop("ES_meta1");
-    Profiler.Start("ES_meta2");
+    Profiler.Stop(profiling::TimerID::ES_meta1);
+    Profiler.Start(profiling::TimerID::ES_meta2);
     // level 2
     if (groupComm.Rank() == 0)
     {
@@ -321,18 +322,18 @@ void BP5Helper::GathervArraysTwoLevel(helper::Comm &groupComm, helper::Comm &gro
         size_t LocalSize = RecvBuffer.size();
         if (groupLeaderComm.Size() > 1)
         {
-            Profiler.Start("ES_meta2_gather");
+            Profiler.Start(profiling::TimerID::ES_meta2_gather);
             RecvCounts = groupLeaderComm.GatherValues(LocalSize, 0);
             groupLeaderComm.GathervArrays(RecvBuffer.data(), LocalSize, RecvCounts.data(),
                                           RecvCounts.size(), OverallRecvBuffer, 0);
-            Profiler.Stop("ES_meta2_gather");
+            Profiler.Stop(profiling::TimerID::ES_meta2_gather);
         }
         else
         {
             std::cout << "This should never happen" << std::endl;
         }
     } // level 2
-    Profiler.Stop("ES_meta2");
+    Profiler.Stop(profiling::TimerID::ES_meta2);
 }
 
 // clang-format off
@@ -420,25 +421,25 @@ void BP5Helper::BP5AggregateInformation(helper::Comm &mpiComm,
     if (mpiComm.Rank() == 0)
     {
         RecvBuffer.resize(mpiComm.Size() * sizeof(node_contrib));
-        Profiler.Start("FixedMetaInfoGather");
+        Profiler.Start(profiling::TimerID::FixedMetaInfoGather);
         mpiComm.GatherArrays(myFixedContrib.data(), myFixedContrib.size(), RecvBuffer.data(), 0);
-        Profiler.Stop("FixedMetaInfoGather");
+        Profiler.Stop(profiling::TimerID::FixedMetaInfoGather);
         BreakdownFixedIncomingMInfo(mpiComm.Size(), RecvBuffer, SecondRecvCounts, BcastInfo,
                                     WriterDataPositions, MetaEncodeSize, AttrSize, MMBSizes,
                                     MMBIDs);
-        Profiler.Start("MetaInfoBcast");
+        Profiler.Start(profiling::TimerID::MetaInfoBcast);
         mpiComm.Bcast(BcastInfo.data(), BcastInfo.size(), 0, "");
-        Profiler.Stop("MetaInfoBcast");
+        Profiler.Stop(profiling::TimerID::MetaInfoBcast);
     }
     else
     {
-        Profiler.Start("FixedMetaInfoGather");
+        Profiler.Start(profiling::TimerID::FixedMetaInfoGather);
         mpiComm.GatherArrays(myFixedContrib.data(), myFixedContrib.size(), RecvBuffer.data(), 0);
-        Profiler.Stop("FixedMetaInfoGather");
+        Profiler.Stop(profiling::TimerID::FixedMetaInfoGather);
         BcastInfo.resize(mpiComm.Size());
-        Profiler.Start("MetaInfoBcast");
+        Profiler.Start(profiling::TimerID::MetaInfoBcast);
         mpiComm.Bcast(BcastInfo.data(), BcastInfo.size(), 0, "");
-        Profiler.Stop("MetaInfoBcast");
+        Profiler.Stop(profiling::TimerID::MetaInfoBcast);
     }
 
     NeedDynamic = BcastInfo[0] == (size_t)-1;
@@ -457,13 +458,13 @@ void BP5Helper::BP5AggregateInformation(helper::Comm &mpiComm,
             uint64_t TotalSize = 0;
             TotalSize = std::accumulate(RecvCounts.begin(), RecvCounts.end(), size_t(0));
             RecvBuffer.resize(TotalSize);
-            Profiler.Start("DynamicInfo");
+            Profiler.Start(profiling::TimerID::DynamicInfo);
             mpiComm.GathervArrays(myContrib.data(), myContrib.size(), RecvCounts.data(),
                                   RecvCounts.size(), RecvBuffer.data(), 0);
             BreakdownIncomingMInfo(RecvCounts, RecvBuffer, SecondRecvCounts, BcastInfo,
                                    WriterDataPositions, MetaEncodeSize, AttrSize, MMBSizes, MMBIDs);
             mpiComm.Bcast(BcastInfo.data(), BcastInfo.size(), 0, "");
-            Profiler.Stop("DynamicInfo");
+            Profiler.Stop(profiling::TimerID::DynamicInfo);
         }
         else
         {
@@ -473,7 +474,9 @@ void BP5Helper::BP5AggregateInformation(helper::Comm &mpiComm,
             mpiComm.Bcast(BcastInfo.data(), BcastInfo.size(), 0, "");
         }
     }
-    uint64_t MMASummary = std::accumulate(BcastInfo.begin(), BcastInfo.end(), size_t(0));
+    // OR rather than sum, the attribute bits of two nodes would overflow to zero
+    uint64_t MMASummary = std::accumulate(BcastInfo.begin(), BcastInfo.end(), uint64_t(0),
+                                          std::bit_or<uint64_t>());
 
     if (MMASummary == 0)
     {
@@ -526,19 +529,19 @@ void BP5Helper::BP5AggregateInformation(helper::Comm &mpiComm,
     {
         std::vector<char> IncomingMMA(TotalSize);
         uint64_t *AlignedIncomingData = reinterpret_cast<uint64_t *>(IncomingMMA.data());
-        Profiler.Start("SelectMetaInfoGather");
+        Profiler.Start(profiling::TimerID::SelectMetaInfoGather);
         mpiComm.GathervArrays(AlignedContrib, AlignedContribCount, AlignedCounts.data(),
                               AlignedCounts.size(), AlignedIncomingData, 0);
-        Profiler.Stop("SelectMetaInfoGather");
+        Profiler.Stop(profiling::TimerID::SelectMetaInfoGather);
         BreakdownIncomingMData(SecondRecvCounts, BcastInfo, IncomingMMA, NewMetaMetaBlocks,
                                AttributeEncodeBuffers, AttrSize, MMBSizes, MMBIDs);
     }
     else
     {
-        Profiler.Start("SelectMetaInfoGather");
+        Profiler.Start(profiling::TimerID::SelectMetaInfoGather);
         mpiComm.GathervArrays(AlignedContrib, AlignedContribCount, AlignedCounts.data(),
                               AlignedCounts.size(), (uint64_t *)nullptr, 0);
-        Profiler.Stop("SelectMetaInfoGather");
+        Profiler.Stop(profiling::TimerID::SelectMetaInfoGather);
     }
 }
 
@@ -0,0 +1,136 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ *
+ * BP5ReadBufferPool.cpp
+ *
+ */
+
+#include "BP5ReadBufferPool.h"
+
+#include <cstdlib>
+#include <new> // std::bad_alloc
+
+namespace adios2
+{
+namespace format
+{
+
+/* size classes start here and grow in quarters of a power of two, so at
+ * most a quarter of a buffer is unused */
+static const size_t MinClassSize = 4096;
+
+/* each buffer is preceded by its size class, this keeps the buffer
+ * itself aligned like malloc() memory */
+static const size_t HeaderSize = alignof(std::max_align_t);
+
+BP5ReadBufferPool::BP5ReadBufferPool(size_t MaxRetainedBytes) : m_MaxRetainedBytes(MaxRetainedBytes)
+{
+}
+
+BP5ReadBufferPool::~BP5ReadBufferPool() { Trim(); }
+
+void BP5ReadBufferPool::SetMaxRetainedBytes(size_t MaxRetainedBytes)
+{
+    std::lock_guard<std::mutex> lockGuard(m_Mutex);
+    m_MaxRetainedBytes = MaxRetainedBytes;
+    TrimTo(MaxRetainedBytes);
+}
+
+size_t BP5ReadBufferPool::ClassSize(size_t SizeClass)
+{
+    return ((MinClassSize << (SizeClass / 4)) / 4) * (4 + SizeClass % 4);
+}
+
+char *BP5ReadBufferPool::Get(size_t Size)
+{
+    size_t SizeClass = 0;
+    while (ClassSize(SizeClass) < Size)
+    {
+        SizeClass++;
+    }
+
+    {
+        std::lock_guard<std::mutex> lockGuard(m_Mutex);
+        m_Stats.Gets++;
+        if ((SizeClass < m_Free.size()) && !m_Free[SizeClass].empty())
+        {
+            char *Buffer = m_Free[SizeClass].back();
+            m_Free[SizeClass].pop_back();
+            m_Stats.Hits++;
+            m_Stats.RetainedBytes -= ClassSize(SizeClass);
+            return Buffer;
+        }
+        m_Stats.AllocatedBytes += ClassSize(SizeClass);
+        if (m_Stats.AllocatedBytes > m_Stats.HighWaterBytes)
+        {
+            m_Stats.HighWaterBytes = m_Stats.AllocatedBytes;
+        }
+    }
+
+    char *Block = (char *)malloc(HeaderSize + ClassSize(SizeClass));
+    if (!Block)
+    {
+        std::lock_guard<std::mutex> lockGuard(m_Mutex);
+        m_Stats.AllocatedBytes -= ClassSize(SizeClass);
+        throw std::bad_alloc();
+    }
+    *(size_t *)Block = SizeClass;
+    return Block + HeaderSize;
+}
+
+void BP5ReadBufferPool::Release(char *Buffer)
+{
+    if (!Buffer)
+    {
+        return;
+    }
+    char *Block = Buffer - HeaderSize;
+    const size_t SizeClass = *(size_t *)Block;
+    {
+        std::lock_guard<std::mutex> lockGuard(m_Mutex);
+        if (m_Stats.RetainedBytes + ClassSize(SizeClass) <= m_MaxRetainedBytes)
+        {
+            if (m_Free.size() <= SizeClass)
+            {
+                m_Free.resize(SizeClass + 1);
+            }
+            m_Free[SizeClass].push_back(Buffer);
+            m_Stats.RetainedBytes += ClassSize(SizeClass);
+            return;
+        }
+        m_Stats.AllocatedBytes -= ClassSize(SizeClass);
+    }
+    free(Block);
+}
+
+void BP5ReadBufferPool::Trim()
+{
+    std::lock_guard<std::mutex> lockGuard(m_Mutex);
+    TrimTo(0);
+}
+
+void BP5ReadBufferPool::TrimTo(size_t Bytes)
+{
+    // drop the largest buffers first
+    for (size_t SizeClass = m_Free.size(); SizeClass-- > 0;)
+    {
+        auto &Free = m_Free[SizeClass];
+        while (!Free.empty() && (m_Stats.RetainedBytes > Bytes))
+        {
+            free(Free.back() - HeaderSize);
+            Free.pop_back();
+            m_Stats.RetainedBytes -= ClassSize(SizeClass);
+            m_Stats.AllocatedBytes -= ClassSize(SizeClass);
+        }
+    }
+}
+
+BP5ReadBufferPool::Stats BP5ReadBufferPool::GetStats()
+{
+    std::lock_guard<std::mutex> lockGuard(m_Mutex);
+    return m_Stats;
+}
+
+} // end namespace format
+} // end namespace adios2
@@ -0,0 +1,66 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ *
+ * BP5ReadBufferPool.h
+ *
+ * Size-classed pool of temporary read buffers.  Buffers given back to
+ * the pool are kept for reuse by later requests (and later steps) up to
+ * a limit on the retained memory, so that reading many small blocks
+ * doesn't go to the allocator (and fault in fresh pages) every time.
+ */
+
+#ifndef ADIOS2_TOOLKIT_FORMAT_BP5_BP5READBUFFERPOOL_H_
+#define ADIOS2_TOOLKIT_FORMAT_BP5_BP5READBUFFERPOOL_H_
+
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+namespace adios2
+{
+namespace format
+{
+
+class BP5ReadBufferPool
+{
+public:
+    /* MaxRetainedBytes is the most memory kept in the pool while not in
+     * use, 0 turns pooling off */
+    BP5ReadBufferPool(size_t MaxRetainedBytes);
+    ~BP5ReadBufferPool();
+
+    void SetMaxRetainedBytes(size_t MaxRetainedBytes);
+
+    /* return a buffer of at least Size bytes, to be given back with
+     * Release() (may be called from any thread) */
+    char *Get(size_t Size);
+    void Release(char *Buffer);
+
+    /* free all buffers not currently in use */
+    void Trim();
+
+    struct Stats
+    {
+        size_t Gets = 0;
+        size_t Hits = 0;           // Gets served from the pool
+        size_t HighWaterBytes = 0; // most memory allocated at any one time
+        size_t AllocatedBytes = 0; // in use or retained now
+        size_t RetainedBytes = 0;  // retained now
+    };
+    Stats GetStats();
+
+private:
+    static size_t ClassSize(size_t SizeClass);
+    void TrimTo(size_t Bytes);
+
+    std::mutex m_Mutex;
+    size_t m_MaxRetainedBytes;
+    std::vector<std::vector<char *>> m_Free; // by size class
+    Stats m_Stats;
+};
+
+} // end namespace format
+} // end namespace adios2
+
+#endif /* ADIOS2_TOOLKIT_FORMAT_BP5_BP5READBUFFERPOOL_H_ */
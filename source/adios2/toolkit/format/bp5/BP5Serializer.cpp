@@ -38,6 +38,18 @@ namespace format
 BP5Serializer::BP5Serializer() { Init(); }
 BP5Serializer::~BP5Serializer()
 {
+    for (auto &Def : DeferredCompressions)
+    {
+        try
+        {
+            free(Def.Result.get().first);
+        }
+        catch (...)
+        {
+        }
+    }
+    DeferredCompressions.clear();
+    m_CompressionPool.reset();
     if (CurDataBuffer)
         delete CurDataBuffer;
     if (!Info.RecNameMap.empty())
@@ -612,27 +624,44 @@ BP5Serializer::BP5WriterRec BP5Serializer::CreateWriterRec(void *Variable, const
         if ((m_StatsLevel > 0) && !NeverMinMax)
         {
             char MMArrayName[40] = {0};
+            const char *MMSize = NULL;
             strcat(MMArrayName, ArrayTypeName);
             switch (ElemSize)
             {
             case 1:
-                strcat(MMArrayName, "MM1");
+                MMSize = "1";
                 break;
             case 2:
-                strcat(MMArrayName, "MM2");
+                MMSize = "2";
                 break;
             case 4:
-                strcat(MMArrayName, "MM4");
+                MMSize = "4";
                 break;
             case 8:
-                strcat(MMArrayName, "MM8");
+                MMSize = "8";
                 break;
             case 16:
-                strcat(MMArrayName, "MM16");
+                MMSize = "16";
                 break;
             }
+            // other sizes (structs) have no min/max record type
+            if (MMSize)
+            {
+                strcat(MMArrayName, "MM");
+                if (m_StatsBlockSize > 0)
+                {
+                    // sub-block min/max after the per-block ones
+                    strcat(MMArrayName, "Sub");
+                    Rec->SubBlockStats = true;
+                }
+                strcat(MMArrayName, MMSize);
+            }
             Rec->MinMaxOffset = FieldSize;
             FieldSize += sizeof(char *);
+            if (Rec->SubBlockStats)
+            {
+                FieldSize += sizeof(MetaSubBlockStats);
+            }
             AddSimpleField(&Info.MetaFields, &Info.MetaFieldCount, LongName, MMArrayName,
                            FieldSize);
         }
@@ -687,17 +716,52 @@ void BP5Serializer::PerformPuts(bool forceCopyDeferred)
     DumpDeferredBlocks(true);
 }
 
-void BP5Serializer::DumpDeferredBlocks(bool forceCopyDeferred)
+void BP5Serializer::SetCompressionThreads(const size_t nThreads)
 {
-    for (auto &Def : DeferredExterns)
+    DumpDeferredCompressions();
+    m_CompressionPool.reset();
+    if (nThreads > 0)
     {
-        MetaArrayRec *MetaEntry = (MetaArrayRec *)((char *)(MetadataBuf) + Def.MetaOffset);
-        size_t DataOffset =
-            m_PriorDataBufferSizeTotal +
-            CurDataBuffer->AddToVec(Def.DataSize, Def.Data, Def.AlignReq, forceCopyDeferred);
-        MetaEntry->DataBlockLocation[Def.BlockID] = DataOffset;
+        m_CompressionPool.reset(new helper::ThreadPool(nThreads));
+    }
+}
+
+void BP5Serializer::DumpDeferredCompressions()
+{
+    /* add the compressed blocks in the order they were put, a failed
+     * compression is rethrown after waiting for the others */
+    std::exception_ptr Failure;
+    for (auto &Def : DeferredCompressions)
+    {
+        std::pair<char *, size_t> Compressed;
+        try
+        {
+            Compressed = Def.Result.get();
+        }
+        catch (...)
+        {
+            if (!Failure)
+            {
+                Failure = std::current_exception();
+            }
+            continue;
+        }
+        if (!Failure)
+        {
+            MetaArrayRecOperator *OpEntry =
+                (MetaArrayRecOperator *)((char *)(MetadataBuf) + Def.MetaOffset);
+            OpEntry->DataBlockLocation[Def.BlockID] =
+                m_PriorDataBufferSizeTotal +
+                CurDataBuffer->AddToVec(Compressed.second, Compressed.first, Def.AlignReq, true);
+            OpEntry->DataBlockSize[Def.BlockID] = Compressed.second;
+        }
+        free(Compressed.first);
+    }
+    DeferredCompressions.clear();
+    if (Failure)
+    {
+        std::rethrow_exception(Failure);
     }
-    DeferredExterns.clear();
 }
 
 static void GetMinMax(const void *Data, size_t ElemCount, const DataType Type, MinMaxStruct &MinMax,
@@ -724,12 +788,101 @@ static void GetMinMax(const void *Data, size_t ElemCount, const DataType Type, M
 #define pertype(T, N)                                                                              \
     else if (Type == helper::GetDataType<T>())                                                     \
     {                                                                                              \
-        const T *values = (const T *)Data;                                                         \
-        auto res = std::minmax_element(values, values + ElemCount);                                \
-        MinMax.MinUnion.field_##N = *res.first;                                                    \
-        MinMax.MaxUnion.field_##N = *res.second;                                                   \
+        helper::GetMinMaxHost((const T *)Data, ElemCount, MinMax.MinUnion.field_##N,               \
+                              MinMax.MaxUnion.field_##N);                                          \
+    }
+    ADIOS2_FOREACH_MINMAX_STDTYPE_2ARGS(pertype)
+#undef pertype
+}
+
+/* copy host data into the buffer and get its min/max in the same pass */
+static void CopyAndGetMinMax(void *Dest, const void *Data, size_t ElemCount, const DataType Type,
+                             MinMaxStruct &MinMax)
+{
+    MinMax.Init(Type);
+    if (ElemCount == 0)
+        return;
+    if (Type == DataType::Struct)
+    {
+    }
+#define pertype(T, N)                                                                              \
+    else if (Type == helper::GetDataType<T>())                                                     \
+    {                                                                                              \
+        helper::CopyAndGetMinMax((const T *)Data, ElemCount, (T *)Dest,                            \
+                                 MinMax.MinUnion.field_##N, MinMax.MaxUnion.field_##N);            \
+    }
+    ADIOS2_FOREACH_MINMAX_STDTYPE_2ARGS(pertype)
+#undef pertype
+}
+
+void BP5Serializer::DumpDeferredBlocks(bool forceCopyDeferred)
+{
+    DumpDeferredCompressions();
+    for (auto &Def : DeferredExterns)
+    {
+        MetaArrayRec *MetaEntry = (MetaArrayRec *)((char *)(MetadataBuf) + Def.MetaOffset);
+        size_t DataOffset;
+        if (Def.MinMaxType == DataType::None)
+        {
+            DataOffset =
+                m_PriorDataBufferSizeTotal +
+                CurDataBuffer->AddToVec(Def.DataSize, Def.Data, Def.AlignReq, forceCopyDeferred);
+        }
+        else
+        {
+            MinMaxStruct MinMax;
+            const size_t ElemCount = Def.DataSize / helper::GetDataTypeSize(Def.MinMaxType);
+            if (forceCopyDeferred)
+            {
+                BufferV::BufferPos pos = CurDataBuffer->Allocate(Def.DataSize, Def.AlignReq);
+                DataOffset = m_PriorDataBufferSizeTotal + pos.globalPos;
+                CopyAndGetMinMax(GetPtr(pos.bufferIdx, pos.posInBuffer), Def.Data, ElemCount,
+                                 Def.MinMaxType, MinMax);
+            }
+            else
+            {
+                GetMinMax(Def.Data, ElemCount, Def.MinMaxType, MinMax, MemorySpace::Host);
+                DataOffset = m_PriorDataBufferSizeTotal +
+                             CurDataBuffer->AddToVec(Def.DataSize, Def.Data, Def.AlignReq, false);
+            }
+            SetBlockMinMax(Def.MetaOffset, Def.MinMaxOffset, Def.BlockID, Def.SubBlockNum,
+                           Def.MinMaxType, MinMax);
+        }
+        MetaEntry->DataBlockLocation[Def.BlockID] = DataOffset;
+    }
+    DeferredExterns.clear();
+}
+
+/* divide a host block into sub-blocks of about SubBlockSize elements and get
+ * the min/max of each one and of the whole block.  Returns the number of
+ * sub-blocks, with a single one MinMax and SubMinMax are left alone */
+static size_t GetMinMaxSubBlocks(const void *Data, const DataType Type, const size_t DimCount,
+                                 const size_t *Count, const size_t SubBlockSize,
+                                 std::vector<size_t> &Div, std::vector<char> &SubMinMax,
+                                 MinMaxStruct &MinMax)
+{
+    const Dims count(Count, Count + DimCount);
+    const helper::BlockDivisionInfo Info =
+        helper::DivideBlock(count, SubBlockSize, helper::BlockDivisionMethod::Contiguous);
+    Div.assign(Info.Div.begin(), Info.Div.end());
+    if (Info.NBlocks <= 1)
+        return 1;
+    MinMax.Init(Type);
+    if (Type == DataType::Struct)
+    {
+    }
+#define pertype(T, N)                                                                              \
+    else if (Type == helper::GetDataType<T>())                                                     \
+    {                                                                                              \
+        std::vector<T> MinMaxs;                                                                    \
+        helper::GetMinMaxSubblocks((const T *)Data, count, Info, MinMaxs,                          \
+                                   MinMax.MinUnion.field_##N, MinMax.MaxUnion.field_##N, 1);       \
+        SubMinMax.resize(MinMaxs.size() * sizeof(T));                                              \
+        memcpy(SubMinMax.data(), MinMaxs.data(), SubMinMax.size());                                \
     }
     ADIOS2_FOREACH_MINMAX_STDTYPE_2ARGS(pertype)
+#undef pertype
+    return Info.NBlocks;
 }
 
 void BP5Serializer::Marshal(void *Variable, const char *Name, const DataType Type, size_t ElemSize,
@@ -741,9 +894,9 @@ void BP5Serializer::Marshal(void *Variable, const char *Name, const DataType Typ
     auto lf_QueueSpanMinMax = [&](const format::BufferV::BufferPos Data, const size_t ElemCount,
                                   const DataType Type, const MemorySpace MemSpace,
                                   const size_t MetaOffset, const size_t MinMaxOffset,
-                                  const size_t BlockNum) {
-        DeferredSpanMinMax entry = {Data,       ElemCount,    Type,    MemSpace,
-                                    MetaOffset, MinMaxOffset, BlockNum};
+                                  const size_t BlockNum, const size_t SubBlockNum) {
+        DeferredSpanMinMax entry = {Data,         ElemCount, Type,       MemSpace, MetaOffset,
+                                    MinMaxOffset, BlockNum,  SubBlockNum};
         DefSpanMinMax.push_back(entry);
     };
 
@@ -830,7 +983,37 @@ void BP5Serializer::Marshal(void *Variable, const char *Name, const DataType Typ
 #endif
         bool DoMinMax =
             ((m_StatsLevel > 0) && !DerivedWithoutStats && TypeHasMinMax((DataType)Rec->Type));
-        if (DoMinMax && !Span)
+        /* only host blocks are divided into sub-blocks, spans and device
+         * blocks get a single sub-block with the min/max of the block */
+        const bool DoSubBlocks = DoMinMax && Rec->SubBlockStats;
+        MetaSubBlockStats *SubBlocks = NULL;
+        size_t FirstSubBlock = SIZE_MAX;
+        size_t SubBlockCount = 1;
+        std::vector<size_t> SubBlockDiv(DimCount, 1);
+        std::vector<char> SubBlockMinMax;
+        if (DoSubBlocks)
+        {
+            SubBlocks = (MetaSubBlockStats *)(((char *)MetaEntry) + Rec->MinMaxOffset +
+                                              sizeof(char *));
+            FirstSubBlock = SubBlocks->SubBlockCount;
+            if (!Span && (MemSpace == MemorySpace::Host))
+            {
+                SubBlockCount = GetMinMaxSubBlocks(Data, (DataType)Rec->Type, DimCount, Count,
+                                                   m_StatsBlockSize, SubBlockDiv,
+                                                   SubBlockMinMax, MinMax);
+            }
+        }
+        /* a block copied into the buffer now gets its min/max while it is
+         * copied, instead of in a separate pass over the data */
+        const bool CopyWithMinMax = DoMinMax && !Span && !Rec->OperatorType && WriteData &&
+                                    Sync && (ElemCount > 0) && (MemSpace == MemorySpace::Host) &&
+                                    (SubBlockCount == 1);
+        /* a deferred block gets its min/max when it is added to the buffer
+         * in DumpDeferredBlocks(), while it is copied if it is copied */
+        const bool DeferMinMax = DoMinMax && DeferAddToVec && WriteData && (ElemCount > 0) &&
+                                 (MemSpace == MemorySpace::Host) && (SubBlockCount == 1);
+        const DataType MinMaxType = DeferMinMax ? (DataType)Rec->Type : DataType::None;
+        if (DoMinMax && !Span && !CopyWithMinMax && !DeferMinMax && (SubBlockCount == 1))
         {
             GetMinMax(Data, ElemCount, (DataType)Rec->Type, MinMax, MemSpace);
         }
@@ -849,17 +1032,69 @@ void BP5Serializer::Marshal(void *Variable, const char *Name, const DataType Typ
             }
             size_t AllocSize =
                 VB->m_Operations[0]->GetEstimatedSize(ElemCount, ElemSize, DimCount, Count);
-            BufferV::BufferPos pos = CurDataBuffer->Allocate(AllocSize, ElemSize);
-            char *CompressedData = (char *)GetPtr(pos.bufferIdx, pos.posInBuffer);
-            DataOffset = m_PriorDataBufferSizeTotal + pos.globalPos;
-            CompressedSize = VB->m_Operations[0]->Operate((const char *)Data, tmpOffsets, tmpCount,
-                                                          (DataType)Rec->Type, CompressedData);
-            // if the operator was not applied
-            if (CompressedSize == 0)
-                CompressedSize = helper::CopyMemoryWithOpHeader(
-                    (const char *)Data, tmpCount, (DataType)Rec->Type, CompressedData,
-                    VB->m_Operations[0]->GetHeaderSize(), MemSpace);
-            CurDataBuffer->DownsizeLastAlloc(AllocSize, CompressedSize);
+            /* Deferred blocks are compressed by the worker pool into their
+             * own buffer and go into the data buffer in
+             * DumpDeferredCompressions().  Only for operators that are
+             * safe to run concurrently (e.g. blosc initializes and
+             * destroys the library in every call, SZ keeps global state) */
+            const bool ConcurrentOperator =
+                (compressionMethod == "zfp") || (compressionMethod == "bzip2") ||
+                (compressionMethod == "png") || (compressionMethod == "null");
+            if (m_CompressionPool && !Sync && !Span && ConcurrentOperator && WriteData &&
+                (MemSpace == MemorySpace::Host))
+            {
+                std::shared_ptr<core::Operator> Op = VB->m_Operations[0];
+                const DataType OpType = (DataType)Rec->Type;
+                auto lf_Compress = [Op, Data, tmpOffsets, tmpCount, OpType,
+                                    AllocSize]() -> std::pair<char *, size_t> {
+                    char *CompressedData = (char *)malloc(AllocSize);
+                    if (!CompressedData)
+                    {
+                        throw std::bad_alloc();
+                    }
+                    size_t Size = 0;
+                    try
+                    {
+                        Size = Op->Operate((const char *)Data, tmpOffsets, tmpCount, OpType,
+                                           CompressedData);
+                        // if the operator was not applied
+                        if (Size == 0)
+                            Size = helper::CopyMemoryWithOpHeader(
+                                (const char *)Data, tmpCount, OpType, CompressedData,
+                                Op->GetHeaderSize(), MemorySpace::Host);
+                    }
+                    catch (...)
+                    {
+                        free(CompressedData);
+                        throw;
+                    }
+                    return std::make_pair(CompressedData, Size);
+                };
+                DeferredCompression Def;
+                Def.MetaOffset = Rec->MetaOffset;
+                Def.BlockID = AlreadyWritten ? MetaEntry->BlockCount : 0;
+                Def.AlignReq = ElemSize;
+                Def.Result = m_CompressionPool->Submit(lf_Compress);
+                DeferredCompressions.push_back(std::move(Def));
+                // location and size are set when the block is dumped
+                DataOffset = 0;
+                CompressedSize = 0;
+            }
+            else
+            {
+                BufferV::BufferPos pos = CurDataBuffer->Allocate(AllocSize, ElemSize);
+                char *CompressedData = (char *)GetPtr(pos.bufferIdx, pos.posInBuffer);
+                DataOffset = m_PriorDataBufferSizeTotal + pos.globalPos;
+                CompressedSize = VB->m_Operations[0]->Operate((const char *)Data, tmpOffsets,
+                                                              tmpCount, (DataType)Rec->Type,
+                                                              CompressedData);
+                // if the operator was not applied
+                if (CompressedSize == 0)
+                    CompressedSize = helper::CopyMemoryWithOpHeader(
+                        (const char *)Data, tmpCount, (DataType)Rec->Type, CompressedData,
+                        VB->m_Operations[0]->GetHeaderSize(), MemSpace);
+                CurDataBuffer->DownsizeLastAlloc(AllocSize, CompressedSize);
+            }
         }
         else if (!WriteData)
         {
@@ -868,7 +1103,14 @@ void BP5Serializer::Marshal(void *Variable, const char *Name, const DataType Typ
         }
         else if (Span == nullptr)
         {
-            if (!DeferAddToVec)
+            if (CopyWithMinMax)
+            {
+                BufferV::BufferPos pos = CurDataBuffer->Allocate(ElemCount * ElemSize, ElemSize);
+                DataOffset = m_PriorDataBufferSizeTotal + pos.globalPos;
+                CopyAndGetMinMax(GetPtr(pos.bufferIdx, pos.posInBuffer), Data, ElemCount,
+                                 (DataType)Rec->Type, MinMax);
+            }
+            else if (!DeferAddToVec)
             {
                 DataOffset =
                     m_PriorDataBufferSizeTotal +
@@ -916,13 +1158,15 @@ void BP5Serializer::Marshal(void *Variable, const char *Name, const DataType Typ
                 else
                 {
                     lf_QueueSpanMinMax(*Span, ElemCount, (DataType)Rec->Type, spanMemSpace,
-                                       Rec->MetaOffset, Rec->MinMaxOffset, 0 /*BlockNum*/);
+                                       Rec->MetaOffset, Rec->MinMaxOffset, 0 /*BlockNum*/,
+                                       FirstSubBlock);
                 }
             }
             if (DeferAddToVec)
             {
-                DeferredExtern rec = {Rec->MetaOffset, 0, Data, ElemCount * ElemSize, ElemSize};
-                DeferredExterns.push_back(rec);
+                DeferredExterns.push_back({Rec->MetaOffset, 0, Data, ElemCount * ElemSize,
+                                           ElemSize, MinMaxType, Rec->MinMaxOffset,
+                                           FirstSubBlock});
             }
         }
         else
@@ -961,19 +1205,42 @@ void BP5Serializer::Marshal(void *Variable, const char *Name, const DataType Typ
                 {
                     lf_QueueSpanMinMax(*Span, ElemCount, (DataType)Rec->Type, spanMemSpace,
                                        Rec->MetaOffset, Rec->MinMaxOffset,
-                                       MetaEntry->BlockCount - 1 /*BlockNum*/);
+                                       MetaEntry->BlockCount - 1 /*BlockNum*/, FirstSubBlock);
                 }
             }
 
             if (DeferAddToVec)
             {
                 DeferredExterns.push_back({Rec->MetaOffset, MetaEntry->BlockCount - 1, Data,
-                                           ElemCount * ElemSize, ElemSize});
+                                           ElemCount * ElemSize, ElemSize, MinMaxType,
+                                           Rec->MinMaxOffset, FirstSubBlock});
             }
             if (Offsets)
                 MetaEntry->Offsets =
                     AppendDims(MetaEntry->Offsets, PreviousDBCount, DimCount, Offsets);
         }
+        if (DoSubBlocks)
+        {
+            /* the sub-blocks of this block follow those of the previous
+             * blocks, a span's single sub-block is set with its min/max in
+             * ProcessDeferredMinMax() */
+            SubBlocks->SubBlockCount += SubBlockCount;
+            SubBlocks->SubBlockDiv = AppendDims(SubBlocks->SubBlockDiv,
+                                                MetaEntry->DBCount - DimCount, DimCount,
+                                                SubBlockDiv.data());
+            SubBlocks->SubBlockMinMax = (char *)realloc(SubBlocks->SubBlockMinMax,
+                                                        SubBlocks->SubBlockCount * 2 * ElemSize);
+            char *SubMinMax = SubBlocks->SubBlockMinMax + FirstSubBlock * 2 * ElemSize;
+            if (SubBlockCount > 1)
+            {
+                memcpy(SubMinMax, SubBlockMinMax.data(), SubBlockCount * 2 * ElemSize);
+            }
+            else if (!Span)
+            {
+                memcpy(SubMinMax, &MinMax.MinUnion, ElemSize);
+                memcpy(SubMinMax + ElemSize, &MinMax.MaxUnion, ElemSize);
+            }
+        }
     }
 }
 
@@ -1227,16 +1494,30 @@ void BP5Serializer::ProcessDeferredMinMax()
         MinMax.Init(Def.Type);
         void *Ptr = reinterpret_cast<void *>(GetPtr(Def.Data.bufferIdx, Def.Data.posInBuffer));
         GetMinMax(Ptr, Def.ElemCount, Def.Type, MinMax, Def.MemSpace);
+        SetBlockMinMax(Def.MetaOffset, Def.MinMaxOffset, Def.BlockNum, Def.SubBlockNum, Def.Type,
+                       MinMax);
+    }
+    DefSpanMinMax.clear();
+}
 
-        MetaArrayRecMM *MetaEntry = (MetaArrayRecMM *)((char *)(MetadataBuf) + Def.MetaOffset);
-        void **MMPtrLoc = (void **)(((char *)MetaEntry) + Def.MinMaxOffset);
-        auto ElemSize = helper::GetDataTypeSize(Def.Type);
+void BP5Serializer::SetBlockMinMax(const size_t MetaOffset, const size_t MinMaxOffset,
+                                   const size_t BlockNum, const size_t SubBlockNum,
+                                   const DataType Type, const MinMaxStruct &MinMax)
+{
+    MetaArrayRecMM *MetaEntry = (MetaArrayRecMM *)((char *)(MetadataBuf) + MetaOffset);
+    void **MMPtrLoc = (void **)(((char *)MetaEntry) + MinMaxOffset);
+    auto ElemSize = helper::GetDataTypeSize(Type);
 
-        memcpy(((char *)*MMPtrLoc) + ElemSize * (2 * (Def.BlockNum)), &MinMax.MinUnion, ElemSize);
-        memcpy(((char *)*MMPtrLoc) + ElemSize * (2 * (Def.BlockNum) + 1), &MinMax.MaxUnion,
-               ElemSize);
+    memcpy(((char *)*MMPtrLoc) + ElemSize * (2 * (BlockNum)), &MinMax.MinUnion, ElemSize);
+    memcpy(((char *)*MMPtrLoc) + ElemSize * (2 * (BlockNum) + 1), &MinMax.MaxUnion, ElemSize);
+    if (SubBlockNum != SIZE_MAX)
+    {
+        MetaSubBlockStats *SubBlocks =
+            (MetaSubBlockStats *)(((char *)MetaEntry) + MinMaxOffset + sizeof(char *));
+        char *SubMinMax = SubBlocks->SubBlockMinMax + ElemSize * (2 * SubBlockNum);
+        memcpy(SubMinMax, &MinMax.MinUnion, ElemSize);
+        memcpy(SubMinMax + ElemSize, &MinMax.MaxUnion, ElemSize);
     }
-    DefSpanMinMax.clear();
 }
 
 BufferV *BP5Serializer::ReinitStepData(BufferV *DataBuffer, bool forceCopyDeferred)
@@ -1285,7 +1566,7 @@ BP5Serializer::TimestepInfo BP5Serializer::CloseTimestep(int timestep, bool forc
     if (!Info.MetaFormat && Info.MetaFieldCount)
     {
         MetaMetaInfoBlock Block;
-        FMStructDescRec struct_list[20] = {
+        FMStructDescRec struct_list[30] = {
             {NULL, NULL, 0, NULL},
             {"complex4", fcomplex_field_list, sizeof(fcomplex_struct), NULL},
             {"complex8", dcomplex_field_list, sizeof(dcomplex_struct), NULL},
@@ -1306,6 +1587,21 @@ BP5Serializer::TimestepInfo BP5Serializer::CloseTimestep(int timestep, bool forc
             {"MetaArrayMM16", MetaArrayRecMM16ListPtr, sizeof(MetaArrayRecMM), NULL},
             {"MetaArrayOpMM16", MetaArrayRecOperatorMM16ListPtr, sizeof(MetaArrayRecOperatorMM),
              NULL},
+            {"MetaArrayMMSub1", MetaArrayRecMMSub1ListPtr, sizeof(MetaArrayRecMMSub), NULL},
+            {"MetaArrayOpMMSub1", MetaArrayRecOperatorMMSub1ListPtr,
+             sizeof(MetaArrayRecOperatorMMSub), NULL},
+            {"MetaArrayMMSub2", MetaArrayRecMMSub2ListPtr, sizeof(MetaArrayRecMMSub), NULL},
+            {"MetaArrayOpMMSub2", MetaArrayRecOperatorMMSub2ListPtr,
+             sizeof(MetaArrayRecOperatorMMSub), NULL},
+            {"MetaArrayMMSub4", MetaArrayRecMMSub4ListPtr, sizeof(MetaArrayRecMMSub), NULL},
+            {"MetaArrayOpMMSub4", MetaArrayRecOperatorMMSub4ListPtr,
+             sizeof(MetaArrayRecOperatorMMSub), NULL},
+            {"MetaArrayMMSub8", MetaArrayRecMMSub8ListPtr, sizeof(MetaArrayRecMMSub), NULL},
+            {"MetaArrayOpMMSub8", MetaArrayRecOperatorMMSub8ListPtr,
+             sizeof(MetaArrayRecOperatorMMSub), NULL},
+            {"MetaArrayMMSub16", MetaArrayRecMMSub16ListPtr, sizeof(MetaArrayRecMMSub), NULL},
+            {"MetaArrayOpMMSub16", MetaArrayRecOperatorMMSub16ListPtr,
+             sizeof(MetaArrayRecOperatorMMSub), NULL},
             {NULL, NULL, 0, NULL}};
         struct_list[0].format_name = "MetaData";
         struct_list[0].field_list = Info.MetaFields;
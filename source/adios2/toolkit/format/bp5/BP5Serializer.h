@@ -12,6 +12,7 @@
 #include "adios2/core/Attribute.h"
 #include "adios2/core/CoreTypes.h"
 #include "adios2/core/IO.h"
+#include "adios2/helper/adiosThreadPool.h"
 #include "adios2/toolkit/format/buffer/BufferV.h"
 #include "adios2/toolkit/format/buffer/heap/BufferSTL.h"
 #include "atl.h"
@@ -21,6 +22,8 @@
 #pragma warning(disable : 4250)
 #endif
 
+#include <future>
+#include <memory>
 #include <unordered_map>
 
 namespace adios2
@@ -133,6 +136,15 @@ public:
 
     int m_StatsLevel = 1;
 
+    /* Elements per sub-block with its own min/max, 0 keeps one min/max
+     * per block */
+    size_t m_StatsBlockSize = DefaultStatsBlockSize;
+
+    /* Compress the blocks of deferred Puts on nThreads worker threads
+     * and add them to the data buffer when the deferred blocks are
+     * dumped, 0 compresses them in Marshal() */
+    void SetCompressionThreads(const size_t nThreads);
+
     /* Variables to help appending to existing file */
     size_t m_PreMetaMetadataFileLength = 0;
 
@@ -153,6 +165,7 @@ private:
         int DimCount;
         int Type;
         size_t MinMaxOffset;
+        bool SubBlockStats = false; // MetaSubBlockStats follow MinMax
     } *BP5WriterRec;
 
     struct FFSWriterMarshalBase
@@ -180,9 +193,26 @@ private:
         const void *Data;
         size_t DataSize;
         size_t AlignReq;
+        // if not DataType::None, the min/max of the block is taken when it
+        // is added in DumpDeferredBlocks(), in the same pass as its copy
+        DataType MinMaxType;
+        size_t MinMaxOffset;
+        size_t SubBlockNum; // SIZE_MAX without sub-block stats
     };
     std::vector<DeferredExtern> DeferredExterns;
 
+    struct DeferredCompression
+    {
+        size_t MetaOffset;
+        size_t BlockID;
+        size_t AlignReq;
+        // malloc'd compressed data and its size
+        std::future<std::pair<char *, size_t>> Result;
+    };
+    std::vector<DeferredCompression> DeferredCompressions;
+    std::unique_ptr<helper::ThreadPool> m_CompressionPool;
+    void DumpDeferredCompressions();
+
     struct DeferredSpanMinMax
     {
         const BufferV::BufferPos Data;
@@ -192,6 +222,7 @@ private:
         const size_t MetaOffset;
         const size_t MinMaxOffset;
         const size_t BlockNum;
+        const size_t SubBlockNum; // SIZE_MAX without sub-block stats
     };
     std::vector<DeferredSpanMinMax> DefSpanMinMax;
 
@@ -237,6 +268,10 @@ private:
                        const size_t *Vals);
 
     void DumpDeferredBlocks(bool forceCopyDeferred = false);
+    /* store the min/max of a block (and of its single sub-block, unless
+     * SubBlockNum is SIZE_MAX) in the metadata */
+    void SetBlockMinMax(const size_t MetaOffset, const size_t MinMaxOffset, const size_t BlockNum,
+                        const size_t SubBlockNum, const DataType Type, const MinMaxStruct &MinMax);
     void VariableStatsEnabled(void *Variable);
 
     typedef struct _ArrayRec
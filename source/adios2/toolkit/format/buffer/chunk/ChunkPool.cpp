@@ -0,0 +1,132 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ *
+ * ChunkPool.cpp
+ *
+ */
+
+#include "ChunkPool.h"
+
+#include <cstdlib>
+
+#ifdef __linux__
+#include <sys/mman.h> // madvise
+#endif
+
+namespace adios2
+{
+namespace format
+{
+
+/* huge pages are 2MB on the common platforms, chunks backed by them must be
+ * aligned to that */
+static const size_t HugePageSize = 2 * 1024 * 1024;
+static const size_t PageSize = 4096;
+
+ChunkPool::ChunkPool(const size_t ChunkSize, const size_t Alignment, const bool Prefault,
+                     const bool HugePages)
+: m_ChunkSize(ChunkSize),
+  m_Alignment(HugePages ? (Alignment > HugePageSize ? Alignment : HugePageSize)
+                        : (Alignment > 0 ? Alignment : 1)),
+  m_Prefault(Prefault), m_HugePages(HugePages)
+{
+}
+
+ChunkPool::~ChunkPool()
+{
+    for (auto &a : m_Allocated)
+    {
+        free(a.second);
+    }
+}
+
+char *ChunkPool::Allocate()
+{
+    void *AllocatedPtr = malloc(m_ChunkSize + m_Alignment - 1);
+    if (!AllocatedPtr)
+    {
+        return nullptr;
+    }
+    size_t p = (size_t)AllocatedPtr;
+    char *Ptr = (char *)((p + m_Alignment - 1) / m_Alignment * m_Alignment);
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    if (m_HugePages && (m_ChunkSize >= HugePageSize))
+    {
+        // advisory only, the chunk works without huge pages too
+        (void)madvise(Ptr, m_ChunkSize / HugePageSize * HugePageSize, MADV_HUGEPAGE);
+    }
+#endif
+    if (m_Prefault)
+    {
+        for (size_t pos = 0; pos < m_ChunkSize; pos += PageSize)
+        {
+            Ptr[pos] = 0;
+        }
+    }
+    m_Allocated[Ptr] = AllocatedPtr;
+    return Ptr;
+}
+
+char *ChunkPool::Get()
+{
+    std::lock_guard<std::mutex> lockGuard(m_Mutex);
+    char *Ptr;
+    m_Stats.Gets++;
+    if (!m_Free.empty())
+    {
+        Ptr = m_Free.back();
+        m_Free.pop_back();
+        m_Stats.Reuses++;
+    }
+    else
+    {
+        Ptr = Allocate();
+        if (!Ptr)
+        {
+            return nullptr;
+        }
+        m_Stats.Allocations++;
+    }
+    m_InUse++;
+    if (m_InUse > m_TrimHighWater)
+    {
+        m_TrimHighWater = m_InUse;
+    }
+    if (m_InUse > m_Stats.HighWater)
+    {
+        m_Stats.HighWater = m_InUse;
+    }
+    return Ptr;
+}
+
+void ChunkPool::Release(char *Ptr)
+{
+    std::lock_guard<std::mutex> lockGuard(m_Mutex);
+    m_Free.push_back(Ptr);
+    m_InUse--;
+}
+
+void ChunkPool::Trim()
+{
+    std::lock_guard<std::mutex> lockGuard(m_Mutex);
+    while (!m_Free.empty() && (m_InUse + m_Free.size() > m_TrimHighWater))
+    {
+        char *Ptr = m_Free.back();
+        m_Free.pop_back();
+        auto it = m_Allocated.find(Ptr);
+        free(it->second);
+        m_Allocated.erase(it);
+        m_Stats.Frees++;
+    }
+    m_TrimHighWater = m_InUse;
+}
+
+ChunkPool::Stats ChunkPool::GetStats()
+{
+    std::lock_guard<std::mutex> lockGuard(m_Mutex);
+    return m_Stats;
+}
+
+} // end namespace format
+} // end namespace adios2
@@ -0,0 +1,82 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ *
+ * ChunkPool.h
+ *
+ * Chunks of one size kept across the ChunkV buffers of successive steps,
+ * so that a writer producing about the same amount of data every step
+ * doesn't allocate, fault in and free its buffer memory every step.
+ */
+
+#ifndef ADIOS2_TOOLKIT_FORMAT_BUFFER_CHUNK_CHUNKPOOL_H_
+#define ADIOS2_TOOLKIT_FORMAT_BUFFER_CHUNK_CHUNKPOOL_H_
+
+#include <cstddef>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace adios2
+{
+namespace format
+{
+
+class ChunkPool
+{
+public:
+    /**
+     * @param ChunkSize size of every chunk
+     * @param Alignment of the chunk pointers
+     * @param Prefault touch every page of a new chunk when it is allocated
+     * @param HugePages ask the OS to back chunks with huge pages (Linux
+     * madvise(MADV_HUGEPAGE), ignored elsewhere)
+     */
+    ChunkPool(const size_t ChunkSize, const size_t Alignment, const bool Prefault,
+              const bool HugePages);
+    ~ChunkPool();
+
+    ChunkPool(const ChunkPool &) = delete;
+    ChunkPool &operator=(const ChunkPool &) = delete;
+
+    size_t ChunkSize() const noexcept { return m_ChunkSize; }
+
+    /* a chunk of ChunkSize() bytes, nullptr if it cannot be allocated,
+     * may be called from any thread */
+    char *Get();
+    void Release(char *Ptr);
+
+    /* free the unused chunks above the most chunks in use at any time since
+     * the previous call (the high-water mark of the last step) */
+    void Trim();
+
+    struct Stats
+    {
+        size_t Gets = 0;
+        size_t Reuses = 0;      // Gets served by a chunk released before
+        size_t Allocations = 0; // Gets that allocated a new chunk
+        size_t Frees = 0;       // chunks freed by Trim()
+        size_t HighWater = 0;   // most chunks in use at any one time
+    };
+    Stats GetStats();
+
+private:
+    const size_t m_ChunkSize;
+    const size_t m_Alignment;
+    const bool m_Prefault;
+    const bool m_HugePages;
+
+    std::mutex m_Mutex;
+    std::vector<char *> m_Free;
+    std::unordered_map<char *, void *> m_Allocated; // chunk -> malloc'd ptr
+    size_t m_InUse = 0;
+    size_t m_TrimHighWater = 0; // most in use since the last Trim()
+    Stats m_Stats;
+
+    char *Allocate();
+};
+
+} // end namespace format
+} // end namespace adios2
+
+#endif /* ADIOS2_TOOLKIT_FORMAT_BUFFER_CHUNK_CHUNKPOOL_H_ */
@@ -22,8 +22,9 @@ namespace format
 {
 
 ChunkV::ChunkV(const std::string type, const bool AlwaysCopy, const size_t MemAlign,
-               const size_t MemBlockSize, const size_t ChunkSize)
-: BufferV(type, AlwaysCopy, MemAlign, MemBlockSize), m_ChunkSize(ChunkSize)
+               const size_t MemBlockSize, const size_t ChunkSize,
+               std::shared_ptr<ChunkPool> Pool)
+: BufferV(type, AlwaysCopy, MemAlign, MemBlockSize), m_ChunkSize(ChunkSize), m_Pool(Pool)
 {
 }
 
@@ -31,7 +32,14 @@ ChunkV::~ChunkV()
 {
     for (const auto &Chunk : m_Chunks)
     {
-        free(Chunk.AllocatedPtr);
+        if (Chunk.Pooled)
+        {
+            m_Pool->Release(Chunk.Ptr);
+        }
+        else
+        {
+            free(Chunk.AllocatedPtr);
+        }
     }
 }
 
@@ -46,6 +54,25 @@ size_t ChunkV::ChunkAlloc(Chunk &v, const size_t size)
         actualsize = actualsize + (m_MemBlockSize - rem);
     }
 
+    // pooled chunks are not resized, a downsized one keeps its memory
+    if (v.Pooled)
+    {
+        v.Size = actualsize;
+        return actualsize;
+    }
+    if (!v.AllocatedPtr && m_Pool && (actualsize <= m_Pool->ChunkSize()))
+    {
+        char *p = m_Pool->Get();
+        if (p)
+        {
+            v.Ptr = p;
+            v.AllocatedPtr = p;
+            v.Size = actualsize;
+            v.Pooled = true;
+            return actualsize;
+        }
+    }
+
     // align usable buffer to m_MemAlign bytes
     void *b = realloc(v.AllocatedPtr, actualsize + m_MemAlign - 1);
     if (b)
@@ -139,7 +166,7 @@ size_t ChunkV::AddToVec(const size_t size, const void *buf, size_t align, bool C
             size_t NewSize = m_ChunkSize;
             if (size > m_ChunkSize)
                 NewSize = size;
-            Chunk c{nullptr, nullptr, 0};
+            Chunk c{nullptr, nullptr, 0, false};
             ChunkAlloc(c, NewSize);
             m_Chunks.push_back(c);
             m_TailChunk = &m_Chunks.back();
@@ -219,7 +246,7 @@ BufferV::BufferPos ChunkV::Allocate(const size_t size, size_t align)
         size_t NewSize = m_ChunkSize;
         if (size > m_ChunkSize)
             NewSize = size;
-        Chunk c{nullptr, nullptr, 0};
+        Chunk c{nullptr, nullptr, 0, false};
         ChunkAlloc(c, NewSize);
         m_Chunks.push_back(c);
         m_TailChunk = &m_Chunks.back();
@@ -12,6 +12,9 @@
 #include "adios2/core/CoreTypes.h"
 
 #include "adios2/toolkit/format/buffer/BufferV.h"
+#include "adios2/toolkit/format/buffer/chunk/ChunkPool.h"
+
+#include <memory>
 
 namespace adios2
 {
@@ -25,8 +28,11 @@ public:
 
     const size_t m_ChunkSize;
 
+    /* chunks of up to the size of Pool's chunks come from Pool (if given)
+     * and go back there when the ChunkV is deleted */
     ChunkV(const std::string type, const bool AlwaysCopy = false, const size_t MemAlign = 1,
-           const size_t MemBlockSize = 1, const size_t ChunkSize = DefaultBufferChunkSize);
+           const size_t MemBlockSize = 1, const size_t ChunkSize = DefaultBufferChunkSize,
+           std::shared_ptr<ChunkPool> Pool = nullptr);
     virtual ~ChunkV();
 
     virtual std::vector<core::iovec> DataVec() noexcept;
@@ -48,8 +54,11 @@ private:
         char *Ptr;          // aligned, do not free
         void *AllocatedPtr; // original ptr, free this
         size_t Size;
+        bool Pooled; // Ptr came from m_Pool, release it there instead
     };
 
+    std::shared_ptr<ChunkPool> m_Pool;
+
     std::vector<Chunk> m_Chunks;
     size_t m_TailChunkPos = 0;
     Chunk *m_TailChunk = nullptr;
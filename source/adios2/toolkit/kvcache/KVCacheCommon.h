@@ -7,60 +7,44 @@
 #include "QueryBox.h"
 #include <cstring> // For memcpy
 #include <string>
+#include <unordered_set>
 #include <vector>
 
-#include <adios2sys/MD5.h> // Include the MD5 header
-
-#ifdef ADIOS2_HAVE_KVCACHE
-#include <hiredis/hiredis.h>
-#endif
-
 namespace adios2
 {
 
 namespace kvcache
 {
 
+// Interface of the caches for remote data, keys are the remote path fingerprint, variable name,
+// step and box (see QueryBox::toString())
 class KVCacheCommon
 {
-#ifdef ADIOS2_HAVE_KVCACHE
-private:
-    redisContext *m_redisContext = nullptr;
-    redisReply *m_redisReply = nullptr;
-
 public:
-    ~KVCacheCommon() { CloseConnection(); }
+    virtual ~KVCacheCommon() = default;
 
-    void OpenConnection(std::string host = "localhost", int port = 6379);
+    virtual void OpenConnection() = 0;
 
-    void CloseConnection();
+    virtual void CloseConnection() = 0;
 
-    void Set(const char *key, size_t size, void *data);
+    virtual void Set(const char *key, size_t size, void *data) = 0;
 
-    void Get(const char *key, size_t size, void *data);
+    // false if the key is not (or no longer) in the cache, e.g. evicted by
+    // another process since Exists()
+    virtual bool Get(const char *key, size_t size, void *data) = 0;
 
     // Batch operations in pipeline, mode 0 for SET, 1 for GET
-    void AppendCommandInBatch(const char *key, size_t mode, size_t size, void *data);
+    virtual void AppendCommandInBatch(const char *key, size_t mode, size_t size, void *data) = 0;
 
-    void ExecuteBatch(const char *key, size_t mode, size_t size, void *data);
+    // false for a GET whose key is no longer in the cache, as Get()
+    virtual bool ExecuteBatch(const char *key, size_t mode, size_t size, void *data) = 0;
 
-    bool Exists(std::string key);
+    virtual bool Exists(std::string key) = 0;
 
-    void KeyPrefixExistence(const std::string &key_prefix, std::unordered_set<std::string> &keys);
+    virtual void KeyPrefixExistence(const std::string &key_prefix,
+                                    std::unordered_set<std::string> &keys) = 0;
 
     void RemotePathHashMd5(const std::string &remotePath, std::string &result);
-#else
-public:
-    KVCacheCommon() = default;
-    ~KVCacheCommon() = default;
-    void OpenConnection(){};
-    void CloseConnection(){};
-    void AppendCommandInBatch(const char *key, size_t mode, size_t size, void *data){};
-    void ExecuteBatch(const char *key, size_t mode, size_t size, void *data){};
-    bool Exists(std::string key) { return false; };
-    void KeyPrefixExistence(const std::string &key_prefix, std::unordered_set<std::string> &keys){};
-    void RemotePathHashMd5(const std::string &remotePath, std::string &result){};
-#endif /* ADIOS2_HAVE_KVCACHE */
 };
 }; // namespace kvcache
 }; // adios2
@@ -0,0 +1,304 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ *
+ * LocalKVCache.cpp
+ *
+ */
+
+#include "LocalKVCache.h"
+
+#include "adios2/common/ADIOSTypes.h" // PathSeparator
+#include "adios2/helper/adiosLog.h"
+#include "adios2/helper/adiosSystem.h" // CreateDirectory
+
+#include <cstdio>  // std::rename, std::remove
+#include <cstdlib> // std::strtoull
+#include <fstream>
+#include <random>
+#include <sys/stat.h>
+#include <sys/types.h>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace adios2
+{
+namespace kvcache
+{
+
+LocalKVCache::LocalKVCache(const std::string &path, const size_t maxSize)
+: m_Path(path), m_MaxSize(maxSize)
+{
+}
+
+std::string LocalKVCache::BlockPath(const std::string &file) const
+{
+    return m_Path + PathSeparator + file;
+}
+
+std::string LocalKVCache::IndexPath() const { return m_Path + PathSeparator + "index"; }
+
+static bool lf_FileExists(const std::string &path)
+{
+    struct stat st;
+    return stat(path.c_str(), &st) == 0;
+}
+
+void LocalKVCache::OpenConnection()
+{
+    if (m_Open)
+    {
+        return;
+    }
+    if (!helper::CreateDirectory(m_Path))
+    {
+        helper::Throw<std::ios_base::failure>("Toolkit", "kvcache::LocalKVCache", "OpenConnection",
+                                              "cannot create cache directory " + m_Path);
+    }
+    ReadIndex();
+    m_Open = true;
+    m_Changed = false;
+    // the limit may be lower than in the process that filled the cache
+    MakeRoom(0);
+}
+
+void LocalKVCache::CloseConnection()
+{
+    if (!m_Open)
+    {
+        return;
+    }
+    m_Open = false;
+    if (!m_Changed)
+    {
+        return;
+    }
+
+    // other processes may have added blocks since we read the index
+    ReadIndex();
+    MakeRoom(0);
+
+    const std::string tmpPath = IndexPath() + ".tmp" + std::to_string(std::random_device{}());
+    {
+        std::ofstream out(tmpPath);
+        for (const auto &key : m_LRU)
+        {
+            const Entry &entry = m_Index[key];
+            out << entry.Size << '\t' << entry.File << '\t' << key << '\n';
+        }
+    }
+#ifdef _WIN32
+    std::remove(IndexPath().c_str());
+#endif
+    if (std::rename(tmpPath.c_str(), IndexPath().c_str()) != 0)
+    {
+        std::remove(tmpPath.c_str());
+        helper::Log("Toolkit", "kvcache::LocalKVCache", "CloseConnection",
+                    "cannot write cache index " + IndexPath(), helper::LogMode::WARNING);
+    }
+}
+
+void LocalKVCache::ReadIndex()
+{
+    std::ifstream in(IndexPath());
+    std::string line;
+    while (std::getline(in, line))
+    {
+        // size <tab> file <tab> key, most recently used first
+        const size_t tab1 = line.find('\t');
+        const size_t tab2 = (tab1 == std::string::npos) ? tab1 : line.find('\t', tab1 + 1);
+        if (tab2 == std::string::npos)
+        {
+            continue;
+        }
+        const std::string key = line.substr(tab2 + 1);
+        const std::string file = line.substr(tab1 + 1, tab2 - tab1 - 1);
+        if (m_Index.count(key) || !lf_FileExists(BlockPath(file)))
+        {
+            continue;
+        }
+        m_LRU.push_back(key);
+        m_Index[key] = {file, std::strtoull(line.c_str(), nullptr, 10), std::prev(m_LRU.end())};
+        m_Size += m_Index[key].Size;
+    }
+}
+
+void LocalKVCache::Add(const std::string &key, const std::string &file, const size_t size)
+{
+    auto it = m_Index.find(key);
+    if (it != m_Index.end())
+    {
+        m_Size -= it->second.Size;
+        m_LRU.erase(it->second.LRU);
+        m_Index.erase(it);
+    }
+    m_LRU.push_front(key);
+    m_Index[key] = {file, size, m_LRU.begin()};
+    m_Size += size;
+    m_Changed = true;
+}
+
+void LocalKVCache::Remove(const std::string &key)
+{
+    auto it = m_Index.find(key);
+    if (it == m_Index.end())
+    {
+        return;
+    }
+    std::remove(BlockPath(it->second.File).c_str());
+    m_Size -= it->second.Size;
+    m_LRU.erase(it->second.LRU);
+    m_Index.erase(it);
+    m_Changed = true;
+}
+
+void LocalKVCache::MakeRoom(const size_t size)
+{
+    while (!m_LRU.empty() && (m_Size + size > m_MaxSize))
+    {
+        Remove(m_LRU.back());
+    }
+}
+
+void LocalKVCache::Set(const char *key, size_t size, void *data)
+{
+    if (!m_Open || (size > m_MaxSize))
+    {
+        return;
+    }
+    std::string file;
+    RemotePathHashMd5(key, file);
+    file += ".blk";
+
+    auto it = m_Index.find(key);
+    if (it != m_Index.end())
+    {
+        // same file name, it is replaced below
+        m_Size -= it->second.Size;
+        m_LRU.erase(it->second.LRU);
+        m_Index.erase(it);
+    }
+    MakeRoom(size);
+
+    // write a temporary file and rename it so that other processes never
+    // see a partially written block
+    const std::string path = BlockPath(file);
+    const std::string tmpPath = path + ".tmp" + std::to_string(std::random_device{}());
+    FILE *f = fopen(tmpPath.c_str(), "wb");
+    bool written = (f != nullptr);
+    if (f)
+    {
+        written = (fwrite(data, 1, size, f) == size);
+        written = (fclose(f) == 0) && written;
+    }
+#ifdef _WIN32
+    std::remove(path.c_str());
+#endif
+    if (!written || (std::rename(tmpPath.c_str(), path.c_str()) != 0))
+    {
+        std::remove(tmpPath.c_str());
+        helper::Log("Toolkit", "kvcache::LocalKVCache", "Set",
+                    "cannot write cache block " + path + ", not caching " + key,
+                    helper::LogMode::WARNING);
+        return;
+    }
+    Add(key, file, size);
+}
+
+bool LocalKVCache::Get(const char *key, size_t size, void *data)
+{
+    auto it = m_Index.find(key);
+    bool read = (it != m_Index.end()) && (it->second.Size >= size);
+    if (read && size)
+    {
+        m_LRU.splice(m_LRU.begin(), m_LRU, it->second.LRU);
+        m_Changed = true;
+        const std::string path = BlockPath(it->second.File);
+#ifndef _WIN32
+        read = false;
+        int fd = open(path.c_str(), O_RDONLY);
+        struct stat st;
+        // the file may have been cut short by another process, reading past
+        // its end through the map would raise SIGBUS
+        if ((fd != -1) && (fstat(fd, &st) == 0) && (static_cast<size_t>(st.st_size) >= size))
+        {
+            void *map = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (map != MAP_FAILED)
+            {
+                memcpy(data, map, size);
+                munmap(map, size);
+                read = true;
+            }
+        }
+        if (fd != -1)
+        {
+            close(fd);
+        }
+#else
+        std::ifstream in(path, std::ios::binary);
+        read = in.read(static_cast<char *>(data), size).good();
+#endif
+    }
+    if (!read)
+    {
+        // e.g. evicted by another process sharing the cache directory
+        Remove(key);
+    }
+    return read;
+}
+
+void LocalKVCache::AppendCommandInBatch(const char *key, size_t mode, size_t size, void *data)
+{
+    if (mode == 0)
+    {
+        Set(key, size, data);
+    }
+}
+
+bool LocalKVCache::ExecuteBatch(const char *key, size_t mode, size_t size, void *data)
+{
+    if (mode == 1)
+    {
+        return Get(key, size, data);
+    }
+    return true;
+}
+
+bool LocalKVCache::Exists(std::string key)
+{
+    auto it = m_Index.find(key);
+    if (it == m_Index.end())
+    {
+        return false;
+    }
+    if (!lf_FileExists(BlockPath(it->second.File)))
+    {
+        // removed by another process sharing the directory
+        m_Size -= it->second.Size;
+        m_LRU.erase(it->second.LRU);
+        m_Index.erase(it);
+        m_Changed = true;
+        return false;
+    }
+    return true;
+}
+
+void LocalKVCache::KeyPrefixExistence(const std::string &key_prefix,
+                                      std::unordered_set<std::string> &keys)
+{
+    for (const auto &entry : m_Index)
+    {
+        if ((entry.first.compare(0, key_prefix.size(), key_prefix) == 0) &&
+            lf_FileExists(BlockPath(entry.second.File)))
+        {
+            keys.insert(entry.first);
+        }
+    }
+}
+
+} // namespace kvcache
+} // namespace adios2
@@ -0,0 +1,88 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ *
+ * LocalKVCache.h
+ *
+ * Remote data cache in a local directory, without a cache server.  Every
+ * cached box is a file named by the MD5 of its key, read back through a
+ * memory map.  A small index file lists the keys, block sizes and their
+ * order of last use, so the cache survives the process and the least
+ * recently used blocks are removed when the cache grows beyond its limit.
+ */
+
+#ifndef ADIOS2_KVCACHE_LOCALKVCACHE_H
+#define ADIOS2_KVCACHE_LOCALKVCACHE_H
+
+#include "KVCacheCommon.h"
+
+#include <list>
+#include <unordered_map>
+
+namespace adios2
+{
+namespace kvcache
+{
+
+class LocalKVCache : public KVCacheCommon
+{
+public:
+    /**
+     * @param path directory of the cache, created if it doesn't exist
+     * @param maxSize most bytes of data kept in the cache
+     */
+    LocalKVCache(const std::string &path, const size_t maxSize);
+    ~LocalKVCache() { CloseConnection(); }
+
+    /** read the index of the cache directory */
+    void OpenConnection() final;
+
+    /** write the index back, merged with blocks added by other processes */
+    void CloseConnection() final;
+
+    void Set(const char *key, size_t size, void *data) final;
+
+    bool Get(const char *key, size_t size, void *data) final;
+
+    // SETs are done right away, GETs when the batch is executed
+    void AppendCommandInBatch(const char *key, size_t mode, size_t size, void *data) final;
+
+    bool ExecuteBatch(const char *key, size_t mode, size_t size, void *data) final;
+
+    bool Exists(std::string key) final;
+
+    void KeyPrefixExistence(const std::string &key_prefix,
+                            std::unordered_set<std::string> &keys) final;
+
+    size_t Size() const noexcept { return m_Size; }
+
+private:
+    struct Entry
+    {
+        std::string File;
+        size_t Size;
+        std::list<std::string>::iterator LRU;
+    };
+
+    const std::string m_Path;
+    const size_t m_MaxSize;
+    bool m_Open = false;
+    bool m_Changed = false;
+    size_t m_Size = 0;
+    std::unordered_map<std::string, Entry> m_Index;
+    std::list<std::string> m_LRU; // keys, most recently used first
+
+    std::string BlockPath(const std::string &file) const;
+    std::string IndexPath() const;
+    /** read the index file, keys not known yet are added as least recently used */
+    void ReadIndex();
+    void Add(const std::string &key, const std::string &file, const size_t size);
+    void Remove(const std::string &key);
+    /** remove least recently used blocks until size more bytes fit */
+    void MakeRoom(const size_t size);
+};
+
+} // namespace kvcache
+} // namespace adios2
+
+#endif // ADIOS2_KVCACHE_LOCALKVCACHE_H
@@ -0,0 +1,152 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ *
+ * RedisKVCache.cpp
+ *
+ */
+
+#include "RedisKVCache.h"
+
+#include <iostream>
+
+namespace adios2
+{
+namespace kvcache
+{
+
+RedisKVCache::RedisKVCache(const std::string &host, const int port) : m_Host(host), m_Port(port) {}
+
+void RedisKVCache::OpenConnection()
+{
+    m_redisContext = redisConnect(m_Host.c_str(), m_Port);
+    if (m_redisContext == nullptr || m_redisContext->err)
+    {
+        std::cout << "Error to connect to kvcache server: " << m_redisContext->errstr << std::endl;
+        if (m_redisContext)
+        {
+            redisFree(m_redisContext);
+            m_redisContext = nullptr;
+        }
+    }
+    else
+    {
+        std::cout << "------------------------------------------------------------" << std::endl;
+        std::cout << "Connected to kvcache server. KV Cache Version Control: V1.0" << std::endl;
+    }
+}
+
+void RedisKVCache::CloseConnection()
+{
+    if (m_redisContext != nullptr)
+    {
+        m_redisContext = nullptr;
+        std::cout << "KVCache connection closed" << std::endl;
+    }
+}
+
+void RedisKVCache::Set(const char *key, size_t size, void *data)
+{
+    m_redisReply = (redisReply *)redisCommand(m_redisContext, "SET %s %b", key, data, size);
+    if (m_redisReply == NULL)
+    {
+        std::cout << "Error to set key: " << key << std::endl;
+    }
+    else
+    {
+        std::cout << "SET Key: " << key << " Value size: " << size << std::endl;
+        freeReplyObject(m_redisReply);
+    }
+}
+
+bool RedisKVCache::Get(const char *key, size_t size, void *data)
+{
+    bool found = false;
+    m_redisReply = (redisReply *)redisCommand(m_redisContext, "GET %s", key);
+    if (m_redisReply == NULL)
+    {
+        std::cout << "Error to get key: " << key << std::endl;
+    }
+    else
+    {
+        // a nil reply if the key was evicted since Exists()
+        found = (m_redisReply->type == REDIS_REPLY_STRING) && (m_redisReply->len >= size);
+        if (found)
+        {
+            memcpy(data, m_redisReply->str, size);
+        }
+        freeReplyObject(m_redisReply);
+    }
+    return found;
+}
+
+void RedisKVCache::AppendCommandInBatch(const char *key, size_t mode, size_t size, void *data)
+{
+    if (mode == 0)
+    {
+        redisAppendCommand(m_redisContext, "SET %s %b", key, data, size);
+    }
+    else if (mode == 1)
+    {
+        redisAppendCommand(m_redisContext, "GET %s", key);
+    }
+}
+
+bool RedisKVCache::ExecuteBatch(const char *key, size_t mode, size_t size, void *data)
+{
+    bool found = (mode != 1);
+    if (redisGetReply(m_redisContext, (void **)&m_redisReply) == REDIS_OK)
+    {
+        if (mode == 1)
+        {
+            found = (m_redisReply->type == REDIS_REPLY_STRING) && (m_redisReply->len >= size);
+            if (found)
+            {
+                memcpy(data, m_redisReply->str, size);
+            }
+        }
+        freeReplyObject(m_redisReply);
+    }
+    else
+    {
+        std::cout << "Error to execute batch command: " << key << std::endl;
+    }
+    return found;
+}
+
+bool RedisKVCache::Exists(std::string key)
+{
+    m_redisReply = (redisReply *)redisCommand(m_redisContext, "EXISTS %s", key.c_str());
+    if (m_redisReply != NULL)
+    {
+        if (!m_redisReply->integer)
+        {
+            std::cout << "The Key: " << key << " does not exist" << std::endl;
+            return false;
+        }
+        freeReplyObject(m_redisReply);
+        return true;
+    }
+    return false;
+}
+
+void RedisKVCache::KeyPrefixExistence(const std::string &key_prefix,
+                                       std::unordered_set<std::string> &keys)
+{
+    m_redisReply = (redisReply *)redisCommand(m_redisContext, "KEYS %s*", key_prefix.c_str());
+    if (m_redisReply == NULL)
+    {
+        std::cout << "Error to get keys with prefix: " << key_prefix << std::endl;
+    }
+    else
+    {
+        for (size_t i = 0; i < m_redisReply->elements; i++)
+        {
+            keys.insert(m_redisReply->element[i]->str);
+        }
+        freeReplyObject(m_redisReply);
+    }
+}
+
+} // namespace kvcache
+} // namespace adios2
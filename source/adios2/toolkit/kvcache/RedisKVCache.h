@@ -0,0 +1,55 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ *
+ * RedisKVCache.h
+ *
+ * Remote data cache in a Redis server
+ */
+
+#ifndef ADIOS2_KVCACHE_REDISKVCACHE_H
+#define ADIOS2_KVCACHE_REDISKVCACHE_H
+
+#include "KVCacheCommon.h"
+
+#include <hiredis/hiredis.h>
+
+namespace adios2
+{
+namespace kvcache
+{
+
+class RedisKVCache : public KVCacheCommon
+{
+public:
+    RedisKVCache(const std::string &host = "localhost", const int port = 6379);
+    ~RedisKVCache() { CloseConnection(); }
+
+    void OpenConnection() final;
+
+    void CloseConnection() final;
+
+    void Set(const char *key, size_t size, void *data) final;
+
+    bool Get(const char *key, size_t size, void *data) final;
+
+    void AppendCommandInBatch(const char *key, size_t mode, size_t size, void *data) final;
+
+    bool ExecuteBatch(const char *key, size_t mode, size_t size, void *data) final;
+
+    bool Exists(std::string key) final;
+
+    void KeyPrefixExistence(const std::string &key_prefix,
+                            std::unordered_set<std::string> &keys) final;
+
+private:
+    std::string m_Host;
+    int m_Port;
+    redisContext *m_redisContext = nullptr;
+    redisReply *m_redisReply = nullptr;
+};
+
+} // namespace kvcache
+} // namespace adios2
+
+#endif // ADIOS2_KVCACHE_REDISKVCACHE_H
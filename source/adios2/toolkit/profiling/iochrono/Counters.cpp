@@ -0,0 +1,346 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ *
+ * Counters.cpp
+ */
+
+#include "Counters.h"
+#include "Timer.h" // m_ADIOS2ProgStart
+
+#include <algorithm>
+#include <chrono>
+#include <sstream>
+
+namespace adios2
+{
+namespace profiling
+{
+
+namespace
+{
+const char *const TimerNames[] = {
+#define declare_name(NAME, TRACE) #NAME,
+    ADIOS2_FOREACH_PROFILING_TIMER(declare_name)
+#undef declare_name
+};
+
+const bool TimerTraced[] = {
+#define declare_trace(NAME, TRACE) TRACE,
+    ADIOS2_FOREACH_PROFILING_TIMER(declare_trace)
+#undef declare_trace
+};
+
+/** same limits as Timer: intervals over 10 ms, listed up to 500 calls */
+constexpr int64_t LongInterval = 10000;
+constexpr uint64_t LongIntervalCalls = 500;
+
+const char *const BytesNames[] = {
+#define declare_name(NAME) #NAME,
+    ADIOS2_FOREACH_PROFILING_BYTES(declare_name)
+#undef declare_name
+};
+
+const char *const EventNames[] = {
+#define declare_name(NAME) #NAME,
+    ADIOS2_FOREACH_PROFILING_EVENT(declare_name)
+#undef declare_name
+};
+
+std::atomic<uint64_t> NextCountersID(1);
+
+/**
+ * The slots the current thread counts into for the last few Counters
+ * objects it used.  A thread that exits gives its slots back, so the
+ * short lived threads of the engines reuse them.
+ */
+struct SlotCache
+{
+    static constexpr size_t Size = 4;
+    uint64_t Owner[Size] = {0, 0, 0, 0};
+    std::shared_ptr<ThreadCounters> Slots[Size];
+    size_t Next = 0;
+
+    ~SlotCache()
+    {
+        for (auto &slot : Slots)
+        {
+            if (slot)
+            {
+                slot->InUse.store(false, std::memory_order_release);
+            }
+        }
+    }
+};
+
+thread_local SlotCache ThreadSlots;
+
+int64_t Now() noexcept
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+               std::chrono::high_resolution_clock::now() - m_ADIOS2ProgStart)
+        .count();
+}
+
+template <class T>
+void AddRelaxed(std::atomic<T> &counter, const T value) noexcept
+{
+    // single writer, no need for a read-modify-write
+    counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+}
+} // end anonymous namespace
+
+const char *TimerName(const TimerID id) noexcept { return TimerNames[static_cast<size_t>(id)]; }
+
+bool TimerIsTraced(const TimerID id) noexcept { return TimerTraced[static_cast<size_t>(id)]; }
+
+const char *BytesName(const BytesID id) noexcept { return BytesNames[static_cast<size_t>(id)]; }
+
+const char *EventName(const EventID id) noexcept { return EventNames[static_cast<size_t>(id)]; }
+
+bool FindTimer(const std::string &name, TimerID &id) noexcept
+{
+    for (size_t i = 0; i < TimerCount; ++i)
+    {
+        if (name == TimerNames[i])
+        {
+            id = static_cast<TimerID>(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+bool FindBytes(const std::string &name, BytesID &id) noexcept
+{
+    for (size_t i = 0; i < BytesCount; ++i)
+    {
+        if (name == BytesNames[i])
+        {
+            id = static_cast<BytesID>(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+ThreadCounters::ThreadCounters(const size_t index, const size_t traceEvents)
+: Index(index), Owner(std::this_thread::get_id()), InUse(true), Trace(traceEvents), TraceNext(0)
+{
+    for (size_t i = 0; i < TimerCount; ++i)
+    {
+        StartTime[i] = -1;
+        Time[i].store(0, std::memory_order_relaxed);
+        Calls[i].store(0, std::memory_order_relaxed);
+    }
+    for (size_t i = 0; i < BytesCount; ++i)
+    {
+        Bytes[i].store(0, std::memory_order_relaxed);
+    }
+    for (size_t i = 0; i < EventCount; ++i)
+    {
+        Events[i].store(0, std::memory_order_relaxed);
+    }
+}
+
+Counters::Counters() : m_ID(NextCountersID.fetch_add(1)) {}
+
+void Counters::EnableTrace(const size_t eventsPerThread)
+{
+    std::lock_guard<std::mutex> lock(m_SlotsMutex);
+    m_TraceEvents = eventsPerThread;
+    for (auto &slot : m_Slots)
+    {
+        slot->Trace.assign(eventsPerThread, TraceEvent());
+        slot->TraceNext.store(0, std::memory_order_relaxed);
+    }
+}
+
+ThreadCounters &Counters::Slot()
+{
+    SlotCache &cache = ThreadSlots;
+    for (size_t i = 0; i < SlotCache::Size; ++i)
+    {
+        if (cache.Owner[i] == m_ID)
+        {
+            return *cache.Slots[i];
+        }
+    }
+    // first use by this thread, or evicted by other Counters
+    const size_t i = cache.Next;
+    cache.Next = (cache.Next + 1) % SlotCache::Size;
+    cache.Owner[i] = m_ID;
+    cache.Slots[i] = AcquireSlot();
+    return *cache.Slots[i];
+}
+
+std::shared_ptr<ThreadCounters> Counters::AcquireSlot()
+{
+    const std::thread::id self = std::this_thread::get_id();
+    std::lock_guard<std::mutex> lock(m_SlotsMutex);
+    for (auto &slot : m_Slots)
+    {
+        if (slot->InUse.load(std::memory_order_acquire) && (slot->Owner == self))
+        {
+            return slot;
+        }
+    }
+    for (auto &slot : m_Slots)
+    {
+        bool inUse = false;
+        if (slot->InUse.compare_exchange_strong(inUse, true, std::memory_order_acquire))
+        {
+            slot->Owner = self;
+            return slot;
+        }
+    }
+    m_Slots.push_back(std::make_shared<ThreadCounters>(m_Slots.size(), m_TraceEvents));
+    return m_Slots.back();
+}
+
+void Counters::Start(const TimerID id) noexcept
+{
+    Slot().StartTime[static_cast<size_t>(id)] = Now();
+}
+
+void Counters::Stop(const TimerID id) noexcept
+{
+    const size_t i = static_cast<size_t>(id);
+    ThreadCounters &slot = Slot();
+    const int64_t start = slot.StartTime[i];
+    if (start < 0)
+    {
+        return;
+    }
+    const int64_t duration = Now() - start;
+    slot.StartTime[i] = -1;
+    if (TimerTraced[i] && (duration > LongInterval) &&
+        (slot.Calls[i].load(std::memory_order_relaxed) < LongIntervalCalls))
+    {
+        std::lock_guard<std::mutex> lock(slot.LongMutex);
+        slot.Long.push_back({start, duration, id});
+    }
+    AddRelaxed(slot.Time[i], duration);
+    AddRelaxed(slot.Calls[i], uint64_t(1));
+    if (!slot.Trace.empty())
+    {
+        const uint64_t n = slot.TraceNext.load(std::memory_order_relaxed);
+        slot.Trace[n % slot.Trace.size()] = {start, duration, id};
+        slot.TraceNext.store(n + 1, std::memory_order_release);
+    }
+}
+
+void Counters::AddBytes(const BytesID id, const size_t bytes) noexcept
+{
+    AddRelaxed(Slot().Bytes[static_cast<size_t>(id)], static_cast<uint64_t>(bytes));
+}
+
+void Counters::AddEvents(const EventID id, const size_t n) noexcept
+{
+    AddRelaxed(Slot().Events[static_cast<size_t>(id)], static_cast<uint64_t>(n));
+}
+
+int64_t Counters::GetTime(const TimerID id) const noexcept
+{
+    std::lock_guard<std::mutex> lock(m_SlotsMutex);
+    int64_t total = 0;
+    for (const auto &slot : m_Slots)
+    {
+        total += slot->Time[static_cast<size_t>(id)].load(std::memory_order_relaxed);
+    }
+    return total;
+}
+
+uint64_t Counters::GetCalls(const TimerID id) const noexcept
+{
+    std::lock_guard<std::mutex> lock(m_SlotsMutex);
+    uint64_t total = 0;
+    for (const auto &slot : m_Slots)
+    {
+        total += slot->Calls[static_cast<size_t>(id)].load(std::memory_order_relaxed);
+    }
+    return total;
+}
+
+uint64_t Counters::GetBytes(const BytesID id) const noexcept
+{
+    std::lock_guard<std::mutex> lock(m_SlotsMutex);
+    uint64_t total = 0;
+    for (const auto &slot : m_Slots)
+    {
+        total += slot->Bytes[static_cast<size_t>(id)].load(std::memory_order_relaxed);
+    }
+    return total;
+}
+
+uint64_t Counters::GetEvents(const EventID id) const noexcept
+{
+    std::lock_guard<std::mutex> lock(m_SlotsMutex);
+    uint64_t total = 0;
+    for (const auto &slot : m_Slots)
+    {
+        total += slot->Events[static_cast<size_t>(id)].load(std::memory_order_relaxed);
+    }
+    return total;
+}
+
+std::string Counters::GetLongIntervals(const TimerID id) const
+{
+    std::vector<TraceEvent> intervals;
+    {
+        std::lock_guard<std::mutex> lock(m_SlotsMutex);
+        for (const auto &slot : m_Slots)
+        {
+            std::lock_guard<std::mutex> longLock(slot->LongMutex);
+            for (const auto &event : slot->Long)
+            {
+                if (event.Timer == id)
+                {
+                    intervals.push_back(event);
+                }
+            }
+        }
+    }
+    std::sort(intervals.begin(), intervals.end(),
+              [](const TraceEvent &a, const TraceEvent &b) { return a.Start < b.Start; });
+
+    std::ostringstream ss;
+    for (size_t n = 0; n < intervals.size(); ++n)
+    {
+        ss << (n ? "," : "") << "\"" << intervals[n].Start / 1000.0 << "+"
+           << intervals[n].Duration / 1000.0 << "\"";
+    }
+    return ss.str();
+}
+
+std::string Counters::GetTraceJSON(const int rank) const
+{
+    const std::string pid = std::to_string(rank);
+    std::string json = "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" + pid +
+                       ",\"args\":{\"name\":\"rank " + pid + "\"}}";
+
+    std::lock_guard<std::mutex> lock(m_SlotsMutex);
+    for (const auto &slot : m_Slots)
+    {
+        const size_t size = slot->Trace.size();
+        if (size == 0)
+        {
+            continue;
+        }
+        const uint64_t next = slot->TraceNext.load(std::memory_order_acquire);
+        const uint64_t first = (next > size) ? next - size : 0;
+        const std::string tid = std::to_string(slot->Index);
+        for (uint64_t n = first; n < next; ++n)
+        {
+            const TraceEvent &event = slot->Trace[n % size];
+            json += ",\n{\"name\":\"" + std::string(TimerName(event.Timer)) +
+                    "\",\"ph\":\"X\",\"pid\":" + pid + ",\"tid\":" + tid +
+                    ",\"ts\":" + std::to_string(event.Start) +
+                    ",\"dur\":" + std::to_string(event.Duration) + "}";
+        }
+    }
+    return json;
+}
+
+} // end namespace profiling
+} // end namespace adios2
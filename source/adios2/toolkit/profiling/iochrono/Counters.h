@@ -0,0 +1,214 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ *
+ * Counters.h
+ *
+ * Timers, byte and event counters registered at compile time for the
+ * engine hot paths.  Every thread counts into its own slot, so Start/Stop/AddBytes
+ * take no lock and do no string lookup, and an optional ring buffer per
+ * thread keeps the last timed intervals for a Chrome trace / Perfetto view.
+ */
+
+#ifndef ADIOS2_TOOLKIT_PROFILING_IOCHRONO_COUNTERS_H_
+#define ADIOS2_TOOLKIT_PROFILING_IOCHRONO_COUNTERS_H_
+
+/// \cond EXCLUDE_FROM_DOXYGEN
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+/// \endcond
+
+namespace adios2
+{
+namespace profiling
+{
+
+/**
+ * Timers known to the profiler, the name is also the key in profiling.json.
+ * For the timers marked true profiling.json also lists the intervals over
+ * 10 ms under "trace", as the string keyed Timer does.
+ */
+#define ADIOS2_FOREACH_PROFILING_TIMER(MACRO)                                                      \
+    MACRO(buffering, true)                                                                         \
+    MACRO(ES, true)                                                                                \
+    MACRO(PP, true)                                                                                \
+    MACRO(ES_meta1_gather, false)                                                                  \
+    MACRO(ES_meta2_gather, false)                                                                  \
+    MACRO(ES_write_metadata, false)                                                                \
+    MACRO(MetadataBlockWrite, false)                                                               \
+    MACRO(ES_AGG1, false)                                                                          \
+    MACRO(ES_GatherMetadataBlocks, false)                                                          \
+    MACRO(ES_simple_meta, false)                                                                   \
+    MACRO(ES_simple_gather, false)                                                                 \
+    MACRO(ES_meta1, true)                                                                          \
+    MACRO(ES_meta2, true)                                                                          \
+    MACRO(ES_aggregate_info, false)                                                                \
+    MACRO(ES_gather_write_meta, false)                                                             \
+    MACRO(FixedMetaInfoGather, false)                                                              \
+    MACRO(MetaInfoBcast, false)                                                                    \
+    MACRO(SelectMetaInfoGather, false)                                                             \
+    MACRO(DynamicInfo, false)                                                                      \
+    MACRO(ES_close, true)                                                                          \
+    MACRO(ES_AWD, true)                                                                            \
+    MACRO(WaitOnAsync, true)                                                                       \
+    MACRO(BS_WaitOnAsync, true)                                                                    \
+    MACRO(DC_WaitOnAsync1, true)                                                                   \
+    MACRO(DC_WaitOnAsync2, true)                                                                   \
+    MACRO(PDW, true)                                                                               \
+    MACRO(DeriveVars, true)                                                                        \
+    MACRO(DataRead, true)                                                                          \
+    MACRO(ReadUnit, false)                                                                         \
+    MACRO(MetaDataRead, true)                                                                      \
+    MACRO(MetaMetaDataRead, true)
+
+/** Byte counters known to the profiler */
+#define ADIOS2_FOREACH_PROFILING_BYTES(MACRO)                                                      \
+    MACRO(buffering)                                                                               \
+    MACRO(dataread)                                                                                \
+    MACRO(metadataread)                                                                            \
+    MACRO(metametadataread)
+
+/** Events counted by the profiler, listed by name under "events" */
+#define ADIOS2_FOREACH_PROFILING_EVENT(MACRO)                                                      \
+    MACRO(MetadataStepInstall)                                                                     \
+    MACRO(MetadataStepRelease)                                                                     \
+    MACRO(MetadataCopy)                                                                            \
+    MACRO(MetadataDecodeRange)                                                                     \
+    MACRO(ReadAheadHit)                                                                            \
+    MACRO(ReadCoalesced)                                                                           \
+    MACRO(RemoteCompressedGet)                                                                     \
+    MACRO(BufferChunkReuse)                                                                        \
+    MACRO(ReadBufferReuse)
+
+enum class TimerID : uint8_t
+{
+#define declare_id(NAME, TRACE) NAME,
+    ADIOS2_FOREACH_PROFILING_TIMER(declare_id)
+#undef declare_id
+        Count
+};
+
+enum class BytesID : uint8_t
+{
+#define declare_id(NAME) NAME,
+    ADIOS2_FOREACH_PROFILING_BYTES(declare_id)
+#undef declare_id
+        Count
+};
+
+enum class EventID : uint8_t
+{
+#define declare_id(NAME) NAME,
+    ADIOS2_FOREACH_PROFILING_EVENT(declare_id)
+#undef declare_id
+        Count
+};
+
+constexpr size_t TimerCount = static_cast<size_t>(TimerID::Count);
+constexpr size_t BytesCount = static_cast<size_t>(BytesID::Count);
+constexpr size_t EventCount = static_cast<size_t>(EventID::Count);
+
+const char *TimerName(const TimerID id) noexcept;
+bool TimerIsTraced(const TimerID id) noexcept;
+const char *BytesName(const BytesID id) noexcept;
+const char *EventName(const EventID id) noexcept;
+
+/** false if name is not a registered timer / byte counter */
+bool FindTimer(const std::string &name, TimerID &id) noexcept;
+bool FindBytes(const std::string &name, BytesID &id) noexcept;
+
+/** One timed interval, in microseconds since the program start */
+struct TraceEvent
+{
+    int64_t Start;
+    int64_t Duration;
+    TimerID Timer;
+};
+
+/**
+ * Counters of one thread.  Only the owning thread writes them, relaxed
+ * atomics let the totals be read from another thread at any time.
+ */
+struct ThreadCounters
+{
+    ThreadCounters(const size_t index, const size_t traceEvents);
+
+    /** trace thread id, the order in which the slots were created */
+    const size_t Index;
+    std::thread::id Owner;
+    std::atomic<bool> InUse;
+
+    int64_t StartTime[TimerCount];
+    std::atomic<int64_t> Time[TimerCount];
+    std::atomic<uint64_t> Calls[TimerCount];
+    std::atomic<uint64_t> Bytes[BytesCount];
+    std::atomic<uint64_t> Events[EventCount];
+
+    /** ring buffer of the last Trace.size() intervals, empty if not tracing */
+    std::vector<TraceEvent> Trace;
+    std::atomic<uint64_t> TraceNext;
+
+    /** intervals over 10 ms of the traced timers, rare enough for a lock */
+    std::mutex LongMutex;
+    std::vector<TraceEvent> Long;
+};
+
+class Counters
+{
+public:
+    Counters();
+    ~Counters() = default;
+
+    /**
+     * Keep the last eventsPerThread intervals of every thread for
+     * GetTraceJSON, 0 turns tracing off.  Call before other threads count.
+     */
+    void EnableTrace(const size_t eventsPerThread);
+
+    void Start(const TimerID id) noexcept;
+
+    /** adds the time since Start on the same thread, ignored without Start */
+    void Stop(const TimerID id) noexcept;
+
+    void AddBytes(const BytesID id, const size_t bytes) noexcept;
+
+    void AddEvents(const EventID id, const size_t n = 1) noexcept;
+
+    /** totals over all threads */
+    int64_t GetTime(const TimerID id) const noexcept;
+    uint64_t GetCalls(const TimerID id) const noexcept;
+    uint64_t GetBytes(const BytesID id) const noexcept;
+    uint64_t GetEvents(const EventID id) const noexcept;
+
+    /**
+     * The intervals over 10 ms of a traced timer in time order, in the
+     * "start+duration" milliseconds format of Timer, separated by commas
+     */
+    std::string GetLongIntervals(const TimerID id) const;
+
+    /**
+     * The traced intervals as Chrome trace event objects ("ph":"X") with
+     * pid = rank, separated by ",\n", starting with the process name.
+     */
+    std::string GetTraceJSON(const int rank) const;
+
+private:
+    /** unique over the life of the program, thread caches are keyed by it */
+    const uint64_t m_ID;
+    size_t m_TraceEvents = 0;
+    mutable std::mutex m_SlotsMutex;
+    std::vector<std::shared_ptr<ThreadCounters>> m_Slots;
+
+    ThreadCounters &Slot();
+    std::shared_ptr<ThreadCounters> AcquireSlot();
+};
+
+} // end namespace profiling
+} // end namespace adios2
+
+#endif /* ADIOS2_TOOLKIT_PROFILING_IOCHRONO_COUNTERS_H_ */
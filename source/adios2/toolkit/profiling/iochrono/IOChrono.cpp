@@ -9,6 +9,7 @@
  */
 
 #include "IOChrono.h"
+#include "adios2/helper/adiosFunctions.h" // LocalTimeDate
 #include "adios2/helper/adiosMemory.h"
 
 namespace adios2
@@ -35,50 +36,38 @@ void IOChrono::Stop(const std::string process)
 //
 // class JSON Profiler
 //
-JSONProfiler::JSONProfiler(helper::Comm const &comm) : m_Comm(comm)
+JSONProfiler::JSONProfiler(helper::Comm const &comm)
+: m_LocalTimeDate(helper::LocalTimeDate()), m_Comm(comm)
 {
     m_Profiler.m_IsActive = true; // default is true
+    m_RankMPI = m_Comm.Rank();
+}
 
-    AddTimerWatch("buffering");
-    AddTimerWatch("ES");
-    AddTimerWatch("PP");
-    AddTimerWatch("ES_meta1_gather", false);
-    AddTimerWatch("ES_meta2_gather", false);
-    AddTimerWatch("ES_write_metadata", false);
-    AddTimerWatch("MetadataBlockWrite", false);
-    AddTimerWatch("ES_AGG1", false);
-    AddTimerWatch("ES_GatherMetadataBlocks", false);
-    AddTimerWatch("ES_simple_meta", false);
-    AddTimerWatch("ES_simple_gather", false);
-
-    AddTimerWatch("ES_meta1");
-    AddTimerWatch("ES_meta2");
-
-    AddTimerWatch("ES_aggregate_info", false);
-    AddTimerWatch("ES_gather_write_meta", false);
-    AddTimerWatch("FixedMetaInfoGather", false);
-    AddTimerWatch("MetaInfoBcast", false);
-    AddTimerWatch("SelectMetaInfoGather", false);
-
-    AddTimerWatch("ES_close");
-    AddTimerWatch("ES_AWD");
-    AddTimerWatch("WaitOnAsync");
-    AddTimerWatch("BS_WaitOnAsync");
-    AddTimerWatch("DC_WaitOnAsync1");
-    AddTimerWatch("DC_WaitOnAsync2");
-    AddTimerWatch("PDW");
-
-    AddTimerWatch("DeriveVars");
-
-    m_Profiler.m_Bytes.emplace("buffering", 0);
-    AddTimerWatch("DataRead");
-    m_Profiler.m_Bytes.emplace("dataread", 0);
-    AddTimerWatch("MetaDataRead");
-    m_Profiler.m_Bytes.emplace("metadataread", 0);
-    AddTimerWatch("MetaMetaDataRead");
-    m_Profiler.m_Bytes.emplace("metadmetaataread", 0);
+void JSONProfiler::Start(const std::string process)
+{
+    TimerID id;
+    if (FindTimer(process, id))
+        m_Counters.Start(id);
+    else
+        m_Profiler.Start(process);
+}
 
-    m_RankMPI = m_Comm.Rank();
+void JSONProfiler::Stop(const std::string process)
+{
+    TimerID id;
+    if (FindTimer(process, id))
+        m_Counters.Stop(id);
+    else
+        m_Profiler.Stop(process);
+}
+
+void JSONProfiler::AddBytes(const std::string process, size_t bytes)
+{
+    BytesID id;
+    if (FindBytes(process, id))
+        m_Counters.AddBytes(id, bytes);
+    else
+        m_Profiler.m_Bytes[process] += bytes;
 }
 
 void JSONProfiler::AddTimerWatch(const std::string &name, const bool trace)
@@ -102,13 +91,37 @@ std::string JSONProfiler::GetRankProfilingJSON(
 
     auto &profiler = m_Profiler;
 
-    std::string timeDate(profiler.m_Timers.at("buffering").m_LocalTimeDate);
+    std::string timeDate(m_LocalTimeDate);
     timeDate.pop_back();
     // avoid whitespace
     std::replace(timeDate.begin(), timeDate.end(), ' ', '_');
 
     rankLog += ", \"start\":\"" + timeDate + "\"";
 
+    // same layout as Timer::AddToJsonStr, in microseconds
+    for (size_t i = 0; i < TimerCount; ++i)
+    {
+        const TimerID id = static_cast<TimerID>(i);
+        const uint64_t nCalls = m_Counters.GetCalls(id);
+        if (nCalls > 0)
+        {
+            const std::string name(TimerName(id));
+            const std::string time(std::to_string(m_Counters.GetTime(id)));
+            rankLog += ",\"" + name + "_mus\": " + time;
+            rankLog += ", \"" + name + "\":{\"mus\":" + time;
+            rankLog += ", \"nCalls\":" + std::to_string(nCalls);
+            if (TimerIsTraced(id) && (nCalls < 500))
+            {
+                const std::string intervals(m_Counters.GetLongIntervals(id));
+                if (!intervals.empty())
+                {
+                    rankLog += ", \"trace\":[" + intervals + "]";
+                }
+            }
+            rankLog += "}";
+        }
+    }
+
     for (const auto &timerPair : profiler.m_Timers)
     {
         const profiling::Timer &timer = timerPair.second;
@@ -120,13 +133,29 @@ std::string JSONProfiler::GetRankProfilingJSON(
         }
     }
 
-    size_t DataBytes = m_Profiler.m_Bytes["dataread"];
-    size_t MetaDataBytes = m_Profiler.m_Bytes["metadataread"];
-    size_t MetaMetaDataBytes = m_Profiler.m_Bytes["metametadataread"];
+    size_t DataBytes = m_Counters.GetBytes(BytesID::dataread);
+    size_t MetaDataBytes = m_Counters.GetBytes(BytesID::metadataread);
+    size_t MetaMetaDataBytes = m_Counters.GetBytes(BytesID::metametadataread);
     rankLog += ", \"databytes\":" + std::to_string(DataBytes);
     rankLog += ", \"metadatabytes\":" + std::to_string(MetaDataBytes);
     rankLog += ", \"metametadatabytes\":" + std::to_string(MetaMetaDataBytes);
 
+    std::string events;
+    for (size_t i = 0; i < EventCount; ++i)
+    {
+        const EventID id = static_cast<EventID>(i);
+        const uint64_t n = m_Counters.GetEvents(id);
+        if (n > 0)
+        {
+            events += std::string(events.empty() ? "" : ", ") + "\"" + EventName(id) +
+                      "\":" + std::to_string(n);
+        }
+    }
+    if (!events.empty())
+    {
+        rankLog += ", \"events\":{" + events + "}";
+    }
+
     const size_t transportsSize = transportsTypes.size();
 
     for (unsigned int t = 0; t < transportsSize; ++t)
@@ -157,6 +186,8 @@ std::string JSONProfiler::GetRankProfilingJSON(
     return rankLog;
 }
 
+std::string JSONProfiler::GetRankTraceJSON() const { return m_Counters.GetTraceJSON(m_RankMPI); }
+
 std::vector<char> JSONProfiler::AggregateProfilingJSON(const std::string &rankLog) const
 {
     // Gather sizes
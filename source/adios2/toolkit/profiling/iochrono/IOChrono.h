@@ -18,6 +18,7 @@
 
 #include "adios2/common/ADIOSConfig.h"
 #include "adios2/helper/adiosComm.h"
+#include "adios2/toolkit/profiling/iochrono/Counters.h"
 #include "adios2/toolkit/profiling/iochrono/Timer.h"
 
 namespace adios2
@@ -59,6 +60,12 @@ public:
     void Stop(const std::string process);
 };
 
+/**
+ * Per rank profile of an engine.  The timers, byte and event counters
+ * registered in Counters.h are counted per thread without locks, use the
+ * TimerID/BytesID/EventID overloads for them on hot paths.  Other names go to
+ * a string keyed IOChrono and must be added with AddTimerWatch first.
+ */
 class JSONProfiler
 {
 public:
@@ -66,21 +73,31 @@ public:
     void Gather();
     void AddTimerWatch(const std::string &, const bool trace = false);
 
-    void Start(const std::string process) { m_Profiler.Start(process); };
-    void Stop(const std::string process) { m_Profiler.Stop(process); };
-    void AddBytes(const std::string process, size_t bytes)
-    {
-        m_Profiler.m_Bytes[process] += bytes;
-    };
+    void Start(const TimerID id) noexcept { m_Counters.Start(id); };
+    void Stop(const TimerID id) noexcept { m_Counters.Stop(id); };
+    void AddBytes(const BytesID id, size_t bytes) noexcept { m_Counters.AddBytes(id, bytes); };
+    void AddEvents(const EventID id, size_t n = 1) noexcept { m_Counters.AddEvents(id, n); };
+
+    void Start(const std::string process);
+    void Stop(const std::string process);
+    void AddBytes(const std::string process, size_t bytes);
+
+    /** keep the last eventsPerThread timed intervals of each thread, 0 = off */
+    void EnableTrace(const size_t eventsPerThread) { m_Counters.EnableTrace(eventsPerThread); }
 
     std::string GetRankProfilingJSON(
         const std::vector<std::string> &transportsTypes,
         const std::vector<adios2::profiling::IOChrono *> &transportsProfilers) noexcept;
 
+    /** Chrome trace / Perfetto events of this rank, for AggregateProfilingJSON */
+    std::string GetRankTraceJSON() const;
+
     std::vector<char> AggregateProfilingJSON(const std::string &rankLog) const;
 
 private:
+    Counters m_Counters;
     IOChrono m_Profiler;
+    std::string m_LocalTimeDate;
     int m_RankMPI = 0;
     helper::Comm const &m_Comm;
 };
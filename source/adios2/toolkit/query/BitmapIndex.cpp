@@ -0,0 +1,282 @@
+#include "BitmapIndex.h"
+
+#include "adios2/common/ADIOSMacros.h"
+
+#include <cstring> // memcpy
+
+namespace adios2
+{
+namespace query
+{
+
+namespace
+{
+constexpr uint32_t BitmapIndexVersion = 1;
+constexpr size_t BitmapIndexHeaderSize = 2 * sizeof(uint32_t) + sizeof(uint64_t);
+const std::string BitmapIndexPrefix = "__bitmap_index__/";
+
+void PutVarint(std::vector<uint8_t> &out, uint64_t value)
+{
+    while (value >= 0x80)
+    {
+        out.push_back(static_cast<uint8_t>(value | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<uint8_t>(value));
+}
+
+template <class T>
+void PutValue(std::vector<uint8_t> &out, const T &value)
+{
+    const size_t pos = out.size();
+    out.resize(pos + sizeof(T));
+    std::memcpy(out.data() + pos, &value, sizeof(T));
+}
+
+template <class T>
+void GetValue(const uint8_t *&p, T &value)
+{
+    std::memcpy(&value, p, sizeof(T));
+    p += sizeof(T);
+}
+
+template <class T>
+bool IsNaN(const T &value)
+{
+    return value != value;
+}
+
+/** run length encodes increasing positions as they come */
+struct BitmapEncoder
+{
+    std::vector<uint8_t> m_Bytes;
+    size_t m_Written = 0;  // end of the last run in m_Bytes
+    size_t m_RunStart = 0; // pending run of ones [m_RunStart, m_RunEnd)
+    size_t m_RunEnd = 0;
+
+    void Add(size_t pos)
+    {
+        if ((pos == m_RunEnd) && (m_RunEnd > m_RunStart))
+        {
+            ++m_RunEnd;
+            return;
+        }
+        Flush();
+        m_RunStart = pos;
+        m_RunEnd = pos + 1;
+    }
+
+    void Flush()
+    {
+        if (m_RunEnd > m_RunStart)
+        {
+            PutVarint(m_Bytes, m_RunStart - m_Written);
+            PutVarint(m_Bytes, m_RunEnd - m_RunStart);
+            m_Written = m_RunEnd;
+            m_RunStart = m_RunEnd;
+        }
+    }
+};
+} // end anonymous namespace
+
+std::string BitmapIndexName(const std::string &varName) { return BitmapIndexPrefix + varName; }
+
+bool IsBitmapIndexName(const std::string &name)
+{
+    return name.compare(0, BitmapIndexPrefix.size(), BitmapIndexPrefix) == 0;
+}
+
+void BuildEmptyBitmapIndex(std::vector<uint8_t> &out)
+{
+    out.clear();
+    out.reserve(BitmapIndexHeaderSize);
+    PutValue(out, BitmapIndexVersion);
+    PutValue(out, static_cast<uint32_t>(0));
+    PutValue(out, static_cast<uint64_t>(0));
+}
+
+template <class T>
+void BuildBitmapIndex(const T *values, size_t nElems, unsigned int nBins, std::vector<uint8_t> &out)
+{
+    bool found = false;
+    T lo = T();
+    T hi = T();
+    for (size_t i = 0; i < nElems; ++i)
+    {
+        const T v = values[i];
+        if (IsNaN(v))
+            continue;
+        if (!found)
+        {
+            lo = hi = v;
+            found = true;
+        }
+        else if (v < lo)
+            lo = v;
+        else if (v > hi)
+            hi = v;
+    }
+
+    if (!found || (nBins == 0))
+    {
+        BuildEmptyBitmapIndex(out);
+        return;
+    }
+    if (lo == hi)
+        nBins = 1;
+
+    // bin boundaries only need to be approximate, the reader uses the exact
+    // min/max of the values in each bin
+    const double base = static_cast<double>(lo);
+    const double scale = nBins / (static_cast<double>(hi) - base);
+
+    std::vector<uint64_t> counts(nBins, 0);
+    std::vector<T> binMin(nBins);
+    std::vector<T> binMax(nBins);
+    std::vector<BitmapEncoder> bitmaps(nBins);
+    for (size_t i = 0; i < nElems; ++i)
+    {
+        const T v = values[i];
+        if (IsNaN(v))
+            continue;
+
+        size_t b = 0;
+        if (nBins > 1)
+        {
+            const double x = (static_cast<double>(v) - base) * scale;
+            if (!(x > 0.0))
+                b = 0;
+            else if (x >= nBins)
+                b = nBins - 1;
+            else
+                b = static_cast<size_t>(x);
+        }
+
+        if (counts[b] == 0)
+            binMin[b] = binMax[b] = v;
+        else if (v < binMin[b])
+            binMin[b] = v;
+        else if (v > binMax[b])
+            binMax[b] = v;
+        ++counts[b];
+        bitmaps[b].Add(i);
+    }
+
+    size_t bitmapBytes = 0;
+    for (auto &bitmap : bitmaps)
+    {
+        bitmap.Flush();
+        bitmapBytes += bitmap.m_Bytes.size();
+    }
+
+    out.clear();
+    out.reserve(BitmapIndexHeaderSize + nBins * (2 * sizeof(uint64_t) + 2 * sizeof(T)) +
+                bitmapBytes);
+    PutValue(out, BitmapIndexVersion);
+    PutValue(out, static_cast<uint32_t>(nBins));
+    PutValue(out, static_cast<uint64_t>(nElems));
+    for (unsigned int b = 0; b < nBins; ++b)
+    {
+        PutValue(out, counts[b]);
+        PutValue(out, static_cast<uint64_t>(bitmaps[b].m_Bytes.size()));
+        PutValue(out, binMin[b]);
+        PutValue(out, binMax[b]);
+    }
+    for (const auto &bitmap : bitmaps)
+    {
+        out.insert(out.end(), bitmap.m_Bytes.begin(), bitmap.m_Bytes.end());
+    }
+}
+
+void DecodeBitmap(const uint8_t *bitmap, size_t bytes, std::vector<size_t> &positions)
+{
+    const uint8_t *p = bitmap;
+    const uint8_t *end = bitmap + bytes;
+    size_t pos = 0;
+    bool ones = false;
+    while (p < end)
+    {
+        uint64_t run = 0;
+        int shift = 0;
+        while ((p < end) && (*p & 0x80))
+        {
+            run |= static_cast<uint64_t>(*p & 0x7f) << shift;
+            shift += 7;
+            ++p;
+        }
+        if (p == end)
+            break; // truncated varint
+        run |= static_cast<uint64_t>(*p) << shift;
+        ++p;
+
+        if (ones)
+        {
+            for (uint64_t k = 0; k < run; ++k)
+                positions.push_back(pos++);
+        }
+        else
+        {
+            pos += run;
+        }
+        ones = !ones;
+    }
+}
+
+template <class T>
+bool BitmapIndexBlock<T>::Parse(const uint8_t *buffer, size_t size)
+{
+    if ((buffer == nullptr) || (size < BitmapIndexHeaderSize))
+        return false;
+
+    const uint8_t *p = buffer;
+    uint32_t version, nBins;
+    uint64_t nElems;
+    GetValue(p, version);
+    GetValue(p, nBins);
+    GetValue(p, nElems);
+    if ((version != BitmapIndexVersion) || (nBins == 0))
+        return false;
+
+    const size_t binRecordSize = 2 * sizeof(uint64_t) + 2 * sizeof(T);
+    if ((size - BitmapIndexHeaderSize) / binRecordSize < nBins)
+        return false;
+
+    m_NElems = static_cast<size_t>(nElems);
+    m_Counts.resize(nBins);
+    m_BinMin.resize(nBins);
+    m_BinMax.resize(nBins);
+    m_Bitmaps.resize(nBins);
+    m_BitmapBytes.resize(nBins);
+
+    size_t bitmapPos = BitmapIndexHeaderSize + nBins * binRecordSize;
+    for (uint32_t b = 0; b < nBins; ++b)
+    {
+        uint64_t bytes;
+        GetValue(p, m_Counts[b]);
+        GetValue(p, bytes);
+        GetValue(p, m_BinMin[b]);
+        GetValue(p, m_BinMax[b]);
+        if (bytes > size - bitmapPos)
+            return false;
+        m_Bitmaps[b] = buffer + bitmapPos;
+        m_BitmapBytes[b] = static_cast<size_t>(bytes);
+        bitmapPos += static_cast<size_t>(bytes);
+    }
+    return true;
+}
+
+template <class T>
+void BitmapIndexBlock<T>::GetPositions(size_t bin, std::vector<size_t> &positions) const
+{
+    DecodeBitmap(m_Bitmaps[bin], m_BitmapBytes[bin], positions);
+}
+
+#define declare_type(T)                                                                            \
+    template void BuildBitmapIndex(const T *, size_t, unsigned int, std::vector<uint8_t> &);       \
+    template class BitmapIndexBlock<T>;
+
+ADIOS2_FOREACH_ATTRIBUTE_PRIMITIVE_STDTYPE_1ARG(declare_type)
+#undef declare_type
+
+} // end namespace query
+} // end namespace adios2
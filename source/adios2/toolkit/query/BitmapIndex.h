@@ -0,0 +1,65 @@
+#ifndef ADIOS2_BITMAP_INDEX_H
+#define ADIOS2_BITMAP_INDEX_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace adios2
+{
+namespace query
+{
+
+/**
+ * Value index of one written block, stored by BP5 (parameter QueryIndexBins)
+ * as one block of the uint8_t local array BitmapIndexName(var) per block of
+ * var, so that block IDs match.
+ *
+ * The [min, max] range of the block is cut into equal-width bins. Each bin
+ * keeps its element count (the histogram), the min/max of the values that
+ * fell into it and the positions of those values in the block as a run
+ * length encoded bitmap. Layout (native byte order):
+ *   uint32 version, uint32 nBins, uint64 nElems,
+ *   nBins x { uint64 count, uint64 bitmapBytes, T min, T max },
+ *   the bitmaps back to back.
+ * A bitmap is a sequence of varints alternating the length of a run of
+ * zeroes and of a run of ones, starting with zeroes.
+ * nBins == 0 means the block has no index (e.g. written with a span).
+ */
+std::string BitmapIndexName(const std::string &varName);
+bool IsBitmapIndexName(const std::string &name);
+
+/** Build the index of nElems values (NaNs are not indexed) */
+template <class T>
+void BuildBitmapIndex(const T *values, size_t nElems, unsigned int nBins,
+                      std::vector<uint8_t> &out);
+
+/** Index of a block without bins */
+void BuildEmptyBitmapIndex(std::vector<uint8_t> &out);
+
+template <class T>
+class BitmapIndexBlock
+{
+public:
+    /** false if buffer is not a valid index or the block has no bins */
+    bool Parse(const uint8_t *buffer, size_t size);
+
+    /** append the positions of the elements in bin to positions */
+    void GetPositions(size_t bin, std::vector<size_t> &positions) const;
+
+    size_t m_NElems = 0;
+    std::vector<uint64_t> m_Counts;
+    std::vector<T> m_BinMin;
+    std::vector<T> m_BinMax;
+
+private:
+    std::vector<const uint8_t *> m_Bitmaps;
+    std::vector<size_t> m_BitmapBytes;
+};
+
+void DecodeBitmap(const uint8_t *bitmap, size_t bytes, std::vector<size_t> &positions);
+
+} // end namespace query
+} // end namespace adios2
+
+#endif
@@ -1,9 +1,12 @@
 #ifndef ADIOS2_BLOCK_INDEX_H
 #define ADIOS2_BLOCK_INDEX_H
 
+#include "BitmapIndex.h"
 #include "Index.h"
 #include "Query.h"
 
+#include <algorithm> // std::sort, std::reverse
+
 namespace adios2
 {
 namespace query
@@ -46,6 +49,72 @@ public:
         }
     }
 
+    // Exact hits: the elements of the blocks that satisfy the query. Uses the
+    // bitmap index of a block (BP5 QueryIndexBins) when there is one, then only
+    // the bins straddling the query bounds are checked against the data.
+    // Without index the data of every block whose min/max match is checked.
+    void EvaluateHits(const QueryVar &query, std::vector<BlockValueHits> &hits)
+    {
+        if (nullptr == m_VarPtr)
+        {
+            throw std::runtime_error("Unable to evaluate query! Invalid Variable detected");
+        }
+
+        size_t currStep = m_IdxReader.CurrentStep();
+        adios2::Dims currShape = m_VarPtr->Shape();
+        if (!query.IsSelectionValid(currShape))
+            return;
+
+        const TypedRangeTree<T> ranges(query.m_RangeTree);
+        const bool isLocal = (m_VarPtr->m_ShapeID == adios2::ShapeID::LocalArray);
+
+        // reading blocks changes the selection of the variable, put it back after
+        const adios2::SelectionType selectionType = m_VarPtr->m_SelectionType;
+        const size_t blockID = m_VarPtr->m_BlockID;
+        const adios2::Dims start = m_VarPtr->m_Start;
+        const adios2::Dims count = m_VarPtr->m_Count;
+
+        auto MinBlocksInfo = m_IdxReader.MinBlocksInfo(*m_VarPtr, currStep);
+        if (MinBlocksInfo != nullptr)
+        {
+            m_IndexVarPtr = InquireIndexVariable(currStep, MinBlocksInfo->BlocksInfo.size());
+            for (auto &blockInfo : MinBlocksInfo->BlocksInfo)
+            {
+                T bmin = *(T *)&blockInfo.MinMax.MinUnion;
+                T bmax = *(T *)&blockInfo.MinMax.MaxUnion;
+                Dims ss, cc(blockInfo.Count, blockInfo.Count + MinBlocksInfo->Dims);
+                if (!isLocal)
+                    ss.assign(blockInfo.Start, blockInfo.Start + MinBlocksInfo->Dims);
+                if (MinBlocksInfo->IsReverseDims)
+                {
+                    std::reverse(ss.begin(), ss.end());
+                    std::reverse(cc.begin(), cc.end());
+                }
+                EvaluateBlockHits(query, ranges, blockInfo.BlockID, ss, cc, bmin, bmax, hits);
+            }
+            delete MinBlocksInfo;
+        }
+        else
+        {
+            std::vector<typename adios2::core::Variable<T>::BPInfo> varBlocksInfo =
+                m_IdxReader.BlocksInfo(*m_VarPtr, currStep);
+            m_IndexVarPtr = InquireIndexVariable(currStep, varBlocksInfo.size());
+            for (auto &blockInfo : varBlocksInfo)
+            {
+                Dims ss;
+                if (!isLocal)
+                    ss = blockInfo.Start;
+                EvaluateBlockHits(query, ranges, blockInfo.BlockID, ss, blockInfo.Count,
+                                  blockInfo.Min, blockInfo.Max, hits);
+            }
+        }
+
+        m_VarPtr->m_SelectionType = selectionType;
+        m_VarPtr->m_BlockID = blockID;
+        m_VarPtr->m_Start = start;
+        m_VarPtr->m_Count = count;
+    }
+
     void RunStatMinBlocksInfo(const QueryVar &query, const adios2::MinVarInfo *MinBlocksInfo,
                               std::vector<BlockHit> &hitBlocks)
     {
@@ -70,11 +139,48 @@ public:
                 if (!query.TouchSelection(ss, cc))
                     continue;
 
-                if (isHit)
+                if ((blockInfo.SubBlockCount > 1) && !MinBlocksInfo->IsReverseDims)
                 {
-                    adios2::Box<adios2::Dims> box = {ss, cc};
-                    hitBlocks.push_back(BlockHit(blockInfo.BlockID, box));
+                    // Narrow the hit to the sub-blocks whose min/max match, return the
+                    // whole block if all of them do (like BP4 in RunStatBlocksInfo)
+                    adios2::helper::BlockDivisionInfo subBlockInfo;
+                    subBlockInfo.Div.assign(blockInfo.SubBlockDiv,
+                                            blockInfo.SubBlockDiv + MinBlocksInfo->Dims);
+                    adios2::helper::CalculateSubblockInfo(cc, subBlockInfo);
+                    const T *minMaxs = static_cast<const T *>(blockInfo.SubBlockMinMax);
+
+                    BlockHit tmp(blockInfo.BlockID);
+                    bool allCovered = true;
+                    for (unsigned int i = 0; i < subBlockInfo.NBlocks; i++)
+                    {
+                        T smin = minMaxs[2 * i];
+                        T smax = minMaxs[2 * i + 1];
+                        if (!query.m_RangeTree.CheckInterval(smin, smax))
+                        {
+                            allCovered = false;
+                            continue;
+                        }
+
+                        adios2::Box<adios2::Dims> currSubBlock =
+                            adios2::helper::GetSubBlock(cc, subBlockInfo, i);
+                        for (size_t d = 0; d < cc.size(); ++d)
+                            currSubBlock.first[d] += ss[d];
+
+                        if (!query.TouchSelection(currSubBlock.first, currSubBlock.second))
+                            continue;
+                        tmp.m_Regions.push_back(currSubBlock);
+                    }
+
+                    if (!allCovered)
+                    {
+                        if (!tmp.m_Regions.empty())
+                            hitBlocks.push_back(tmp);
+                        continue;
+                    }
                 }
+
+                adios2::Box<adios2::Dims> box = {ss, cc};
+                hitBlocks.push_back(BlockHit(blockInfo.BlockID, box));
             }
             else
             { // local array
@@ -151,6 +257,148 @@ public:
         }
     }
 
+    // the index is only usable if there is one index block per data block
+    adios2::core::Variable<uint8_t> *InquireIndexVariable(const size_t step, const size_t nBlocks)
+    {
+        auto indexVar = m_IdxIO.InquireVariable<uint8_t>(BitmapIndexName(m_VarPtr->m_Name));
+        if (nullptr == indexVar)
+            return nullptr;
+
+        size_t nIndexBlocks = 0;
+        auto MinBlocksInfo = m_IdxReader.MinBlocksInfo(*indexVar, step);
+        if (MinBlocksInfo != nullptr)
+        {
+            nIndexBlocks = MinBlocksInfo->BlocksInfo.size();
+            delete MinBlocksInfo;
+        }
+        else
+        {
+            nIndexBlocks = m_IdxReader.BlocksInfo(*indexVar, step).size();
+        }
+        return (nIndexBlocks == nBlocks) ? indexVar : nullptr;
+    }
+
+    void EvaluateBlockHits(const QueryVar &query, const TypedRangeTree<T> &ranges,
+                           const size_t blockID, Dims start, Dims count, const T &bmin,
+                           const T &bmax, std::vector<BlockValueHits> &hits)
+    {
+        if (!ranges.CheckInterval(bmin, bmax))
+            return;
+
+        const bool isGlobal = !start.empty();
+        if (isGlobal && !query.TouchSelection(start, count))
+            return;
+
+        BlockValueHits blockHits;
+        blockHits.m_ID = blockID;
+        blockHits.m_Start = start;
+        blockHits.m_Count = count;
+        std::vector<size_t> &offsets = blockHits.m_Offsets;
+
+        const size_t nElems = helper::GetTotalSize(count);
+        std::vector<T> data;
+        if (ranges.CoversInterval(bmin, bmax))
+        {
+            offsets.resize(nElems);
+            for (size_t i = 0; i < nElems; ++i)
+                offsets[i] = i;
+        }
+        else
+        {
+            std::vector<uint8_t> indexBuffer;
+            BitmapIndexBlock<T> index;
+            bool hasIndex = false;
+            if (m_IndexVarPtr != nullptr)
+            {
+                m_IndexVarPtr->SetBlockSelection(blockID);
+                indexBuffer.resize(m_IndexVarPtr->SelectionSize());
+                m_IdxReader.Get(*m_IndexVarPtr, indexBuffer.data(), adios2::Mode::Sync);
+                hasIndex = index.Parse(indexBuffer.data(), indexBuffer.size()) &&
+                           (index.m_NElems == nElems);
+            }
+
+            if (hasIndex)
+            {
+                // bins inside the ranges are hits, bins straddling a bound
+                // are checked against the data
+                std::vector<size_t> edges;
+                for (size_t b = 0; b < index.m_Counts.size(); ++b)
+                {
+                    if ((index.m_Counts[b] == 0) ||
+                        !ranges.CheckInterval(index.m_BinMin[b], index.m_BinMax[b]))
+                        continue;
+                    if (ranges.CoversInterval(index.m_BinMin[b], index.m_BinMax[b]))
+                        index.GetPositions(b, offsets);
+                    else
+                        index.GetPositions(b, edges);
+                }
+
+                if (!edges.empty())
+                {
+                    ReadBlock(blockID, nElems, data);
+                    for (const size_t pos : edges)
+                        if (ranges.Check(data[pos]))
+                            offsets.push_back(pos);
+                }
+                std::sort(offsets.begin(), offsets.end());
+            }
+            else
+            {
+                ReadBlock(blockID, nElems, data);
+                for (size_t i = 0; i < nElems; ++i)
+                    if (ranges.Check(data[i]))
+                        offsets.push_back(i);
+            }
+        }
+
+        if (isGlobal)
+            LimitToSelection(query, blockHits);
+
+        if (!offsets.empty())
+            hits.push_back(std::move(blockHits));
+    }
+
+    void ReadBlock(const size_t blockID, const size_t nElems, std::vector<T> &data)
+    {
+        data.resize(nElems);
+        m_VarPtr->SetBlockSelection(blockID);
+        m_IdxReader.Get(*m_VarPtr, data.data(), adios2::Mode::Sync);
+    }
+
+    // drop the hits of a global array block outside the query selection
+    static void LimitToSelection(const QueryVar &query, BlockValueHits &blockHits)
+    {
+        const Box<Dims> &selection = query.m_Selection;
+        if (selection.first.empty())
+            return;
+
+        const Dims &start = blockHits.m_Start;
+        const Dims &count = blockHits.m_Count;
+        bool inside = true;
+        for (size_t d = 0; d < start.size(); ++d)
+        {
+            if ((start[d] < selection.first[d]) ||
+                (start[d] + count[d] > selection.first[d] + selection.second[d]))
+                inside = false;
+        }
+        if (inside)
+            return;
+
+        auto last = std::remove_if(
+            blockHits.m_Offsets.begin(), blockHits.m_Offsets.end(), [&](size_t offset) -> bool {
+                for (size_t d = start.size(); d-- > 0;)
+                {
+                    const size_t coord = start[d] + offset % count[d];
+                    offset /= count[d];
+                    if ((coord < selection.first[d]) ||
+                        (coord >= selection.first[d] + selection.second[d]))
+                        return true;
+                }
+                return false;
+            });
+        blockHits.m_Offsets.erase(last, blockHits.m_Offsets.end());
+    }
+
     // can not be unique_ptr as it changes with bp5 through steps
     // as BP5Deserializer::SetupForStep calls io.RemoveVariables()
     // must use ptr as bp5 associates ptrs with blockinfo, see MinBlocksInfo() in bp5
@@ -163,6 +411,7 @@ private:
     // std::string& m_DataFileName;
     adios2::core::IO &m_IdxIO;
     adios2::core::Engine &m_IdxReader;
+    adios2::core::Variable<uint8_t> *m_IndexVarPtr = nullptr;
 
 }; // class blockIndex
 
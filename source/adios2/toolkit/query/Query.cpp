@@ -4,6 +4,9 @@
 
 #include "Query.tcc"
 
+#include <algorithm> // std::sort, std::set_intersection, std::set_union
+#include <iterator>  // std::back_inserter
+
 namespace adios2
 {
 namespace query
@@ -249,6 +252,42 @@ void QueryComposite::BlockIndexEvaluate(adios2::core::IO &io, adios2::core::Engi
     }
 }
 
+void QueryComposite::HitEvaluate(adios2::core::IO &io, adios2::core::Engine &reader,
+                                 std::vector<Dims> &hits)
+{
+    hits.clear();
+    bool first = true;
+    for (auto node : m_Nodes)
+    {
+        std::vector<Dims> currHits;
+        node->HitEvaluate(io, reader, currHits);
+        if (first)
+        {
+            hits.swap(currHits);
+            first = false;
+            continue;
+        }
+
+        // both are sorted
+        std::vector<Dims> merged;
+        if (adios2::query::Relation::AND == m_Relation)
+            std::set_intersection(hits.begin(), hits.end(), currHits.begin(), currHits.end(),
+                                  std::back_inserter(merged));
+        else if (adios2::query::Relation::OR == m_Relation)
+            std::set_union(hits.begin(), hits.end(), currHits.begin(), currHits.end(),
+                           std::back_inserter(merged));
+        hits.swap(merged);
+    }
+}
+
+void QueryComposite::HitCountEvaluate(adios2::core::IO &, adios2::core::Engine &,
+                                      std::vector<std::pair<size_t, size_t>> &)
+{
+    helper::Throw<std::invalid_argument>(
+        "Toolkit", "query::QueryComposite", "HitCountEvaluate",
+        "hit counts are per block of one variable, use the hits of a composite query instead");
+}
+
 bool QueryVar::IsSelectionValid(adios2::Dims &shape) const
 {
     if (0 == m_Selection.first.size())
@@ -336,5 +375,67 @@ void QueryVar::BlockIndexEvaluate(adios2::core::IO &io, adios2::core::Engine &re
         }
     }
 }
+
+namespace
+{
+void EvaluateBlockValueHits(QueryVar &query, adios2::core::IO &io, adios2::core::Engine &reader,
+                            std::vector<BlockValueHits> &blockHits)
+{
+    const std::string &varName = query.GetVarName();
+    const DataType varType = io.InquireVariableType(varName);
+#define declare_type(T)                                                                            \
+    if (varType == adios2::helper::GetDataType<T>())                                               \
+    {                                                                                              \
+        core::Variable<T> *var = io.InquireVariable<T>(varName);                                   \
+        BlockIndex<T> idx(var, io, reader);                                                        \
+        idx.EvaluateHits(query, blockHits);                                                        \
+    }
+    ADIOS2_FOREACH_ATTRIBUTE_PRIMITIVE_STDTYPE_1ARG(declare_type)
+#undef declare_type
+}
+} // end anonymous namespace
+
+void QueryVar::HitEvaluate(adios2::core::IO &io, adios2::core::Engine &reader,
+                           std::vector<Dims> &hits)
+{
+    hits.clear();
+    std::vector<BlockValueHits> blockHits;
+    EvaluateBlockValueHits(*this, io, reader, blockHits);
+
+    for (const auto &blk : blockHits)
+    {
+        if (blk.m_Start.empty())
+        {
+            helper::Throw<std::invalid_argument>(
+                "Toolkit", "query::QueryVar", "HitEvaluate",
+                "hit coordinates need a global array, use hit counts for local array " +
+                    m_VarName);
+        }
+
+        const size_t ndims = blk.m_Count.size();
+        for (size_t offset : blk.m_Offsets)
+        {
+            Dims coords(ndims);
+            for (size_t d = ndims; d-- > 0;)
+            {
+                coords[d] = blk.m_Start[d] + offset % blk.m_Count[d];
+                offset /= blk.m_Count[d];
+            }
+            hits.push_back(coords);
+        }
+    }
+    std::sort(hits.begin(), hits.end());
+}
+
+void QueryVar::HitCountEvaluate(adios2::core::IO &io, adios2::core::Engine &reader,
+                                std::vector<std::pair<size_t, size_t>> &blockHitCounts)
+{
+    blockHitCounts.clear();
+    std::vector<BlockValueHits> blockHits;
+    EvaluateBlockValueHits(*this, io, reader, blockHits);
+
+    for (const auto &blk : blockHits)
+        blockHitCounts.push_back(std::make_pair(blk.m_ID, blk.m_Offsets.size()));
+}
 } // namespace query
 } // namespace adios2
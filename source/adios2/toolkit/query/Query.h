@@ -93,6 +93,37 @@ public:
     std::vector<RangeTree> m_SubNodes;
 }; // class RangeTree
 
+// RangeTree with its values converted to T once, for checking many values
+template <class T>
+class TypedRangeTree
+{
+public:
+    TypedRangeTree(const RangeTree &tree);
+
+    bool Check(const T &value) const { return CheckInterval(value, value); }
+
+    // true if some value in [min, max] may satisfy the ranges
+    bool CheckInterval(const T &min, const T &max) const;
+
+    // true if every value in [min, max] satisfies the ranges
+    bool CoversInterval(const T &min, const T &max) const;
+
+private:
+    adios2::query::Relation m_Relation;
+    std::vector<std::pair<adios2::query::Op, T>> m_Leaves;
+    std::vector<TypedRangeTree<T>> m_SubNodes;
+}; // class TypedRangeTree
+
+// elements of one block that satisfy a query
+struct BlockValueHits
+{
+    size_t m_ID;
+    Dims m_Start; // empty for local arrays
+    Dims m_Count;
+    // positions of the hits in the block (row major), sorted
+    std::vector<size_t> m_Offsets;
+};
+
 struct BlockHit
 {
     BlockHit(size_t id);
@@ -122,6 +153,12 @@ public:
     virtual void Print() = 0;
     virtual void BlockIndexEvaluate(adios2::core::IO &, adios2::core::Engine &,
                                     std::vector<BlockHit> &touchedBlocks) = 0;
+    // exact hits as sorted global coordinates
+    virtual void HitEvaluate(adios2::core::IO &, adios2::core::Engine &,
+                             std::vector<Dims> &hits) = 0;
+    // number of hits in each block that has hits, as (blockID, count)
+    virtual void HitCountEvaluate(adios2::core::IO &, adios2::core::Engine &,
+                                  std::vector<std::pair<size_t, size_t>> &blockHitCounts) = 0;
 
     static Box<Dims> GetIntersection(const Box<Dims> &box1, const Box<Dims> &box2) noexcept
     {
@@ -162,6 +199,9 @@ public:
     std::string &GetVarName() { return m_VarName; }
     void BlockIndexEvaluate(adios2::core::IO &, adios2::core::Engine &,
                             std::vector<BlockHit> &touchedBlocks);
+    void HitEvaluate(adios2::core::IO &, adios2::core::Engine &, std::vector<Dims> &hits);
+    void HitCountEvaluate(adios2::core::IO &, adios2::core::Engine &,
+                          std::vector<std::pair<size_t, size_t>> &blockHitCounts);
 
     void BroadcastOutputRegion(const adios2::Box<adios2::Dims> &region) { m_OutputRegion = region; }
 
@@ -262,6 +302,9 @@ public:
     void BlockIndexEvaluate(adios2::core::IO &, adios2::core::Engine &,
                             std::vector<BlockHit> &touchedBlocks);
     // std::vector<Box<Dims>> &touchedBlocks);
+    void HitEvaluate(adios2::core::IO &, adios2::core::Engine &, std::vector<Dims> &hits);
+    void HitCountEvaluate(adios2::core::IO &, adios2::core::Engine &,
+                          std::vector<std::pair<size_t, size_t>> &blockHitCounts);
 
     bool AddNode(QueryBase *v);
 
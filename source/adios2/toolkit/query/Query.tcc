@@ -69,5 +69,129 @@ bool RangeTree::CheckInterval(T &min, T &max) const
     // anything else are false
     return false;
 }
+
+template <class T>
+TypedRangeTree<T>::TypedRangeTree(const RangeTree &tree) : m_Relation(tree.m_Relation)
+{
+    for (auto &range : tree.m_Leaves)
+    {
+        std::stringstream convert(range.m_StrValue);
+        T value;
+        convert >> value;
+        m_Leaves.push_back(std::make_pair(range.m_Op, value));
+    }
+
+    for (auto &node : tree.m_SubNodes)
+        m_SubNodes.push_back(TypedRangeTree<T>(node));
+}
+
+template <class T>
+bool TypedRangeTree<T>::CheckInterval(const T &min, const T &max) const
+{
+    // same as RangeTree::CheckInterval()
+    auto lf_CheckLeaf = [&](const std::pair<adios2::query::Op, T> &leaf) -> bool {
+        const T &value = leaf.second;
+        switch (leaf.first)
+        {
+        case adios2::query::Op::GT:
+            return (max > value);
+        case adios2::query::Op::LT:
+            return (min < value);
+        case adios2::query::Op::GE:
+            return (max >= value);
+        case adios2::query::Op::LE:
+            return (min <= value);
+        case adios2::query::Op::EQ:
+            return (max >= value) && (min <= value);
+        case adios2::query::Op::NE:
+            return !((max == value) && (min == value));
+        default:
+            return false;
+        }
+    };
+
+    if (adios2::query::Relation::AND == m_Relation)
+    {
+        for (auto &leaf : m_Leaves)
+            if (!lf_CheckLeaf(leaf))
+                return false;
+
+        for (auto &node : m_SubNodes)
+            if (!node.CheckInterval(min, max))
+                return false;
+
+        return true;
+    }
+
+    if (adios2::query::Relation::OR == m_Relation)
+    {
+        for (auto &leaf : m_Leaves)
+            if (lf_CheckLeaf(leaf))
+                return true;
+
+        for (auto &node : m_SubNodes)
+            if (node.CheckInterval(min, max))
+                return true;
+
+        return false;
+    }
+
+    return false;
+}
+
+template <class T>
+bool TypedRangeTree<T>::CoversInterval(const T &min, const T &max) const
+{
+    auto lf_CoversLeaf = [&](const std::pair<adios2::query::Op, T> &leaf) -> bool {
+        const T &value = leaf.second;
+        switch (leaf.first)
+        {
+        case adios2::query::Op::GT:
+            return (min > value);
+        case adios2::query::Op::LT:
+            return (max < value);
+        case adios2::query::Op::GE:
+            return (min >= value);
+        case adios2::query::Op::LE:
+            return (max <= value);
+        case adios2::query::Op::EQ:
+            return (min == value) && (max == value);
+        case adios2::query::Op::NE:
+            return (max < value) || (min > value);
+        default:
+            return false;
+        }
+    };
+
+    if (adios2::query::Relation::AND == m_Relation)
+    {
+        for (auto &leaf : m_Leaves)
+            if (!lf_CoversLeaf(leaf))
+                return false;
+
+        for (auto &node : m_SubNodes)
+            if (!node.CoversInterval(min, max))
+                return false;
+
+        return true;
+    }
+
+    // for OR this may miss intervals covered only by the union of the ranges,
+    // those are then checked value by value
+    if (adios2::query::Relation::OR == m_Relation)
+    {
+        for (auto &leaf : m_Leaves)
+            if (lf_CoversLeaf(leaf))
+                return true;
+
+        for (auto &node : m_SubNodes)
+            if (node.CoversInterval(min, max))
+                return true;
+
+        return false;
+    }
+
+    return false;
+}
 }
 }
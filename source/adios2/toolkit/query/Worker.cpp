@@ -116,5 +116,25 @@ void Worker::GetResultCoverage(const adios2::Box<adios2::Dims> &outputRegion,
             touchedBlocks.insert(touchedBlocks.end(), blk.m_Regions.begin(), blk.m_Regions.end());
     }
 }
+
+void Worker::GetResultHits(std::vector<Dims> &hits)
+{
+    hits.clear();
+
+    if (m_Query && m_SourceReader)
+    {
+        m_Query->HitEvaluate(m_SourceReader->m_IO, *m_SourceReader, hits);
+    }
+}
+
+void Worker::GetResultHitCounts(std::vector<std::pair<size_t, size_t>> &blockHitCounts)
+{
+    blockHitCounts.clear();
+
+    if (m_Query && m_SourceReader)
+    {
+        m_Query->HitCountEvaluate(m_SourceReader->m_IO, *m_SourceReader, blockHitCounts);
+    }
+}
 } // namespace query
 } // namespace adios2
@@ -44,6 +44,8 @@ public:
 
     void GetResultCoverage(std::vector<size_t> &);
     void GetResultCoverage(const adios2::Box<adios2::Dims> &, std::vector<Box<adios2::Dims>> &);
+    void GetResultHits(std::vector<adios2::Dims> &);
+    void GetResultHitCounts(std::vector<std::pair<size_t, size_t>> &);
 
 protected:
     Worker(const std::string &configFile, adios2::core::Engine *adiosEngine);
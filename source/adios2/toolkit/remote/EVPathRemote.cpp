@@ -9,6 +9,8 @@
 #include "adios2/helper/adiosLog.h"
 #include "adios2/helper/adiosString.h"
 #include "adios2/helper/adiosSystem.h"
+#include "adios2/operator/OperatorFactory.h"
+#include <vector>
 #ifdef _MSC_VER
 #define strdup(x) _strdup(x)
 #endif
@@ -60,7 +62,56 @@ void ReadResponseHandler(CManager cm, CMConnection conn, void *vevent, void *cli
 {
     EVPathRemoteCommon::ReadResponseMsg read_response_msg =
         static_cast<EVPathRemoteCommon::ReadResponseMsg>(vevent);
-    memcpy(read_response_msg->Dest, read_response_msg->ReadData, read_response_msg->Size);
+    // this runs on the network thread, the errors are thrown by the wait
+    const int condition = read_response_msg->ReadResponseCondition;
+    EVPathRemote *remote =
+        static_cast<EVPathRemote *>(CMCondition_get_client_data(cm, condition));
+    const size_t destSize = remote->TakeGetSize(condition);
+    const size_t size =
+        read_response_msg->RawSize ? read_response_msg->RawSize : read_response_msg->Size;
+    if (read_response_msg->Error)
+    {
+        remote->SetGetError(condition, "Get() failed on the remote server: " +
+                                           std::string(read_response_msg->Error));
+    }
+    else if (size != destSize)
+    {
+        // check before writing anything to the destination
+        remote->SetGetError(condition, "Get() response has " + std::to_string(size) +
+                                           " bytes instead of " + std::to_string(destSize));
+    }
+    else if (read_response_msg->RawSize)
+    {
+        // the operator header decides how much is written, so decompress into
+        // scratch memory and copy to the destination only what was asked for
+        try
+        {
+            std::vector<char> raw(size);
+            const size_t rawSize = core::Decompress(read_response_msg->ReadData,
+                                                    read_response_msg->Size, raw.data(),
+                                                    MemorySpace::Host);
+            if (rawSize != size)
+            {
+                remote->SetGetError(condition, "Get() response decompressed to " +
+                                                   std::to_string(rawSize) + " bytes instead of " +
+                                                   std::to_string(size));
+            }
+            else
+            {
+                memcpy(read_response_msg->Dest, raw.data(), size);
+                remote->m_CompressedGets++;
+            }
+        }
+        catch (const std::exception &exc)
+        {
+            remote->SetGetError(condition,
+                                "Cannot decompress Get() response: " + std::string(exc.what()));
+        }
+    }
+    else
+    {
+        memcpy(read_response_msg->Dest, read_response_msg->ReadData, size);
+    }
     CMCondition_signal(cm, read_response_msg->ReadResponseCondition);
     return;
 };
@@ -90,6 +141,13 @@ void EVPathRemote::InitCMData()
     });
 }
 
+void EVPathRemote::SetResponseCompression(const std::string &Operator,
+                                          const std::string &Accuracy)
+{
+    m_ResponseOperator = Operator;
+    m_ResponseAccuracy = Accuracy;
+}
+
 void EVPathRemote::Open(const std::string hostname, const int32_t port, const std::string filename,
                         const Mode mode, bool RowMajorOrdering)
 {
@@ -123,6 +181,14 @@ void EVPathRemote::Open(const std::string hostname, const int32_t port, const st
     }
     open_msg.OpenResponseCondition = CMCondition_get(ev_state.cm, m_conn);
     open_msg.RowMajorOrder = RowMajorOrdering;
+    if (!m_ResponseOperator.empty())
+    {
+        open_msg.ResponseOperator = (char *)m_ResponseOperator.c_str();
+    }
+    if (!m_ResponseAccuracy.empty())
+    {
+        open_msg.ResponseAccuracy = (char *)m_ResponseAccuracy.c_str();
+    }
     CMCondition_set_client_data(ev_state.cm, open_msg.OpenResponseCondition, (void *)this);
     CMwrite(m_conn, ev_state.OpenFileFormat, &open_msg);
     CMCondition_wait(ev_state.cm, open_msg.OpenResponseCondition);
@@ -157,7 +223,7 @@ void EVPathRemote::OpenSimpleFile(const std::string hostname, const int32_t port
 }
 
 EVPathRemote::GetHandle EVPathRemote::Get(char *VarName, size_t Step, size_t BlockID, Dims &Count,
-                                          Dims &Start, void *dest)
+                                          Dims &Start, void *dest, const size_t destSize)
 {
     EVPathRemoteCommon::_GetRequestMsg GetMsg;
     memset(&GetMsg, 0, sizeof(GetMsg));
@@ -170,6 +236,12 @@ EVPathRemote::GetHandle EVPathRemote::Get(char *VarName, size_t Step, size_t Blo
     GetMsg.Count = Count.data();
     GetMsg.Start = Start.data();
     GetMsg.Dest = dest;
+    {
+        // the response may arrive as soon as the request is written
+        std::lock_guard<std::mutex> lock(m_GetErrorsMutex);
+        m_GetSizes[GetMsg.GetResponseCondition] = destSize;
+    }
+    CMCondition_set_client_data(ev_state.cm, GetMsg.GetResponseCondition, (void *)this);
     CMwrite(m_conn, ev_state.GetRequestFormat, &GetMsg);
     return (Remote::GetHandle)(intptr_t)GetMsg.GetResponseCondition;
 }
@@ -183,17 +255,64 @@ EVPathRemote::GetHandle EVPathRemote::Read(size_t Start, size_t Size, void *Dest
     ReadMsg.Offset = Start;
     ReadMsg.Size = Size;
     ReadMsg.Dest = Dest;
+    {
+        std::lock_guard<std::mutex> lock(m_GetErrorsMutex);
+        m_GetSizes[ReadMsg.ReadResponseCondition] = Size;
+    }
+    CMCondition_set_client_data(ev_state.cm, ReadMsg.ReadResponseCondition, (void *)this);
     CMwrite(m_conn, ev_state.ReadRequestFormat, &ReadMsg);
     CMCondition_wait(ev_state.cm, ReadMsg.ReadResponseCondition);
+    ThrowGetError(ReadMsg.ReadResponseCondition);
     return (Remote::GetHandle)(intptr_t)ReadMsg.ReadResponseCondition;
 }
 
 bool EVPathRemote::WaitForGet(GetHandle handle)
 {
-    return CMCondition_wait(ev_state.cm, (int)(intptr_t)handle);
+    const int condition = (int)(intptr_t)handle;
+    const bool ret = CMCondition_wait(ev_state.cm, condition);
+    ThrowGetError(condition);
+    return ret;
+}
+
+void EVPathRemote::SetGetError(int condition, const std::string &message)
+{
+    std::lock_guard<std::mutex> lock(m_GetErrorsMutex);
+    m_GetErrors[condition] = message;
+}
+
+size_t EVPathRemote::TakeGetSize(int condition)
+{
+    std::lock_guard<std::mutex> lock(m_GetErrorsMutex);
+    auto it = m_GetSizes.find(condition);
+    if (it == m_GetSizes.end())
+    {
+        return 0;
+    }
+    const size_t size = it->second;
+    m_GetSizes.erase(it);
+    return size;
+}
+
+void EVPathRemote::ThrowGetError(int condition)
+{
+    std::string message;
+    {
+        std::lock_guard<std::mutex> lock(m_GetErrorsMutex);
+        auto it = m_GetErrors.find(condition);
+        if (it == m_GetErrors.end())
+        {
+            return;
+        }
+        message = it->second;
+        m_GetErrors.erase(it);
+    }
+    helper::Throw<std::runtime_error>("Remote", "EVPathRemote", "WaitForGet", message);
 }
 #else
 
+void EVPathRemote::SetResponseCompression(const std::string &Operator,
+                                          const std::string &Accuracy){};
+
 void EVPathRemote::Open(const std::string hostname, const int32_t port, const std::string filename,
                         const Mode mode, bool RowMajorOrdering){};
 
@@ -201,7 +320,7 @@ void EVPathRemote::OpenSimpleFile(const std::string hostname, const int32_t port
                                   const std::string filename){};
 
 EVPathRemote::GetHandle EVPathRemote::Get(char *VarName, size_t Step, size_t BlockID, Dims &Count,
-                                          Dims &Start, void *dest)
+                                          Dims &Start, void *dest, const size_t destSize)
 {
     return static_cast<GetHandle>(0);
 };
@@ -7,6 +7,7 @@
 #define ADIOS2_TOOLKIT_REMOTE_EVPATHREMOTE_H_
 
 /// \cond EXCLUDE_FROM_DOXYGEN
+#include <map>
 #include <mutex>
 #include <string>
 #include <vector>
@@ -38,12 +39,15 @@ public:
 
     explicit operator bool() const { return m_Active; }
 
+    void SetResponseCompression(const std::string &Operator, const std::string &Accuracy);
+
     void Open(const std::string hostname, const int32_t port, const std::string filename,
               const Mode mode, bool RowMajorOrdering);
 
     void OpenSimpleFile(const std::string hostname, const int32_t port, const std::string filename);
 
-    GetHandle Get(char *VarName, size_t Step, size_t BlockID, Dims &Count, Dims &Start, void *dest);
+    GetHandle Get(char *VarName, size_t Step, size_t BlockID, Dims &Count, Dims &Start, void *dest,
+                  const size_t destSize);
 
     bool WaitForGet(GetHandle handle);
 
@@ -51,14 +55,27 @@ public:
 
     int64_t m_ID;
 
+#ifdef ADIOS2_HAVE_SST
+    /** called by the response handler, the wait for the response throws */
+    void SetGetError(int condition, const std::string &message);
+    /** the size of the destination of a Get() or Read(), forgotten once taken */
+    size_t TakeGetSize(int condition);
+#endif
+
 private:
 #ifdef ADIOS2_HAVE_SST
     void InitCMData();
+    void ThrowGetError(int condition);
     EVPathRemoteCommon::Remote_evpath_state ev_state;
     CMConnection m_conn = NULL;
     std::mutex m_CMInitMutex;
+    std::mutex m_GetErrorsMutex;
+    std::map<int, std::string> m_GetErrors;
+    std::map<int, size_t> m_GetSizes; // also under m_GetErrorsMutex
 #endif
     bool m_Active = false;
+    std::string m_ResponseOperator;
+    std::string m_ResponseAccuracy;
 };
 
 #ifdef ADIOS2_HAVE_SST
@@ -23,6 +23,9 @@
 namespace adios2
 {
 
+// remotes that can't compress responses just send raw data
+void Remote::SetResponseCompression(const std::string &Operator, const std::string &Accuracy) {}
+
 void Remote::Open(const std::string hostname, const int32_t port, const std::string filename,
                   const Mode mode, bool RowMajorOrdering)
 {
@@ -36,7 +39,7 @@ void Remote::OpenSimpleFile(const std::string hostname, const int32_t port,
 };
 
 Remote::GetHandle Remote::Get(char *VarName, size_t Step, size_t BlockID, Dims &Count, Dims &Start,
-                              void *dest)
+                              void *dest, const size_t destSize)
 {
     ThrowUp("RemoteGet");
     return (Remote::GetHandle)(intptr_t)0;
@@ -7,6 +7,7 @@
 #define ADIOS2_TOOLKIT_REMOTE_REMOTE_H_
 
 /// \cond EXCLUDE_FROM_DOXYGEN
+#include <atomic>
 #include <mutex>
 #include <string>
 #include <vector>
@@ -31,6 +32,13 @@ public:
 
     virtual explicit operator bool() const { return false; }
 
+    /**
+     * Ask the server to compress Get() responses of files opened afterwards
+     * @param Operator ADIOS2 operator type (e.g. "blosc", "zfp"), empty for none
+     * @param Accuracy error bound for lossy operators, empty for their default
+     */
+    virtual void SetResponseCompression(const std::string &Operator, const std::string &Accuracy);
+
     virtual void Open(const std::string hostname, const int32_t port, const std::string filename,
                       const Mode mode, bool RowMajorOrdering);
 
@@ -39,14 +47,17 @@ public:
 
     typedef void *GetHandle;
 
+    /** destSize is the size of dest in bytes, a larger response is an error */
     virtual GetHandle Get(char *VarName, size_t Step, size_t BlockID, Dims &Count, Dims &Start,
-                          void *dest);
+                          void *dest, const size_t destSize);
 
     virtual bool WaitForGet(GetHandle handle);
 
     virtual GetHandle Read(size_t Start, size_t Size, void *Dest);
 
     size_t m_Size;
+    // number of Get() responses that arrived compressed
+    std::atomic<size_t> m_CompressedGets{0};
 
 private:
     const std::shared_ptr<adios2::HostOptions> m_HostOptions;
@@ -100,7 +100,8 @@ public:
     void Open(const std::string hostname, const int32_t port, const std::string filename,
               const Mode mode, bool RowMajorOrdering);
 
-    GetHandle Get(char *VarName, size_t Step, size_t BlockID, Dims &Count, Dims &Start, void *dest);
+    GetHandle Get(char *VarName, size_t Step, size_t BlockID, Dims &Count, Dims &Start, void *dest,
+                  const size_t destSize);
 
     GetHandle Read(size_t Start, size_t Size, void *Dest);
     bool WaitForGet(GetHandle handle);
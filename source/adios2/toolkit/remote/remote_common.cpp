@@ -14,6 +14,8 @@ FMField OpenFileList[] = {
     {"FileName", "string", sizeof(char *), FMOffset(OpenFileMsg, FileName)},
     {"Mode", "integer", sizeof(RemoteFileMode), FMOffset(OpenFileMsg, Mode)},
     {"RowMajorOrder", "integer", sizeof(int), FMOffset(OpenFileMsg, RowMajorOrder)},
+    {"ResponseOperator", "string", sizeof(char *), FMOffset(OpenFileMsg, ResponseOperator)},
+    {"ResponseAccuracy", "string", sizeof(char *), FMOffset(OpenFileMsg, ResponseAccuracy)},
     {NULL, NULL, 0, 0}};
 
 FMStructDescRec OpenFileStructs[] = {{"OpenFile", OpenFileList, sizeof(struct _OpenFileMsg), NULL},
@@ -85,6 +87,8 @@ FMField ReadResponseList[] = {
     {"Dest", "integer", sizeof(void *), FMOffset(ReadResponseMsg, Dest)},
     {"Size", "integer", sizeof(size_t), FMOffset(ReadResponseMsg, Size)},
     {"ReadData", "char[Size]", sizeof(char), FMOffset(ReadResponseMsg, ReadData)},
+    {"RawSize", "integer", sizeof(size_t), FMOffset(ReadResponseMsg, RawSize)},
+    {"Error", "string", sizeof(char *), FMOffset(ReadResponseMsg, Error)},
     {NULL, NULL, 0, 0}};
 
 FMStructDescRec ReadResponseStructs[] = {
@@ -24,6 +24,8 @@ typedef struct _OpenFileMsg
     char *FileName;
     RemoteFileMode Mode;
     int RowMajorOrder;
+    char *ResponseOperator; // compress Get responses with this operator, NULL for none
+    char *ResponseAccuracy; // error bound for lossy operators, NULL for the default
 } *OpenFileMsg;
 
 typedef struct _OpenResponseMsg
@@ -83,6 +85,8 @@ typedef struct _ReadResponseMsg
     void *Dest;
     size_t Size;
     char *ReadData;
+    size_t RawSize; // if not 0, ReadData is compressed and decompresses to RawSize bytes
+    char *Error;    // if not NULL, the Get failed on the server and there is no data
 } *ReadResponseMsg;
 
 /*
@@ -9,14 +9,23 @@
 #include "adios2/core/IO.h"
 #include "adios2/core/Variable.h"
 #include "adios2/helper/adiosFunctions.h"
+#include "adios2/helper/adiosThreadPool.h"
+#include "adios2/operator/OperatorFactory.h"
+#include "adios2/toolkit/format/bp5/BP5ReadBufferPool.h"
 #include <evpath.h>
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <cstdio>  // remove
 #include <cstring> // strerror
+#include <deque>
 #include <errno.h> // errno
 #include <fcntl.h> // open
 #include <fstream>
 #include <inttypes.h>
+#include <memory>
+#include <mutex>
 #include <regex>
 #include <sys/stat.h>  // open, fstat
 #include <sys/types.h> // open
@@ -48,13 +57,45 @@ using namespace adios2;
 
 int verbose = 1;
 ADIOS adios("C++");
+// declaring and removing IOs may happen on the network and worker threads
+std::mutex adios_mutex;
 
 size_t TotalSimpleBytesSent = 0;
-size_t TotalGetBytesSent = 0;
+std::atomic<size_t> TotalGetBytesSent(0);
 size_t TotalSimpleReads = 0;
-size_t TotalGets = 0;
+std::atomic<size_t> TotalGets(0);
 size_t SimpleFilesOpened = 0;
 size_t ADIOSFilesOpened = 0;
+
+// Get()s are served by a pool of workers, queued per file and batched into
+// one PerformGets() per step
+size_t GetThreads = 4;
+std::unique_ptr<helper::ThreadPool> GetWorkers;
+// response buffers are reused instead of allocated for every response
+format::BP5ReadBufferPool ResponseBuffers(256 * 1024 * 1024);
+
+std::atomic<size_t> GetQueueDepth(0);
+std::atomic<size_t> MaxGetQueueDepth(0);
+std::atomic<size_t> GetBatches(0);
+std::atomic<uint64_t> TotalGetLatencyUs(0);
+std::atomic<uint64_t> MaxGetLatencyUs(0);
+std::atomic<uint64_t> GetServiceUs(0);
+
+// compressed Get responses, bytes before and after compression
+std::atomic<size_t> CompressedGets(0);
+std::atomic<size_t> CompressedBytesIn(0);
+std::atomic<size_t> CompressedBytesOut(0);
+// operators not known to be safe to run concurrently on several workers
+std::mutex operator_mutex;
+
+template <class T>
+static void lf_AtomicMax(std::atomic<T> &Max, const T Value)
+{
+    T Prev = Max.load();
+    while ((Prev < Value) && !Max.compare_exchange_weak(Prev, Value))
+    {
+    }
+}
 static int report_port_selection = 0;
 int parent_pid;
 uint64_t random_cookie = 0;
@@ -91,6 +132,20 @@ std::string lf_random_string()
     return str.substr(0, 8);
 }
 
+struct PendingGet
+{
+    CMConnection m_Conn;
+    struct Remote_evpath_state *m_EvState;
+    std::string m_VarName;
+    size_t m_Step;
+    int64_t m_BlockID;
+    bool m_HasStart;
+    Box<Dims> m_Box;
+    int m_GetResponseCondition;
+    void *m_Dest;
+    std::chrono::steady_clock::time_point m_Arrival;
+};
+
 class AnonADIOSFile
 {
 public:
@@ -100,9 +155,20 @@ public:
     int64_t currentStep = -1;
     std::string m_IOname;
     std::string m_FileName;
-    size_t m_BytesSent = 0;
-    size_t m_OperationCount = 0;
+    // updated by the Get workers, read by ConnCloseHandler
+    std::atomic<size_t> m_BytesSent{0};
+    std::atomic<size_t> m_OperationCount{0};
     RemoteFileMode m_mode = EVPathRemoteCommon::RemoteFileMode::RemoteOpen;
+    // compresses Get() responses if the client asked for it
+    std::shared_ptr<Operator> m_ResponseOperator;
+    std::string m_ResponseOperatorType;
+
+    // Get()s waiting for a worker, only one worker serves a file at a time
+    std::mutex m_QueueMutex;
+    std::deque<PendingGet> m_Queue;
+    bool m_Busy = false;
+    bool m_CloseWhenIdle = false; // connection closed while a worker was busy
+
     AnonADIOSFile(std::string FileName, EVPathRemoteCommon::RemoteFileMode mode,
                   bool RowMajorArrays)
     {
@@ -111,6 +177,7 @@ public:
         m_IOname = lf_random_string();
         ArrayOrdering ArrayOrder =
             RowMajorArrays ? ArrayOrdering::RowMajor : ArrayOrdering::ColumnMajor;
+        std::lock_guard<std::mutex> lockGuard(adios_mutex);
         m_io = &adios.DeclareIO(m_IOname, ArrayOrder);
         m_mode = mode;
         if (m_mode == RemoteOpenRandomAccess)
@@ -118,8 +185,28 @@ public:
         m_engine = &m_io->Open(FileName, adios_read_mode);
         memcpy(&m_ID, m_IOname.c_str(), sizeof(m_ID));
     }
+    void SetResponseCompression(const std::string &OperatorType, const std::string &Accuracy)
+    {
+        Params OperatorParams;
+        if (!Accuracy.empty())
+        {
+            OperatorParams["accuracy"] = Accuracy;
+        }
+        try
+        {
+            m_ResponseOperator = MakeOperator(OperatorType, OperatorParams);
+            m_ResponseOperatorType = OperatorType;
+        }
+        catch (const std::exception &exc)
+        {
+            if (verbose)
+                std::cout << "Cannot compress responses with " << OperatorType
+                          << ", sending raw data: " << exc.what() << std::endl;
+        }
+    }
     ~AnonADIOSFile()
     {
+        std::lock_guard<std::mutex> lockGuard(adios_mutex);
         m_engine->Close();
         adios.RemoveIO(m_IOname);
     }
@@ -134,8 +221,8 @@ public:
     size_t m_Size = (size_t)-1;
     size_t m_CurrentOffset = 0;
     std::string m_FileName;
-    size_t m_BytesSent = 0;
-    size_t m_OperationCount = 0;
+    std::atomic<size_t> m_BytesSent{0};
+    std::atomic<size_t> m_OperationCount{0};
     AnonSimpleFile(std::string FileName)
     {
         m_FileName = FileName;
@@ -173,7 +260,23 @@ static void ConnCloseHandler(CManager cm, CMConnection conn, void *client_data)
                           << readable_size(file->m_BytesSent) << " in " << file->m_OperationCount
                           << " Get()s" << std::endl;
             ADIOSFileMap.erase(it1->second);
-            delete file;
+            bool busy;
+            {
+                std::lock_guard<std::mutex> lockGuard(file->m_QueueMutex);
+                // nobody is waiting for the queued responses anymore
+                GetQueueDepth -= file->m_Queue.size();
+                for (auto &req : file->m_Queue)
+                {
+                    CMConnection_dereference(req.m_Conn);
+                }
+                file->m_Queue.clear();
+                busy = file->m_Busy;
+                file->m_CloseWhenIdle = busy;
+            }
+            if (!busy)
+            {
+                delete file;
+            }
         }
         AnonSimpleFile *sfile = SimpleFileMap[it1->second];
         if (sfile)
@@ -202,6 +305,11 @@ static void OpenHandler(CManager cm, CMConnection conn, void *vevent, void *clie
               << std::endl;
     AnonADIOSFile *f =
         new AnonADIOSFile(open_msg->FileName, open_msg->Mode, open_msg->RowMajorOrder);
+    if (open_msg->ResponseOperator && *open_msg->ResponseOperator)
+    {
+        f->SetResponseCompression(open_msg->ResponseOperator,
+                                  open_msg->ResponseAccuracy ? open_msg->ResponseAccuracy : "");
+    }
     memset(&open_response_msg, 0, sizeof(open_response_msg));
     open_response_msg.FileHandle = f->m_ID;
     open_response_msg.OpenResponseCondition = open_msg->OpenResponseCondition;
@@ -235,83 +343,308 @@ static void OpenSimpleHandler(CManager cm, CMConnection conn, void *vevent, void
     last_service_time = std::chrono::steady_clock::now();
 }
 
-static void GetRequestHandler(CManager cm, CMConnection conn, void *vevent, void *client_data,
-                              attr_list attrs)
+/* replaces the response data by its compressed form, if that is smaller */
+static void CompressResponse(AnonADIOSFile *f, const PendingGet &Req, const DataType Type,
+                             _ReadResponseMsg &Response)
 {
-    GetRequestMsg GetMsg = static_cast<GetRequestMsg>(vevent);
-    AnonADIOSFile *f = ADIOSFileMap[GetMsg->FileHandle];
-    struct Remote_evpath_state *ev_state = static_cast<struct Remote_evpath_state *>(client_data);
-    last_service_time = std::chrono::steady_clock::now();
-    if (f->m_mode == RemoteOpen)
+    Operator &Op = *f->m_ResponseOperator;
+    if (!Response.Size || !Op.IsDataTypeValid(Type))
+    {
+        return;
+    }
+    const size_t ElemSize = helper::GetDataTypeSize(Type);
+    const size_t ElemCount = Response.Size / ElemSize;
+    // keep the shape of box selections for operators that use it
+    Dims Count = {ElemCount};
+    if (Req.m_HasStart && (helper::GetTotalSize(Req.m_Box.second) == ElemCount))
     {
-        if (f->currentStep == -1)
+        Count = Req.m_Box.second;
+    }
+    const Dims Start(Count.size(), 0);
+    const size_t AllocSize = Op.GetEstimatedSize(ElemCount, ElemSize, Count.size(), Count.data());
+    char *Compressed = ResponseBuffers.Get(AllocSize);
+    size_t CompressedSize = 0;
+    try
+    {
+        const bool Concurrent = (f->m_ResponseOperatorType == "zfp") ||
+                                (f->m_ResponseOperatorType == "bzip2") ||
+                                (f->m_ResponseOperatorType == "png");
+        std::unique_lock<std::mutex> lock(operator_mutex, std::defer_lock);
+        if (!Concurrent)
         {
-            f->m_engine->BeginStep();
-            f->currentStep++;
+            lock.lock();
         }
-        while (f->m_engine->CurrentStep() < GetMsg->Step)
+        CompressedSize = Op.Operate(Response.ReadData, Start, Count, Type, Compressed);
+    }
+    catch (const std::exception &exc)
+    {
+        if (verbose)
+            std::cout << "Cannot compress " << Req.m_VarName << ", sending raw data: " << exc.what()
+                      << std::endl;
+    }
+    if (!CompressedSize || (CompressedSize >= Response.Size))
+    {
+        ResponseBuffers.Release(Compressed);
+        return;
+    }
+    CompressedGets++;
+    CompressedBytesIn += Response.Size;
+    CompressedBytesOut += CompressedSize;
+    ResponseBuffers.Release(Response.ReadData);
+    Response.RawSize = Response.Size;
+    Response.Size = CompressedSize;
+    Response.ReadData = Compressed;
+}
+
+/* sets up the Get of one request into a response buffer, throws on error */
+static DataType QueueGet(AnonADIOSFile *f, const PendingGet &Req, _ReadResponseMsg &Response,
+                         const Mode GetMode)
+{
+    adios2::DataType TypeOfVar = f->m_io->InquireVariableType(Req.m_VarName);
+    if (TypeOfVar == adios2::DataType::None)
+    {
+        throw std::invalid_argument("variable " + Req.m_VarName + " not found");
+    }
+#define GET(T)                                                                                     \
+    else if (TypeOfVar == helper::GetDataType<T>())                                                \
+    {                                                                                              \
+        auto var = f->m_io->InquireVariable<T>(Req.m_VarName);                                     \
+        if (f->m_mode == RemoteOpenRandomAccess)                                                   \
+            var->SetStepSelection({Req.m_Step, 1});                                                \
+        if (Req.m_BlockID != -1)                                                                   \
+            var->SetBlockSelection(Req.m_BlockID);                                                 \
+        if (Req.m_HasStart)                                                                        \
+            var->SetSelection(Req.m_Box);                                                          \
+        Response.Size = var->SelectionSize() * sizeof(T);                                          \
+        Response.ReadData = ResponseBuffers.Get(Response.Size);                                    \
+        f->m_engine->Get(*var, (T *)Response.ReadData, GetMode);                                   \
+    }
+    ADIOS2_FOREACH_PRIMITIVE_STDTYPE_1ARG(GET)
+#undef GET
+    else
+    {
+        throw std::invalid_argument("variable " + Req.m_VarName + " has an unsupported type");
+    }
+    return TypeOfVar;
+}
+
+static void ServeGetBatch(AnonADIOSFile *f, std::vector<PendingGet> &Batch)
+{
+    auto start = std::chrono::steady_clock::now();
+    const size_t Step = Batch.front().m_Step;
+    std::vector<_ReadResponseMsg> Responses(Batch.size());
+    std::vector<DataType> Types(Batch.size(), DataType::None);
+    // a failed request is answered with its error instead of data
+    std::vector<std::string> Errors(Batch.size());
+    memset(Responses.data(), 0, Batch.size() * sizeof(_ReadResponseMsg));
+
+    auto lf_Fail = [&](const size_t i, const std::string &Error) {
+        if (verbose)
+            std::cout << "Returning exception " << Error << " for Get(" << Batch[i].m_VarName
+                      << ")" << std::endl;
+        ResponseBuffers.Release(Responses[i].ReadData);
+        Responses[i].ReadData = NULL;
+        Responses[i].Size = 0;
+        Errors[i] = Error;
+    };
+
+    try
+    {
+        if (f->m_mode == RemoteOpen)
         {
-            if (verbose >= 2)
-                std::cout << "Advancing a step" << std::endl;
-            f->m_engine->EndStep();
-            f->m_engine->BeginStep();
-            f->currentStep++;
+            if (f->currentStep == -1)
+            {
+                f->m_engine->BeginStep();
+                f->currentStep++;
+            }
+            while (f->m_engine->CurrentStep() < Step)
+            {
+                if (verbose >= 2)
+                    std::cout << "Advancing a step" << std::endl;
+                f->m_engine->EndStep();
+                f->m_engine->BeginStep();
+                f->currentStep++;
+            }
+        }
+    }
+    catch (const std::exception &exc)
+    {
+        for (size_t i = 0; i < Batch.size(); ++i)
+        {
+            lf_Fail(i, "advancing to step " + std::to_string(Step) + ": " + exc.what());
         }
     }
 
-    std::string VarName = std::string(GetMsg->VarName);
-    adios2::DataType TypeOfVar = f->m_io->InquireVariableType(VarName);
-    Box<Dims> b;
-    if (GetMsg->Count)
+    bool Queued = false;
+    for (size_t i = 0; i < Batch.size(); ++i)
     {
-        for (int i = 0; i < GetMsg->DimCount; i++)
+        if (!Errors[i].empty())
         {
-            b.first.push_back(GetMsg->Start[i]);
-            b.second.push_back(GetMsg->Count[i]);
+            continue;
+        }
+        try
+        {
+            Types[i] = QueueGet(f, Batch[i], Responses[i], Mode::Deferred);
+            Queued = true;
+        }
+        catch (const std::exception &exc)
+        {
+            lf_Fail(i, exc.what());
         }
     }
 
     try
     {
-        if (TypeOfVar == adios2::DataType::None)
+        if (Queued)
         {
+            f->m_engine->PerformGets();
         }
-#define GET(T)                                                                                     \
-    else if (TypeOfVar == helper::GetDataType<T>())                                                \
-    {                                                                                              \
-        _ReadResponseMsg Response;                                                                 \
-        memset(&Response, 0, sizeof(Response));                                                    \
-        auto var = f->m_io->InquireVariable<T>(VarName);                                           \
-        if (f->m_mode == RemoteOpenRandomAccess)                                                   \
-            var->SetStepSelection({GetMsg->Step, 1});                                              \
-        if (GetMsg->BlockID != -1)                                                                 \
-            var->SetBlockSelection(GetMsg->BlockID);                                               \
-        if (GetMsg->Start)                                                                         \
-            var->SetSelection(b);                                                                  \
-        Response.Size = var->SelectionSize() * sizeof(T);                                          \
-        T *RetData = (T *)malloc(Response.Size);                                                   \
-        f->m_engine->Get(*var, RetData, Mode::Sync);                                               \
-        Response.ReadData = (char *)RetData;                                                       \
-        Response.ReadResponseCondition = GetMsg->GetResponseCondition;                             \
-        Response.Dest = GetMsg->Dest; /* final data destination in client memory space */          \
-        if (verbose >= 2)                                                                          \
-            std::cout << "Returning " << readable_size(Response.Size) << " for Get<" << TypeOfVar  \
-                      << ">(" << VarName << ")" << b << std::endl;                                 \
-        f->m_BytesSent += Response.Size;                                                           \
-        f->m_OperationCount++;                                                                     \
-        TotalGetBytesSent += Response.Size;                                                        \
-        TotalGets++;                                                                               \
-        CMwrite(conn, ev_state->ReadResponseFormat, &Response);                                    \
-        free(RetData);                                                                             \
-    }
-        ADIOS2_FOREACH_PRIMITIVE_STDTYPE_1ARG(GET)
-#undef GET
     }
     catch (const std::exception &exc)
     {
+        // one bad request fails the whole batch, serve the rest one by one
         if (verbose)
-            std::cout << "Returning exception " << exc.what() << " for Get<" << TypeOfVar << ">("
-                      << VarName << ")" << std::endl;
+            std::cout << "Retrying " << Batch.size() << " Get()s in step " << Step
+                      << " one at a time after exception " << exc.what() << std::endl;
+        for (size_t i = 0; i < Batch.size(); ++i)
+        {
+            if (!Errors[i].empty())
+            {
+                continue;
+            }
+            ResponseBuffers.Release(Responses[i].ReadData);
+            Responses[i].ReadData = NULL;
+            try
+            {
+                QueueGet(f, Batch[i], Responses[i], Mode::Sync);
+            }
+            catch (const std::exception &exc)
+            {
+                lf_Fail(i, exc.what());
+            }
+        }
+    }
+
+    for (size_t i = 0; i < Batch.size(); ++i)
+    {
+        const PendingGet &Req = Batch[i];
+        _ReadResponseMsg &Response = Responses[i];
+        if (!Errors[i].empty())
+        {
+            Response.ReadResponseCondition = Req.m_GetResponseCondition;
+            Response.Dest = Req.m_Dest;
+            Response.Error = const_cast<char *>(Errors[i].c_str());
+            CMwrite(Req.m_Conn, Req.m_EvState->ReadResponseFormat, &Response);
+        }
+        else
+        {
+            if (f->m_ResponseOperator)
+            {
+                CompressResponse(f, Req, Types[i], Response);
+            }
+            Response.ReadResponseCondition = Req.m_GetResponseCondition;
+            Response.Dest = Req.m_Dest; /* final data destination in client memory space */
+            if (verbose >= 2)
+                std::cout << "Returning " << readable_size(Response.Size) << " for Get("
+                          << Req.m_VarName << ")" << Req.m_Box << std::endl;
+            f->m_BytesSent += Response.Size;
+            f->m_OperationCount++;
+            TotalGetBytesSent += Response.Size;
+            TotalGets++;
+            CMwrite(Req.m_Conn, Req.m_EvState->ReadResponseFormat, &Response);
+            ResponseBuffers.Release(Response.ReadData);
+        }
+        CMConnection_dereference(Req.m_Conn);
+        auto latency = std::chrono::duration_cast<std::chrono::microseconds>(
+                           std::chrono::steady_clock::now() - Req.m_Arrival)
+                           .count();
+        TotalGetLatencyUs += latency;
+        lf_AtomicMax<uint64_t>(MaxGetLatencyUs, latency);
+    }
+    GetBatches++;
+    GetServiceUs += std::chrono::duration_cast<std::chrono::microseconds>(
+                        std::chrono::steady_clock::now() - start)
+                        .count();
+}
+
+/* runs on a worker until the file's queue is empty, requests for the same
+ * step queued while the previous batch was served go into one batch */
+static void ServeGets(AnonADIOSFile *f)
+{
+    while (true)
+    {
+        std::vector<PendingGet> Batch;
+        {
+            std::lock_guard<std::mutex> lockGuard(f->m_QueueMutex);
+            if (f->m_Queue.empty())
+            {
+                f->m_Busy = false;
+                if (!f->m_CloseWhenIdle)
+                {
+                    return;
+                }
+            }
+            else
+            {
+                const size_t Step = f->m_Queue.front().m_Step;
+                while (!f->m_Queue.empty() && (f->m_Queue.front().m_Step == Step))
+                {
+                    Batch.push_back(std::move(f->m_Queue.front()));
+                    f->m_Queue.pop_front();
+                }
+            }
+        }
+        if (Batch.empty())
+        {
+            // the connection went away while we were serving it
+            delete f;
+            return;
+        }
+        GetQueueDepth -= Batch.size();
+        ServeGetBatch(f, Batch);
+    }
+}
+
+static void GetRequestHandler(CManager cm, CMConnection conn, void *vevent, void *client_data,
+                              attr_list attrs)
+{
+    GetRequestMsg GetMsg = static_cast<GetRequestMsg>(vevent);
+    AnonADIOSFile *f = ADIOSFileMap[GetMsg->FileHandle];
+    struct Remote_evpath_state *ev_state = static_cast<struct Remote_evpath_state *>(client_data);
+    last_service_time = std::chrono::steady_clock::now();
+
+    PendingGet Req;
+    Req.m_Conn = conn;
+    Req.m_EvState = ev_state;
+    Req.m_VarName = std::string(GetMsg->VarName);
+    Req.m_Step = GetMsg->Step;
+    Req.m_BlockID = GetMsg->BlockID;
+    Req.m_HasStart = (GetMsg->Start != NULL);
+    if (GetMsg->Count)
+    {
+        for (int i = 0; i < GetMsg->DimCount; i++)
+        {
+            Req.m_Box.first.push_back(GetMsg->Start[i]);
+            Req.m_Box.second.push_back(GetMsg->Count[i]);
+        }
+    }
+    Req.m_GetResponseCondition = GetMsg->GetResponseCondition;
+    Req.m_Dest = GetMsg->Dest;
+    Req.m_Arrival = last_service_time;
+
+    // the worker writes the response after this handler has returned
+    CMConnection_add_reference(conn);
+    bool schedule;
+    {
+        std::lock_guard<std::mutex> lockGuard(f->m_QueueMutex);
+        f->m_Queue.push_back(std::move(Req));
+        schedule = !f->m_Busy;
+        f->m_Busy = true;
+    }
+    lf_AtomicMax<size_t>(MaxGetQueueDepth, ++GetQueueDepth);
+    if (schedule)
+    {
+        GetWorkers->Submit([f]() { ServeGets(f); });
     }
 }
 
@@ -327,7 +660,7 @@ static void ReadRequestHandler(CManager cm, CMConnection conn, void *vevent, voi
         lseek(f->m_FileDescriptor, (long)ReadMsg->Offset, SEEK_SET);
         f->m_CurrentOffset = ReadMsg->Offset;
     }
-    char *tmp = (char *)malloc(ReadMsg->Size);
+    char *tmp = ResponseBuffers.Get(ReadMsg->Size);
     size_t remaining = ReadMsg->Size;
     char *pointer = tmp;
     while (remaining > 0)
@@ -338,7 +671,7 @@ static void ReadRequestHandler(CManager cm, CMConnection conn, void *vevent, voi
             // EOF or error,  should send a message back, but we haven't define error handling yet
             std::cout << "Read failed! BAD!" << std::endl;
             // instead free tmp and return;
-            free(tmp);
+            ResponseBuffers.Release(tmp);
             return;
         }
         else
@@ -361,7 +694,32 @@ static void ReadRequestHandler(CManager cm, CMConnection conn, void *vevent, voi
     TotalSimpleBytesSent += Response.Size;
     TotalSimpleReads++;
     CMwrite(conn, ev_state->ReadResponseFormat, &Response);
-    free(tmp);
+    ResponseBuffers.Release(tmp);
+}
+
+static std::string ServerStatus()
+{
+    std::stringstream Status;
+    Status << "ADIOS files Opened: " << ADIOSFilesOpened << " (" << TotalGets.load()
+           << " gets for " << readable_size(TotalGetBytesSent.load())
+           << ")  Simple files opened: " << SimpleFilesOpened << " (" << TotalSimpleReads
+           << " reads for " << readable_size(TotalSimpleBytesSent) << ")";
+    const size_t Gets = TotalGets.load();
+    const uint64_t ServiceUs = GetServiceUs.load();
+    Status << "  Get queue: " << GetQueueDepth.load() << " pending (max "
+           << MaxGetQueueDepth.load() << "), " << GetBatches.load() << " batches on "
+           << GetThreads << " threads, latency avg "
+           << (Gets ? TotalGetLatencyUs.load() / Gets / 1000.0 : 0.0) << " ms max "
+           << MaxGetLatencyUs.load() / 1000.0 << " ms, throughput "
+           << readable_size(ServiceUs ? TotalGetBytesSent.load() * 1000000 / ServiceUs : 0)
+           << "/s";
+    if (CompressedGets.load())
+    {
+        Status << "  Compressed " << CompressedGets.load() << " gets from "
+               << readable_size(CompressedBytesIn.load()) << " to "
+               << readable_size(CompressedBytesOut.load());
+    }
+    return Status.str();
 }
 
 static void KillServerHandler(CManager cm, CMConnection conn, void *vevent, void *client_data,
@@ -372,12 +730,7 @@ static void KillServerHandler(CManager cm, CMConnection conn, void *vevent, void
     _KillResponseMsg kill_response_msg;
     memset(&kill_response_msg, 0, sizeof(kill_response_msg));
     kill_response_msg.KillResponseCondition = kill_msg->KillResponseCondition;
-    std::stringstream Status;
-    Status << "ADIOS files Opened: " << ADIOSFilesOpened << " (" << TotalGets << " gets for "
-           << readable_size(TotalGetBytesSent) << ")  Simple files opened: " << SimpleFilesOpened
-           << " (" << TotalSimpleReads << " reads for " << readable_size(TotalSimpleBytesSent)
-           << ")";
-    kill_response_msg.Status = strdup(Status.str().c_str());
+    kill_response_msg.Status = strdup(ServerStatus().c_str());
     CMwrite(conn, ev_state->KillResponseFormat, &kill_response_msg);
     free(kill_response_msg.Status);
     exit(0);
@@ -404,12 +757,7 @@ static void StatusServerHandler(CManager cm, CMConnection conn, void *vevent, vo
     memset(&status_response_msg, 0, sizeof(status_response_msg));
     status_response_msg.StatusResponseCondition = status_msg->StatusResponseCondition;
     status_response_msg.Hostname = &hostbuffer[0];
-    std::stringstream Status;
-    Status << "ADIOS files Opened: " << ADIOSFilesOpened << " (" << TotalGets << " gets for "
-           << readable_size(TotalGetBytesSent) << ")  Simple files opened: " << SimpleFilesOpened
-           << " (" << TotalSimpleReads << " reads for " << readable_size(TotalSimpleBytesSent)
-           << ")";
-    status_response_msg.Status = strdup(Status.str().c_str());
+    status_response_msg.Status = strdup(ServerStatus().c_str());
     CMwrite(conn, ev_state->StatusResponseFormat, &status_response_msg);
     free(status_response_msg.Status);
 }
@@ -575,6 +923,19 @@ int main(int argc, char **argv)
         {
             no_timeout++;
         }
+        else if (strcmp(argv[i], "-threads") == 0)
+        {
+            i++;
+            if ((argc <= i) || (atoi(argv[i]) < 1))
+            {
+                fprintf(stderr, "Flag -threads requires a positive argument\n");
+                fprintf(stderr,
+                        "Usage:  adios2_remote_server [-background] [-kill_server] [-no_timeout] "
+                        "[-status] [-threads n] [-v] [-q] [-l logfile]\n");
+                exit(1);
+            }
+            GetThreads = static_cast<size_t>(atoi(argv[i]));
+        }
         else if (strcmp(argv[i], "-v") == 0)
         {
             verbose++;
@@ -591,7 +952,7 @@ int main(int argc, char **argv)
                 fprintf(stderr, "Flag -l requires an argument\n");
                 fprintf(stderr,
                         "Usage:  adios2_remote_server [-background] [-kill_server] [-no_timeout] "
-                        "[-status] [-v] [-q] [-l logfile]\n");
+                        "[-status] [-threads n] [-v] [-q] [-l logfile]\n");
                 exit(1);
             }
             char *filename = argv[i];
@@ -607,7 +968,7 @@ int main(int argc, char **argv)
             fprintf(stderr, "Unknown argument \"%s\"\n", argv[i]);
             fprintf(stderr,
                     "Usage:  adios2_remote_server [-background] [-kill_server] [-no_timeout] "
-                    "[-status] [-v] [-q] [-l logfile]\n");
+                    "[-status] [-threads n] [-v] [-q] [-l logfile]\n");
             exit(1);
         }
     }
@@ -754,6 +1115,8 @@ int main(int argc, char **argv)
 
     ServerRegisterHandlers(ev_state);
 
+    GetWorkers.reset(new helper::ThreadPool(GetThreads));
+
     CMrun_network(cm);
     return 0;
 }
@@ -38,6 +38,18 @@ void Transport::WriteV(const core::iovec *iov, const int iovcnt, size_t start)
     }
 }
 
+void Transport::ReadV(const core::iovec *iov, const int iovcnt, size_t start)
+{
+    for (int c = 0; c < iovcnt; ++c)
+    {
+        Read(static_cast<char *>(const_cast<void *>(iov[c].iov_base)), iov[c].iov_len, start);
+        if (start != MaxSizeT)
+        {
+            start += iov[c].iov_len;
+        }
+    }
+}
+
 void Transport::InitProfiler(const Mode openMode, const TimeUnit timeUnit)
 {
     m_Profiler.m_IsActive = true;
@@ -123,6 +123,16 @@ public:
      */
     virtual void Read(char *buffer, size_t size, size_t start = MaxSizeT) = 0;
 
+    /**
+     * Reads a contiguous range from transport into several buffers, readv
+     * version.
+     * @param iovec array pointer, iov_base of each entry is written to
+     * @param iovcnt number of entries
+     * @param start starting position for read, if not passed then start at
+     * current stream position
+     */
+    virtual void ReadV(const core::iovec *iov, const int iovcnt, size_t start = MaxSizeT);
+
     /**
      * Returns the size of current data in transport
      * @return size as size_t
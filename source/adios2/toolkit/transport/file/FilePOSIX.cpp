@@ -13,6 +13,7 @@
 #endif
 #endif
 
+#include <algorithm>   // std::min
 #include <cstdio>      // remove
 #include <cstring>     // strerror
 #include <errno.h>     // errno
@@ -21,7 +22,9 @@
 #include <sys/types.h> // open
 #include <thread>
 #ifndef _MSC_VER
-#include <unistd.h> // write, close, ftruncate
+#include <limits.h>  // IOV_MAX
+#include <sys/uio.h> // readv
+#include <unistd.h>  // write, close, ftruncate
 #ifndef O_BINARY
 #define O_BINARY 0
 #endif
@@ -504,6 +507,88 @@ void FilePOSIX::Read(char *buffer, size_t size, size_t start)
     }
 }
 
+#ifndef _WIN32
+void FilePOSIX::ReadV(const core::iovec *iov, const int iovcnt, size_t start)
+{
+#ifdef IOV_MAX
+    constexpr int maxIovPerCall = IOV_MAX;
+#else
+    constexpr int maxIovPerCall = 1024;
+#endif
+    WaitForOpen();
+
+    if (start != MaxSizeT)
+    {
+        errno = 0;
+        const auto newPosition = lseek(m_FileDescriptor, start, SEEK_SET);
+        m_Errno = errno;
+
+        if (static_cast<size_t>(newPosition) != start)
+        {
+            helper::Throw<std::ios_base::failure>("Toolkit", "transport::file::FilePOSIX", "ReadV",
+                                                  "couldn't move to start position " +
+                                                      std::to_string(start) + " in file " + m_Name +
+                                                      " " + SysErrMsg());
+        }
+    }
+
+    int cntTotal = 0;
+    while (cntTotal < iovcnt)
+    {
+        const int cnt = std::min(iovcnt - cntTotal, maxIovPerCall);
+        size_t nBytesExpected = 0;
+        for (int i = cntTotal; i < cntTotal + cnt; ++i)
+        {
+            nBytesExpected += iov[i].iov_len;
+        }
+
+        ProfilerStart("read");
+        errno = 0;
+        const ::iovec *v = reinterpret_cast<const ::iovec *>(iov + cntTotal);
+        const auto ret = readv(m_FileDescriptor, v, cnt);
+        m_Errno = errno;
+        ProfilerStop("read");
+
+        size_t nRead;
+        if (ret == -1)
+        {
+            if (errno != EINTR)
+            {
+                helper::Throw<std::ios_base::failure>(
+                    "Toolkit", "transport::file::FilePOSIX", "ReadV",
+                    "couldn't read from file " + m_Name + " " + SysErrMsg());
+            }
+            nRead = 0;
+        }
+        else
+        {
+            nRead = static_cast<size_t>(ret);
+        }
+
+        if (nRead < nBytesExpected)
+        {
+            /* Fall back to read calls with individual buffers, they know
+             * how to deal with EOF and interrupted calls */
+            int c = cntTotal;
+            size_t n = 0;
+            while (n + iov[c].iov_len <= nRead)
+            {
+                n += iov[c].iov_len;
+                ++c;
+            }
+            const size_t pos = nRead - n;
+            Read(static_cast<char *>(const_cast<void *>(iov[c].iov_base)) + pos,
+                 iov[c].iov_len - pos);
+            for (++c; c < cntTotal + cnt; ++c)
+            {
+                Read(static_cast<char *>(const_cast<void *>(iov[c].iov_base)), iov[c].iov_len);
+            }
+        }
+        cntTotal += cnt;
+    }
+}
+#endif
+
 size_t FilePOSIX::GetSize()
 {
     struct stat fileStat;
@@ -47,6 +47,10 @@ public:
 
     void Read(char *buffer, size_t size, size_t start = MaxSizeT) final;
 
+#ifndef _WIN32
+    void ReadV(const core::iovec *iov, const int iovcnt, size_t start = MaxSizeT) final;
+#endif
+
     size_t GetSize() final;
 
     /** Does nothing, each write is supposed to flush */
@@ -416,6 +416,14 @@ void TransportMan::ReadFile(char *buffer, const size_t size, const size_t start,
     itTransport->second->Read(buffer, size, start);
 }
 
+void TransportMan::ReadFile(const core::iovec *iov, const size_t iovcnt, const size_t start,
+                            const size_t transportIndex)
+{
+    auto itTransport = m_Transports.find(transportIndex);
+    CheckFile(itTransport, ", in call to ReadFile with index " + std::to_string(transportIndex));
+    itTransport->second->ReadV(iov, static_cast<int>(iovcnt), start);
+}
+
 void TransportMan::SetParameters(const Params &params, const int transportIndex)
 {
     if (transportIndex == -1)
@@ -169,6 +169,17 @@ public:
     void ReadFile(char *buffer, const size_t size, const size_t start = 0,
                   const size_t transportIndex = 0);
 
+    /**
+     * Read a contiguous range from a single file into several buffers,
+     * readv version
+     * @param iov
+     * @param iovcnt
+     * @param start
+     * @param transportIndex
+     */
+    void ReadFile(const core::iovec *iov, const size_t iovcnt, const size_t start = 0,
+                  const size_t transportIndex = 0);
+
     /**
      * Flush file or files depending on transport index. Throws an exception
      * if transport is not a file when transportIndex > -1.
@@ -13,15 +13,20 @@
        Actually, this means, even more memory is needed than the size of output.
        We need to read each variable while also buffering all of them for
  output.
+       With --memory-budget, the step is read and written in batches instead,
+       but only global arrays are cut into slabs, a local array block larger
+       than the budget is still read as a whole.
      - output steps contain the same variable set (no changes in variables)
      - attributes are the same for all steps (will write only once here)
  */
 
 #include "Reorganize.h"
 
+#include <algorithm>
 #include <assert.h>
 #include <iomanip>
 #include <string>
+#include <thread>
 
 #include "adios2/common/ADIOSMacros.h"
 #include "adios2/core/ADIOS.h"
@@ -31,6 +36,7 @@
 #include "adios2/helper/adiosFunctions.h"
 #include "adios2/helper/adiosLog.h"
 #include "adios2/helper/adiosString.h"
+#include "adios2/toolkit/query/BitmapIndex.h"
 
 #if ADIOS2_USE_MPI
 #include "adios2/helper/adiosCommMPI.h"
@@ -41,6 +47,7 @@
 // C headers
 #include <cerrno>
 #include <cstdlib>
+#include <cstring>
 
 namespace adios2
 {
@@ -60,6 +67,22 @@ Reorganize::Reorganize(int argc, char *argv[]) : Utils("adios_reorganize", argc,
     m_Rank = m_Comm.Rank();
     m_Size = m_Comm.Size();
 
+    // options may be anywhere, the rest are the positional arguments
+    std::vector<char *> args;
+    for (int i = 0; i < argc; i++)
+    {
+        if (i > 0 && std::strncmp(argv[i], "--", 2) == 0)
+        {
+            SetParameters(argv[i], true);
+        }
+        else
+        {
+            args.push_back(argv[i]);
+        }
+    }
+    argc = static_cast<int>(args.size());
+    argv = args.data();
+
     if (argc < 7)
     {
         PrintUsage();
@@ -121,15 +144,41 @@ void Reorganize::Run()
     ProcessParameters();
     int retval = 0;
 
+#if ADIOS2_USE_MPI
+    if (m_Pipeline)
+    {
+        // the writer thread makes MPI calls while the main thread reads
+        int provided;
+        MPI_Query_thread(&provided);
+        if (provided < MPI_THREAD_MULTIPLE)
+        {
+            print0("WARNING: MPI does not provide MPI_THREAD_MULTIPLE, "
+                   "ignoring --pipeline");
+            m_Pipeline = false;
+        }
+    }
+#endif
+
     print0("Input stream            = ", infilename);
     print0("Output stream           = ", outfilename);
     print0("Read method             = ", rmethodname);
     print0("Read method parameters  = ", rmethodparam_str);
     print0("Write method            = ", wmethodname);
     print0("Write method parameters = ", wmethodparam_str);
+    if (m_Pipeline)
+    {
+        print0("Pipelined read and write");
+    }
+    if (m_MemoryBudget)
+    {
+        print0("Memory budget           = ", m_MemoryBudget, " bytes");
+    }
 
     core::ADIOS adios(m_Comm.Duplicate(), "C++");
     core::IO &io = adios.DeclareIO("group");
+    // the writer thread cannot share the variables of the reader, which
+    // change at every step, so it defines its own in another io
+    core::IO &wio = m_Pipeline ? adios.DeclareIO("output") : io;
 
     print0("Waiting to open stream ", infilename, "...");
 
@@ -138,75 +187,103 @@ void Reorganize::Run()
     core::Engine &rStream = io.Open(infilename, adios2::Mode::Read);
     // rStream.FixedSchedule();
 
-    io.ClearParameters();
-    io.SetEngine(wmethodname);
-    io.SetParameters(wmethodparams);
-    core::Engine &wStream = io.Open(outfilename, adios2::Mode::Write);
+    wio.ClearParameters();
+    wio.SetEngine(wmethodname);
+    wio.SetParameters(wmethodparams);
+    core::Engine &wStream = wio.Open(outfilename, adios2::Mode::Write);
+
+    std::thread writer;
+    if (m_Pipeline)
+    {
+        writer = std::thread(&Reorganize::WriterThread, this, std::ref(wStream), std::ref(wio));
+    }
 
     int steps = 0;
     int curr_step = -1;
-    while (true)
+    try
     {
-        adios2::StepStatus status = rStream.BeginStep(adios2::StepMode::Read, 10.0);
-        if (status == adios2::StepStatus::NotReady)
+        while (true)
         {
-            if (handleAsStream)
+            adios2::StepStatus status = rStream.BeginStep(adios2::StepMode::Read, 10.0);
+            if (status == adios2::StepStatus::NotReady)
             {
-                if (!m_Rank)
+                if (handleAsStream)
                 {
-                    std::cout << " No new steps arrived in a while " << std::endl;
+                    if (!m_Rank)
+                    {
+                        std::cout << " No new steps arrived in a while " << std::endl;
+                    }
+                    continue;
                 }
-                continue;
-            }
-            else
-            {
-                if (!m_Rank)
+                else
                 {
-                    std::cout << " Timeout waiting for next step. If this is "
-                                 "a live stream through file, use a different "
-                                 "reading engine, like FileStream or BP4. "
-                                 "If it is an unclosed BP file, you may manually "
-                                 "close it with using adios_deactive_bp.sh."
-                              << std::endl;
+                    if (!m_Rank)
+                    {
+                        std::cout << " Timeout waiting for next step. If this is "
+                                     "a live stream through file, use a different "
+                                     "reading engine, like FileStream or BP4. "
+                                     "If it is an unclosed BP file, you may manually "
+                                     "close it with using adios_deactive_bp.sh."
+                                  << std::endl;
+                    }
+                    break;
                 }
+            }
+            else if (status != adios2::StepStatus::OK)
+            {
                 break;
             }
-        }
-        else if (status != adios2::StepStatus::OK)
-        {
-            break;
-        }
 
-        steps++; // start counting from 1
+            steps++; // start counting from 1
 
-        if (rStream.CurrentStep() != static_cast<size_t>(curr_step + 1))
-        {
-            // we missed some steps
-            std::cout << "rank " << m_Rank << " WARNING: steps " << curr_step << ".."
-                      << rStream.CurrentStep() - 1 << "were missed when advancing." << std::endl;
-        }
+            if (rStream.CurrentStep() != static_cast<size_t>(curr_step + 1))
+            {
+                // we missed some steps
+                std::cout << "rank " << m_Rank << " WARNING: steps " << curr_step << ".."
+                          << rStream.CurrentStep() - 1 << "were missed when advancing."
+                          << std::endl;
+            }
 
-        curr_step = static_cast<int>(rStream.CurrentStep());
-        const core::VarMap &variables = io.GetVariables();
-        const core::AttrMap &attributes = io.GetAttributes();
+            curr_step = static_cast<int>(rStream.CurrentStep());
+            const core::VarMap &variables = io.GetVariables();
+            const core::AttrMap &attributes = io.GetAttributes();
 
-        print0("____________________\n\nFile info:");
-        print0("  current step:   ", curr_step);
-        print0("  # of variables: ", variables.size());
-        print0("  # of attributes: ", attributes.size());
+            print0("____________________\n\nFile info:");
+            print0("  current step:   ", curr_step);
+            print0("  # of variables: ", variables.size());
+            print0("  # of attributes: ", attributes.size());
 
-        retval = ProcessMetadata(rStream, io, variables, attributes, steps);
-        if (retval)
-            break;
+            retval = ProcessMetadata(rStream, io, variables, attributes, steps);
+            if (retval)
+                break;
 
-        retval = ReadWrite(rStream, wStream, io, variables, steps);
-        if (retval)
-            break;
+            if (m_Pipeline || m_MemoryBudget)
+            {
+                retval = ReadWriteBatches(rStream, wStream, io, wio);
+            }
+            else
+            {
+                retval = ReadWrite(rStream, wStream, io, variables, steps);
+            }
+            if (retval)
+                break;
 
-        CleanUpStep(io);
+            CleanUpStep(io);
+        }
+    }
+    catch (...)
+    {
+        // let the writer thread finish before the exception ends the tool
+        StopWriter(writer);
+        throw;
     }
 
     rStream.Close();
+    StopWriter(writer);
+    if (m_WriterError)
+    {
+        std::rethrow_exception(m_WriterError);
+    }
     wStream.Close();
     print0("Bye after processing ", steps, " steps");
 }
@@ -277,7 +354,7 @@ void Reorganize::ProcessParameters()
 
 void Reorganize::PrintUsage() const noexcept
 {
-    std::cout << "Usage: adios_reorganize input output rmethod \"params\" wmethod "
+    std::cout << "Usage: adios_reorganize [options] input output rmethod \"params\" wmethod "
                  "\"params\" "
                  "<decomposition>\n"
                  "    input   Input stream path\n"
@@ -300,13 +377,38 @@ void Reorganize::PrintUsage() const noexcept
                  "values,\n"
                  "            will be decomposed with using the appropriate number "
                  "of\n"
-                 "            values."
+                 "            values.\n"
+                 "Options:\n"
+                 "    --pipeline         Write a step on a separate thread while the\n"
+                 "                       next step is read\n"
+                 "    --memory-budget=SIZE\n"
+                 "                       Max size of data buffered by a process, e.g. 4GB.\n"
+                 "                       Large global arrays are read and written in\n"
+                 "                       slabs, local arrays are not split."
               << std::endl;
 }
 
 void Reorganize::PrintExamples() const noexcept {}
 
-void Reorganize::SetParameters(const std::string argument, const bool isLong) {}
+void Reorganize::SetParameters(const std::string argument, const bool isLong)
+{
+    const std::string budgetOption("--memory-budget=");
+    if (argument == "--pipeline")
+    {
+        m_Pipeline = true;
+    }
+    else if (argument.compare(0, budgetOption.size(), budgetOption) == 0)
+    {
+        m_MemoryBudget = helper::StringToByteUnits(argument.substr(budgetOption.size()),
+                                                   "for option " + budgetOption);
+    }
+    else
+    {
+        PrintUsage();
+        helper::Throw<std::invalid_argument>("Utils", "AdiosReorganize", "SetParameters",
+                                             "Unknown option " + argument);
+    }
+}
 
 std::vector<VarInfo> varinfo;
 
@@ -477,6 +579,7 @@ int Reorganize::ProcessMetadata(core::Engine &rStream, core::IO &io, const core:
     varinfo.resize(variables.size());
     write_total = 0;
     largest_block = 0;
+    size_t largest_unsplit = 0;
 
     // Decompose each variable and calculate output buffer size
     int varidx = 0;
@@ -492,6 +595,11 @@ int Reorganize::ProcessMetadata(core::Engine &rStream, core::IO &io, const core:
         {
             // not supported
         }
+        else if (query::IsBitmapIndexName(name))
+        {
+            // the writer builds the query index of the output itself
+            print0("    skip query index ", name);
+        }
 #define declare_template_instantiation(T)                                                          \
     else if (type == helper::GetDataType<T>())                                                     \
     {                                                                                              \
@@ -570,6 +678,10 @@ int Reorganize::ProcessMetadata(core::Engine &rStream, core::IO &io, const core:
                 write_total += varinfo[varidx].writesize;
                 if (largest_block < varinfo[varidx].writesize)
                     largest_block = varinfo[varidx].writesize;
+                // PlanBatches() cuts only global arrays into slabs
+                if (variable->m_ShapeID != adios2::ShapeID::GlobalArray &&
+                    largest_unsplit < varinfo[varidx].writesize)
+                    largest_unsplit = varinfo[varidx].writesize;
             }
         }
         else
@@ -579,6 +691,22 @@ int Reorganize::ProcessMetadata(core::Engine &rStream, core::IO &io, const core:
         ++varidx;
     }
 
+    if (m_MemoryBudget)
+    {
+        /* The step is read and written in batches, only a block that cannot
+         * be cut into slabs has to be buffered as a whole */
+        if (largest_unsplit > max_read_buffer_size)
+        {
+            helper::Log("Util", "Reorganize", "ProcessMetadata",
+                        "read buffer size needs to hold a block of " +
+                            std::to_string(largest_unsplit) + " bytes but max is set to " +
+                            std::to_string(max_read_buffer_size),
+                        m_Rank, m_Rank, 0, 0, helper::FATALERROR);
+            return 1;
+        }
+        return retval;
+    }
+
     // determine output buffer size
     size_t bufsize = write_total + variables.size() * 200 + attributes.size() * 32 + 1024;
     if (bufsize > max_write_buffer_size)
@@ -702,5 +830,372 @@ int Reorganize::ReadWrite(core::Engine &rStream, core::Engine &wStream, core::IO
     return retval;
 }
 
+std::vector<ChunkBatch> Reorganize::PlanBatches()
+{
+    // in pipelined mode the reader fills a batch while the writer writes
+    // the previous one, each of them gets half of the budget
+    const size_t limit = m_Pipeline ? m_MemoryBudget / 2 : m_MemoryBudget;
+
+    std::vector<VarChunk> chunks;
+    for (const auto &vi : varinfo)
+    {
+        if (vi.v == nullptr || vi.writesize == 0)
+        {
+            continue;
+        }
+        VarChunk chunk;
+        chunk.name = vi.v->m_Name;
+        chunk.type = vi.v->m_Type;
+        chunk.shapeID = vi.v->m_ShapeID;
+        if (chunk.shapeID == ShapeID::GlobalArray)
+        {
+            chunk.shape = vi.v->Shape();
+        }
+        chunk.start = vi.start;
+        chunk.count = vi.count;
+        chunk.elements = helper::GetTotalSize(vi.count);
+        chunk.size = vi.writesize;
+
+        if (!limit || chunk.size <= limit || chunk.shapeID != ShapeID::GlobalArray)
+        {
+            chunks.push_back(std::move(chunk));
+            continue;
+        }
+
+        /* Cut the array into slabs of 'rows' in dimension d, one in the
+         * dimensions before d and all of the dimensions after d. d is the
+         * first dimension where at least one row fits into the limit. */
+        const size_t ndim = vi.count.size();
+        const size_t elementSize = vi.v->m_ElementSize;
+        size_t d = 0;
+        size_t rowSize = chunk.size / vi.count[0];
+        while (rowSize > limit && d + 1 < ndim)
+        {
+            ++d;
+            rowSize /= vi.count[d];
+        }
+        const size_t rows = std::min(std::max<size_t>(limit / rowSize, 1), vi.count[d]);
+
+        chunk.split = true;
+        Dims pos(ndim, 0); // position of the slab in the subset
+        while (true)
+        {
+            VarChunk slab = chunk;
+            for (size_t i = 0; i <= d; ++i)
+            {
+                slab.start[i] = vi.start[i] + pos[i];
+                slab.count[i] = 1;
+            }
+            slab.count[d] = std::min(rows, vi.count[d] - pos[d]);
+            slab.elements = helper::GetTotalSize(slab.count);
+            slab.size = slab.elements * elementSize;
+            chunks.push_back(std::move(slab));
+
+            size_t i = d;
+            pos[i] += rows;
+            while (pos[i] >= vi.count[i] && i > 0)
+            {
+                pos[i] = 0;
+                --i;
+                ++pos[i];
+            }
+            if (pos[0] >= vi.count[0])
+            {
+                break;
+            }
+        }
+    }
+
+    std::vector<ChunkBatch> batches(1);
+    for (auto &chunk : chunks)
+    {
+        if (limit && !batches.back().chunks.empty() && batches.back().size + chunk.size > limit)
+        {
+            batches.emplace_back();
+        }
+        batches.back().size += chunk.size;
+        batches.back().chunks.push_back(std::move(chunk));
+    }
+
+    if (m_MemoryBudget)
+    {
+        // PerformDataWrite() is collective, every process writes in as many
+        // batches as the process with the most batches
+        const size_t nBatches = batches.size();
+        size_t maxBatches = nBatches;
+        m_Comm.Allreduce(&nBatches, &maxBatches, 1, helper::Comm::Op::Max);
+        batches.resize(maxBatches);
+    }
+    batches.front().firstInStep = true;
+    batches.back().lastInStep = true;
+    return batches;
+}
+
+template <class T>
+void Reorganize::GetChunk(core::Engine &rStream, core::IO &io, VarChunk &chunk)
+{
+    // every element is read, no need to initialize the buffer
+    chunk.data = std::shared_ptr<void>(new T[chunk.elements], std::default_delete<T[]>());
+    core::Variable<T> *v = io.InquireVariable<T>(chunk.name);
+    if (chunk.count.empty())
+    {
+        rStream.Get(*v, static_cast<T *>(chunk.data.get()), adios2::Mode::Sync);
+        return;
+    }
+    v->SetSelection({chunk.start, chunk.count});
+    // not every engine keeps the selection of each deferred Get of the same
+    // variable, slabs are read one by one
+    rStream.Get(*v, static_cast<T *>(chunk.data.get()),
+                chunk.split ? adios2::Mode::Sync : adios2::Mode::Deferred);
+}
+
+template <class T>
+void Reorganize::PutChunk(core::Engine &wStream, core::IO &wio, const VarChunk &chunk)
+{
+    core::Variable<T> *v = wio.InquireVariable<T>(chunk.name);
+    if (v == nullptr)
+    {
+        // pipelined mode, the output io has its own variables
+        v = &wio.DefineVariable<T>(chunk.name, chunk.shape, chunk.start, chunk.count);
+    }
+    else if (chunk.shapeID == ShapeID::GlobalArray)
+    {
+        if (v->m_Shape != chunk.shape)
+        {
+            v->SetShape(chunk.shape);
+        }
+        v->SetSelection({chunk.start, chunk.count});
+    }
+    else if (chunk.shapeID == ShapeID::LocalArray)
+    {
+        v->SetSelection({Dims(), chunk.count});
+    }
+    // Sync: the buffer is released right after the Put
+    wStream.Put(*v, static_cast<const T *>(chunk.data.get()), adios2::Mode::Sync);
+}
+
+void Reorganize::ReadBatch(core::Engine &rStream, core::IO &io, ChunkBatch &batch)
+{
+    for (auto &chunk : batch.chunks)
+    {
+        std::cout << "rank " << m_Rank << ": Read variable " << chunk.name << std::endl;
+        if (chunk.type == DataType::Struct)
+        {
+            // not supported
+        }
+#define declare_template_instantiation(T)                                                          \
+    else if (chunk.type == helper::GetDataType<T>())                                               \
+    {                                                                                              \
+        GetChunk<T>(rStream, io, chunk);                                                           \
+    }
+        ADIOS2_FOREACH_STDTYPE_1ARG(declare_template_instantiation)
+#undef declare_template_instantiation
+    }
+    rStream.PerformGets();
+}
+
+void Reorganize::WriteBatch(core::Engine &wStream, core::IO &wio, const ChunkBatch &batch)
+{
+    for (const auto &defineAttribute : batch.attributes)
+    {
+        defineAttribute(wio);
+    }
+    for (const auto &chunk : batch.chunks)
+    {
+        std::cout << "rank " << m_Rank << ": Write variable " << chunk.name << std::endl;
+        if (chunk.type == DataType::Struct)
+        {
+            // not supported
+        }
+#define declare_template_instantiation(T)                                                          \
+    else if (chunk.type == helper::GetDataType<T>())                                               \
+    {                                                                                              \
+        PutChunk<T>(wStream, wio, chunk);                                                          \
+    }
+        ADIOS2_FOREACH_STDTYPE_1ARG(declare_template_instantiation)
+#undef declare_template_instantiation
+    }
+}
+
+std::vector<std::function<void(core::IO &)>>
+Reorganize::CopyAttributes(const core::AttrMap &attributes)
+{
+    std::vector<std::function<void(core::IO &)>> defineAttributes;
+    for (const auto &attributePair : attributes)
+    {
+        const std::string &name = attributePair.first;
+        const DataType type = attributePair.second->m_Type;
+        if (type == DataType::Struct)
+        {
+            // not supported
+        }
+#define declare_template_instantiation(T)                                                          \
+    else if (type == helper::GetDataType<T>())                                                     \
+    {                                                                                              \
+        const auto &a = static_cast<const core::Attribute<T> &>(*attributePair.second);            \
+        if (a.m_IsSingleValue)                                                                     \
+        {                                                                                          \
+            const T value = a.m_DataSingleValue;                                                   \
+            defineAttributes.push_back([name, value](core::IO &wio) {                              \
+                wio.DefineAttribute<T>(name, value, "", "/", true);                                \
+            });                                                                                    \
+        }                                                                                          \
+        else                                                                                       \
+        {                                                                                          \
+            const std::vector<T> values = a.m_DataArray;                                           \
+            defineAttributes.push_back([name, values](core::IO &wio) {                             \
+                wio.DefineAttribute<T>(name, values.data(), values.size(), "", "/", true);         \
+            });                                                                                    \
+        }                                                                                          \
+    }
+        ADIOS2_FOREACH_ATTRIBUTE_STDTYPE_1ARG(declare_template_instantiation)
+#undef declare_template_instantiation
+    }
+    return defineAttributes;
+}
+
+int Reorganize::ReadWriteBatches(core::Engine &rStream, core::Engine &wStream, core::IO &io,
+                                 core::IO &wio)
+{
+    std::vector<ChunkBatch> batches = PlanBatches();
+    if (m_Pipeline)
+    {
+        // the writer thread may not look at the attributes of the reader
+        batches.front().attributes = CopyAttributes(io.GetAttributes());
+    }
+    else
+    {
+        wStream.BeginStep();
+    }
+
+    for (auto &batch : batches)
+    {
+        if (m_Pipeline)
+        {
+            if (!WaitForMemory(batch.size))
+            {
+                return 1;
+            }
+            ReadBatch(rStream, io, batch);
+            PushBatch(std::move(batch));
+        }
+        else
+        {
+            ReadBatch(rStream, io, batch);
+            WriteBatch(wStream, wio, batch);
+            batch.chunks.clear();
+            if (!batch.lastInStep)
+            {
+                wStream.PerformDataWrite();
+            }
+        }
+    }
+
+    rStream.EndStep();
+    if (!m_Pipeline)
+    {
+        wStream.EndStep();
+    }
+    return 0;
+}
+
+bool Reorganize::WaitForMemory(size_t size)
+{
+    std::unique_lock<std::mutex> lock(m_QueueMutex);
+    m_QueueCV.wait(lock, [&]() {
+        if (m_WriterError)
+        {
+            return true;
+        }
+        if (!m_MemoryBudget)
+        {
+            // one step is being written while the next one is read
+            return m_BatchesInFlight < 2;
+        }
+        return m_BatchesInFlight == 0 || m_BytesInFlight + size <= m_MemoryBudget;
+    });
+    if (m_WriterError)
+    {
+        return false;
+    }
+    m_BytesInFlight += size;
+    ++m_BatchesInFlight;
+    return true;
+}
+
+void Reorganize::StopWriter(std::thread &writer)
+{
+    if (!writer.joinable())
+    {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(m_QueueMutex);
+        m_ReaderDone = true;
+    }
+    m_QueueCV.notify_all();
+    writer.join();
+}
+
+void Reorganize::PushBatch(ChunkBatch &&batch)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_QueueMutex);
+        m_Queue.push_back(std::move(batch));
+    }
+    m_QueueCV.notify_all();
+}
+
+void Reorganize::WriterThread(core::Engine &wStream, core::IO &wio)
+{
+    try
+    {
+        while (true)
+        {
+            ChunkBatch batch;
+            {
+                std::unique_lock<std::mutex> lock(m_QueueMutex);
+                m_QueueCV.wait(lock, [&]() { return !m_Queue.empty() || m_ReaderDone; });
+                if (m_Queue.empty())
+                {
+                    return;
+                }
+                batch = std::move(m_Queue.front());
+                m_Queue.pop_front();
+            }
+
+            if (batch.firstInStep)
+            {
+                wStream.BeginStep();
+            }
+            WriteBatch(wStream, wio, batch);
+            batch.chunks.clear();
+            if (batch.lastInStep)
+            {
+                wStream.EndStep();
+            }
+            else
+            {
+                wStream.PerformDataWrite();
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(m_QueueMutex);
+                m_BytesInFlight -= batch.size;
+                --m_BatchesInFlight;
+            }
+            m_QueueCV.notify_all();
+        }
+    }
+    catch (...)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_QueueMutex);
+            m_WriterError = std::current_exception();
+        }
+        m_QueueCV.notify_all();
+    }
+}
+
 } // end namespace utils
 } // end namespace adios2
@@ -11,6 +11,14 @@
 #ifndef UTILS_REORGANIZE_REORGANIZE_H_
 #define UTILS_REORGANIZE_REORGANIZE_H_
 
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+
 #include "adios2/core/IO.h"
 #include "adios2/helper/adiosComm.h"
 #include "utils/Utils.h"
@@ -30,6 +38,34 @@ struct VarInfo
     void *readbuf = nullptr; // read in buffer
 };
 
+// A part of the subset of a variable one process writes, read and written
+// at once. Global arrays larger than the memory budget are cut into slabs.
+struct VarChunk
+{
+    std::string name;
+    DataType type = DataType::None;
+    ShapeID shapeID = ShapeID::Unknown;
+    Dims shape;
+    Dims start;
+    Dims count;
+    size_t elements = 0;
+    size_t size = 0;            // bytes of data
+    bool split = false;         // the variable is read in several chunks
+    std::shared_ptr<void> data; // read in buffer
+};
+
+// Chunks read with one PerformGets and written between two
+// PerformDataWrite calls
+struct ChunkBatch
+{
+    std::vector<VarChunk> chunks;
+    size_t size = 0; // bytes of data of all chunks
+    bool firstInStep = false;
+    bool lastInStep = false;
+    // define the attributes of the step in the output io (pipelined mode)
+    std::vector<std::function<void(core::IO &)>> attributes;
+};
+
 class Reorganize : public Utils
 {
 public:
@@ -64,6 +100,22 @@ private:
                         const core::AttrMap &attributes, int step);
     int ReadWrite(core::Engine &rStream, core::Engine &wStream, core::IO &io,
                   const core::VarMap &variables, int step);
+    int ReadWriteBatches(core::Engine &rStream, core::Engine &wStream, core::IO &io,
+                         core::IO &wio);
+    std::vector<ChunkBatch> PlanBatches();
+    void ReadBatch(core::Engine &rStream, core::IO &io, ChunkBatch &batch);
+    void WriteBatch(core::Engine &wStream, core::IO &wio, const ChunkBatch &batch);
+    std::vector<std::function<void(core::IO &)>> CopyAttributes(const core::AttrMap &attributes);
+    template <class T>
+    void GetChunk(core::Engine &rStream, core::IO &io, VarChunk &chunk);
+    template <class T>
+    void PutChunk(core::Engine &wStream, core::IO &wio, const VarChunk &chunk);
+
+    // pipelined mode: the writer thread takes the batches from the reader
+    void WriterThread(core::Engine &wStream, core::IO &wio);
+    void PushBatch(ChunkBatch &&batch);
+    void StopWriter(std::thread &writer);
+    bool WaitForMemory(size_t size);
     Params parseParams(const std::string &param_str);
 
     // Input arguments
@@ -100,6 +152,21 @@ private:
 
     int decomp_values[10] = {1, 1, 1, 1, 1, 1, 1, 1, 1, 1};
 
+    // --pipeline: read the next step on the main thread while the current
+    // step is written by a writer thread
+    bool m_Pipeline = false;
+    // --memory-budget: max bytes of data buffered by one process,
+    // 0: the whole step is read before it is written
+    size_t m_MemoryBudget = 0;
+
+    std::mutex m_QueueMutex;
+    std::condition_variable m_QueueCV;
+    std::deque<ChunkBatch> m_Queue;
+    size_t m_BatchesInFlight = 0; // pushed by the reader and not yet written
+    size_t m_BytesInFlight = 0;
+    bool m_ReaderDone = false;
+    std::exception_ptr m_WriterError;
+
     template <typename Arg, typename... Args>
     void print0(Arg &&arg, Args &&...args);
 
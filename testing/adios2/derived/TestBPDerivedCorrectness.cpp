@@ -435,6 +435,200 @@ TEST_P(DerivedCorrectnessP, MagCurlCorrectnessTest)
     EXPECT_LT(err / (Nx * Ny * Nz), error_limit);
 }
 
+TEST_P(DerivedCorrectnessP, NestedCorrectnessTest)
+{
+    // more elements than one tile of the fused evaluation
+    const size_t Nx = 30, Ny = 100;
+    adios2::DerivedVarType mode = GetParam();
+
+    std::default_random_engine generator;
+    std::uniform_real_distribution<float> distribution(1.0, 10.0);
+    std::vector<float> simArray1(Nx * Ny);
+    std::vector<float> simArray2(Nx * Ny);
+    std::vector<float> simArray3(Nx * Ny);
+    for (size_t i = 0; i < Nx * Ny; ++i)
+    {
+        simArray1[i] = distribution(generator);
+        simArray2[i] = distribution(generator);
+        simArray3[i] = distribution(generator);
+    }
+
+    adios2::ADIOS adios;
+    adios2::IO bpOut = adios.DeclareIO("BPWriteNestedExpr");
+    std::vector<std::string> varname = {"sim3/Ux", "sim3/Uy", "sim3/Uz"};
+    const std::string derNormName = "derived/normU";
+    const std::string derCombName = "derived/combU";
+
+    auto Ux = bpOut.DefineVariable<float>(varname[0], {Nx, Ny}, {0, 0}, {Nx, Ny});
+    auto Uy = bpOut.DefineVariable<float>(varname[1], {Nx, Ny}, {0, 0}, {Nx, Ny});
+    auto Uz = bpOut.DefineVariable<float>(varname[2], {Nx, Ny}, {0, 0}, {Nx, Ny});
+    // clang-format off
+    bpOut.DefineDerivedVariable(derNormName,
+                                "x =" + varname[0] + " \n"
+                                "y =" + varname[1] + " \n"
+                                "z =" + varname[2] + " \n"
+                                "sqrt((x*x) + (y*y) + (z*z))",
+                                mode);
+    bpOut.DefineDerivedVariable(derCombName,
+                                "x =" + varname[0] + " \n"
+                                "y =" + varname[1] + " \n"
+                                "z =" + varname[2] + " \n"
+                                "((x + y) * z) - (x * y)",
+                                mode);
+    // clang-format on
+    std::string filename = "ADIOS2BPWriteDerivedNested.bp";
+    adios2::Engine bpFileWriter = bpOut.Open(filename, adios2::Mode::Write);
+
+    bpFileWriter.BeginStep();
+    bpFileWriter.Put(Ux, simArray1.data());
+    bpFileWriter.Put(Uy, simArray2.data());
+    bpFileWriter.Put(Uz, simArray3.data());
+    bpFileWriter.EndStep();
+    bpFileWriter.Close();
+
+    adios2::IO bpIn = adios.DeclareIO("BPReadNestedExpr");
+    adios2::Engine bpFileReader = bpIn.Open(filename, adios2::Mode::Read);
+
+    std::vector<double> readNorm;
+    std::vector<float> readComb;
+    bpFileReader.BeginStep();
+    auto varNorm = bpIn.InquireVariable<double>(derNormName);
+    auto varComb = bpIn.InquireVariable<float>(derCombName);
+    bpFileReader.Get(varNorm, readNorm);
+    bpFileReader.Get(varComb, readComb);
+    bpFileReader.EndStep();
+    bpFileReader.Close();
+
+    ASSERT_EQ(readNorm.size(), Nx * Ny);
+    ASSERT_EQ(readComb.size(), Nx * Ny);
+    for (size_t i = 0; i < Nx * Ny; ++i)
+    {
+        const float x = simArray1[i], y = simArray2[i], z = simArray3[i];
+        // the norm is stored as double but the products and sums of the
+        // float inputs are computed in float
+        const double norm = std::sqrt(static_cast<double>(x) * x + static_cast<double>(y) * y +
+                                      static_cast<double>(z) * z);
+        EXPECT_NEAR(readNorm[i], norm, 1e-6 * norm);
+        EXPECT_FLOAT_EQ(readComb[i], ((x + y) * z) - (x * y));
+    }
+}
+
+TEST_P(DerivedCorrectnessP, SelectionCorrectnessTest)
+{
+    const size_t Nx = 20, Ny = 16, Nz = 12;
+    adios2::DerivedVarType mode = GetParam();
+
+    std::vector<float> simArray1(Nx * Ny * Nz);
+    std::vector<float> simArray2(Nx * Ny * Nz);
+    std::vector<float> simArray3(Nx * Ny * Nz);
+    for (size_t i = 0; i < Nx; ++i)
+    {
+        for (size_t j = 0; j < Ny; ++j)
+        {
+            for (size_t k = 0; k < Nz; ++k)
+            {
+                size_t idx = (i * Ny * Nz) + (j * Nz) + k;
+                float x = static_cast<float>(i);
+                float y = static_cast<float>(j);
+                float z = static_cast<float>(k);
+                simArray1[idx] = (6 * x * y) + powf(z, 2);
+                simArray2[idx] = (4 * x * z) + powf(y, 2);
+                simArray3[idx] = powf(x, 2) + (2 * y * z);
+            }
+        }
+    }
+
+    adios2::ADIOS adios;
+    adios2::IO bpOut = adios.DeclareIO("BPWriteSelectionExpr");
+    std::vector<std::string> varname = {"sim3/VX", "sim3/VY", "sim3/VZ"};
+    const std::string derCurlName = "derived/curlV";
+    const std::string derMagName = "derived/magV";
+
+    auto VX = bpOut.DefineVariable<float>(varname[0], {Nx, Ny, Nz}, {0, 0, 0}, {Nx, Ny, Nz});
+    auto VY = bpOut.DefineVariable<float>(varname[1], {Nx, Ny, Nz}, {0, 0, 0}, {Nx, Ny, Nz});
+    auto VZ = bpOut.DefineVariable<float>(varname[2], {Nx, Ny, Nz}, {0, 0, 0}, {Nx, Ny, Nz});
+    // clang-format off
+    bpOut.DefineDerivedVariable(derCurlName,
+                                "Vx =" + varname[0] + " \n"
+                                "Vy =" + varname[1] + " \n"
+                                "Vz =" + varname[2] + " \n"
+                                "curl(Vx,Vy,Vz)",
+                                mode);
+    bpOut.DefineDerivedVariable(derMagName,
+                                "Vx =" + varname[0] + " \n"
+                                "Vy =" + varname[1] + " \n"
+                                "Vz =" + varname[2] + " \n"
+                                "magnitude(Vx,Vy,Vz)",
+                                mode);
+    // clang-format on
+    std::string filename = "ADIOS2BPWriteDerivedSelection.bp";
+    adios2::Engine bpFileWriter = bpOut.Open(filename, adios2::Mode::Write);
+
+    bpFileWriter.BeginStep();
+    bpFileWriter.Put(VX, simArray1.data());
+    bpFileWriter.Put(VY, simArray2.data());
+    bpFileWriter.Put(VZ, simArray3.data());
+    bpFileWriter.EndStep();
+    bpFileWriter.Close();
+
+    adios2::IO bpIn = adios.DeclareIO("BPReadSelectionExpr");
+    adios2::Engine bpFileReader = bpIn.Open(filename, adios2::Mode::Read);
+
+    // an interior box, a box touching the block boundaries and a 2D slice
+    const std::vector<adios2::Box<adios2::Dims>> boxes = {
+        {{5, 4, 3}, {6, 5, 4}}, {{0, 10, 8}, {4, 6, 4}}, {{7, 0, 0}, {1, Ny, Nz}}};
+
+    std::vector<float> fullCurl;
+    std::vector<float> fullMag;
+    std::vector<std::vector<float>> boxCurl(boxes.size());
+    std::vector<std::vector<float>> boxMag(boxes.size());
+    bpFileReader.BeginStep();
+    auto varCurl = bpIn.InquireVariable<float>(derCurlName);
+    auto varMag = bpIn.InquireVariable<float>(derMagName);
+    bpFileReader.Get(varCurl, fullCurl, adios2::Mode::Sync);
+    bpFileReader.Get(varMag, fullMag, adios2::Mode::Sync);
+    for (size_t b = 0; b < boxes.size(); ++b)
+    {
+        adios2::Dims start = boxes[b].first;
+        adios2::Dims count = boxes[b].second;
+        varMag.SetSelection({start, count});
+        bpFileReader.Get(varMag, boxMag[b], adios2::Mode::Sync);
+        start.push_back(0);
+        count.push_back(3);
+        varCurl.SetSelection({start, count});
+        bpFileReader.Get(varCurl, boxCurl[b], adios2::Mode::Sync);
+    }
+    bpFileReader.EndStep();
+    bpFileReader.Close();
+
+    ASSERT_EQ(fullCurl.size(), 3 * Nx * Ny * Nz);
+    ASSERT_EQ(fullMag.size(), Nx * Ny * Nz);
+    for (size_t b = 0; b < boxes.size(); ++b)
+    {
+        const adios2::Dims &start = boxes[b].first;
+        const adios2::Dims &count = boxes[b].second;
+        ASSERT_EQ(boxMag[b].size(), count[0] * count[1] * count[2]);
+        ASSERT_EQ(boxCurl[b].size(), 3 * count[0] * count[1] * count[2]);
+        size_t pos = 0;
+        for (size_t i = start[0]; i < start[0] + count[0]; ++i)
+        {
+            for (size_t j = start[1]; j < start[1] + count[1]; ++j)
+            {
+                for (size_t k = start[2]; k < start[2] + count[2]; ++k)
+                {
+                    size_t idx = (i * Ny * Nz) + (j * Nz) + k;
+                    EXPECT_FLOAT_EQ(boxMag[b][pos], fullMag[idx]);
+                    for (size_t c = 0; c < 3; ++c)
+                    {
+                        EXPECT_FLOAT_EQ(boxCurl[b][3 * pos + c], fullCurl[3 * idx + c]);
+                    }
+                    ++pos;
+                }
+            }
+        }
+    }
+}
+
 INSTANTIATE_TEST_SUITE_P(DerivedCorrectness, DerivedCorrectnessP,
                          ::testing::Values(adios2::DerivedVarType::StatsOnly,
                                            adios2::DerivedVarType::ExpressionString,
@@ -0,0 +1,60 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ *
+ * The BP5 engines count events (profiling::EventID) into their profiling.json
+ * at Close().  Rank 0 writes one entry per rank: the writer into the output
+ * directory, the reader into /tmp/<file name>_<pid in hex>_profiling.json.
+ */
+#ifndef TESTING_ADIOS2_ENGINE_PROFILEDEVENTS_H_
+#define TESTING_ADIOS2_ENGINE_PROFILEDEVENTS_H_
+
+#include <cstdint>
+
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#ifdef _WIN32
+#include <process.h>
+#define getpid _getpid
+#else
+#include <unistd.h>
+#endif
+
+inline std::string WriterProfile(const std::string &filename)
+{
+    return filename + "/profiling.json";
+}
+
+/** the profile of a reader of filename closed by this process */
+inline std::string ReaderProfile(const std::string &filename)
+{
+    std::string base = filename;
+    const size_t slash = base.find_last_of("/\\");
+    if (slash != std::string::npos)
+    {
+        base = base.substr(slash + 1);
+    }
+    std::stringstream pid;
+    pid << std::hex << getpid();
+    return "/tmp/" + base + "_" + pid.str() + "_profiling.json";
+}
+
+/** an event counted over all ranks in a profile, 0 if never counted */
+inline uint64_t ProfiledEvents(const std::string &profile, const std::string &event)
+{
+    std::ifstream file(profile);
+    std::stringstream content;
+    content << file.rdbuf();
+    const std::string json = content.str();
+    const std::string key = "\"" + event + "\":";
+    uint64_t n = 0;
+    for (size_t pos = json.find(key); pos != std::string::npos; pos = json.find(key, pos + 1))
+    {
+        n += std::stoull(json.substr(pos + key.size()));
+    }
+    return n;
+}
+
+#endif /* TESTING_ADIOS2_ENGINE_PROFILEDEVENTS_H_ */
@@ -0,0 +1,152 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ *
+ * Test writing through a burst buffer and reading the drained output.
+ * The multi-threaded drainer without options is tested by the
+ * Utils.IOTest.BurstBuffer.*.BP5 pipelines.
+ */
+
+#include <cstdint>
+#include <cstring>
+
+#include <chrono>
+#include <iostream>
+#include <stdexcept>
+
+#include <adios2.h>
+
+#include <gtest/gtest.h>
+
+std::string engineName; // comes from command line
+constexpr std::size_t NSteps = 4;
+// larger than the 4MB chunks of the drainer
+constexpr std::size_t Nx = 600000;
+
+class BPBurstBufferTest : public ::testing::Test
+{
+public:
+    BPBurstBufferTest() = default;
+
+    static double Value(size_t step, size_t var, size_t x)
+    {
+        return static_cast<double>(step * 10000000 + var * 1000000 + x);
+    }
+
+    void Write(const std::string &filename, const adios2::Params &params)
+    {
+        // the drain threads are joined when the engine is destroyed
+        adios2::ADIOS adios;
+        adios2::IO ioWrite = adios.DeclareIO("TestIOWrite");
+        ioWrite.SetEngine(engineName);
+        ioWrite.SetParameters(params);
+        ioWrite.SetParameter("BurstBufferPath", "bb");
+        adios2::Engine engine = ioWrite.Open(filename, adios2::Mode::Write);
+        auto a = ioWrite.DefineVariable<double>("a", {Nx}, {0}, {Nx});
+        auto b = ioWrite.DefineVariable<double>("b", {Nx}, {0}, {Nx});
+        std::vector<double> dataA(Nx), dataB(Nx);
+        for (size_t step = 0; step < NSteps; ++step)
+        {
+            engine.BeginStep();
+            for (size_t x = 0; x < Nx; ++x)
+            {
+                dataA[x] = Value(step, 0, x);
+                dataB[x] = Value(step, 1, x);
+            }
+            engine.Put(a, dataA.data(), adios2::Mode::Sync);
+            engine.Put(b, dataB.data(), adios2::Mode::Sync);
+            // a new variable in the middle adds metametadata
+            if (step == NSteps / 2)
+            {
+                auto s = ioWrite.DefineVariable<int32_t>("s");
+                engine.Put(s, static_cast<int32_t>(step));
+            }
+            engine.EndStep();
+        }
+        engine.Close();
+    }
+
+    void ReadAndCheck(const std::string &filename)
+    {
+        adios2::ADIOS adios;
+        adios2::IO ioRead = adios.DeclareIO("TestIORead");
+        ioRead.SetEngine(engineName);
+        adios2::Engine reader = ioRead.Open(filename, adios2::Mode::Read);
+        EXPECT_TRUE(reader);
+
+        std::vector<double> inA(Nx), inB(Nx);
+        for (size_t step = 0; step < NSteps; ++step)
+        {
+            EXPECT_EQ(reader.BeginStep(), adios2::StepStatus::OK);
+            auto a = ioRead.InquireVariable<double>("a");
+            auto b = ioRead.InquireVariable<double>("b");
+            ASSERT_TRUE(a);
+            ASSERT_TRUE(b);
+            reader.Get(a, inA.data());
+            reader.Get(b, inB.data());
+            int32_t s = -1;
+            auto varS = ioRead.InquireVariable<int32_t>("s");
+            if (step == NSteps / 2)
+            {
+                ASSERT_TRUE(varS);
+                reader.Get(varS, s);
+            }
+            reader.EndStep();
+
+            for (size_t x = 0; x < Nx; ++x)
+            {
+                ASSERT_EQ(inA[x], Value(step, 0, x));
+                ASSERT_EQ(inB[x], Value(step, 1, x));
+            }
+            if (step == NSteps / 2)
+            {
+                EXPECT_EQ(s, static_cast<int32_t>(step));
+            }
+        }
+        EXPECT_EQ(reader.BeginStep(), adios2::StepStatus::EndOfStream);
+        reader.Close();
+    }
+};
+
+TEST_F(BPBurstBufferTest, SingleThread)
+{
+    const std::string filename = "BPBurstBuffer1.bp";
+    Write(filename, {{"BurstBufferDrainThreads", "1"}});
+    ReadAndCheck(filename);
+}
+
+TEST_F(BPBurstBufferTest, MultiThreadBandwidth)
+{
+    const std::string filename = "BPBurstBufferBW.bp";
+    const auto start = std::chrono::steady_clock::now();
+    Write(filename, {{"BurstBufferDrainThreads", "3"},
+                     {"BurstBufferDrainBandwidth", "100MB"},
+                     {"AggregationType", "EveryoneWrites"}});
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    // all threads together drain at most 100MB/s, allow for the last chunk
+    const double dataBytes = static_cast<double>(NSteps * 2 * Nx * sizeof(double));
+    EXPECT_GE(elapsed.count(), 0.5 * dataBytes / (100.0 * 1024 * 1024));
+    ReadAndCheck(filename);
+}
+
+TEST_F(BPBurstBufferTest, MultiThreadAsync)
+{
+    const std::string filename = "BPBurstBufferAsync.bp";
+    Write(filename, {{"BurstBufferDrainThreads", "2"}, {"AsyncWrite", "true"}});
+    ReadAndCheck(filename);
+}
+
+int main(int argc, char **argv)
+{
+    int result;
+    ::testing::InitGoogleTest(&argc, argv);
+
+    if (argc > 1)
+    {
+        engineName = std::string(argv[1]);
+    }
+
+    result = RUN_ALL_TESTS();
+
+    return result;
+}
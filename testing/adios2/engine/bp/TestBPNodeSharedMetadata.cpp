@@ -0,0 +1,223 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ *
+ * Test reading with the metadata shared by the ranks of a node, which is only
+ * used in ReadRandomAccess mode with MaxInstalledSteps.  The MetadataCopy
+ * event counts the ranks that hold a copy of the metadata.
+ */
+
+#include <cstdint>
+#include <cstring>
+
+#include <iostream>
+#include <stdexcept>
+
+#include <adios2.h>
+
+#include <gtest/gtest.h>
+
+#include "../ProfiledEvents.h"
+
+std::string engineName; // comes from command line
+constexpr std::size_t NSteps = 5;
+constexpr std::size_t Nx = 10;
+
+class BPNodeSharedMetadata : public ::testing::Test
+{
+public:
+    BPNodeSharedMetadata() = default;
+
+    int mpiRank = 0, mpiSize = 1;
+    int nNodes = 1;
+
+    void SetUp()
+    {
+#if ADIOS2_USE_MPI
+        MPI_Comm_rank(MPI_COMM_WORLD, &mpiRank);
+        MPI_Comm_size(MPI_COMM_WORLD, &mpiSize);
+        MPI_Comm nodeComm;
+        MPI_Comm_split_type(MPI_COMM_WORLD, MPI_COMM_TYPE_SHARED, 0, MPI_INFO_NULL, &nodeComm);
+        int nodeRank;
+        MPI_Comm_rank(nodeComm, &nodeRank);
+        int leader = (nodeRank == 0) ? 1 : 0;
+        MPI_Allreduce(&leader, &nNodes, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
+        MPI_Comm_free(&nodeComm);
+#endif
+    }
+
+    static double Value(size_t step, size_t x) { return static_cast<double>(step * 1000 + x); }
+
+    /* every rank writes a block of "a", a value of "s" and a per step
+     * attribute, "b" appears at step 2 */
+    void Write(adios2::ADIOS &adios, const std::string &filename)
+    {
+        adios2::IO io = adios.DeclareIO("TestIOWrite");
+        io.SetEngine(engineName);
+        adios2::Engine engine = io.Open(filename, adios2::Mode::Write);
+        const size_t rank = static_cast<size_t>(mpiRank);
+        auto a = io.DefineVariable<double>("a", {mpiSize * Nx}, {rank * Nx}, {Nx});
+        auto s = io.DefineVariable<int32_t>("s", {adios2::LocalValueDim});
+        adios2::Variable<double> b;
+        std::vector<double> data(Nx);
+        for (size_t step = 0; step < NSteps; ++step)
+        {
+            engine.BeginStep();
+            for (size_t x = 0; x < Nx; ++x)
+            {
+                data[x] = Value(step, rank * Nx + x);
+            }
+            engine.Put(a, data.data(), adios2::Mode::Sync);
+            engine.Put(s, static_cast<int32_t>(step * 100 + rank));
+            if (step == 2)
+            {
+                b = io.DefineVariable<double>("b", {mpiSize * Nx}, {rank * Nx}, {Nx});
+            }
+            if (step >= 2)
+            {
+                engine.Put(b, data.data(), adios2::Mode::Sync);
+            }
+            io.DefineAttribute<int32_t>("stepattr", static_cast<int32_t>(step), "", "/", true);
+            engine.EndStep();
+        }
+        engine.Close();
+    }
+
+    void CheckStep(size_t step, const std::vector<double> &in)
+    {
+        ASSERT_EQ(in.size(), mpiSize * Nx);
+        for (size_t x = 0; x < mpiSize * Nx; ++x)
+        {
+            ASSERT_EQ(in[x], Value(step, x));
+        }
+    }
+
+    void ReadStream(adios2::ADIOS &adios, const std::string &filename)
+    {
+        adios2::IO io = adios.DeclareIO("TestIOReadStream");
+        io.SetEngine(engineName);
+        io.SetParameter("NodeSharedMetadata", "true");
+        adios2::Engine reader = io.Open(filename, adios2::Mode::Read);
+        std::vector<double> in;
+        for (size_t step = 0; step < NSteps; ++step)
+        {
+            ASSERT_EQ(reader.BeginStep(), adios2::StepStatus::OK);
+            auto a = io.InquireVariable<double>("a");
+            auto s = io.InquireVariable<int32_t>("s");
+            ASSERT_TRUE(a);
+            ASSERT_TRUE(s);
+            EXPECT_EQ(a.Shape()[0], mpiSize * Nx);
+            EXPECT_EQ(s.Shape()[0], static_cast<size_t>(mpiSize));
+            reader.Get(a, in, adios2::Mode::Sync);
+            CheckStep(step, in);
+
+            std::vector<int32_t> values;
+            reader.Get(s, values, adios2::Mode::Sync);
+            ASSERT_EQ(values.size(), static_cast<size_t>(mpiSize));
+            EXPECT_EQ(values.back(), static_cast<int32_t>(step * 100 + mpiSize - 1));
+
+            auto b = io.InquireVariable<double>("b");
+            EXPECT_EQ(static_cast<bool>(b), step >= 2);
+            auto attr = io.InquireAttribute<int32_t>("stepattr");
+            ASSERT_TRUE(attr);
+            EXPECT_EQ(attr.Data()[0], static_cast<int32_t>(step));
+            reader.EndStep();
+        }
+        EXPECT_EQ(reader.BeginStep(), adios2::StepStatus::EndOfStream);
+        reader.Close();
+
+        // ignored in streaming mode, every rank holds its own copy
+        if (mpiRank == 0)
+        {
+            const uint64_t copies = ProfiledEvents(ReaderProfile(filename), "MetadataCopy");
+            EXPECT_GT(copies, 0u);
+            EXPECT_EQ(copies % static_cast<uint64_t>(mpiSize), 0u);
+        }
+    }
+
+    void ReadRandomAccess(adios2::ADIOS &adios, const std::string &filename)
+    {
+        adios2::IO io = adios.DeclareIO("TestIOReadRandomAccess");
+        io.SetEngine(engineName);
+        io.SetParameters({{"NodeSharedMetadata", "true"}, {"MaxInstalledSteps", "2"}});
+        adios2::Engine reader = io.Open(filename, adios2::Mode::ReadRandomAccess);
+        EXPECT_EQ(reader.Steps(), NSteps);
+        auto a = io.InquireVariable<double>("a");
+        auto b = io.InquireVariable<double>("b");
+        ASSERT_TRUE(a);
+        ASSERT_TRUE(b);
+        EXPECT_EQ(b.Steps(), NSteps - 2);
+
+        std::vector<double> in;
+        for (const size_t step : {4, 0, 3, 1, 4, 2})
+        {
+            EXPECT_EQ(reader.BlocksInfo(a, step).size(), static_cast<size_t>(mpiSize));
+            a.SetStepSelection({step, 1});
+            reader.Get(a, in, adios2::Mode::Sync);
+            CheckStep(step, in);
+            if (step >= 2)
+            {
+                b.SetStepSelection({step - 2, 1});
+                reader.Get(b, in, adios2::Mode::Sync);
+                CheckStep(step, in);
+            }
+        }
+        reader.Close();
+
+        // the metadata is read once, into one shared window per node
+        if (mpiRank == 0)
+        {
+            EXPECT_EQ(ProfiledEvents(ReaderProfile(filename), "MetadataCopy"),
+                      static_cast<uint64_t>(nNodes));
+        }
+    }
+};
+
+TEST_F(BPNodeSharedMetadata, Stream)
+{
+    const std::string filename = "BPNodeSharedMetadataStream.bp";
+#if ADIOS2_USE_MPI
+    adios2::ADIOS adios(MPI_COMM_WORLD);
+#else
+    adios2::ADIOS adios;
+#endif
+    Write(adios, filename);
+    ReadStream(adios, filename);
+}
+
+TEST_F(BPNodeSharedMetadata, RandomAccess)
+{
+    const std::string filename = "BPNodeSharedMetadataRA.bp";
+#if ADIOS2_USE_MPI
+    adios2::ADIOS adios(MPI_COMM_WORLD);
+#else
+    adios2::ADIOS adios;
+#endif
+    Write(adios, filename);
+    ReadRandomAccess(adios, filename);
+}
+
+int main(int argc, char **argv)
+{
+#if ADIOS2_USE_MPI
+    int provided;
+
+    // MPI_THREAD_MULTIPLE is only required if you enable the SST MPI_DP
+    MPI_Init_thread(nullptr, nullptr, MPI_THREAD_MULTIPLE, &provided);
+#endif
+
+    int result;
+    ::testing::InitGoogleTest(&argc, argv);
+
+    if (argc > 1)
+    {
+        engineName = std::string(argv[1]);
+    }
+    result = RUN_ALL_TESTS();
+
+#if ADIOS2_USE_MPI
+    MPI_Finalize();
+#endif
+
+    return result;
+}
@@ -0,0 +1,254 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ *
+ * Test reading metadata of many writers decoded by several threads, each
+ * decoding a range of writers.  A read with Threads=4 must give the same
+ * values as one with Threads=1.  Several ranges need several writers, so
+ * run with more than one MPI process.
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+#include <iostream>
+#include <stdexcept>
+
+#include <adios2.h>
+
+#include <gtest/gtest.h>
+
+#include "../ProfiledEvents.h"
+
+std::string engineName; // comes from command line
+constexpr std::size_t NSteps = 4;
+constexpr std::size_t Nx = 6;
+constexpr std::size_t Ny = 3;
+
+class BPParallelMetadata : public ::testing::Test
+{
+public:
+    BPParallelMetadata() = default;
+
+    int mpiRank = 0, mpiSize = 1;
+
+    void SetUp()
+    {
+#if ADIOS2_USE_MPI
+        MPI_Comm_rank(MPI_COMM_WORLD, &mpiRank);
+        MPI_Comm_size(MPI_COMM_WORLD, &mpiSize);
+#endif
+    }
+
+    static double Value(size_t step, size_t x) { return static_cast<double>(step * 1000 + x); }
+
+    /* every rank writes a block of the 2D array "a", rank + 1 rows of the
+     * joined array "j" and a value of "s".  Odd ranks write "o" on odd
+     * steps only, so the writers of a step have different formats */
+    void Write(adios2::ADIOS &adios, const std::string &filename)
+    {
+        adios2::IO io = adios.DeclareIO("TestIOWrite");
+        io.SetEngine(engineName);
+        adios2::Engine engine = io.Open(filename, adios2::Mode::Write);
+        const size_t rank = static_cast<size_t>(mpiRank);
+        auto a = io.DefineVariable<double>("a", {mpiSize * Nx, Ny}, {rank * Nx, 0}, {Nx, Ny});
+        auto j = io.DefineVariable<double>("j", {adios2::JoinedDim, Ny}, {}, {rank + 1, Ny});
+        auto s = io.DefineVariable<int32_t>("s", {adios2::LocalValueDim});
+        adios2::Variable<int32_t> o;
+        if (rank % 2)
+        {
+            o = io.DefineVariable<int32_t>("o", {adios2::LocalValueDim});
+        }
+        std::vector<double> data(Nx * Ny);
+        for (size_t step = 0; step < NSteps; ++step)
+        {
+            engine.BeginStep();
+            for (size_t x = 0; x < Nx * Ny; ++x)
+            {
+                data[x] = Value(step, rank * Nx * Ny + x);
+            }
+            engine.Put(a, data.data(), adios2::Mode::Sync);
+            std::vector<double> rows((rank + 1) * Ny, static_cast<double>(step * 100 + rank));
+            engine.Put(j, rows.data(), adios2::Mode::Sync);
+            engine.Put(s, static_cast<int32_t>(step * 100 + rank));
+            if ((rank % 2) && (step % 2))
+            {
+                engine.Put(o, static_cast<int32_t>(step));
+            }
+            engine.EndStep();
+        }
+        engine.Close();
+    }
+
+    /* checks the variables of a step and appends their values to dump */
+    void CheckStep(adios2::Engine &reader, adios2::IO &io, size_t step, std::vector<double> &dump)
+    {
+        const size_t size = static_cast<size_t>(mpiSize);
+        auto a = io.InquireVariable<double>("a");
+        auto j = io.InquireVariable<double>("j");
+        auto s = io.InquireVariable<int32_t>("s");
+        ASSERT_TRUE(a);
+        ASSERT_TRUE(j);
+        ASSERT_TRUE(s);
+        if (reader.OpenMode() == adios2::Mode::ReadRandomAccess)
+        {
+            a.SetStepSelection({step, 1});
+            j.SetStepSelection({step, 1});
+            s.SetStepSelection({step, 1});
+        }
+        EXPECT_EQ(a.Shape()[0], size * Nx);
+        EXPECT_EQ(a.Shape()[1], Ny);
+        const size_t rows = size * (size + 1) / 2;
+        ASSERT_EQ(j.Shape()[0], rows);
+
+        std::vector<double> in;
+        reader.Get(a, in, adios2::Mode::Sync);
+        ASSERT_EQ(in.size(), size * Nx * Ny);
+        for (size_t x = 0; x < size * Nx * Ny; ++x)
+        {
+            ASSERT_EQ(in[x], Value(step, x));
+        }
+        dump.insert(dump.end(), in.begin(), in.end());
+
+        // the rows of the joined array are in writer order
+        j.SetSelection({{0, 0}, {rows, Ny}});
+        reader.Get(j, in, adios2::Mode::Sync);
+        ASSERT_EQ(in.size(), rows * Ny);
+        size_t row = 0;
+        for (size_t rank = 0; rank < size; ++rank)
+        {
+            for (size_t r = 0; r <= rank; ++r, ++row)
+            {
+                ASSERT_EQ(in[row * Ny], static_cast<double>(step * 100 + rank));
+            }
+        }
+        dump.insert(dump.end(), in.begin(), in.end());
+
+        std::vector<int32_t> values;
+        reader.Get(s, values, adios2::Mode::Sync);
+        ASSERT_EQ(values.size(), size);
+        for (size_t rank = 0; rank < size; ++rank)
+        {
+            EXPECT_EQ(values[rank], static_cast<int32_t>(step * 100 + rank));
+        }
+        dump.insert(dump.end(), values.begin(), values.end());
+    }
+
+    /* dump gets the values of all variables of all steps */
+    void Read(adios2::ADIOS &adios, const std::string &filename, const adios2::Mode mode,
+              const std::string &threads, std::vector<double> &dump)
+    {
+        adios2::IO io = adios.DeclareIO("TestIORead" + threads + std::to_string(int(mode)));
+        io.SetEngine(engineName);
+        io.SetParameter("Threads", threads);
+        adios2::Engine reader = io.Open(filename, mode);
+        if (mode == adios2::Mode::ReadRandomAccess)
+        {
+            EXPECT_EQ(reader.Steps(), NSteps);
+            for (const size_t step : {3, 0, 2, 1})
+            {
+                CheckStep(reader, io, step, dump);
+            }
+            if (mpiSize > 1)
+            {
+                auto o = io.InquireVariable<int32_t>("o");
+                ASSERT_TRUE(o);
+                EXPECT_EQ(o.Steps(), NSteps / 2);
+            }
+        }
+        else
+        {
+            for (size_t step = 0; step < NSteps; ++step)
+            {
+                ASSERT_EQ(reader.BeginStep(), adios2::StepStatus::OK);
+                CheckStep(reader, io, step, dump);
+                if (mpiSize > 1)
+                {
+                    EXPECT_EQ(static_cast<bool>(io.InquireVariable<int32_t>("o")), step % 2 == 1);
+                }
+                reader.EndStep();
+            }
+            EXPECT_EQ(reader.BeginStep(), adios2::StepStatus::EndOfStream);
+        }
+        reader.Close();
+    }
+
+    /* every step of every rank is decoded in min(threads, writers) ranges */
+    void CheckDecodeRanges(const std::string &filename, const size_t threads)
+    {
+        if (mpiRank != 0)
+        {
+            return;
+        }
+        const size_t ranges = std::min(threads, static_cast<size_t>(mpiSize));
+        const uint64_t events = ProfiledEvents(ReaderProfile(filename), "MetadataDecodeRange");
+        if (ranges > 1)
+        {
+            EXPECT_GE(events, mpiSize * NSteps * ranges);
+        }
+        else
+        {
+            EXPECT_EQ(events, 0u);
+        }
+    }
+};
+
+TEST_F(BPParallelMetadata, Stream)
+{
+    const std::string filename = "BPParallelMetadataStream.bp";
+#if ADIOS2_USE_MPI
+    adios2::ADIOS adios(MPI_COMM_WORLD);
+#else
+    adios2::ADIOS adios;
+#endif
+    Write(adios, filename);
+    std::vector<double> serial, parallel;
+    Read(adios, filename, adios2::Mode::Read, "1", serial);
+    CheckDecodeRanges(filename, 1);
+    Read(adios, filename, adios2::Mode::Read, "4", parallel);
+    CheckDecodeRanges(filename, 4);
+    EXPECT_EQ(parallel, serial);
+}
+
+TEST_F(BPParallelMetadata, RandomAccess)
+{
+    const std::string filename = "BPParallelMetadataRA.bp";
+#if ADIOS2_USE_MPI
+    adios2::ADIOS adios(MPI_COMM_WORLD);
+#else
+    adios2::ADIOS adios;
+#endif
+    Write(adios, filename);
+    std::vector<double> serial, parallel;
+    Read(adios, filename, adios2::Mode::ReadRandomAccess, "1", serial);
+    CheckDecodeRanges(filename, 1);
+    Read(adios, filename, adios2::Mode::ReadRandomAccess, "4", parallel);
+    CheckDecodeRanges(filename, 4);
+    EXPECT_EQ(parallel, serial);
+}
+
+int main(int argc, char **argv)
+{
+#if ADIOS2_USE_MPI
+    int provided;
+
+    // MPI_THREAD_MULTIPLE is only required if you enable the SST MPI_DP
+    MPI_Init_thread(nullptr, nullptr, MPI_THREAD_MULTIPLE, &provided);
+#endif
+
+    int result;
+    ::testing::InitGoogleTest(&argc, argv);
+
+    if (argc > 1)
+    {
+        engineName = std::string(argv[1]);
+    }
+    result = RUN_ALL_TESTS();
+
+#if ADIOS2_USE_MPI
+    MPI_Finalize();
+#endif
+
+    return result;
+}
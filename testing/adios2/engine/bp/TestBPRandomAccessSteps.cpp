@@ -0,0 +1,193 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ *
+ * Test reading steps in random order in ReadRandomAccess mode, where the
+ * metadata of a step is installed when it is first used, and released
+ * again beyond MaxInstalledSteps
+ */
+
+#include <cstdint>
+#include <cstring>
+
+#include <iostream>
+#include <stdexcept>
+
+#include <adios2.h>
+
+#include <gtest/gtest.h>
+
+#include "../ProfiledEvents.h"
+
+std::string engineName; // comes from command line
+constexpr std::size_t NSteps = 10;
+constexpr std::size_t Nx = 8;
+
+class BPRandomAccessSteps : public ::testing::Test
+{
+public:
+    BPRandomAccessSteps() = default;
+
+    static double Value(size_t step, size_t x) { return static_cast<double>(step * 100 + x); }
+
+    /* "a" is written on every step in two blocks, "b" on odd steps only,
+     * "c" from step 5 on and "j" is a joined array growing every step */
+    void CreateOutput(const std::string &filename)
+    {
+        adios2::ADIOS adios;
+        adios2::IO io = adios.DeclareIO("TestIOWrite");
+        io.SetEngine(engineName);
+        adios2::Engine engine = io.Open(filename, adios2::Mode::Write);
+        auto a = io.DefineVariable<double>("a", {2 * Nx}, {0}, {Nx});
+        auto b = io.DefineVariable<int32_t>("b");
+        auto j = io.DefineVariable<double>("j", {adios2::JoinedDim}, {}, {1});
+        adios2::Variable<double> c;
+        std::vector<double> data(2 * Nx);
+        for (size_t step = 0; step < NSteps; ++step)
+        {
+            engine.BeginStep();
+            for (size_t x = 0; x < 2 * Nx; ++x)
+            {
+                data[x] = Value(step, x);
+            }
+            a.SetSelection({{0}, {Nx}});
+            engine.Put(a, data.data(), adios2::Mode::Sync);
+            a.SetSelection({{Nx}, {Nx}});
+            engine.Put(a, data.data() + Nx, adios2::Mode::Sync);
+            if (step % 2)
+            {
+                engine.Put(b, static_cast<int32_t>(step));
+            }
+            if (step == 5)
+            {
+                c = io.DefineVariable<double>("c", {Nx}, {0}, {Nx});
+            }
+            if (step >= 5)
+            {
+                engine.Put(c, data.data(), adios2::Mode::Sync);
+            }
+            for (size_t block = 0; block <= step; ++block)
+            {
+                j.SetSelection({{}, {1}});
+                engine.Put(j, data[block], adios2::Mode::Sync);
+            }
+            engine.EndStep();
+        }
+        engine.Close();
+    }
+
+    void ReadAndCheck(const std::string &filename, const adios2::Params &params)
+    {
+        adios2::ADIOS adios;
+        adios2::IO io = adios.DeclareIO("TestIORead");
+        io.SetEngine(engineName);
+        io.SetParameters(params);
+        adios2::Engine reader = io.Open(filename, adios2::Mode::ReadRandomAccess);
+        EXPECT_EQ(reader.Steps(), NSteps);
+
+        auto a = io.InquireVariable<double>("a");
+        auto b = io.InquireVariable<int32_t>("b");
+        auto c = io.InquireVariable<double>("c");
+        auto j = io.InquireVariable<double>("j");
+        ASSERT_TRUE(a);
+        ASSERT_TRUE(b);
+        ASSERT_TRUE(c);
+        ASSERT_TRUE(j);
+        EXPECT_EQ(a.Steps(), NSteps);
+        EXPECT_EQ(b.Steps(), NSteps / 2);
+        EXPECT_EQ(c.Steps(), NSteps - 5);
+        EXPECT_EQ(j.Steps(), NSteps);
+
+        // visit the steps out of order, more than once
+        const std::vector<size_t> steps = {7, 2, 9, 0, 7, 5, 3, 2, 8, 1, 6, 4, 9};
+        std::vector<double> in;
+        for (const size_t step : steps)
+        {
+            auto blocks = reader.BlocksInfo(a, step);
+            ASSERT_EQ(blocks.size(), 2U);
+            EXPECT_EQ(blocks[1].Start[0], Nx);
+            a.SetStepSelection({step, 1});
+            reader.Get(a, in, adios2::Mode::Sync);
+            ASSERT_EQ(in.size(), 2 * Nx);
+            for (size_t x = 0; x < 2 * Nx; ++x)
+            {
+                ASSERT_EQ(in[x], Value(step, x));
+            }
+
+            j.SetStepSelection({step, 1});
+            EXPECT_EQ(j.Shape()[0], step + 1);
+            j.SetSelection({{0}, {step + 1}});
+            reader.Get(j, in, adios2::Mode::Sync);
+            ASSERT_EQ(in.size(), step + 1);
+            for (size_t x = 0; x <= step; ++x)
+            {
+                ASSERT_EQ(in[x], Value(step, x));
+            }
+            EXPECT_EQ(reader.BlocksInfo(j, step).size(), step + 1);
+
+            if (step % 2)
+            {
+                int32_t value = -1;
+                b.SetStepSelection({step / 2, 1});
+                reader.Get(b, value, adios2::Mode::Sync);
+                EXPECT_EQ(value, static_cast<int32_t>(step));
+            }
+            if (step >= 5)
+            {
+                c.SetStepSelection({step - 5, 1});
+                reader.Get(c, in, adios2::Mode::Sync);
+                ASSERT_EQ(in.size(), Nx);
+                EXPECT_EQ(in[Nx - 1], Value(step, Nx - 1));
+            }
+        }
+
+        // all steps in one Get
+        a.SetStepSelection({0, NSteps});
+        reader.Get(a, in, adios2::Mode::Sync);
+        ASSERT_EQ(in.size(), NSteps * 2 * Nx);
+        for (size_t step = 0; step < NSteps; ++step)
+        {
+            ASSERT_EQ(in[step * 2 * Nx], Value(step, 0));
+        }
+        reader.Close();
+    }
+};
+
+TEST_F(BPRandomAccessSteps, AllStepsKept)
+{
+    const std::string filename = "BPRandomAccessSteps.bp";
+    CreateOutput(filename);
+    ReadAndCheck(filename, {});
+
+    // every step is installed once and kept
+    const std::string profile = ReaderProfile(filename);
+    EXPECT_EQ(ProfiledEvents(profile, "MetadataStepInstall"), NSteps);
+    EXPECT_EQ(ProfiledEvents(profile, "MetadataStepRelease"), 0U);
+}
+
+TEST_F(BPRandomAccessSteps, MaxInstalledSteps)
+{
+    const std::string filename = "BPRandomAccessStepsMax.bp";
+    CreateOutput(filename);
+    ReadAndCheck(filename, {{"MaxInstalledSteps", "2"}});
+
+    // steps visited again after being released are installed again
+    const std::string profile = ReaderProfile(filename);
+    EXPECT_GT(ProfiledEvents(profile, "MetadataStepRelease"), 0U);
+    EXPECT_GT(ProfiledEvents(profile, "MetadataStepInstall"), NSteps);
+}
+
+int main(int argc, char **argv)
+{
+    int result;
+    ::testing::InitGoogleTest(&argc, argv);
+
+    if (argc > 1)
+    {
+        engineName = std::string(argv[1]);
+    }
+
+    result = RUN_ALL_TESTS();
+
+    return result;
+}
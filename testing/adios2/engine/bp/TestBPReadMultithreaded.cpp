@@ -117,6 +117,79 @@ public:
         else
             FileOutputWritten = true;
     }
+
+    // 2D array for the selection tests, written as blocks of full rows
+    // ("rows") and as 2x2 tiles ("tiles")
+    static constexpr size_t Ny2D = 12;
+    static constexpr size_t Nx2D = 16;
+    static constexpr size_t NSteps2D = 3;
+
+    static int32_t Value2D(size_t step, size_t y, size_t x)
+    {
+        return static_cast<int32_t>(step * 1000 + y * Nx2D + x);
+    }
+
+    // each test writes its own file, ctest runs them in parallel
+    std::string CreateOutput2D(const std::string &name)
+    {
+        const std::string filename = "BPReadMultithreaded2D" + name + ".bp";
+        adios2::ADIOS adios;
+        adios2::IO ioWrite = adios.DeclareIO("TestIOWrite2D");
+        ioWrite.SetEngine(engineName);
+        adios2::Engine engine = ioWrite.Open(filename, adios2::Mode::Write);
+        auto vRows = ioWrite.DefineVariable<int32_t>("rows", {Ny2D, Nx2D}, {0, 0}, {Ny2D, Nx2D});
+        auto vTiles =
+            ioWrite.DefineVariable<int32_t>("tiles", {Ny2D, Nx2D}, {0, 0}, {Ny2D, Nx2D});
+        for (size_t step = 0; step < NSteps2D; ++step)
+        {
+            engine.BeginStep();
+            const size_t rowsPerBlock = Ny2D / 4;
+            for (size_t y0 = 0; y0 < Ny2D; y0 += rowsPerBlock)
+            {
+                std::vector<int32_t> block(rowsPerBlock * Nx2D);
+                for (size_t y = 0; y < rowsPerBlock; ++y)
+                    for (size_t x = 0; x < Nx2D; ++x)
+                        block[y * Nx2D + x] = Value2D(step, y0 + y, x);
+                vRows.SetSelection({{y0, 0}, {rowsPerBlock, Nx2D}});
+                engine.Put(vRows, block.data(), adios2::Mode::Sync);
+            }
+            const size_t ty = Ny2D / 2, tx = Nx2D / 2;
+            for (size_t y0 = 0; y0 < Ny2D; y0 += ty)
+            {
+                for (size_t x0 = 0; x0 < Nx2D; x0 += tx)
+                {
+                    std::vector<int32_t> block(ty * tx);
+                    for (size_t y = 0; y < ty; ++y)
+                        for (size_t x = 0; x < tx; ++x)
+                            block[y * tx + x] = Value2D(step, y0 + y, x0 + x);
+                    vTiles.SetSelection({{y0, x0}, {ty, tx}});
+                    engine.Put(vTiles, block.data(), adios2::Mode::Sync);
+                }
+            }
+            engine.EndStep();
+        }
+        engine.Close();
+        return filename;
+    }
+
+    // read a box of a variable in every step and check each element
+    void ReadAndCheckBox2D(adios2::Engine &reader, adios2::IO &io, const std::string &varName,
+                           const adios2::Dims &start, const adios2::Dims &count)
+    {
+        adios2::Variable<int32_t> var = io.InquireVariable<int32_t>(varName);
+        ASSERT_TRUE(var);
+        var.SetSelection({start, count});
+        var.SetStepSelection({0, NSteps2D});
+        std::vector<int32_t> data;
+        reader.Get(var, data, adios2::Mode::Sync);
+        ASSERT_EQ(data.size(), NSteps2D * count[0] * count[1]);
+        size_t i = 0;
+        for (size_t step = 0; step < NSteps2D; ++step)
+            for (size_t y = start[0]; y < start[0] + count[0]; ++y)
+                for (size_t x = start[1]; x < start[1] + count[1]; ++x, ++i)
+                    ASSERT_EQ(data[i], Value2D(step, y, x))
+                        << varName << " step " << step << " y " << y << " x " << x;
+    }
 };
 
 class BPReadMultithreadedTestP : public BPReadMultithreadedTest,
@@ -264,6 +337,162 @@ TEST_P(BPReadMultithreadedTestP, ReadStream)
 #endif
 }
 
+TEST_P(BPReadMultithreadedTestP, ReadSubBox)
+{
+    // sub-boxes of uncompressed blocks are read as their contiguous runs,
+    // one vectored read per run without gap merging, merged with it
+    const std::string filename = CreateOutput2D("ReadSubBox");
+    for (const std::string gapSize : {"0", "64KB"})
+    {
+        adios2::ADIOS adios;
+        adios2::IO ioRead = adios.DeclareIO("TestIORead");
+        ioRead.SetEngine(engineName);
+        ioRead.SetParameter("Threads", std::to_string(GetThreads()));
+        ioRead.SetParameter("StridedReadGapSize", gapSize);
+        adios2::Engine reader = ioRead.Open(filename, adios2::Mode::ReadRandomAccess);
+        // inside one block of each variable
+        ReadAndCheckBox2D(reader, ioRead, "rows", {4, 3}, {2, 5});
+        ReadAndCheckBox2D(reader, ioRead, "tiles", {1, 1}, {4, 6});
+        // across all blocks
+        ReadAndCheckBox2D(reader, ioRead, "rows", {1, 3}, {10, 10});
+        ReadAndCheckBox2D(reader, ioRead, "tiles", {1, 3}, {10, 10});
+        reader.Close();
+    }
+}
+
+TEST_P(BPReadMultithreadedTestP, ReadSubBox3D)
+{
+    // a box across the two 4x6x8 halves of a 4x6x16 array spans whole
+    // block rows but only half of each selection row: its runs are read
+    // packed, one per plane of the block, and copied out, while a box
+    // inside one block is scattered into the application buffer
+    const size_t Nz = 4, Ny = 6, Nx = 16, Bx = Nx / 2;
+    auto lf_Value = [&](size_t step, size_t z, size_t y, size_t x) {
+        return static_cast<int32_t>(step * 1000 + (z * Ny + y) * Nx + x);
+    };
+    const std::string filename = "BPReadMultithreaded3DReadSubBox.bp";
+    {
+        adios2::ADIOS adios;
+        adios2::IO ioWrite = adios.DeclareIO("TestIOWrite3D");
+        ioWrite.SetEngine(engineName);
+        adios2::Engine engine = ioWrite.Open(filename, adios2::Mode::Write);
+        auto var = ioWrite.DefineVariable<int32_t>("cube", {Nz, Ny, Nx}, {0, 0, 0}, {Nz, Ny, Bx});
+        std::vector<int32_t> block(Nz * Ny * Bx);
+        for (size_t step = 0; step < NSteps2D; ++step)
+        {
+            engine.BeginStep();
+            for (size_t x0 = 0; x0 < Nx; x0 += Bx)
+            {
+                size_t i = 0;
+                for (size_t z = 0; z < Nz; ++z)
+                    for (size_t y = 0; y < Ny; ++y)
+                        for (size_t x = 0; x < Bx; ++x, ++i)
+                            block[i] = lf_Value(step, z, y, x0 + x);
+                var.SetSelection({{0, 0, x0}, {Nz, Ny, Bx}});
+                engine.Put(var, block.data(), adios2::Mode::Sync);
+            }
+            engine.EndStep();
+        }
+        engine.Close();
+    }
+
+    for (const std::string gapSize : {"0", "64KB"})
+    {
+        adios2::ADIOS adios;
+        adios2::IO ioRead = adios.DeclareIO("TestIORead");
+        ioRead.SetEngine(engineName);
+        ioRead.SetParameter("Threads", std::to_string(GetThreads()));
+        ioRead.SetParameter("StridedReadGapSize", gapSize);
+        adios2::Engine reader = ioRead.Open(filename, adios2::Mode::ReadRandomAccess);
+        adios2::Variable<int32_t> var = ioRead.InquireVariable<int32_t>("cube");
+        ASSERT_TRUE(var);
+        var.SetStepSelection({0, NSteps2D});
+        for (const adios2::Box<adios2::Dims> &box :
+             {adios2::Box<adios2::Dims>({1, 2, 0}, {2, 3, Nx}),
+              adios2::Box<adios2::Dims>({1, 1, 2}, {2, 3, 4})})
+        {
+            const adios2::Dims &start = box.first;
+            const adios2::Dims &count = box.second;
+            var.SetSelection(box);
+            std::vector<int32_t> data;
+            reader.Get(var, data, adios2::Mode::Sync);
+            ASSERT_EQ(data.size(), NSteps2D * count[0] * count[1] * count[2]);
+            size_t i = 0;
+            for (size_t step = 0; step < NSteps2D; ++step)
+                for (size_t z = start[0]; z < start[0] + count[0]; ++z)
+                    for (size_t y = start[1]; y < start[1] + count[1]; ++y)
+                        for (size_t x = start[2]; x < start[2] + count[2]; ++x, ++i)
+                            ASSERT_EQ(data[i], lf_Value(step, z, y, x))
+                                << "step " << step << " z " << z << " y " << y << " x " << x;
+        }
+        reader.Close();
+    }
+}
+
+TEST_P(BPReadMultithreadedTestP, ReadSlabsAndColumns)
+{
+    // full-row slabs and single rows are contiguous in block and selection
+    // and go straight to the application buffer, a column is scattered there
+    const std::string filename = CreateOutput2D("ReadSlabsAndColumns");
+    adios2::ADIOS adios;
+    adios2::IO ioRead = adios.DeclareIO("TestIORead");
+    ioRead.SetEngine(engineName);
+    ioRead.SetParameter("Threads", std::to_string(GetThreads()));
+    adios2::Engine reader = ioRead.Open(filename, adios2::Mode::ReadRandomAccess);
+    ReadAndCheckBox2D(reader, ioRead, "rows", {2, 0}, {8, Nx2D});
+    ReadAndCheckBox2D(reader, ioRead, "rows", {0, 0}, {Ny2D, Nx2D});
+    ReadAndCheckBox2D(reader, ioRead, "tiles", {7, 0}, {1, Nx2D});
+    ReadAndCheckBox2D(reader, ioRead, "tiles", {7, 2}, {1, 4});
+    ReadAndCheckBox2D(reader, ioRead, "rows", {0, 5}, {Ny2D, 1});
+    ReadAndCheckBox2D(reader, ioRead, "tiles", {0, 9}, {Ny2D, 1});
+    reader.Close();
+}
+
+TEST_P(BPReadMultithreadedTestP, ReadUnitsOfOneSubfile)
+{
+    // without coalescing every block of every step is a read unit of its
+    // own; with a single subfile they all start in the first thread's
+    // share and the other threads take theirs from it
+    const std::string filename = CreateOutput2D("ReadUnitsOfOneSubfile");
+    adios2::ADIOS adios;
+    adios2::IO ioRead = adios.DeclareIO("TestIORead");
+    ioRead.SetEngine(engineName);
+    ioRead.SetParameter("Threads", std::to_string(GetThreads()));
+    ioRead.SetParameter("ReadCoalesceMaxSize", "0");
+    adios2::Engine reader = ioRead.Open(filename, adios2::Mode::ReadRandomAccess);
+    adios2::Variable<int32_t> vRows = ioRead.InquireVariable<int32_t>("rows");
+    adios2::Variable<int32_t> vTiles = ioRead.InquireVariable<int32_t>("tiles");
+    ASSERT_TRUE(vRows);
+    ASSERT_TRUE(vTiles);
+    vRows.SetStepSelection({0, NSteps2D});
+    vTiles.SetStepSelection({0, NSteps2D});
+    std::vector<int32_t> rows, tiles, box;
+    reader.Get(vRows, rows, adios2::Mode::Deferred);
+    reader.Get(vTiles, tiles, adios2::Mode::Deferred);
+    reader.PerformGets();
+    vTiles.SetSelection({{1, 3}, {10, 10}});
+    reader.Get(vTiles, box, adios2::Mode::Deferred);
+    reader.PerformGets();
+
+    ASSERT_EQ(rows.size(), NSteps2D * Ny2D * Nx2D);
+    ASSERT_EQ(tiles.size(), NSteps2D * Ny2D * Nx2D);
+    size_t i = 0;
+    for (size_t step = 0; step < NSteps2D; ++step)
+        for (size_t y = 0; y < Ny2D; ++y)
+            for (size_t x = 0; x < Nx2D; ++x, ++i)
+            {
+                ASSERT_EQ(rows[i], Value2D(step, y, x));
+                ASSERT_EQ(tiles[i], Value2D(step, y, x));
+            }
+    ASSERT_EQ(box.size(), NSteps2D * 10 * 10);
+    i = 0;
+    for (size_t step = 0; step < NSteps2D; ++step)
+        for (size_t y = 1; y < 11; ++y)
+            for (size_t x = 3; x < 13; ++x, ++i)
+                ASSERT_EQ(box[i], Value2D(step, y, x));
+    reader.Close();
+}
+
 INSTANTIATE_TEST_SUITE_P(BPReadMultithreadedTest, BPReadMultithreadedTestP,
                          ::testing::Values(1, 2, 3, 0));
 
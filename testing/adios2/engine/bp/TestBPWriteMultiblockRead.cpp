@@ -1383,6 +1383,130 @@ TEST_F(BPWriteMultiblockReadTest, ADIOS2BPWriteRead1D8ZeroBlock)
     }
 }
 
+//******************************************************************************
+// 2D many blocks, enough for the reader to index the blocks of a step
+//******************************************************************************
+
+TEST_F(BPWriteMultiblockReadTest, ADIOS2BPWriteMultiblockRead2DManyBlocks)
+{
+    // Each process writes an 8x10 grid of 4x4 blocks, forming a 2D
+    // (numberOfProcess*32) x 40 matrix with 80 blocks per process
+
+    int mpiRank = 0, mpiSize = 1;
+    const size_t B = 4;
+    const size_t BlocksY = 8;
+    const size_t BlocksX = 10;
+    const size_t NSteps = 3;
+
+#if ADIOS2_USE_MPI
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpiRank);
+    MPI_Comm_size(MPI_COMM_WORLD, &mpiSize);
+    const std::string fname("ADIOS2BPWriteMultiblockRead2DManyBlocks_MPI.bp");
+#else
+    const std::string fname("ADIOS2BPWriteMultiblockRead2DManyBlocks.bp");
+#endif
+
+    const size_t Ny = BlocksY * B * static_cast<size_t>(mpiSize);
+    const size_t Nx = BlocksX * B;
+    auto lf_Value = [](size_t step, size_t y, size_t x) {
+        return static_cast<double>(step * 1000000 + y * 1000 + x);
+    };
+
+#if ADIOS2_USE_MPI
+    adios2::ADIOS adios(MPI_COMM_WORLD);
+#else
+    adios2::ADIOS adios;
+#endif
+    {
+        adios2::IO io = adios.DeclareIO("TestIO");
+        if (!engineName.empty())
+        {
+            io.SetEngine(engineName);
+        }
+        auto var = io.DefineVariable<double>("r64", {Ny, Nx}, {0, 0}, {B, B});
+        adios2::Engine bpWriter = io.Open(fname, adios2::Mode::Write);
+
+        std::vector<double> block(B * B);
+        for (size_t step = 0; step < NSteps; ++step)
+        {
+            bpWriter.BeginStep();
+            for (size_t by = 0; by < BlocksY; ++by)
+            {
+                for (size_t bx = 0; bx < BlocksX; ++bx)
+                {
+                    const size_t y0 = (mpiRank * BlocksY + by) * B;
+                    const size_t x0 = bx * B;
+                    for (size_t i = 0; i < B * B; ++i)
+                    {
+                        block[i] = lf_Value(step, y0 + i / B, x0 + i % B);
+                    }
+                    var.SetSelection({{y0, x0}, {B, B}});
+                    bpWriter.Put(var, block.data(), adios2::Mode::Sync);
+                }
+            }
+            bpWriter.EndStep();
+        }
+        bpWriter.Close();
+    }
+
+    // boxes across block boundaries, each read more than once per step
+    const std::vector<adios2::Box<adios2::Dims>> boxes = {
+        {{3, 5}, {6, 9}}, {{0, 0}, {Ny, Nx}}, {{Ny - 5, Nx - 7}, {5, 7}}, {{3, 5}, {6, 9}}};
+
+    auto lf_Check = [&](adios2::Variable<double> &var, adios2::Engine &bpReader, size_t step) {
+        std::vector<double> data;
+        for (const auto &box : boxes)
+        {
+            var.SetSelection(box);
+            bpReader.Get(var, data, adios2::Mode::Sync);
+            ASSERT_EQ(data.size(), box.second[0] * box.second[1]);
+            for (size_t i = 0; i < data.size(); ++i)
+            {
+                const size_t y = box.first[0] + i / box.second[1];
+                const size_t x = box.first[1] + i % box.second[1];
+                ASSERT_EQ(data[i], lf_Value(step, y, x))
+                    << "step " << step << " y " << y << " x " << x << " rank " << mpiRank;
+            }
+        }
+    };
+
+    {
+        adios2::IO io = adios.DeclareIO("ReadIO");
+        if (!engineName.empty())
+        {
+            io.SetEngine(engineName);
+        }
+        adios2::Engine bpReader = io.Open(fname, adios2::Mode::Read);
+        for (size_t step = 0; step < NSteps; ++step)
+        {
+            ASSERT_EQ(bpReader.BeginStep(), adios2::StepStatus::OK);
+            auto var = io.InquireVariable<double>("r64");
+            ASSERT_TRUE(var);
+            lf_Check(var, bpReader, step);
+            bpReader.EndStep();
+        }
+        bpReader.Close();
+    }
+
+    {
+        adios2::IO io = adios.DeclareIO("ReadRandomAccessIO");
+        if (!engineName.empty())
+        {
+            io.SetEngine(engineName);
+        }
+        adios2::Engine bpReader = io.Open(fname, adios2::Mode::ReadRandomAccess);
+        auto var = io.InquireVariable<double>("r64");
+        ASSERT_TRUE(var);
+        ASSERT_EQ(var.Steps(), NSteps);
+        for (size_t step = 0; step < NSteps; ++step)
+        {
+            var.SetStepSelection({step, 1});
+            lf_Check(var, bpReader, step);
+        }
+        bpReader.Close();
+    }
+}
+
 int main(int argc, char **argv)
 {
 #if ADIOS2_USE_MPI
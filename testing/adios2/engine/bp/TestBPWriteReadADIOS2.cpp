@@ -3,8 +3,10 @@
  * accompanying file Copyright.txt for details.
  */
 #include <cstdint>
+#include <cstdlib>
 #include <cstring>
 
+#include <algorithm>
 #include <iostream>
 #include <numeric> //std::iota
 #include <stdexcept>
@@ -13,6 +15,7 @@
 
 #include <gtest/gtest.h>
 
+#include "../ProfiledEvents.h"
 #include "../SmallTestData.h"
 
 std::string engineName;       // comes from command line
@@ -2112,6 +2115,190 @@ TEST_F(BPWriteReadTestADIOS2, GetDeferredInClose)
     }
 }
 
+TEST_F(BPWriteReadTestADIOS2, ReadCompressibleData)
+{
+    // Data that compresses well, remote Get responses asked for with
+    // RemoteCompression have to arrive compressed
+
+    int mpiRank = 0, mpiSize = 1;
+
+    const std::size_t Nx = 100000;
+
+#if ADIOS2_USE_MPI
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpiRank);
+    MPI_Comm_size(MPI_COMM_WORLD, &mpiSize);
+    const std::string fname("ReadCompressibleData_MPI.bp");
+#else
+    const std::string fname("ReadCompressibleData.bp");
+#endif
+
+    std::vector<int64_t> localData(Nx);
+    for (size_t i = 0; i < Nx; ++i)
+    {
+        localData[i] = static_cast<int64_t>((mpiRank * Nx + i) / 1000);
+    }
+
+#if ADIOS2_USE_MPI
+    adios2::ADIOS adios(MPI_COMM_WORLD);
+#else
+    adios2::ADIOS adios;
+#endif
+    {
+        adios2::IO io = adios.DeclareIO("CompressibleWrite");
+        if (!engineName.empty())
+        {
+            io.SetEngine(engineName);
+        }
+        if (!engineParameters.empty())
+        {
+            io.SetParameters(engineParameters);
+        }
+
+        io.DefineVariable<int64_t>("steps", {static_cast<std::size_t>(Nx * mpiSize)},
+                                   {static_cast<std::size_t>(Nx * mpiRank)}, {Nx});
+
+        adios2::Engine bpWriter = io.Open(fname, adios2::Mode::Write);
+
+        bpWriter.Put<int64_t>("steps", localData.data());
+        bpWriter.Close();
+    }
+    // Reader
+    {
+        adios2::IO io = adios.DeclareIO("CompressibleRead");
+        if (!engineName.empty())
+        {
+            io.SetEngine(engineName);
+        }
+        if (!engineParameters.empty())
+        {
+            io.SetParameters(engineParameters);
+        }
+
+        adios2::Engine bpReader = io.Open(fname, adios2::Mode::ReadRandomAccess);
+        adios2::Variable<int64_t> varSteps = io.InquireVariable<int64_t>("steps");
+        ASSERT_TRUE(varSteps);
+
+        std::vector<int64_t> readData(Nx);
+        varSteps.SetSelection({{static_cast<std::size_t>(Nx * mpiRank)}, {Nx}});
+        bpReader.Get(varSteps, readData, adios2::Mode::Sync);
+        bpReader.Close();
+
+        for (size_t j = 0; j < Nx; ++j)
+        {
+            ASSERT_EQ(localData[j], readData[j]) << "element " << j;
+        }
+    }
+
+    if (getenv("DoRemote") && (engineParameters.find("RemoteCompression") != std::string::npos) &&
+        (mpiRank == 0))
+    {
+        EXPECT_GT(ProfiledEvents(ReaderProfile(fname), "RemoteCompressedGet"), 0u);
+    }
+}
+
+TEST_F(BPWriteReadTestADIOS2, DeferredPutMinMax)
+{
+    // Min/Max of blocks too large to be copied at Put(): copied by
+    // PerformPuts() in the first step, added as they are at EndStep() in
+    // the second
+
+    int mpiRank = 0, mpiSize = 1;
+
+    // 4.8 MB, more than the default MinDeferredSize
+    const std::size_t Nx = 600000;
+    const std::size_t NSteps = 2;
+
+#if ADIOS2_USE_MPI
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpiRank);
+    MPI_Comm_size(MPI_COMM_WORLD, &mpiSize);
+    const std::string fname("DeferredPutMinMax_MPI.bp");
+#else
+    const std::string fname("DeferredPutMinMax.bp");
+#endif
+
+    auto lf_Value = [&](size_t step, size_t i) {
+        if (i == Nx / 3)
+            return -1.0e6 - static_cast<double>(step);
+        if (i == 2 * Nx / 3)
+            return 1.0e6 + static_cast<double>(step);
+        return static_cast<double>(i % 1000) - 500.0 + static_cast<double>(step);
+    };
+
+#if ADIOS2_USE_MPI
+    adios2::ADIOS adios(MPI_COMM_WORLD);
+#else
+    adios2::ADIOS adios;
+#endif
+    {
+        adios2::IO io = adios.DeclareIO("DeferredMinMaxWrite");
+        if (!engineName.empty())
+        {
+            io.SetEngine(engineName);
+        }
+        if (!engineParameters.empty())
+        {
+            io.SetParameters(engineParameters);
+        }
+
+        auto var = io.DefineVariable<double>("r64", {static_cast<std::size_t>(Nx * mpiSize)},
+                                             {static_cast<std::size_t>(Nx * mpiRank)}, {Nx});
+
+        adios2::Engine bpWriter = io.Open(fname, adios2::Mode::Write);
+
+        std::vector<double> data(Nx);
+        for (size_t step = 0; step < NSteps; ++step)
+        {
+            for (size_t i = 0; i < Nx; ++i)
+            {
+                data[i] = lf_Value(step, i);
+            }
+            bpWriter.BeginStep();
+            bpWriter.Put(var, data.data(), adios2::Mode::Deferred);
+            if (step == 0)
+            {
+                bpWriter.PerformPuts();
+                // the data has been copied
+                std::fill(data.begin(), data.end(), 0.0);
+            }
+            bpWriter.EndStep();
+        }
+        bpWriter.Close();
+    }
+    // Reader
+    {
+        adios2::IO io = adios.DeclareIO("DeferredMinMaxRead");
+        if (!engineName.empty())
+        {
+            io.SetEngine(engineName);
+        }
+        if (!engineParameters.empty())
+        {
+            io.SetParameters(engineParameters);
+        }
+
+        adios2::Engine bpReader = io.Open(fname, adios2::Mode::Read);
+        std::vector<double> readData;
+        for (size_t step = 0; step < NSteps; ++step)
+        {
+            ASSERT_EQ(bpReader.BeginStep(), adios2::StepStatus::OK);
+            adios2::Variable<double> var = io.InquireVariable<double>("r64");
+            ASSERT_TRUE(var);
+            EXPECT_EQ(var.Min(), lf_Value(step, Nx / 3)) << "step " << step;
+            EXPECT_EQ(var.Max(), lf_Value(step, 2 * Nx / 3)) << "step " << step;
+
+            var.SetSelection({{static_cast<std::size_t>(Nx * mpiRank)}, {Nx}});
+            bpReader.Get(var, readData, adios2::Mode::Sync);
+            bpReader.EndStep();
+            ASSERT_EQ(readData.size(), Nx);
+            for (size_t i = 0; i < Nx; ++i)
+            {
+                ASSERT_EQ(readData[i], lf_Value(step, i)) << "step " << step << " i " << i;
+            }
+        }
+        bpReader.Close();
+    }
+}
+
 TEST_F(BPWriteReadTestADIOS2, GetDeferredInEndStep)
 {
     // Test if Get() will retrieve data in EndStep()
@@ -12,9 +12,11 @@
 
 #include <gtest/gtest.h>
 
+#include "../ProfiledEvents.h"
 #include "../SmallTestData.h"
 
-std::string engineName; // comes from command line
+std::string engineName;       // comes from command line
+std::string engineParameters; // comes from command line
 
 class BPWriteReadAsStreamTestADIOS2 : public ::testing::Test
 {
@@ -95,6 +97,10 @@ TEST_F(BPWriteReadAsStreamTestADIOS2, ADIOS2BPWriteRead1D8)
             // Create the BP Engine
             io.SetEngine("File");
         }
+        if (!engineParameters.empty())
+        {
+            io.SetParameters(engineParameters);
+        }
 
         adios2::Engine bpWriter = io.Open(fname, adios2::Mode::Write);
 
@@ -150,6 +156,10 @@ TEST_F(BPWriteReadAsStreamTestADIOS2, ADIOS2BPWriteRead1D8)
         {
             io.SetEngine(engineName);
         }
+        if (!engineParameters.empty())
+        {
+            io.SetParameters(engineParameters);
+        }
 
         adios2::Engine bpReader = io.Open(fname, adios2::Mode::Read);
 
@@ -446,6 +456,10 @@ TEST_F(BPWriteReadAsStreamTestADIOS2, ADIOS2BPWriteRead2D2x4)
             // Create the BP Engine
             io.SetEngine("File");
         }
+        if (!engineParameters.empty())
+        {
+            io.SetParameters(engineParameters);
+        }
         io.AddTransport("file");
 
         adios2::Engine bpWriter = io.Open(fname, adios2::Mode::Write);
@@ -481,6 +495,10 @@ TEST_F(BPWriteReadAsStreamTestADIOS2, ADIOS2BPWriteRead2D2x4)
         {
             io.SetEngine(engineName);
         }
+        if (!engineParameters.empty())
+        {
+            io.SetParameters(engineParameters);
+        }
 
         adios2::Engine bpReader = io.Open(fname, adios2::Mode::Read);
 
@@ -621,6 +639,27 @@ TEST_F(BPWriteReadAsStreamTestADIOS2, ADIOS2BPWriteRead2D2x4)
         EXPECT_EQ(t, NSteps);
 
         bpReader.Close();
+
+        // the Gets of a step are for adjacent blocks, read ahead from the second step on
+        if ((engineName == "BP5") && (mpiRank == 0))
+        {
+            const std::string profile = ReaderProfile(fname);
+            EXPECT_GT(ProfiledEvents(profile, "ReadCoalesced"), 0u);
+            // the coalesced reads of every step after the first reuse buffers
+            EXPECT_GT(ProfiledEvents(profile, "ReadBufferReuse"), 0u);
+            if (engineParameters.find("BufferChunkPool=true") != std::string::npos)
+            {
+                EXPECT_GT(ProfiledEvents(WriterProfile(fname), "BufferChunkReuse"), 0u);
+            }
+            if (engineParameters.find("ReadAhead=true") != std::string::npos)
+            {
+                EXPECT_GT(ProfiledEvents(profile, "ReadAheadHit"), 0u);
+            }
+            else
+            {
+                EXPECT_EQ(ProfiledEvents(profile, "ReadAheadHit"), 0u);
+            }
+        }
     }
 }
 
@@ -690,6 +729,10 @@ TEST_F(BPWriteReadAsStreamTestADIOS2, ADIOS2BPWriteRead2D4x2)
             // Create the BP Engine
             io.SetEngine("File");
         }
+        if (!engineParameters.empty())
+        {
+            io.SetParameters(engineParameters);
+        }
 
         io.AddTransport("file");
 
@@ -726,6 +769,10 @@ TEST_F(BPWriteReadAsStreamTestADIOS2, ADIOS2BPWriteRead2D4x2)
         {
             io.SetEngine(engineName);
         }
+        if (!engineParameters.empty())
+        {
+            io.SetParameters(engineParameters);
+        }
 
         adios2::Engine bpReader = io.Open(fname, adios2::Mode::Read);
 
@@ -913,6 +960,10 @@ TEST_F(BPWriteReadAsStreamTestADIOS2, ReaderWriterDefineVariable)
         {
             io.SetEngine(engineName);
         }
+        if (!engineParameters.empty())
+        {
+            io.SetParameters(engineParameters);
+        }
 
         io.DefineVariable<float>("r32", shape, start, count, adios2::ConstantDims);
 
@@ -938,6 +989,10 @@ TEST_F(BPWriteReadAsStreamTestADIOS2, ReaderWriterDefineVariable)
         {
             io.SetEngine(engineName);
         }
+        if (!engineParameters.empty())
+        {
+            io.SetParameters(engineParameters);
+        }
 
         adios2::Engine reader = io.Open(fnameFloat, adios2::Mode::Read);
         adios2::Engine writer = io.Open(fname, adios2::Mode::Write);
@@ -975,6 +1030,10 @@ TEST_F(BPWriteReadAsStreamTestADIOS2, ReaderWriterDefineVariable)
         {
             io.SetEngine(engineName);
         }
+        if (!engineParameters.empty())
+        {
+            io.SetParameters(engineParameters);
+        }
         adios2::Engine reader = io.Open(fname, adios2::Mode::Read);
         while (reader.BeginStep() == adios2::StepStatus::OK)
         {
@@ -1004,6 +1063,10 @@ int main(int argc, char **argv)
     {
         engineName = std::string(argv[1]);
     }
+    if (argc > 2)
+    {
+        engineParameters = std::string(argv[2]);
+    }
     result = RUN_ALL_TESTS();
 
 #if ADIOS2_USE_MPI
@@ -112,6 +112,76 @@ TEST_F(BPWriteReadAttributeTestMultirank, ADIOS2BPWriteReadArrayTypes)
     }
 }
 
+// ADIOS2  new attributes on every rank in a step without new variables
+TEST_F(BPWriteReadAttributeTestMultirank, ADIOS2BPWriteReadNewAttributesLaterStep)
+{
+    const std::string fName = "foo" + std::string(&adios2::PathSeparator, 1) +
+                              "ADIOS2BPWriteAttributeMultirankLaterStep.bp";
+
+    int mpiRank = 0, mpiSize = 1;
+#if ADIOS2_USE_MPI
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpiRank);
+    MPI_Comm_size(MPI_COMM_WORLD, &mpiSize);
+#endif
+
+    if (engineName == "BP3")
+    {
+        // BP3 does not support changing attributes
+        return;
+    }
+
+    auto lf_AttrName = [](int rank) { return "rank" + std::to_string(rank) + "_step1"; };
+
+#if ADIOS2_USE_MPI
+    adios2::ADIOS adios(MPI_COMM_WORLD);
+#else
+    adios2::ADIOS adios;
+#endif
+    {
+        adios2::IO io = adios.DeclareIO("TestIO");
+        if (!engineName.empty())
+        {
+            io.SetEngine(engineName);
+        }
+        // the same attribute everywhere registers the attribute format at step 0
+        io.DefineAttribute<std::string>("GlobalAttribute", "Defined on all ranks");
+        auto var = io.DefineVariable<int>("value", {static_cast<size_t>(mpiSize)},
+                                          {static_cast<size_t>(mpiRank)}, {1});
+
+        adios2::Engine engine = io.Open(fName, adios2::Mode::Write);
+        for (int step = 0; step < 3; ++step)
+        {
+            if (step == 1)
+            {
+                // every rank has a different attribute block to contribute
+                io.DefineAttribute<int>(lf_AttrName(mpiRank), mpiRank);
+            }
+            engine.BeginStep();
+            const int value = step * 100 + mpiRank;
+            engine.Put(var, value);
+            engine.EndStep();
+        }
+        engine.Close();
+    }
+    {
+        adios2::IO ioRead = adios.DeclareIO("ioRead");
+        if (!engineName.empty())
+        {
+            ioRead.SetEngine(engineName);
+        }
+        adios2::Engine bpRead = ioRead.Open(fName, adios2::Mode::ReadRandomAccess);
+        EXPECT_EQ(bpRead.Steps(), 3);
+        for (int rank = 0; rank < mpiSize; ++rank)
+        {
+            auto attr = ioRead.InquireAttribute<int>(lf_AttrName(rank));
+            ASSERT_TRUE(attr) << lf_AttrName(rank);
+            ASSERT_EQ(attr.Data().size(), 1);
+            EXPECT_EQ(attr.Data()[0], rank);
+        }
+        bpRead.Close();
+    }
+}
+
 //******************************************************************************
 // main
 //******************************************************************************
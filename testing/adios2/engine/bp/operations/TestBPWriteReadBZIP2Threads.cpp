@@ -0,0 +1,191 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ *
+ * BP5 compresses deferred blocks on CompressionThreads worker threads
+ */
+#include <cstdint>
+#include <cstring>
+
+#include <iostream>
+#include <stdexcept>
+
+#include <adios2.h>
+
+#include <gtest/gtest.h>
+
+std::string engineName; // comes from command line
+
+void BZIP2CompressionThreads(const std::string accuracy)
+{
+    // Several blocks of several variables per step, put in deferred mode
+    // so that they are compressed concurrently
+
+    int mpiRank = 0, mpiSize = 1;
+    const size_t Nx = 1000;
+    const size_t NBlocks = 4;
+    const size_t NVars = 3;
+    const size_t NSteps = 3;
+
+#if ADIOS2_USE_MPI
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpiRank);
+    MPI_Comm_size(MPI_COMM_WORLD, &mpiSize);
+    const std::string fname("BPWR_BZIP2_Threads_" + accuracy + "_MPI.bp");
+#else
+    const std::string fname("BPWR_BZIP2_Threads_" + accuracy + ".bp");
+#endif
+
+    auto lf_Value = [&](size_t step, size_t var, size_t i) -> double {
+        return static_cast<double>(step * 1000000 + var * 100000) + static_cast<double>(i % 77);
+    };
+
+#if ADIOS2_USE_MPI
+    adios2::ADIOS adios(MPI_COMM_WORLD);
+#else
+    adios2::ADIOS adios;
+#endif
+    {
+        adios2::IO io = adios.DeclareIO("TestIO");
+
+        if (!engineName.empty())
+        {
+            io.SetEngine(engineName);
+        }
+        else
+        {
+            // Create the BP Engine
+            io.SetEngine("BPFile");
+        }
+        io.SetParameter("CompressionThreads", "3");
+
+        const adios2::Dims shape{static_cast<size_t>(Nx * NBlocks * mpiSize)};
+        adios2::Operator BZIP2Op =
+            adios.DefineOperator("BZIP2Compressor", adios2::ops::LosslessBZIP2);
+
+        std::vector<adios2::Variable<double>> vars;
+        for (size_t v = 0; v < NVars; ++v)
+        {
+            vars.push_back(io.DefineVariable<double>("r64_" + std::to_string(v), shape, {0}, {Nx}));
+            vars.back().AddOperation(BZIP2Op,
+                                     {{adios2::ops::bzip2::key::blockSize100k, accuracy}});
+        }
+
+        adios2::Engine bpWriter = io.Open(fname, adios2::Mode::Write);
+
+        std::vector<std::vector<double>> data(NVars * NBlocks, std::vector<double>(Nx));
+        for (size_t step = 0; step < NSteps; ++step)
+        {
+            bpWriter.BeginStep();
+            for (size_t v = 0; v < NVars; ++v)
+            {
+                for (size_t b = 0; b < NBlocks; ++b)
+                {
+                    const size_t offset = (mpiRank * NBlocks + b) * Nx;
+                    auto &block = data[v * NBlocks + b];
+                    for (size_t i = 0; i < Nx; ++i)
+                    {
+                        block[i] = lf_Value(step, v, offset + i);
+                    }
+                    vars[v].SetSelection({{offset}, {Nx}});
+                    bpWriter.Put(vars[v], block.data());
+                }
+            }
+            bpWriter.EndStep();
+        }
+
+        bpWriter.Close();
+    }
+
+    {
+        adios2::IO io = adios.DeclareIO("ReadIO");
+
+        if (!engineName.empty())
+        {
+            io.SetEngine(engineName);
+        }
+        else
+        {
+            // Create the BP Engine
+            io.SetEngine("BPFile");
+        }
+
+        adios2::Engine bpReader = io.Open(fname, adios2::Mode::Read);
+
+        size_t t = 0;
+        std::vector<std::vector<double>> in(NVars);
+        while (bpReader.BeginStep() == adios2::StepStatus::OK)
+        {
+            for (size_t v = 0; v < NVars; ++v)
+            {
+                auto var = io.InquireVariable<double>("r64_" + std::to_string(v));
+                EXPECT_TRUE(var);
+                ASSERT_EQ(var.Shape()[0], Nx * NBlocks * mpiSize);
+                bpReader.Get(var, in[v]);
+            }
+            bpReader.EndStep();
+
+            for (size_t v = 0; v < NVars; ++v)
+            {
+                for (size_t i = 0; i < in[v].size(); ++i)
+                {
+                    ASSERT_EQ(in[v][i], lf_Value(t, v, i)) << "t=" << t << " v=" << v
+                                                           << " i=" << i << " rank=" << mpiRank;
+                }
+            }
+            ++t;
+        }
+
+        EXPECT_EQ(t, NSteps);
+
+        bpReader.Close();
+    }
+}
+
+class BPWriteReadBZIP2Threads : public ::testing::TestWithParam<std::string>
+{
+public:
+    BPWriteReadBZIP2Threads() = default;
+    virtual void SetUp(){};
+    virtual void TearDown(){};
+};
+
+TEST_P(BPWriteReadBZIP2Threads, ADIOS2BPWriteReadBZIP2CompressionThreads)
+{
+    BZIP2CompressionThreads(GetParam());
+}
+
+INSTANTIATE_TEST_SUITE_P(BZIP2Accuracy, BPWriteReadBZIP2Threads,
+                         ::testing::Values(adios2::ops::bzip2::value::blockSize100k_1,
+                                           adios2::ops::bzip2::value::blockSize100k_2,
+                                           adios2::ops::bzip2::value::blockSize100k_3,
+                                           adios2::ops::bzip2::value::blockSize100k_4,
+                                           adios2::ops::bzip2::value::blockSize100k_5,
+                                           adios2::ops::bzip2::value::blockSize100k_6,
+                                           adios2::ops::bzip2::value::blockSize100k_7,
+                                           adios2::ops::bzip2::value::blockSize100k_8,
+                                           adios2::ops::bzip2::value::blockSize100k_9));
+
+int main(int argc, char **argv)
+{
+#if ADIOS2_USE_MPI
+    int provided;
+
+    // MPI_THREAD_MULTIPLE is only required if you enable the SST MPI_DP
+    MPI_Init_thread(nullptr, nullptr, MPI_THREAD_MULTIPLE, &provided);
+#endif
+
+    int result;
+    ::testing::InitGoogleTest(&argc, argv);
+
+    if (argc > 1)
+    {
+        engineName = std::string(argv[1]);
+    }
+    result = RUN_ALL_TESTS();
+
+#if ADIOS2_USE_MPI
+    MPI_Finalize();
+#endif
+
+    return result;
+}
@@ -0,0 +1,307 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ */
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <adios2.h>
+
+#include <gtest/gtest.h>
+
+#include <sqlite3.h>
+
+/*
+ * A campaign archive (.aca) is a sqlite database that lists the datasets of a
+ * campaign. The reader opens the datasets lazily and keeps a catalog of their
+ * variables and attributes in the cache directory, which is rebuilt when the
+ * dataset files recorded in the archive change.
+ */
+
+const std::string Host = "localhost";
+const std::string CachePath = "campaign_cache";
+const std::vector<std::string> DatasetFiles = {"data.0", "md.0", "md.idx", "mmd.0"};
+const size_t Nx = 10;
+const size_t NSteps = 2;
+
+class CampaignReadTest : public ::testing::Test
+{
+public:
+    CampaignReadTest() = default;
+
+    /** values of "temp" in dataset ds at step */
+    static std::vector<float> Temp(size_t ds, size_t step)
+    {
+        std::vector<float> v(Nx);
+        for (size_t i = 0; i < Nx; ++i)
+        {
+            v[i] = static_cast<float>(ds * 100 + step * 10 + i);
+        }
+        return v;
+    }
+
+    /** writes a dataset with "temp" and "edge", and "extra" if asked */
+    static void WriteDataset(const std::string &path, size_t ds, bool extra)
+    {
+        adios2::ADIOS adios;
+        adios2::IO io = adios.DeclareIO("Write");
+        io.SetEngine("BP5");
+        auto vTemp = io.DefineVariable<float>("temp", {Nx}, {0}, {Nx});
+        // JSON has no infinity, the catalog must still carry this min/max
+        auto vEdge = io.DefineVariable<double>("edge", {3}, {0}, {3});
+        adios2::Variable<int32_t> vExtra;
+        if (extra)
+        {
+            vExtra = io.DefineVariable<int32_t>("extra");
+        }
+        io.DefineAttribute<std::string>("unit", "K");
+
+        const std::vector<double> edge = {-std::numeric_limits<double>::infinity(), 0.0,
+                                          std::numeric_limits<double>::infinity()};
+        adios2::Engine w = io.Open(path, adios2::Mode::Write);
+        for (size_t step = 0; step < NSteps; ++step)
+        {
+            w.BeginStep();
+            const std::vector<float> temp = Temp(ds, step);
+            w.Put(vTemp, temp.data());
+            w.Put(vEdge, edge.data());
+            if (extra)
+            {
+                w.Put(vExtra, static_cast<int32_t>(step + 42));
+            }
+            w.EndStep();
+        }
+        w.Close();
+    }
+
+    static void Exec(sqlite3 *db, const std::string &sql)
+    {
+        char *errmsg = nullptr;
+        if (sqlite3_exec(db, sql.c_str(), nullptr, nullptr, &errmsg) != SQLITE_OK)
+        {
+            std::string msg(errmsg ? errmsg : "");
+            sqlite3_free(errmsg);
+            throw std::runtime_error("SQL error in " + sql + ": " + msg);
+        }
+    }
+
+    static size_t FileSize(const std::string &path)
+    {
+        std::ifstream f(path, std::ios::binary | std::ios::ate);
+        return f ? static_cast<size_t>(f.tellg()) : 0;
+    }
+
+    /** records the datasets of dir in a new campaign archive; version stands
+     * for the ctime of the dataset files */
+    static void WriteCampaign(const std::string &aca, const std::string &dir,
+                              const std::vector<std::string> &datasets, int version)
+    {
+        std::remove(aca.c_str());
+        sqlite3 *db;
+        ASSERT_EQ(sqlite3_open(aca.c_str(), &db), SQLITE_OK);
+        Exec(db, "CREATE TABLE info (version TEXT)");
+        Exec(db, "CREATE TABLE host (hostname TEXT, longhostname TEXT)");
+        Exec(db, "CREATE TABLE directory (hostid INT, name TEXT)");
+        Exec(db, "CREATE TABLE bpdataset (hostid INT, dirid INT, name TEXT)");
+        Exec(db, "CREATE TABLE bpfile (bpdatasetid INT, name TEXT, compression INT, "
+                 "lenorig INT, lencompressed INT, ctime INT, data BLOB)");
+        Exec(db, "INSERT INTO info VALUES ('0.3')");
+        Exec(db, "INSERT INTO host VALUES ('" + Host + "', '" + Host + "')");
+        Exec(db, "INSERT INTO directory VALUES (1, '" + dir + "')");
+        for (size_t i = 0; i < datasets.size(); ++i)
+        {
+            Exec(db, "INSERT INTO bpdataset VALUES (1, 1, '" + datasets[i] + "')");
+            for (const auto &f : DatasetFiles)
+            {
+                const std::string len = std::to_string(FileSize(dir + "/" + datasets[i] + "/" + f));
+                Exec(db, "INSERT INTO bpfile VALUES (" + std::to_string(i + 1) + ", '" + f +
+                             "', 0, " + len + ", " + len + ", " + std::to_string(version) +
+                             ", NULL)");
+            }
+        }
+        sqlite3_close(db);
+    }
+
+    static std::string CatalogPath(const std::string &aca, const std::string &dataset)
+    {
+        return CachePath + "/" + Host + "/" + aca + "/" + dataset + "/catalog.json";
+    }
+
+    static bool FileExists(const std::string &path) { return static_cast<bool>(std::ifstream(path)); }
+
+    static adios2::Engine OpenCampaign(adios2::IO &io, const std::string &aca, bool lazy = true)
+    {
+        io.SetEngine("Campaign");
+        io.SetParameters({{"hostname", Host}, {"cachepath", CachePath}});
+        if (lazy)
+        {
+            io.SetParameters({{"LazyOpen", "true"}, {"OpenThreads", "2"}});
+        }
+        return io.Open(aca, adios2::Mode::ReadRandomAccess);
+    }
+
+    static void CheckTemp(adios2::IO &io, adios2::Engine &r, size_t ds)
+    {
+        const std::string name = "ds" + std::to_string(ds) + ".bp/temp";
+        auto v = io.InquireVariable<float>(name);
+        ASSERT_TRUE(v) << name;
+        EXPECT_EQ(v.Shape(), adios2::Dims{Nx});
+        ASSERT_EQ(v.Steps(), NSteps);
+        for (size_t step = 0; step < NSteps; ++step)
+        {
+            std::vector<float> data;
+            v.SetStepSelection({step, 1});
+            r.Get(v, data, adios2::Mode::Sync);
+            EXPECT_EQ(data, Temp(ds, step)) << name << " step " << step;
+        }
+    }
+
+    static void CheckEdgeMinMax(adios2::IO &io, size_t ds)
+    {
+        auto v = io.InquireVariable<double>("ds" + std::to_string(ds) + ".bp/edge");
+        ASSERT_TRUE(v);
+        EXPECT_EQ(v.Min(), -std::numeric_limits<double>::infinity());
+        EXPECT_EQ(v.Max(), std::numeric_limits<double>::infinity());
+    }
+};
+
+TEST_F(CampaignReadTest, FirstOpen)
+{
+    const std::string dir = "CampaignFirstOpen";
+    const std::string aca = "CampaignFirstOpen.aca";
+    WriteDataset(dir + "/ds1.bp", 1, false);
+    WriteDataset(dir + "/ds2.bp", 2, false);
+    WriteCampaign(aca, dir, {"ds1.bp", "ds2.bp"}, 1);
+    std::remove(CatalogPath(aca, "ds1.bp").c_str());
+    std::remove(CatalogPath(aca, "ds2.bp").c_str());
+
+    adios2::ADIOS adios;
+    adios2::IO io = adios.DeclareIO("Read");
+    adios2::Engine r = OpenCampaign(io, aca);
+    EXPECT_TRUE(FileExists(CatalogPath(aca, "ds1.bp")));
+    EXPECT_TRUE(FileExists(CatalogPath(aca, "ds2.bp")));
+    CheckEdgeMinMax(io, 1);
+    CheckTemp(io, r, 1);
+    CheckTemp(io, r, 2);
+    auto a = io.InquireAttribute<std::string>("ds2.bp/unit");
+    ASSERT_TRUE(a);
+    EXPECT_EQ(a.Data().front(), "K");
+    r.Close();
+}
+
+TEST_F(CampaignReadTest, CollectiveOpen)
+{
+    const std::string dir = "CampaignCollectiveOpen";
+    const std::string aca = "CampaignCollectiveOpen.aca";
+    WriteDataset(dir + "/ds1.bp", 1, false);
+    WriteDataset(dir + "/ds2.bp", 2, false);
+    WriteCampaign(aca, dir, {"ds1.bp", "ds2.bp"}, 1);
+
+    adios2::ADIOS adios;
+    adios2::IO io = adios.DeclareIO("Read");
+    adios2::Engine r = OpenCampaign(io, aca, false);
+
+    // all datasets are open, reading does not need their files any more
+    const std::vector<std::string> index = {dir + "/ds1.bp/md.idx", dir + "/ds2.bp/md.idx"};
+    for (const auto &f : index)
+    {
+        ASSERT_EQ(std::rename(f.c_str(), (f + ".moved").c_str()), 0);
+    }
+    CheckEdgeMinMax(io, 2);
+    CheckTemp(io, r, 2);
+    CheckTemp(io, r, 1);
+    for (const auto &f : index)
+    {
+        ASSERT_EQ(std::rename((f + ".moved").c_str(), f.c_str()), 0);
+    }
+    r.Close();
+}
+
+TEST_F(CampaignReadTest, OpenFromCatalog)
+{
+    const std::string dir = "CampaignFromCatalog";
+    const std::string aca = "CampaignFromCatalog.aca";
+    WriteDataset(dir + "/ds1.bp", 1, false);
+    WriteDataset(dir + "/ds2.bp", 2, false);
+    WriteCampaign(aca, dir, {"ds1.bp", "ds2.bp"}, 1);
+    std::remove(CatalogPath(aca, "ds1.bp").c_str());
+    std::remove(CatalogPath(aca, "ds2.bp").c_str());
+
+    {
+        adios2::ADIOS adios;
+        adios2::IO io = adios.DeclareIO("Build");
+        adios2::Engine r = OpenCampaign(io, aca);
+        r.Close();
+    }
+
+    // with the datasets out of reach, only the catalog can define the variables
+    const std::vector<std::string> index = {dir + "/ds1.bp/md.idx", dir + "/ds2.bp/md.idx"};
+    for (const auto &f : index)
+    {
+        ASSERT_EQ(std::rename(f.c_str(), (f + ".moved").c_str()), 0);
+    }
+    adios2::ADIOS adios;
+    adios2::IO io = adios.DeclareIO("Read");
+    adios2::Engine r = OpenCampaign(io, aca);
+    for (const auto &f : index)
+    {
+        ASSERT_EQ(std::rename((f + ".moved").c_str(), f.c_str()), 0);
+    }
+    CheckEdgeMinMax(io, 1);
+    CheckEdgeMinMax(io, 2);
+    auto a = io.InquireAttribute<std::string>("ds1.bp/unit");
+    ASSERT_TRUE(a);
+    EXPECT_EQ(a.Data().front(), "K");
+
+    // the datasets are opened on the first Get
+    CheckTemp(io, r, 2);
+    CheckTemp(io, r, 1);
+    r.Close();
+}
+
+TEST_F(CampaignReadTest, StaleCatalog)
+{
+    const std::string dir = "CampaignStaleCatalog";
+    const std::string aca = "CampaignStaleCatalog.aca";
+    WriteDataset(dir + "/ds1.bp", 1, false);
+    WriteCampaign(aca, dir, {"ds1.bp"}, 1);
+    std::remove(CatalogPath(aca, "ds1.bp").c_str());
+
+    {
+        adios2::ADIOS adios;
+        adios2::IO io = adios.DeclareIO("Old");
+        adios2::Engine r = OpenCampaign(io, aca);
+        EXPECT_FALSE(io.InquireVariable<int32_t>("ds1.bp/extra"));
+        r.Close();
+    }
+
+    // a new version of the dataset is recorded in the campaign
+    WriteDataset(dir + "/ds1.bp", 1, true);
+    WriteCampaign(aca, dir, {"ds1.bp"}, 2);
+
+    adios2::ADIOS adios;
+    adios2::IO io = adios.DeclareIO("New");
+    adios2::Engine r = OpenCampaign(io, aca);
+    auto v = io.InquireVariable<int32_t>("ds1.bp/extra");
+    ASSERT_TRUE(v);
+    EXPECT_EQ(v.Steps(), NSteps);
+    int32_t extra = 0;
+    v.SetStepSelection({1, 1});
+    r.Get(v, extra, adios2::Mode::Sync);
+    EXPECT_EQ(extra, 43);
+    CheckTemp(io, r, 1);
+    r.Close();
+}
+
+int main(int argc, char **argv)
+{
+    int result;
+    ::testing::InitGoogleTest(&argc, argv);
+    result = RUN_ALL_TESTS();
+    return result;
+}
@@ -2,6 +2,7 @@
  * Distributed under the OSI-approved Apache License, Version 2.0.  See
  * accompanying file Copyright.txt for details.
  */
+#include <algorithm>
 #include <cmath>
 #include <cstdint>
 #include <cstring>
@@ -1096,6 +1097,46 @@ TEST(ADIOS2MinMaxs, ADIOS2MinMaxs_4D_3x2x5x4)
     }
 }
 
+template <class T>
+void CheckMinMaxKernels(const size_t size)
+{
+    std::vector<T> data(size);
+    for (size_t i = 0; i < size; ++i)
+    {
+        // values go up and down, extremes somewhere inside and in the tail
+        data[i] = static_cast<T>((i * 37) % 101);
+    }
+    data[size / 3] = std::numeric_limits<T>::lowest();
+    data[size - 1] = std::numeric_limits<T>::max();
+
+    auto expected = std::minmax_element(data.begin(), data.end());
+    T min, max;
+    adios2::helper::GetMinMaxHost(data.data(), size, min, max);
+    EXPECT_EQ(min, *expected.first);
+    EXPECT_EQ(max, *expected.second);
+
+    std::vector<T> copy(size);
+    adios2::helper::CopyAndGetMinMax(data.data(), size, copy.data(), min, max);
+    EXPECT_EQ(min, *expected.first);
+    EXPECT_EQ(max, *expected.second);
+    EXPECT_EQ(copy, data);
+}
+
+TEST(ADIOS2MinMaxs, ADIOS2MinMaxs_Kernels)
+{
+    for (size_t size : {1, 2, 7, 63, 64, 65, 1000, 100003})
+    {
+        CheckMinMaxKernels<int8_t>(size);
+        CheckMinMaxKernels<uint8_t>(size);
+        CheckMinMaxKernels<int16_t>(size);
+        CheckMinMaxKernels<uint32_t>(size);
+        CheckMinMaxKernels<int64_t>(size);
+        CheckMinMaxKernels<float>(size);
+        CheckMinMaxKernels<double>(size);
+        CheckMinMaxKernels<long double>(size);
+    }
+}
+
 int main(int argc, char **argv)
 {
 
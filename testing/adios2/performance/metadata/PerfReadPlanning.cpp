@@ -0,0 +1,144 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ *
+ * PerfReadPlanning.cpp : measure reader-side read planning time for small
+ * box selections against a global array written as many blocks.  Each
+ * block stands in for one writer rank, so that the cost of traversing
+ * the metadata of large writer counts can be studied on a single node.
+ *
+ * Usage: PerfReadPlanning [--blocks n1,n2,...] [--reads n] [--steps n]
+ */
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <adios2.h>
+
+static std::vector<size_t> BlockCounts = {1024, 4096, 16384, 65536};
+static size_t NReads = 1000;
+static size_t NSteps = 2;
+static const size_t BlockEdge = 4; // each block is BlockEdge x BlockEdge
+
+static void ParseArgs(int argc, char **argv)
+{
+    while (argc > 1)
+    {
+        std::string Arg(argv[1]);
+        if ((Arg == "--blocks") && (argc > 2))
+        {
+            BlockCounts.clear();
+            std::istringstream ss(argv[2]);
+            std::string Count;
+            while (std::getline(ss, Count, ','))
+            {
+                BlockCounts.push_back(std::stoul(Count));
+            }
+            argv++;
+            argc--;
+        }
+        else if ((Arg == "--reads") && (argc > 2))
+        {
+            NReads = std::stoul(argv[2]);
+            argv++;
+            argc--;
+        }
+        else if ((Arg == "--steps") && (argc > 2))
+        {
+            NSteps = std::stoul(argv[2]);
+            argv++;
+            argc--;
+        }
+        else
+        {
+            std::cerr << "Usage: PerfReadPlanning [--blocks n1,n2,...] [--reads n] "
+                         "[--steps n]"
+                      << std::endl;
+            exit(1);
+        }
+        argv++;
+        argc--;
+    }
+}
+
+/* blocks are laid out on a square-ish 2D grid of BlockEdge x BlockEdge tiles */
+static void Write(adios2::ADIOS &adios, const std::string &fname, size_t NBlocks, size_t &GridX,
+                  size_t &GridY)
+{
+    GridX = 1;
+    while (GridX * GridX < NBlocks)
+    {
+        GridX++;
+    }
+    GridY = (NBlocks + GridX - 1) / GridX;
+
+    adios2::IO io = adios.DeclareIO("Write" + std::to_string(NBlocks));
+    io.SetEngine("BP5");
+    auto var = io.DefineVariable<double>("data", {GridX * BlockEdge, GridY * BlockEdge}, {0, 0},
+                                         {BlockEdge, BlockEdge});
+    std::vector<double> data(BlockEdge * BlockEdge);
+    adios2::Engine writer = io.Open(fname, adios2::Mode::Write);
+    for (size_t step = 0; step < NSteps; step++)
+    {
+        writer.BeginStep();
+        for (size_t b = 0; b < NBlocks; b++)
+        {
+            for (size_t i = 0; i < data.size(); i++)
+            {
+                data[i] = (double)(step * NBlocks + b);
+            }
+            var.SetSelection({{(b % GridX) * BlockEdge, (b / GridX) * BlockEdge},
+                              {BlockEdge, BlockEdge}});
+            writer.Put(var, data.data(), adios2::Mode::Sync);
+        }
+        writer.EndStep();
+    }
+    writer.Close();
+}
+
+static double Read(adios2::ADIOS &adios, const std::string &fname, size_t NBlocks, size_t GridX,
+                   size_t GridY)
+{
+    adios2::IO io = adios.DeclareIO("Read" + std::to_string(NBlocks));
+    io.SetEngine("BP5");
+    adios2::Engine reader = io.Open(fname, adios2::Mode::ReadRandomAccess);
+    auto var = io.InquireVariable<double>("data");
+
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<size_t> xdist(0, (GridX - 1) * BlockEdge);
+    std::uniform_int_distribution<size_t> ydist(0, (GridY - 1) * BlockEdge);
+    std::vector<double> in(BlockEdge * BlockEdge);
+
+    auto start = std::chrono::steady_clock::now();
+    for (size_t r = 0; r < NReads; r++)
+    {
+        var.SetStepSelection({r % NSteps, 1});
+        var.SetSelection({{xdist(gen), ydist(gen)}, {BlockEdge, BlockEdge}});
+        reader.Get(var, in.data(), adios2::Mode::Sync);
+    }
+    auto finish = std::chrono::steady_clock::now();
+    reader.Close();
+    return std::chrono::duration<double>(finish - start).count();
+}
+
+int main(int argc, char **argv)
+{
+    ParseArgs(argc, argv);
+    adios2::ADIOS adios;
+
+    std::cout << "blocks(writers)  reads  total(s)  per-read(us)" << std::endl;
+    for (const size_t NBlocks : BlockCounts)
+    {
+        const std::string fname = "PerfReadPlanning_" + std::to_string(NBlocks) + ".bp";
+        size_t GridX, GridY;
+        Write(adios, fname, NBlocks, GridX, GridY);
+        const double t = Read(adios, fname, NBlocks, GridX, GridY);
+        std::cout << NBlocks << "  " << NReads << "  " << t << "  " << (t * 1e6 / (double)NReads)
+                  << std::endl;
+    }
+    return 0;
+}
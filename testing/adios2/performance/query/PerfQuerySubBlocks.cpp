@@ -0,0 +1,196 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ *
+ * PerfQuerySubBlocks.cpp : measure how tight the result coverage of a value
+ * query on a BP5 file gets with sub-block min/max (StatsBlockSize), how long
+ * evaluating the query takes and how long reading the covered regions takes.
+ * The data is a smooth 2D ramp written as a grid of blocks, the query picks
+ * a narrow band of values that crosses every block diagonally.
+ *
+ * Usage: PerfQuerySubBlocks [--blocks n] [--edge n] [--statsblocksize n1,n2,...]
+ *                           [--queries n]
+ */
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <adios2.h>
+
+static size_t NBlocks = 16;
+static size_t BlockEdge = 256; // each block is BlockEdge x BlockEdge
+static std::vector<size_t> StatsBlockSizes = {0, 16384, 4096, 1024, 256};
+static size_t NQueries = 10;
+
+static void ParseArgs(int argc, char **argv)
+{
+    while (argc > 1)
+    {
+        std::string Arg(argv[1]);
+        if ((Arg == "--blocks") && (argc > 2))
+        {
+            NBlocks = std::stoul(argv[2]);
+            argv++;
+            argc--;
+        }
+        else if ((Arg == "--edge") && (argc > 2))
+        {
+            BlockEdge = std::stoul(argv[2]);
+            argv++;
+            argc--;
+        }
+        else if ((Arg == "--statsblocksize") && (argc > 2))
+        {
+            StatsBlockSizes.clear();
+            std::istringstream ss(argv[2]);
+            std::string Size;
+            while (std::getline(ss, Size, ','))
+            {
+                StatsBlockSizes.push_back(std::stoul(Size));
+            }
+            argv++;
+            argc--;
+        }
+        else if ((Arg == "--queries") && (argc > 2))
+        {
+            NQueries = std::stoul(argv[2]);
+            argv++;
+            argc--;
+        }
+        else
+        {
+            std::cerr << "Usage: PerfQuerySubBlocks [--blocks n] [--edge n] "
+                         "[--statsblocksize n1,n2,...] [--queries n]"
+                      << std::endl;
+            exit(1);
+        }
+        argv++;
+        argc--;
+    }
+}
+
+/* blocks are laid out on a square-ish 2D grid, value is x + y */
+static void Write(adios2::ADIOS &adios, const std::string &fname, size_t StatsBlockSize,
+                  size_t &GridX, size_t &GridY)
+{
+    GridX = 1;
+    while (GridX * GridX < NBlocks)
+    {
+        GridX++;
+    }
+    GridY = (NBlocks + GridX - 1) / GridX;
+
+    adios2::IO io = adios.DeclareIO("Write" + std::to_string(StatsBlockSize));
+    io.SetEngine("BP5");
+    io.SetParameter("StatsBlockSize", std::to_string(StatsBlockSize));
+    auto var = io.DefineVariable<double>("data", {GridX * BlockEdge, GridY * BlockEdge}, {0, 0},
+                                         {BlockEdge, BlockEdge});
+    std::vector<double> data(BlockEdge * BlockEdge);
+    adios2::Engine writer = io.Open(fname, adios2::Mode::Write);
+    writer.BeginStep();
+    for (size_t b = 0; b < NBlocks; b++)
+    {
+        const size_t x0 = (b % GridX) * BlockEdge;
+        const size_t y0 = (b / GridX) * BlockEdge;
+        for (size_t i = 0; i < BlockEdge; i++)
+        {
+            for (size_t j = 0; j < BlockEdge; j++)
+            {
+                data[i * BlockEdge + j] = (double)(x0 + i + y0 + j);
+            }
+        }
+        var.SetSelection({{x0, y0}, {BlockEdge, BlockEdge}});
+        writer.Put(var, data.data(), adios2::Mode::Sync);
+    }
+    writer.EndStep();
+    writer.Close();
+}
+
+static void WriteQuery(const std::string &queryFile, const std::string &ioName, double Low,
+                       double High)
+{
+    std::ofstream file(queryFile.c_str());
+    file << "<adios-query>" << std::endl;
+    file << " <io name=\"" << ioName << "\">" << std::endl;
+    file << "   <var name=\"data\">" << std::endl;
+    file << "       <op value=\"AND\">" << std::endl;
+    file << "         <range  compare=\"GT\" value=\"" << Low << "\"/>" << std::endl;
+    file << "         <range  compare=\"LT\" value=\"" << High << "\"/>" << std::endl;
+    file << "       </op>" << std::endl;
+    file << "   </var>" << std::endl;
+    file << " </io>" << std::endl;
+    file << "</adios-query>" << std::endl;
+}
+
+static void Query(adios2::ADIOS &adios, const std::string &fname, size_t StatsBlockSize,
+                  size_t GridX, size_t GridY)
+{
+    const std::string ioName = "Read" + std::to_string(StatsBlockSize);
+    adios2::IO io = adios.DeclareIO(ioName);
+    io.SetEngine("BP5");
+    adios2::Engine reader = io.Open(fname, adios2::Mode::Read);
+    reader.BeginStep();
+    auto var = io.InquireVariable<double>("data");
+
+    // a band of values one block edge wide along the anti-diagonal
+    const double Mid = (double)((GridX + GridY) * BlockEdge) / 2.0;
+    const std::string queryFile = "PerfQuerySubBlocks_" + ioName + ".xml";
+    WriteQuery(queryFile, ioName, Mid - BlockEdge / 2.0, Mid + BlockEdge / 2.0);
+
+    std::vector<adios2::Box<adios2::Dims>> touched;
+    auto start = std::chrono::steady_clock::now();
+    for (size_t q = 0; q < NQueries; q++)
+    {
+        adios2::QueryWorker w = adios2::QueryWorker(queryFile, reader);
+        w.GetResultCoverage(touched);
+    }
+    auto finish = std::chrono::steady_clock::now();
+    const double tQuery = std::chrono::duration<double>(finish - start).count();
+
+    size_t covered = 0;
+    for (const auto &box : touched)
+    {
+        covered += box.second[0] * box.second[1];
+    }
+    std::vector<double> in(covered);
+    start = std::chrono::steady_clock::now();
+    size_t pos = 0;
+    for (const auto &box : touched)
+    {
+        var.SetSelection(box);
+        reader.Get(var, in.data() + pos);
+        pos += box.second[0] * box.second[1];
+    }
+    reader.PerformGets();
+    finish = std::chrono::steady_clock::now();
+    const double tRead = std::chrono::duration<double>(finish - start).count();
+
+    reader.EndStep();
+    reader.Close();
+
+    const size_t total = NBlocks * BlockEdge * BlockEdge;
+    std::cout << StatsBlockSize << "  " << touched.size() << "  " << covered << "  "
+              << (100.0 * (double)covered / (double)total) << "  "
+              << (tQuery * 1e6 / (double)NQueries) << "  " << (tRead * 1e3) << std::endl;
+}
+
+int main(int argc, char **argv)
+{
+    ParseArgs(argc, argv);
+    adios2::ADIOS adios;
+
+    std::cout << "statsblocksize  boxes  covered(elems)  covered(%)  per-query(us)  read(ms)"
+              << std::endl;
+    for (const size_t StatsBlockSize : StatsBlockSizes)
+    {
+        const std::string fname = "PerfQuerySubBlocks_" + std::to_string(StatsBlockSize) + ".bp";
+        size_t GridX, GridY;
+        Write(adios, fname, StatsBlockSize, GridX, GridY);
+        Query(adios, fname, StatsBlockSize, GridX, GridY);
+    }
+    return 0;
+}
@@ -8,6 +8,7 @@
 #include <fstream>
 #include <iostream>
 #include <numeric> //std::iota
+#include <sstream>
 #include <stdexcept>
 
 #include <adios2.h>
@@ -58,6 +59,32 @@ void LoadTestData(QueryTestData &input, int step, int rank, int dataSize)
     }
 }
 
+// the query of WriteXmlQuery1D, with its values parsed as T like the query does
+template <class T>
+std::vector<adios2::Dims> ExpectedHits1D(const std::vector<T> &data, size_t offset)
+{
+    auto lf_Value = [](const std::string &str) -> T {
+        std::stringstream convert(str);
+        T value;
+        convert >> value;
+        return value;
+    };
+    const T gt = lf_Value("100.6"), lt = lf_Value("-0.17");
+    const T lo = lf_Value("2.8"), hi = lf_Value("11.9");
+
+    std::vector<adios2::Dims> hits;
+    for (size_t i = 0; i < data.size(); i++)
+    {
+        const size_t pos = offset + i;
+        if ((pos < 5) || (pos >= 85))
+            continue;
+        const T v = data[i];
+        if ((v > gt) || (v < lt) || ((v < hi) && (v > lo)))
+            hits.push_back({pos});
+    }
+    return hits;
+}
+
 class BPQueryTest : public ::testing::Test
 {
 public:
@@ -67,6 +94,7 @@ public:
     void QueryDoubleVar(const std::string &fname, adios2::ADIOS &adios,
                         const std::string &engineName);
     void QueryIntVar(const std::string &fname, adios2::ADIOS &adios, const std::string &engineName);
+    void QueryHits(const std::string &fname, adios2::ADIOS &adios, const std::string &engineName);
 
     QueryTestData m_TestData;
 
@@ -74,6 +102,10 @@ public:
     const size_t Nx = 100;
     // Number of steps
     const size_t NSteps = 3;
+    // BP5 sub-block min/max, 0 for one min/max per block
+    size_t StatsBlockSize = 0;
+    // BP5 bitmap index bins, 0 for no index
+    unsigned int QueryIndexBins = 0;
 
     int mpiRank = 0, mpiSize = 1;
 };
@@ -102,7 +134,7 @@ void BPQueryTest::QueryIntVar(const std::string &fname, adios2::ADIOS &adios,
     WriteXmlQuery1D(queryFile, ioName, "intV");
 
     std::vector<size_t> rr;
-    if (engineName.compare("BP4") == 0)
+    if ((engineName.compare("BP4") == 0) || (StatsBlockSize > 0))
         rr = {2, 1, 1};
     else
         rr = {1, 1, 1};
@@ -138,7 +170,7 @@ void BPQueryTest::QueryDoubleVar(const std::string &fname, adios2::ADIOS &adios,
     WriteXmlQuery1D(queryFile, ioName, "doubleV");
 
     std::vector<size_t> rr; //= {0,9,9};
-    if (engineName.compare("BP4") == 0)
+    if ((engineName.compare("BP4") == 0) || (StatsBlockSize > 0))
         rr = {0, 3, 1};
     else
         rr = {0, 1, 1};
@@ -153,6 +185,51 @@ void BPQueryTest::QueryDoubleVar(const std::string &fname, adios2::ADIOS &adios,
     bpReader.Close();
 }
 
+void BPQueryTest::QueryHits(const std::string &fname, adios2::ADIOS &adios,
+                            const std::string &engineName)
+{
+    std::string ioName = "IOQueryTestHits" + engineName + std::to_string(QueryIndexBins);
+    adios2::IO io = adios.DeclareIO(ioName.c_str());
+    io.SetEngine(engineName);
+
+    adios2::Engine bpReader = io.Open(fname, adios2::Mode::Read);
+
+    const std::string intQueryFile = "./" + ioName + "int.xml";
+    const std::string doubleQueryFile = "./" + ioName + "double.xml";
+    WriteXmlQuery1D(intQueryFile, ioName, "intV");
+    WriteXmlQuery1D(doubleQueryFile, ioName, "doubleV");
+
+    while (bpReader.BeginStep() == adios2::StepStatus::OK)
+    {
+        QueryTestData expected;
+        LoadTestData(expected, static_cast<int>(bpReader.CurrentStep()), 0, static_cast<int>(Nx));
+
+        std::vector<adios2::Dims> hits;
+        std::vector<std::pair<size_t, size_t>> counts;
+        size_t nCounted = 0;
+
+        adios2::QueryWorker wi = adios2::QueryWorker(intQueryFile, bpReader);
+        wi.GetResultHits(hits);
+        EXPECT_EQ(hits, ExpectedHits1D(expected.m_IntData, 0));
+        wi.GetResultHitCounts(counts);
+        for (const auto &c : counts)
+            nCounted += c.second;
+        EXPECT_EQ(nCounted, hits.size());
+
+        adios2::QueryWorker wd = adios2::QueryWorker(doubleQueryFile, bpReader);
+        wd.GetResultHits(hits);
+        EXPECT_EQ(hits, ExpectedHits1D(expected.m_DoubleData, 0));
+        wd.GetResultHitCounts(counts);
+        nCounted = 0;
+        for (const auto &c : counts)
+            nCounted += c.second;
+        EXPECT_EQ(nCounted, hits.size());
+
+        bpReader.EndStep();
+    }
+    bpReader.Close();
+}
+
 void BPQueryTest::WriteFile(const std::string &fname, adios2::ADIOS &adios,
                             const std::string &engineName)
 {
@@ -196,6 +273,14 @@ void BPQueryTest::WriteFile(const std::string &fname, adios2::ADIOS &adios,
             io.SetParameters("statslevel=1");
             io.SetParameters("statsblocksize=10");
         }
+        else if (StatsBlockSize > 0)
+        {
+            io.SetParameter("StatsBlockSize", std::to_string(StatsBlockSize));
+        }
+        if (QueryIndexBins > 0)
+        {
+            io.SetParameter("QueryIndexBins", std::to_string(QueryIndexBins));
+        }
         io.AddTransport("file");
 
         // QUESTION: It seems that BPFilterWriter cannot overwrite existing
@@ -254,6 +339,54 @@ TEST_F(BPQueryTest, BP5)
     {
         QueryDoubleVar(fname, adios, engineName);
         QueryIntVar(fname, adios, engineName);
+        QueryHits(fname, adios, engineName);
+    }
+}
+
+TEST_F(BPQueryTest, BP5SubBlocks)
+{
+    std::string engineName = "BP5";
+    // Same sub-blocks as the BP4 test, so the hits narrow down the same way
+    StatsBlockSize = 10;
+
+#if ADIOS2_USE_MPI
+    adios2::ADIOS adios(MPI_COMM_WORLD);
+    const std::string fname(engineName + "SubBlocksQuery1D_MPI.bp");
+#else
+    adios2::ADIOS adios;
+    const std::string fname(engineName + "SubBlocksQuery1D.bp");
+#endif
+
+    WriteFile(fname, adios, engineName);
+
+    if (mpiSize == 1)
+    {
+        QueryDoubleVar(fname, adios, engineName);
+        QueryIntVar(fname, adios, engineName);
+    }
+}
+
+TEST_F(BPQueryTest, BP5BitmapIndex)
+{
+    std::string engineName = "BP5";
+    // Bins straddle the query bounds, so hits come from both the bitmaps and the data
+    QueryIndexBins = 8;
+
+#if ADIOS2_USE_MPI
+    adios2::ADIOS adios(MPI_COMM_WORLD);
+    const std::string fname(engineName + "BitmapIndexQuery1D_MPI.bp");
+#else
+    adios2::ADIOS adios;
+    const std::string fname(engineName + "BitmapIndexQuery1D.bp");
+#endif
+
+    WriteFile(fname, adios, engineName);
+
+    if (mpiSize == 1)
+    {
+        QueryDoubleVar(fname, adios, engineName);
+        QueryIntVar(fname, adios, engineName);
+        QueryHits(fname, adios, engineName);
     }
 }
 
@@ -1,5 +1,6 @@
 from adios2 import Stream, LocalValueDim
 from random import randint
+import numpy as np
 
 import unittest
 
@@ -52,6 +53,49 @@ class TestStream(unittest.TestCase):
                     output = s.read("temp", start=[0], count=[2])
                     self.assertEqual(len(output), 2)
 
+    def test_read_many(self):
+        with Stream("pythonstreamtest.bp", "w") as s:
+            for _ in s.steps(5):
+                s.write("Outlook", "Good")
+                s.write("step", s.current_step())
+                s.write(
+                    "temp",
+                    content=np.arange(6, dtype=np.float64) + s.current_step(),
+                    shape=[6],
+                    start=[0],
+                    count=[6],
+                )
+                s.write("Coords", [38, -46], [], [], [2])
+
+        with Stream("pythonstreamtest.bp", "r") as s:
+            outputs = None
+            for _ in s.steps():
+                coords = s.inquire_variable("Coords")
+                coords.set_block_selection(0)
+                results = s.read_many(["Outlook", "step", "temp", coords], outputs)
+                outlook, step, temp, coords = results
+                self.assertEqual(outlook, "Good")
+                self.assertEqual(step, s.current_step())
+                self.assertTrue(np.array_equal(temp, np.arange(6) + s.current_step()))
+                self.assertTrue(np.array_equal(coords, [38, -46]))
+                if outputs is not None:
+                    # the arrays of the previous step are reused
+                    self.assertIs(temp, outputs[2])
+                    self.assertIs(coords, outputs[3])
+                outputs = [None, None, temp, coords]
+
+                with self.assertRaises(ValueError):
+                    s.read("temp", output=np.empty(5))
+                with self.assertRaises(ValueError):
+                    s.read("temp", output=np.empty((2, 3)))
+                # a bad output fails before any read is queued
+                with self.assertRaises(ValueError):
+                    s.read_many(["step", "temp"], [None, np.empty(5)])
+                self.assertEqual(s.read("step"), s.current_step())
+                part = s.read("temp", start=[2], count=[3], output=np.empty(3))
+                self.assertTrue(np.array_equal(part, np.arange(2, 5) + s.current_step()))
+                s.inquire_variable("temp").set_selection([[0], [6]])
+
 
 if __name__ == "__main__":
     unittest.main()
@@ -0,0 +1,83 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ */
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include <adios2/toolkit/format/bp5/BP5ReadBufferPool.h>
+
+#include <gtest/gtest.h>
+
+namespace adios2
+{
+namespace format
+{
+
+TEST(BP5ReadBufferPool, Reuse)
+{
+    BP5ReadBufferPool pool(1024 * 1024);
+
+    char *a = pool.Get(1000);
+    memset(a, 0xef, 1000);
+    pool.Release(a);
+
+    // same size class, the buffer comes back
+    char *b = pool.Get(900);
+    EXPECT_EQ(a, b);
+    // a different size class needs a new buffer
+    char *c = pool.Get(100000);
+    EXPECT_NE(b, c);
+    memset(c, 0xfe, 100000);
+    pool.Release(b);
+    pool.Release(c);
+
+    auto stats = pool.GetStats();
+    EXPECT_EQ(stats.Gets, 3U);
+    EXPECT_EQ(stats.Hits, 1U);
+    EXPECT_GE(stats.HighWaterBytes, 100000U + 1000U);
+    EXPECT_EQ(stats.AllocatedBytes, stats.RetainedBytes);
+
+    pool.Trim();
+    stats = pool.GetStats();
+    EXPECT_EQ(stats.AllocatedBytes, 0U);
+    EXPECT_EQ(stats.RetainedBytes, 0U);
+}
+
+TEST(BP5ReadBufferPool, RetainLimit)
+{
+    BP5ReadBufferPool pool(0);
+
+    char *a = pool.Get(1000);
+    pool.Release(a);
+    auto stats = pool.GetStats();
+    EXPECT_EQ(stats.RetainedBytes, 0U);
+    EXPECT_EQ(stats.AllocatedBytes, 0U);
+
+    pool.SetMaxRetainedBytes(64 * 1024);
+    std::vector<char *> buffers;
+    for (int i = 0; i < 32; i++)
+    {
+        buffers.push_back(pool.Get(4096));
+    }
+    for (auto buf : buffers)
+    {
+        pool.Release(buf);
+    }
+    stats = pool.GetStats();
+    EXPECT_LE(stats.RetainedBytes, 64U * 1024U);
+    EXPECT_EQ(stats.AllocatedBytes, stats.RetainedBytes);
+    EXPECT_EQ(stats.HighWaterBytes, 32U * 4096U);
+}
+
+} // end namespace format
+} // end namespace adios2
+
+int main(int argc, char **argv)
+{
+    int result;
+    ::testing::InitGoogleTest(&argc, argv);
+    result = RUN_ALL_TESTS();
+    return result;
+}
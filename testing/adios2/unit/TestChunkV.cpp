@@ -8,10 +8,12 @@
 
 #include <iostream>
 #include <limits>
+#include <memory>
 #include <stdexcept>
 
 #include <adios2.h>
 #include <adios2/common/ADIOSTypes.h>
+#include <adios2/toolkit/format/buffer/chunk/ChunkPool.h>
 #include <adios2/toolkit/format/buffer/chunk/ChunkV.h>
 
 #include <gtest/gtest.h>
@@ -136,6 +138,52 @@ TEST(ChunkV, AlignmentToMemBlockSize)
         ASSERT_EQ(chunk1[AllocSize - 1], AllocSize - 1);
     }
 }
+
+TEST(ChunkV, PooledChunksAcrossSteps)
+{
+    size_t MemBlockSize = 32;
+    size_t ChunkSize = 160;
+    auto Pool = std::make_shared<ChunkPool>(ChunkSize, 16, true, false);
+
+    size_t nChunks = 0;
+    for (size_t step = 0; step < 3; ++step)
+    {
+        {
+            ChunkV b = ChunkV("test", false, 16, MemBlockSize, ChunkSize, Pool);
+            /* a few chunks worth of small allocations, the same every step */
+            for (uint8_t i = 0; i < 9; ++i)
+            {
+                adios2::format::BufferV::BufferPos pos = b.Allocate(48, 8);
+                uint8_t *ptr =
+                    reinterpret_cast<uint8_t *>(b.GetPtr(pos.bufferIdx, pos.posInBuffer));
+                memset(ptr, i, 48);
+            }
+            /* a block larger than a chunk does not come from the pool */
+            std::vector<uint8_t> big(1000, 7);
+            b.AddToVec(big.size(), big.data(), 1, true);
+
+            std::vector<core::iovec> vec = b.DataVec();
+            if (step == 0)
+            {
+                nChunks = vec.size() - 1;
+            }
+            ASSERT_EQ(vec.size(), nChunks + 1);
+            ASSERT_EQ(vec.back().iov_len, big.size());
+            const uint8_t *last = reinterpret_cast<const uint8_t *>(vec.back().iov_base);
+            ASSERT_EQ(last[999], 7);
+        }
+        /* all chunks are back in the pool, none above the high-water mark */
+        Pool->Trim();
+    }
+
+    auto stats = Pool->GetStats();
+    ASSERT_GT(nChunks, 1U);
+    ASSERT_EQ(stats.Gets, 3 * nChunks);
+    ASSERT_EQ(stats.Allocations, nChunks);
+    ASSERT_EQ(stats.Reuses, 2 * nChunks);
+    ASSERT_EQ(stats.HighWater, nChunks);
+    ASSERT_EQ(stats.Frees, 0U);
+}
 }
 }
 
@@ -0,0 +1,189 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ */
+#include <cstdint>
+#include <cstring>
+#include <unordered_set>
+#include <vector>
+
+#include <adios2/toolkit/kvcache/LocalKVCache.h>
+
+#ifndef _WIN32
+#include <dirent.h>
+#include <unistd.h> // truncate
+#endif
+
+#include <gtest/gtest.h>
+
+namespace adios2
+{
+namespace kvcache
+{
+
+static std::string Key(const std::string &prefix, size_t start, size_t count)
+{
+    QueryBox box(1);
+    box.Start[0] = start;
+    box.Count[0] = count;
+    return prefix + box.toString();
+}
+
+// a cache without room drops everything left from earlier runs
+static void Clear(const std::string &path)
+{
+    LocalKVCache cache(path, 0);
+    cache.OpenConnection();
+    cache.CloseConnection();
+}
+
+TEST(LocalKVCache, SetGetPersist)
+{
+    const std::string path = "LocalKVCache.SetGetPersist";
+    Clear(path);
+    std::vector<double> a(100), b(50);
+    for (size_t i = 0; i < a.size(); ++i)
+    {
+        a[i] = static_cast<double>(i);
+    }
+    for (size_t i = 0; i < b.size(); ++i)
+    {
+        b[i] = -static_cast<double>(i);
+    }
+    {
+        LocalKVCache cache(path, 1024 * 1024);
+        cache.OpenConnection();
+        cache.Set(Key("fp|v0", 0, 100).c_str(), a.size() * sizeof(double), a.data());
+        cache.AppendCommandInBatch(Key("fp|v0", 100, 50).c_str(), 0, b.size() * sizeof(double),
+                                   b.data());
+        cache.ExecuteBatch(Key("fp|v0", 100, 50).c_str(), 0, 0, nullptr);
+        cache.Set(Key("fp|w0", 0, 50).c_str(), b.size() * sizeof(double), b.data());
+        EXPECT_EQ(cache.Size(), (a.size() + 2 * b.size()) * sizeof(double));
+        cache.CloseConnection();
+    }
+
+    // a new process finds the blocks of the previous one
+    LocalKVCache cache(path, 1024 * 1024);
+    cache.OpenConnection();
+    EXPECT_TRUE(cache.Exists(Key("fp|v0", 0, 100)));
+    EXPECT_TRUE(cache.Exists(Key("fp|v0", 100, 50)));
+    EXPECT_FALSE(cache.Exists(Key("fp|v0", 0, 50)));
+
+    std::unordered_set<std::string> keys;
+    cache.KeyPrefixExistence("fp|v0", keys);
+    EXPECT_EQ(keys.size(), 2U);
+    EXPECT_EQ(keys.count(Key("fp|v0", 100, 50)), 1U);
+
+    std::vector<double> in(100);
+    cache.AppendCommandInBatch(Key("fp|v0", 0, 100).c_str(), 1, 0, nullptr);
+    EXPECT_TRUE(cache.ExecuteBatch(Key("fp|v0", 0, 100).c_str(), 1, in.size() * sizeof(double),
+                                   in.data()));
+    EXPECT_EQ(in, a);
+    in.resize(50);
+    EXPECT_TRUE(cache.Get(Key("fp|w0", 0, 50).c_str(), in.size() * sizeof(double), in.data()));
+    EXPECT_EQ(in, b);
+    cache.CloseConnection();
+}
+
+TEST(LocalKVCache, EvictLeastRecentlyUsed)
+{
+    const std::string path = "LocalKVCache.EvictLeastRecentlyUsed";
+    Clear(path);
+    std::vector<char> block(1000, 'x');
+    {
+        LocalKVCache cache(path, 3500);
+        cache.OpenConnection();
+        cache.Set("k1", block.size(), block.data());
+        cache.Set("k2", block.size(), block.data());
+        cache.Set("k3", block.size(), block.data());
+        // k1 becomes the most recently used, k2 the least
+        cache.Get("k1", block.size(), block.data());
+        cache.Set("k4", block.size(), block.data());
+        EXPECT_TRUE(cache.Exists("k1"));
+        EXPECT_FALSE(cache.Exists("k2"));
+        EXPECT_TRUE(cache.Exists("k3"));
+        EXPECT_TRUE(cache.Exists("k4"));
+        EXPECT_EQ(cache.Size(), 3000U);
+        // larger than the whole cache, not cached
+        std::vector<char> big(4000, 'y');
+        cache.Set("big", big.size(), big.data());
+        EXPECT_FALSE(cache.Exists("big"));
+        cache.CloseConnection();
+    }
+
+    // a smaller limit drops the least recently used blocks when opening
+    LocalKVCache cache(path, 2000);
+    cache.OpenConnection();
+    EXPECT_TRUE(cache.Exists("k1"));
+    EXPECT_FALSE(cache.Exists("k3"));
+    EXPECT_TRUE(cache.Exists("k4"));
+    EXPECT_EQ(cache.Size(), 2000U);
+    cache.CloseConnection();
+}
+
+TEST(LocalKVCache, RemovedByAnotherProcess)
+{
+    const std::string path = "LocalKVCache.RemovedByAnotherProcess";
+    Clear(path);
+    std::vector<char> block(1000, 'x');
+    {
+        LocalKVCache writer(path, 1024 * 1024);
+        writer.OpenConnection();
+        writer.Set("k1", block.size(), block.data());
+        writer.Set("k2", block.size(), block.data());
+        writer.CloseConnection();
+    }
+    LocalKVCache cache(path, 1024 * 1024);
+    cache.OpenConnection();
+    EXPECT_TRUE(cache.Exists("k1"));
+    EXPECT_TRUE(cache.Exists("k2"));
+
+    // another process evicts everything after the reader checked for the blocks
+    Clear(path);
+    EXPECT_FALSE(cache.Get("k1", block.size(), block.data()));
+    EXPECT_FALSE(cache.Exists("k1"));
+    cache.AppendCommandInBatch("k2", 1, 0, nullptr);
+    EXPECT_FALSE(cache.ExecuteBatch("k2", 1, block.size(), block.data()));
+    EXPECT_FALSE(cache.Exists("k2"));
+    cache.CloseConnection();
+}
+
+#ifndef _WIN32
+TEST(LocalKVCache, TruncatedByAnotherProcess)
+{
+    const std::string path = "LocalKVCache.TruncatedByAnotherProcess";
+    Clear(path);
+    std::vector<char> block(100000, 'x');
+    LocalKVCache cache(path, 1024 * 1024);
+    cache.OpenConnection();
+    cache.Set("k1", block.size(), block.data());
+    ASSERT_TRUE(cache.Exists("k1"));
+
+    // the block file is shorter than the index says, a miss instead of SIGBUS
+    DIR *dir = opendir(path.c_str());
+    ASSERT_NE(dir, nullptr);
+    while (struct dirent *entry = readdir(dir))
+    {
+        const std::string name(entry->d_name);
+        if ((name.size() > 4) && (name.substr(name.size() - 4) == ".blk"))
+        {
+            ASSERT_EQ(truncate((path + "/" + name).c_str(), 10), 0);
+        }
+    }
+    closedir(dir);
+    EXPECT_FALSE(cache.Get("k1", block.size(), block.data()));
+    EXPECT_FALSE(cache.Exists("k1"));
+    cache.CloseConnection();
+}
+#endif
+
+} // end namespace kvcache
+} // end namespace adios2
+
+int main(int argc, char **argv)
+{
+    int result;
+    ::testing::InitGoogleTest(&argc, argv);
+    result = RUN_ALL_TESTS();
+    return result;
+}
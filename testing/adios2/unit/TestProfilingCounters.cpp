@@ -0,0 +1,161 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ */
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <adios2/helper/adiosCommDummy.h>
+#include <adios2/toolkit/profiling/iochrono/Counters.h>
+#include <adios2/toolkit/profiling/iochrono/IOChrono.h>
+
+#include <gtest/gtest.h>
+
+namespace adios2
+{
+namespace profiling
+{
+
+TEST(ProfilingCounters, Names)
+{
+    EXPECT_STREQ(TimerName(TimerID::DataRead), "DataRead");
+    EXPECT_STREQ(BytesName(BytesID::metadataread), "metadataread");
+    EXPECT_STREQ(EventName(EventID::MetadataStepInstall), "MetadataStepInstall");
+
+    TimerID timer;
+    ASSERT_TRUE(FindTimer("ES_meta1", timer));
+    EXPECT_EQ(timer, TimerID::ES_meta1);
+    EXPECT_FALSE(FindTimer("no_such_timer", timer));
+
+    BytesID bytes;
+    ASSERT_TRUE(FindBytes("dataread", bytes));
+    EXPECT_EQ(bytes, BytesID::dataread);
+    EXPECT_FALSE(FindBytes("DataRead", bytes));
+}
+
+TEST(ProfilingCounters, Threads)
+{
+    Counters counters;
+    const size_t nThreads = 4;
+    const size_t nCalls = 1000;
+
+    auto lf_Count = [&]() {
+        for (size_t i = 0; i < nCalls; ++i)
+        {
+            counters.Start(TimerID::ReadUnit);
+            counters.AddBytes(BytesID::dataread, 10);
+            counters.AddEvents(EventID::MetadataStepInstall);
+            counters.Stop(TimerID::ReadUnit);
+        }
+    };
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < nThreads; ++t)
+    {
+        threads.emplace_back(lf_Count);
+    }
+    for (auto &t : threads)
+    {
+        t.join();
+    }
+    // a second round of threads reuses the slots of the first one
+    threads.clear();
+    for (size_t t = 0; t < nThreads; ++t)
+    {
+        threads.emplace_back(lf_Count);
+    }
+    for (auto &t : threads)
+    {
+        t.join();
+    }
+
+    EXPECT_EQ(counters.GetCalls(TimerID::ReadUnit), 2 * nThreads * nCalls);
+    EXPECT_EQ(counters.GetBytes(BytesID::dataread), 2 * nThreads * nCalls * 10);
+    EXPECT_EQ(counters.GetEvents(EventID::MetadataStepInstall), 2 * nThreads * nCalls);
+    EXPECT_EQ(counters.GetEvents(EventID::MetadataStepRelease), 0U);
+    EXPECT_GE(counters.GetTime(TimerID::ReadUnit), 0);
+    EXPECT_EQ(counters.GetCalls(TimerID::DataRead), 0U);
+
+    // Stop without Start is not counted
+    counters.Stop(TimerID::DataRead);
+    EXPECT_EQ(counters.GetCalls(TimerID::DataRead), 0U);
+}
+
+TEST(ProfilingCounters, Trace)
+{
+    Counters counters;
+    const int rank = 3;
+
+    // no tracing: only the process name
+    counters.Start(TimerID::ES);
+    counters.Stop(TimerID::ES);
+    std::string json = counters.GetTraceJSON(rank);
+    EXPECT_NE(json.find("\"process_name\""), std::string::npos);
+    EXPECT_EQ(json.find("\"ph\":\"X\""), std::string::npos);
+
+    // the ring keeps the last 4 intervals
+    counters.EnableTrace(4);
+    for (size_t i = 0; i < 3; ++i)
+    {
+        counters.Start(TimerID::PP);
+        counters.Stop(TimerID::PP);
+    }
+    for (size_t i = 0; i < 2; ++i)
+    {
+        counters.Start(TimerID::ES);
+        counters.Stop(TimerID::ES);
+    }
+    json = counters.GetTraceJSON(rank);
+
+    auto lf_Count = [&](const std::string &what) {
+        size_t n = 0;
+        for (size_t pos = json.find(what); pos != std::string::npos;
+             pos = json.find(what, pos + 1))
+        {
+            ++n;
+        }
+        return n;
+    };
+    EXPECT_EQ(lf_Count("\"ph\":\"X\""), 4U);
+    EXPECT_EQ(lf_Count("\"name\":\"PP\""), 2U);
+    EXPECT_EQ(lf_Count("\"name\":\"ES\""), 2U);
+    EXPECT_EQ(lf_Count("\"pid\":3"), 5U);
+    EXPECT_EQ(counters.GetCalls(TimerID::ES), 3U);
+}
+
+TEST(ProfilingCounters, LongIntervals)
+{
+    helper::Comm comm = helper::CommDummy();
+    JSONProfiler profiler(comm);
+
+    // ES lists its intervals over 10 ms, ReadUnit never does
+    profiler.Start(TimerID::ES);
+    profiler.Stop(TimerID::ES);
+    profiler.Start(TimerID::ES);
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    profiler.Stop(TimerID::ES);
+    profiler.Start(TimerID::ReadUnit);
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    profiler.Stop(TimerID::ReadUnit);
+
+    const std::string json = profiler.GetRankProfilingJSON({}, {});
+    const size_t es = json.find("\"ES\":{");
+    ASSERT_NE(es, std::string::npos);
+    const size_t trace = json.find("\"trace\":[\"", es);
+    ASSERT_NE(trace, std::string::npos);
+    EXPECT_LT(trace, json.find('}', es));
+    // a single "start+duration" entry
+    EXPECT_EQ(json.find("\",\"", trace), std::string::npos);
+    EXPECT_NE(json.find("\"ReadUnit\":{\"mus\":"), std::string::npos);
+    EXPECT_EQ(json.find("\"trace\"", trace + 1), std::string::npos);
+}
+
+} // end namespace profiling
+} // end namespace adios2
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}